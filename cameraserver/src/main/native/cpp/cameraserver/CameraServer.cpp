@@ -4,6 +4,7 @@
 
 #include "cameraserver/CameraServer.h"
 
+#include <algorithm>
 #include <atomic>
 #include <vector>
 
@@ -73,6 +74,8 @@ struct Instance {
   std::string m_primarySourceName;
   wpi::StringMap<cs::VideoSource> m_sources;
   wpi::StringMap<cs::VideoSink> m_sinks;
+  std::vector<cs::VideoSource> m_switchedCameras;
+  cs::VideoSink m_switchedServer;
   wpi::DenseMap<CS_Sink, CS_Source> m_fixedSources;
   wpi::DenseMap<CS_Source, SourcePublisher> m_publishers;
   std::shared_ptr<nt::NetworkTable> m_publishTable{
@@ -560,6 +563,64 @@ cs::MjpegServer CameraServer::AddSwitchedCamera(std::string_view name) {
   return server;
 }
 
+cs::MjpegServer CameraServer::StartSwitchedCapture(
+    std::span<const cs::VideoSource> cameras) {
+  auto& inst = ::GetInstance();
+  for (auto& camera : cameras) {
+    AddCamera(camera);
+  }
+  auto server = AddServer("switched");
+  {
+    std::scoped_lock lock(inst.m_mutex);
+    inst.m_switchedCameras.assign(cameras.begin(), cameras.end());
+    inst.m_switchedServer = server;
+  }
+  if (!cameras.empty()) {
+    server.SetSource(cameras[0]);
+  }
+  return server;
+}
+
+void CameraServer::SelectSwitchedCamera(int index) {
+  auto& inst = ::GetInstance();
+  cs::VideoSource source;
+  cs::VideoSink server;
+  {
+    std::scoped_lock lock(inst.m_mutex);
+    if (index < 0 ||
+        static_cast<size_t>(index) >= inst.m_switchedCameras.size()) {
+      auto csShared = GetCameraServerShared();
+      csShared->SetCameraServerError("switched camera index {} out of range",
+                                     index);
+      return;
+    }
+    source = inst.m_switchedCameras[index];
+    server = inst.m_switchedServer;
+  }
+  server.SetSource(source);
+}
+
+void CameraServer::SelectSwitchedCamera(std::string_view name) {
+  auto& inst = ::GetInstance();
+  cs::VideoSource source;
+  cs::VideoSink server;
+  {
+    std::scoped_lock lock(inst.m_mutex);
+    auto it =
+        std::find_if(inst.m_switchedCameras.begin(),
+                     inst.m_switchedCameras.end(),
+                     [&](const auto& camera) { return camera.GetName() == name; });
+    if (it == inst.m_switchedCameras.end()) {
+      auto csShared = GetCameraServerShared();
+      csShared->SetCameraServerError("could not find switched camera {}", name);
+      return;
+    }
+    source = *it;
+    server = inst.m_switchedServer;
+  }
+  server.SetSource(source);
+}
+
 cs::MjpegServer CameraServer::StartAutomaticCapture(
     const cs::VideoSource& camera) {
   AddCamera(camera);
@@ -174,6 +174,43 @@ class CameraServer {
    */
   static cs::MjpegServer AddSwitchedCamera(std::string_view name);
 
+  /**
+   * Start capturing from multiple cameras through a single switched MJPEG
+   * server.
+   *
+   * All cameras are added to the server list, but only one MjpegServer is
+   * created; SelectSwitchedCamera() swaps its active source.  The dashboard
+   * stays connected to one port across switches, and since the server passes
+   * MJPEG frames through unmodified when the camera is already outputting
+   * MJPEG (and the client doesn't request a different resolution or
+   * compression), switching never pays a decode/re-encode.
+   *
+   * The first camera in the list is initially selected.
+   *
+   * @param cameras Cameras to serve
+   */
+  static cs::MjpegServer StartSwitchedCapture(
+      std::span<const cs::VideoSource> cameras);
+
+  /**
+   * Selects the active camera of the switched server created by
+   * StartSwitchedCapture().  The swap happens atomically in cscore; connected
+   * clients simply receive the next frame from the new camera.
+   *
+   * @param index Index of the camera in the list passed to
+   *              StartSwitchedCapture()
+   */
+  static void SelectSwitchedCamera(int index);
+
+  /**
+   * Selects the active camera of the switched server created by
+   * StartSwitchedCapture().  The swap happens atomically in cscore; connected
+   * clients simply receive the next frame from the new camera.
+   *
+   * @param name Camera name
+   */
+  static void SelectSwitchedCamera(std::string_view name);
+
   /**
    * Get OpenCV access to the primary camera feed.  This allows you to
    * get images from the camera for image processing on the roboRIO.
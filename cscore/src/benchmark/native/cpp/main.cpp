@@ -0,0 +1,290 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <stdint.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <fmt/format.h>
+#include <opencv2/core/core.hpp>
+#include <wpi/Logger.h>
+#include <wpinet/TCPConnector.h>
+#include <wpinet/raw_socket_istream.h>
+
+#include "cscore.h"
+#include "cscore_cv.h"
+#include "cscore_raw.h"
+
+// Global allocation counters.  Every operator new in the process is counted,
+// so the per-stage numbers below include allocations made by cscore worker
+// threads during the measurement window.  A warmed-up image pool should show
+// near-zero allocations per frame.
+static std::atomic<uint64_t> gAllocCount{0};
+static std::atomic<uint64_t> gAllocBytes{0};
+
+void* operator new(std::size_t size) {
+  gAllocCount.fetch_add(1, std::memory_order_relaxed);
+  gAllocBytes.fetch_add(size, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size)) {
+    return ptr;
+  }
+  throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size) {
+  gAllocCount.fetch_add(1, std::memory_order_relaxed);
+  gAllocBytes.fetch_add(size, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size)) {
+    return ptr;
+  }
+  throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+void operator delete(void* ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+void operator delete[](void* ptr) noexcept {
+  std::free(ptr);
+}
+void operator delete[](void* ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
+namespace {
+
+void Report(std::string_view name, int frames, double seconds, uint64_t allocs,
+            uint64_t allocBytes, uint64_t streamBytes = 0) {
+  if (frames <= 0 || seconds <= 0) {
+    fmt::print("{:<36} no frames\n", name);
+    return;
+  }
+  fmt::print("{:<36} {:>8.1f} fps {:>8.1f} allocs/frame {:>8.1f} KiB "
+             "alloc/frame",
+             name, frames / seconds, static_cast<double>(allocs) / frames,
+             static_cast<double>(allocBytes) / frames / 1024.0);
+  if (streamBytes != 0) {
+    fmt::print(" {:>8.2f} MB/s", streamBytes / seconds / 1e6);
+  }
+  fmt::print("\n");
+}
+
+cv::Mat MakeTestImage(int width, int height) {
+  cv::Mat image{height, width, CV_8UC3};
+  for (int y = 0; y < height; ++y) {
+    uchar* row = image.ptr(y);
+    for (int x = 0; x < width; ++x) {
+      row[3 * x] = static_cast<uchar>(x);
+      row[3 * x + 1] = static_cast<uchar>(y);
+      row[3 * x + 2] = static_cast<uchar>(x + y);
+    }
+  }
+  return image;
+}
+
+// CvSource::PutFrame -> pool image -> CvSink::GrabFrame; exercises
+// SourceImpl's image pool and the BGR fast path (no pixel conversion).
+void BenchPutGrabLoop(int width, int height, double seconds) {
+  cs::CvSource source{"benchSource", cs::VideoMode::kBGR, width, height, 30};
+  cs::CvSink sink{"benchSink"};
+  sink.SetSource(source);
+
+  cv::Mat in = MakeTestImage(width, height);
+  cv::Mat out;
+
+  // warm up the image pool
+  for (int i = 0; i < 10; ++i) {
+    source.PutFrame(in);
+    [[maybe_unused]] auto time = sink.GrabFrameNoTimeout(out);
+  }
+
+  uint64_t startAllocs = gAllocCount;
+  uint64_t startAllocBytes = gAllocBytes;
+  auto start = std::chrono::steady_clock::now();
+  auto stop = start + std::chrono::duration<double>(seconds);
+  int frames = 0;
+  while (std::chrono::steady_clock::now() < stop) {
+    source.PutFrame(in);
+    if (sink.GrabFrameNoTimeout(out) != 0) {
+      ++frames;
+    }
+  }
+  double elapsed = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+  Report(fmt::format("put+grab BGR {}x{}", width, height), frames, elapsed,
+         gAllocCount - startAllocs, gAllocBytes - startAllocBytes);
+}
+
+// RawSource YUYV frames -> CvSink BGR; every grab pays a pixel format
+// conversion.
+void BenchYuyvConversion(int width, int height, double seconds) {
+  CS_Status status = 0;
+  CS_Source source = cs::CreateRawSource(
+      "benchYuyvSource", {cs::VideoMode::kYUYV, width, height, 30}, &status);
+  CS_Sink sink = cs::CreateCvSink("benchYuyvSink", &status);
+  cs::SetSinkSource(sink, source, &status);
+
+  std::vector<uchar> yuyv(static_cast<size_t>(width) * height * 2);
+  for (size_t i = 0; i < yuyv.size(); ++i) {
+    yuyv[i] = static_cast<uchar>(i);
+  }
+  CS_RawFrame raw;
+  raw.data = reinterpret_cast<char*>(yuyv.data());
+  raw.dataLength = static_cast<int>(yuyv.size());
+  raw.totalData = static_cast<int>(yuyv.size());
+  raw.pixelFormat = CS_PIXFMT_YUYV;
+  raw.width = width;
+  raw.height = height;
+
+  cv::Mat out;
+  for (int i = 0; i < 10; ++i) {
+    cs::PutSourceFrame(source, raw, &status);
+    [[maybe_unused]] auto time = cs::GrabSinkFrame(sink, out, &status);
+  }
+
+  uint64_t startAllocs = gAllocCount;
+  uint64_t startAllocBytes = gAllocBytes;
+  auto start = std::chrono::steady_clock::now();
+  auto stop = start + std::chrono::duration<double>(seconds);
+  int frames = 0;
+  while (std::chrono::steady_clock::now() < stop) {
+    cs::PutSourceFrame(source, raw, &status);
+    if (cs::GrabSinkFrame(sink, out, &status) != 0) {
+      ++frames;
+    }
+  }
+  double elapsed = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+  Report(fmt::format("put+grab YUYV->BGR {}x{}", width, height), frames,
+         elapsed, gAllocCount - startAllocs, gAllocBytes - startAllocBytes);
+
+  cs::ReleaseSink(sink, &status);
+  cs::ReleaseSource(source, &status);
+}
+
+// Counts multipart boundaries across read chunks, keeping a short tail so
+// boundaries split between chunks are still found.
+struct BoundaryCounter {
+  explicit BoundaryCounter(std::string_view needle) : m_needle{needle} {}
+
+  void Process(std::string_view data) {
+    m_buf.append(data.data(), data.size());
+    size_t pos = 0;
+    while ((pos = m_buf.find(m_needle, pos)) != std::string::npos) {
+      ++count;
+      pos += m_needle.size();
+    }
+    if (m_buf.size() > m_needle.size() - 1) {
+      m_buf.erase(0, m_buf.size() - (m_needle.size() - 1));
+    }
+  }
+
+  int count = 0;
+
+ private:
+  std::string m_needle;
+  std::string m_buf;
+};
+
+// CvSource -> MjpegServerImpl -> loopback TCP clients; exercises the JPEG
+// encode (shared across clients by the frame conversion cache) and the
+// connection threads' socket writes.
+void BenchMjpegServer(int numClients, double seconds, int port) {
+  cs::CvSource source{"benchServerSource", cs::VideoMode::kBGR, 640, 480, 30};
+  cs::MjpegServer server{"benchServer", port};
+  server.SetSource(source);
+
+  wpi::Logger logger;
+  std::atomic_bool active{true};
+  std::atomic<uint64_t> totalBytes{0};
+  std::atomic<int> totalFrames{0};
+  std::vector<std::thread> clients;
+  for (int i = 0; i < numClients; ++i) {
+    clients.emplace_back([&] {
+      auto stream = wpi::TCPConnector::connect("127.0.0.1", port, logger, 1);
+      if (!stream) {
+        return;
+      }
+      std::string_view req = "GET /stream.mjpg HTTP/1.0\r\n\r\n";
+      wpi::NetworkStream::Error err;
+      stream->send(req.data(), req.size(), &err);
+      wpi::raw_socket_istream is{*stream, 1};
+      BoundaryCounter counter{"--boundarydonotcross"};
+      char buf[4096];
+      while (active && !is.has_error()) {
+        is.read(buf, sizeof(buf));
+        if (is.has_error()) {
+          break;
+        }
+        totalBytes += sizeof(buf);
+        counter.Process({buf, sizeof(buf)});
+      }
+      totalFrames += counter.count;
+    });
+  }
+
+  // let the clients connect and the first frames prime the pools
+  cv::Mat in = MakeTestImage(640, 480);
+  auto warmupStop =
+      std::chrono::steady_clock::now() + std::chrono::milliseconds(500);
+  while (std::chrono::steady_clock::now() < warmupStop) {
+    source.PutFrame(in);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+
+  uint64_t startAllocs = gAllocCount;
+  uint64_t startAllocBytes = gAllocBytes;
+  auto start = std::chrono::steady_clock::now();
+  auto stop = start + std::chrono::duration<double>(seconds);
+  while (std::chrono::steady_clock::now() < stop) {
+    source.PutFrame(in);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  double elapsed = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+  uint64_t allocs = gAllocCount - startAllocs;
+  uint64_t allocBytes = gAllocBytes - startAllocBytes;
+
+  active = false;
+  for (auto& thr : clients) {
+    thr.join();
+  }
+
+  Report(fmt::format("mjpeg server, {} client(s)", numClients), totalFrames,
+         elapsed, allocs, allocBytes, totalBytes);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  // Seconds per stage; pass a larger value (e.g. 300) for a soak run.
+  double seconds = 5.0;
+  if (argc > 1) {
+    seconds = std::strtod(argv[1], nullptr);
+    if (seconds <= 0) {
+      seconds = 5.0;
+    }
+  }
+
+  fmt::print("cscore benchmarks ({} s per stage)\n", seconds);
+  BenchPutGrabLoop(640, 480, seconds);
+  BenchPutGrabLoop(1280, 720, seconds);
+  BenchYuyvConversion(640, 480, seconds);
+  BenchMjpegServer(1, seconds, 18080);
+  BenchMjpegServer(4, seconds, 18081);
+  return EXIT_SUCCESS;
+}
@@ -335,7 +335,15 @@ public class CameraServerJNI {
   //
   public enum TelemetryKind {
     kSourceBytesReceived(1),
-    kSourceFramesReceived(2);
+    kSourceFramesReceived(2),
+    kSourceConversionCacheHits(3),
+    kSourceConversionCacheMisses(4),
+    kSourceDispatchLatencyP50(5),
+    kSourceDispatchLatencyP99(6),
+    kSourceConvertLatencyP50(7),
+    kSourceConvertLatencyP99(8),
+    kSinkWriteLatencyP50(9),
+    kSinkWriteLatencyP99(10);
 
     private final int value;
 
@@ -0,0 +1,143 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "ConvertKernels.h"
+
+#include <cstdint>
+
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace cs {
+
+// BT.601 video-range YUV to RGB coefficients in 13-bit fixed point:
+//   C = Y - 16, D = U - 128, E = V - 128
+//   R = 1.164 C           + 1.596 E
+//   G = 1.164 C - 0.391 D - 0.813 E
+//   B = 1.164 C + 2.018 D
+static constexpr int kYC = 9539;    // 1.164 * 8192
+static constexpr int kVR = 13074;   // 1.596 * 8192
+static constexpr int kUG = -3203;   // -0.391 * 8192
+static constexpr int kVG = -6660;   // -0.813 * 8192
+static constexpr int kUB = 16531;   // 2.018 * 8192
+static constexpr int kRound = 1 << 12;
+
+static inline uchar ClampU8(int x) {
+  return static_cast<uchar>(x < 0 ? 0 : (x > 255 ? 255 : x));
+}
+
+void YUYVToBGR(const uchar* src, uchar* dst, int width, int height) {
+  int pairs = (width / 2) * height;
+
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+  // Process 8 macropixels (16 output pixels) per iteration, with the same
+  // 13-bit coefficients and round-to-nearest behavior as the scalar loop
+  const int16x4_t yc = vdup_n_s16(kYC);
+  const int16x4_t vr = vdup_n_s16(kVR);
+  const int16x4_t ug = vdup_n_s16(kUG);
+  const int16x4_t vg = vdup_n_s16(kVG);
+  const int16x4_t ub = vdup_n_s16(kUB);
+  while (pairs >= 8) {
+    uint8x8x4_t yuyv = vld4_u8(src);  // y0, u, y1, v for 8 macropixels
+
+    int16x8_t c0 = vreinterpretq_s16_u16(vsubl_u8(yuyv.val[0], vdup_n_u8(16)));
+    int16x8_t c1 = vreinterpretq_s16_u16(vsubl_u8(yuyv.val[2], vdup_n_u8(16)));
+    int16x8_t d = vsubq_s16(
+        vreinterpretq_s16_u16(vmovl_u8(yuyv.val[1])), vdupq_n_s16(128));
+    int16x8_t e = vsubq_s16(
+        vreinterpretq_s16_u16(vmovl_u8(yuyv.val[3])), vdupq_n_s16(128));
+
+    // Per-macropixel chroma offsets (32-bit, 10-bit fixed point)
+    int32x4_t rOffLo = vmull_s16(vget_low_s16(e), vr);
+    int32x4_t rOffHi = vmull_s16(vget_high_s16(e), vr);
+    int32x4_t gOffLo = vmlal_s16(vmull_s16(vget_low_s16(d), ug),
+                                 vget_low_s16(e), vg);
+    int32x4_t gOffHi = vmlal_s16(vmull_s16(vget_high_s16(d), ug),
+                                 vget_high_s16(e), vg);
+    int32x4_t bOffLo = vmull_s16(vget_low_s16(d), ub);
+    int32x4_t bOffHi = vmull_s16(vget_high_s16(d), ub);
+
+    int32x4_t y0Lo = vmull_s16(vget_low_s16(c0), yc);
+    int32x4_t y0Hi = vmull_s16(vget_high_s16(c0), yc);
+    int32x4_t y1Lo = vmull_s16(vget_low_s16(c1), yc);
+    int32x4_t y1Hi = vmull_s16(vget_high_s16(c1), yc);
+
+    // Narrow with rounding right shift and saturate to u8
+    auto narrow = [](int32x4_t lo, int32x4_t hi) {
+      return vqmovun_s16(vcombine_s16(vqrshrn_n_s32(lo, 13),
+                                      vqrshrn_n_s32(hi, 13)));
+    };
+    uint8x8_t b0 = narrow(vaddq_s32(y0Lo, bOffLo), vaddq_s32(y0Hi, bOffHi));
+    uint8x8_t g0 = narrow(vaddq_s32(y0Lo, gOffLo), vaddq_s32(y0Hi, gOffHi));
+    uint8x8_t r0 = narrow(vaddq_s32(y0Lo, rOffLo), vaddq_s32(y0Hi, rOffHi));
+    uint8x8_t b1 = narrow(vaddq_s32(y1Lo, bOffLo), vaddq_s32(y1Hi, bOffHi));
+    uint8x8_t g1 = narrow(vaddq_s32(y1Lo, gOffLo), vaddq_s32(y1Hi, gOffHi));
+    uint8x8_t r1 = narrow(vaddq_s32(y1Lo, rOffLo), vaddq_s32(y1Hi, rOffHi));
+
+    // Interleave even/odd pixels back into BGRBGR... order
+    uint8x8x2_t b = vzip_u8(b0, b1);
+    uint8x8x2_t g = vzip_u8(g0, g1);
+    uint8x8x2_t r = vzip_u8(r0, r1);
+    uint8x8x3_t bgrLo{b.val[0], g.val[0], r.val[0]};
+    uint8x8x3_t bgrHi{b.val[1], g.val[1], r.val[1]};
+    vst3_u8(dst, bgrLo);
+    vst3_u8(dst + 24, bgrHi);
+
+    src += 32;
+    dst += 48;
+    pairs -= 8;
+  }
+#endif
+
+  for (; pairs > 0; --pairs) {
+    int c0 = kYC * (src[0] - 16);
+    int c1 = kYC * (src[2] - 16);
+    int d = src[1] - 128;
+    int e = src[3] - 128;
+    int rOff = kVR * e + kRound;
+    int gOff = kUG * d + kVG * e + kRound;
+    int bOff = kUB * d + kRound;
+    dst[0] = ClampU8((c0 + bOff) >> 13);
+    dst[1] = ClampU8((c0 + gOff) >> 13);
+    dst[2] = ClampU8((c0 + rOff) >> 13);
+    dst[3] = ClampU8((c1 + bOff) >> 13);
+    dst[4] = ClampU8((c1 + gOff) >> 13);
+    dst[5] = ClampU8((c1 + rOff) >> 13);
+    src += 4;
+    dst += 6;
+  }
+}
+
+void BGRToRGB565(const uchar* src, uchar* dst, int width, int height) {
+  int count = width * height;
+  auto out = reinterpret_cast<uint16_t*>(dst);
+  // Simple shift-and-or packing; auto-vectorizes on both NEON and SSE
+  for (int i = 0; i < count; ++i) {
+    out[i] = static_cast<uint16_t>((src[3 * i + 2] >> 3) |
+                                   ((src[3 * i + 1] >> 2) << 5) |
+                                   ((src[3 * i] >> 3) << 11));
+  }
+}
+
+void Downscale2x(const uchar* src, int srcWidth, int srcHeight, int channels,
+                 uchar* dst) {
+  int dstWidth = srcWidth / 2;
+  int dstHeight = srcHeight / 2;
+  int srcStride = srcWidth * channels;
+  for (int y = 0; y < dstHeight; ++y) {
+    const uchar* row0 = src + (2 * y) * srcStride;
+    const uchar* row1 = row0 + srcStride;
+    for (int x = 0; x < dstWidth; ++x) {
+      for (int ch = 0; ch < channels; ++ch) {
+        int i = 2 * x * channels + ch;
+        *dst++ = static_cast<uchar>(
+            (row0[i] + row0[i + channels] + row1[i] + row1[i + channels] + 2) >>
+            2);
+      }
+    }
+  }
+}
+
+}  // namespace cs
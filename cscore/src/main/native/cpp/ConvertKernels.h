@@ -0,0 +1,32 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#ifndef CSCORE_CONVERTKERNELS_H_
+#define CSCORE_CONVERTKERNELS_H_
+
+#include <opencv2/core/core.hpp>
+
+namespace cs {
+
+// Dedicated kernels for the fixed hot conversions between pooled Image
+// buffers.  These avoid the generic OpenCV dispatch and operate directly on
+// the raw buffers; YUYVToBGR has a NEON path for ARM coprocessors.
+
+// Converts packed YUYV (YUY2) to BGR using BT.601 video-range coefficients
+// (same convention as cv::COLOR_YUV2BGR_YUYV).  width must be even.
+void YUYVToBGR(const uchar* src, uchar* dst, int width, int height);
+
+// Packs BGR pixels into 16-bit 565 format with the same bit layout as
+// cv::cvtColor with cv::COLOR_RGB2BGR565 on BGR input.
+void BGRToRGB565(const uchar* src, uchar* dst, int width, int height);
+
+// Downscales an image by exactly 2x in each dimension by averaging each 2x2
+// block per channel.  srcWidth and srcHeight must be even; dst is
+// (srcWidth / 2) x (srcHeight / 2) with the same number of channels.
+void Downscale2x(const uchar* src, int srcWidth, int srcHeight, int channels,
+                 uchar* dst);
+
+}  // namespace cs
+
+#endif  // CSCORE_CONVERTKERNELS_H_
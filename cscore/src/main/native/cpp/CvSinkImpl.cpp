@@ -4,15 +4,22 @@
 
 #include "CvSinkImpl.h"
 
+#include <limits>
+#include <memory>
+#include <span>
+
 #include <opencv2/core/core.hpp>
 #include <opencv2/highgui/highgui.hpp>
 #include <opencv2/imgproc/imgproc.hpp>
 #include <wpi/SmallString.h>
+#include <wpi/SmallVector.h>
+#include <wpi/timestamp.h>
 
 #include "Handle.h"
 #include "Instance.h"
 #include "Log.h"
 #include "Notifier.h"
+#include "PropertyImpl.h"
 #include "c_util.h"
 #include "cscore_cpp.h"
 
@@ -22,13 +29,23 @@ CvSinkImpl::CvSinkImpl(std::string_view name, wpi::Logger& logger,
                        Notifier& notifier, Telemetry& telemetry)
     : SinkImpl{name, logger, notifier, telemetry} {
   m_active = true;
+  // Frames to skip between grabs (0 = return every frame)
+  m_frameSkipProp = CreateProperty("frame_skip", [] {
+    return std::make_unique<PropertyImpl>("frame_skip", CS_PROP_INTEGER, 1, 0,
+                                          0);
+  });
   // m_thread = std::thread(&CvSinkImpl::ThreadMain, this);
 }
 
 CvSinkImpl::CvSinkImpl(std::string_view name, wpi::Logger& logger,
                        Notifier& notifier, Telemetry& telemetry,
                        std::function<void(uint64_t time)> processFrame)
-    : SinkImpl{name, logger, notifier, telemetry} {}
+    : SinkImpl{name, logger, notifier, telemetry} {
+  m_frameSkipProp = CreateProperty("frame_skip", [] {
+    return std::make_unique<PropertyImpl>("frame_skip", CS_PROP_INTEGER, 1, 0,
+                                          0);
+  });
+}
 
 CvSinkImpl::~CvSinkImpl() {
   Stop();
@@ -58,7 +75,8 @@ uint64_t CvSinkImpl::GrabFrame(cv::Mat& image) {
     return 0;
   }
 
-  auto frame = source->GetNextFrame();  // blocks
+  auto frame = source->GetNextFrame(
+      m_lastFrameSeq, GetProperty(m_frameSkipProp)->value + 1);  // blocks
   if (!frame) {
     // Bad frame; sleep for 20 ms so we don't consume all processor time.
     std::this_thread::sleep_for(std::chrono::milliseconds(20));
@@ -84,7 +102,9 @@ uint64_t CvSinkImpl::GrabFrame(cv::Mat& image, double timeout) {
     return 0;
   }
 
-  auto frame = source->GetNextFrame(timeout);  // blocks
+  auto frame = source->GetNextFrame(
+      m_lastFrameSeq, GetProperty(m_frameSkipProp)->value + 1,
+      timeout);  // blocks
   if (!frame) {
     // Bad frame; sleep for 20 ms so we don't consume all processor time.
     std::this_thread::sleep_for(std::chrono::milliseconds(20));
@@ -174,6 +194,79 @@ uint64_t GrabSinkFrameTimeout(CS_Sink sink, cv::Mat& image, double timeout,
   return static_cast<CvSinkImpl&>(*data->sink).GrabFrame(image, timeout);
 }
 
+uint64_t GrabSinkFramesSynced(std::span<const CS_Sink> sinks,
+                              std::span<cv::Mat> images, double epsilon,
+                              double timeout, CS_Status* status) {
+  if (sinks.empty() || sinks.size() != images.size()) {
+    *status = CS_INVALID_HANDLE;
+    return 0;
+  }
+  auto& inst = Instance::GetInstance();
+
+  // Collect the sources; keep the sinks alive for the duration of the wait.
+  wpi::SmallVector<std::shared_ptr<SinkData>, 4> datas;
+  wpi::SmallVector<std::shared_ptr<SourceImpl>, 4> sources;
+  for (auto sink : sinks) {
+    auto data = inst.GetSink(sink);
+    if (!data || data->kind != CS_SINK_CV) {
+      *status = CS_INVALID_HANDLE;
+      return 0;
+    }
+    static_cast<CvSinkImpl&>(*data->sink).SetEnabled(true);
+    auto source = data->sink->GetSource();
+    if (!source) {
+      *status = CS_SOURCE_IS_DISCONNECTED;
+      return 0;
+    }
+    datas.emplace_back(std::move(data));
+    sources.emplace_back(std::move(source));
+  }
+
+  auto epsilonUs = static_cast<uint64_t>(epsilon * 1e6);
+  auto deadline = wpi::Now() + static_cast<uint64_t>(timeout * 1e6);
+  wpi::SmallVector<Frame, 4> frames;
+  for (;;) {
+    // Look at each source's current frame and find the one furthest behind.
+    frames.clear();
+    uint64_t minTime = (std::numeric_limits<uint64_t>::max)();
+    uint64_t maxTime = 0;
+    size_t laggard = 0;
+    bool valid = true;
+    for (size_t i = 0; i < sources.size(); ++i) {
+      frames.emplace_back(sources[i]->GetCurFrame());
+      uint64_t time = frames.back().GetTime();
+      if (!frames.back() || time == 0) {
+        valid = false;
+      }
+      if (time < minTime) {
+        minTime = time;
+        laggard = i;
+      }
+      if (time > maxTime) {
+        maxTime = time;
+      }
+    }
+
+    if (valid && maxTime - minTime <= epsilonUs) {
+      // Matched set; only now pay for conversions.
+      for (size_t i = 0; i < frames.size(); ++i) {
+        if (!frames[i].GetCv(images[i])) {
+          return 0;  // signal error
+        }
+      }
+      return minTime;
+    }
+
+    // Not matched; wait for a new frame from the laggard.  The stale frames
+    // are dropped without conversion.
+    auto now = wpi::Now();
+    if (now >= deadline) {
+      return 0;  // signal timeout
+    }
+    sources[laggard]->GetNextFrame((deadline - now) * 1e-6);
+  }
+}
+
 std::string GetSinkError(CS_Sink sink, CS_Status* status) {
   auto data = Instance::GetInstance().GetSink(sink);
   if (!data || (data->kind & SinkMask) == 0) {
@@ -245,6 +338,14 @@ uint64_t CS_GrabSinkFrameTimeoutCpp(CS_Sink sink, cv::Mat* image,
   return cs::GrabSinkFrameTimeout(sink, *image, timeout, status);
 }
 
+uint64_t CS_GrabSinkFramesSyncedCpp(const CS_Sink* sinks, int sinkCount,
+                                    cv::Mat* images, double epsilon,
+                                    double timeout, CS_Status* status) {
+  return cs::GrabSinkFramesSynced({sinks, static_cast<size_t>(sinkCount)},
+                                  {images, static_cast<size_t>(sinkCount)},
+                                  epsilon, timeout, status);
+}
+
 char* CS_GetSinkError(CS_Sink sink, CS_Status* status) {
   wpi::SmallString<128> buf;
   auto str = cs::GetSinkError(sink, buf, status);
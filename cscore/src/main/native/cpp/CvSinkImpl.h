@@ -42,6 +42,10 @@ class CvSinkImpl : public SinkImpl {
   std::atomic_bool m_active;  // set to false to terminate threads
   std::thread m_thread;
   std::function<void(uint64_t time)> m_processFrame;
+  int m_frameSkipProp;
+  // Sequence number of the last frame grabbed (only touched by the grabbing
+  // thread via SourceImpl::GetNextFrame)
+  uint64_t m_lastFrameSeq{0};
 };
 
 }  // namespace cs
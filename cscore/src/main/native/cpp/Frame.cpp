@@ -5,14 +5,19 @@
 #include "Frame.h"
 
 #include <cstdlib>
+#include <cstring>
 
 #include <opencv2/core/core.hpp>
 #include <opencv2/highgui/highgui.hpp>
 #include <opencv2/imgproc/imgproc.hpp>
+#include <wpi/timestamp.h>
 
+#include "ConvertKernels.h"
 #include "Instance.h"
+#include "JpegCodec.h"
 #include "Log.h"
 #include "SourceImpl.h"
+#include "Telemetry.h"
 
 using namespace cs;
 
@@ -195,6 +200,23 @@ Image* Frame::GetNearestImage(int width, int height,
   return m_impl->images.empty() ? nullptr : m_impl->images[0];
 }
 
+Image* Frame::MakeOwnedCopy(Image* image) {
+  // The OpenCV conversion functions require an image backed by the internal
+  // vector, so copy the borrowed data into a pooled image first.
+  auto newImage = m_impl->source.AllocImage(
+      image->pixelFormat, image->width, image->height, image->size());
+  std::memcpy(newImage->data(), image->data(), image->size());
+  newImage->jpegQuality = image->jpegQuality;
+
+  // Save the result
+  Image* rv = newImage.release();
+  if (m_impl) {
+    std::scoped_lock lock(m_impl->mutex);
+    m_impl->images.push_back(rv);
+  }
+  return rv;
+}
+
 Image* Frame::ConvertImpl(Image* image, VideoMode::PixelFormat pixelFormat,
                           int requiredJpegQuality, int defaultJpegQuality) {
   if (!image || image->Is(image->width, image->height, pixelFormat,
@@ -202,6 +224,9 @@ Image* Frame::ConvertImpl(Image* image, VideoMode::PixelFormat pixelFormat,
     return image;
   }
   Image* cur = image;
+  if (cur->IsExternal()) {
+    cur = MakeOwnedCopy(cur);
+  }
 
   // If the source image is a JPEG, we need to decode it before we can do
   // anything else with it.  Note that if the destination format is JPEG, we
@@ -294,8 +319,8 @@ Image* Frame::ConvertMJPEGToBGR(Image* image) {
                                 image->width * image->height * 3);
 
   // Decode
-  cv::Mat newMat = newImage->AsMat();
-  cv::imdecode(image->AsInputArray(), cv::IMREAD_COLOR, &newMat);
+  JpegDecode(image->str(), image->width, image->height, 3,
+             reinterpret_cast<uchar*>(newImage->data()));
 
   // Save the result
   Image* rv = newImage.release();
@@ -317,8 +342,8 @@ Image* Frame::ConvertMJPEGToGray(Image* image) {
                                 image->width * image->height);
 
   // Decode
-  cv::Mat newMat = newImage->AsMat();
-  cv::imdecode(image->AsInputArray(), cv::IMREAD_GRAYSCALE, &newMat);
+  JpegDecode(image->str(), image->width, image->height, 1,
+             reinterpret_cast<uchar*>(newImage->data()));
 
   // Save the result
   Image* rv = newImage.release();
@@ -340,7 +365,9 @@ Image* Frame::ConvertYUYVToBGR(Image* image) {
                                 image->width * image->height * 3);
 
   // Convert
-  cv::cvtColor(image->AsMat(), newImage->AsMat(), cv::COLOR_YUV2BGR_YUYV);
+  YUYVToBGR(reinterpret_cast<const uchar*>(image->data()),
+            reinterpret_cast<uchar*>(newImage->data()), image->width,
+            image->height);
 
   // Save the result
   Image* rv = newImage.release();
@@ -362,7 +389,9 @@ Image* Frame::ConvertBGRToRGB565(Image* image) {
                                 image->width * image->height * 2);
 
   // Convert
-  cv::cvtColor(image->AsMat(), newImage->AsMat(), cv::COLOR_RGB2BGR565);
+  BGRToRGB565(reinterpret_cast<const uchar*>(image->data()),
+              reinterpret_cast<uchar*>(newImage->data()), image->width,
+              image->height);
 
   // Save the result
   Image* rv = newImage.release();
@@ -459,14 +488,8 @@ Image* Frame::ConvertBGRToMJPEG(Image* image, int quality) {
                                 image->width * image->height * 1.5);
 
   // Compress
-  if (m_impl->compressionParams.empty()) {
-    m_impl->compressionParams.push_back(cv::IMWRITE_JPEG_QUALITY);
-    m_impl->compressionParams.push_back(quality);
-  } else {
-    m_impl->compressionParams[1] = quality;
-  }
-  cv::imencode(".jpg", image->AsMat(), newImage->vec(),
-               m_impl->compressionParams);
+  JpegEncode(reinterpret_cast<const uchar*>(image->data()), image->width,
+             image->height, 3, quality, &newImage->vec());
 
   // Save the result
   Image* rv = newImage.release();
@@ -494,14 +517,8 @@ Image* Frame::ConvertGrayToMJPEG(Image* image, int quality) {
                                 image->width * image->height * 0.75);
 
   // Compress
-  if (m_impl->compressionParams.empty()) {
-    m_impl->compressionParams.push_back(cv::IMWRITE_JPEG_QUALITY);
-    m_impl->compressionParams.push_back(quality);
-  } else {
-    m_impl->compressionParams[1] = quality;
-  }
-  cv::imencode(".jpg", image->AsMat(), newImage->vec(),
-               m_impl->compressionParams);
+  JpegEncode(reinterpret_cast<const uchar*>(image->data()), image->width,
+             image->height, 1, quality, &newImage->vec());
 
   // Save the result
   Image* rv = newImage.release();
@@ -518,8 +535,19 @@ Image* Frame::GetImageImpl(int width, int height,
   std::scoped_lock lock(m_impl->mutex);
   Image* cur = GetNearestImage(width, height, pixelFormat, requiredJpegQuality);
   if (!cur || cur->Is(width, height, pixelFormat, requiredJpegQuality)) {
+    // Converted images are kept on the frame, so sinks requesting the same
+    // format/resolution/quality share a single conversion; count reuse of a
+    // previously converted image as a cache hit.
+    if (cur && cur != m_impl->images[0]) {
+      m_impl->source.m_telemetry.RecordSourceConversionCacheHit(m_impl->source);
+    }
     return cur;
   }
+  m_impl->source.m_telemetry.RecordSourceConversionCacheMiss(m_impl->source);
+  auto convertStart = wpi::Now();
+  if (cur->IsExternal()) {
+    cur = MakeOwnedCopy(cur);
+  }
 
   WPI_DEBUG4(Instance::GetInstance().logger,
              "converting image from {}x{} type {} to {}x{} type {}", cur->width,
@@ -541,9 +569,18 @@ Image* Frame::GetImageImpl(int width, int height,
         cur->pixelFormat, width, height,
         width * height * (cur->size() / (cur->width * cur->height)));
 
-    // Resize
-    cv::Mat newMat = newImage->AsMat();
-    cv::resize(cur->AsMat(), newMat, newMat.size(), 0, 0);
+    // Resize; use the dedicated 2x downscale kernel for the common "half
+    // resolution" stream request on unpacked formats
+    if (cur->width == 2 * width && cur->height == 2 * height &&
+        (cur->pixelFormat == VideoMode::kBGR ||
+         cur->pixelFormat == VideoMode::kGray)) {
+      Downscale2x(reinterpret_cast<const uchar*>(cur->data()), cur->width,
+                  cur->height, cur->pixelFormat == VideoMode::kBGR ? 3 : 1,
+                  reinterpret_cast<uchar*>(newImage->data()));
+    } else {
+      cv::Mat newMat = newImage->AsMat();
+      cv::resize(cur->AsMat(), newMat, newMat.size(), 0, 0);
+    }
 
     // Save the result
     cur = newImage.release();
@@ -551,7 +588,11 @@ Image* Frame::GetImageImpl(int width, int height,
   }
 
   // Convert to output format
-  return ConvertImpl(cur, pixelFormat, requiredJpegQuality, defaultJpegQuality);
+  Image* converted =
+      ConvertImpl(cur, pixelFormat, requiredJpegQuality, defaultJpegQuality);
+  m_impl->source.m_telemetry.RecordSourceConvertLatency(
+      m_impl->source, wpi::Now() - convertStart);
+  return converted;
 }
 
 bool Frame::GetCv(cv::Mat& image, int width, int height) {
@@ -10,7 +10,6 @@
 #include <string>
 #include <string_view>
 #include <utility>
-#include <vector>
 
 #include <wpi/SmallVector.h>
 #include <wpi/mutex.h>
@@ -38,7 +37,6 @@ class Frame {
     SourceImpl& source;
     std::string error;
     wpi::SmallVector<Image*, 4> images;
-    std::vector<int> compressionParams;
   };
 
  public:
@@ -123,6 +121,20 @@ class Frame {
     return m_impl->images[0]->jpegQuality;
   }
 
+  // DMABUF fd of the original captured image's backing store, or -1 if it
+  // isn't backed by an exported kernel buffer.  The fd remains valid as
+  // long as this Frame holds a reference.
+  int GetDmaBufFd() const {
+    if (!m_impl) {
+      return -1;
+    }
+    std::scoped_lock lock(m_impl->mutex);
+    if (m_impl->images.empty()) {
+      return -1;
+    }
+    return m_impl->images[0]->dmabufFd;
+  }
+
   Image* GetExistingImage(size_t i = 0) const {
     if (!m_impl) {
       return nullptr;
@@ -220,6 +232,7 @@ class Frame {
   bool GetCv(cv::Mat& image, int width, int height);
 
  private:
+  Image* MakeOwnedCopy(Image* image);
   Image* ConvertImpl(Image* image, VideoMode::PixelFormat pixelFormat,
                      int requiredJpegQuality, int defaultJpegQuality);
   Image* GetImageImpl(int width, int height, VideoMode::PixelFormat pixelFormat,
@@ -8,6 +8,7 @@
 #include <wpi/StringExtras.h>
 #include <wpi/timestamp.h>
 #include <wpinet/TCPConnector.h>
+#include <wpinet/buffered_raw_socket_istream.h>
 
 #include "Handle.h"
 #include "Instance.h"
@@ -97,11 +98,16 @@ void HttpCameraImpl::MonitorThreadMain() {
 }
 
 void HttpCameraImpl::StreamThreadMain() {
+  bool skipSleep = false;
   while (m_active) {
     SetConnected(false);
 
-    // sleep between retries
-    std::this_thread::sleep_for(std::chrono::milliseconds(250));
+    // sleep between retries, unless the last stream ended cleanly (e.g.
+    // a settings update); in that case reconnect immediately
+    if (!skipSleep) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(250));
+    }
+    skipSleep = false;
 
     // disconnect if not enabled
     if (!IsEnabled()) {
@@ -133,8 +139,10 @@ void HttpCameraImpl::StreamThreadMain() {
     // update connected since we're actually connected
     SetConnected(true);
 
-    // stream
-    DeviceStream(conn->is, boundary.str());
+    // stream; read through a buffered stream so boundary and header
+    // scanning doesn't pay a socket receive per small read
+    wpi::buffered_raw_socket_istream is{*conn->stream, 1};
+    skipSleep = DeviceStream(is, boundary.str());
     {
       std::unique_lock lock(m_mutex);
       m_streamConn = nullptr;
@@ -225,7 +233,7 @@ wpi::HttpConnection* HttpCameraImpl::DeviceStreamConnect(
   return conn;
 }
 
-void HttpCameraImpl::DeviceStream(wpi::raw_istream& is,
+bool HttpCameraImpl::DeviceStream(wpi::raw_istream& is,
                                   std::string_view boundary) {
   // Stored here so we reuse it from frame to frame
   std::string imageBuf;
@@ -265,6 +273,8 @@ void HttpCameraImpl::DeviceStream(wpi::raw_istream& is,
       numErrors = 0;
     }
   }
+
+  return !is.has_error() && numErrors < 3;
 }
 
 bool HttpCameraImpl::DeviceStreamFrame(wpi::raw_istream& is,
@@ -102,7 +102,9 @@ class HttpCameraImpl : public SourceImpl {
   // Functions used by StreamThreadMain()
   wpi::HttpConnection* DeviceStreamConnect(
       wpi::SmallVectorImpl<char>& boundary);
-  void DeviceStream(wpi::raw_istream& is, std::string_view boundary);
+  // Returns true if the stream ended cleanly (settings update, sink
+  // disabled, or end-of-stream marker) rather than from a stream error.
+  bool DeviceStream(wpi::raw_istream& is, std::string_view boundary);
   bool DeviceStreamFrame(wpi::raw_istream& is, std::string& imageBuf);
 
   // The camera settings thread
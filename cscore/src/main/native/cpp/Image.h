@@ -5,7 +5,9 @@
 #ifndef CSCORE_IMAGE_H_
 #define CSCORE_IMAGE_H_
 
+#include <functional>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 #include <opencv2/core/core.hpp>
@@ -32,6 +34,18 @@ class Image {
   }
 #endif
 
+  // Constructs an image backed by externally owned storage (e.g. a mapped
+  // V4L2 buffer).  The release function is called when the image is
+  // destroyed; external images are never returned to the source image pool.
+  Image(const uchar* data, size_t size, std::function<void()> release)
+      : m_extData{data}, m_extSize{size}, m_release{std::move(release)} {}
+
+  ~Image() {
+    if (m_release) {
+      m_release();
+    }
+  }
+
   Image(const Image&) = delete;
   Image& operator=(const Image&) = delete;
 
@@ -43,16 +57,26 @@ class Image {
     return {data(), size()};
   }
   size_t capacity() const {
-    return m_data.capacity();
+    return m_extData ? m_extSize : m_data.capacity();
   }
   const char* data() const {
-    return reinterpret_cast<const char*>(m_data.data());
+    return m_extData ? reinterpret_cast<const char*>(m_extData)
+                     : reinterpret_cast<const char*>(m_data.data());
   }
   char* data() {
-    return reinterpret_cast<char*>(m_data.data());
+    return m_extData
+               ? const_cast<char*>(reinterpret_cast<const char*>(m_extData))
+               : reinterpret_cast<char*>(m_data.data());
   }
   size_t size() const {
-    return m_data.size();
+    return m_extData ? m_extSize : m_data.size();
+  }
+
+  // Returns true if the image borrows externally owned storage.  External
+  // images can't be resized or used with the OpenCV conversion functions;
+  // Frame copies them into a pooled image before converting.
+  bool IsExternal() const {
+    return m_extData != nullptr;
   }
 
   const std::vector<uchar>& vec() const {
@@ -85,7 +109,7 @@ class Image {
         type = CV_8UC1;
         break;
     }
-    return cv::Mat{height, width, type, m_data.data()};
+    return cv::Mat{height, width, type, data()};
   }
 
   cv::_InputArray AsInputArray() {
@@ -122,11 +146,21 @@ class Image {
  private:
   std::vector<uchar> m_data;
 
+  // External storage (nullptr if m_data is used)
+  const uchar* m_extData{nullptr};
+  size_t m_extSize{0};
+  std::function<void()> m_release;
+
  public:
   VideoMode::PixelFormat pixelFormat{VideoMode::kUnknown};
   int width{0};
   int height{0};
   int jpegQuality{-1};
+  // DMABUF fd of the backing store for external images whose buffer was
+  // exported from the kernel (e.g. VIDIOC_EXPBUF), or -1.  The fd is owned
+  // by the capture buffer and stays valid as long as the release function
+  // hasn't run.
+  int dmabufFd{-1};
 };
 
 }  // namespace cs
@@ -0,0 +1,74 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "JpegCodec.h"
+
+#include <opencv2/highgui/highgui.hpp>
+#include <opencv2/imgproc/imgproc.hpp>
+
+namespace cs {
+
+namespace {
+
+class SoftwareJpegCodec : public JpegCodec {
+ public:
+  std::string_view GetName() const override { return "software"; }
+
+  bool Encode(const uchar* src, int width, int height, int channels,
+              int quality, std::vector<uchar>* dst) override {
+    cv::Mat srcMat{height, width, channels == 1 ? CV_8UC1 : CV_8UC3,
+                   const_cast<uchar*>(src)};
+    std::vector<int> params{cv::IMWRITE_JPEG_QUALITY, quality};
+    return cv::imencode(".jpg", srcMat, *dst, params);
+  }
+
+  bool Decode(std::string_view src, int width, int height, int channels,
+              uchar* dst) override {
+    cv::Mat srcMat{1, static_cast<int>(src.size()), CV_8UC1,
+                   const_cast<char*>(src.data())};
+    cv::Mat dstMat{height, width, channels == 1 ? CV_8UC1 : CV_8UC3, dst};
+    cv::imdecode(srcMat,
+                 channels == 1 ? cv::IMREAD_GRAYSCALE : cv::IMREAD_COLOR,
+                 &dstMat);
+    return true;
+  }
+};
+
+JpegCodec* GetHardwareCodec() {
+#ifdef __linux__
+  static std::unique_ptr<JpegCodec> hardware = CreateV4L2JpegCodec();
+  return hardware.get();
+#else
+  return nullptr;
+#endif
+}
+
+SoftwareJpegCodec& GetSoftwareCodec() {
+  static SoftwareJpegCodec software;
+  return software;
+}
+
+}  // namespace
+
+bool JpegEncode(const uchar* src, int width, int height, int channels,
+                int quality, std::vector<uchar>* dst) {
+  if (JpegCodec* hw = GetHardwareCodec()) {
+    if (hw->Encode(src, width, height, channels, quality, dst)) {
+      return true;
+    }
+  }
+  return GetSoftwareCodec().Encode(src, width, height, channels, quality, dst);
+}
+
+bool JpegDecode(std::string_view src, int width, int height, int channels,
+                uchar* dst) {
+  if (JpegCodec* hw = GetHardwareCodec()) {
+    if (hw->Decode(src, width, height, channels, dst)) {
+      return true;
+    }
+  }
+  return GetSoftwareCodec().Decode(src, width, height, channels, dst);
+}
+
+}  // namespace cs
@@ -0,0 +1,54 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#ifndef CSCORE_JPEGCODEC_H_
+#define CSCORE_JPEGCODEC_H_
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include <opencv2/core/core.hpp>
+
+namespace cs {
+
+// Pluggable JPEG codec backend.  An implementation returns false from the
+// encode/decode functions when it can't handle a particular request (e.g.
+// unsupported format or device error); callers fall through to the software
+// codec, which always succeeds.
+class JpegCodec {
+ public:
+  virtual ~JpegCodec() = default;
+
+  virtual std::string_view GetName() const = 0;
+
+  // Encodes packed BGR (channels == 3) or grayscale (channels == 1) pixel
+  // data to JPEG.
+  virtual bool Encode(const uchar* src, int width, int height, int channels,
+                      int quality, std::vector<uchar>* dst) = 0;
+
+  // Decodes a JPEG into packed BGR or grayscale pixel data; dst must hold
+  // width * height * channels bytes, with width and height matching the
+  // JPEG's dimensions.
+  virtual bool Decode(std::string_view src, int width, int height,
+                      int channels, uchar* dst) = 0;
+};
+
+// Encode/decode through the active codec chain: the hardware codec first
+// when one is available, then software.
+bool JpegEncode(const uchar* src, int width, int height, int channels,
+                int quality, std::vector<uchar>* dst);
+bool JpegDecode(std::string_view src, int width, int height, int channels,
+                uchar* dst);
+
+#ifdef __linux__
+// Returns a codec backed by a V4L2 memory-to-memory JPEG engine (e.g. the
+// hardware codecs on Pi and Jetson coprocessors), or nullptr if no usable
+// device exists.
+std::unique_ptr<JpegCodec> CreateV4L2JpegCodec();
+#endif
+
+}  // namespace cs
+
+#endif  // CSCORE_JPEGCODEC_H_
@@ -10,6 +10,7 @@
 #include <wpi/SmallString.h>
 #include <wpi/StringExtras.h>
 #include <wpi/fmt/raw_ostream.h>
+#include <wpi/timestamp.h>
 #include <wpinet/HttpUtil.h>
 #include <wpinet/TCPAcceptor.h>
 #include <wpinet/raw_socket_istream.h>
@@ -21,6 +22,7 @@
 #include "Log.h"
 #include "Notifier.h"
 #include "SourceImpl.h"
+#include "Telemetry.h"
 #include "c_util.h"
 #include "cscore_cpp.h"
 
@@ -75,8 +77,9 @@ static const char* endRootPage = "</div></body></html>";
 
 class MjpegServerImpl::ConnThread : public wpi::SafeThread {
  public:
-  explicit ConnThread(std::string_view name, wpi::Logger& logger)
-      : m_name(name), m_logger(logger) {}
+  ConnThread(std::string_view name, wpi::Logger& logger,
+             MjpegServerImpl* server)
+      : m_name(name), m_logger(logger), m_server(server) {}
 
   void Main() override;
 
@@ -101,6 +104,7 @@ class MjpegServerImpl::ConnThread : public wpi::SafeThread {
  private:
   std::string m_name;
   wpi::Logger& m_logger;
+  MjpegServerImpl* m_server;
 
   std::string_view GetName() { return m_name; }
 
@@ -771,6 +775,10 @@ void MjpegServerImpl::ConnThread::SendStream(wpi::raw_socket_ostream& os) {
       os << std::string_view(data, size);
     }
     // os.flush();
+    if (thisFrameTime != 0) {
+      m_server->m_telemetry.RecordSinkWriteLatency(
+          *m_server, wpi::Now() - thisFrameTime);
+    }
   }
   StopStream();
 }
@@ -955,7 +963,7 @@ void MjpegServerImpl::ServerThreadMain() {
     }
 
     // Start it if not already started
-    it->Start(GetName(), m_logger);
+    it->Start(GetName(), m_logger, this);
 
     auto nstreams =
         std::count_if(m_connThreads.begin(), m_connThreads.end(),
@@ -77,6 +77,10 @@ Frame SourceImpl::GetNextFrame() {
   std::unique_lock lock{m_frameMutex};
   auto oldTime = m_frame.GetTime();
   m_frameCv.wait(lock, [=, this] { return m_frame.GetTime() != oldTime; });
+  if (m_frame && m_frame.GetTime() != 0) {
+    m_telemetry.RecordSourceDispatchLatency(*this,
+                                            wpi::Now() - m_frame.GetTime());
+  }
   return m_frame;
 }
 
@@ -87,7 +91,51 @@ Frame SourceImpl::GetNextFrame(double timeout) {
           lock, std::chrono::milliseconds(static_cast<int>(timeout * 1000)),
           [=, this] { return m_frame.GetTime() != oldTime; })) {
     m_frame = Frame{*this, "timed out getting frame", wpi::Now()};
+  } else if (m_frame && m_frame.GetTime() != 0) {
+    m_telemetry.RecordSourceDispatchLatency(*this,
+                                            wpi::Now() - m_frame.GetTime());
+  }
+  return m_frame;
+}
+
+Frame SourceImpl::GetNextFrame(uint64_t& lastFrameSeq, int minFrames) {
+  std::unique_lock lock{m_frameMutex};
+  auto oldTime = m_frame.GetTime();
+  if (lastFrameSeq > m_frameSeq) {
+    lastFrameSeq = m_frameSeq;  // source restarted; reset the count
+  }
+  uint64_t targetSeq = lastFrameSeq + std::max(minFrames, 1);
+  m_frameCv.wait(lock, [&, this] {
+    return m_frame.GetTime() != oldTime && (!m_frame || m_frameSeq >= targetSeq);
+  });
+  lastFrameSeq = m_frameSeq;
+  if (m_frame && m_frame.GetTime() != 0) {
+    m_telemetry.RecordSourceDispatchLatency(*this,
+                                            wpi::Now() - m_frame.GetTime());
+  }
+  return m_frame;
+}
+
+Frame SourceImpl::GetNextFrame(uint64_t& lastFrameSeq, int minFrames,
+                               double timeout) {
+  std::unique_lock lock{m_frameMutex};
+  auto oldTime = m_frame.GetTime();
+  if (lastFrameSeq > m_frameSeq) {
+    lastFrameSeq = m_frameSeq;  // source restarted; reset the count
+  }
+  uint64_t targetSeq = lastFrameSeq + std::max(minFrames, 1);
+  if (!m_frameCv.wait_for(
+          lock, std::chrono::milliseconds(static_cast<int>(timeout * 1000)),
+          [&, this] {
+            return m_frame.GetTime() != oldTime &&
+                   (!m_frame || m_frameSeq >= targetSeq);
+          })) {
+    m_frame = Frame{*this, "timed out getting frame", wpi::Now()};
+  } else if (m_frame && m_frame.GetTime() != 0) {
+    m_telemetry.RecordSourceDispatchLatency(*this,
+                                            wpi::Now() - m_frame.GetTime());
   }
+  lastFrameSeq = m_frameSeq;
   return m_frame;
 }
 
@@ -450,7 +498,89 @@ void SourceImpl::PutFrame(VideoMode::PixelFormat pixelFormat, int width,
   PutFrame(std::move(image), time);
 }
 
+bool SourceImpl::SetROI(int x, int y, int width, int height,
+                        CS_Status* status) {
+  if (x == 0 && y == 0 && width == 0 && height == 0) {
+    m_roiEnabled.store(false, std::memory_order_release);
+    return true;
+  }
+  if (x < 0 || y < 0 || width <= 0 || height <= 0) {
+    *status = CS_PROPERTY_WRITE_FAILED;
+    return false;
+  }
+  {
+    std::scoped_lock lock{m_roiMutex};
+    m_roiX = x;
+    m_roiY = y;
+    m_roiWidth = width;
+    m_roiHeight = height;
+  }
+  m_roiEnabled.store(true, std::memory_order_release);
+  return true;
+}
+
+std::unique_ptr<Image> SourceImpl::CropToROI(std::unique_ptr<Image> image) {
+  int bpp;
+  switch (image->pixelFormat) {
+    case VideoMode::kGray:
+      bpp = 1;
+      break;
+    case VideoMode::kYUYV:
+    case VideoMode::kRGB565:
+      bpp = 2;
+      break;
+    case VideoMode::kBGR:
+      bpp = 3;
+      break;
+    default:
+      // Compressed formats can't be cropped here; pass through unchanged.
+      return image;
+  }
+
+  int x, y, width, height;
+  {
+    std::scoped_lock lock{m_roiMutex};
+    x = m_roiX;
+    y = m_roiY;
+    width = m_roiWidth;
+    height = m_roiHeight;
+  }
+  if (image->pixelFormat == VideoMode::kYUYV) {
+    // keep YUYV macropixel pairs aligned
+    x &= ~1;
+    width &= ~1;
+  }
+  if (x >= image->width || y >= image->height) {
+    return image;  // region entirely outside the frame
+  }
+  width = (std::min)(width, image->width - x);
+  height = (std::min)(height, image->height - y);
+  if (x == 0 && y == 0 && width == image->width && height == image->height) {
+    return image;
+  }
+
+  auto cropped = AllocImage(
+      static_cast<VideoMode::PixelFormat>(image->pixelFormat), width, height,
+      static_cast<size_t>(width) * height * bpp);
+  const char* src = image->data() +
+                    (static_cast<size_t>(y) * image->width + x) * bpp;
+  char* dst = cropped->data();
+  size_t rowBytes = static_cast<size_t>(width) * bpp;
+  size_t srcStride = static_cast<size_t>(image->width) * bpp;
+  for (int row = 0; row < height; ++row) {
+    std::memcpy(dst, src, rowBytes);
+    dst += rowBytes;
+    src += srcStride;
+  }
+  ReleaseImage(std::move(image));
+  return cropped;
+}
+
 void SourceImpl::PutFrame(std::unique_ptr<Image> image, Frame::Time time) {
+  if (m_roiEnabled.load(std::memory_order_acquire)) {
+    image = CropToROI(std::move(image));
+  }
+
   // Update telemetry
   m_telemetry.RecordSourceFrames(*this, 1);
   m_telemetry.RecordSourceBytes(*this, static_cast<int>(image->size()));
@@ -458,6 +588,7 @@ void SourceImpl::PutFrame(std::unique_ptr<Image> image, Frame::Time time) {
   // Update frame
   {
     std::scoped_lock lock{m_frameMutex};
+    ++m_frameSeq;
     m_frame = Frame{*this, std::move(image), time};
   }
 
@@ -510,6 +641,11 @@ void SourceImpl::UpdatePropertyValue(int property, bool setString, int value,
 }
 
 void SourceImpl::ReleaseImage(std::unique_ptr<Image> image) {
+  // Images borrowing external storage (e.g. V4L2 buffers) can't be reused;
+  // destroying the image runs its release function.
+  if (image->IsExternal()) {
+    return;
+  }
   std::scoped_lock lock{m_poolMutex};
   if (m_destroyFrames) {
     return;
@@ -7,6 +7,7 @@
 
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -102,6 +103,16 @@ class SourceImpl : public PropertyContainer {
   // timeout in seconds).  If timeout expires, returns empty frame.
   Frame GetNextFrame(double timeout);
 
+  // Blocking function that waits until at least minFrames new frames have
+  // arrived since lastFrameSeq and returns the most recent one.  Used by
+  // sinks with an every-Nth-frame policy; skipped frames never wake the
+  // caller.  lastFrameSeq is updated to the returned frame's sequence number.
+  Frame GetNextFrame(uint64_t& lastFrameSeq, int minFrames);
+
+  // Same as above, with timeout in seconds.  If timeout expires, returns
+  // empty frame.
+  Frame GetNextFrame(uint64_t& lastFrameSeq, int minFrames, double timeout);
+
   // Force a wakeup of all GetNextFrame() callers by sending an empty frame.
   void Wakeup();
 
@@ -126,6 +137,13 @@ class SourceImpl : public PropertyContainer {
   virtual bool SetResolution(int width, int height, CS_Status* status);
   virtual bool SetFPS(int fps, CS_Status* status);
 
+  // Sets a region of interest; incoming raw frames are cropped to the region
+  // before being stored, so sinks and conversions only ever see (and pay for)
+  // the region.  Compressed (MJPEG) frames are passed through unchanged.
+  // Passing all zeros disables the region.  Returns false if the region is
+  // invalid.
+  bool SetROI(int x, int y, int width, int height, CS_Status* status);
+
   bool SetConfigJson(std::string_view config, CS_Status* status);
   virtual bool SetConfigJson(const wpi::json& config, CS_Status* status);
   std::string GetConfigJson(CS_Status* status);
@@ -166,6 +184,7 @@ class SourceImpl : public PropertyContainer {
   void ReleaseImage(std::unique_ptr<Image> image);
   std::unique_ptr<Frame::Impl> AllocFrameImpl();
   void ReleaseFrameImpl(std::unique_ptr<Frame::Impl> data);
+  std::unique_ptr<Image> CropToROI(std::unique_ptr<Image> image);
 
   std::string m_name;
   std::string m_description;
@@ -176,6 +195,18 @@ class SourceImpl : public PropertyContainer {
   wpi::mutex m_frameMutex;
   wpi::condition_variable m_frameCv;
 
+  // Region of interest applied to incoming raw frames (protected by
+  // m_roiMutex; m_roiEnabled allows the PutFrame fast path to skip the lock)
+  wpi::mutex m_roiMutex;
+  int m_roiX{0};
+  int m_roiY{0};
+  int m_roiWidth{0};
+  int m_roiHeight{0};
+  std::atomic_bool m_roiEnabled{false};
+
+  // Number of image frames put to m_frame; protected by m_frameMutex
+  uint64_t m_frameSeq{0};
+
   bool m_destroyFrames{false};
 
   // Pool of frames/images to reduce malloc traffic.
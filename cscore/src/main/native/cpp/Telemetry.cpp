@@ -4,8 +4,11 @@
 
 #include "Telemetry.h"
 
+#include <algorithm>
 #include <chrono>
 #include <limits>
+#include <utility>
+#include <vector>
 
 #include <wpi/DenseMap.h>
 #include <wpi/timestamp.h>
@@ -13,6 +16,7 @@
 #include "Handle.h"
 #include "Instance.h"
 #include "Notifier.h"
+#include "SinkImpl.h"
 #include "SourceImpl.h"
 #include "cscore_cpp.h"
 
@@ -27,12 +31,29 @@ class Telemetry::Thread : public wpi::SafeThread {
   Notifier& m_notifier;
   wpi::DenseMap<std::pair<CS_Handle, int>, int64_t> m_user;
   wpi::DenseMap<std::pair<CS_Handle, int>, int64_t> m_current;
+  // Latency samples collected over the current period, keyed by the P50
+  // telemetry kind (the P99 kind is always the next enum value)
+  wpi::DenseMap<std::pair<CS_Handle, int>, std::vector<int64_t>> m_latencies;
   double m_period = 0.0;
   double m_elapsed = 0.0;
   bool m_updated = false;
   int64_t GetValue(CS_Handle handle, CS_TelemetryKind kind, CS_Status* status);
+  void RecordLatency(CS_Handle handle, CS_TelemetryKind p50Kind,
+                     int64_t micros);
+
+  static constexpr size_t kMaxLatencySamples = 512;
 };
 
+void Telemetry::Thread::RecordLatency(CS_Handle handle,
+                                      CS_TelemetryKind p50Kind,
+                                      int64_t micros) {
+  auto& samples =
+      m_latencies[std::make_pair(handle, static_cast<int>(p50Kind))];
+  if (samples.size() < kMaxLatencySamples) {
+    samples.push_back(micros);
+  }
+}
+
 int64_t Telemetry::Thread::GetValue(CS_Handle handle, CS_TelemetryKind kind,
                                     CS_Status* status) {
   auto it = m_user.find(std::make_pair(handle, static_cast<int>(kind)));
@@ -75,6 +96,20 @@ void Telemetry::Thread::Main() {
       continue;
     }
 
+    // aggregate latency samples into percentile values
+    for (auto& latency : m_latencies) {
+      auto& samples = latency.getSecond();
+      if (samples.empty()) {
+        continue;
+      }
+      std::sort(samples.begin(), samples.end());
+      m_current[latency.getFirst()] = samples[(samples.size() - 1) / 2];
+      m_current[std::make_pair(latency.getFirst().first,
+                               latency.getFirst().second + 1)] =
+          samples[99 * (samples.size() - 1) / 100];
+    }
+    m_latencies.clear();
+
     // move to user and clear current, as we don't keep around old values
     m_user = std::move(m_current);
     m_current.clear();
@@ -152,3 +187,57 @@ void Telemetry::RecordSourceFrames(const SourceImpl& source, int quantity) {
                                 static_cast<int>(CS_SOURCE_FRAMES_RECEIVED))] +=
       quantity;
 }
+
+void Telemetry::RecordSourceConversionCacheHit(const SourceImpl& source) {
+  auto thr = m_owner.GetThread();
+  if (!thr) {
+    return;
+  }
+  auto handleData = Instance::GetInstance().FindSource(source);
+  thr->m_current[std::make_pair(
+      Handle{handleData.first, Handle::kSource},
+      static_cast<int>(CS_SOURCE_CONVERSION_CACHE_HITS))] += 1;
+}
+
+void Telemetry::RecordSourceConversionCacheMiss(const SourceImpl& source) {
+  auto thr = m_owner.GetThread();
+  if (!thr) {
+    return;
+  }
+  auto handleData = Instance::GetInstance().FindSource(source);
+  thr->m_current[std::make_pair(
+      Handle{handleData.first, Handle::kSource},
+      static_cast<int>(CS_SOURCE_CONVERSION_CACHE_MISSES))] += 1;
+}
+
+void Telemetry::RecordSourceDispatchLatency(const SourceImpl& source,
+                                            int64_t micros) {
+  auto thr = m_owner.GetThread();
+  if (!thr) {
+    return;
+  }
+  auto handleData = Instance::GetInstance().FindSource(source);
+  thr->RecordLatency(Handle{handleData.first, Handle::kSource},
+                     CS_SOURCE_DISPATCH_LATENCY_P50, micros);
+}
+
+void Telemetry::RecordSourceConvertLatency(const SourceImpl& source,
+                                           int64_t micros) {
+  auto thr = m_owner.GetThread();
+  if (!thr) {
+    return;
+  }
+  auto handleData = Instance::GetInstance().FindSource(source);
+  thr->RecordLatency(Handle{handleData.first, Handle::kSource},
+                     CS_SOURCE_CONVERT_LATENCY_P50, micros);
+}
+
+void Telemetry::RecordSinkWriteLatency(const SinkImpl& sink, int64_t micros) {
+  auto thr = m_owner.GetThread();
+  if (!thr) {
+    return;
+  }
+  auto handleData = Instance::GetInstance().FindSink(sink);
+  thr->RecordLatency(Handle{handleData.first, Handle::kSink},
+                     CS_SINK_WRITE_LATENCY_P50, micros);
+}
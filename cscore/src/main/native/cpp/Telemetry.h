@@ -12,6 +12,7 @@
 namespace cs {
 
 class Notifier;
+class SinkImpl;
 class SourceImpl;
 
 class Telemetry {
@@ -34,6 +35,13 @@ class Telemetry {
   // Telemetry events
   void RecordSourceBytes(const SourceImpl& source, int quantity);
   void RecordSourceFrames(const SourceImpl& source, int quantity);
+  void RecordSourceConversionCacheHit(const SourceImpl& source);
+  void RecordSourceConversionCacheMiss(const SourceImpl& source);
+
+  // Latency samples in microseconds; aggregated into p50/p99 each period
+  void RecordSourceDispatchLatency(const SourceImpl& source, int64_t micros);
+  void RecordSourceConvertLatency(const SourceImpl& source, int64_t micros);
+  void RecordSinkWriteLatency(const SinkImpl& sink, int64_t micros);
 
  private:
   Notifier& m_notifier;
@@ -206,6 +206,11 @@ CS_Bool CS_SetSourceResolution(CS_Source source, int width, int height,
   return cs::SetSourceResolution(source, width, height, status);
 }
 
+CS_Bool CS_SetSourceROI(CS_Source source, int x, int y, int width, int height,
+                        CS_Status* status) {
+  return cs::SetSourceROI(source, x, y, width, height, status);
+}
+
 CS_Bool CS_SetSourceFPS(CS_Source source, int fps, CS_Status* status) {
   return cs::SetSourceFPS(source, fps, status);
 }
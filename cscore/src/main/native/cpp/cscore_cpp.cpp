@@ -341,6 +341,16 @@ bool SetSourceResolution(CS_Source source, int width, int height,
   return data->source->SetResolution(width, height, status);
 }
 
+bool SetSourceROI(CS_Source source, int x, int y, int width, int height,
+                  CS_Status* status) {
+  auto data = Instance::GetInstance().GetSource(source);
+  if (!data) {
+    *status = CS_INVALID_HANDLE;
+    return false;
+  }
+  return data->source->SetROI(x, y, width, height, status);
+}
+
 bool SetSourceFPS(CS_Source source, int fps, CS_Status* status) {
   auto data = Instance::GetInstance().GetSource(source);
   if (!data) {
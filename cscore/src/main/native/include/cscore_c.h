@@ -179,7 +179,18 @@ enum CS_EventKind {
  */
 enum CS_TelemetryKind {
   CS_SOURCE_BYTES_RECEIVED = 1,
-  CS_SOURCE_FRAMES_RECEIVED = 2
+  CS_SOURCE_FRAMES_RECEIVED = 2,
+  CS_SOURCE_CONVERSION_CACHE_HITS = 3,
+  CS_SOURCE_CONVERSION_CACHE_MISSES = 4,
+  // Latency percentiles over the telemetry period, in microseconds:
+  // capture to sink pickup, time spent converting, and capture to the end
+  // of the socket write
+  CS_SOURCE_DISPATCH_LATENCY_P50 = 5,
+  CS_SOURCE_DISPATCH_LATENCY_P99 = 6,
+  CS_SOURCE_CONVERT_LATENCY_P50 = 7,
+  CS_SOURCE_CONVERT_LATENCY_P99 = 8,
+  CS_SINK_WRITE_LATENCY_P50 = 9,
+  CS_SINK_WRITE_LATENCY_P99 = 10
 };
 
 /** Connection strategy */
@@ -308,6 +319,8 @@ CS_Bool CS_SetSourcePixelFormat(CS_Source source,
                                 CS_Status* status);
 CS_Bool CS_SetSourceResolution(CS_Source source, int width, int height,
                                CS_Status* status);
+CS_Bool CS_SetSourceROI(CS_Source source, int x, int y, int width, int height,
+                        CS_Status* status);
 CS_Bool CS_SetSourceFPS(CS_Source source, int fps, CS_Status* status);
 CS_Bool CS_SetSourceConfigJson(CS_Source source, const char* config,
                                CS_Status* status);
@@ -240,6 +240,8 @@ bool SetSourcePixelFormat(CS_Source source, VideoMode::PixelFormat pixelFormat,
                           CS_Status* status);
 bool SetSourceResolution(CS_Source source, int width, int height,
                          CS_Status* status);
+bool SetSourceROI(CS_Source source, int x, int y, int width, int height,
+                  CS_Status* status);
 bool SetSourceFPS(CS_Source source, int fps, CS_Status* status);
 bool SetSourceConfigJson(CS_Source source, std::string_view config,
                          CS_Status* status);
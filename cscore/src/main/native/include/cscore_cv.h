@@ -39,6 +39,8 @@ uint64_t CS_GrabSinkFrameTimeout(CS_Sink sink, struct CvMat* image,
 
 #ifdef __cplusplus
 
+#include <span>
+
 #include "cscore_oo.h"
 
 namespace cv {
@@ -57,6 +59,9 @@ extern "C" {
 uint64_t CS_GrabSinkFrameCpp(CS_Sink sink, cv::Mat* image, CS_Status* status);
 uint64_t CS_GrabSinkFrameTimeoutCpp(CS_Sink sink, cv::Mat* image,
                                     double timeout, CS_Status* status);
+uint64_t CS_GrabSinkFramesSyncedCpp(const CS_Sink* sinks, int sinkCount,
+                                    cv::Mat* images, double epsilon,
+                                    double timeout, CS_Status* status);
 void CS_PutSourceFrameCpp(CS_Source source, cv::Mat* image, CS_Status* status);
 }  // extern "C"
 /** @} */
@@ -66,6 +71,26 @@ uint64_t GrabSinkFrame(CS_Sink sink, cv::Mat& image, CS_Status* status);
 uint64_t GrabSinkFrameTimeout(CS_Sink sink, cv::Mat& image, double timeout,
                               CS_Status* status);
 
+/**
+ * Wait for a time-synchronized set of frames from multiple sinks.
+ *
+ * Blocks until every sink's source has a current frame whose capture
+ * timestamps all fall within epsilon seconds of each other, then converts
+ * the matched frames into the caller's images.  Unmatched frames are
+ * dropped without ever being converted or copied.
+ *
+ * @param sinks sinks to synchronize (all must be CvSinks)
+ * @param images images to fill (same length as sinks)
+ * @param epsilon maximum capture timestamp spread in seconds
+ * @param timeout timeout in seconds
+ * @param status status
+ * @return Earliest capture timestamp of the matched set, or 0 on timeout or
+ *         error.
+ */
+uint64_t GrabSinkFramesSynced(std::span<const CS_Sink> sinks,
+                              std::span<cv::Mat> images, double epsilon,
+                              double timeout, CS_Status* status);
+
 /**
  * A source for user code to provide OpenCV images as video frames.
  * These sources require the WPILib OpenCV builds.
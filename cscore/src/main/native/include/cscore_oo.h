@@ -244,6 +244,22 @@ class VideoSource {
    */
   bool SetResolution(int width, int height);
 
+  /**
+   * Set a region of interest.
+   *
+   * Incoming raw (uncompressed) frames are cropped to the region before they
+   * reach any sink, so downstream conversion, encoding, and streaming only
+   * pay for the region.  Compressed (MJPEG) frames are passed through
+   * unchanged.  The region is clamped to the frame bounds.
+   *
+   * @param x left edge of the region (pixels)
+   * @param y top edge of the region (pixels)
+   * @param width region width; pass all zeros to disable the region
+   * @param height region height
+   * @return True if set successfully
+   */
+  bool SetROI(int x, int y, int width, int height);
+
   /**
    * Set the frames per second (FPS).
    *
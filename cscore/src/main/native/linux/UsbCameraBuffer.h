@@ -6,6 +6,7 @@
 #define CSCORE_USBCAMERABUFFER_H_
 
 #include <sys/mman.h>
+#include <unistd.h>
 
 #include <utility>
 
@@ -38,16 +39,23 @@ class UsbCameraBuffer {
     if (m_data) {
       munmap(m_data, m_length);
     }
+    if (m_dmabufFd >= 0) {
+      close(m_dmabufFd);
+    }
   }
 
   friend void swap(UsbCameraBuffer& first, UsbCameraBuffer& second) noexcept {
     using std::swap;
     swap(first.m_data, second.m_data);
     swap(first.m_length, second.m_length);
+    swap(first.m_dmabufFd, second.m_dmabufFd);
   }
 
   void* m_data{nullptr};
   size_t m_length{0};
+  // DMABUF fd exported via VIDIOC_EXPBUF, or -1 if the driver doesn't
+  // support export.  Owned by this buffer.
+  int m_dmabufFd{-1};
 };
 
 }  // namespace cs
@@ -452,6 +452,9 @@ void UsbCameraImpl::CameraThreadMain() {
       break;
     }
 
+    // Requeue any buffers released by frames since the last wakeup
+    DeviceRequeueBuffers();
+
     // Handle notify events
     if (notify_fd >= 0 && FD_ISSET(notify_fd, &readfds)) {
       SDEBUG4("notify event");
@@ -509,16 +512,18 @@ void UsbCameraImpl::CameraThreadMain() {
         continue;         // will reconnect
       }
 
+      bool requeue = true;
       if ((buf.flags & V4L2_BUF_FLAG_ERROR) == 0) {
         SDEBUG4("got image size={} index={}", buf.bytesused, buf.index);
 
-        if (buf.index >= kNumBuffers || !m_buffers[buf.index].m_data) {
+        if (buf.index >= kNumBuffers || !m_buffers[buf.index] ||
+            !m_buffers[buf.index]->m_data) {
           SWARNING("invalid buffer {}", buf.index);
           continue;
         }
 
         std::string_view image{
-            static_cast<const char*>(m_buffers[buf.index].m_data),
+            static_cast<const char*>(m_buffers[buf.index]->m_data),
             static_cast<size_t>(buf.bytesused)};
         int width = m_mode.width;
         int height = m_mode.height;
@@ -529,13 +534,38 @@ void UsbCameraImpl::CameraThreadMain() {
           good = false;
         }
         if (good) {
-          PutFrame(static_cast<VideoMode::PixelFormat>(m_mode.pixelFormat),
-                   width, height, image, wpi::Now());  // TODO: time
+          auto pixelFormat =
+              static_cast<VideoMode::PixelFormat>(m_mode.pixelFormat);
+          if (m_outstandingBuffers < (kNumBuffers - 2)) {
+            // Hand the mapped buffer to the frame without copying; it gets
+            // requeued once the frame releases it.  Only do this while at
+            // least two buffers stay queued in the driver so streaming
+            // doesn't stall when clients hold frames.
+            unsigned index = buf.index;
+            unsigned generation = m_bufferGeneration;
+            auto buffer = m_buffers[buf.index];
+            auto extImage = std::make_unique<Image>(
+                static_cast<const uchar*>(buffer->m_data), image.size(),
+                [this, buffer, index, generation] {
+                  std::scoped_lock lock{m_freeMutex};
+                  m_returnedBuffers.emplace_back(index, generation);
+                });
+            extImage->pixelFormat = pixelFormat;
+            extImage->width = width;
+            extImage->height = height;
+            extImage->dmabufFd = buffer->m_dmabufFd;
+            PutFrame(std::move(extImage), wpi::Now());  // TODO: time
+            ++m_outstandingBuffers;
+            requeue = false;
+          } else {
+            PutFrame(pixelFormat, width, height, image,
+                     wpi::Now());  // TODO: time
+          }
         }
       }
 
-      // Requeue buffer
-      if (DoIoctl(fd, VIDIOC_QBUF, &buf) != 0) {
+      // Requeue buffer (unless it was handed out zero-copy above)
+      if (requeue && DoIoctl(fd, VIDIOC_QBUF, &buf) != 0) {
         SWARNING("could not requeue buffer");
         wasStreaming = m_streaming;
         DeviceStreamOff();
@@ -557,9 +587,10 @@ void UsbCameraImpl::DeviceDisconnect() {
     return;  // already disconnected
   }
 
-  // Unmap buffers
+  // Release buffers; mappings handed out to outstanding frames stay alive
+  // until those frames are released.
   for (int i = 0; i < kNumBuffers; ++i) {
-    m_buffers[i] = UsbCameraBuffer{};
+    m_buffers[i].reset();
   }
 
   // Close device
@@ -654,19 +685,34 @@ void UsbCameraImpl::DeviceConnect() {
     }
     SDEBUG4("buf {} length={} offset={}", i, buf.length, buf.m.offset);
 
-    m_buffers[i] = UsbCameraBuffer(fd, buf.length, buf.m.offset);
-    if (!m_buffers[i].m_data) {
+    m_buffers[i] =
+        std::make_shared<UsbCameraBuffer>(fd, buf.length, buf.m.offset);
+    if (!m_buffers[i]->m_data) {
       SWARNING("could not map buffer {}", i);
       // release other buffers
-      for (int j = 0; j < i; ++j) {
-        m_buffers[j] = UsbCameraBuffer{};
+      for (int j = 0; j <= i; ++j) {
+        m_buffers[j].reset();
       }
       close(fd);
       m_fd = -1;
       return;
     }
 
-    SDEBUG4("buf {} address={}", i, m_buffers[i].m_data);
+    SDEBUG4("buf {} address={}", i, m_buffers[i]->m_data);
+
+    // Export the buffer as a DMABUF fd if the driver supports it, so
+    // downstream consumers (hardware encoders, GL/CL) can import the
+    // capture buffer without a copy.  Not all drivers support export, so
+    // failure here is fine; we just stream without fds.
+    struct v4l2_exportbuffer expbuf;
+    std::memset(&expbuf, 0, sizeof(expbuf));
+    expbuf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    expbuf.index = i;
+    expbuf.flags = O_CLOEXEC | O_RDONLY;
+    if (TryIoctl(fd, VIDIOC_EXPBUF, &expbuf) == 0) {
+      m_buffers[i]->m_dmabufFd = expbuf.fd;
+      SDEBUG4("buf {} dmabuf fd={}", i, expbuf.fd);
+    }
   }
 
   // Update description (as it may have changed)
@@ -688,6 +734,16 @@ bool UsbCameraImpl::DeviceStreamOn() {
     return false;
   }
 
+  // Any buffers returned from a previous streaming session are stale; all
+  // buffers get requeued below.  A frame still holding a buffer across the
+  // restart keeps its mapping alive but may observe the driver refilling it.
+  {
+    std::scoped_lock lock{m_freeMutex};
+    m_returnedBuffers.clear();
+  }
+  ++m_bufferGeneration;
+  m_outstandingBuffers = 0;
+
   // Queue buffers
   SDEBUG3("queuing buffers");
   for (int i = 0; i < kNumBuffers; ++i) {
@@ -722,6 +778,35 @@ bool UsbCameraImpl::DeviceStreamOn() {
   return true;
 }
 
+void UsbCameraImpl::DeviceRequeueBuffers() {
+  std::vector<std::pair<unsigned, unsigned>> returned;
+  {
+    std::scoped_lock lock{m_freeMutex};
+    returned.swap(m_returnedBuffers);
+  }
+  if (returned.empty()) {
+    return;
+  }
+  int fd = m_fd.load();
+  for (auto&& [index, generation] : returned) {
+    // Drop returns from a previous streaming session; DeviceStreamOn()
+    // requeues every buffer itself.
+    if (generation != m_bufferGeneration || !m_streaming || fd < 0) {
+      continue;
+    }
+    struct v4l2_buffer buf;
+    std::memset(&buf, 0, sizeof(buf));
+    buf.index = index;
+    buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    buf.memory = V4L2_MEMORY_MMAP;
+    if (DoIoctl(fd, VIDIOC_QBUF, &buf) != 0) {
+      SWARNING("could not requeue buffer {}", index);
+      continue;
+    }
+    --m_outstandingBuffers;
+  }
+}
+
 bool UsbCameraImpl::DeviceStreamOff() {
   if (!m_streaming) {
     return false;  // ignore if already disabled
@@ -115,6 +115,7 @@ class UsbCameraImpl : public SourceImpl {
   void DeviceConnect();
   bool DeviceStreamOn();
   bool DeviceStreamOff();
+  void DeviceRequeueBuffers();
   void DeviceProcessCommands();
   void DeviceSetMode();
   void DeviceSetFPS();
@@ -150,7 +151,14 @@ class UsbCameraImpl : public SourceImpl {
   unsigned m_capabilities = 0;
   // Number of buffers to ask OS for
   static constexpr int kNumBuffers = 4;
-  std::array<UsbCameraBuffer, kNumBuffers> m_buffers;
+  std::array<std::shared_ptr<UsbCameraBuffer>, kNumBuffers> m_buffers;
+
+  // Zero-copy frame tracking.  Buffers handed to frames without copying are
+  // requeued by the camera thread after the frame releases them; the
+  // generation counter discards returns from a previous streaming session.
+  // m_bufferGeneration and m_outstandingBuffers are camera thread only.
+  unsigned m_bufferGeneration{0};
+  int m_outstandingBuffers{0};
 
   std::atomic_int m_fd;
   std::atomic_int m_command_fd;  // for command eventfd
@@ -167,6 +175,12 @@ class UsbCameraImpl : public SourceImpl {
   // Variables protected by m_mutex
   //
 
+  // Buffers returned from released frames, pending requeue by the camera
+  // thread (index, generation).  Protected by m_freeMutex since frames are
+  // released from arbitrary threads.
+  wpi::mutex m_freeMutex;
+  std::vector<std::pair<unsigned, unsigned>> m_returnedBuffers;
+
   // Message queues
   mutable std::vector<Message> m_commands;
   mutable std::vector<std::pair<std::thread::id, CS_StatusValue>> m_responses;
@@ -0,0 +1,360 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <linux/videodev2.h>
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <fmt/format.h>
+#include <wpi/mutex.h>
+
+#include "Instance.h"
+#include "JpegCodec.h"
+#include "Log.h"
+#include "UsbUtil.h"
+
+namespace cs {
+
+namespace {
+
+// A single-buffer V4L2 memory-to-memory conversion context (multi-planar
+// API, as used by the Pi and Jetson codec drivers).  The source image is
+// copied into the OUTPUT queue buffer, the device converts, and the result
+// is read from the CAPTURE queue buffer.
+class M2mConverter {
+ public:
+  ~M2mConverter() { Close(); }
+
+  bool Open(const char* path, uint32_t srcFourcc, uint32_t dstFourcc);
+  void Close();
+
+  bool IsOpen() const { return m_fd >= 0; }
+  uint32_t GetSrcFourcc() const { return m_srcFourcc; }
+
+  // Runs one conversion.  Returns the result size, or 0 on failure.
+  size_t Convert(const uchar* src, size_t srcSize, int width, int height,
+                 int quality, uchar* dst, size_t dstCapacity);
+
+ private:
+  bool Configure(int width, int height, size_t srcSize);
+  bool MapBuffer(uint32_t type, void** data, size_t* length);
+  void Unconfigure();
+
+  int m_fd = -1;
+  uint32_t m_srcFourcc = 0;
+  uint32_t m_dstFourcc = 0;
+  int m_width = 0;
+  int m_height = 0;
+  int m_quality = -1;
+  void* m_srcData = nullptr;
+  size_t m_srcLength = 0;
+  void* m_dstData = nullptr;
+  size_t m_dstLength = 0;
+};
+
+bool TryFormat(int fd, uint32_t type, uint32_t fourcc) {
+  struct v4l2_format vfmt;
+  std::memset(&vfmt, 0, sizeof(vfmt));
+  vfmt.type = type;
+  vfmt.fmt.pix_mp.pixelformat = fourcc;
+  vfmt.fmt.pix_mp.width = 640;
+  vfmt.fmt.pix_mp.height = 480;
+  vfmt.fmt.pix_mp.num_planes = 1;
+  if (TryIoctl(fd, VIDIOC_TRY_FMT, &vfmt) != 0) {
+    return false;
+  }
+  return vfmt.fmt.pix_mp.pixelformat == fourcc;
+}
+
+bool M2mConverter::Open(const char* path, uint32_t srcFourcc,
+                        uint32_t dstFourcc) {
+  int fd = open(path, O_RDWR);
+  if (fd < 0) {
+    return false;
+  }
+
+  struct v4l2_capability vcap;
+  std::memset(&vcap, 0, sizeof(vcap));
+  uint32_t caps = 0;
+  if (TryIoctl(fd, VIDIOC_QUERYCAP, &vcap) == 0) {
+    caps = (vcap.capabilities & V4L2_CAP_DEVICE_CAPS) ? vcap.device_caps
+                                                      : vcap.capabilities;
+  }
+  if ((caps & V4L2_CAP_VIDEO_M2M_MPLANE) == 0 ||
+      !TryFormat(fd, V4L2_BUF_TYPE_VIDEO_OUTPUT_MPLANE, srcFourcc) ||
+      !TryFormat(fd, V4L2_BUF_TYPE_VIDEO_CAPTURE_MPLANE, dstFourcc)) {
+    close(fd);
+    return false;
+  }
+
+  m_fd = fd;
+  m_srcFourcc = srcFourcc;
+  m_dstFourcc = dstFourcc;
+  return true;
+}
+
+void M2mConverter::Close() {
+  if (m_fd < 0) {
+    return;
+  }
+  Unconfigure();
+  close(m_fd);
+  m_fd = -1;
+}
+
+bool M2mConverter::MapBuffer(uint32_t type, void** data, size_t* length) {
+  struct v4l2_plane plane;
+  struct v4l2_buffer buf;
+  std::memset(&plane, 0, sizeof(plane));
+  std::memset(&buf, 0, sizeof(buf));
+  buf.type = type;
+  buf.memory = V4L2_MEMORY_MMAP;
+  buf.index = 0;
+  buf.m.planes = &plane;
+  buf.length = 1;
+  if (DoIoctl(m_fd, VIDIOC_QUERYBUF, &buf) != 0) {
+    return false;
+  }
+  *data = mmap(nullptr, plane.length, PROT_READ | PROT_WRITE, MAP_SHARED,
+               m_fd, plane.m.mem_offset);
+  if (*data == MAP_FAILED) {
+    *data = nullptr;
+    return false;
+  }
+  *length = plane.length;
+  return true;
+}
+
+bool M2mConverter::Configure(int width, int height, size_t srcSize) {
+  if (width == m_width && height == m_height && m_srcData &&
+      srcSize <= m_srcLength) {
+    return true;
+  }
+  Unconfigure();
+
+  for (uint32_t type : {V4L2_BUF_TYPE_VIDEO_OUTPUT_MPLANE,
+                        V4L2_BUF_TYPE_VIDEO_CAPTURE_MPLANE}) {
+    bool isSrc = (type == V4L2_BUF_TYPE_VIDEO_OUTPUT_MPLANE);
+    struct v4l2_format vfmt;
+    std::memset(&vfmt, 0, sizeof(vfmt));
+    vfmt.type = type;
+    vfmt.fmt.pix_mp.pixelformat = isSrc ? m_srcFourcc : m_dstFourcc;
+    vfmt.fmt.pix_mp.width = width;
+    vfmt.fmt.pix_mp.height = height;
+    vfmt.fmt.pix_mp.num_planes = 1;
+    if (isSrc && m_srcFourcc == V4L2_PIX_FMT_JPEG) {
+      vfmt.fmt.pix_mp.plane_fmt[0].sizeimage = srcSize;
+    }
+    if (DoIoctl(m_fd, VIDIOC_S_FMT, &vfmt) != 0) {
+      return false;
+    }
+
+    struct v4l2_requestbuffers rb;
+    std::memset(&rb, 0, sizeof(rb));
+    rb.count = 1;
+    rb.type = type;
+    rb.memory = V4L2_MEMORY_MMAP;
+    if (DoIoctl(m_fd, VIDIOC_REQBUFS, &rb) != 0) {
+      return false;
+    }
+
+    if (!MapBuffer(type, isSrc ? &m_srcData : &m_dstData,
+                   isSrc ? &m_srcLength : &m_dstLength)) {
+      return false;
+    }
+
+    int streamType = type;
+    if (DoIoctl(m_fd, VIDIOC_STREAMON, &streamType) != 0) {
+      return false;
+    }
+  }
+
+  if (srcSize > m_srcLength) {
+    return false;
+  }
+  m_width = width;
+  m_height = height;
+  return true;
+}
+
+void M2mConverter::Unconfigure() {
+  for (uint32_t type : {V4L2_BUF_TYPE_VIDEO_OUTPUT_MPLANE,
+                        V4L2_BUF_TYPE_VIDEO_CAPTURE_MPLANE}) {
+    int streamType = type;
+    TryIoctl(m_fd, VIDIOC_STREAMOFF, &streamType);
+    struct v4l2_requestbuffers rb;
+    std::memset(&rb, 0, sizeof(rb));
+    rb.count = 0;
+    rb.type = type;
+    rb.memory = V4L2_MEMORY_MMAP;
+    TryIoctl(m_fd, VIDIOC_REQBUFS, &rb);
+  }
+  if (m_srcData) {
+    munmap(m_srcData, m_srcLength);
+    m_srcData = nullptr;
+  }
+  if (m_dstData) {
+    munmap(m_dstData, m_dstLength);
+    m_dstData = nullptr;
+  }
+  m_width = 0;
+  m_height = 0;
+}
+
+size_t M2mConverter::Convert(const uchar* src, size_t srcSize, int width,
+                             int height, int quality, uchar* dst,
+                             size_t dstCapacity) {
+  if (!Configure(width, height, srcSize)) {
+    return 0;
+  }
+
+  if (quality >= 0 && quality != m_quality) {
+    struct v4l2_control ctrl;
+    std::memset(&ctrl, 0, sizeof(ctrl));
+    ctrl.id = V4L2_CID_JPEG_COMPRESSION_QUALITY;
+    ctrl.value = quality;
+    TryIoctl(m_fd, VIDIOC_S_CTRL, &ctrl);  // best effort
+    m_quality = quality;
+  }
+
+  std::memcpy(m_srcData, src, srcSize);
+
+  for (uint32_t type : {V4L2_BUF_TYPE_VIDEO_OUTPUT_MPLANE,
+                        V4L2_BUF_TYPE_VIDEO_CAPTURE_MPLANE}) {
+    struct v4l2_plane plane;
+    struct v4l2_buffer buf;
+    std::memset(&plane, 0, sizeof(plane));
+    std::memset(&buf, 0, sizeof(buf));
+    buf.type = type;
+    buf.memory = V4L2_MEMORY_MMAP;
+    buf.index = 0;
+    buf.m.planes = &plane;
+    buf.length = 1;
+    if (type == V4L2_BUF_TYPE_VIDEO_OUTPUT_MPLANE) {
+      plane.bytesused = srcSize;
+    }
+    if (DoIoctl(m_fd, VIDIOC_QBUF, &buf) != 0) {
+      return 0;
+    }
+  }
+
+  struct pollfd pfd;
+  pfd.fd = m_fd;
+  pfd.events = POLLIN;
+  if (poll(&pfd, 1, 1000) <= 0) {
+    return 0;
+  }
+
+  size_t resultSize = 0;
+  for (uint32_t type : {V4L2_BUF_TYPE_VIDEO_CAPTURE_MPLANE,
+                        V4L2_BUF_TYPE_VIDEO_OUTPUT_MPLANE}) {
+    struct v4l2_plane plane;
+    struct v4l2_buffer buf;
+    std::memset(&plane, 0, sizeof(plane));
+    std::memset(&buf, 0, sizeof(buf));
+    buf.type = type;
+    buf.memory = V4L2_MEMORY_MMAP;
+    buf.m.planes = &plane;
+    buf.length = 1;
+    if (DoIoctl(m_fd, VIDIOC_DQBUF, &buf) != 0) {
+      return 0;
+    }
+    if (type == V4L2_BUF_TYPE_VIDEO_CAPTURE_MPLANE) {
+      resultSize = plane.bytesused;
+    }
+  }
+
+  if (resultSize == 0 || resultSize > dstCapacity) {
+    return 0;
+  }
+  std::memcpy(dst, m_dstData, resultSize);
+  return resultSize;
+}
+
+class V4L2JpegCodec : public JpegCodec {
+ public:
+  std::string_view GetName() const override { return "v4l2-m2m"; }
+
+  bool Encode(const uchar* src, int width, int height, int channels,
+              int quality, std::vector<uchar>* dst) override;
+  bool Decode(std::string_view src, int width, int height, int channels,
+              uchar* dst) override;
+
+  bool Probe();
+
+ private:
+  wpi::mutex m_encodeMutex;
+  M2mConverter m_encoder;
+  wpi::mutex m_decodeMutex;
+  M2mConverter m_decoder;
+};
+
+bool V4L2JpegCodec::Probe() {
+  // Look for M2M devices supporting BGR24 <-> JPEG
+  for (int i = 0; i < 64 && (!m_encoder.IsOpen() || !m_decoder.IsOpen());
+       ++i) {
+    auto path = fmt::format("/dev/video{}", i);
+    if (!m_encoder.IsOpen()) {
+      m_encoder.Open(path.c_str(), V4L2_PIX_FMT_BGR24, V4L2_PIX_FMT_JPEG);
+    }
+    if (!m_decoder.IsOpen()) {
+      m_decoder.Open(path.c_str(), V4L2_PIX_FMT_JPEG, V4L2_PIX_FMT_BGR24);
+    }
+  }
+  return m_encoder.IsOpen() || m_decoder.IsOpen();
+}
+
+bool V4L2JpegCodec::Encode(const uchar* src, int width, int height,
+                           int channels, int quality,
+                           std::vector<uchar>* dst) {
+  if (channels != 3 || !m_encoder.IsOpen()) {
+    return false;  // hardware path only handles BGR
+  }
+  std::scoped_lock lock{m_encodeMutex};
+  // Worst-case JPEG size bound; trimmed to the actual size below
+  dst->resize(static_cast<size_t>(width) * height * 3 / 2 + 1024);
+  size_t size =
+      m_encoder.Convert(src, static_cast<size_t>(width) * height * 3, width,
+                        height, quality, dst->data(), dst->size());
+  if (size == 0) {
+    return false;
+  }
+  dst->resize(size);
+  return true;
+}
+
+bool V4L2JpegCodec::Decode(std::string_view src, int width, int height,
+                           int channels, uchar* dst) {
+  if (channels != 3 || !m_decoder.IsOpen()) {
+    return false;  // hardware path only handles BGR
+  }
+  std::scoped_lock lock{m_decodeMutex};
+  size_t size = m_decoder.Convert(reinterpret_cast<const uchar*>(src.data()),
+                                  src.size(), width, height, -1, dst,
+                                  static_cast<size_t>(width) * height * 3);
+  return size == static_cast<size_t>(width) * height * 3;
+}
+
+}  // namespace
+
+std::unique_ptr<JpegCodec> CreateV4L2JpegCodec() {
+  auto codec = std::make_unique<V4L2JpegCodec>();
+  if (!codec->Probe()) {
+    return nullptr;
+  }
+  WPI_INFO(Instance::GetInstance().logger,
+           "using V4L2 M2M hardware JPEG codec");
+  return codec;
+}
+
+}  // namespace cs
@@ -14,6 +14,7 @@
 #endif
 
 #include <algorithm>
+#include <deque>
 #include <filesystem>
 
 #include <fmt/format.h>
@@ -233,6 +234,9 @@ void Downloader::ThreadMain() {
   std::unique_ptr<sftp::Session> session;
 
   static constexpr size_t kBufSize = 32 * 1024;
+  // read requests kept in flight on the channel; pipelining avoids paying a
+  // full round trip per kBufSize block
+  static constexpr size_t kNumRequests = 16;
   std::unique_ptr<uint8_t[]> copyBuf = std::make_unique<uint8_t[]>(kBufSize);
 
   std::unique_lock lock{m_mutex};
@@ -322,10 +326,31 @@ void Downloader::ThreadMain() {
 
             lock.unlock();
 
-            // open local file
+            // check for a file left by a previous (e.g. dropped) download
+            // attempt; resume where it left off
             std::error_code ec;
-            fs::file_t of = fs::OpenFileForWrite(localFilename, ec,
-                                                 fs::CD_CreateNew, fs::OF_None);
+            uint64_t startOffset = 0;
+            if (fs::exists(localFilename, ec) && !ec) {
+              uint64_t localSize = fs::file_size(localFilename, ec);
+              if (!ec) {
+                if (localSize == fileSize) {
+                  lock.lock();
+                  download.complete = 1.0;
+                  download.status = "already downloaded";
+                  continue;
+                } else if (localSize < fileSize) {
+                  startOffset = localSize;
+                }
+                // local file larger than remote: overwrite from scratch
+              }
+              ec.clear();
+            }
+
+            // open local file
+            fs::file_t of = fs::OpenFileForWrite(
+                localFilename, ec,
+                startOffset != 0 ? fs::CD_OpenAlways : fs::CD_CreateAlways,
+                startOffset != 0 ? fs::OF_Append : fs::OF_None);
             if (ec) {
               // failed to open
               lock.lock();
@@ -343,23 +368,64 @@ void Downloader::ThreadMain() {
             try {
               // open remote file
               sftp::File f = session->Open(remoteFilename, O_RDONLY, 0);
+              if (startOffset != 0) {
+                f.Seek(startOffset);
+              }
+
+              // copy in chunks, keeping multiple read requests in flight
+              struct Request {
+                sftp::File::AsyncId id;
+                uint32_t len;
+              };
+              std::deque<Request> requests;
+              uint64_t total = startOffset;
+              uint64_t issueOffset = startOffset;
+
+              auto issueReads = [&] {
+                while (requests.size() < kNumRequests &&
+                       issueOffset < fileSize) {
+                  uint32_t toRead = static_cast<uint32_t>((std::min)(
+                      fileSize - issueOffset, static_cast<uint64_t>(kBufSize)));
+                  requests.push_back({f.AsyncReadBegin(toRead), toRead});
+                  issueOffset += toRead;
+                }
+              };
+              issueReads();
 
-              // copy in chunks
-              uint64_t total = 0;
               while (total < fileSize) {
-                uint64_t toCopy = (std::min)(fileSize - total,
-                                             static_cast<uint64_t>(kBufSize));
-                auto copied = f.Read(copyBuf.get(), toCopy);
+                auto req = requests.front();
+                requests.pop_front();
+                auto copied = f.AsyncRead(copyBuf.get(), req.len, req.id);
+                if (copied == 0) {
+                  // remote file ended early (changed size?); keep the partial
+                  // file so a retry can resume
+                  close(ofd);
+                  lock.lock();
+                  download.status = "unexpected end of remote file";
+                  goto err;
+                }
                 if (write(ofd, copyBuf.get(), copied) !=
                     static_cast<int64_t>(copied)) {
-                  // error writing
+                  // error writing; keep the partial file so a retry can resume
                   close(ofd);
-                  fs::remove(localFilename, ec);
                   lock.lock();
                   download.status = "error writing local file";
                   goto err;
                 }
                 total += copied;
+
+                if (copied < req.len) {
+                  // short read; outstanding requests no longer line up with
+                  // the file position, so drain them and reissue from here
+                  for (auto&& drop : requests) {
+                    f.AsyncRead(copyBuf.get(), drop.len, drop.id);
+                  }
+                  requests.clear();
+                  f.Seek(total);
+                  issueOffset = total;
+                }
+                issueReads();
+
                 lock.lock();
                 download.complete = static_cast<float>(total) / fileSize;
                 lock.unlock();
@@ -376,9 +442,9 @@ void Downloader::ThreadMain() {
               }
             } catch (sftp::Exception& ex) {
               if (ofd != -1) {
-                // close local file and delete it (due to failure)
+                // close local file, but keep the partial download so a retry
+                // after reconnecting resumes where it left off
                 close(ofd);
-                fs::remove(localFilename, ec);
               }
               lock.lock();
               download.status = ex.what();
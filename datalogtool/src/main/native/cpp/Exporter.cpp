@@ -4,6 +4,7 @@
 
 #include "Exporter.h"
 
+#include <algorithm>
 #include <atomic>
 #include <ctime>
 #include <future>
@@ -12,6 +13,8 @@
 #include <set>
 #include <string>
 #include <string_view>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include <fmt/chrono.h>
@@ -63,9 +66,6 @@ struct Entry {
   bool typeConflict = false;
   bool metadataConflict = false;
   bool selected = true;
-
-  // used only during export
-  int column = -1;
 };
 
 struct EntryTreeNode {
@@ -529,6 +529,10 @@ static void ValueToCsv(wpi::raw_ostream& os, const Entry& entry,
 }
 
 static void ExportCsvFile(InputFile& f, wpi::raw_ostream& os, int style) {
+  // column assignments are kept local so multiple files can export in
+  // parallel
+  wpi::DenseMap<Entry*, int> columns;
+
   // header
   if (style == 0) {
     os << "Timestamp,Name,Value\n";
@@ -542,9 +546,7 @@ static void ExportCsvFile(InputFile& f, wpi::raw_ostream& os, int style) {
         os << ',' << '"';
         PrintEscapedCsvString(os, entry.first);
         os << '"';
-        entry.second->column = columnNum++;
-      } else {
-        entry.second->column = -1;
+        columns[entry.second.get()] = columnNum++;
       }
     }
     os << '\n';
@@ -578,37 +580,145 @@ static void ExportCsvFile(InputFile& f, wpi::raw_ostream& os, int style) {
         os << '"' << ',';
         ValueToCsv(os, *entry, record);
         os << '\n';
-      } else if (style == 1 && entry->column != -1) {
-        fmt::print(os, "{},", record.GetTimestamp() / 1000000.0);
-        for (int i = 0; i < entry->column; ++i) {
-          os << ',';
+      } else if (style == 1) {
+        auto columnIt = columns.find(entry);
+        if (columnIt != columns.end()) {
+          fmt::print(os, "{},", record.GetTimestamp() / 1000000.0);
+          for (int i = 0; i < columnIt->second; ++i) {
+            os << ',';
+          }
+          ValueToCsv(os, *entry, record);
+          os << '\n';
         }
-        ValueToCsv(os, *entry, record);
-        os << '\n';
       }
     }
   }
 }
 
-static void ExportCsv(std::string_view outputFolder, int style) {
-  fs::path outPath{outputFolder};
-  for (auto&& f : gInputFiles) {
-    if (f.second->datalog) {
-      std::error_code ec;
+static void ExportColumnsFile(InputFile& f, const fs::path& dir) {
+  // one output file per selected entry (Timestamp,Value), so downstream
+  // analysis tools can load a single channel without parsing the rest
+  wpi::DenseMap<int, Entry*> nameMap;
+  std::map<Entry*, std::unique_ptr<wpi::raw_fd_ostream>> files;
+
+  auto getFile = [&](Entry* entry) -> wpi::raw_ostream* {
+    auto it = files.find(entry);
+    if (it != files.end()) {
+      return it->second.get();
+    }
+    std::string name = entry->name;
+    for (auto& ch : name) {
+      if (ch == '/' || ch == '\\' || ch == ':') {
+        ch = '_';
+      }
+    }
+    std::error_code ec;
+    auto of = fs::OpenFileForWrite(dir / fs::path{name + ".csv"}, ec,
+                                   fs::CD_CreateAlways, fs::OF_Text);
+    if (ec) {
+      std::scoped_lock lock{gExportMutex};
+      gExportErrors.emplace_back(
+          fmt::format("{}: {}", entry->name, ec.message()));
+      files.emplace(entry, nullptr);
+      return nullptr;
+    }
+    auto os = std::make_unique<wpi::raw_fd_ostream>(
+        fs::FileToFd(of, ec, fs::OF_Text), true);
+    *os << "Timestamp,Value\n";
+    return files.emplace(entry, std::move(os)).first->second.get();
+  };
+
+  for (auto&& record : f.datalog->GetReader()) {
+    if (record.IsStart()) {
+      wpi::log::StartRecordData data;
+      if (record.GetStartData(&data)) {
+        auto it = gEntries.find(data.name);
+        if (it != gEntries.end() && it->second->selected) {
+          nameMap[data.entry] = it->second.get();
+        }
+      }
+    } else if (record.IsFinish()) {
+      int entry;
+      if (record.GetFinishEntry(&entry)) {
+        nameMap.erase(entry);
+      }
+    } else if (!record.IsControl()) {
+      auto entryIt = nameMap.find(record.GetEntry());
+      if (entryIt == nameMap.end()) {
+        continue;
+      }
+      Entry* entry = entryIt->second;
+      if (auto os = getFile(entry)) {
+        fmt::print(*os, "{},", record.GetTimestamp() / 1000000.0);
+        ValueToCsv(*os, *entry, record);
+        *os << '\n';
+      }
+    }
+  }
+}
+
+static void ExportFile(InputFile& f, const std::string& name,
+                       const fs::path& outPath, int style) {
+  if (f.datalog) {
+    std::error_code ec;
+    if (style == 2) {
+      auto dir = outPath / fs::path{fmt::format("{}_columns", f.stem)};
+      fs::create_directories(dir, ec);
+      if (ec) {
+        std::scoped_lock lock{gExportMutex};
+        gExportErrors.emplace_back(fmt::format("{}: {}", name, ec.message()));
+        ++gExportCount;
+        return;
+      }
+      ExportColumnsFile(f, dir);
+    } else {
       auto of = fs::OpenFileForWrite(
-          outPath / fs::path{f.first}.replace_extension("csv"), ec,
+          outPath / fs::path{name}.replace_extension("csv"), ec,
           fs::CD_CreateNew, fs::OF_Text);
       if (ec) {
         std::scoped_lock lock{gExportMutex};
-        gExportErrors.emplace_back(
-            fmt::format("{}: {}", f.first, ec.message()));
+        gExportErrors.emplace_back(fmt::format("{}: {}", name, ec.message()));
         ++gExportCount;
-        continue;
+        return;
       }
       wpi::raw_fd_ostream os{fs::FileToFd(of, ec, fs::OF_Text), true};
-      ExportCsvFile(*f.second, os, style);
+      ExportCsvFile(f, os, style);
+    }
+  }
+  ++gExportCount;
+}
+
+static void ExportCsv(std::string_view outputFolder, int style) {
+  fs::path outPath{outputFolder};
+
+  // decode each file on its own worker; entry id mappings depend on control
+  // records earlier in the same file, so the file is the natural parallel
+  // unit
+  std::vector<std::pair<const std::string*, InputFile*>> files;
+  for (auto&& f : gInputFiles) {
+    files.emplace_back(&f.first, f.second.get());
+  }
+  std::atomic<size_t> nextFile{0};
+  auto worker = [&] {
+    for (;;) {
+      size_t i = nextFile.fetch_add(1);
+      if (i >= files.size()) {
+        break;
+      }
+      ExportFile(*files[i].second, *files[i].first, outPath, style);
     }
-    ++gExportCount;
+  };
+
+  size_t numWorkers = (std::min)(
+      files.size(),
+      static_cast<size_t>((std::max)(1u, std::thread::hardware_concurrency())));
+  std::vector<std::future<void>> workers;
+  for (size_t i = 1; i < numWorkers; ++i) {
+    workers.emplace_back(std::async(std::launch::async, worker));
+  }
+  worker();
+  for (auto&& w : workers) {
+    w.wait();
   }
 }
 
@@ -625,7 +735,8 @@ void DisplayOutput(glass::Storage& storage) {
     }
     ImGui::TextUnformatted(outputFolder.c_str());
 
-    static const char* const options[] = {"List", "Table"};
+    static const char* const options[] = {"List", "Table",
+                                          "File per entry (columnar)"};
     static int style = 0;
     ImGui::SetNextItemWidth(ImGui::GetFontSize() * 8);
     ImGui::Combo("Style", &style, options,
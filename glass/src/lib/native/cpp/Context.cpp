@@ -255,7 +255,12 @@ static wpi::json WindowToJson() {
   return out;
 }
 
-bool SaveWindowStorageImpl(const std::string& filename) {
+static bool SaveFileIfChanged(Context* ctx, const std::string& filename,
+                              const std::string& contents) {
+  auto it = ctx->storageSavedContents.find(filename);
+  if (it != ctx->storageSavedContents.end() && it->getValue() == contents) {
+    return true;  // unchanged since last save; skip the rewrite
+  }
   std::error_code ec;
   wpi::raw_fd_ostream os{filename, ec};
   if (ec) {
@@ -263,23 +268,22 @@ bool SaveWindowStorageImpl(const std::string& filename) {
                    ec.message().c_str());
     return false;
   }
-  WindowToJson().dump(os, 2);
-  os << '\n';
+  os << contents;
+  ctx->storageSavedContents[filename] = contents;
   return true;
 }
 
+bool SaveWindowStorageImpl(const std::string& filename) {
+  std::string contents = WindowToJson().dump(2);
+  contents += '\n';
+  return SaveFileIfChanged(gContext, filename, contents);
+}
+
 static bool SaveStorageRootImpl(Context* ctx, const std::string& filename,
                                 const Storage& storage) {
-  std::error_code ec;
-  wpi::raw_fd_ostream os{filename, ec};
-  if (ec) {
-    ImGui::LogText("error opening %s: %s", filename.c_str(),
-                   ec.message().c_str());
-    return false;
-  }
-  storage.ToJson().dump(os, 2);
-  os << '\n';
-  return true;
+  std::string contents = storage.ToJson().dump(2);
+  contents += '\n';
+  return SaveFileIfChanged(ctx, filename, contents);
 }
 
 static bool SaveStorageImpl(Context* ctx, std::string_view dir,
@@ -303,6 +307,8 @@ static bool SaveStorageImpl(Context* ctx, std::string_view dir,
         fs::remove(dirPath / fmt::format("{}-{}.json", name, rootName), ec);
       }
     }
+    // the files are gone, so forget their saved contents
+    ctx->storageSavedContents.clear();
   }
 
   bool rv = SaveWindowStorageImpl(
@@ -4,12 +4,16 @@
 
 #include "glass/other/Field2D.h"
 
+#include <stdint.h>
+
 #include <algorithm>
 #include <cmath>
 #include <cstdio>
+#include <map>
 #include <memory>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 #include <frc/geometry/Pose2d.h>
@@ -192,7 +196,42 @@ class ObjectInfo {
   void DrawLine(ImDrawList* drawList, std::span<const ImVec2> points) const;
 
   void LoadImage();
-  const gui::Texture& GetTexture() const { return m_texture; }
+  const gui::Texture& GetTexture() const {
+    static gui::Texture empty;
+    return m_texture ? *m_texture : empty;
+  }
+
+  // Cached screen-space geometry, rebuilt only when the pose array, field
+  // frame, or geometry-affecting display options change (see
+  // FieldDisplay::DisplayObject)
+  struct GeometryCache {
+    bool IsValid(uint64_t posesEpoch, const FieldFrameData& ffd,
+                 const DisplayOptions& options) const {
+      return valid && posesEpoch == this->posesEpoch && ffd.min.x == min.x &&
+             ffd.min.y == min.y && ffd.max.x == max.x && ffd.max.y == max.y &&
+             ffd.scale == scale && options.style == style &&
+             options.width == width && options.length == length &&
+             options.arrows == arrows && options.arrowSize == arrowSize;
+    }
+
+    bool valid = false;
+    uint64_t posesEpoch = 0;
+    ImVec2 min;
+    ImVec2 max;
+    float scale = 0;
+    DisplayOptions::Style style = DisplayOptions::kHidden;
+    units::meter_t width = 0_m;
+    units::meter_t length = 0_m;
+    bool arrows = false;
+    int arrowSize = 0;
+
+    std::vector<ImVec2> corners;    // 4 per pose (box style only)
+    std::vector<ImVec2> arrowPts;   // 3 per pose (if arrows enabled)
+    std::vector<ImVec2> centerLine;
+    std::vector<ImVec2> leftLine;
+    std::vector<ImVec2> rightLine;
+  };
+  GeometryCache m_geomCache;
 
  private:
   void Reset();
@@ -216,7 +255,7 @@ class ObjectInfo {
   bool& m_selectable;
 
   std::string& m_filename;
-  gui::Texture m_texture;
+  std::shared_ptr<gui::Texture> m_texture;
 };
 
 class FieldInfo {
@@ -242,7 +281,7 @@ class FieldInfo {
   std::unique_ptr<pfd::open_file> m_fileOpener;
 
   std::string& m_filename;
-  gui::Texture m_texture;
+  std::shared_ptr<gui::Texture> m_texture;
 
   // in meters
   float& m_width;
@@ -263,6 +302,28 @@ static PoseDragState gDragState;
 static PopupState gPopupState;
 static DisplayUnits gDisplayUnits = kDisplayMeters;
 
+// Shared decoded-image registry.  Multiple field widgets (e.g. several
+// Field2D windows showing the same save file) commonly point at the same
+// field or object image; decode it once and share the texture.  Entries
+// are weak, so the decoded copy is freed when the last widget using it
+// resets or closes.
+static std::shared_ptr<gui::Texture> LoadSharedTexture(const std::string& fn) {
+  static std::map<std::string, std::weak_ptr<gui::Texture>, std::less<>> cache;
+  std::erase_if(cache,
+                [](const auto& entry) { return entry.second.expired(); });
+  auto& slot = cache[fn];
+  if (auto texture = slot.lock()) {
+    return texture;
+  }
+  auto texture =
+      std::make_shared<gui::Texture>(gui::Texture::CreateFromFile(fn.c_str()));
+  if (!*texture) {
+    return nullptr;
+  }
+  slot = texture;
+  return texture;
+}
+
 static double ConvertDisplayLength(units::meter_t v) {
   switch (gDisplayUnits) {
     case kDisplayFeet:
@@ -369,7 +430,7 @@ void FieldInfo::DisplaySettings() {
 }
 
 void FieldInfo::Reset() {
-  m_texture = gui::Texture{};
+  m_texture.reset();
   m_filename.clear();
   m_imageWidth = 0;
   m_imageHeight = 0;
@@ -492,14 +553,14 @@ void FieldInfo::LoadJson(std::string_view jsonfile) {
 
 bool FieldInfo::LoadImageImpl(const std::string& fn) {
   fmt::print("GUI: loading field image '{}'\n", fn);
-  auto texture = gui::Texture::CreateFromFile(fn.c_str());
+  auto texture = LoadSharedTexture(fn);
   if (!texture) {
     std::puts("GUI: could not read field image");
     return false;
   }
   m_texture = std::move(texture);
-  m_imageWidth = m_texture.GetWidth();
-  m_imageHeight = m_texture.GetHeight();
+  m_imageWidth = m_texture->GetWidth();
+  m_imageHeight = m_texture->GetHeight();
   m_filename = fn;
   return true;
 }
@@ -533,7 +594,7 @@ FieldFrameData FieldInfo::GetFrameData(ImVec2 min, ImVec2 max) const {
 
 void FieldInfo::Draw(ImDrawList* drawList, const FieldFrameData& ffd) const {
   if (m_texture && m_imageHeight != 0 && m_imageWidth != 0) {
-    drawList->AddImage(m_texture, ffd.imageMin, ffd.imageMax);
+    drawList->AddImage(*m_texture, ffd.imageMin, ffd.imageMax);
   }
 
   // draw the field "active area" as a yellow boundary box
@@ -563,7 +624,7 @@ ObjectInfo::ObjectInfo(Storage& storage)
       m_filename{storage.GetString("image")} {}
 
 DisplayOptions ObjectInfo::GetDisplayOptions() const {
-  DisplayOptions rv{m_texture};
+  DisplayOptions rv{GetTexture()};
   rv.style = static_cast<DisplayOptions::Style>(m_style.GetValue());
   rv.weight = m_weight;
   rv.color = ImGui::ColorConvertFloat4ToU32(m_color.GetColor());
@@ -657,7 +718,7 @@ void ObjectInfo::DrawLine(ImDrawList* drawList,
 }
 
 void ObjectInfo::Reset() {
-  m_texture = gui::Texture{};
+  m_texture.reset();
   m_filename.clear();
 }
 
@@ -678,7 +739,7 @@ void ObjectInfo::LoadImage() {
 
 bool ObjectInfo::LoadImageImpl(const std::string& fn) {
   fmt::print("GUI: loading object image '{}'\n", fn);
-  auto texture = gui::Texture::CreateFromFile(fn.c_str());
+  auto texture = LoadSharedTexture(fn);
   if (!texture) {
     std::fputs("GUI: could not read object image\n", stderr);
     return false;
@@ -1030,6 +1091,48 @@ void FieldDisplay::DisplayObject(FieldObjectModel& model,
   obj->LoadImage();
 
   auto displayOptions = obj->GetDisplayOptions();
+  auto& cache = obj->m_geomCache;
+
+  bool insertOverride = gPopupState.GetInsertModel() == &model;
+  // hit testing and dragging need per-pose frame data, so the cache can only
+  // be replayed when no interaction with this object is possible
+  bool wantInteraction =
+      gDragState.target.objModel == &model ||
+      (displayOptions.selectable && m_isHovered && !gDragState.target.objModel);
+
+  if (!insertOverride && !wantInteraction &&
+      cache.IsValid(model.GetPosesEpoch(), m_ffd, displayOptions)) {
+    // replay cached geometry
+    m_drawSplit.Split(m_drawList, 2);
+    m_drawSplit.SetCurrentChannel(m_drawList, 1);
+    for (size_t i = 0; i + 3 < cache.corners.size(); i += 4) {
+      if (displayOptions.texture) {
+        m_drawList->AddImageQuad(displayOptions.texture, cache.corners[i],
+                                 cache.corners[i + 1], cache.corners[i + 2],
+                                 cache.corners[i + 3]);
+      } else {
+        m_drawList->AddQuad(cache.corners[i], cache.corners[i + 1],
+                            cache.corners[i + 2], cache.corners[i + 3],
+                            displayOptions.color, displayOptions.weight);
+      }
+    }
+    for (size_t i = 0; i + 2 < cache.arrowPts.size(); i += 3) {
+      m_drawList->AddTriangle(cache.arrowPts[i], cache.arrowPts[i + 1],
+                              cache.arrowPts[i + 2], displayOptions.arrowColor,
+                              displayOptions.arrowWeight);
+    }
+    m_drawSplit.SetCurrentChannel(m_drawList, 0);
+    obj->DrawLine(m_drawList, cache.centerLine);
+    obj->DrawLine(m_drawList, cache.leftLine);
+    obj->DrawLine(m_drawList, cache.rightLine);
+    m_drawSplit.Merge(m_drawList);
+    PopID();
+    return;
+  }
+
+  cache.valid = false;
+  cache.corners.resize(0);
+  cache.arrowPts.resize(0);
 
   m_centerLine.resize(0);
   m_leftLine.resize(0);
@@ -1037,9 +1140,7 @@ void FieldDisplay::DisplayObject(FieldObjectModel& model,
 
   m_drawSplit.Split(m_drawList, 2);
   m_drawSplit.SetCurrentChannel(m_drawList, 1);
-  auto poses = gPopupState.GetInsertModel() == &model
-                   ? gPopupState.GetInsertPoses()
-                   : model.GetPoses();
+  auto poses = insertOverride ? gPopupState.GetInsertPoses() : model.GetPoses();
   size_t i = 0;
   for (auto&& pose : poses) {
     PoseFrameData pfd{pose, model, i, m_ffd, displayOptions};
@@ -1062,6 +1163,15 @@ void FieldDisplay::DisplayObject(FieldObjectModel& model,
 
     // draw
     pfd.Draw(m_drawList, &m_centerLine, &m_leftLine, &m_rightLine);
+
+    // capture screen-space geometry for replay on unchanged frames
+    if (displayOptions.style == DisplayOptions::kBoxImage) {
+      cache.corners.insert(cache.corners.end(), pfd.m_corners,
+                           pfd.m_corners + 4);
+    }
+    if (displayOptions.arrows) {
+      cache.arrowPts.insert(cache.arrowPts.end(), pfd.m_arrow, pfd.m_arrow + 3);
+    }
     ++i;
   }
 
@@ -1071,6 +1181,23 @@ void FieldDisplay::DisplayObject(FieldObjectModel& model,
   obj->DrawLine(m_drawList, m_rightLine);
   m_drawSplit.Merge(m_drawList);
 
+  if (!insertOverride) {
+    // key the cache on the epoch as of after any drag edits above
+    cache.posesEpoch = model.GetPosesEpoch();
+    cache.min = m_ffd.min;
+    cache.max = m_ffd.max;
+    cache.scale = m_ffd.scale;
+    cache.style = displayOptions.style;
+    cache.width = displayOptions.width;
+    cache.length = displayOptions.length;
+    cache.arrows = displayOptions.arrows;
+    cache.arrowSize = displayOptions.arrowSize;
+    cache.centerLine = m_centerLine;
+    cache.leftLine = m_leftLine;
+    cache.rightLine = m_rightLine;
+    cache.valid = true;
+  }
+
   PopID();
 }
 
@@ -4,6 +4,8 @@
 
 #include "glass/other/Log.h"
 
+#include <utility>
+
 #include <imgui.h>
 
 using namespace glass;
@@ -11,46 +13,59 @@ using namespace glass;
 LogData::LogData(size_t maxLines) : m_maxLines{maxLines} {}
 
 void LogData::Clear() {
-  m_buf.clear();
-  m_lineOffsets.clear();
-  m_lineOffsets.push_back(0);
+  m_lines.clear();
+  m_partial.clear();
 }
 
 void LogData::Append(std::string_view msg) {
-  if (m_lineOffsets.size() >= m_maxLines) {
-    Clear();
+  while (!msg.empty()) {
+    auto pos = msg.find('\n');
+    if (pos == std::string_view::npos) {
+      m_partial.append(msg);
+      break;
+    }
+    m_partial.append(msg.substr(0, pos));
+    m_lines.emplace_back(std::move(m_partial));
+    m_partial.clear();
+    msg.remove_prefix(pos + 1);
   }
 
-  size_t oldSize = m_buf.size();
-  m_buf.append(msg);
-  for (size_t newSize = m_buf.size(); oldSize < newSize; ++oldSize) {
-    if (m_buf[oldSize] == '\n') {
-      m_lineOffsets.push_back(oldSize + 1);
-    }
+  // discard oldest lines rather than wholesale clearing
+  while (m_lines.size() > m_maxLines) {
+    m_lines.pop_front();
   }
 }
 
-const std::string& LogData::GetBuffer() {
-  return m_buf;
+std::string LogData::GetBuffer() const {
+  size_t size = m_partial.size();
+  for (auto&& line : m_lines) {
+    size += line.size() + 1;
+  }
+  std::string rv;
+  rv.reserve(size);
+  for (auto&& line : m_lines) {
+    rv += line;
+    rv += '\n';
+  }
+  rv += m_partial;
+  return rv;
 }
 
 void glass::DisplayLog(LogData* data, bool autoScroll) {
-  if (data->m_buf.empty()) {
+  size_t numLines = data->m_lines.size() + (data->m_partial.empty() ? 0 : 1);
+  if (numLines == 0) {
     return;
   }
   ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0, 0));
-  const char* buf = data->m_buf.data();
-  const char* bufEnd = buf + data->m_buf.size();
   ImGuiListClipper clipper;
-  clipper.Begin(data->m_lineOffsets.size());
+  clipper.Begin(numLines);
   while (clipper.Step()) {
     for (size_t lineNum = clipper.DisplayStart;
          lineNum < static_cast<size_t>(clipper.DisplayEnd); lineNum++) {
-      const char* lineStart = buf + data->m_lineOffsets[lineNum];
-      const char* lineEnd = (lineNum + 1 < data->m_lineOffsets.size())
-                                ? (buf + data->m_lineOffsets[lineNum + 1] - 1)
-                                : bufEnd;
-      ImGui::TextUnformatted(lineStart, lineEnd);
+      const std::string& line = lineNum < data->m_lines.size()
+                                    ? data->m_lines[lineNum]
+                                    : data->m_partial;
+      ImGui::TextUnformatted(line.data(), line.data() + line.size());
     }
   }
   clipper.End();
@@ -67,7 +82,7 @@ void LogView::Display() {
     if (ImGui::Selectable("Clear")) {
       m_data->Clear();
     }
-    const auto& buf = m_data->GetBuffer();
+    auto buf = m_data->GetBuffer();
     if (ImGui::Selectable("Copy to Clipboard", false,
                           buf.empty() ? ImGuiSelectableFlags_Disabled : 0)) {
       ImGui::SetClipboardText(buf.c_str());
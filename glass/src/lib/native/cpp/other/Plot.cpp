@@ -84,6 +84,9 @@ class PlotSeries {
            (m_digital.GetValue() == kAuto && m_source && m_source->IsDigital());
   }
   void AppendValue(double value, int64_t time);
+  void AddPoint(const ImPlotPoint& pt);
+  void AppendLod(const ImPlotPoint& pt);
+  ImPlotPoint Newest() const;
 
   // source linkage
   DataSource* m_source = nullptr;
@@ -110,6 +113,25 @@ class PlotSeries {
   std::atomic<int> m_size = 0;
   std::atomic<int> m_offset = 0;
   ImPlotPoint m_data[kMaxSize];
+
+  // Hierarchical min/max downsampling of the raw ring, maintained
+  // incrementally on append.  Each level is a ring of buckets covering
+  // bucketSize raw points; a bucket keeps four points (first, min, max,
+  // last), so an analog series can be drawn with its min/max envelope
+  // intact using only screen-resolution-many points.  The renderer picks
+  // the coarsest level that still gives ~2 points per pixel for the
+  // visible range and falls back to raw data when zoomed in.
+  static constexpr int kNumLodLevels = 4;
+  static constexpr int kLodBucketSizes[kNumLodLevels] = {4, 16, 64, 256};
+  struct LodLevel {
+    int bucketSize = 0;
+    int capacity = 0;  // in buckets
+    std::vector<ImPlotPoint> points;  // 4 per bucket
+    int size = 0;    // buckets in use
+    int offset = 0;  // oldest bucket when full
+    int fill = 0;    // raw points in the newest bucket
+  };
+  LodLevel m_lod[kNumLodLevels];
 };
 
 class Plot {
@@ -210,6 +232,12 @@ PlotSeries::PlotSeries(Storage& storage, int yAxis)
       m_digitalBitHeight{storage.GetInt("digitalBitHeight", 8)},
       m_digitalBitGap{storage.GetInt("digitalBitGap", 4)} {
   m_yAxis = yAxis;
+  for (int i = 0; i < kNumLodLevels; ++i) {
+    m_lod[i].bucketSize = kLodBucketSizes[i];
+    m_lod[i].capacity =
+        (kMaxSize + kLodBucketSizes[i] - 1) / kLodBucketSizes[i];
+    m_lod[i].points.resize(4 * m_lod[i].capacity);
+  }
 }
 
 PlotSeries::PlotSeries(Storage& storage, std::string_view id)
@@ -251,44 +279,69 @@ void PlotSeries::SetSource(DataSource* source) {
       [this](double value, int64_t time) { AppendValue(value, time); });
 }
 
+ImPlotPoint PlotSeries::Newest() const {
+  if (m_size < kMaxSize) {
+    return m_data[m_size - 1];
+  }
+  return m_data[(m_offset + kMaxSize - 1) % kMaxSize];
+}
+
 void PlotSeries::AppendValue(double value, int64_t timeUs) {
   double time = (timeUs != 0 ? timeUs : wpi::Now()) * 1.0e-6;
   if (IsDigital()) {
-    if (m_size < kMaxSize) {
-      m_data[m_size] = ImPlotPoint{time, value};
-      ++m_size;
-    } else {
-      m_data[m_offset] = ImPlotPoint{time, value};
-      m_offset = (m_offset + 1) % kMaxSize;
-    }
+    AddPoint(ImPlotPoint{time, value});
   } else {
     // as an analog graph draws linear lines in between each value,
     // insert duplicate value if "long" time between updates so it
     // looks appropriately flat
-    if (m_size < kMaxSize) {
-      if (m_size > 0) {
-        if ((time - m_data[m_size - 1].x) > kTimeGap) {
-          m_data[m_size] = ImPlotPoint{time, m_data[m_size - 1].y};
-          ++m_size;
-        }
+    if (m_size > 0) {
+      ImPlotPoint last = Newest();
+      if ((time - last.x) > kTimeGap) {
+        AddPoint(ImPlotPoint{time, last.y});
       }
-      m_data[m_size] = ImPlotPoint{time, value};
-      ++m_size;
-    } else {
-      if (m_offset == 0) {
-        if ((time - m_data[kMaxSize - 1].x) > kTimeGap) {
-          m_data[m_offset] = ImPlotPoint{time, m_data[kMaxSize - 1].y};
-          ++m_offset;
-        }
+    }
+    AddPoint(ImPlotPoint{time, value});
+  }
+}
+
+void PlotSeries::AddPoint(const ImPlotPoint& pt) {
+  if (m_size < kMaxSize) {
+    m_data[m_size] = pt;
+    ++m_size;
+  } else {
+    m_data[m_offset] = pt;
+    m_offset = (m_offset + 1) % kMaxSize;
+  }
+  AppendLod(pt);
+}
+
+void PlotSeries::AppendLod(const ImPlotPoint& pt) {
+  for (auto& level : m_lod) {
+    if (level.fill == 0) {
+      // start a new bucket, evicting the oldest if the ring is full
+      ImPlotPoint* bucket;
+      if (level.size < level.capacity) {
+        bucket = &level.points[4 * level.size];
+        ++level.size;
       } else {
-        if ((time - m_data[m_offset - 1].x) > kTimeGap) {
-          m_data[m_offset] = ImPlotPoint{time, m_data[m_offset - 1].y};
-          m_offset = (m_offset + 1) % kMaxSize;
-        }
+        bucket = &level.points[4 * level.offset];
+        level.offset = (level.offset + 1) % level.capacity;
+      }
+      bucket[0] = bucket[1] = bucket[2] = bucket[3] = pt;
+    } else {
+      int newest = level.size < level.capacity
+                       ? level.size - 1
+                       : (level.offset + level.capacity - 1) % level.capacity;
+      ImPlotPoint* bucket = &level.points[4 * newest];
+      if (pt.y < bucket[1].y) {
+        bucket[1] = pt;
+      }
+      if (pt.y > bucket[2].y) {
+        bucket[2] = pt;
       }
-      m_data[m_offset] = ImPlotPoint{time, value};
-      m_offset = (m_offset + 1) % kMaxSize;
+      bucket[3] = pt;
     }
+    level.fill = (level.fill + 1) % level.bucketSize;
   }
 }
 
@@ -359,7 +412,84 @@ PlotSeries::Action PlotSeries::EmitPlot(PlotView& view, double now, size_t i,
       ImPlot::SetAxis(ImAxis_Y1);
     }
     ImPlot::SetNextMarkerStyle(m_marker.GetValue() - 1);
-    ImPlot::PlotLineG(label, getter, &getterData, size + 1);
+
+    // Level-of-detail selection: estimate how many raw points fall inside
+    // the visible X range and pick the coarsest downsampling level that
+    // still gives ~2 points per pixel.  Zoomed-in views (or short
+    // histories) use the raw data.
+    int lodLevel = -1;
+    if (size > 1) {
+      double oldestX = (size < kMaxSize ? m_data[0] : m_data[offset]).x;
+      double newestX =
+          m_data[offset == 0 ? size - 1 : offset - 1].x;
+      double dataSpan = newestX - oldestX;
+      auto limits = ImPlot::GetPlotLimits(ImAxis_X1, ImAxis_Y1 + m_yAxis);
+      double zeroTime = getterData.zeroTime;
+      double visibleSpan =
+          (std::min)(limits.X.Max, newestX - zeroTime) -
+          (std::max)(limits.X.Min, oldestX - zeroTime);
+      if (dataSpan > 0 && visibleSpan > 0) {
+        double rawInView = size * visibleSpan / dataSpan;
+        double target = 2.0 * ImPlot::GetPlotSize().x;
+        for (int i = 0; i < kNumLodLevels; ++i) {
+          if (rawInView * 4 / m_lod[i].bucketSize <= target) {
+            if (rawInView > target) {
+              lodLevel = i;
+            }
+            break;
+          }
+          if (i == kNumLodLevels - 1) {
+            lodLevel = i;
+          }
+        }
+      }
+    }
+
+    if (lodLevel >= 0) {
+      auto& lvl = m_lod[lodLevel];
+      struct LodGetterData {
+        double now;
+        double zeroTime;
+        ImPlotPoint* points;
+        int buckets;
+        int offset;
+      };
+      LodGetterData lodData = {now, getterData.zeroTime, lvl.points.data(),
+                               lvl.size, lvl.offset};
+      auto lodGetter = [](int idx, void* data) {
+        auto d = static_cast<LodGetterData*>(data);
+        if (idx == 4 * d->buckets) {
+          int newest = d->offset == 0 ? d->buckets - 1 : d->offset - 1;
+          return ImPlotPoint{d->now - d->zeroTime,
+                             d->points[4 * newest + 3].y};
+        }
+        int bucket = d->offset + idx / 4;
+        if (bucket >= d->buckets) {
+          bucket -= d->buckets;
+        }
+        ImPlotPoint* pts = &d->points[4 * bucket];
+        ImPlotPoint pt;
+        switch (idx % 4) {
+          case 0:
+            pt = pts[0];
+            break;
+          case 1:
+            // min/max are emitted in time order to keep the line monotonic
+            pt = pts[1].x <= pts[2].x ? pts[1] : pts[2];
+            break;
+          case 2:
+            pt = pts[1].x <= pts[2].x ? pts[2] : pts[1];
+            break;
+          default:
+            pt = pts[3];
+            break;
+        }
+        return ImPlotPoint{pt.x - d->zeroTime, pt.y};
+      };
+      ImPlot::PlotLineG(label, lodGetter, &lodData, 4 * lvl.size + 1);
+    } else {
+      ImPlot::PlotLineG(label, getter, &getterData, size + 1);
+    }
   }
 
   // DND source for PlotSeries
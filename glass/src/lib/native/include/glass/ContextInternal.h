@@ -35,6 +35,9 @@ class Context {
   std::string storageName = "imgui";
   wpi::SmallVector<Storage*, 32> storageStack;
   wpi::StringMap<std::unique_ptr<Storage>> storageRoots;
+  // Last-saved contents per settings file; autosave uses this to skip
+  // rewriting files whose serialized contents haven't changed.
+  wpi::StringMap<std::string> storageSavedContents;
   wpi::StringMap<bool> deviceHidden;
   wpi::StringMap<DataSource*> sources;
   Storage& sourceNameStorage;
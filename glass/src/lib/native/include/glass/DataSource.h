@@ -39,11 +39,20 @@ class DataSource {
   void SetValue(double value, int64_t time = 0) {
     m_value = value;
     m_valueTime = time;
+    ++m_epoch;
     valueChanged(value, time);
   }
   double GetValue() const { return m_value; }
   int64_t GetValueTime() const { return m_valueTime; }
 
+  /**
+   * Returns the change epoch; incremented on every SetValue() call.  Widgets
+   * that derive expensive display state from the value can remember the epoch
+   * and skip the rebuild when it is unchanged, rather than re-deriving every
+   * frame or connecting to valueChanged.
+   */
+  uint64_t GetEpoch() const { return m_epoch; }
+
   // drag source helpers
   void LabelText(const char* label, const char* fmt, ...) const IM_FMTARGS(3);
   void LabelTextV(const char* label, const char* fmt, va_list args) const
@@ -71,6 +80,7 @@ class DataSource {
   bool m_digital = false;
   double m_value = 0;
   int64_t m_valueTime = 0;
+  uint64_t m_epoch = 0;
 };
 
 }  // namespace glass
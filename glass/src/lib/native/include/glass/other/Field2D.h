@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <stdint.h>
+
 #include <span>
 #include <string_view>
 
@@ -23,6 +25,14 @@ class FieldObjectModel : public Model {
   virtual const char* GetName() const = 0;
 
   virtual std::span<const frc::Pose2d> GetPoses() = 0;
+
+  /**
+   * Gets the pose change epoch; incremented whenever the pose array changes.
+   * Views use this to skip re-deriving display geometry from an unchanged
+   * pose array.
+   */
+  virtual uint64_t GetPosesEpoch() = 0;
+
   virtual void SetPoses(std::span<const frc::Pose2d> poses) = 0;
   virtual void SetPose(size_t i, frc::Pose2d pose) = 0;
   virtual void SetPosition(size_t i, frc::Translation2d pos) = 0;
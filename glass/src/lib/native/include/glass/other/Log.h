@@ -4,9 +4,9 @@
 
 #pragma once
 
+#include <deque>
 #include <string>
 #include <string_view>
-#include <vector>
 
 #include "glass/View.h"
 
@@ -20,12 +20,20 @@ class LogData {
 
   void Clear();
   void Append(std::string_view msg);
-  const std::string& GetBuffer();
+
+  /**
+   * Gets the entire log contents as a single string (e.g. for clipboard
+   * copy).  The log is stored line-by-line, so this concatenates.
+   */
+  std::string GetBuffer() const;
 
  private:
   size_t m_maxLines;
-  std::string m_buf;
-  std::vector<size_t> m_lineOffsets{0};
+  // one string per line; a deque avoids the large reallocate-and-copy
+  // hitches of a single growing buffer, and lets the oldest lines be
+  // discarded once m_maxLines is reached
+  std::deque<std::string> m_lines;
+  std::string m_partial;  // incomplete last line (no newline yet)
 };
 
 void DisplayLog(LogData* data, bool autoScroll);
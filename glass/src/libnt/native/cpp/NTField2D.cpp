@@ -4,6 +4,8 @@
 
 #include "glass/networktables/NTField2D.h"
 
+#include <stdint.h>
+
 #include <algorithm>
 #include <vector>
 
@@ -33,6 +35,7 @@ class NTField2DModel::ObjectModel : public FieldObjectModel {
   bool IsReadOnly() override { return false; }
 
   std::span<const frc::Pose2d> GetPoses() override { return m_poses; }
+  uint64_t GetPosesEpoch() override { return m_posesEpoch; }
   void SetPoses(std::span<const frc::Pose2d> poses) override;
   void SetPose(size_t i, frc::Pose2d pose) override;
   void SetPosition(size_t i, frc::Translation2d pos) override;
@@ -46,6 +49,7 @@ class NTField2DModel::ObjectModel : public FieldObjectModel {
   nt::DoubleArrayPublisher m_pub;
 
   std::vector<frc::Pose2d> m_poses;
+  uint64_t m_posesEpoch = 0;
 };
 
 void NTField2DModel::ObjectModel::NTUpdate(const nt::Value& value) {
@@ -61,6 +65,7 @@ void NTField2DModel::ObjectModel::NTUpdate(const nt::Value& value) {
           units::meter_t{arr[i * 3 + 0]}, units::meter_t{arr[i * 3 + 1]},
           frc::Rotation2d{units::degree_t{arr[i * 3 + 2]}}};
     }
+    ++m_posesEpoch;
   }
 }
 
@@ -80,12 +85,14 @@ void NTField2DModel::ObjectModel::UpdateNT() {
 
 void NTField2DModel::ObjectModel::SetPoses(std::span<const frc::Pose2d> poses) {
   m_poses.assign(poses.begin(), poses.end());
+  ++m_posesEpoch;
   UpdateNT();
 }
 
 void NTField2DModel::ObjectModel::SetPose(size_t i, frc::Pose2d pose) {
   if (i < m_poses.size()) {
     m_poses[i] = pose;
+    ++m_posesEpoch;
     UpdateNT();
   }
 }
@@ -94,6 +101,7 @@ void NTField2DModel::ObjectModel::SetPosition(size_t i,
                                               frc::Translation2d pos) {
   if (i < m_poses.size()) {
     m_poses[i] = frc::Pose2d{pos, m_poses[i].Rotation()};
+    ++m_posesEpoch;
     UpdateNT();
   }
 }
@@ -101,6 +109,7 @@ void NTField2DModel::ObjectModel::SetPosition(size_t i,
 void NTField2DModel::ObjectModel::SetRotation(size_t i, frc::Rotation2d rot) {
   if (i < m_poses.size()) {
     m_poses[i] = frc::Pose2d{m_poses[i].Translation(), rot};
+    ++m_posesEpoch;
     UpdateNT();
   }
 }
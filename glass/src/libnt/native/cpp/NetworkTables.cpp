@@ -4,6 +4,7 @@
 
 #include "glass/networktables/NetworkTables.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <cstdio>
 #include <cstring>
@@ -26,6 +27,7 @@
 #include <wpi/StringExtras.h>
 #include <wpi/mpack.h>
 #include <wpi/raw_ostream.h>
+#include <wpi/timestamp.h>
 
 #include "glass/Context.h"
 #include "glass/DataSource.h"
@@ -109,11 +111,19 @@ static std::string StringArrayToString(std::span<const std::string> in) {
 NetworkTablesModel::NetworkTablesModel()
     : NetworkTablesModel{nt::NetworkTableInstance::GetDefault()} {}
 
+// how long a value subscription is kept alive after the entry was last
+// displayed; avoids subscription churn while scrolling
+static constexpr uint64_t kValueSubscriptionLinger = 1'000'000;  // us
+
 NetworkTablesModel::NetworkTablesModel(nt::NetworkTableInstance inst)
     : m_inst{inst}, m_poller{inst} {
-  m_poller.AddListener({{"", "$"}}, nt::EventFlags::kTopic |
-                                        nt::EventFlags::kValueAll |
-                                        nt::EventFlags::kImmediate);
+  // track topic metadata for everything, but only subscribe to values of
+  // meta topics here; normal topic values are subscribed on demand as the
+  // display code requests them (see RequestValue)
+  m_poller.AddListener({{""}},
+                       nt::EventFlags::kTopic | nt::EventFlags::kImmediate);
+  m_poller.AddListener({{"$"}},
+                       nt::EventFlags::kValueAll | nt::EventFlags::kImmediate);
 }
 
 NetworkTablesModel::Entry::~Entry() {
@@ -420,33 +430,52 @@ void NetworkTablesModel::ValueSource::UpdateFromValue(
 }
 
 void NetworkTablesModel::Update() {
-  bool updateTree = false;
   for (auto&& event : m_poller.ReadQueue()) {
     if (auto info = event.GetTopicInfo()) {
       auto& entry = m_entries[info->topic];
+      bool isNew = false;
       if (event.flags & nt::EventFlags::kPublish) {
         if (!entry) {
           entry = std::make_unique<Entry>();
-          m_sortedEntries.emplace_back(entry.get());
-          updateTree = true;
+          isNew = true;
         }
       }
       if (event.flags & nt::EventFlags::kUnpublish) {
-        auto it = std::find(m_sortedEntries.begin(), m_sortedEntries.end(),
-                            entry.get());
-        // will be removed completely below
-        if (it != m_sortedEntries.end()) {
-          *it = nullptr;
+        if (entry) {
+          if (entry->valueListener != 0) {
+            m_poller.RemoveListener(entry->valueListener);
+          }
+          RemoveTreeEntry(entry.get());
+          auto it = std::find(m_sortedEntries.begin(), m_sortedEntries.end(),
+                              entry.get());
+          if (it != m_sortedEntries.end()) {
+            m_sortedEntries.erase(it);
+          }
         }
         m_entries.erase(info->topic);
-        updateTree = true;
         continue;
       }
-      if (event.flags & nt::EventFlags::kProperties) {
-        updateTree = true;
-      }
       if (entry) {
+        // a properties change can move the entry between category trees, so
+        // pull it out before the update and reinsert it after
+        bool reinsert =
+            !isNew && (event.flags & nt::EventFlags::kProperties) != 0;
+        if (reinsert) {
+          RemoveTreeEntry(entry.get());
+        }
         entry->UpdateTopic(std::move(event));
+        if (isNew) {
+          m_sortedEntries.insert(
+              std::upper_bound(m_sortedEntries.begin(), m_sortedEntries.end(),
+                               entry.get(),
+                               [](const auto& a, const auto& b) {
+                                 return a->info.name < b->info.name;
+                               }),
+              entry.get());
+        }
+        if (isNew || reinsert) {
+          InsertTreeEntry(entry.get());
+        }
       }
     } else if (auto valueData = event.GetValueEventData()) {
       auto& entry = m_entries[valueData->topic];
@@ -478,77 +507,120 @@ void NetworkTablesModel::Update() {
     }
   }
 
-  // shortcut common case (updates)
-  if (!updateTree) {
-    return;
+  // drop value subscriptions for entries that haven't been displayed
+  // recently; entries with a data source stay subscribed, as plots and
+  // other widgets may be connected to them
+  uint64_t now = wpi::Now();
+  for (auto&& entry : m_sortedEntries) {
+    if (entry->valueListener != 0 && !entry->source &&
+        (now - entry->lastRequestTime) > kValueSubscriptionLinger) {
+      m_poller.RemoveListener(entry->valueListener);
+      entry->valueListener = 0;
+    }
   }
+}
 
-  // remove deleted entries
-  m_sortedEntries.erase(
-      std::remove(m_sortedEntries.begin(), m_sortedEntries.end(), nullptr),
-      m_sortedEntries.end());
+static void InsertTreeEntryImpl(std::vector<NetworkTablesModel::TreeNode>* tree,
+                                NetworkTablesModel::Entry* entry,
+                                std::span<const std::string_view> parts) {
+  // get to leaf, inserting missing nodes in sorted position
+  auto nodes = tree;
+  for (auto part : wpi::drop_back(parts)) {
+    auto it =
+        std::find_if(nodes->begin(), nodes->end(),
+                     [&](const auto& node) { return node.name == part; });
+    if (it == nodes->end()) {
+      it = nodes->emplace(
+          std::upper_bound(
+              nodes->begin(), nodes->end(), part,
+              [](auto&& name, const auto& node) { return name < node.name; }),
+          part);
+    }
+    if (it->path.empty()) {
+      // path is from the beginning of the string to the end of the current
+      // part; this works because part is a reference to the internals of
+      // entry->info.name.  An existing node may also need this filled in if
+      // it was first created as a leaf and is only now gaining children.
+      it->path.assign(entry->info.name.data(),
+                      part.data() + part.size() - entry->info.name.data());
+    }
+    nodes = &it->children;
+  }
 
-  RebuildTree();
+  auto it = std::find_if(nodes->begin(), nodes->end(), [&](const auto& node) {
+    return node.name == parts.back();
+  });
+  if (it == nodes->end()) {
+    it = nodes->emplace(
+        std::upper_bound(
+            nodes->begin(), nodes->end(), parts.back(),
+            [](auto&& name, const auto& node) { return name < node.name; }),
+        parts.back());
+    // no need to set path, as it's identical to entry->name
+  }
+  it->entry = entry;
 }
 
-void NetworkTablesModel::RebuildTree() {
-  // sort by name
-  std::sort(
-      m_sortedEntries.begin(), m_sortedEntries.end(),
-      [](const auto& a, const auto& b) { return a->info.name < b->info.name; });
-
-  RebuildTreeImpl(&m_root, ShowAll);
-  RebuildTreeImpl(&m_persistentRoot, ShowPersistent);
-  RebuildTreeImpl(&m_retainedRoot, ShowRetained);
-  RebuildTreeImpl(&m_transitoryRoot, ShowTransitory);
+static bool RemoveTreeEntryImpl(std::vector<NetworkTablesModel::TreeNode>& tree,
+                                NetworkTablesModel::Entry* entry,
+                                std::span<const std::string_view> parts) {
+  auto it = std::find_if(tree.begin(), tree.end(), [&](const auto& node) {
+    return node.name == parts.front();
+  });
+  if (it == tree.end()) {
+    return false;
+  }
+  if (parts.size() == 1) {
+    if (it->entry != entry) {
+      return false;
+    }
+    it->entry = nullptr;
+  } else if (!RemoveTreeEntryImpl(it->children, entry, parts.subspan(1))) {
+    return false;
+  }
+  // prune nodes left with neither a value nor children
+  if (!it->entry && it->children.empty()) {
+    tree.erase(it);
+  }
+  return true;
 }
 
-void NetworkTablesModel::RebuildTreeImpl(std::vector<TreeNode>* tree,
-                                         int category) {
-  tree->clear();
+void NetworkTablesModel::InsertTreeEntry(Entry* entry) {
   wpi::SmallVector<std::string_view, 16> parts;
-  for (auto& entry : m_sortedEntries) {
-    if (!IsVisible(static_cast<ShowCategory>(category), entry->persistent,
-                   entry->retained)) {
-      continue;
-    }
-    parts.clear();
-    wpi::split(entry->info.name, parts, '/', -1, false);
+  wpi::split(entry->info.name, parts, '/', -1, false);
 
-    // ignore a raw "/" key
-    if (parts.empty()) {
-      continue;
-    }
+  // ignore a raw "/" key
+  if (parts.empty()) {
+    return;
+  }
 
-    // get to leaf
-    auto nodes = tree;
-    for (auto part : wpi::drop_back(std::span{parts.begin(), parts.end()})) {
-      auto it =
-          std::find_if(nodes->begin(), nodes->end(),
-                       [&](const auto& node) { return node.name == part; });
-      if (it == nodes->end()) {
-        nodes->emplace_back(part);
-        // path is from the beginning of the string to the end of the current
-        // part; this works because part is a reference to the internals of
-        // entry->info.name
-        nodes->back().path.assign(
-            entry->info.name.data(),
-            part.data() + part.size() - entry->info.name.data());
-        it = nodes->end() - 1;
-      }
-      nodes = &it->children;
-    }
+  std::span<const std::string_view> partsSpan{parts.begin(), parts.end()};
+  InsertTreeEntryImpl(&m_root, entry, partsSpan);
+  if (IsVisible(ShowPersistent, entry->persistent, entry->retained)) {
+    InsertTreeEntryImpl(&m_persistentRoot, entry, partsSpan);
+  }
+  if (IsVisible(ShowRetained, entry->persistent, entry->retained)) {
+    InsertTreeEntryImpl(&m_retainedRoot, entry, partsSpan);
+  }
+  if (IsVisible(ShowTransitory, entry->persistent, entry->retained)) {
+    InsertTreeEntryImpl(&m_transitoryRoot, entry, partsSpan);
+  }
+}
 
-    auto it = std::find_if(nodes->begin(), nodes->end(), [&](const auto& node) {
-      return node.name == parts.back();
-    });
-    if (it == nodes->end()) {
-      nodes->emplace_back(parts.back());
-      // no need to set path, as it's identical to entry->name
-      it = nodes->end() - 1;
-    }
-    it->entry = entry;
+void NetworkTablesModel::RemoveTreeEntry(Entry* entry) {
+  wpi::SmallVector<std::string_view, 16> parts;
+  wpi::split(entry->info.name, parts, '/', -1, false);
+  if (parts.empty()) {
+    return;
   }
+
+  // removal from a tree the entry isn't in is a no-op, so just try all of
+  // them rather than guessing which categories the entry was visible in
+  std::span<const std::string_view> partsSpan{parts.begin(), parts.end()};
+  RemoveTreeEntryImpl(m_root, entry, partsSpan);
+  RemoveTreeEntryImpl(m_persistentRoot, entry, partsSpan);
+  RemoveTreeEntryImpl(m_retainedRoot, entry, partsSpan);
+  RemoveTreeEntryImpl(m_transitoryRoot, entry, partsSpan);
 }
 
 bool NetworkTablesModel::Exists() {
@@ -571,12 +643,28 @@ NetworkTablesModel::Entry* NetworkTablesModel::AddEntry(NT_Topic topic) {
     entry = std::make_unique<Entry>();
     entry->info = nt::GetTopicInfo(topic);
     entry->properties = entry->info.GetProperties();
-    m_sortedEntries.emplace_back(entry.get());
+    m_sortedEntries.insert(
+        std::upper_bound(m_sortedEntries.begin(), m_sortedEntries.end(),
+                         entry.get(),
+                         [](const auto& a, const auto& b) {
+                           return a->info.name < b->info.name;
+                         }),
+        entry.get());
+    InsertTreeEntry(entry.get());
   }
-  RebuildTree();
   return entry.get();
 }
 
+void NetworkTablesModel::RequestValue(Entry* entry) {
+  entry->lastRequestTime = wpi::Now();
+  if (entry->valueListener == 0 && !wpi::starts_with(entry->info.name, '$')) {
+    // meta topic values are already subscribed by the constructor
+    entry->valueListener = m_poller.AddListener(
+        {{entry->info.name}},
+        nt::EventFlags::kValueAll | nt::EventFlags::kImmediate);
+  }
+}
+
 void NetworkTablesModel::Client::UpdatePublishers(
     std::span<const uint8_t> data) {
   mpack_reader_t r;
@@ -910,6 +998,19 @@ static bool StringToStringArray(std::string_view in,
   return true;
 }
 
+// Returns a "%.<precision>f" format string for the given precision without
+// allocating; the precision comes from the flags and is the same for every
+// entry in a frame, so cache the last one built.
+static const char* GetPrecisionFormat(unsigned char precision) {
+  static char format[8] = "%.6f";
+  static unsigned char lastPrecision = 6;
+  if (precision != lastPrecision) {
+    std::snprintf(format, sizeof(format), "%%.%uf", precision);
+    lastPrecision = precision;
+  }
+  return format;
+}
+
 static void EmitEntryValueReadonly(const NetworkTablesModel::ValueSource& entry,
                                    const char* typeStr,
                                    NetworkTablesFlags flags) {
@@ -937,8 +1038,7 @@ static void EmitEntryValueReadonly(const NetworkTablesModel::ValueSource& entry,
 #pragma GCC diagnostic ignored "-Wformat-nonliteral"
 #endif
       ImGui::LabelText(typeStr ? typeStr : "double",
-                       fmt::format("%.{}f", precision).c_str(),
-                       val.GetDouble());
+                       GetPrecisionFormat(precision), val.GetDouble());
 #ifdef __GNUC__
 #pragma GCC diagnostic pop
 #endif
@@ -1044,7 +1144,7 @@ static void EmitEntryValueEditable(NetworkTablesModel::Entry& entry,
 #pragma GCC diagnostic ignored "-Wformat-nonliteral"
 #endif
       if (ImGui::InputDouble(typeStr ? typeStr : "double", &v, 0, 0,
-                             fmt::format("%.{}f", precision).c_str(),
+                             GetPrecisionFormat(precision),
                              ImGuiInputTextFlags_EnterReturnsTrue)) {
         if (entry.publisher == 0) {
           entry.publisher = nt::Publish(entry.info.topic, NT_DOUBLE, "double");
@@ -1264,6 +1364,7 @@ static void EmitEntry(NetworkTablesModel* model,
   if (!IsVisible(category, entry.persistent, entry.retained)) {
     return;
   }
+  model->RequestValue(&entry);
 
   bool valueChildrenOpen = false;
   ImGui::TableNextRow();
@@ -1419,12 +1520,26 @@ static void DisplayTable(NetworkTablesModel* model,
       PopID();
     }
   } else {
+    // rows are uniform height in the flat view, so only emit the rows that
+    // are actually on screen
+    std::vector<NetworkTablesModel::Entry*> visible;
+    visible.reserve(model->GetEntries().size());
     for (auto entry : model->GetEntries()) {
-      if ((flags & NetworkTablesFlags_ShowSpecial) != 0 ||
-          !wpi::starts_with(entry->info.name, '$')) {
+      if (((flags & NetworkTablesFlags_ShowSpecial) != 0 ||
+           !wpi::starts_with(entry->info.name, '$')) &&
+          IsVisible(category, entry->persistent, entry->retained)) {
+        visible.emplace_back(entry);
+      }
+    }
+    ImGuiListClipper clipper;
+    clipper.Begin(visible.size());
+    while (clipper.Step()) {
+      for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+        auto entry = visible[row];
         EmitEntry(model, *entry, entry->info.name.c_str(), flags, category);
       }
     }
+    clipper.End();
   }
   ImGui::EndTable();
 }
@@ -103,6 +103,12 @@ class NetworkTablesModel : public Model {
     /** Publisher (created when the value changes). */
     NT_Publisher publisher{0};
 
+    /** Value listener (active only while the entry is being displayed). */
+    NT_Listener valueListener{0};
+
+    /** Time (local us) the entry was last requested by display code. */
+    uint64_t lastRequestTime = 0;
+
     std::vector<TopicPublisher> publishers;
     std::vector<TopicSubscriber> subscribers;
   };
@@ -174,9 +180,17 @@ class NetworkTablesModel : public Model {
   Entry* GetEntry(std::string_view name);
   Entry* AddEntry(NT_Topic topic);
 
+  /**
+   * Requests value updates for an entry.  Display code calls this for each
+   * entry it actually shows; the model only subscribes to value changes for
+   * recently requested entries.  Topic metadata is always tracked, so
+   * collapsed subtrees and off-screen rows generate no value traffic.
+   */
+  void RequestValue(Entry* entry);
+
  private:
-  void RebuildTree();
-  void RebuildTreeImpl(std::vector<TreeNode>* tree, int category);
+  void InsertTreeEntry(Entry* entry);
+  void RemoveTreeEntry(Entry* entry);
   void UpdateClients(std::span<const uint8_t> data);
 
   nt::NetworkTableInstance m_inst;
@@ -5,6 +5,7 @@
 #include "hal/AddressableLED.h"
 
 #include <cstring>
+#include <memory>
 
 #include <fmt/format.h>
 
@@ -27,6 +28,10 @@ struct AddressableLED {
   void* ledBuffer;
   size_t ledBufferSize;
   int32_t stringLength = 1;
+  // copy of the last frame written to the HMB; lets full-buffer writes skip
+  // the copy of pixels that didn't change since the previous frame
+  std::unique_ptr<HAL_AddressableLEDData[]> shadowBuffer;
+  bool shadowValid = false;
 };
 }  // namespace
 
@@ -174,6 +179,8 @@ void HAL_SetAddressableLEDLength(HAL_AddressableLEDHandle handle,
   led->led->writeStringLength(length, status);
 
   led->stringLength = length;
+  led->shadowBuffer = std::make_unique<HAL_AddressableLEDData[]>(length);
+  led->shadowValid = false;
 }
 
 static_assert(sizeof(HAL_AddressableLEDData) == sizeof(uint32_t),
@@ -198,7 +205,68 @@ void HAL_WriteAddressableLEDData(HAL_AddressableLEDHandle handle,
     return;
   }
 
-  std::memcpy(led->ledBuffer, data, length * sizeof(HAL_AddressableLEDData));
+  if (!led->shadowBuffer || !led->shadowValid) {
+    // first frame at this length; the HMB contents are unknown, copy it all
+    std::memcpy(led->ledBuffer, data, length * sizeof(HAL_AddressableLEDData));
+    if (led->shadowBuffer) {
+      std::memcpy(led->shadowBuffer.get(), data,
+                  length * sizeof(HAL_AddressableLEDData));
+      led->shadowValid = true;
+    }
+  } else {
+    // copy only the span that changed since the last frame; the compare reads
+    // cached shadow memory instead of writing the uncached HMB mapping
+    const uint32_t* newData = reinterpret_cast<const uint32_t*>(data);
+    uint32_t* shadow = reinterpret_cast<uint32_t*>(led->shadowBuffer.get());
+    int32_t first = 0;
+    while (first < length && newData[first] == shadow[first]) {
+      ++first;
+    }
+    if (first != length) {
+      int32_t last = length - 1;
+      while (last > first && newData[last] == shadow[last]) {
+        --last;
+      }
+      int32_t count = last - first + 1;
+      std::memcpy(static_cast<HAL_AddressableLEDData*>(led->ledBuffer) + first,
+                  data + first, count * sizeof(HAL_AddressableLEDData));
+      std::memcpy(led->shadowBuffer.get() + first, data + first,
+                  count * sizeof(HAL_AddressableLEDData));
+    }
+  }
+
+  asm("dmb");
+
+  led->led->strobeLoad(status);
+}
+
+void HAL_WriteAddressableLEDDataRange(HAL_AddressableLEDHandle handle,
+                                      const struct HAL_AddressableLEDData* data,
+                                      int32_t start, int32_t length,
+                                      int32_t* status) {
+  auto led = addressableLEDHandles->Get(handle);
+  if (!led) {
+    *status = HAL_HANDLE_ERROR;
+    return;
+  }
+
+  if (start < 0 || length < 0 || start + length > led->stringLength) {
+    *status = PARAMETER_OUT_OF_RANGE;
+    hal::SetLastError(
+        status,
+        fmt::format(
+            "Data range must be within the string length {}. [{}, {}) was "
+            "requested",
+            led->stringLength, start, start + length));
+    return;
+  }
+
+  std::memcpy(static_cast<HAL_AddressableLEDData*>(led->ledBuffer) + start,
+              data, length * sizeof(HAL_AddressableLEDData));
+  if (led->shadowBuffer) {
+    std::memcpy(led->shadowBuffer.get() + start, data,
+                length * sizeof(HAL_AddressableLEDData));
+  }
 
   asm("dmb");
 
@@ -12,6 +12,7 @@
 #include "hal/CAN.h"
 #include "hal/Errors.h"
 #include "hal/handles/UnlimitedHandleResource.h"
+#include "hal/Instrumentation.h"
 
 using namespace hal;
 
@@ -98,6 +99,7 @@ void HAL_CleanCAN(HAL_CANHandle handle) {
 
 void HAL_WriteCANPacket(HAL_CANHandle handle, const uint8_t* data,
                         int32_t length, int32_t apiId, int32_t* status) {
+  hal::InstrumentationScope instrumentation{HAL_Instrumentation_kCANSend};
   auto can = canHandles->Get(handle);
   if (!can) {
     *status = HAL_HANDLE_ERROR;
@@ -117,6 +119,7 @@ void HAL_WriteCANPacket(HAL_CANHandle handle, const uint8_t* data,
 void HAL_WriteCANPacketRepeating(HAL_CANHandle handle, const uint8_t* data,
                                  int32_t length, int32_t apiId,
                                  int32_t repeatMs, int32_t* status) {
+  hal::InstrumentationScope instrumentation{HAL_Instrumentation_kCANSend};
   auto can = canHandles->Get(handle);
   if (!can) {
     *status = HAL_HANDLE_ERROR;
@@ -176,6 +179,7 @@ void HAL_StopCANPacketRepeating(HAL_CANHandle handle, int32_t apiId,
 void HAL_ReadCANPacketNew(HAL_CANHandle handle, int32_t apiId, uint8_t* data,
                           int32_t* length, uint64_t* receivedTimestamp,
                           int32_t* status) {
+  hal::InstrumentationScope instrumentation{HAL_Instrumentation_kCANReceive};
   auto can = canHandles->Get(handle);
   if (!can) {
     *status = HAL_HANDLE_ERROR;
@@ -202,6 +206,7 @@ void HAL_ReadCANPacketNew(HAL_CANHandle handle, int32_t apiId, uint8_t* data,
 void HAL_ReadCANPacketLatest(HAL_CANHandle handle, int32_t apiId, uint8_t* data,
                              int32_t* length, uint64_t* receivedTimestamp,
                              int32_t* status) {
+  hal::InstrumentationScope instrumentation{HAL_Instrumentation_kCANReceive};
   auto can = canHandles->Get(handle);
   if (!can) {
     *status = HAL_HANDLE_ERROR;
@@ -239,6 +244,7 @@ void HAL_ReadCANPacketTimeout(HAL_CANHandle handle, int32_t apiId,
                               uint8_t* data, int32_t* length,
                               uint64_t* receivedTimestamp, int32_t timeoutMs,
                               int32_t* status) {
+  hal::InstrumentationScope instrumentation{HAL_Instrumentation_kCANReceive};
   auto can = canHandles->Get(handle);
   if (!can) {
     *status = HAL_HANDLE_ERROR;
@@ -278,4 +284,63 @@ void HAL_ReadCANPacketTimeout(HAL_CANHandle handle, int32_t apiId,
     }
   }
 }
+
+void HAL_WriteCANPacketBatch(HAL_CANHandle handle,
+                             const struct HAL_CANPacket* packets,
+                             int32_t count, int32_t* status) {
+  hal::InstrumentationScope instrumentation{HAL_Instrumentation_kCANSend};
+  auto can = canHandles->Get(handle);
+  if (!can) {
+    *status = HAL_HANDLE_ERROR;
+    return;
+  }
+  // single lock acquisition for the entire batch
+  std::scoped_lock lock(can->mapMutex);
+  for (int32_t i = 0; i < count; ++i) {
+    auto& packet = packets[i];
+    auto id = CreateCANId(can.get(), packet.apiId);
+    int32_t period = packet.repeatMs > 0 ? packet.repeatMs
+                                         : HAL_CAN_SEND_PERIOD_NO_REPEAT;
+    HAL_CAN_SendMessage(id, packet.data, packet.length, period, status);
+    if (*status != 0) {
+      return;
+    }
+    can->periodicSends[packet.apiId] = packet.repeatMs > 0 ? packet.repeatMs
+                                                           : -1;
+  }
+}
+
+void HAL_ReadCANPacketBatch(HAL_CANHandle handle,
+                            struct HAL_CANPacket* packets,
+                            uint64_t* receivedTimestamps, int32_t* statuses,
+                            int32_t count) {
+  hal::InstrumentationScope instrumentation{HAL_Instrumentation_kCANReceive};
+  auto can = canHandles->Get(handle);
+  if (!can) {
+    for (int32_t i = 0; i < count; ++i) {
+      statuses[i] = HAL_HANDLE_ERROR;
+    }
+    return;
+  }
+  // single lock acquisition for the entire batch
+  std::scoped_lock lock(can->mapMutex);
+  for (int32_t i = 0; i < count; ++i) {
+    auto& packet = packets[i];
+    uint32_t messageId = CreateCANId(can.get(), packet.apiId);
+    uint8_t dataSize = 0;
+    uint32_t ts = 0;
+    HAL_CAN_ReceiveMessage(&messageId, 0x1FFFFFFF, packet.data, &dataSize, &ts,
+                           &statuses[i]);
+
+    if (statuses[i] == 0) {
+      auto& msg = can->receives[messageId];
+      msg.length = dataSize;
+      msg.lastTimeStamp = ts;
+      // The NetComm call placed in the packet data, copy into the msg
+      std::memcpy(msg.data, packet.data, dataSize);
+      packet.length = dataSize;
+      receivedTimestamps[i] = ts;
+    }
+  }
+}
 }  // extern "C"
@@ -3,13 +3,17 @@
 // the WPILib BSD license file in the root directory of this project.
 
 #include "hal/DMA.h"
+#include "hal/Instrumentation.h"
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstring>
 #include <memory>
 #include <type_traits>
 
+#include <wpi/SmallVector.h>
+
 #include "AnalogInternal.h"
 #include "ConstantsInternal.h"
 #include "DigitalInternal.h"
@@ -718,6 +722,7 @@ enum HAL_DMAReadStatus HAL_ReadDMADirect(void* dmaPointer,
                                          double timeoutSeconds,
                                          int32_t* remainingOut,
                                          int32_t* status) {
+  hal::InstrumentationScope instrumentation{HAL_Instrumentation_kDMARead};
   DMA* dma = static_cast<DMA*>(dmaPointer);
   *remainingOut = 0;
   size_t remainingBytes = 0;
@@ -767,6 +772,80 @@ enum HAL_DMAReadStatus HAL_ReadDMA(HAL_DMAHandle handle,
                            status);
 }
 
+int32_t HAL_ReadDMABatchDirect(void* dmaPointer, HAL_DMASample* dmaSamples,
+                               int32_t maxSamples, double timeoutSeconds,
+                               int32_t* remainingOut, int32_t* status) {
+  // instrumented via the HAL_ReadDMADirect call below
+  DMA* dma = static_cast<DMA*>(dmaPointer);
+  *remainingOut = 0;
+
+  if (!dma->manager) {
+    *status = HAL_INVALID_DMA_STATE;
+    return 0;
+  }
+
+  if (maxSamples < 1) {
+    return 0;
+  }
+
+  // Block (up to the timeout) for the first sample
+  if (HAL_ReadDMADirect(dmaPointer, &dmaSamples[0], timeoutSeconds,
+                        remainingOut, status) != HAL_DMA_OK) {
+    return 0;
+  }
+
+  // Drain what is already queued with a single FIFO read
+  uint32_t captureSize = dma->captureStore.captureSize;
+  int32_t toRead = (std::min)(*remainingOut, maxSamples - 1);
+  if (toRead <= 0) {
+    return 1;
+  }
+
+  wpi::SmallVector<uint32_t, 256> readBuffer;
+  readBuffer.resize(toRead * captureSize);
+  size_t remainingBytes = 0;
+  dma->manager->read(readBuffer.data(), readBuffer.size(), 0, &remainingBytes,
+                     status);
+  if (*status == NiFpga_Status_FifoTimeout) {
+    // raced with a consumer; the first sample is still valid
+    *status = 0;
+    *remainingOut = 0;
+    return 1;
+  } else if (*status != 0) {
+    return 1;
+  }
+
+  *remainingOut = remainingBytes / captureSize;
+
+  for (int32_t i = 0; i < toRead; ++i) {
+    HAL_DMASample* dmaSample = &dmaSamples[i + 1];
+    const uint32_t* words = &readBuffer[i * captureSize];
+    std::memcpy(dmaSample->readBuffer, words, captureSize * sizeof(uint32_t));
+    dmaSample->timeStamp = HAL_ExpandFPGATime(words[captureSize - 1], status);
+    if (*status != 0) {
+      return i + 1;
+    }
+    dmaSample->triggerChannels = dma->captureStore.triggerChannels;
+    dmaSample->captureSize = captureSize;
+    std::memcpy(dmaSample->channelOffsets, dma->captureStore.channelOffsets,
+                sizeof(dmaSample->channelOffsets));
+  }
+  return toRead + 1;
+}
+
+int32_t HAL_ReadDMABatch(HAL_DMAHandle handle, HAL_DMASample* dmaSamples,
+                         int32_t maxSamples, double timeoutSeconds,
+                         int32_t* remainingOut, int32_t* status) {
+  auto dma = dmaHandles->Get(handle);
+  if (!dma) {
+    *status = HAL_HANDLE_ERROR;
+    return 0;
+  }
+
+  return HAL_ReadDMABatchDirect(dma.get(), dmaSamples, maxSamples,
+                                timeoutSeconds, remainingOut, status);
+}
+
 static uint32_t ReadDMAValue(const HAL_DMASample& dma, int valueType, int index,
                              int32_t* status) {
   auto offset = dma.channelOffsets[valueType];
@@ -16,6 +16,7 @@
 
 #include "DigitalInternal.h"
 #include "HALInitializer.h"
+#include "hal/Instrumentation.h"
 #include "HALInternal.h"
 #include "hal/DIO.h"
 #include "hal/HAL.h"
@@ -98,6 +99,7 @@ void HAL_InitializeI2C(HAL_I2CPort port, int32_t* status) {
 int32_t HAL_TransactionI2C(HAL_I2CPort port, int32_t deviceAddress,
                            const uint8_t* dataToSend, int32_t sendSize,
                            uint8_t* dataReceived, int32_t receiveSize) {
+  hal::InstrumentationScope instrumentation{HAL_Instrumentation_kI2CTransfer};
   if (port < 0 || port > 1) {
     int32_t status = 0;
     hal::SetLastErrorIndexOutOfRange(&status, "Invalid Index for I2C", 0, 1,
@@ -130,6 +132,7 @@ int32_t HAL_TransactionI2C(HAL_I2CPort port, int32_t deviceAddress,
 
 int32_t HAL_WriteI2C(HAL_I2CPort port, int32_t deviceAddress,
                      const uint8_t* dataToSend, int32_t sendSize) {
+  hal::InstrumentationScope instrumentation{HAL_Instrumentation_kI2CTransfer};
   if (port < 0 || port > 1) {
     int32_t status = 0;
     hal::SetLastErrorIndexOutOfRange(&status, "Invalid Index for I2C", 0, 1,
@@ -158,6 +161,7 @@ int32_t HAL_WriteI2C(HAL_I2CPort port, int32_t deviceAddress,
 
 int32_t HAL_ReadI2C(HAL_I2CPort port, int32_t deviceAddress, uint8_t* buffer,
                     int32_t count) {
+  hal::InstrumentationScope instrumentation{HAL_Instrumentation_kI2CTransfer};
   if (port < 0 || port > 1) {
     int32_t status = 0;
     hal::SetLastErrorIndexOutOfRange(&status, "Invalid Index for I2C", 0, 1,
@@ -8,8 +8,10 @@
 #include <cstdlib>  // For std::atexit()
 #include <memory>
 #include <thread>
+#include <utility>
 
 #include <fmt/core.h>
+#include <wpi/SmallVector.h>
 #include <wpi/condition_variable.h>
 #include <wpi/mutex.h>
 
@@ -39,6 +41,8 @@ struct Notifier {
   uint64_t triggerTime = UINT64_MAX;
   uint64_t triggeredTime = UINT64_MAX;
   bool active = true;
+  HAL_NotifierCallbackFunction callback = nullptr;
+  void* callbackParam = nullptr;
   wpi::mutex mutex;
   wpi::condition_variable cond;
 };
@@ -71,38 +75,54 @@ class NotifierHandleContainer
 static NotifierHandleContainer* notifierHandles;
 
 static void alarmCallback() {
-  std::scoped_lock lock(notifierMutex);
-  int32_t status = 0;
+  // callbacks ready to be dispatched inline on this thread
+  wpi::SmallVector<std::pair<HAL_NotifierCallbackFunction, void*>, 4> callbacks;
   uint64_t currentTime = 0;
 
-  // the hardware disables itself after each alarm
-  closestTrigger = UINT64_MAX;
+  {
+    std::scoped_lock lock(notifierMutex);
+    int32_t status = 0;
 
-  // process all notifiers
-  notifierHandles->ForEach([&](HAL_NotifierHandle handle, Notifier* notifier) {
-    if (notifier->triggerTime == UINT64_MAX) {
-      return;
-    }
-    if (currentTime == 0) {
-      currentTime = HAL_GetFPGATime(&status);
-    }
-    std::unique_lock lock(notifier->mutex);
-    if (notifier->triggerTime < currentTime) {
-      notifier->triggerTime = UINT64_MAX;
-      notifier->triggeredTime = currentTime;
-      lock.unlock();
-      notifier->cond.notify_all();
-    } else if (notifier->triggerTime < closestTrigger) {
-      closestTrigger = notifier->triggerTime;
+    // the hardware disables itself after each alarm
+    closestTrigger = UINT64_MAX;
+
+    // process all notifiers
+    notifierHandles->ForEach(
+        [&](HAL_NotifierHandle handle, Notifier* notifier) {
+          if (notifier->triggerTime == UINT64_MAX) {
+            return;
+          }
+          if (currentTime == 0) {
+            currentTime = HAL_GetFPGATime(&status);
+          }
+          std::unique_lock lock(notifier->mutex);
+          if (notifier->triggerTime < currentTime) {
+            notifier->triggerTime = UINT64_MAX;
+            notifier->triggeredTime = currentTime;
+            if (notifier->callback) {
+              callbacks.emplace_back(notifier->callback,
+                                     notifier->callbackParam);
+            }
+            lock.unlock();
+            notifier->cond.notify_all();
+          } else if (notifier->triggerTime < closestTrigger) {
+            closestTrigger = notifier->triggerTime;
+          }
+        });
+
+    if (notifierAlarm && closestTrigger != UINT64_MAX) {
+      // Simply truncate the hardware trigger time to 32-bit.
+      notifierAlarm->writeTriggerTime(static_cast<uint32_t>(closestTrigger),
+                                      &status);
+      // Enable the alarm.  The hardware disables itself after each alarm.
+      notifierAlarm->writeEnable(true, &status);
     }
-  });
+  }
 
-  if (notifierAlarm && closestTrigger != UINT64_MAX) {
-    // Simply truncate the hardware trigger time to 32-bit.
-    notifierAlarm->writeTriggerTime(static_cast<uint32_t>(closestTrigger),
-                                    &status);
-    // Enable the alarm.  The hardware disables itself after each alarm.
-    notifierAlarm->writeEnable(true, &status);
+  // run the callbacks with the table lock released so they can rearm via
+  // HAL_UpdateNotifierAlarm
+  for (auto&& [callback, param] : callbacks) {
+    callback(currentTime, param);
   }
 }
 
@@ -200,6 +220,18 @@ HAL_Bool HAL_SetNotifierThreadPriority(HAL_Bool realTime, int32_t priority,
 void HAL_SetNotifierName(HAL_NotifierHandle notifierHandle, const char* name,
                          int32_t* status) {}
 
+void HAL_SetNotifierCallback(HAL_NotifierHandle notifierHandle,
+                             HAL_NotifierCallbackFunction callback, void* param,
+                             int32_t* status) {
+  auto notifier = notifierHandles->Get(notifierHandle);
+  if (!notifier) {
+    return;
+  }
+  std::scoped_lock lock(notifier->mutex);
+  notifier->callback = callback;
+  notifier->callbackParam = param;
+}
+
 void HAL_StopNotifier(HAL_NotifierHandle notifierHandle, int32_t* status) {
   auto notifier = notifierHandles->Get(notifierHandle);
   if (!notifier) {
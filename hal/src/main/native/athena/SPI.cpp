@@ -23,6 +23,7 @@
 #include "hal/DIO.h"
 #include "hal/HAL.h"
 #include "hal/handles/HandlesInternal.h"
+#include "hal/Instrumentation.h"
 
 using namespace hal;
 
@@ -260,6 +261,7 @@ void HAL_InitializeSPI(HAL_SPIPort port, int32_t* status) {
 
 int32_t HAL_TransactionSPI(HAL_SPIPort port, const uint8_t* dataToSend,
                            uint8_t* dataReceived, int32_t size) {
+  hal::InstrumentationScope instrumentation{HAL_Instrumentation_kSPITransfer};
   if (port < 0 || port >= kSpiMaxHandles) {
     return -1;
   }
@@ -278,8 +280,40 @@ int32_t HAL_TransactionSPI(HAL_SPIPort port, const uint8_t* dataToSend,
   return ioctl(HAL_GetSPIHandle(port), SPI_IOC_MESSAGE(1), &xfer);
 }
 
+int32_t HAL_ChainedTransactionSPI(HAL_SPIPort port,
+                                  const struct HAL_SPISegment* segments,
+                                  int32_t count) {
+  hal::InstrumentationScope instrumentation{HAL_Instrumentation_kSPITransfer};
+  constexpr int32_t kMaxSegments = 8;
+
+  if (port < 0 || port >= kSpiMaxHandles) {
+    return -1;
+  }
+
+  if (count < 1 || count > kMaxSegments) {
+    return -1;
+  }
+
+  if (SPIInUseByAuto(port)) {
+    return -1;
+  }
+
+  struct spi_ioc_transfer xfers[kMaxSegments];
+  std::memset(xfers, 0, sizeof(xfers));
+  for (int32_t i = 0; i < count; i++) {
+    xfers[i].tx_buf = (__u64)segments[i].dataToSend;
+    xfers[i].rx_buf = (__u64)segments[i].dataReceived;
+    xfers[i].len = segments[i].size;
+    xfers[i].cs_change = segments[i].csChange;
+  }
+
+  std::scoped_lock lock(spiApiMutexes[port]);
+  return ioctl(HAL_GetSPIHandle(port), SPI_IOC_MESSAGE(count), xfers);
+}
+
 int32_t HAL_WriteSPI(HAL_SPIPort port, const uint8_t* dataToSend,
                      int32_t sendSize) {
+  hal::InstrumentationScope instrumentation{HAL_Instrumentation_kSPITransfer};
   if (port < 0 || port >= kSpiMaxHandles) {
     return -1;
   }
@@ -298,6 +332,7 @@ int32_t HAL_WriteSPI(HAL_SPIPort port, const uint8_t* dataToSend,
 }
 
 int32_t HAL_ReadSPI(HAL_SPIPort port, uint8_t* buffer, int32_t count) {
+  hal::InstrumentationScope instrumentation{HAL_Instrumentation_kSPITransfer};
   if (port < 0 || port >= kSpiMaxHandles) {
     return -1;
   }
@@ -0,0 +1,56 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "hal/Instrumentation.h"
+
+#include <atomic>
+
+static std::atomic<bool> instrumentationEnabled{false};
+static std::atomic<uint64_t>
+    instrumentationCounts[HAL_Instrumentation_kNumCategories];
+static std::atomic<uint64_t>
+    instrumentationTimes[HAL_Instrumentation_kNumCategories];
+
+extern "C" {
+
+void HAL_SetInstrumentationEnabled(HAL_Bool enabled) {
+  instrumentationEnabled.store(enabled != 0, std::memory_order_relaxed);
+}
+
+HAL_Bool HAL_GetInstrumentationEnabled(void) {
+  return instrumentationEnabled.load(std::memory_order_relaxed);
+}
+
+void HAL_AddInstrumentationSample(HAL_InstrumentationCategory category,
+                                  uint64_t elapsedMicroseconds) {
+  if (category < 0 || category >= HAL_Instrumentation_kNumCategories) {
+    return;
+  }
+  instrumentationCounts[category].fetch_add(1, std::memory_order_relaxed);
+  instrumentationTimes[category].fetch_add(elapsedMicroseconds,
+                                           std::memory_order_relaxed);
+}
+
+uint64_t HAL_GetInstrumentationCount(HAL_InstrumentationCategory category) {
+  if (category < 0 || category >= HAL_Instrumentation_kNumCategories) {
+    return 0;
+  }
+  return instrumentationCounts[category].load(std::memory_order_relaxed);
+}
+
+uint64_t HAL_GetInstrumentationTotalTime(HAL_InstrumentationCategory category) {
+  if (category < 0 || category >= HAL_Instrumentation_kNumCategories) {
+    return 0;
+  }
+  return instrumentationTimes[category].load(std::memory_order_relaxed);
+}
+
+void HAL_ResetInstrumentation(void) {
+  for (int32_t i = 0; i < HAL_Instrumentation_kNumCategories; i++) {
+    instrumentationCounts[i].store(0, std::memory_order_relaxed);
+    instrumentationTimes[i].store(0, std::memory_order_relaxed);
+  }
+}
+
+}  // extern "C"
@@ -11,7 +11,7 @@
 
 namespace hal {
 static wpi::SmallVector<HandleBase*, 32>* globalHandles = nullptr;
-static wpi::mutex globalHandleMutex;
+static wpi::adaptive_mutex globalHandleMutex;
 HandleBase::HandleBase() {
   static wpi::SmallVector<HandleBase*, 32> gH;
   std::scoped_lock lock(globalHandleMutex);
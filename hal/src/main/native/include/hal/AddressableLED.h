@@ -35,6 +35,14 @@ void HAL_WriteAddressableLEDData(HAL_AddressableLEDHandle handle,
                                  const struct HAL_AddressableLEDData* data,
                                  int32_t length, int32_t* status);
 
+/* Writes only the pixels [start, start + length); pixels outside the range
+ * keep their previous values.  Cheaper than HAL_WriteAddressableLEDData when
+ * only a small part of a long strip changes each frame. */
+void HAL_WriteAddressableLEDDataRange(HAL_AddressableLEDHandle handle,
+                                      const struct HAL_AddressableLEDData* data,
+                                      int32_t start, int32_t length,
+                                      int32_t* status);
+
 void HAL_SetAddressableLEDBitTiming(HAL_AddressableLEDHandle handle,
                                     int32_t lowTime0NanoSeconds,
                                     int32_t highTime0NanoSeconds,
@@ -154,6 +154,46 @@ void HAL_ReadCANPacketTimeout(HAL_CANHandle handle, int32_t apiId,
                               uint64_t* receivedTimestamp, int32_t timeoutMs,
                               int32_t* status);
 
+/**
+ * Writes a set of packets to the CAN device with one handle lookup and one
+ * lock acquisition.
+ *
+ * Packets with a nonzero repeatMs are repeated by the hardware at that
+ * period (like HAL_WriteCANPacketRepeating), so fixed-rate frames need not
+ * be resubmitted every loop.  On the first send failure the remaining
+ * packets are not sent.
+ *
+ * @param[in] handle  the CAN handle
+ * @param[in] packets the packets to write
+ * @param[in] count   the number of packets
+ * @param[out] status Error status variable. 0 on success.
+ */
+void HAL_WriteCANPacketBatch(HAL_CANHandle handle,
+                             const struct HAL_CANPacket* packets,
+                             int32_t count, int32_t* status);
+
+/**
+ * Reads new CAN packets for a set of API IDs with one handle lookup and one
+ * lock acquisition.
+ *
+ * Each packet's apiId must be set by the caller; data and length are filled
+ * in.  Like HAL_ReadCANPacketNew, each ID only returns properly once per
+ * packet received; IDs with no new packet report an error in their status
+ * entry without affecting the rest of the batch.
+ *
+ * @param[in] handle              the CAN handle
+ * @param[in,out] packets         the packets to read (apiId in, data out)
+ * @param[out] receivedTimestamps the packet received timestamps (based off
+ *                                of CLOCK_MONOTONIC); count elements
+ * @param[out] statuses           per-packet error status; count elements.
+ *                                0 on success.
+ * @param[in] count               the number of packets
+ */
+void HAL_ReadCANPacketBatch(HAL_CANHandle handle,
+                            struct HAL_CANPacket* packets,
+                            uint64_t* receivedTimestamps, int32_t* statuses,
+                            int32_t count);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -57,4 +57,22 @@ HAL_ENUM(HAL_CANManufacturer) {
   HAL_CAN_Man_kStudica = 12
 };
 // clang-format on
+
+/**
+ * Storage for a batched CAN frame.  Used by HAL_WriteCANPacketBatch() and
+ * HAL_ReadCANPacketBatch().
+ */
+struct HAL_CANPacket {
+  /** The API ID (0-1023). */
+  int32_t apiId;
+  /**
+   * Repeat period in ms; 0 to send once.  Frames with a nonzero period are
+   * repeated by the hardware without further calls.  Only used for writes.
+   */
+  int32_t repeatMs;
+  /** The packet data (0-8 bytes). */
+  uint8_t data[8];
+  /** The length of data (0-8). */
+  uint8_t length;
+};
 /** @} */
@@ -115,6 +115,23 @@ void HAL_SetDigitalPWMOutputChannel(HAL_DigitalPWMHandle pwmGenerator,
 void HAL_SetDIO(HAL_DigitalHandle dioPortHandle, HAL_Bool value,
                 int32_t* status);
 
+/**
+ * Writes digital values to multiple DIO channels in one FPGA transaction.
+ *
+ * All channels are applied to the output register with a single
+ * read-modify-write, so fanning out to several actuators costs one hardware
+ * round trip instead of one per channel.  On any invalid handle or input
+ * channel, no outputs are changed.
+ *
+ * @param[in] dioPortHandles the digital port handles
+ * @param[in] values         the states to set the digital channels (if they
+ *                           are configured as outputs)
+ * @param[in] count          the number of channels
+ * @param[out] status        Error status variable. 0 on success.
+ */
+void HAL_SetDIOBatch(const HAL_DigitalHandle* dioPortHandles,
+                     const HAL_Bool* values, int32_t count, int32_t* status);
+
 /**
  * Sets the direction of a DIO channel.
  *
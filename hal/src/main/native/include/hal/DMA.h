@@ -317,6 +317,44 @@ enum HAL_DMAReadStatus HAL_ReadDMA(HAL_DMAHandle handle,
                                    double timeoutSeconds, int32_t* remainingOut,
                                    int32_t* status);
 
+/**
+ * Reads a batch of DMA samples using a direct DMA pointer.
+ *
+ * See HAL_ReadDMABatch for full documentation.
+ *
+ * @param[in] dmaPointer     direct DMA pointer
+ * @param[in] dmaSamples     array to place samples into
+ * @param[in] maxSamples     the capacity of dmaSamples
+ * @param[in] timeoutSeconds the time to wait for the first sample to be
+ *                           queued before timing out
+ * @param[in] remainingOut   the number of samples remaining in the queue
+ * @param[out] status        Error status variable. 0 on success.
+ * @return the number of samples read
+ */
+int32_t HAL_ReadDMABatchDirect(void* dmaPointer, HAL_DMASample* dmaSamples,
+                               int32_t maxSamples, double timeoutSeconds,
+                               int32_t* remainingOut, int32_t* status);
+
+/**
+ * Reads a batch of DMA samples from the queue.
+ *
+ * Blocks (up to the timeout) for the first sample, then drains any samples
+ * already queued (up to maxSamples) with a single FPGA FIFO read, so
+ * high-rate capture does not pay a FIFO transaction per sample.
+ *
+ * @param[in] handle         the dma handle
+ * @param[in] dmaSamples     array to place samples into
+ * @param[in] maxSamples     the capacity of dmaSamples
+ * @param[in] timeoutSeconds the time to wait for the first sample to be
+ *                           queued before timing out
+ * @param[in] remainingOut   the number of samples remaining in the queue
+ * @param[out] status        Error status variable. 0 on success.
+ * @return the number of samples read; 0 on timeout or error
+ */
+int32_t HAL_ReadDMABatch(HAL_DMAHandle handle, HAL_DMASample* dmaSamples,
+                         int32_t maxSamples, double timeoutSeconds,
+                         int32_t* remainingOut, int32_t* status);
+
 // The following are helper functions for reading data from samples
 
 /**
@@ -0,0 +1,128 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <stdint.h>
+
+#include "hal/Types.h"
+
+/**
+ * @defgroup hal_instrumentation Instrumentation Functions
+ * @ingroup hal_capi
+ * Opt-in counters for hardware and driver call rates.  When enabled, each
+ * instrumented HAL call adds to a per-category call count and elapsed-time
+ * sum, so loop-time spikes can be attributed to specific call patterns.
+ * When disabled (the default), instrumented calls only pay a single relaxed
+ * atomic load.
+ * @{
+ */
+
+// clang-format off
+HAL_ENUM(HAL_InstrumentationCategory) {
+  HAL_Instrumentation_kCANSend,
+  HAL_Instrumentation_kCANReceive,
+  HAL_Instrumentation_kSPITransfer,
+  HAL_Instrumentation_kI2CTransfer,
+  HAL_Instrumentation_kDIOAccess,
+  HAL_Instrumentation_kDMARead,
+  HAL_Instrumentation_kNumCategories
+};
+// clang-format on
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Enables or disables instrumentation collection.
+ *
+ * @param[in] enabled true to collect counts and times, false to disable
+ */
+void HAL_SetInstrumentationEnabled(HAL_Bool enabled);
+
+/**
+ * Returns whether instrumentation collection is enabled.
+ *
+ * @return true if enabled
+ */
+HAL_Bool HAL_GetInstrumentationEnabled(void);
+
+/**
+ * Records one instrumented call.  Called by the HAL itself; exposed so
+ * vendor code can participate in the same counters.
+ *
+ * @param[in] category            the call category
+ * @param[in] elapsedMicroseconds time spent in the call
+ */
+void HAL_AddInstrumentationSample(HAL_InstrumentationCategory category,
+                                  uint64_t elapsedMicroseconds);
+
+/**
+ * Gets the number of calls recorded for a category since the last reset.
+ *
+ * @param[in] category the call category
+ * @return the call count
+ */
+uint64_t HAL_GetInstrumentationCount(HAL_InstrumentationCategory category);
+
+/**
+ * Gets the total time in microseconds spent in calls recorded for a
+ * category since the last reset.
+ *
+ * @param[in] category the call category
+ * @return the total time (microseconds)
+ */
+uint64_t HAL_GetInstrumentationTotalTime(HAL_InstrumentationCategory category);
+
+/**
+ * Resets all instrumentation counts and times to zero.
+ */
+void HAL_ResetInstrumentation(void);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#ifdef __cplusplus
+#include <chrono>
+
+namespace hal {
+
+/**
+ * RAII helper for instrumented call sites.  Costs one relaxed atomic load
+ * when instrumentation is disabled; when enabled, records one call and its
+ * elapsed time on destruction.
+ */
+class InstrumentationScope {
+ public:
+  explicit InstrumentationScope(HAL_InstrumentationCategory category)
+      : m_category{category}, m_enabled{HAL_GetInstrumentationEnabled() != 0} {
+    if (m_enabled) {
+      m_start = std::chrono::steady_clock::now();
+    }
+  }
+
+  ~InstrumentationScope() {
+    if (m_enabled) {
+      auto elapsed = std::chrono::steady_clock::now() - m_start;
+      HAL_AddInstrumentationSample(
+          m_category,
+          std::chrono::duration_cast<std::chrono::microseconds>(elapsed)
+              .count());
+    }
+  }
+
+  InstrumentationScope(const InstrumentationScope&) = delete;
+  InstrumentationScope& operator=(const InstrumentationScope&) = delete;
+
+ private:
+  HAL_InstrumentationCategory m_category;
+  bool m_enabled;
+  std::chrono::steady_clock::time_point m_start;
+};
+
+}  // namespace hal
+#endif
+/** @} */
@@ -16,6 +16,13 @@
  * @{
  */
 
+/**
+ * Notifier callback function.  Called with the current FPGA time and the
+ * opaque parameter passed to HAL_SetNotifierCallback.
+ */
+typedef void (*HAL_NotifierCallbackFunction)(uint64_t currentTime,
+                                             void* param);
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -60,6 +67,28 @@ HAL_Bool HAL_SetNotifierThreadPriority(HAL_Bool realTime, int32_t priority,
 void HAL_SetNotifierName(HAL_NotifierHandle notifierHandle, const char* name,
                          int32_t* status);
 
+/**
+ * Sets a callback to be directly dispatched when the notifier alarm fires.
+ *
+ * The callback runs on the shared HAL notifier thread instead of waking a
+ * thread parked in HAL_WaitForNotifierAlarm, which removes a wakeup chain
+ * per notifier and tightens dispatch jitter.  Because every callback-mode
+ * notifier shares that thread, callbacks must be short and must not block;
+ * they may call HAL_UpdateNotifierAlarm to schedule the next alarm.
+ *
+ * A notifier in callback mode must not concurrently use
+ * HAL_WaitForNotifierAlarm.  Pass NULL to return to wait mode.
+ *
+ * @param[in] notifierHandle the notifier handle
+ * @param[in] callback       function called with the current FPGA time when
+ *                           the alarm fires, or NULL to disable
+ * @param[in] param          opaque pointer passed to the callback
+ * @param[out] status        Error status variable. 0 on success.
+ */
+void HAL_SetNotifierCallback(HAL_NotifierHandle notifierHandle,
+                             HAL_NotifierCallbackFunction callback, void* param,
+                             int32_t* status);
+
 /**
  * Stops a notifier from running.
  *
@@ -47,6 +47,25 @@ void HAL_InitializeSPI(HAL_SPIPort port, int32_t* status);
 int32_t HAL_TransactionSPI(HAL_SPIPort port, const uint8_t* dataToSend,
                            uint8_t* dataReceived, int32_t size);
 
+/**
+ * Performs a chained SPI transaction.
+ *
+ * All segments are submitted to the kernel as a single SPI message, so a
+ * multi-step device access (e.g. register address write followed by a data
+ * read) pays one syscall and one chip-select cycle instead of one per step.
+ * Chip select stays asserted between segments unless a segment sets
+ * csChange.
+ *
+ * @param port     The number of the port to use. 0-3 for Onboard CS0-CS2, 4
+ *                 for MXP
+ * @param segments The segments to transfer, executed in order.
+ * @param count    Number of segments. [1..8]
+ * @return Total number of bytes transferred, -1 for error
+ */
+int32_t HAL_ChainedTransactionSPI(HAL_SPIPort port,
+                                  const struct HAL_SPISegment* segments,
+                                  int32_t count);
+
 /**
  * Executes a write transaction with the device.
  *
@@ -34,6 +34,24 @@ HAL_ENUM(HAL_SPIMode) {
 };
 // clang-format on
 
+/**
+ * One segment of a chained SPI transaction.  Used by
+ * HAL_ChainedTransactionSPI().
+ */
+struct HAL_SPISegment {
+  /** Buffer of data to send; NULL to send zeros. */
+  const uint8_t* dataToSend;
+  /** Buffer to read data into; NULL to discard received data. */
+  uint8_t* dataReceived;
+  /** Number of bytes to transfer in this segment. */
+  int32_t size;
+  /**
+   * True to deassert chip select between this segment and the next one;
+   * otherwise chip select stays asserted across the segment boundary.
+   */
+  HAL_Bool csChange;
+};
+
 #ifdef __cplusplus
 namespace hal {
 
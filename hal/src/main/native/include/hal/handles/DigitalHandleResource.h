@@ -7,6 +7,7 @@
 #include <stdint.h>
 
 #include <array>
+#include <atomic>
 #include <memory>
 
 #include <wpi/mutex.h>
@@ -49,7 +50,7 @@ class DigitalHandleResource : public HandleBase {
 
  private:
   std::array<std::shared_ptr<TStruct>, size> m_structures;
-  std::array<wpi::mutex, size> m_handleMutexes;
+  std::array<wpi::adaptive_mutex, size> m_handleMutexes;
 };
 
 template <typename THandle, typename TStruct, int16_t size>
@@ -69,7 +70,9 @@ DigitalHandleResource<THandle, TStruct, size>::Allocate(
     *status = RESOURCE_IS_ALLOCATED;
     return m_structures[index];
   }
-  m_structures[index] = std::make_shared<TStruct>();
+  std::atomic_store_explicit(&m_structures[index],
+                             std::make_shared<TStruct>(),
+                             std::memory_order_release);
   *handle =
       static_cast<THandle>(hal::createHandle(index, enumValue, m_version));
   *status = HAL_SUCCESS;
@@ -84,10 +87,9 @@ std::shared_ptr<TStruct> DigitalHandleResource<THandle, TStruct, size>::Get(
   if (index < 0 || index >= size) {
     return nullptr;
   }
-  std::scoped_lock lock(m_handleMutexes[index]);
-  // return structure. Null will propagate correctly, so no need to manually
-  // check.
-  return m_structures[index];
+  // lock-free read; allocation/free publish the slot with a release store
+  return std::atomic_load_explicit(&m_structures[index],
+                                   std::memory_order_acquire);
 }
 
 template <typename THandle, typename TStruct, int16_t size>
@@ -100,14 +102,16 @@ void DigitalHandleResource<THandle, TStruct, size>::Free(
   }
   // lock and deallocated handle
   std::scoped_lock lock(m_handleMutexes[index]);
-  m_structures[index].reset();
+  std::atomic_store_explicit(&m_structures[index], std::shared_ptr<TStruct>{},
+                             std::memory_order_release);
 }
 
 template <typename THandle, typename TStruct, int16_t size>
 void DigitalHandleResource<THandle, TStruct, size>::ResetHandles() {
   for (int i = 0; i < size; i++) {
     std::scoped_lock lock(m_handleMutexes[i]);
-    m_structures[i].reset();
+    std::atomic_store_explicit(&m_structures[i], std::shared_ptr<TStruct>{},
+                               std::memory_order_release);
   }
   HandleBase::ResetHandles();
 }
@@ -7,6 +7,7 @@
 #include <stdint.h>
 
 #include <array>
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -53,7 +54,7 @@ class IndexedClassedHandleResource : public HandleBase {
 
  private:
   std::array<std::shared_ptr<TStruct>, size> m_structures;
-  std::array<wpi::mutex, size> m_handleMutexes;
+  std::array<wpi::adaptive_mutex, size> m_handleMutexes;
 };
 
 template <typename THandle, typename TStruct, int16_t size,
@@ -72,7 +73,8 @@ IndexedClassedHandleResource<THandle, TStruct, size, enumValue>::Allocate(
     *status = RESOURCE_IS_ALLOCATED;
     return HAL_kInvalidHandle;
   }
-  m_structures[index] = toSet;
+  std::atomic_store_explicit(&m_structures[index], std::move(toSet),
+                             std::memory_order_release);
   return static_cast<THandle>(hal::createHandle(index, enumValue, m_version));
 }
 
@@ -86,10 +88,9 @@ IndexedClassedHandleResource<THandle, TStruct, size, enumValue>::Get(
   if (index < 0 || index >= size) {
     return nullptr;
   }
-  std::scoped_lock lock(m_handleMutexes[index]);
-  // return structure. Null will propagate correctly, so no need to manually
-  // check.
-  return m_structures[index];
+  // lock-free read; allocation/free publish the slot with a release store
+  return std::atomic_load_explicit(&m_structures[index],
+                                   std::memory_order_acquire);
 }
 
 template <typename THandle, typename TStruct, int16_t size,
@@ -103,7 +104,8 @@ void IndexedClassedHandleResource<THandle, TStruct, size, enumValue>::Free(
   }
   // lock and deallocated handle
   std::scoped_lock lock(m_handleMutexes[index]);
-  m_structures[index].reset();
+  std::atomic_store_explicit(&m_structures[index], std::shared_ptr<TStruct>{},
+                             std::memory_order_release);
 }
 
 template <typename THandle, typename TStruct, int16_t size,
@@ -112,7 +114,8 @@ void IndexedClassedHandleResource<THandle, TStruct, size,
                                   enumValue>::ResetHandles() {
   for (int i = 0; i < size; i++) {
     std::scoped_lock lock(m_handleMutexes[i]);
-    m_structures[i].reset();
+    std::atomic_store_explicit(&m_structures[i], std::shared_ptr<TStruct>{},
+                               std::memory_order_release);
   }
   HandleBase::ResetHandles();
 }
@@ -7,6 +7,7 @@
 #include <stdint.h>
 
 #include <array>
+#include <atomic>
 #include <memory>
 
 #include <wpi/mutex.h>
@@ -50,7 +51,7 @@ class IndexedHandleResource : public HandleBase {
 
  private:
   std::array<std::shared_ptr<TStruct>, size> m_structures;
-  std::array<wpi::mutex, size> m_handleMutexes;
+  std::array<wpi::adaptive_mutex, size> m_handleMutexes;
 };
 
 template <typename THandle, typename TStruct, int16_t size,
@@ -71,7 +72,9 @@ IndexedHandleResource<THandle, TStruct, size, enumValue>::Allocate(
     *handle = HAL_kInvalidHandle;
     return m_structures[index];
   }
-  m_structures[index] = std::make_shared<TStruct>();
+  std::atomic_store_explicit(&m_structures[index],
+                             std::make_shared<TStruct>(),
+                             std::memory_order_release);
   *handle =
       static_cast<THandle>(hal::createHandle(index, enumValue, m_version));
   *status = HAL_SUCCESS;
@@ -87,10 +90,9 @@ IndexedHandleResource<THandle, TStruct, size, enumValue>::Get(THandle handle) {
   if (index < 0 || index >= size) {
     return nullptr;
   }
-  std::scoped_lock lock(m_handleMutexes[index]);
-  // return structure. Null will propagate correctly, so no need to manually
-  // check.
-  return m_structures[index];
+  // lock-free read; allocation/free publish the slot with a release store
+  return std::atomic_load_explicit(&m_structures[index],
+                                   std::memory_order_acquire);
 }
 
 template <typename THandle, typename TStruct, int16_t size,
@@ -104,7 +106,8 @@ void IndexedHandleResource<THandle, TStruct, size, enumValue>::Free(
   }
   // lock and deallocated handle
   std::scoped_lock lock(m_handleMutexes[index]);
-  m_structures[index].reset();
+  std::atomic_store_explicit(&m_structures[index], std::shared_ptr<TStruct>{},
+                             std::memory_order_release);
 }
 
 template <typename THandle, typename TStruct, int16_t size,
@@ -112,7 +115,8 @@ template <typename THandle, typename TStruct, int16_t size,
 void IndexedHandleResource<THandle, TStruct, size, enumValue>::ResetHandles() {
   for (int i = 0; i < size; i++) {
     std::scoped_lock lock(m_handleMutexes[i]);
-    m_structures[i].reset();
+    std::atomic_store_explicit(&m_structures[i], std::shared_ptr<TStruct>{},
+                               std::memory_order_release);
   }
   HandleBase::ResetHandles();
 }
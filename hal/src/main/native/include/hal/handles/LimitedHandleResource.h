@@ -7,6 +7,7 @@
 #include <stdint.h>
 
 #include <array>
+#include <atomic>
 #include <memory>
 
 #include <wpi/mutex.h>
@@ -46,8 +47,8 @@ class LimitedHandleResource : public HandleBase {
 
  private:
   std::array<std::shared_ptr<TStruct>, size> m_structures;
-  std::array<wpi::mutex, size> m_handleMutexes;
-  wpi::mutex m_allocateMutex;
+  std::array<wpi::adaptive_mutex, size> m_handleMutexes;
+  wpi::adaptive_mutex m_allocateMutex;
 };
 
 template <typename THandle, typename TStruct, int16_t size,
@@ -60,7 +61,9 @@ THandle LimitedHandleResource<THandle, TStruct, size, enumValue>::Allocate() {
       // if a false index is found, grab its specific mutex
       // and allocate it.
       std::scoped_lock lock(m_handleMutexes[i]);
-      m_structures[i] = std::make_shared<TStruct>();
+      std::atomic_store_explicit(&m_structures[i],
+                                 std::make_shared<TStruct>(),
+                                 std::memory_order_release);
       return static_cast<THandle>(createHandle(i, enumValue, m_version));
     }
   }
@@ -76,10 +79,9 @@ LimitedHandleResource<THandle, TStruct, size, enumValue>::Get(THandle handle) {
   if (index < 0 || index >= size) {
     return nullptr;
   }
-  std::scoped_lock lock(m_handleMutexes[index]);
-  // return structure. Null will propagate correctly, so no need to manually
-  // check.
-  return m_structures[index];
+  // lock-free read; allocation/free publish the slot with a release store
+  return std::atomic_load_explicit(&m_structures[index],
+                                   std::memory_order_acquire);
 }
 
 template <typename THandle, typename TStruct, int16_t size,
@@ -94,7 +96,8 @@ void LimitedHandleResource<THandle, TStruct, size, enumValue>::Free(
   // lock and deallocated handle
   std::scoped_lock allocateLock(m_allocateMutex);
   std::scoped_lock handleLock(m_handleMutexes[index]);
-  m_structures[index].reset();
+  std::atomic_store_explicit(&m_structures[index], std::shared_ptr<TStruct>{},
+                             std::memory_order_release);
 }
 
 template <typename THandle, typename TStruct, int16_t size,
@@ -104,7 +107,8 @@ void LimitedHandleResource<THandle, TStruct, size, enumValue>::ResetHandles() {
     std::scoped_lock allocateLock(m_allocateMutex);
     for (int i = 0; i < size; i++) {
       std::scoped_lock handleLock(m_handleMutexes[i]);
-      m_structures[i].reset();
+      std::atomic_store_explicit(&m_structures[i], std::shared_ptr<TStruct>{},
+                                 std::memory_order_release);
     }
   }
   HandleBase::ResetHandles();
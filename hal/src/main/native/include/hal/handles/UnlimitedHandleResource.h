@@ -6,9 +6,10 @@
 
 #include <stdint.h>
 
+#include <array>
+#include <atomic>
 #include <memory>
 #include <utility>
-#include <vector>
 
 #include <wpi/mutex.h>
 
@@ -22,9 +23,9 @@ namespace hal {
  * allows an unlimted number of handles that are allocated sequentially. When
  * possible, indices are reused to save memory usage and keep the array length
  * down.
- * However, automatic array management has not been implemented, but might be in
- * the future.
- * Because we have to loop through the allocator, we must use a global mutex.
+ * Storage is sharded into fixed-size blocks that are never moved once
+ * allocated, so Get() can dereference a handle without taking the table
+ * mutex; only allocation and free serialize on it.
 
  * @tparam THandle The Handle Type (Must be typedefed from HAL_Handle)
  * @tparam TStruct The struct type held by this resource
@@ -37,6 +38,11 @@ class UnlimitedHandleResource : public HandleBase {
 
  public:
   UnlimitedHandleResource() = default;
+  ~UnlimitedHandleResource() {
+    for (auto& shard : m_shards) {
+      delete shard.load(std::memory_order_relaxed);
+    }
+  }
   UnlimitedHandleResource(const UnlimitedHandleResource&) = delete;
   UnlimitedHandleResource& operator=(const UnlimitedHandleResource&) = delete;
 
@@ -56,8 +62,21 @@ class UnlimitedHandleResource : public HandleBase {
   void ForEach(Functor func);
 
  private:
-  std::vector<std::shared_ptr<TStruct>> m_structures;
-  wpi::mutex m_handleMutex;
+  static constexpr size_t kShardSize = 64;
+  static constexpr size_t kNumShards = (INT16_MAX + kShardSize) / kShardSize;
+  using Shard = std::array<std::shared_ptr<TStruct>, kShardSize>;
+
+  std::shared_ptr<TStruct>* GetSlot(size_t index) {
+    Shard* shard = m_shards[index / kShardSize].load(std::memory_order_acquire);
+    if (shard == nullptr) {
+      return nullptr;
+    }
+    return &(*shard)[index % kShardSize];
+  }
+
+  std::array<std::atomic<Shard*>, kNumShards> m_shards{};
+  size_t m_size = 0;
+  wpi::adaptive_mutex m_handleMutex;
 };
 
 template <typename THandle, typename TStruct, HAL_HandleEnum enumValue>
@@ -65,9 +84,11 @@ THandle UnlimitedHandleResource<THandle, TStruct, enumValue>::Allocate(
     std::shared_ptr<TStruct> structure) {
   std::scoped_lock lock(m_handleMutex);
   size_t i;
-  for (i = 0; i < m_structures.size(); i++) {
-    if (m_structures[i] == nullptr) {
-      m_structures[i] = structure;
+  for (i = 0; i < m_size; i++) {
+    std::shared_ptr<TStruct>* slot = GetSlot(i);
+    if (*slot == nullptr) {
+      std::atomic_store_explicit(slot, std::move(structure),
+                                 std::memory_order_release);
       return static_cast<THandle>(createHandle(i, enumValue, m_version));
     }
   }
@@ -75,7 +96,14 @@ THandle UnlimitedHandleResource<THandle, TStruct, enumValue>::Allocate(
     return HAL_kInvalidHandle;
   }
 
-  m_structures.push_back(structure);
+  auto& shard = m_shards[i / kShardSize];
+  if (shard.load(std::memory_order_relaxed) == nullptr) {
+    // publish the shard before any reader can hold a handle into it
+    shard.store(new Shard{}, std::memory_order_release);
+  }
+  std::atomic_store_explicit(GetSlot(i), std::move(structure),
+                             std::memory_order_release);
+  m_size = i + 1;
   return static_cast<THandle>(
       createHandle(static_cast<int16_t>(i), enumValue, m_version));
 }
@@ -84,31 +112,41 @@ template <typename THandle, typename TStruct, HAL_HandleEnum enumValue>
 std::shared_ptr<TStruct>
 UnlimitedHandleResource<THandle, TStruct, enumValue>::Get(THandle handle) {
   int16_t index = GetIndex(handle);
-  std::scoped_lock lock(m_handleMutex);
-  if (index < 0 || index >= static_cast<int16_t>(m_structures.size())) {
+  if (index < 0) {
+    return nullptr;
+  }
+  std::shared_ptr<TStruct>* slot = GetSlot(index);
+  if (slot == nullptr) {
     return nullptr;
   }
-  return m_structures[index];
+  return std::atomic_load_explicit(slot, std::memory_order_acquire);
 }
 
 template <typename THandle, typename TStruct, HAL_HandleEnum enumValue>
 std::shared_ptr<TStruct>
 UnlimitedHandleResource<THandle, TStruct, enumValue>::Free(THandle handle) {
   int16_t index = GetIndex(handle);
+  if (index < 0) {
+    return nullptr;
+  }
   std::scoped_lock lock(m_handleMutex);
-  if (index < 0 || index >= static_cast<int16_t>(m_structures.size())) {
+  if (static_cast<size_t>(index) >= m_size) {
     return nullptr;
   }
-  return std::move(m_structures[index]);
+  return std::atomic_exchange_explicit(GetSlot(index),
+                                       std::shared_ptr<TStruct>{},
+                                       std::memory_order_acq_rel);
 }
 
 template <typename THandle, typename TStruct, HAL_HandleEnum enumValue>
 void UnlimitedHandleResource<THandle, TStruct, enumValue>::ResetHandles() {
   {
     std::scoped_lock lock(m_handleMutex);
-    for (size_t i = 0; i < m_structures.size(); i++) {
-      m_structures[i].reset();
+    for (size_t i = 0; i < m_size; i++) {
+      std::atomic_store_explicit(GetSlot(i), std::shared_ptr<TStruct>{},
+                                 std::memory_order_release);
     }
+    m_size = 0;
   }
   HandleBase::ResetHandles();
 }
@@ -119,10 +157,11 @@ void UnlimitedHandleResource<THandle, TStruct, enumValue>::ForEach(
     Functor func) {
   std::scoped_lock lock(m_handleMutex);
   size_t i;
-  for (i = 0; i < m_structures.size(); i++) {
-    if (m_structures[i] != nullptr) {
+  for (i = 0; i < m_size; i++) {
+    std::shared_ptr<TStruct>* slot = GetSlot(i);
+    if (*slot != nullptr) {
       func(static_cast<THandle>(createHandle(i, enumValue, m_version)),
-           m_structures[i].get());
+           slot->get());
     }
   }
 }
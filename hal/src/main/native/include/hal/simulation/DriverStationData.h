@@ -109,6 +109,10 @@ void HALSIM_GetJoystickButtons(int32_t joystickNum,
 void HALSIM_SetJoystickButtons(int32_t joystickNum,
                                const HAL_JoystickButtons* buttons);
 
+void HALSIM_SetJoystickData(int32_t joystickNum, const HAL_JoystickAxes* axes,
+                            const HAL_JoystickPOVs* povs,
+                            const HAL_JoystickButtons* buttons);
+
 int32_t HALSIM_RegisterJoystickDescriptorCallback(
     int32_t joystickNum, HAL_JoystickDescriptorCallback callback, void* param,
     HAL_Bool initialNotify);
@@ -85,6 +85,19 @@ const char** HALSIM_GetSimValueEnumOptions(HAL_SimValueHandle handle,
 const double* HALSIM_GetSimValueEnumDoubleValues(HAL_SimValueHandle handle,
                                                  int32_t* numOptions);
 
+/* Direct value access fast path.  The pointer stays valid until the device is
+ * freed or HALSIM_ResetSimDeviceData is called.  Gets and sets through it take
+ * only a per-value lock instead of the device-wide lock; sets defer changed
+ * callbacks until the next HALSIM_FlushSimValueChangedCallbacks call (once per
+ * sim tick) instead of firing them inline. */
+void* HALSIM_GetSimValueDirectPointer(HAL_SimValueHandle handle);
+
+void HALSIM_GetSimValueByPointer(void* valuePtr, struct HAL_Value* value);
+
+void HALSIM_SetSimValueByPointer(void* valuePtr, const struct HAL_Value* value);
+
+void HALSIM_FlushSimValueChangedCallbacks(void);
+
 void HALSIM_ResetSimDeviceData(void);
 
 #ifdef __cplusplus
@@ -145,6 +145,30 @@ void HAL_WriteAddressableLEDData(HAL_AddressableLEDHandle handle,
   SimAddressableLEDData[led->index].SetData(data, length);
 }
 
+void HAL_WriteAddressableLEDDataRange(HAL_AddressableLEDHandle handle,
+                                      const struct HAL_AddressableLEDData* data,
+                                      int32_t start, int32_t length,
+                                      int32_t* status) {
+  auto led = ledHandles->Get(handle);
+  if (!led) {
+    *status = HAL_HANDLE_ERROR;
+    return;
+  }
+  if (start < 0 || length < 0 ||
+      start + length > SimAddressableLEDData[led->index].length) {
+    *status = PARAMETER_OUT_OF_RANGE;
+    hal::SetLastError(
+        status,
+        fmt::format(
+            "Data range must be within the string length {}. [{}, {}) was "
+            "requested",
+            SimAddressableLEDData[led->index].length.Get(), start,
+            start + length));
+    return;
+  }
+  SimAddressableLEDData[led->index].SetDataRange(data, start, length);
+}
+
 void HAL_SetAddressableLEDBitTiming(HAL_AddressableLEDHandle handle,
                                     int32_t lowTime0NanoSeconds,
                                     int32_t highTime0NanoSeconds,
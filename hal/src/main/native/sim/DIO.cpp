@@ -182,6 +182,29 @@ void HAL_SetDIO(HAL_DigitalHandle dioPortHandle, HAL_Bool value,
   SimDIOData[port->channel].value = value;
 }
 
+void HAL_SetDIOBatch(const HAL_DigitalHandle* dioPortHandles,
+                     const HAL_Bool* values, int32_t count, int32_t* status) {
+  // validate every channel before changing any output
+  for (int32_t i = 0; i < count; i++) {
+    auto port =
+        digitalChannelHandles->Get(dioPortHandles[i], HAL_HandleEnum::DIO);
+    if (port == nullptr) {
+      *status = HAL_HANDLE_ERROR;
+      return;
+    }
+    if (SimDIOData[port->channel].isInput) {
+      *status = PARAMETER_OUT_OF_RANGE;
+      hal::SetLastError(status, "Cannot set output of an input channel");
+      return;
+    }
+  }
+  for (int32_t i = 0; i < count; i++) {
+    auto port =
+        digitalChannelHandles->Get(dioPortHandles[i], HAL_HandleEnum::DIO);
+    SimDIOData[port->channel].value = values[i] != 0 ? 1 : 0;
+  }
+}
+
 void HAL_SetDIODirection(HAL_DigitalHandle dioPortHandle, HAL_Bool input,
                          int32_t* status) {
   auto port = digitalChannelHandles->Get(dioPortHandle, HAL_HandleEnum::DIO);
@@ -76,6 +76,18 @@ enum HAL_DMAReadStatus HAL_ReadDMA(HAL_DMAHandle handle,
   return HAL_DMA_ERROR;
 }
 
+int32_t HAL_ReadDMABatchDirect(void* dmaPointer, HAL_DMASample* dmaSamples,
+                               int32_t maxSamples, double timeoutSeconds,
+                               int32_t* remainingOut, int32_t* status) {
+  return 0;
+}
+
+int32_t HAL_ReadDMABatch(HAL_DMAHandle handle, HAL_DMASample* dmaSamples,
+                         int32_t maxSamples, double timeoutSeconds,
+                         int32_t* remainingOut, int32_t* status) {
+  return 0;
+}
+
 // Sampling Code
 uint64_t HAL_GetDMASampleTime(const HAL_DMASample* dmaSample, int32_t* status) {
   return 0;
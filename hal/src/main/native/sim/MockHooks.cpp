@@ -127,6 +127,35 @@ void HALSIM_StepTiming(uint64_t delta) {
     StepTiming(step);
     delta -= step;
 
+    DispatchNotifierCallbacks();
+    WakeupWaitNotifiers();
+  }
+}
+
+void HALSIM_FastForwardTiming(uint64_t delta) {
+  WaitNotifiers();
+
+  int32_t status = 0;
+  uint64_t endTime = HAL_GetFPGATime(&status) + delta;
+
+  for (;;) {
+    uint64_t curTime = HAL_GetFPGATime(&status);
+    if (curTime >= endTime) {
+      break;
+    }
+    uint64_t nextTimeout = HALSIM_GetNextNotifierTimeout();
+    if (nextTimeout > endTime) {
+      // No more alarms inside the window; jump straight to the end
+      StepTiming(endTime - curTime);
+      WakeupWaitNotifiers();
+      break;
+    }
+    // Jump directly to the next alarm deadline; callback-mode notifiers run
+    // inline on this thread, wait-mode notifiers are woken and waited for
+    if (nextTimeout > curTime) {
+      StepTiming(nextTimeout - curTime);
+    }
+    DispatchNotifierCallbacks();
     WakeupWaitNotifiers();
   }
 }
@@ -7,8 +7,11 @@
 #include <atomic>
 #include <chrono>
 #include <cstdio>
+#include <cstdlib>  // For std::atexit()
 #include <cstring>
 #include <string>
+#include <thread>
+#include <utility>
 
 #include <wpi/SmallVector.h>
 #include <wpi/condition_variable.h>
@@ -27,6 +30,8 @@ struct Notifier {
   std::string name;
   uint64_t waitTime = UINT64_MAX;
   bool active = true;
+  HAL_NotifierCallbackFunction callback = nullptr;
+  void* callbackParam = nullptr;
   bool waitTimeValid = false;    // True if waitTime is set and in the future
   bool waitingForAlarm = false;  // True if in HAL_WaitForNotifierAlarm()
   uint64_t waitCount = 0;        // Counts calls to HAL_WaitForNotifierAlarm()
@@ -60,6 +65,63 @@ class NotifierHandleContainer
 static NotifierHandleContainer* notifierHandles;
 static std::atomic<bool> notifiersPaused{false};
 
+// shared dispatcher thread for callback-mode notifiers
+static wpi::mutex notifierDispatcherMutex;
+static wpi::condition_variable notifierDispatcherCond;
+static std::thread notifierDispatcherThread;
+static std::atomic<bool> notifierDispatcherRunning{false};
+
+static void notifierDispatcherMain() {
+  std::unique_lock ulock(notifierDispatcherMutex);
+  while (notifierDispatcherRunning) {
+    int32_t status = 0;
+    uint64_t curTime = HAL_GetFPGATime(&status);
+    uint64_t nextTime = UINT64_MAX;
+    wpi::SmallVector<std::pair<HAL_NotifierCallbackFunction, void*>, 4> ready;
+    notifierHandles->ForEach([&](HAL_NotifierHandle, Notifier* notifier) {
+      std::scoped_lock lock(notifier->mutex);
+      if (!notifier->active || !notifier->callback ||
+          !notifier->waitTimeValid) {
+        return;
+      }
+      if (!notifiersPaused && curTime >= notifier->waitTime) {
+        notifier->waitTimeValid = false;
+        ready.emplace_back(notifier->callback, notifier->callbackParam);
+      } else if (notifier->waitTime < nextTime) {
+        nextTime = notifier->waitTime;
+      }
+    });
+
+    if (!ready.empty()) {
+      // dispatch with the lock released so callbacks can rearm
+      ulock.unlock();
+      for (auto&& [callback, param] : ready) {
+        callback(curTime, param);
+      }
+      ulock.lock();
+      continue;
+    }
+
+    double waitDuration;
+    if (nextTime == UINT64_MAX || notifiersPaused) {
+      // If not running, wait 1000 seconds
+      waitDuration = 1000.0;
+    } else {
+      waitDuration = (nextTime - curTime) * 1e-6;
+    }
+    notifierDispatcherCond.wait_for(ulock,
+                                    std::chrono::duration<double>(waitDuration));
+  }
+}
+
+static void cleanupNotifierDispatcherAtExit() {
+  notifierDispatcherRunning = false;
+  notifierDispatcherCond.notify_all();
+  if (notifierDispatcherThread.joinable()) {
+    notifierDispatcherThread.join();
+  }
+}
+
 namespace hal {
 namespace init {
 void InitializeNotifier() {
@@ -81,16 +143,18 @@ void WakeupNotifiers() {
   notifierHandles->ForEach([](HAL_NotifierHandle handle, Notifier* notifier) {
     notifier->cond.notify_all();
   });
+  notifierDispatcherCond.notify_all();
 }
 
 void WaitNotifiers() {
   std::unique_lock ulock(notifiersWaiterMutex);
   wpi::SmallVector<HAL_NotifierHandle, 8> waiters;
 
-  // Wait for all Notifiers to hit HAL_WaitForNotifierAlarm()
+  // Wait for all wait-mode Notifiers to hit HAL_WaitForNotifierAlarm();
+  // callback-mode notifiers are dispatched rather than waited on
   notifierHandles->ForEach([&](HAL_NotifierHandle handle, Notifier* notifier) {
     std::scoped_lock lock(notifier->mutex);
-    if (notifier->active && !notifier->waitingForAlarm) {
+    if (notifier->active && !notifier->callback && !notifier->waitingForAlarm) {
       waiters.emplace_back(handle);
     }
   });
@@ -127,8 +191,9 @@ void WakeupWaitNotifiers() {
   notifierHandles->ForEach([&](HAL_NotifierHandle handle, Notifier* notifier) {
     std::scoped_lock lock(notifier->mutex);
 
-    // Only wait for the Notifier if it has a valid timeout that's expired
-    if (notifier->active && notifier->waitTimeValid &&
+    // Only wait for the Notifier if it has a valid timeout that's expired;
+    // callback-mode notifiers are dispatched rather than waited on
+    if (notifier->active && !notifier->callback && notifier->waitTimeValid &&
         curTime >= notifier->waitTime) {
       waiters.emplace_back(handle, notifier->waitCount);
       notifier->cond.notify_all();
@@ -159,6 +224,24 @@ void WakeupWaitNotifiers() {
     notifiersWaiterCond.wait_for(ulock, std::chrono::duration<double>(1));
   }
 }
+void DispatchNotifierCallbacks() {
+  int32_t status = 0;
+  uint64_t curTime = HAL_GetFPGATime(&status);
+  wpi::SmallVector<std::pair<HAL_NotifierCallbackFunction, void*>, 4> ready;
+  notifierHandles->ForEach([&](HAL_NotifierHandle, Notifier* notifier) {
+    std::scoped_lock lock(notifier->mutex);
+    // Clearing waitTimeValid under the notifier mutex claims the alarm, so
+    // the dispatcher thread can't also run it
+    if (notifier->active && notifier->callback && notifier->waitTimeValid &&
+        curTime >= notifier->waitTime) {
+      notifier->waitTimeValid = false;
+      ready.emplace_back(notifier->callback, notifier->callbackParam);
+    }
+  });
+  for (auto&& [callback, param] : ready) {
+    callback(curTime, param);
+  }
+}
 }  // namespace hal
 
 extern "C" {
@@ -189,6 +272,27 @@ void HAL_SetNotifierName(HAL_NotifierHandle notifierHandle, const char* name,
   notifier->name = name;
 }
 
+void HAL_SetNotifierCallback(HAL_NotifierHandle notifierHandle,
+                             HAL_NotifierCallbackFunction callback, void* param,
+                             int32_t* status) {
+  auto notifier = notifierHandles->Get(notifierHandle);
+  if (!notifier) {
+    return;
+  }
+  {
+    std::scoped_lock lock(notifier->mutex);
+    notifier->callback = callback;
+    notifier->callbackParam = param;
+  }
+  if (callback) {
+    if (!notifierDispatcherRunning.exchange(true)) {
+      notifierDispatcherThread = std::thread(notifierDispatcherMain);
+      std::atexit(cleanupNotifierDispatcherAtExit);
+    }
+    notifierDispatcherCond.notify_all();
+  }
+}
+
 void HAL_StopNotifier(HAL_NotifierHandle notifierHandle, int32_t* status) {
   auto notifier = notifierHandles->Get(notifierHandle);
   if (!notifier) {
@@ -233,6 +337,7 @@ void HAL_UpdateNotifierAlarm(HAL_NotifierHandle notifierHandle,
 
   // We wake up any waiters to change how long they're sleeping for
   notifier->cond.notify_all();
+  notifierDispatcherCond.notify_all();
 }
 
 void HAL_CancelNotifierAlarm(HAL_NotifierHandle notifierHandle,
@@ -23,6 +23,21 @@ int32_t HAL_TransactionSPI(HAL_SPIPort port, const uint8_t* dataToSend,
                            uint8_t* dataReceived, int32_t size) {
   return SimSPIData[port].Transaction(dataToSend, dataReceived, size);
 }
+int32_t HAL_ChainedTransactionSPI(HAL_SPIPort port,
+                                  const struct HAL_SPISegment* segments,
+                                  int32_t count) {
+  // no kernel message in sim; run the segments back to back
+  int32_t total = 0;
+  for (int32_t i = 0; i < count; i++) {
+    int32_t ret = SimSPIData[port].Transaction(
+        segments[i].dataToSend, segments[i].dataReceived, segments[i].size);
+    if (ret < 0) {
+      return -1;
+    }
+    total += ret;
+  }
+  return total;
+}
 int32_t HAL_WriteSPI(HAL_SPIPort port, const uint8_t* dataToSend,
                      int32_t sendSize) {
   return SimSPIData[port].Write(dataToSend, sendSize);
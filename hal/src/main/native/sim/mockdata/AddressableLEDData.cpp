@@ -36,6 +36,19 @@ void AddressableLEDData::SetData(const HAL_AddressableLEDData* d, int32_t len) {
   data(reinterpret_cast<const uint8_t*>(d), len * sizeof(d[0]));
 }
 
+void AddressableLEDData::SetDataRange(const HAL_AddressableLEDData* d,
+                                      int32_t start, int32_t len) {
+  len = (std::min)(HAL_kAddressableLEDMaxLength - start, len);
+  int32_t dataLen;
+  {
+    std::scoped_lock lock(m_dataMutex);
+    std::memcpy(&m_data[start], d, len * sizeof(d[0]));
+    dataLen = length;
+  }
+  // notify with the whole buffer so listeners see the full strip state
+  data(reinterpret_cast<const uint8_t*>(m_data), dataLen * sizeof(d[0]));
+}
+
 int32_t AddressableLEDData::GetData(HAL_AddressableLEDData* d) {
   std::scoped_lock lock(m_dataMutex);
   int32_t len = length;
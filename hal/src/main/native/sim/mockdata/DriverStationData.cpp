@@ -99,6 +99,22 @@ DEFINE_CPPAPI(Axes, axes, )
 DEFINE_CPPAPI(POVs, povs, )
 DEFINE_CPPAPI(Buttons, buttons, )
 
+void DriverStationData::SetJoystickData(int32_t joystickNum,
+                                        const HAL_JoystickAxes* axes,
+                                        const HAL_JoystickPOVs* povs,
+                                        const HAL_JoystickButtons* buttons) {
+  if (joystickNum < 0 || joystickNum >= kNumJoysticks) {
+    return;
+  }
+  std::scoped_lock lock(m_joystickDataMutex);
+  m_joystickData[joystickNum].axes = *axes;
+  m_joystickData[joystickNum].povs = *povs;
+  m_joystickData[joystickNum].buttons = *buttons;
+  m_joystickAxesCallbacks(joystickNum, axes);
+  m_joystickPOVsCallbacks(joystickNum, povs);
+  m_joystickButtonsCallbacks(joystickNum, buttons);
+}
+
 DEFINE_CPPAPI_CALLBACKS(Descriptor, descriptor, )
 
 void DriverStationData::GetJoystickDescriptor(
@@ -442,6 +458,12 @@ DEFINE_CAPI(POVs, povs)
 DEFINE_CAPI(Buttons, buttons)
 DEFINE_CAPI(Descriptor, descriptor)
 
+void HALSIM_SetJoystickData(int32_t joystickNum, const HAL_JoystickAxes* axes,
+                            const HAL_JoystickPOVs* povs,
+                            const HAL_JoystickButtons* buttons) {
+  SimDriverStationData->SetJoystickData(joystickNum, axes, povs, buttons);
+}
+
 int32_t HALSIM_RegisterJoystickOutputsCallback(
     int32_t joystickNum, HAL_JoystickOutputsCallback callback, void* param,
     HAL_Bool initialNotify) {
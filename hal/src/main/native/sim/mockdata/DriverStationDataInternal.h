@@ -62,6 +62,10 @@ class DriverStationData {
   void SetJoystickButtons(int32_t joystickNum,
                           const HAL_JoystickButtons* buttons);
 
+  void SetJoystickData(int32_t joystickNum, const HAL_JoystickAxes* axes,
+                       const HAL_JoystickPOVs* povs,
+                       const HAL_JoystickButtons* buttons);
+
   int32_t RegisterJoystickDescriptorCallback(
       int32_t joystickNum, HAL_JoystickDescriptorCallback callback, void* param,
       HAL_Bool initialNotify);
@@ -204,6 +204,7 @@ HAL_Value SimDeviceData::GetValue(HAL_SimValueHandle handle) {
     return value;
   }
 
+  std::scoped_lock valueLock(valueImpl->valueMutex);
   return valueImpl->value;
 }
 
@@ -215,7 +216,10 @@ void SimDeviceData::SetValue(HAL_SimValueHandle handle,
     return;
   }
 
-  valueImpl->value = value;
+  {
+    std::scoped_lock valueLock(valueImpl->valueMutex);
+    valueImpl->value = value;
+  }
 
   // notify callbacks
   valueImpl->changed(valueImpl->name.c_str(), valueImpl->handle,
@@ -229,8 +233,14 @@ void SimDeviceData::ResetValue(HAL_SimValueHandle handle) {
     return;
   }
 
+  HAL_Value oldValue;
+  {
+    std::scoped_lock valueLock(valueImpl->valueMutex);
+    oldValue = valueImpl->value;
+  }
+
   // don't notify reset if we aren't going to actually reset anything
-  switch (valueImpl->value.type) {
+  switch (oldValue.type) {
     case HAL_INT:
     case HAL_LONG:
     case HAL_DOUBLE:
@@ -241,26 +251,80 @@ void SimDeviceData::ResetValue(HAL_SimValueHandle handle) {
 
   // notify reset callbacks (done here so they're called with the old value)
   valueImpl->reset(valueImpl->name.c_str(), valueImpl->handle,
-                   valueImpl->direction, &valueImpl->value);
+                   valueImpl->direction, &oldValue);
 
   // set user-facing value to 0
-  switch (valueImpl->value.type) {
+  HAL_Value newValue = oldValue;
+  switch (newValue.type) {
     case HAL_INT:
-      valueImpl->value.data.v_int = 0;
+      newValue.data.v_int = 0;
       break;
     case HAL_LONG:
-      valueImpl->value.data.v_long = 0;
+      newValue.data.v_long = 0;
       break;
     case HAL_DOUBLE:
-      valueImpl->value.data.v_double = 0;
+      newValue.data.v_double = 0;
       break;
     default:
       return;
   }
+  {
+    std::scoped_lock valueLock(valueImpl->valueMutex);
+    valueImpl->value = newValue;
+  }
 
   // notify changed callbacks
   valueImpl->changed(valueImpl->name.c_str(), valueImpl->handle,
-                     valueImpl->direction, &valueImpl->value);
+                     valueImpl->direction, &newValue);
+}
+
+void* SimDeviceData::GetValueDirectPointer(HAL_SimValueHandle handle) {
+  std::scoped_lock lock(m_mutex);
+  // Value objects are held by unique_ptr and never move, so the pointer is
+  // stable until the device is freed or ResetData() destroys it
+  return LookupValue(handle);
+}
+
+void SimDeviceData::GetValueByPointer(void* valuePtr, HAL_Value* value) {
+  Value* valueImpl = static_cast<Value*>(valuePtr);
+  if (!valueImpl) {
+    value->data.v_int = 0;
+    value->type = HAL_UNASSIGNED;
+    return;
+  }
+  std::scoped_lock valueLock(valueImpl->valueMutex);
+  *value = valueImpl->value;
+}
+
+void SimDeviceData::SetValueByPointer(void* valuePtr, const HAL_Value& value) {
+  Value* valueImpl = static_cast<Value*>(valuePtr);
+  if (!valueImpl) {
+    return;
+  }
+  {
+    std::scoped_lock valueLock(valueImpl->valueMutex);
+    valueImpl->value = value;
+  }
+  // defer callbacks to FlushValueChangedCallbacks()
+  valueImpl->changedPending.store(true, std::memory_order_release);
+}
+
+void SimDeviceData::FlushValueChangedCallbacks() {
+  std::scoped_lock lock(m_mutex);
+  for (auto&& device : m_devices) {
+    for (auto&& value : device->values) {
+      if (!value->changedPending.exchange(false, std::memory_order_acq_rel)) {
+        continue;
+      }
+      HAL_Value current;
+      {
+        std::scoped_lock valueLock(value->valueMutex);
+        current = value->value;
+      }
+      value->changed(value->name.c_str(), value->handle, value->direction,
+                     &current);
+    }
+  }
 }
 
 int32_t SimDeviceData::RegisterDeviceCreatedCallback(
@@ -355,8 +419,13 @@ int32_t SimDeviceData::RegisterValueCreatedCallback(
   // initial notifications
   if (initialNotify) {
     for (auto&& value : deviceImpl->values) {
+      HAL_Value current;
+      {
+        std::scoped_lock valueLock(value->valueMutex);
+        current = value->value;
+      }
       callback(value->name.c_str(), param, value->handle, value->direction,
-               &value->value);
+               &current);
     }
   }
 
@@ -390,8 +459,13 @@ int32_t SimDeviceData::RegisterValueChangedCallback(
 
   // initial notification
   if (initialNotify) {
+    HAL_Value current;
+    {
+      std::scoped_lock valueLock(valueImpl->valueMutex);
+      current = valueImpl->value;
+    }
     callback(valueImpl->name.c_str(), param, valueImpl->handle,
-             valueImpl->direction, &valueImpl->value);
+             valueImpl->direction, &current);
   }
 
   // encode device and value into uid
@@ -468,8 +542,13 @@ void SimDeviceData::EnumerateValues(HAL_SimDeviceHandle device, void* param,
   }
 
   for (auto&& value : deviceImpl->values) {
+    HAL_Value current;
+    {
+      std::scoped_lock valueLock(value->valueMutex);
+      current = value->value;
+    }
     callback(value->name.c_str(), param, value->handle, value->direction,
-             &value->value);
+             &current);
   }
 }
 
@@ -611,6 +690,23 @@ void HALSIM_EnumerateSimValues(HAL_SimDeviceHandle device, void* param,
   SimSimDeviceData->EnumerateValues(device, param, callback);
 }
 
+void* HALSIM_GetSimValueDirectPointer(HAL_SimValueHandle handle) {
+  return SimSimDeviceData->GetValueDirectPointer(handle);
+}
+
+void HALSIM_GetSimValueByPointer(void* valuePtr, struct HAL_Value* value) {
+  SimSimDeviceData->GetValueByPointer(valuePtr, value);
+}
+
+void HALSIM_SetSimValueByPointer(void* valuePtr,
+                                 const struct HAL_Value* value) {
+  SimSimDeviceData->SetValueByPointer(valuePtr, *value);
+}
+
+void HALSIM_FlushSimValueChangedCallbacks(void) {
+  SimSimDeviceData->FlushValueChangedCallbacks();
+}
+
 const char** HALSIM_GetSimValueEnumOptions(HAL_SimValueHandle handle,
                                            int32_t* numOptions) {
   return SimSimDeviceData->GetValueEnumOptions(handle, numOptions);
@@ -6,6 +6,7 @@
 
 #include <stdint.h>
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <utility>
@@ -147,6 +148,11 @@ class SimDeviceData {
     std::string name;
     int32_t direction;
     HAL_Value value;
+    // guards value for direct (pointer-based) access, which does not take
+    // the device-wide m_mutex; lock order is m_mutex then valueMutex
+    wpi::spinlock valueMutex;
+    // set by SetValueByPointer, consumed by FlushValueChangedCallbacks
+    std::atomic<bool> changedPending{false};
     std::vector<std::string> enumOptions;
     std::vector<const char*> cstrEnumOptions;
     std::vector<double> enumOptionValues;
@@ -192,6 +198,15 @@ class SimDeviceData {
   void SetValue(HAL_SimValueHandle handle, const HAL_Value& value);
   void ResetValue(HAL_SimValueHandle handle);
 
+  // Direct value access.  The returned pointer stays valid until the device
+  // is freed or ResetData() is called; reads and writes through it take only
+  // a per-value lock, and writes defer changed callbacks until the next
+  // FlushValueChangedCallbacks() instead of firing them inline.
+  void* GetValueDirectPointer(HAL_SimValueHandle handle);
+  void GetValueByPointer(void* valuePtr, HAL_Value* value);
+  void SetValueByPointer(void* valuePtr, const HAL_Value& value);
+  void FlushValueChangedCallbacks();
+
   int32_t RegisterDeviceCreatedCallback(const char* prefix, void* param,
                                         HALSIM_SimDeviceCallback callback,
                                         bool initialNotify);
@@ -2,9 +2,12 @@
 // Open Source Software; you can modify and/or share it under the terms of
 // the WPILib BSD license file in the root directory of this project.
 
+#include <vector>
+
 #include "gtest/gtest.h"
 #include "hal/HAL.h"
 #include "hal/handles/IndexedClassedHandleResource.h"
+#include "hal/handles/UnlimitedHandleResource.h"
 
 #define HAL_TestHandle HAL_Handle
 
@@ -22,4 +25,22 @@ TEST(HandleTest, ClassedHandle) {
   EXPECT_EQ(0, status);
 }
 
+TEST(HandleTest, UnlimitedHandleShards) {
+  static hal::UnlimitedHandleResource<HAL_TestHandle, MyTestClass,
+                                      HAL_HandleEnum::Vendor>
+      testClass;
+  // span multiple storage shards
+  std::vector<HAL_TestHandle> handles;
+  for (int i = 0; i < 200; i++) {
+    handles.push_back(testClass.Allocate(std::make_shared<MyTestClass>()));
+  }
+  for (auto handle : handles) {
+    EXPECT_NE(testClass.Get(handle), nullptr);
+  }
+  EXPECT_NE(testClass.Free(handles[0]), nullptr);
+  EXPECT_EQ(testClass.Get(handles[0]), nullptr);
+  // freed slots are reused
+  EXPECT_EQ(testClass.Allocate(std::make_shared<MyTestClass>()), handles[0]);
+}
+
 }  // namespace hal
@@ -0,0 +1,162 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <stdint.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <fmt/format.h>
+#include <wpi/SmallVector.h>
+#include <wpi/Synchronization.h>
+#include <wpi/raw_ostream.h>
+
+#include "net/WireDecoder.h"
+#include "net/WireEncoder.h"
+#include "ntcore.h"
+#include "ntcore_cpp.h"
+
+namespace {
+
+// Runs fn() count times and prints the per-iteration time.  Coarse by design;
+// these exist to catch order-of-magnitude regressions in the hot paths, not to
+// replace a profiler.
+template <typename F>
+void Bench(std::string_view name, int count, F&& fn) {
+  auto start = std::chrono::high_resolution_clock::now();
+  for (int i = 0; i < count; ++i) {
+    fn(i);
+  }
+  auto stop = std::chrono::high_resolution_clock::now();
+  auto total =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start)
+          .count();
+  fmt::print("{:<32} {:>10} iters {:>10} ns/iter\n", name, count,
+             total / count);
+}
+
+void BenchLocalStorage() {
+  fmt::print("-- LocalStorage --\n");
+  auto inst = nt::CreateInstance();
+  auto topic = nt::GetTopic(inst, "bench");
+  auto pub = nt::Publish(topic, NT_DOUBLE, "double");
+  auto sub = nt::Subscribe(topic, NT_DOUBLE, "double");
+
+  Bench("publish double", 1000000,
+        [&](int i) { nt::SetDouble(pub, i * 0.5, 1); });
+  Bench("poll latest double", 1000000, [&](int) { nt::GetDouble(sub, 0); });
+
+  auto queueSub = nt::Subscribe(topic, NT_DOUBLE, "double",
+                                {{nt::PubSubOption::KeepDuplicates(true),
+                                  nt::PubSubOption::SendAll(true)}});
+  std::vector<nt::Value> values;
+  Bench("publish + drain queue x16", 10000, [&](int i) {
+    for (int j = 0; j < 16; ++j) {
+      nt::SetDouble(pub, i + j * 0.5, 1);
+    }
+    nt::ReadQueueValue(queueSub, &values);
+  });
+
+  nt::DestroyInstance(inst);
+}
+
+void BenchWireCodec() {
+  fmt::print("-- Wire codec --\n");
+  auto value = nt::Value::MakeDouble(1.5, 100);
+  wpi::SmallVector<char, 128> buf;
+  wpi::raw_svector_ostream os{buf};
+
+  Bench("WireEncodeBinary double", 1000000, [&](int) {
+    buf.clear();
+    nt::net::WireEncodeBinary(os, 5, 100, value);
+  });
+
+  buf.clear();
+  nt::net::WireEncodeBinary(os, 5, 100, value);
+  Bench("WireDecodeBinary double", 1000000, [&](int) {
+    std::span<const uint8_t> in{reinterpret_cast<const uint8_t*>(buf.data()),
+                                buf.size()};
+    int64_t id;
+    nt::Value decoded;
+    std::string error;
+    nt::net::WireDecodeBinary(&in, &id, &decoded, &error, 0);
+  });
+
+  auto strValue = nt::Value::MakeString(std::string(128, 'x'), 100);
+  Bench("WireEncodeBinary string(128)", 1000000, [&](int) {
+    buf.clear();
+    nt::net::WireEncodeBinary(os, 5, 100, strValue);
+  });
+}
+
+void BenchRoundTrip() {
+  fmt::print("-- Client-server round trip --\n");
+  auto client = nt::CreateInstance();
+  auto server = nt::CreateInstance();
+
+  nt::StartServer(server, "benchmark.json", "127.0.0.1", 0, 10030);
+  nt::StartClient4(client, "benchmark");
+  nt::SetServer(client, "127.0.0.1", 10030);
+
+  using namespace std::chrono_literals;
+  std::this_thread::sleep_for(1s);
+
+  auto pub = nt::Publish(nt::GetTopic(client, "rtt"), NT_DOUBLE, "double");
+  auto sub = nt::Subscribe(nt::GetTopic(server, "rtt"), NT_DOUBLE, "double",
+                           {{nt::PubSubOption::KeepDuplicates(true),
+                             nt::PubSubOption::SendAll(true)}});
+  wpi::Event received;
+  nt::AddListener(sub, NT_EVENT_VALUE_REMOTE, [&](const nt::Event&) {
+    received.Set();
+  });
+
+  // warm up (and wait for announce to complete)
+  nt::SetDouble(pub, 0);
+  nt::Flush(client);
+  bool timedOut;
+  wpi::WaitForObject(received.GetHandle(), 5.0, &timedOut);
+  if (timedOut) {
+    fmt::print("round trip benchmark skipped: no connection\n");
+    nt::DestroyInstance(client);
+    nt::DestroyInstance(server);
+    return;
+  }
+
+  std::vector<int64_t> times;
+  times.reserve(1000);
+  for (int i = 1; i <= 1000; ++i) {
+    int64_t start = nt::Now();
+    nt::SetDouble(pub, i * 0.5);
+    nt::Flush(client);
+    wpi::WaitForObject(received.GetHandle(), 1.0, &timedOut);
+    if (!timedOut) {
+      times.emplace_back(nt::Now() - start);
+    }
+  }
+  if (!times.empty()) {
+    int64_t total = 0;
+    for (auto t : times) {
+      total += t;
+    }
+    fmt::print("{:<32} {:>10} iters {:>10} us/iter\n", "publish->receive",
+               times.size(), total / static_cast<int64_t>(times.size()));
+  }
+
+  nt::DestroyInstance(client);
+  nt::DestroyInstance(server);
+}
+
+}  // namespace
+
+int main() {
+  BenchLocalStorage();
+  BenchWireCodec();
+  BenchRoundTrip();
+  return EXIT_SUCCESS;
+}
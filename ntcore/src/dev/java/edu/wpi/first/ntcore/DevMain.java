@@ -8,11 +8,48 @@ import edu.wpi.first.networktables.NetworkTablesJNI;
 import edu.wpi.first.util.RuntimeDetector;
 
 public final class DevMain {
+  private static final int kWarmupIters = 20000;
+  private static final int kBenchIters = 200000;
+
   /** Main method. */
   public static void main(String[] args) {
     System.out.println("Hello World!");
     System.out.println(RuntimeDetector.getPlatformPath());
-    NetworkTablesJNI.flush(NetworkTablesJNI.getDefaultInstance());
+    int inst = NetworkTablesJNI.getDefaultInstance();
+    NetworkTablesJNI.flush(inst);
+    benchJni(inst);
+  }
+
+  private static void bench(String name, Runnable op) {
+    for (int i = 0; i < kWarmupIters; i++) {
+      op.run();
+    }
+    long start = System.nanoTime();
+    for (int i = 0; i < kBenchIters; i++) {
+      op.run();
+    }
+    long elapsed = System.nanoTime() - start;
+    System.out.println(name + ": " + elapsed / kBenchIters + " ns/op");
+  }
+
+  /**
+   * Micro-benchmark of JNI crossing costs for the common value paths: scalar set/get, bulk array
+   * transfer, and timestamped value read-out.
+   */
+  private static void benchJni(int inst) {
+    int entry = NetworkTablesJNI.getEntry(inst, "/bench/double");
+    int arrayEntry = NetworkTablesJNI.getEntry(inst, "/bench/doubleArray");
+    double[] values = new double[64];
+    for (int i = 0; i < values.length; i++) {
+      values[i] = i;
+    }
+    double[] arrayDefault = new double[0];
+
+    bench("setDouble", () -> NetworkTablesJNI.setDouble(entry, 0, 1.0));
+    bench("getDouble", () -> NetworkTablesJNI.getDouble(entry, 0.0));
+    bench("getAtomicDouble", () -> NetworkTablesJNI.getAtomicDouble(entry, 0.0));
+    bench("setDoubleArray[64]", () -> NetworkTablesJNI.setDoubleArray(arrayEntry, 0, values));
+    bench("getDoubleArray[64]", () -> NetworkTablesJNI.getDoubleArray(arrayEntry, arrayDefault));
   }
 
   private DevMain() {}
@@ -26,6 +26,8 @@ class INetworkClient {
 
   virtual void FlushLocal() = 0;
   virtual void Flush() = 0;
+
+  virtual TimeSyncInfo GetTimeSyncInfo() = 0;
 };
 
 }  // namespace nt
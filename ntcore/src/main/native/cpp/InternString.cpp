@@ -0,0 +1,41 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "InternString.h"
+
+#include <wpi/StringMap.h>
+#include <wpi/mutex.h>
+
+using namespace nt;
+
+std::shared_ptr<const std::string> InternString::Intern(std::string_view str) {
+  struct Pool {
+    wpi::mutex mutex;
+    wpi::StringMap<std::weak_ptr<const std::string>> map;
+    size_t insertsSincePrune{0};
+  };
+  static Pool pool;
+
+  std::scoped_lock lock{pool.mutex};
+  auto it = pool.map.find(str);
+  if (it != pool.map.end()) {
+    if (auto rv = it->second.lock()) {
+      return rv;
+    }
+  }
+  auto rv = std::make_shared<const std::string>(str);
+  pool.map[str] = rv;
+  // opportunistically drop entries whose strings are no longer referenced so
+  // churning topic names don't grow the pool without bound
+  if (++pool.insertsSincePrune >= 1024) {
+    pool.insertsSincePrune = 0;
+    for (auto mapIt = pool.map.begin(); mapIt != pool.map.end();) {
+      auto cur = mapIt++;
+      if (cur->second.expired()) {
+        pool.map.erase(cur);
+      }
+    }
+  }
+  return rv;
+}
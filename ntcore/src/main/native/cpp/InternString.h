@@ -0,0 +1,64 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <fmt/format.h>
+
+namespace nt {
+
+// Refcounted immutable string interned in a process-wide pool.  Topic names
+// are stored once and shared between LocalStorage, ServerImpl, and queued
+// network messages; copying an InternString is a refcount bump instead of a
+// string copy.  Converts implicitly to std::string_view, so it can be passed
+// directly to the wire encoders and used as a StringMap key.
+class InternString {
+ public:
+  InternString() = default;
+  /*implicit*/ InternString(std::string_view str) : m_str{Intern(str)} {}
+  /*implicit*/ InternString(const std::string& str)
+      : InternString{std::string_view{str}} {}
+  /*implicit*/ InternString(const char* str)
+      : InternString{std::string_view{str}} {}
+
+  operator std::string_view() const {  // NOLINT
+    return m_str ? std::string_view{*m_str} : std::string_view{};
+  }
+
+  const std::string& str() const {
+    static const std::string empty;
+    return m_str ? *m_str : empty;
+  }
+
+  const char* data() const { return m_str ? m_str->data() : nullptr; }
+  size_t size() const { return m_str ? m_str->size() : 0; }
+  bool empty() const { return !m_str || m_str->empty(); }
+
+  friend bool operator==(const InternString& lhs, const InternString& rhs) {
+    return lhs.m_str == rhs.m_str ||
+           std::string_view{lhs} == std::string_view{rhs};
+  }
+  friend bool operator==(const InternString& lhs, std::string_view rhs) {
+    return std::string_view{lhs} == rhs;
+  }
+
+ private:
+  static std::shared_ptr<const std::string> Intern(std::string_view str);
+
+  std::shared_ptr<const std::string> m_str;
+};
+
+}  // namespace nt
+
+template <>
+struct fmt::formatter<nt::InternString> : formatter<std::string_view> {
+  template <typename FormatContext>
+  auto format(const nt::InternString& str, FormatContext& ctx) const {
+    return formatter<std::string_view>::format(std::string_view{str}, ctx);
+  }
+};
@@ -240,10 +240,14 @@ void ListenerStorage::Notify(unsigned int flags, unsigned int level,
 
 NT_Listener ListenerStorage::AddListener(ListenerCallback callback) {
   std::scoped_lock lock{m_mutex};
-  if (!m_thread) {
-    m_thread.Start(m_pollers.Add(m_inst)->handle);
+  if (m_threads.size() < m_dispatchThreadCount) {
+    m_threads.emplace_back();
+    m_threads.back().Start(m_pollers.Add(m_inst)->handle);
+    m_nextThread = m_threads.size() - 1;
+  } else {
+    m_nextThread = (m_nextThread + 1) % m_threads.size();
   }
-  if (auto thr = m_thread.GetThread()) {
+  if (auto thr = m_threads[m_nextThread].GetThread()) {
     auto listener = DoAddListener(thr->m_poller);
     if (listener) {
       thr->m_callbacks.try_emplace(listener, std::move(callback));
@@ -309,27 +313,44 @@ ListenerStorage::RemoveListener(NT_Listener listenerHandle) {
 
 bool ListenerStorage::WaitForListenerQueue(double timeout) {
   std::scoped_lock lock{m_mutex};
-  WPI_EventHandle h;
-  if (auto thr = m_thread.GetThread()) {
-    h = thr->m_waitQueueWaiter.GetHandle();
-    thr->m_waitQueueWakeup.Set();
-  } else {
+  wpi::SmallVector<WPI_EventHandle, 4> handles;
+  for (auto&& owner : m_threads) {
+    if (auto thr = owner.GetThread()) {
+      handles.emplace_back(thr->m_waitQueueWaiter.GetHandle());
+      thr->m_waitQueueWakeup.Set();
+    }
+  }
+  if (handles.empty()) {
     return false;
   }
   bool timedOut;
-  return wpi::WaitForObject(h, timeout, &timedOut);
+  for (auto h : handles) {
+    if (!wpi::WaitForObject(h, timeout, &timedOut)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void ListenerStorage::SetDispatchThreadCount(unsigned int count) {
+  std::scoped_lock lock{m_mutex};
+  if (count >= 1) {
+    m_dispatchThreadCount = count;
+  }
 }
 
 std::vector<std::pair<NT_Listener, unsigned int>>
 ListenerStorage::DoRemoveListeners(std::span<const NT_Listener> handles) {
   std::vector<std::pair<NT_Listener, unsigned int>> rv;
-  auto thr = m_thread.GetThread();
   for (auto handle : handles) {
     if (auto listener = m_listeners.Remove(handle)) {
       rv.emplace_back(handle, listener->eventMask);
-      if (thr) {
-        if (thr->m_poller == listener->poller->handle) {
-          thr->m_callbacks.erase(handle);
+      for (auto&& owner : m_threads) {
+        if (auto thr = owner.GetThread()) {
+          if (thr->m_poller == listener->poller->handle) {
+            thr->m_callbacks.erase(handle);
+            break;
+          }
         }
       }
       if ((listener->eventMask & NT_EVENT_CONNECTION) != 0) {
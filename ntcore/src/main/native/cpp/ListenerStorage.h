@@ -59,6 +59,14 @@ class ListenerStorage final : public IListenerStorage {
 
   bool WaitForListenerQueue(double timeout);
 
+  // Opt-in parallel dispatch: callback listeners are partitioned round-robin
+  // across up to count dispatch threads (each with its own poller), keeping
+  // per-listener event ordering while isolating slow callbacks from listeners
+  // on other threads.  The default count of 1 retains the single dispatch
+  // thread.  Listeners added before the count is raised stay on their
+  // original thread.
+  void SetDispatchThreadCount(unsigned int count);
+
  private:
   // these assume the mutex is already held
   NT_Listener DoAddListener(NT_ListenerPoller pollerHandle);
@@ -105,7 +113,9 @@ class ListenerStorage final : public IListenerStorage {
   VectorSet<ListenerData*> m_logListeners;
 
   class Thread;
-  wpi::SafeThreadOwner<Thread> m_thread;
+  std::vector<wpi::SafeThreadOwner<Thread>> m_threads;
+  unsigned int m_dispatchThreadCount{1};
+  size_t m_nextThread{0};
 };
 
 }  // namespace nt
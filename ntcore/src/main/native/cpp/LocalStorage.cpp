@@ -5,6 +5,7 @@
 #include "LocalStorage.h"
 
 #include <algorithm>
+#include <atomic>
 
 #include <wpi/DataLog.h>
 #include <wpi/StringExtras.h>
@@ -17,6 +18,7 @@
 #include "Handle.h"
 #include "HandleMap.h"
 #include "IListenerStorage.h"
+#include "InternString.h"
 #include "Log.h"
 #include "PubSubOptions.h"
 #include "Types_internal.h"
@@ -46,6 +48,79 @@ struct PublisherData;
 struct SubscriberData;
 struct MultiSubscriberData;
 
+// Bounded lock-free multi-producer queue for values published while another
+// thread holds the storage mutex.  Producers enqueue without blocking; the
+// consumer drains with the storage mutex held, so publish order relative to
+// other publishes and to reads under the mutex is preserved.
+class PendingValueQueue {
+ public:
+  PendingValueQueue() {
+    for (size_t i = 0; i < kSize; ++i) {
+      m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  // Thread-safe; returns false if the queue is full (caller must fall back
+  // to the locked path).
+  bool Enqueue(NT_Handle pubentryHandle, const Value& value) {
+    size_t pos = m_tail.load(std::memory_order_relaxed);
+    for (;;) {
+      Cell& cell = m_cells[pos & kMask];
+      size_t seq = cell.sequence.load(std::memory_order_acquire);
+      auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+      if (diff == 0) {
+        if (m_tail.compare_exchange_weak(pos, pos + 1,
+                                         std::memory_order_relaxed)) {
+          cell.handle = pubentryHandle;
+          cell.value = value;
+          cell.sequence.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = m_tail.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  bool IsEmpty() const {
+    return m_head == m_tail.load(std::memory_order_relaxed);
+  }
+
+  // Single consumer only (call with the storage mutex held).
+  template <typename F>
+  void Drain(F&& func) {
+    size_t pos = m_head;
+    for (;;) {
+      Cell& cell = m_cells[pos & kMask];
+      size_t seq = cell.sequence.load(std::memory_order_acquire);
+      if (static_cast<intptr_t>(seq) != static_cast<intptr_t>(pos + 1)) {
+        break;
+      }
+      func(cell.handle, std::move(cell.value));
+      cell.value = Value{};
+      cell.sequence.store(pos + kSize, std::memory_order_release);
+      ++pos;
+    }
+    m_head = pos;
+  }
+
+ private:
+  static constexpr size_t kSize = 256;
+  static constexpr size_t kMask = kSize - 1;
+
+  struct Cell {
+    std::atomic<size_t> sequence{0};
+    NT_Handle handle{0};
+    Value value;
+  };
+
+  Cell m_cells[kSize];
+  std::atomic<size_t> m_tail{0};
+  size_t m_head{0};  // consumer only
+};
+
 struct DataLoggerEntry {
   DataLoggerEntry(wpi::log::DataLog& log, int entry, NT_DataLogger logger)
       : log{&log}, entry{entry}, logger{logger} {}
@@ -73,10 +148,13 @@ struct TopicData {
 
   // invariants
   wpi::SignalObject<NT_Topic> handle;
-  std::string name;
+  InternString name;
 
   Value lastValue;  // also stores timestamp
   bool lastValueNetwork{false};
+  // created on first GetLatestValueCell() for the topic; outlives the topic
+  // (readers hold a shared_ptr)
+  std::shared_ptr<LatestValueCell> latestCell;
   NT_Type type{NT_UNASSIGNED};
   std::string typeStr;
   unsigned int flags{0};            // for NT3 APIs
@@ -327,7 +405,17 @@ struct LSImpl {
   bool SetEntryValue(NT_Handle pubentryHandle, const Value& value);
   bool SetDefaultEntryValue(NT_Handle pubsubentryHandle, const Value& value);
 
+  // lock-free publish fast path; Enqueue is safe to call without the storage
+  // mutex, Drain requires it
+  bool EnqueuePendingValue(NT_Handle pubentryHandle, const Value& value) {
+    return m_pendingValues.Enqueue(pubentryHandle, value);
+  }
+  bool HasPendingValues() const { return !m_pendingValues.IsEmpty(); }
+  void DrainPendingValues();
+
   void RemoveSubEntry(NT_Handle subentryHandle);
+
+  PendingValueQueue m_pendingValues;
 };
 
 }  // namespace
@@ -474,6 +562,30 @@ void LSImpl::CheckReset(TopicData* topic) {
   topic->propertiesStr = "{}";
 }
 
+static void WriteLatestCell(LatestValueCell& cell, const Value& value) {
+  LatestValueCell::Snapshot data;
+  data.type = value.type();
+  data.time = value.time();
+  data.serverTime = value.server_time();
+  switch (value.type()) {
+    case NT_BOOLEAN:
+      data.valueBoolean = value.GetBoolean();
+      break;
+    case NT_INTEGER:
+      data.valueInteger = value.GetInteger();
+      break;
+    case NT_FLOAT:
+      data.valueFloat = value.GetFloat();
+      break;
+    case NT_DOUBLE:
+      data.valueDouble = value.GetDouble();
+      break;
+    default:
+      return;
+  }
+  cell.Write(data);
+}
+
 bool LSImpl::SetValue(TopicData* topic, const Value& value,
                       unsigned int eventFlags) {
   if (topic->type != NT_UNASSIGNED && topic->type != value.type()) {
@@ -486,6 +598,9 @@ bool LSImpl::SetValue(TopicData* topic, const Value& value,
     topic->type = value.type();
     topic->lastValue = value;
     topic->lastValueNetwork = isNetwork;
+    if (topic->latestCell) {
+      WriteLatestCell(*topic->latestCell, value);
+    }
     NotifyValue(topic, eventFlags);
   }
   if (topic->datalogType == value.type()) {
@@ -822,7 +937,7 @@ SubscriberData* LSImpl::AddLocalSubscriber(TopicData* topic,
   }
   if (m_network) {
     DEBUG4("-> NetworkSubscribe({})", topic->name);
-    m_network->Subscribe(subscriber->handle, {{topic->name}}, config);
+    m_network->Subscribe(subscriber->handle, {{topic->name.str()}}, config);
   }
   return subscriber;
 }
@@ -1155,6 +1270,8 @@ TopicData* LSImpl::GetTopic(NT_Handle handle) {
 }
 
 SubscriberData* LSImpl::GetSubEntry(NT_Handle subentryHandle) {
+  // ensure publishes queued on the lock-free path are visible to reads
+  DrainPendingValues();
   Handle h{subentryHandle};
   if (h.IsType(Handle::kSubscriber)) {
     return m_subscribers.Get(subentryHandle);
@@ -1227,6 +1344,14 @@ bool LSImpl::SetEntryValue(NT_Handle pubentryHandle, const Value& value) {
   return PublishLocalValue(publisher, value);
 }
 
+void LSImpl::DrainPendingValues() {
+  if (m_pendingValues.IsEmpty()) {
+    return;
+  }
+  m_pendingValues.Drain(
+      [this](NT_Handle handle, Value value) { SetEntryValue(handle, value); });
+}
+
 bool LSImpl::SetDefaultEntryValue(NT_Handle pubsubentryHandle,
                                   const Value& value) {
   if (!value) {
@@ -1239,6 +1364,9 @@ bool LSImpl::SetDefaultEntryValue(NT_Handle pubsubentryHandle,
       topic->lastValue = value;
       topic->lastValue.SetTime(0);
       topic->lastValue.SetServerTime(0);
+      if (topic->latestCell) {
+        WriteLatestCell(*topic->latestCell, topic->lastValue);
+      }
 
       auto publisher = m_publishers.Get(pubsubentryHandle);
       if (!publisher) {
@@ -1286,6 +1414,34 @@ LocalStorage::LocalStorage(int inst, IListenerStorage& listenerStorage,
 
 LocalStorage::~LocalStorage() = default;
 
+void LocalStorage::StorageMutex::unlock() {
+  // drain before releasing; the exclusive lock is still held here, so this
+  // both preserves publish order and guarantees any value enqueued on the
+  // lock-free path while this thread held the mutex gets delivered rather
+  // than sitting in the queue until some future locked operation
+  m_storage.m_impl->DrainPendingValues();
+  m_mutex.unlock();
+  // a value can be enqueued between the drain above and the release; the
+  // enqueuer's try_lock retry fails while this thread is in that gap, so
+  // mirror unlock_shared(): re-check after releasing and drain if the mutex
+  // is free (if another thread grabbed it, its release will drain instead)
+  if (m_storage.m_impl->HasPendingValues() && m_mutex.try_lock()) {
+    m_storage.m_impl->DrainPendingValues();
+    m_mutex.unlock();
+  }
+}
+
+void LocalStorage::StorageMutex::unlock_shared() {
+  m_mutex.unlock_shared();
+  // a shared holder can't drain in place (draining mutates storage), so
+  // re-check after releasing and drain if the mutex is free; if another
+  // thread holds it, that thread's release will drain instead
+  if (m_storage.m_impl->HasPendingValues() && m_mutex.try_lock()) {
+    m_storage.m_impl->DrainPendingValues();
+    m_mutex.unlock();
+  }
+}
+
 NT_Topic LocalStorage::NetworkAnnounce(std::string_view name,
                                        std::string_view typeStr,
                                        const wpi::json& properties,
@@ -1337,7 +1493,7 @@ void LocalStorage::StartNetwork(net::NetworkStartupInterface& startup,
     }
   }
   for (auto&& subscriber : m_impl->m_subscribers) {
-    startup.Subscribe(subscriber->handle, {{subscriber->topic->name}},
+    startup.Subscribe(subscriber->handle, {{subscriber->topic->name.str()}},
                       subscriber->config);
   }
   for (auto&& subscriber : m_impl->m_multiSubscribers) {
@@ -1401,7 +1557,7 @@ static void ForEachTopic(T& topics, std::string_view prefix,
 
 std::vector<NT_Topic> LocalStorage::GetTopics(std::string_view prefix,
                                               unsigned int types) {
-  std::scoped_lock lock(m_mutex);
+  std::shared_lock lock(m_mutex);
   std::vector<NT_Topic> rv;
   ForEachTopic(m_impl->m_topics, prefix, types,
                [&](TopicData& topic) { rv.push_back(topic.handle); });
@@ -1410,7 +1566,7 @@ std::vector<NT_Topic> LocalStorage::GetTopics(std::string_view prefix,
 
 std::vector<NT_Topic> LocalStorage::GetTopics(
     std::string_view prefix, std::span<const std::string_view> types) {
-  std::scoped_lock lock(m_mutex);
+  std::shared_lock lock(m_mutex);
   std::vector<NT_Topic> rv;
   ForEachTopic(m_impl->m_topics, prefix, types,
                [&](TopicData& topic) { rv.push_back(topic.handle); });
@@ -1419,7 +1575,7 @@ std::vector<NT_Topic> LocalStorage::GetTopics(
 
 std::vector<TopicInfo> LocalStorage::GetTopicInfo(std::string_view prefix,
                                                   unsigned int types) {
-  std::scoped_lock lock(m_mutex);
+  std::shared_lock lock(m_mutex);
   std::vector<TopicInfo> rv;
   ForEachTopic(m_impl->m_topics, prefix, types, [&](TopicData& topic) {
     rv.emplace_back(topic.GetTopicInfo());
@@ -1429,7 +1585,7 @@ std::vector<TopicInfo> LocalStorage::GetTopicInfo(std::string_view prefix,
 
 std::vector<TopicInfo> LocalStorage::GetTopicInfo(
     std::string_view prefix, std::span<const std::string_view> types) {
-  std::scoped_lock lock(m_mutex);
+  std::shared_lock lock(m_mutex);
   std::vector<TopicInfo> rv;
   ForEachTopic(m_impl->m_topics, prefix, types, [&](TopicData& topic) {
     rv.emplace_back(topic.GetTopicInfo());
@@ -1446,16 +1602,16 @@ NT_Topic LocalStorage::GetTopic(std::string_view name) {
 }
 
 std::string LocalStorage::GetTopicName(NT_Topic topicHandle) {
-  std::scoped_lock lock{m_mutex};
+  std::shared_lock lock{m_mutex};
   if (auto topic = m_impl->m_topics.Get(topicHandle)) {
-    return topic->name;
+    return topic->name.str();
   } else {
     return {};
   }
 }
 
 NT_Type LocalStorage::GetTopicType(NT_Topic topicHandle) {
-  std::scoped_lock lock{m_mutex};
+  std::shared_lock lock{m_mutex};
   if (auto topic = m_impl->m_topics.Get(topicHandle)) {
     return topic->type;
   } else {
@@ -1464,7 +1620,7 @@ NT_Type LocalStorage::GetTopicType(NT_Topic topicHandle) {
 }
 
 std::string LocalStorage::GetTopicTypeString(NT_Topic topicHandle) {
-  std::scoped_lock lock{m_mutex};
+  std::shared_lock lock{m_mutex};
   if (auto topic = m_impl->m_topics.Get(topicHandle)) {
     return topic->typeStr;
   } else {
@@ -1480,7 +1636,7 @@ void LocalStorage::SetTopicPersistent(NT_Topic topicHandle, bool value) {
 }
 
 bool LocalStorage::GetTopicPersistent(NT_Topic topicHandle) {
-  std::scoped_lock lock{m_mutex};
+  std::shared_lock lock{m_mutex};
   if (auto topic = m_impl->m_topics.Get(topicHandle)) {
     return (topic->flags & NT_PERSISTENT) != 0;
   } else {
@@ -1496,7 +1652,7 @@ void LocalStorage::SetTopicRetained(NT_Topic topicHandle, bool value) {
 }
 
 bool LocalStorage::GetTopicRetained(NT_Topic topicHandle) {
-  std::scoped_lock lock{m_mutex};
+  std::shared_lock lock{m_mutex};
   if (auto topic = m_impl->m_topics.Get(topicHandle)) {
     return (topic->flags & NT_RETAINED) != 0;
   } else {
@@ -1505,14 +1661,14 @@ bool LocalStorage::GetTopicRetained(NT_Topic topicHandle) {
 }
 
 bool LocalStorage::GetTopicExists(NT_Handle handle) {
-  std::scoped_lock lock{m_mutex};
+  std::shared_lock lock{m_mutex};
   TopicData* topic = m_impl->GetTopic(handle);
   return topic && topic->Exists();
 }
 
 wpi::json LocalStorage::GetTopicProperty(NT_Topic topicHandle,
                                          std::string_view name) {
-  std::scoped_lock lock{m_mutex};
+  std::shared_lock lock{m_mutex};
   if (auto topic = m_impl->m_topics.Get(topicHandle)) {
     return topic->properties.value(name, wpi::json{});
   } else {
@@ -1547,7 +1703,7 @@ void LocalStorage::DeleteTopicProperty(NT_Topic topicHandle,
 }
 
 wpi::json LocalStorage::GetTopicProperties(NT_Topic topicHandle) {
-  std::scoped_lock lock{m_mutex};
+  std::shared_lock lock{m_mutex};
   if (auto topic = m_impl->m_topics.Get(topicHandle)) {
     return topic->properties;
   } else {
@@ -1570,7 +1726,7 @@ bool LocalStorage::SetTopicProperties(NT_Topic topicHandle,
 }
 
 TopicInfo LocalStorage::GetTopicInfo(NT_Topic topicHandle) {
-  std::scoped_lock lock{m_mutex};
+  std::shared_lock lock{m_mutex};
   if (auto topic = m_impl->m_topics.Get(topicHandle)) {
     return topic->GetTopicInfo();
   } else {
@@ -1730,7 +1886,7 @@ void LocalStorage::Release(NT_Handle pubsubentryHandle) {
 }
 
 NT_Topic LocalStorage::GetTopicFromHandle(NT_Handle pubsubentryHandle) {
-  std::scoped_lock lock{m_mutex};
+  std::shared_lock lock{m_mutex};
   if (auto topic = m_impl->GetTopic(pubsubentryHandle)) {
     return topic->handle;
   } else {
@@ -1739,7 +1895,24 @@ NT_Topic LocalStorage::GetTopicFromHandle(NT_Handle pubsubentryHandle) {
 }
 
 bool LocalStorage::SetEntryValue(NT_Handle pubentryHandle, const Value& value) {
-  std::scoped_lock lock{m_mutex};
+  std::unique_lock lock{m_mutex, std::try_to_lock};
+  if (!lock.owns_lock()) {
+    // another thread holds the storage mutex; queue the value on the
+    // lock-free path rather than stalling the publisher.  The holder drains
+    // the queue in publish order when it releases the mutex (see
+    // StorageMutex::unlock()).  Note this optimistically reports success; a
+    // type mismatch is caught at drain time.
+    if (m_impl->EnqueuePendingValue(pubentryHandle, value)) {
+      // the holder may have released between the failed try_lock above and
+      // the enqueue; if the mutex is free now, this thread must drain itself
+      if (lock.try_lock()) {
+        m_impl->DrainPendingValues();
+      }
+      return true;
+    }
+    lock.lock();
+  }
+  m_impl->DrainPendingValues();
   return m_impl->SetEntryValue(pubentryHandle, value);
 }
 
@@ -1917,6 +2090,39 @@ std::vector<Value> LocalStorage::ReadQueueValue(NT_Handle subentry) {
   return rv;
 }
 
+std::shared_ptr<LatestValueCell> LocalStorage::GetLatestValueCell(
+    NT_Handle subentry) {
+  std::scoped_lock lock{m_mutex};
+  auto subscriber = m_impl->GetSubEntry(subentry);
+  if (!subscriber) {
+    return nullptr;
+  }
+  auto topic = subscriber->topic;
+  if (!topic->latestCell) {
+    topic->latestCell = std::make_shared<LatestValueCell>();
+    if (topic->lastValue) {
+      WriteLatestCell(*topic->latestCell, topic->lastValue);
+    }
+  }
+  return topic->latestCell;
+}
+
+size_t LocalStorage::ReadQueueValue(NT_Handle subentry,
+                                    std::vector<Value>* out) {
+  std::scoped_lock lock{m_mutex};
+  out->clear();
+  auto subscriber = m_impl->GetSubEntry(subentry);
+  if (!subscriber) {
+    return 0;
+  }
+  out->reserve(subscriber->pollStorage.size());
+  for (auto&& val : subscriber->pollStorage) {
+    out->emplace_back(std::move(val));
+  }
+  subscriber->pollStorage.reset();
+  return out->size();
+}
+
 std::vector<TimestampedBoolean> LocalStorage::ReadQueueBoolean(
     NT_Handle subentry) {
   std::scoped_lock lock{m_mutex};
@@ -2061,7 +2267,7 @@ void LocalStorage::SetEntryFlags(NT_Entry entryHandle, unsigned int flags) {
 }
 
 unsigned int LocalStorage::GetEntryFlags(NT_Entry entryHandle) {
-  std::scoped_lock lock{m_mutex};
+  std::shared_lock lock{m_mutex};
   if (auto entry = m_impl->m_entries.Get(entryHandle)) {
     return entry->subscriber->topic->flags;
   } else {
@@ -2101,7 +2307,7 @@ NT_Entry LocalStorage::GetEntry(std::string_view name) {
 std::string LocalStorage::GetEntryName(NT_Handle subentryHandle) {
   std::scoped_lock lock{m_mutex};
   if (auto subscriber = m_impl->GetSubEntry(subentryHandle)) {
-    return subscriber->topic->name;
+    return subscriber->topic->name.str();
   } else {
     return {};
   }
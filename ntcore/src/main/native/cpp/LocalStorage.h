@@ -8,6 +8,7 @@
 
 #include <functional>
 #include <memory>
+#include <shared_mutex>
 #include <span>
 #include <string>
 #include <string_view>
@@ -162,6 +163,13 @@ class LocalStorage final : public net::ILocalStorage {
 
   std::vector<Value> ReadQueueValue(NT_Handle subentry);
 
+  // Caller-provided buffer variant: clears and fills *out and returns the
+  // number of values read.  Reusing the same buffer across polls makes
+  // steady-state queue reads allocation-free.
+  size_t ReadQueueValue(NT_Handle subentry, std::vector<Value>* out);
+
+  std::shared_ptr<LatestValueCell> GetLatestValueCell(NT_Handle subentry);
+
   std::vector<TimestampedBoolean> ReadQueueBoolean(NT_Handle subentry);
   std::vector<TimestampedInteger> ReadQueueInteger(NT_Handle subentry);
   std::vector<TimestampedFloat> ReadQueueFloat(NT_Handle subentry);
@@ -213,7 +221,31 @@ class LocalStorage final : public net::ILocalStorage {
   class Impl;
   std::unique_ptr<Impl> m_impl;
 
-  wpi::mutex m_mutex;
+  // shared_mutex wrapper that drains the pending value queue before each
+  // exclusive release (and opportunistically after shared releases).  This
+  // guarantees a value enqueued on the lock-free publish path while the
+  // mutex was held is delivered once the holder releases, even if no
+  // further locked operation ever occurs.
+  class StorageMutex {
+   public:
+    explicit StorageMutex(LocalStorage& storage) : m_storage{storage} {}
+
+    void lock() { m_mutex.lock(); }
+    bool try_lock() { return m_mutex.try_lock(); }
+    void unlock();
+
+    void lock_shared() { m_mutex.lock_shared(); }
+    void unlock_shared();
+
+   private:
+    LocalStorage& m_storage;
+    std::shared_mutex m_mutex;
+  };
+
+  // read-mostly handle getters take this shared; anything that can mutate
+  // storage state (including paths that drain the pending value queue) takes
+  // it exclusive
+  StorageMutex m_mutex{*this};
 };
 
 }  // namespace nt
@@ -13,6 +13,8 @@
 #include <fmt/format.h>
 #include <wpi/SmallString.h>
 #include <wpi/StringExtras.h>
+#include <wpi/mutex.h>
+#include <wpi/timestamp.h>
 #include <wpinet/DsClient.h>
 #include <wpinet/EventLoopRunner.h>
 #include <wpinet/HttpUtil.h>
@@ -27,6 +29,7 @@
 #include "IConnectionList.h"
 #include "Log.h"
 #include "net/ClientImpl.h"
+#include "net/ClockSync.h"
 #include "net/Message.h"
 #include "net/NetworkLoopQueue.h"
 #include "net/WebSocketConnection.h"
@@ -41,13 +44,29 @@ static constexpr uv::Timer::Time kWebsocketHandshakeTimeout{500};
 // use a larger max message size for websockets
 static constexpr size_t kMaxMessageSize = 2 * 1024 * 1024;
 
+// All client instances in the process share one event loop (and thus one
+// socket thread); each instance keeps its own storage, connection, and
+// handles on that loop.  The runner is reference counted so it's started on
+// first use and torn down when the last client is destroyed.
+static std::shared_ptr<wpi::EventLoopRunner> AcquireLoopRunner() {
+  static wpi::mutex mutex;
+  static std::weak_ptr<wpi::EventLoopRunner> weakRunner;
+  std::scoped_lock lock{mutex};
+  auto runner = weakRunner.lock();
+  if (!runner) {
+    runner = std::make_shared<wpi::EventLoopRunner>();
+    weakRunner = runner;
+  }
+  return runner;
+}
+
 namespace {
 
 class NCImpl {
  public:
   NCImpl(int inst, std::string_view id, net::ILocalStorage& localStorage,
          IConnectionList& connList, wpi::Logger& logger);
-  virtual ~NCImpl() = default;
+  virtual ~NCImpl();
 
   // user-facing functions
   void SetServers(std::span<const std::pair<std::string, unsigned int>> servers,
@@ -58,6 +77,10 @@ class NCImpl {
   virtual void TcpConnected(uv::Tcp& tcp) = 0;
   virtual void Disconnect(std::string_view reason);
 
+  // closes all of this instance's handles on the shared loop; must be called
+  // from the loop, and is idempotent
+  void CloseLoopHandles();
+
   // invariants
   int m_inst;
   net::ILocalStorage& m_localStorage;
@@ -69,8 +92,10 @@ class NCImpl {
   std::shared_ptr<wpi::ParallelTcpConnector> m_parallelConnect;
   std::shared_ptr<uv::Timer> m_readLocalTimer;
   std::shared_ptr<uv::Timer> m_sendValuesTimer;
+  std::shared_ptr<uv::Timer> m_reconnectTimer;
   std::shared_ptr<uv::Async<>> m_flushLocal;
   std::shared_ptr<uv::Async<>> m_flush;
+  bool m_shutdown = false;
 
   std::vector<net::ClientMessage> m_localMsgs;
 
@@ -87,7 +112,7 @@ class NCImpl {
 
   int m_connHandle = 0;
 
-  wpi::EventLoopRunner m_loopRunner;
+  std::shared_ptr<wpi::EventLoopRunner> m_loopRunner;
   uv::Loop& m_loop;
 };
 
@@ -118,6 +143,10 @@ class NCImpl4 : public NCImpl {
 
   std::shared_ptr<net::WebSocketConnection> m_wire;
   std::unique_ptr<net::ClientImpl> m_clientImpl;
+
+  // owned here rather than by the connection so time sync queries have a
+  // stable object to read across connection churn; internally thread-safe
+  net::ClockSync m_clockSync;
 };
 
 }  // namespace
@@ -130,12 +159,55 @@ NCImpl::NCImpl(int inst, std::string_view id, net::ILocalStorage& localStorage,
       m_logger{logger},
       m_id{id},
       m_localQueue{logger},
-      m_loop{*m_loopRunner.GetLoop()} {
+      m_loopRunner{AcquireLoopRunner()},
+      m_loop{*m_loopRunner->GetLoop()} {
   m_localMsgs.reserve(net::NetworkLoopQueue::kInitialQueueSize);
 
   INFO("starting network client");
 }
 
+NCImpl::~NCImpl() {
+  // normally a no-op; the derived destructor already closed everything in a
+  // single loop pass (see NCImpl3/NCImpl4)
+  m_loopRunner->ExecSync([this](uv::Loop&) { CloseLoopHandles(); });
+}
+
+void NCImpl::CloseLoopHandles() {
+  // the loop is shared with other instances, so rather than stopping it,
+  // explicitly close this instance's handles; Close() guarantees no further
+  // callbacks (which capture this) are invoked
+  m_flushAtomic = nullptr;
+  m_flushLocalAtomic = nullptr;
+  if (m_dsClient) {
+    m_dsClient->Close();
+    m_dsClient.reset();
+  }
+  if (m_parallelConnect) {
+    m_parallelConnect->Close();
+    m_parallelConnect.reset();
+  }
+  if (m_readLocalTimer) {
+    m_readLocalTimer->Close();
+    m_readLocalTimer.reset();
+  }
+  if (m_sendValuesTimer) {
+    m_sendValuesTimer->Close();
+    m_sendValuesTimer.reset();
+  }
+  if (m_reconnectTimer) {
+    m_reconnectTimer->Close();
+    m_reconnectTimer.reset();
+  }
+  if (m_flush) {
+    m_flush->Close();
+    m_flush.reset();
+  }
+  if (m_flushLocal) {
+    m_flushLocal->Close();
+    m_flushLocal.reset();
+  }
+}
+
 void NCImpl::SetServers(
     std::span<const std::pair<std::string, unsigned int>> servers,
     unsigned int defaultPort) {
@@ -146,7 +218,7 @@ void NCImpl::SetServers(
                              server.second == 0 ? defaultPort : server.second);
   }
 
-  m_loopRunner.ExecAsync(
+  m_loopRunner->ExecAsync(
       [this, servers = std::move(serversCopy)](uv::Loop&) mutable {
         m_servers = std::move(servers);
         if (m_dsClientServer.first.empty()) {
@@ -156,7 +228,7 @@ void NCImpl::SetServers(
 }
 
 void NCImpl::StartDSClient(unsigned int port) {
-  m_loopRunner.ExecAsync([=, this](uv::Loop& loop) {
+  m_loopRunner->ExecAsync([=, this](uv::Loop& loop) {
     if (m_dsClient) {
       return;
     }
@@ -174,7 +246,7 @@ void NCImpl::StartDSClient(unsigned int port) {
 }
 
 void NCImpl::StopDSClient() {
-  m_loopRunner.ExecAsync([this](uv::Loop& loop) {
+  m_loopRunner->ExecAsync([this](uv::Loop& loop) {
     if (m_dsClient) {
       m_dsClient->Close();
       m_dsClient.reset();
@@ -183,6 +255,9 @@ void NCImpl::StopDSClient() {
 }
 
 void NCImpl::Disconnect(std::string_view reason) {
+  if (m_shutdown) {
+    return;
+  }
   if (m_readLocalTimer) {
     m_readLocalTimer->Stop();
   }
@@ -192,16 +267,24 @@ void NCImpl::Disconnect(std::string_view reason) {
   m_connList.RemoveConnection(m_connHandle);
   m_connHandle = 0;
 
-  // start trying to connect again
-  uv::Timer::SingleShot(m_loop, kReconnectRate,
-                        [this] { m_parallelConnect->Disconnected(); });
+  // start trying to connect again; the timer is kept as a member (rather
+  // than using SingleShot) so it can be closed if the instance is destroyed
+  // before it fires
+  if (!m_reconnectTimer) {
+    m_reconnectTimer = uv::Timer::Create(m_loop);
+    m_reconnectTimer->timeout.connect([this] {
+      m_reconnectTimer->Stop();
+      m_parallelConnect->Disconnected();
+    });
+  }
+  m_reconnectTimer->Start(kReconnectRate);
 }
 
 NCImpl3::NCImpl3(int inst, std::string_view id,
                  net::ILocalStorage& localStorage, IConnectionList& connList,
                  wpi::Logger& logger)
     : NCImpl{inst, id, localStorage, connList, logger} {
-  m_loopRunner.ExecAsync([this](uv::Loop& loop) {
+  m_loopRunner->ExecAsync([this](uv::Loop& loop) {
     m_parallelConnect = wpi::ParallelTcpConnector::Create(
         loop, kReconnectRate, m_logger,
         [this](uv::Tcp& tcp) { TcpConnected(tcp); });
@@ -231,13 +314,23 @@ NCImpl3::NCImpl3(int inst, std::string_view id,
 }
 
 NCImpl3::~NCImpl3() {
-  // must explicitly destroy these on loop
-  m_loopRunner.ExecSync([&](auto&) {
+  // must explicitly destroy these on loop; the shared loop keeps running for
+  // other instances, so also detach our socket callbacks (which capture
+  // this) and close the socket rather than relying on loop teardown
+  m_loopRunner->ExecSync([&](auto&) {
+    m_shutdown = true;
+    auto wire = std::move(m_wire);
     m_clientImpl.reset();
-    m_wire.reset();
+    if (wire) {
+      auto& stream = wire->GetStream();
+      stream.error.disconnect_all();
+      stream.end.disconnect_all();
+      stream.closed.disconnect_all();
+      stream.data.disconnect_all();
+      wire->Disconnect("instance destroyed");
+    }
+    CloseLoopHandles();
   });
-  // shut down loop here to avoid race
-  m_loopRunner.Stop();
 }
 
 void NCImpl3::HandleLocal() {
@@ -331,7 +424,7 @@ NCImpl4::NCImpl4(int inst, std::string_view id,
                  net::ILocalStorage& localStorage, IConnectionList& connList,
                  wpi::Logger& logger)
     : NCImpl{inst, id, localStorage, connList, logger} {
-  m_loopRunner.ExecAsync([this](uv::Loop& loop) {
+  m_loopRunner->ExecAsync([this](uv::Loop& loop) {
     m_parallelConnect = wpi::ParallelTcpConnector::Create(
         loop, kReconnectRate, m_logger,
         [this](uv::Tcp& tcp) { TcpConnected(tcp); });
@@ -370,13 +463,23 @@ NCImpl4::NCImpl4(int inst, std::string_view id,
 }
 
 NCImpl4::~NCImpl4() {
-  // must explicitly destroy these on loop
-  m_loopRunner.ExecSync([&](auto&) {
+  // must explicitly destroy these on loop; the shared loop keeps running for
+  // other instances, so also detach our socket callbacks (which capture
+  // this) and close the socket rather than relying on loop teardown
+  m_loopRunner->ExecSync([&](auto&) {
+    m_shutdown = true;
+    auto wire = std::move(m_wire);
     m_clientImpl.reset();
-    m_wire.reset();
+    if (wire) {
+      auto& ws = wire->GetWebSocket();
+      ws.closed.disconnect_all();
+      ws.text.disconnect_all();
+      ws.binary.disconnect_all();
+      wire->Disconnect("instance destroyed");
+      ws.GetStream().Close();
+    }
+    CloseLoopHandles();
   });
-  // shut down loop here to avoid race
-  m_loopRunner.Stop();
 }
 
 void NCImpl4::HandleLocal() {
@@ -423,12 +526,18 @@ void NCImpl4::WsConnected(wpi::WebSocket& ws, uv::Tcp& tcp) {
 
   m_wire = std::make_shared<net::WebSocketConnection>(ws);
   m_clientImpl = std::make_unique<net::ClientImpl>(
-      m_loop.Now().count(), m_inst, *m_wire, m_logger,
+      m_loop.Now().count(), m_inst, *m_wire, m_logger, m_clockSync,
       [this](uint32_t repeatMs) {
         DEBUG4("Setting periodic timer to {}", repeatMs);
         m_sendValuesTimer->Start(uv::Timer::Time{repeatMs},
                                  uv::Timer::Time{repeatMs});
       });
+  // same-host connections aren't subject to the normal transmit rate
+  // limiting; loopback latency is dominated by our own batching delays
+  if (connInfo.remote_ip == "localhost" || connInfo.remote_ip == "127.0.0.1" ||
+      connInfo.remote_ip == "::1") {
+    m_clientImpl->SetSameHost(true);
+  }
   {
     net::ClientStartup startup{*m_clientImpl};
     m_localStorage.StartNetwork(startup, &m_localQueue);
@@ -455,6 +564,7 @@ void NCImpl4::Disconnect(std::string_view reason) {
   INFO("DISCONNECTED NT4 connection: {}", reason);
   m_clientImpl.reset();
   m_wire.reset();
+  m_clockSync.Reset();
   NCImpl::Disconnect(reason);
 }
 
@@ -490,11 +600,11 @@ void NetworkClient::StopDSClient() {
 }
 
 void NetworkClient::FlushLocal() {
-  m_impl->m_loopRunner.ExecAsync([this](uv::Loop&) { m_impl->HandleLocal(); });
+  m_impl->m_loopRunner->ExecAsync([this](uv::Loop&) { m_impl->HandleLocal(); });
 }
 
 void NetworkClient::Flush() {
-  m_impl->m_loopRunner.ExecAsync([this](uv::Loop&) {
+  m_impl->m_loopRunner->ExecAsync([this](uv::Loop&) {
     m_impl->HandleLocal();
     if (m_impl->m_clientImpl) {
       m_impl->m_clientImpl->SendValues(m_impl->m_loop.Now().count());
@@ -502,6 +612,15 @@ void NetworkClient::Flush() {
   });
 }
 
+TimeSyncInfo NetworkClient::GetTimeSyncInfo() {
+  auto& clockSync = m_impl->m_clockSync;
+  if (!clockSync.HaveOffset()) {
+    return {};
+  }
+  int64_t now = wpi::Now();
+  return {clockSync.GetOffset(now), clockSync.GetUncertainty(now), true};
+}
+
 class NetworkClient3::Impl final : public NCImpl3 {
  public:
   Impl(int inst, std::string_view id, net::ILocalStorage& localStorage,
@@ -544,3 +663,8 @@ void NetworkClient3::Flush() {
     async->UnsafeSend();
   }
 }
+
+TimeSyncInfo NetworkClient3::GetTimeSyncInfo() {
+  // the NT3 protocol has no RTT exchange to measure the offset with
+  return {};
+}
@@ -40,6 +40,8 @@ class NetworkClient final : public INetworkClient {
   void FlushLocal() final;
   void Flush() final;
 
+  TimeSyncInfo GetTimeSyncInfo() final;
+
  private:
   class Impl;
   std::unique_ptr<Impl> m_impl;
@@ -61,6 +63,8 @@ class NetworkClient3 final : public INetworkClient {
   void FlushLocal() final;
   void Flush() final;
 
+  TimeSyncInfo GetTimeSyncInfo() final;
+
  private:
   class Impl;
   std::unique_ptr<Impl> m_impl;
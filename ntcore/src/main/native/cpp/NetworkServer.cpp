@@ -11,6 +11,7 @@
 #include <system_error>
 #include <vector>
 
+#include <wpi/MemoryBuffer.h>
 #include <wpi/SmallString.h>
 #include <wpi/StringExtras.h>
 #include <wpi/fs.h>
@@ -102,6 +103,14 @@ class ServerConnection3 : public ServerConnection {
   std::shared_ptr<net3::UvStreamConnection3> m_wire;
 };
 
+// All connections intentionally share one event loop.  ServerImpl is
+// single-threaded by design: processing one client's input fans out writes to
+// every subscribed client's wire, so sharding connections across loops would
+// require either cross-thread socket writes (unsupported by wpi::WebSocket
+// and libuv handles, which are bound to their creating loop) or marshalling
+// every fanout through per-loop queues, serializing on the storage anyway.
+// Per-connection encoding costs are instead kept off the critical path by
+// cached announce encodings, batched text frames, and outgoing coalescing.
 class NSImpl {
  public:
   NSImpl(std::string_view persistFilename, std::string_view listenAddress,
@@ -111,7 +120,9 @@ class NSImpl {
 
   void HandleLocal();
   void LoadPersistent();
-  void SavePersistent(std::string_view filename, std::string_view data);
+  void SavePersistent(std::string_view filename, std::string_view data,
+                      std::string_view snapshot);
+  void AppendJournal(std::string_view filename, std::string_view data);
   void Init();
   void AddConnection(ServerConnection* conn, const ConnectionInfo& info);
   void RemoveConnection(ServerConnection* conn);
@@ -122,6 +133,10 @@ class NSImpl {
   std::function<void()> m_initDone;
   std::string m_persistentData;
   std::string m_persistentFilename;
+  // memory-mapped binary snapshot; loaded in preference to the JSON file
+  std::unique_ptr<wpi::MemoryBuffer> m_snapshotData;
+  // memory-mapped journal of value updates appended after the last full save
+  std::unique_ptr<wpi::MemoryBuffer> m_journalData;
   std::string m_listenAddress;
   unsigned int m_port3;
   unsigned int m_port4;
@@ -129,6 +144,7 @@ class NSImpl {
   // used only from loop
   std::shared_ptr<uv::Timer> m_readLocalTimer;
   std::shared_ptr<uv::Timer> m_savePersistentTimer;
+  size_t m_journalSize{0};  // bytes appended since the last full save
   std::shared_ptr<uv::Async<>> m_flushLocal;
   std::shared_ptr<uv::Async<>> m_flush;
 
@@ -356,8 +372,51 @@ void NSImpl::HandleLocal() {
   m_serverImpl.HandleLocal(m_localMsgs);
 }
 
+static std::string SnapshotFilename(std::string_view persistentFilename) {
+  return fmt::format("{}.snap", persistentFilename);
+}
+
+static std::string JournalFilename(std::string_view persistentFilename) {
+  return fmt::format("{}.jrnl", persistentFilename);
+}
+
+// once the journal grows past this, the next flush does a full rewrite (which
+// truncates the journal) instead of appending further
+static constexpr size_t kMaxJournalSize = 256 * 1024;
+
 void NSImpl::LoadPersistent() {
   std::error_code ec;
+  // prefer the binary snapshot if it is at least as recent as the JSON file;
+  // a hand-edited JSON file always wins
+  auto snapName = SnapshotFilename(m_persistentFilename);
+  auto snapTime = fs::last_write_time(snapName, ec);
+  if (!ec) {
+    auto jsonTime = fs::last_write_time(m_persistentFilename, ec);
+    if (ec || snapTime >= jsonTime) {
+      std::error_code ec2;
+      m_snapshotData = wpi::MemoryBuffer::GetFile(snapName, ec2);
+      if (ec2) {
+        m_snapshotData.reset();
+      }
+    }
+  }
+  // the journal holds value updates appended after the last full save;
+  // it is replayed over whichever base file is loaded unless the JSON file
+  // was hand-edited more recently
+  auto jrnlName = JournalFilename(m_persistentFilename);
+  ec = {};
+  auto jrnlTime = fs::last_write_time(jrnlName, ec);
+  if (!ec) {
+    auto jsonTime = fs::last_write_time(m_persistentFilename, ec);
+    if (ec || jrnlTime >= jsonTime) {
+      std::error_code ec2;
+      m_journalData = wpi::MemoryBuffer::GetFile(jrnlName, ec2);
+      if (ec2) {
+        m_journalData.reset();
+      }
+    }
+  }
+  ec = {};
   auto size = fs::file_size(m_persistentFilename, ec);
   wpi::raw_fd_istream is{m_persistentFilename, ec};
   if (ec.value() != 0) {
@@ -373,7 +432,8 @@ void NSImpl::LoadPersistent() {
   }
 }
 
-void NSImpl::SavePersistent(std::string_view filename, std::string_view data) {
+void NSImpl::SavePersistent(std::string_view filename, std::string_view data,
+                            std::string_view snapshot) {
   // write to temporary file
   auto tmp = fmt::format("{}.tmp", filename);
   std::error_code ec;
@@ -398,14 +458,67 @@ void NSImpl::SavePersistent(std::string_view filename, std::string_view data) {
   if (ec.value() != 0) {
     // attempt to restore backup
     fs::rename(bak, filename, ec);
+    return;
+  }
+
+  // write the binary snapshot alongside (after the JSON file, so it is
+  // never newer than a JSON write that failed)
+  if (!snapshot.empty()) {
+    auto snapName = SnapshotFilename(filename);
+    auto snapTmp = fmt::format("{}.tmp", snapName);
+    wpi::raw_fd_ostream sos{snapTmp, ec, fs::F_None};
+    if (ec.value() != 0) {
+      return;
+    }
+    sos << snapshot;
+    sos.close();
+    if (sos.has_error()) {
+      fs::remove(snapTmp);
+      return;
+    }
+    fs::rename(snapTmp, snapName, ec);
+  }
+
+  // a full save subsumes any journaled updates
+  fs::remove(JournalFilename(filename), ec);
+}
+
+void NSImpl::AppendJournal(std::string_view filename, std::string_view data) {
+  std::error_code ec;
+  wpi::raw_fd_ostream os{filename, ec, fs::CD_OpenAlways, fs::FA_Write,
+                         fs::OF_Append};
+  if (ec.value() != 0) {
+    INFO("could not open persistent journal '{}' for append: {}", filename,
+         ec.message());
+    return;
   }
+  os << data;
+  os.close();
 }
 
 void NSImpl::Init() {
-  auto errs = m_serverImpl.LoadPersistent(m_persistentData);
-  if (!errs.empty()) {
-    WARNING("error reading persistent file: {}", errs);
+  bool loaded = false;
+  if (m_snapshotData) {
+    loaded = m_serverImpl.LoadPersistentSnapshot(m_snapshotData->GetBuffer());
+    if (!loaded) {
+      WARNING("could not load persistent snapshot, using persistent file");
+    }
+    m_snapshotData.reset();
+  }
+  if (!loaded) {
+    auto errs = m_serverImpl.LoadPersistent(m_persistentData);
+    if (!errs.empty()) {
+      WARNING("error reading persistent file: {}", errs);
+    }
+  }
+  if (m_journalData) {
+    // replay value updates journaled after the last full save; count the
+    // existing journal bytes so appends still trigger compaction at the cap
+    m_serverImpl.LoadPersistentJournal(m_journalData->GetBuffer());
+    m_journalSize = m_journalData->GetBuffer().size();
+    m_journalData.reset();
   }
+  m_persistentData.clear();
 
   // set up timers
   m_readLocalTimer = uv::Timer::Create(m_loop);
@@ -417,11 +530,25 @@ void NSImpl::Init() {
 
   m_savePersistentTimer = uv::Timer::Create(m_loop);
   m_savePersistentTimer->timeout.connect([this] {
-    if (m_serverImpl.PersistentChanged()) {
+    if (m_serverImpl.PersistentChanged() || m_journalSize >= kMaxJournalSize) {
+      // the topic set or properties changed (or the journal grew too large):
+      // rewrite the full files, which also truncates the journal
+      m_journalSize = 0;
+      uv::QueueWork(
+          m_loop,
+          [this, fn = m_persistentFilename, data = m_serverImpl.DumpPersistent(),
+           snapshot = m_serverImpl.DumpPersistentSnapshot()] {
+            SavePersistent(fn, data, snapshot);
+          },
+          nullptr);
+    } else if (auto journal = m_serverImpl.DumpPersistentJournal();
+               !journal.empty()) {
+      // steady-state value updates only cost a journal append
+      m_journalSize += journal.size();
       uv::QueueWork(
           m_loop,
-          [this, fn = m_persistentFilename,
-           data = m_serverImpl.DumpPersistent()] { SavePersistent(fn, data); },
+          [this, fn = JournalFilename(m_persistentFilename),
+           journal = std::move(journal)] { AppendJournal(fn, journal); },
           nullptr);
     }
   });
@@ -567,3 +694,16 @@ void NetworkServer::Flush() {
     async->UnsafeSend();
   }
 }
+
+void NetworkServer::StartDataLog(wpi::log::DataLog& log,
+                                 std::string_view prefix,
+                                 std::string_view logPrefix) {
+  m_impl->m_loopRunner.ExecSync([&](auto&) {
+    m_impl->m_serverImpl.StartDataLog(log, prefix, logPrefix);
+  });
+}
+
+void NetworkServer::StopDataLog() {
+  m_impl->m_loopRunner.ExecSync(
+      [&](auto&) { m_impl->m_serverImpl.StopDataLog(); });
+}
@@ -14,6 +14,10 @@ namespace wpi {
 class Logger;
 }  // namespace wpi
 
+namespace wpi::log {
+class DataLog;
+}  // namespace wpi::log
+
 namespace nt::net {
 class ILocalStorage;
 }  // namespace nt::net
@@ -34,6 +38,11 @@ class NetworkServer {
   void FlushLocal();
   void Flush();
 
+  // in-process data log bridge; marshalled onto the server loop thread
+  void StartDataLog(wpi::log::DataLog& log, std::string_view prefix,
+                    std::string_view logPrefix);
+  void StopDataLog();
+
  private:
   class Impl;
   std::unique_ptr<Impl> m_impl;
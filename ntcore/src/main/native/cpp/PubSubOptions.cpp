@@ -29,6 +29,11 @@ nt::PubSubOptions::PubSubOptions(std::span<const PubSubOption> options) {
       case NT_PUBSUB_POLLSTORAGE:
         pollStorageSize = static_cast<size_t>(option.value);
         break;
+      case NT_PUBSUB_COALESCE:
+        if (option.value > 1) {
+          serverCoalesce = static_cast<size_t>(option.value);
+        }
+        break;
       default:
         break;
     }
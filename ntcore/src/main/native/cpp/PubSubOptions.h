@@ -22,6 +22,10 @@ class PubSubOptions {
   bool topicsOnly = false;
   bool prefixMatch = false;
   bool keepDuplicates = false;
+  // internal: remote subscriber advertised it can decode delta-encoded values
+  bool deltaCapable = false;
+  // server keeps the newest N samples per period window (0 = only the latest)
+  size_t serverCoalesce = 0;
 };
 
 }  // namespace nt
@@ -8,6 +8,7 @@
 #include <span>
 
 #include <wpi/MemAlloc.h>
+#include <wpi/ObjectPool.h>
 #include <wpi/timestamp.h>
 
 #include "Value_internal.h"
@@ -31,6 +32,16 @@ struct StringArrayStorage {
   std::vector<std::string> strings;
   std::vector<NT_String> ntStrings;
 };
+
+// Array values are created at the subscriber poll rate, so their payload
+// vectors are recycled through a pool instead of hitting the allocator each
+// time; an updated value of the same type typically reuses the previous
+// buffer's capacity outright.
+template <typename T>
+std::shared_ptr<std::vector<T>> AcquireArrayStorage() {
+  static auto pool = wpi::ObjectPool<std::vector<T>>::Create();
+  return pool->Acquire();
+}
 }  // namespace
 
 void StringArrayStorage::InitNtStrings() {
@@ -71,9 +82,8 @@ Value::Value(NT_Type type, int64_t time, int64_t serverTime,
 
 Value Value::MakeBooleanArray(std::span<const bool> value, int64_t time) {
   Value val{NT_BOOLEAN_ARRAY, time, private_init{}};
-  auto data = std::make_shared<std::vector<int>>(value.begin(), value.end());
-  // data->reserve(value.size());
-  // std::copy(value.begin(), value.end(), *data);
+  auto data = AcquireArrayStorage<int>();
+  data->assign(value.begin(), value.end());
   val.m_val.data.arr_boolean.arr = data->data();
   val.m_val.data.arr_boolean.size = data->size();
   val.m_storage = std::move(data);
@@ -82,7 +92,8 @@ Value Value::MakeBooleanArray(std::span<const bool> value, int64_t time) {
 
 Value Value::MakeBooleanArray(std::span<const int> value, int64_t time) {
   Value val{NT_BOOLEAN_ARRAY, time, private_init{}};
-  auto data = std::make_shared<std::vector<int>>(value.begin(), value.end());
+  auto data = AcquireArrayStorage<int>();
+  data->assign(value.begin(), value.end());
   val.m_val.data.arr_boolean.arr = data->data();
   val.m_val.data.arr_boolean.size = data->size();
   val.m_storage = std::move(data);
@@ -91,8 +102,8 @@ Value Value::MakeBooleanArray(std::span<const int> value, int64_t time) {
 
 Value Value::MakeIntegerArray(std::span<const int64_t> value, int64_t time) {
   Value val{NT_INTEGER_ARRAY, time, private_init{}};
-  auto data =
-      std::make_shared<std::vector<int64_t>>(value.begin(), value.end());
+  auto data = AcquireArrayStorage<int64_t>();
+  data->assign(value.begin(), value.end());
   val.m_val.data.arr_int.arr = data->data();
   val.m_val.data.arr_int.size = data->size();
   val.m_storage = std::move(data);
@@ -101,7 +112,8 @@ Value Value::MakeIntegerArray(std::span<const int64_t> value, int64_t time) {
 
 Value Value::MakeFloatArray(std::span<const float> value, int64_t time) {
   Value val{NT_FLOAT_ARRAY, time, private_init{}};
-  auto data = std::make_shared<std::vector<float>>(value.begin(), value.end());
+  auto data = AcquireArrayStorage<float>();
+  data->assign(value.begin(), value.end());
   val.m_val.data.arr_float.arr = data->data();
   val.m_val.data.arr_float.size = data->size();
   val.m_storage = std::move(data);
@@ -110,7 +122,8 @@ Value Value::MakeFloatArray(std::span<const float> value, int64_t time) {
 
 Value Value::MakeDoubleArray(std::span<const double> value, int64_t time) {
   Value val{NT_DOUBLE_ARRAY, time, private_init{}};
-  auto data = std::make_shared<std::vector<double>>(value.begin(), value.end());
+  auto data = AcquireArrayStorage<double>();
+  data->assign(value.begin(), value.end());
   val.m_val.data.arr_double.arr = data->data();
   val.m_val.data.arr_double.size = data->size();
   val.m_storage = std::move(data);
@@ -120,8 +120,10 @@ JNIEXPORT void JNICALL JNI_OnUnload(JavaVM* vm, void* reserved) {
 static std::span<const nt::PubSubOption> FromJavaPubSubOptions(
     JNIEnv* env, jintArray optionTypes, jdoubleArray optionValues,
     wpi::SmallVectorImpl<nt::PubSubOption>& arr) {
-  JIntArrayRef types{env, optionTypes};
-  JDoubleArrayRef values{env, optionValues};
+  // pinned rather than copied; released before return, after the copy into
+  // arr below
+  CriticalJIntArrayRef types{env, optionTypes};
+  CriticalJDoubleArrayRef values{env, optionValues};
   if (types.size() != values.size()) {
     return {};
   }
@@ -138,22 +140,14 @@ static std::span<const nt::PubSubOption> FromJavaPubSubOptions(
 //
 
 static jobject MakeJObject(JNIEnv* env, const nt::Value& value) {
-  static jmethodID booleanConstructor = nullptr;
-  static jmethodID doubleConstructor = nullptr;
-  static jmethodID floatConstructor = nullptr;
-  static jmethodID longConstructor = nullptr;
-  if (!booleanConstructor) {
-    booleanConstructor = env->GetMethodID(booleanCls, "<init>", "(Z)V");
-  }
-  if (!doubleConstructor) {
-    doubleConstructor = env->GetMethodID(doubleCls, "<init>", "(D)V");
-  }
-  if (!floatConstructor) {
-    floatConstructor = env->GetMethodID(floatCls, "<init>", "(F)V");
-  }
-  if (!longConstructor) {
-    longConstructor = env->GetMethodID(longCls, "<init>", "(J)V");
-  }
+  static jmethodID booleanConstructor =
+      env->GetMethodID(booleanCls, "<init>", "(Z)V");
+  static jmethodID doubleConstructor =
+      env->GetMethodID(doubleCls, "<init>", "(D)V");
+  static jmethodID floatConstructor =
+      env->GetMethodID(floatCls, "<init>", "(F)V");
+  static jmethodID longConstructor =
+      env->GetMethodID(longCls, "<init>", "(J)V");
 
   switch (value.type()) {
     case NT_BOOLEAN:
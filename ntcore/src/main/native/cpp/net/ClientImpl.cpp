@@ -11,10 +11,12 @@
 
 #include <fmt/format.h>
 #include <wpi/DenseMap.h>
+#include <wpi/Endian.h>
 #include <wpi/Logger.h>
 #include <wpi/raw_ostream.h>
 #include <wpi/timestamp.h>
 
+#include "ClockSync.h"
 #include "Handle.h"
 #include "Log.h"
 #include "Message.h"
@@ -50,7 +52,7 @@ struct PublisherData {
 class CImpl : public ServerMessageHandler {
  public:
   CImpl(uint64_t curTimeMs, int inst, WireConnection& wire, wpi::Logger& logger,
-        std::function<void(uint32_t repeatMs)> setPeriodic);
+        ClockSync& clockSync, std::function<void(uint32_t repeatMs)> setPeriodic);
 
   void ProcessIncomingBinary(std::span<const uint8_t> data);
   void HandleLocal(std::vector<ClientMessage>&& msgs);
@@ -58,6 +60,10 @@ class CImpl : public ServerMessageHandler {
   void SendValues(uint64_t curTimeMs);
   bool CheckNetworkReady();
 
+  // effective minimum period; same-host connections are not rate limited to
+  // the normal wire minimum since loopback latency is dominated by batching
+  uint32_t MinPeriodMs() const { return m_sameHost ? 1 : kMinPeriodMs; }
+
   // ServerMessageHandler interface
   void ServerAnnounce(std::string_view name, int64_t id,
                       std::string_view typeStr, const wpi::json& properties,
@@ -83,33 +89,45 @@ class CImpl : public ServerMessageHandler {
 
   // indexed by server-provided topic id
   wpi::DenseMap<int64_t, NT_Topic> m_topicMap;
+  // last full value for topics announced with the delta property
+  wpi::DenseMap<int64_t, Value> m_deltaValues;
 
-  // timestamp handling
+  // timestamp handling; pings are sent at a short interval until the clock
+  // sync filter's sample window fills, then drop back to the steady-state
+  // interval (the filter's drift estimate keeps the offset accurate between
+  // pings)
   static constexpr uint32_t kPingIntervalMs = 3000;
+  static constexpr uint32_t kPingBurstIntervalMs = 500;
   uint64_t m_nextPingTimeMs{0};
-  uint32_t m_rtt2Us{UINT32_MAX};
   bool m_haveTimeOffset{false};
   int64_t m_serverTimeOffsetUs{0};
+  ClockSync& m_clockSync;
 
   // periodic sweep handling
   uint32_t m_periodMs{kPingIntervalMs + 10};
   uint64_t m_lastSendMs{0};
+  bool m_sameHost{false};
   int m_notReadyCount{0};
 
   // outgoing queue
   std::vector<ClientMessage> m_outgoing;
+
+  // reusable batch encode buffer for the outgoing queue
+  WireEncodeBuffer m_batchBuf;
 };
 
 }  // namespace
 
 CImpl::CImpl(uint64_t curTimeMs, int inst, WireConnection& wire,
-             wpi::Logger& logger,
+             wpi::Logger& logger, ClockSync& clockSync,
              std::function<void(uint32_t repeatMs)> setPeriodic)
     : m_inst{inst},
       m_wire{wire},
       m_logger{logger},
       m_setPeriodic{std::move(setPeriodic)},
-      m_nextPingTimeMs{curTimeMs + kPingIntervalMs} {
+      m_nextPingTimeMs{curTimeMs + kPingBurstIntervalMs},
+      m_clockSync{clockSync} {
+  m_clockSync.Reset();
   // immediately send RTT ping
   auto out = m_wire.SendBinary();
   auto now = wpi::Now();
@@ -119,6 +137,54 @@ CImpl::CImpl(uint64_t curTimeMs, int inst, WireConnection& wire,
   m_setPeriodic(m_periodMs);
 }
 
+// reconstructs a full value from a delta patch blob (see kBinaryDeltaType);
+// returns false if the patch does not apply to the base value
+static bool ApplyValueDelta(const Value& base, Value* patch) {
+  if (base.type() != NT_STRING && base.type() != NT_RAW) {
+    return false;
+  }
+  auto blob = patch->GetRaw();
+  if (blob.size() < 8) {
+    return false;
+  }
+  uint32_t prefixLen = wpi::support::endian::read32be(blob.data());
+  uint32_t suffixLen = wpi::support::endian::read32be(blob.data() + 4);
+  auto middle = blob.subspan(8);
+  std::span<const uint8_t> baseBytes;
+  if (base.type() == NT_STRING) {
+    auto str = base.GetString();
+    baseBytes = {reinterpret_cast<const uint8_t*>(str.data()), str.size()};
+  } else {
+    baseBytes = base.GetRaw();
+  }
+  if (static_cast<uint64_t>(prefixLen) + suffixLen > baseBytes.size()) {
+    return false;
+  }
+  Value full;
+  if (base.type() == NT_STRING) {
+    std::string str;
+    str.reserve(prefixLen + middle.size() + suffixLen);
+    str.append(reinterpret_cast<const char*>(baseBytes.data()), prefixLen);
+    str.append(reinterpret_cast<const char*>(middle.data()), middle.size());
+    str.append(
+        reinterpret_cast<const char*>(baseBytes.data() + baseBytes.size() -
+                                      suffixLen),
+        suffixLen);
+    full = Value::MakeString(std::move(str), 1);
+  } else {
+    std::vector<uint8_t> buf;
+    buf.reserve(prefixLen + middle.size() + suffixLen);
+    buf.insert(buf.end(), baseBytes.begin(), baseBytes.begin() + prefixLen);
+    buf.insert(buf.end(), middle.begin(), middle.end());
+    buf.insert(buf.end(), baseBytes.end() - suffixLen, baseBytes.end());
+    full = Value::MakeRaw(std::move(buf), 1);
+  }
+  full.SetTime(patch->time());
+  full.SetServerTime(patch->server_time());
+  *patch = std::move(full);
+  return true;
+}
+
 void CImpl::ProcessIncomingBinary(std::span<const uint8_t> data) {
   for (;;) {
     if (data.empty()) {
@@ -129,7 +195,9 @@ void CImpl::ProcessIncomingBinary(std::span<const uint8_t> data) {
     int64_t id;
     Value value;
     std::string error;
-    if (!WireDecodeBinary(&data, &id, &value, &error, -m_serverTimeOffsetUs)) {
+    bool isDelta = false;
+    if (!WireDecodeBinary(&data, &id, &value, &error, -m_serverTimeOffsetUs,
+                          &isDelta)) {
       ERROR("binary decode error: {}", error);
       break;  // FIXME
     }
@@ -146,12 +214,10 @@ void CImpl::ProcessIncomingBinary(std::span<const uint8_t> data) {
              value.GetInteger());
       int64_t now = wpi::Now();
       int64_t rtt2 = (now - value.GetInteger()) / 2;
-      if (rtt2 < m_rtt2Us) {
-        m_rtt2Us = rtt2;
-        m_serverTimeOffsetUs = value.server_time() + rtt2 - now;
-        DEBUG3("Time offset: {}", m_serverTimeOffsetUs);
-        m_haveTimeOffset = true;
-      }
+      m_clockSync.AddSample(value.server_time() + rtt2 - now, rtt2, now);
+      m_serverTimeOffsetUs = m_clockSync.GetOffset(now);
+      DEBUG3("Time offset: {}", m_serverTimeOffsetUs);
+      m_haveTimeOffset = true;
       continue;
     }
 
@@ -162,6 +228,19 @@ void CImpl::ProcessIncomingBinary(std::span<const uint8_t> data) {
       continue;
     }
 
+    // reconstruct delta-encoded values against the last full value
+    auto deltaIt = m_deltaValues.find(id);
+    if (isDelta) {
+      if (deltaIt == m_deltaValues.end() ||
+          !ApplyValueDelta(deltaIt->second, &value)) {
+        WARNING("could not apply delta for id {}", id);
+        continue;
+      }
+      deltaIt->second = value;
+    } else if (deltaIt != m_deltaValues.end()) {
+      deltaIt->second = value;
+    }
+
     // pass along to local handler
     if (m_local) {
       m_local->NetworkSetValue(topicIt->second, value);
@@ -194,7 +273,7 @@ bool CImpl::SendControl(uint64_t curTimeMs) {
   DEBUG4("SendControl({})", curTimeMs);
 
   // rate limit sends
-  if (curTimeMs < (m_lastSendMs + kMinPeriodMs)) {
+  if (curTimeMs < (m_lastSendMs + MinPeriodMs())) {
     return false;
   }
 
@@ -206,21 +285,21 @@ bool CImpl::SendControl(uint64_t curTimeMs) {
     auto now = wpi::Now();
     DEBUG4("Sending RTT ping {}", now);
     WireEncodeBinary(m_wire.SendBinary().Add(), -1, 0, Value::MakeInteger(now));
-    // drift isn't critical here, so just go from current time
-    m_nextPingTimeMs = curTimeMs + kPingIntervalMs;
+    // schedule drift isn't critical here, so just go from current time
+    m_nextPingTimeMs =
+        curTimeMs + (m_clockSync.HaveFullWindow() ? kPingIntervalMs
+                                                  : kPingBurstIntervalMs);
   }
 
   if (!m_outgoing.empty()) {
     if (!CheckNetworkReady()) {
       return false;
     }
-    auto writer = m_wire.SendText();
-    for (auto&& msg : m_outgoing) {
-      auto& stream = writer.Add();
-      if (!WireEncodeText(stream, msg)) {
-        // shouldn't happen, but just in case...
-        stream << "{}";
-      }
+    // batch encode the entire outgoing queue into the reusable buffer, then
+    // hand it to the wire as a single write; steady state does no allocation
+    m_batchBuf.Clear();
+    if (WireEncodeTextBatch(m_batchBuf, m_outgoing) != 0) {
+      m_wire.SendText().Add() << m_batchBuf.view();
     }
     m_outgoing.resize(0);
   }
@@ -242,6 +321,9 @@ void CImpl::SendValues(uint64_t curTimeMs) {
     return;
   }
 
+  // refresh the offset so outgoing timestamps track clock drift between pings
+  m_serverTimeOffsetUs = m_clockSync.GetOffset(wpi::Now());
+
   // send any pending updates due to be sent
   bool checkedNetwork = false;
   auto writer = m_wire.SendBinary();
@@ -260,8 +342,7 @@ void CImpl::SendValues(uint64_t curTimeMs) {
         if (time != 0) {
           time += m_serverTimeOffsetUs;
         }
-        WireEncodeBinary(writer.Add(), Handle{pub->handle}.GetIndex(), time,
-                         val);
+        writer.WriteValue(Handle{pub->handle}.GetIndex(), time, val);
       }
       pub->outValues.resize(0);
       pub->nextSendMs = curTimeMs + pub->periodMs;
@@ -295,14 +376,14 @@ void CImpl::Publish(NT_Publisher pubHandle, NT_Topic topicHandle,
   publisher->handle = pubHandle;
   publisher->options = options;
   publisher->periodMs = std::lround(options.periodic * 100) * 10;
-  if (publisher->periodMs < kMinPeriodMs) {
-    publisher->periodMs = kMinPeriodMs;
+  if (publisher->periodMs < MinPeriodMs()) {
+    publisher->periodMs = MinPeriodMs();
   }
 
   // update period
   m_periodMs = std::gcd(m_periodMs, publisher->periodMs);
-  if (m_periodMs < kMinPeriodMs) {
-    m_periodMs = kMinPeriodMs;
+  if (m_periodMs < MinPeriodMs()) {
+    m_periodMs = MinPeriodMs();
   }
   m_setPeriodic(m_periodMs);
 }
@@ -380,6 +461,9 @@ void CImpl::ServerAnnounce(std::string_view name, int64_t id,
   }
   m_topicMap[id] =
       m_local->NetworkAnnounce(name, typeStr, properties, pubHandle);
+  if (properties.value("delta", false)) {
+    m_deltaValues.try_emplace(id);
+  }
 }
 
 void CImpl::ServerUnannounce(std::string_view name, int64_t id) {
@@ -387,6 +471,7 @@ void CImpl::ServerUnannounce(std::string_view name, int64_t id) {
   assert(m_local);
   m_local->NetworkUnannounce(name);
   m_topicMap.erase(id);
+  m_deltaValues.erase(id);
 }
 
 void CImpl::ServerPropertiesUpdate(std::string_view name,
@@ -399,14 +484,15 @@ void CImpl::ServerPropertiesUpdate(std::string_view name,
 class ClientImpl::Impl final : public CImpl {
  public:
   Impl(uint64_t curTimeMs, int inst, WireConnection& wire, wpi::Logger& logger,
-       std::function<void(uint32_t repeatMs)> setPeriodic)
-      : CImpl{curTimeMs, inst, wire, logger, std::move(setPeriodic)} {}
+       ClockSync& clockSync, std::function<void(uint32_t repeatMs)> setPeriodic)
+      : CImpl{curTimeMs, inst, wire, logger, clockSync,
+              std::move(setPeriodic)} {}
 };
 
 ClientImpl::ClientImpl(uint64_t curTimeMs, int inst, WireConnection& wire,
-                       wpi::Logger& logger,
+                       wpi::Logger& logger, ClockSync& clockSync,
                        std::function<void(uint32_t repeatMs)> setPeriodic)
-    : m_impl{std::make_unique<Impl>(curTimeMs, inst, wire, logger,
+    : m_impl{std::make_unique<Impl>(curTimeMs, inst, wire, logger, clockSync,
                                     std::move(setPeriodic))} {}
 
 ClientImpl::~ClientImpl() = default;
@@ -440,6 +526,10 @@ void ClientImpl::SetLocal(LocalInterface* local) {
   m_impl->m_local = local;
 }
 
+void ClientImpl::SetSameHost(bool sameHost) {
+  m_impl->m_sameHost = sameHost;
+}
+
 ClientStartup::ClientStartup(ClientImpl& client)
     : m_client{client},
       m_binaryWriter{client.m_impl->m_wire.SendBinary()},
@@ -479,7 +569,7 @@ void ClientStartup::SetValue(NT_Publisher pubHandle, const Value& value) {
   publisher.lastValue = value;
   // only send time 0 values until we have a RTT
   if (value.server_time() == 0) {
-    WireEncodeBinary(m_binaryWriter.Add(), index, 0, value);
+    m_binaryWriter.WriteValue(index, 0, value);
   } else {
     publisher.outValues.emplace_back(value);
   }
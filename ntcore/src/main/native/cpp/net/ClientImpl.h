@@ -29,6 +29,7 @@ namespace nt::net {
 
 struct ClientMessage;
 class ClientStartup;
+class ClockSync;
 class WireConnection;
 
 class ClientImpl {
@@ -36,7 +37,7 @@ class ClientImpl {
 
  public:
   ClientImpl(uint64_t curTimeMs, int inst, WireConnection& wire,
-             wpi::Logger& logger,
+             wpi::Logger& logger, ClockSync& clockSync,
              std::function<void(uint32_t repeatMs)> setPeriodic);
   ~ClientImpl();
 
@@ -49,6 +50,10 @@ class ClientImpl {
 
   void SetLocal(LocalInterface* local);
 
+  // Same-host (loopback) connections skip the normal transmit rate limiting,
+  // cutting local pub/sub latency to the event loop turnaround time.
+  void SetSameHost(bool sameHost);
+
  private:
   class Impl;
   std::unique_ptr<Impl> m_impl;
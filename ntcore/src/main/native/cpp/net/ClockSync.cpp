@@ -0,0 +1,99 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "ClockSync.h"
+
+#include <algorithm>
+
+using namespace nt::net;
+
+void ClockSync::AddSample(int64_t offsetUs, int64_t rtt2Us,
+                          int64_t localTimeUs) {
+  std::scoped_lock lock{m_mutex};
+
+  m_samples[m_sampleNext] = Sample{offsetUs, rtt2Us, localTimeUs};
+  m_sampleNext = (m_sampleNext + 1) % kWindowSize;
+  if (m_sampleCount < kWindowSize) {
+    ++m_sampleCount;
+  }
+
+  // clock filter: select the lowest-delay sample in the window (its offset
+  // was least perturbed by queuing delay); on ties prefer the newest
+  Sample selected = m_samples[0];
+  for (size_t i = 1; i < m_sampleCount; ++i) {
+    if (m_samples[i].rtt2Us <= selected.rtt2Us) {
+      selected = m_samples[i];
+    }
+  }
+
+  if (!m_haveSelected) {
+    m_driftBase = selected;
+  } else if (selected.timeUs - m_driftBase.timeUs >= kDriftMinSpanUs) {
+    // instantaneous drift between the baseline and current selection,
+    // clamped to physically plausible rates and smoothed (1/4 gain) to ride
+    // out selection changes within the window
+    int64_t spanUs = selected.timeUs - m_driftBase.timeUs;
+    double drift = (selected.offsetUs - m_driftBase.offsetUs) * 1e6 /
+                   static_cast<double>(spanUs);
+    drift = std::clamp(drift, -kMaxDriftPpm, kMaxDriftPpm);
+    if (m_haveDrift) {
+      m_driftPpm += (drift - m_driftPpm) * 0.25;
+    } else {
+      m_driftPpm = drift;
+      m_haveDrift = true;
+    }
+    if (spanUs >= kDriftMaxSpanUs) {
+      m_driftBase = selected;
+    }
+  }
+
+  m_selected = selected;
+  m_haveSelected = true;
+}
+
+void ClockSync::Reset() {
+  std::scoped_lock lock{m_mutex};
+  m_sampleCount = 0;
+  m_sampleNext = 0;
+  m_haveSelected = false;
+  m_driftPpm = 0.0;
+  m_haveDrift = false;
+}
+
+bool ClockSync::HaveOffset() const {
+  std::scoped_lock lock{m_mutex};
+  return m_haveSelected;
+}
+
+bool ClockSync::HaveFullWindow() const {
+  std::scoped_lock lock{m_mutex};
+  return m_sampleCount >= kWindowSize;
+}
+
+int64_t ClockSync::ExtrapolateOffset(int64_t localTimeUs) const {
+  int64_t offset = m_selected.offsetUs;
+  if (m_haveDrift) {
+    offset += static_cast<int64_t>((localTimeUs - m_selected.timeUs) *
+                                   m_driftPpm * 1e-6);
+  }
+  return offset;
+}
+
+int64_t ClockSync::GetOffset(int64_t localTimeUs) const {
+  std::scoped_lock lock{m_mutex};
+  if (!m_haveSelected) {
+    return 0;
+  }
+  return ExtrapolateOffset(localTimeUs);
+}
+
+int64_t ClockSync::GetUncertainty(int64_t localTimeUs) const {
+  std::scoped_lock lock{m_mutex};
+  if (!m_haveSelected) {
+    return INT64_MAX;
+  }
+  int64_t ageUs = std::max<int64_t>(localTimeUs - m_selected.timeUs, 0);
+  double driftPpm = m_haveDrift ? kResidualDriftPpm : kMaxDriftPpm;
+  return m_selected.rtt2Us + static_cast<int64_t>(ageUs * driftPpm * 1e-6);
+}
@@ -0,0 +1,115 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <wpi/mutex.h>
+
+namespace nt::net {
+
+/**
+ * NTP-style filter for the client's estimate of the server clock offset.
+ *
+ * Each RTT ping exchange produces one (offset, half-RTT, local time) sample.
+ * Individual samples wobble with network jitter, so rather than trusting the
+ * single lowest-RTT exchange ever seen (which also freezes out clock drift),
+ * this keeps a sliding window of recent samples, selects the lowest-delay
+ * sample in the window as the current offset (the NTP clock filter), and
+ * estimates the drift rate between the two clocks from how the selected
+ * offset moves over time.  The drift estimate lets the offset be extrapolated
+ * between pings, and the selected sample's delay plus an age-based dispersion
+ * term bounds how far off the extrapolation can be.
+ *
+ * AddSample()/Reset() are called from the network loop; the getters may be
+ * called from any thread.
+ */
+class ClockSync {
+ public:
+  /**
+   * Add an offset measurement from an RTT ping exchange.
+   *
+   * @param offsetUs measured offset (server time - local time), microseconds
+   * @param rtt2Us half of the measured round trip time, microseconds
+   * @param localTimeUs local time of the measurement, microseconds
+   */
+  void AddSample(int64_t offsetUs, int64_t rtt2Us, int64_t localTimeUs);
+
+  /**
+   * Clear all state (e.g. on disconnect); HaveOffset() returns false until
+   * the next sample.
+   */
+  void Reset();
+
+  /**
+   * Return true if at least one sample has been added since the last Reset().
+   */
+  bool HaveOffset() const;
+
+  /**
+   * Return true once the sample window is full; used to switch the ping
+   * cadence from the initial burst to the steady-state interval.
+   */
+  bool HaveFullWindow() const;
+
+  /**
+   * Get the current offset estimate, extrapolated to the passed local time
+   * using the drift estimate.  Returns 0 if no samples have been added.
+   *
+   * @param localTimeUs local time to extrapolate to, microseconds
+   * @return offset (server time - local time), microseconds
+   */
+  int64_t GetOffset(int64_t localTimeUs) const;
+
+  /**
+   * Get a bound on the error of GetOffset() at the passed local time: the
+   * selected sample's half-RTT plus a dispersion term that grows with the
+   * sample's age at an assumed maximum drift rate.
+   *
+   * @param localTimeUs local time, microseconds
+   * @return offset uncertainty, microseconds; INT64_MAX if no samples
+   */
+  int64_t GetUncertainty(int64_t localTimeUs) const;
+
+ private:
+  struct Sample {
+    int64_t offsetUs{0};
+    int64_t rtt2Us{0};
+    int64_t timeUs{0};
+  };
+
+  // NTP uses an 8-deep clock filter; at the 3 second ping interval this
+  // spans 24 seconds of history
+  static constexpr size_t kWindowSize = 8;
+
+  // minimum time between drift baseline and current selection before an
+  // instantaneous drift measurement is meaningful relative to RTT jitter
+  static constexpr int64_t kDriftMinSpanUs = 10'000'000;
+
+  // advance the drift baseline once it's this old so the drift estimate
+  // tracks slow changes (e.g. temperature) instead of averaging forever
+  static constexpr int64_t kDriftMaxSpanUs = 120'000'000;
+
+  // crystal oscillators are specified to roughly this; bounds both the drift
+  // estimate and the dispersion growth rate before drift is known
+  static constexpr double kMaxDriftPpm = 100.0;
+
+  // residual drift after correction, for dispersion growth
+  static constexpr double kResidualDriftPpm = 15.0;
+
+  int64_t ExtrapolateOffset(int64_t localTimeUs) const;
+
+  mutable wpi::mutex m_mutex;
+  Sample m_samples[kWindowSize];
+  size_t m_sampleCount{0};
+  size_t m_sampleNext{0};
+  Sample m_selected;
+  bool m_haveSelected{false};
+  Sample m_driftBase;
+  double m_driftPpm{0.0};
+  bool m_haveDrift{false};
+};
+
+}  // namespace nt::net
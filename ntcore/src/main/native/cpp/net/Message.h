@@ -11,6 +11,7 @@
 
 #include <wpi/json.h>
 
+#include "InternString.h"
 #include "PubSubOptions.h"
 #include "networktables/NetworkTableValue.h"
 #include "ntcore_c.h"
@@ -21,7 +22,7 @@ struct PublishMsg {
   static constexpr std::string_view kMethodStr = "publish";
   NT_Publisher pubHandle{0};
   NT_Topic topicHandle{0};  // will be 0 when coming from network
-  std::string name;
+  InternString name;
   std::string typeStr;
   wpi::json properties;
   PubSubOptions options;  // will be empty when coming from network
@@ -36,7 +37,7 @@ struct UnpublishMsg {
 struct SetPropertiesMsg {
   static constexpr std::string_view kMethodStr = "setproperties";
   NT_Topic topicHandle{0};  // will be 0 when coming from network
-  std::string name;
+  InternString name;
   wpi::json update;
 };
 
@@ -64,9 +65,16 @@ struct ClientMessage {
   Contents contents;
 };
 
+// binary frame type code for delta-encoded string/raw values; an internal
+// extension only sent to subscribers that advertised "delta" in their
+// subscribe options.  The payload is a bin blob: 4-byte BE length of the
+// prior value's retained prefix, 4-byte BE length of its retained suffix,
+// followed by the replacement bytes in between.
+inline constexpr int kBinaryDeltaType = 100;
+
 struct AnnounceMsg {
   static constexpr std::string_view kMethodStr = "announce";
-  std::string name;
+  InternString name;
   int64_t id{0};
   std::string typeStr;
   std::optional<int64_t> pubuid;
@@ -75,13 +83,13 @@ struct AnnounceMsg {
 
 struct UnannounceMsg {
   static constexpr std::string_view kMethodStr = "unannounce";
-  std::string name;
+  InternString name;
   int64_t id{0};
 };
 
 struct PropertiesUpdateMsg {
   static constexpr std::string_view kMethodStr = "properties";
-  std::string name;
+  InternString name;
   wpi::json update;
   bool ack;
 };
@@ -14,6 +14,7 @@
 #include <vector>
 
 #include <wpi/Base64.h>
+#include <wpi/DataLog.h>
 #include <wpi/DenseMap.h>
 #include <wpi/MessagePack.h>
 #include <wpi/SmallVector.h>
@@ -26,6 +27,7 @@
 #include <wpi/timestamp.h>
 
 #include "IConnectionList.h"
+#include "InternString.h"
 #include "Log.h"
 #include "Message.h"
 #include "NetworkInterface.h"
@@ -52,6 +54,14 @@ static constexpr uint32_t kMinPeriodMs = 5;
 // transmission before we close the connection
 static constexpr int kWireMaxNotReady = 10;
 
+// bulk (low priority) value scheduling: values with encoded size above the
+// threshold are sent only as the per-connection bandwidth budget allows, so
+// small control-critical values are never starved behind bulk data on a slow
+// link
+static constexpr size_t kBulkThresholdBytes = 512;
+static constexpr size_t kBulkBytesPerMs = 256;  // 256 KB/s refill rate
+static constexpr size_t kBulkMaxBurstBytes = 64 * 1024;
+
 namespace {
 
 // Utility wrapper for making a set-like vector
@@ -105,8 +115,11 @@ class ClientData {
   virtual void SendOutgoing(uint64_t curTimeMs) = 0;
   virtual void Flush() = 0;
 
+  // mark this client's meta topics dirty; the documents are re-encoded at
+  // most once per control cycle by FlushMetaUpdates()
   void UpdateMetaClientPub();
   void UpdateMetaClientSub();
+  void FlushMetaUpdates();
 
   // returns nullptr if there is no subscriber for that topic name
   SubscriberData* GetSubscriber(std::string_view name, bool special);
@@ -130,6 +143,13 @@ class ClientData {
   wpi::DenseMap<int64_t, std::unique_ptr<PublisherData>> m_publishers;
   wpi::DenseMap<int64_t, std::unique_ptr<SubscriberData>> m_subscribers;
 
+  bool m_metaPubDirty{false};
+  bool m_metaSubDirty{false};
+
+ private:
+  void EncodeMetaClientPub();
+  void EncodeMetaClientSub();
+
  public:
   // meta topics
   TopicData* m_metaPub = nullptr;
@@ -158,6 +178,7 @@ class ClientData4Base : public ClientData, protected ClientMessageHandler {
   void ClientSetValue(int64_t pubuid, const Value& value);
 
   wpi::DenseMap<TopicData*, bool> m_announceSent;
+  bool m_deltaCapable{false};  // any subscribe advertised delta support
 };
 
 class ClientDataLocal final : public ClientData4Base {
@@ -207,10 +228,16 @@ class ClientData4 final : public ClientData4Base {
  private:
   std::vector<ServerMessage> m_outgoing;
   int m_notReadyCount{0};
+  size_t m_bulkBudget{0};  // bytes available for bulk values this cycle
+  // last value sent to this client for each delta-encoded topic
+  wpi::DenseMap<TopicData*, Value> m_deltaPrev;
 
-  bool WriteBinary(int64_t id, int64_t time, const Value& value) {
-    return WireEncodeBinary(SendBinary().Add(), id, time, value);
-  }
+  bool WriteBinary(int64_t id, int64_t time, const Value& value);
+
+  // delta path for string/raw topics with the "delta" property; returns
+  // empty if the topic is not delta-encoded
+  std::optional<bool> TryWriteBinaryDelta(int64_t id, int64_t time,
+                                          const Value& value);
 
   TextWriter& SendText() {
     m_outBinary.reset();  // ensure proper interleaving of text and binary
@@ -322,7 +349,20 @@ struct TopicData {
   void RefreshProperties();
   bool SetFlags(unsigned int flags_);
 
-  std::string name;
+  // encoded announce message (no pubuid), lazily built and reused for every
+  // client this topic is announced to; cleared when announce-relevant fields
+  // change.  This makes (re)connect repopulation a series of buffer appends
+  // rather than a JSON serialization per topic per client.
+  std::string_view GetAnnounceCache();
+
+  // encoded msgpack [id, time, type, value] frame for the most recently
+  // encoded value; when the same value fans out to several NT4 clients
+  // (e.g. an NT3 publisher with multiple NT4 dashboards) the frame is
+  // encoded once and the bytes reused.  Returns empty if the value should
+  // not be cached (see ClientData4Base::WriteBinary).
+  std::string_view GetBinaryCache(int64_t time, const Value& value);
+
+  InternString name;
   unsigned int id;
   Value lastValue;
   ClientData* lastValueClient = nullptr;
@@ -330,8 +370,11 @@ struct TopicData {
   wpi::json properties = wpi::json::object();
   bool persistent{false};
   bool retained{false};
+  bool delta{false};  // publisher opted in to delta encoding
   bool special{false};
   NT_Topic localHandle{0};
+  int datalogEntry{-1};  // data log bridge entry, -1 if not logged
+  NT_Type datalogType{NT_UNASSIGNED};
 
   VectorSet<PublisherData*> publishers;
   VectorSet<SubscriberData*> subscribers;
@@ -339,6 +382,11 @@ struct TopicData {
   // meta topics
   TopicData* metaPub = nullptr;
   TopicData* metaSub = nullptr;
+
+ private:
+  std::string m_announceCache;
+  std::string m_binaryCache;
+  Value m_binaryCacheValue;
 };
 
 struct PublisherData {
@@ -396,12 +444,25 @@ class SImpl {
   std::vector<std::unique_ptr<ClientData>> m_clients;
   wpi::UidVector<std::unique_ptr<TopicData>, 16> m_topics;
   wpi::StringMap<TopicData*> m_nameTopics;
+  // set when the persistent topic set or properties change; forces a full
+  // rewrite of the persistent file.  Value-only changes instead queue the
+  // topic in m_dirtyPersistent and are written as journal appends
   bool m_persistentChanged{false};
+  VectorSet<TopicData*> m_dirtyPersistent;
 
   // global meta topics (other meta topics are linked to from the specific
   // client or topic)
   TopicData* m_metaClients;
 
+  // topics with deferred meta topic updates
+  VectorSet<TopicData*> m_dirtyMetaTopicPub;
+  VectorSet<TopicData*> m_dirtyMetaTopicSub;
+
+  // in-process data log bridge (see ServerImpl::StartDataLog)
+  wpi::log::DataLog* m_dataLog{nullptr};
+  std::string m_dataLogPrefix;
+  std::string m_dataLogLogPrefix;
+
   // ServerImpl interface
   int AddClient(std::string_view name, std::string_view connInfo, bool local,
                 WireConnection& wire, ServerImpl::SetPeriodicFunc setPeriodic);
@@ -414,6 +475,10 @@ class SImpl {
   bool PersistentChanged();
   void DumpPersistent(wpi::raw_ostream& os);
   std::string LoadPersistent(std::string_view in);
+  std::string DumpPersistentSnapshot();
+  bool LoadPersistentSnapshot(std::span<const uint8_t> in);
+  std::string DumpPersistentJournal();
+  bool LoadPersistentJournal(std::span<const uint8_t> in);
 
   // helper functions
   TopicData* CreateTopic(ClientData* client, std::string_view name,
@@ -426,14 +491,25 @@ class SImpl {
   void SetFlags(ClientData* client, TopicData* topic, unsigned int flags);
   void SetValue(ClientData* client, TopicData* topic, const Value& value);
 
-  // update meta topic values from data structures
+  void StartDataLog(wpi::log::DataLog& log, std::string_view prefix,
+                    std::string_view logPrefix);
+  void StopDataLog();
+  void StartDataLogEntry(TopicData* topic, int64_t time);
+
+  // update meta topic values from data structures.  Topic meta updates are
+  // coalesced: UpdateMetaTopicPub/Sub mark the topic dirty and the document
+  // is re-encoded at most once per control cycle by FlushMetaUpdates()
   void UpdateMetaClients(const std::vector<ConnectionInfo>& conns);
   void UpdateMetaTopicPub(TopicData* topic);
   void UpdateMetaTopicSub(TopicData* topic);
+  void FlushMetaUpdates();
 
  private:
   void PropertiesChanged(ClientData* client, TopicData* topic,
                          const wpi::json& update);
+
+  void EncodeMetaTopicPub(TopicData* topic);
+  void EncodeMetaTopicSub(TopicData* topic);
 };
 
 struct Writer : public mpack_writer_t {
@@ -476,6 +552,27 @@ static void WriteOptions(mpack_writer_t& w, const PubSubOptions& options) {
 }
 
 void ClientData::UpdateMetaClientPub() {
+  m_metaPubDirty = true;
+  m_server.m_controlReady = true;
+}
+
+void ClientData::UpdateMetaClientSub() {
+  m_metaSubDirty = true;
+  m_server.m_controlReady = true;
+}
+
+void ClientData::FlushMetaUpdates() {
+  if (m_metaPubDirty) {
+    m_metaPubDirty = false;
+    EncodeMetaClientPub();
+  }
+  if (m_metaSubDirty) {
+    m_metaSubDirty = false;
+    EncodeMetaClientSub();
+  }
+}
+
+void ClientData::EncodeMetaClientPub() {
   if (!m_metaPub) {
     return;
   }
@@ -495,7 +592,7 @@ void ClientData::UpdateMetaClientPub() {
   }
 }
 
-void ClientData::UpdateMetaClientSub() {
+void ClientData::EncodeMetaClientSub() {
   if (!m_metaSub) {
     return;
   }
@@ -614,6 +711,9 @@ void ClientData4Base::ClientSubscribe(int64_t subuid,
     // create
     sub = std::make_unique<SubscriberData>(this, topicNames, subuid, options);
   }
+  if (options.deltaCapable) {
+    m_deltaCapable = true;
+  }
 
   // limit subscriber min period
   if (sub->periodMs < kMinPeriodMs) {
@@ -840,21 +940,38 @@ void ClientData4::SendValue(TopicData* topic, const Value& value,
       m_outgoing.emplace_back(ServerMessage{ServerValueMsg{topic->id, value}});
       break;
     case ClientData::kSendNormal: {
-      // scan outgoing and replace, or append if not present
-      bool found = false;
-      for (auto&& msg : m_outgoing) {
-        if (auto m = std::get_if<ServerValueMsg>(&msg.contents)) {
+      // how many samples to retain for this topic; subscribers can opt into
+      // a deeper per-window ring via the coalesce option
+      size_t keep = 1;
+      for (auto&& sub : topic->subscribers) {
+        if (sub->client == this && sub->options.serverCoalesce > keep) {
+          keep = sub->options.serverCoalesce;
+        }
+      }
+      // scan outgoing; if fewer than keep queued, append; otherwise drop the
+      // oldest queued sample so the window holds the newest keep samples
+      size_t count = 0;
+      auto oldest = m_outgoing.end();
+      for (auto it = m_outgoing.begin(), end = m_outgoing.end(); it != end;
+           ++it) {
+        if (auto m = std::get_if<ServerValueMsg>(&it->contents)) {
           if (m->topic == topic->id) {
-            m->value = value;
-            found = true;
-            break;
+            if (oldest == m_outgoing.end()) {
+              oldest = it;
+            }
+            ++count;
           }
         }
       }
-      if (!found) {
-        m_outgoing.emplace_back(
-            ServerMessage{ServerValueMsg{topic->id, value}});
+      if (count >= keep) {
+        if (keep == 1) {
+          // common case: replace the single queued sample in place
+          std::get_if<ServerValueMsg>(&oldest->contents)->value = value;
+          break;
+        }
+        m_outgoing.erase(oldest);
       }
+      m_outgoing.emplace_back(ServerMessage{ServerValueMsg{topic->id, value}});
       break;
     }
   }
@@ -869,8 +986,12 @@ void ClientData4::SendAnnounce(TopicData* topic,
   sent = true;
 
   if (m_local) {
-    WireEncodeAnnounce(SendText().Add(), topic->name, topic->id, topic->typeStr,
-                       topic->properties, pubuid);
+    if (pubuid) {
+      WireEncodeAnnounce(SendText().Add(), topic->name, topic->id,
+                         topic->typeStr, topic->properties, pubuid);
+    } else {
+      SendText().Add() << topic->GetAnnounceCache();
+    }
     Flush();
   } else {
     m_outgoing.emplace_back(ServerMessage{AnnounceMsg{
@@ -880,6 +1001,7 @@ void ClientData4::SendAnnounce(TopicData* topic,
 }
 
 void ClientData4::SendUnannounce(TopicData* topic) {
+  m_deltaPrev.erase(topic);
   auto& sent = m_announceSent[topic];
   if (!sent) {
     return;
@@ -912,6 +1034,83 @@ void ClientData4::SendPropertiesUpdate(TopicData* topic,
   }
 }
 
+// approximate encoded size of a value message, for bandwidth scheduling
+static size_t ValueSendSize(const Value& value) {
+  static constexpr size_t kOverhead = 16;  // array/id/time/type overhead
+  switch (value.type()) {
+    case NT_STRING:
+      return value.GetString().size() + kOverhead;
+    case NT_RPC:
+    case NT_RAW:
+      return value.GetRaw().size() + kOverhead;
+    case NT_BOOLEAN_ARRAY:
+      return value.GetBooleanArray().size() + kOverhead;
+    case NT_INTEGER_ARRAY:
+      return value.GetIntegerArray().size() * 9 + kOverhead;
+    case NT_FLOAT_ARRAY:
+      return value.GetFloatArray().size() * 5 + kOverhead;
+    case NT_DOUBLE_ARRAY:
+      return value.GetDoubleArray().size() * 9 + kOverhead;
+    case NT_STRING_ARRAY: {
+      size_t size = kOverhead;
+      for (auto&& str : value.GetStringArray()) {
+        size += str.size() + 5;
+      }
+      return size;
+    }
+    default:
+      return kOverhead;
+  }
+}
+
+static std::span<const uint8_t> DeltaBytes(const Value& value) {
+  if (value.type() == NT_STRING) {
+    auto str = value.GetString();
+    return {reinterpret_cast<const uint8_t*>(str.data()), str.size()};
+  }
+  return value.GetRaw();
+}
+
+std::optional<bool> ClientData4::TryWriteBinaryDelta(int64_t id, int64_t time,
+                                                     const Value& value) {
+  if (id < 0 || static_cast<size_t>(id) >= m_server.m_topics.size()) {
+    return std::nullopt;
+  }
+  TopicData* topic = m_server.m_topics[id].get();
+  if (!topic || !topic->delta) {
+    return std::nullopt;
+  }
+  auto cur = DeltaBytes(value);
+  auto prevIt = m_deltaPrev.find(topic);
+  if (prevIt != m_deltaPrev.end() && prevIt->second.type() == value.type()) {
+    auto prev = DeltaBytes(prevIt->second);
+    size_t maxCommon = (std::min)(prev.size(), cur.size());
+    size_t prefix = 0;
+    while (prefix < maxCommon && prev[prefix] == cur[prefix]) {
+      ++prefix;
+    }
+    size_t suffix = 0;
+    while (suffix < maxCommon - prefix &&
+           prev[prev.size() - 1 - suffix] == cur[cur.size() - 1 - suffix]) {
+      ++suffix;
+    }
+    auto middle = cur.subspan(prefix, cur.size() - prefix - suffix);
+    // only worth sending as a delta if meaningfully smaller than the value
+    if (middle.size() + 16 < cur.size()) {
+      WireEncodeBinaryDelta(SendBinary().Add(), id, time,
+                            static_cast<uint32_t>(prefix),
+                            static_cast<uint32_t>(suffix), middle);
+      prevIt->second = value;
+      return true;
+    }
+  }
+  if (!SendBinary().WriteValue(id, time, value)) {
+    return false;
+  }
+  m_deltaPrev[topic] = value;
+  return true;
+}
+
 void ClientData4::SendOutgoing(uint64_t curTimeMs) {
   if (m_outgoing.empty()) {
     return;  // nothing to do
@@ -931,14 +1130,69 @@ void ClientData4::SendOutgoing(uint64_t curTimeMs) {
   }
   m_notReadyCount = 0;
 
+  // replenish the bulk-data budget for the elapsed interval
+  if (m_lastSendMs == 0) {
+    m_bulkBudget = kBulkMaxBurstBytes;
+  } else {
+    m_bulkBudget += (curTimeMs - m_lastSendMs) * kBulkBytesPerMs;
+    if (m_bulkBudget > kBulkMaxBurstBytes) {
+      m_bulkBudget = kBulkMaxBurstBytes;
+    }
+  }
+
+  // first pass: control messages and small (high priority) values; these are
+  // always encoded first so control-critical topics are never starved behind
+  // bulk data in the socket buffer
+  bool deferred = false;
   for (auto&& msg : m_outgoing) {
     if (auto m = std::get_if<ServerValueMsg>(&msg.contents)) {
+      if (ValueSendSize(m->value) > kBulkThresholdBytes) {
+        continue;
+      }
       WriteBinary(m->topic, m->value.time(), m->value);
-    } else {
+      msg.contents = std::monostate{};
+    } else if (auto m = std::get_if<AnnounceMsg>(&msg.contents);
+               m && !m->pubuid) {
+      // announce without pubuid is identical for every client; reuse the
+      // topic's cached encoding (reconnect repopulation is dominated by these)
+      auto topicIt = m_server.m_nameTopics.find(m->name);
+      if (topicIt != m_server.m_nameTopics.end() &&
+          topicIt->second->id == m->id) {
+        SendText().Add() << topicIt->second->GetAnnounceCache();
+      } else {
+        WireEncodeText(SendText().Add(), msg);
+      }
+      msg.contents = std::monostate{};
+    } else if (!std::holds_alternative<std::monostate>(msg.contents)) {
       WireEncodeText(SendText().Add(), msg);
+      msg.contents = std::monostate{};
     }
   }
-  m_outgoing.resize(0);
+
+  // second pass: bulk values, in queue order, while budget remains; the rest
+  // stay queued for the next cycle (kSendNormal coalescing keeps only the
+  // latest value per topic).  A value too large to ever fit the burst cap is
+  // sent when the budget is full so it still makes progress.
+  for (auto&& msg : m_outgoing) {
+    if (auto m = std::get_if<ServerValueMsg>(&msg.contents)) {
+      size_t size = ValueSendSize(m->value);
+      if (size <= m_bulkBudget || m_bulkBudget >= kBulkMaxBurstBytes) {
+        m_bulkBudget -= (std::min)(size, m_bulkBudget);
+        WriteBinary(m->topic, m->value.time(), m->value);
+        msg.contents = std::monostate{};
+      } else {
+        deferred = true;
+      }
+    }
+  }
+
+  if (deferred) {
+    std::erase_if(m_outgoing, [](const auto& msg) {
+      return std::holds_alternative<std::monostate>(msg.contents);
+    });
+  } else {
+    m_outgoing.resize(0);
+  }
   m_lastSendMs = curTimeMs;
 }
 
@@ -1433,6 +1687,7 @@ bool TopicData::SetProperties(const wpi::json& update) {
   }
   if (updated) {
     RefreshProperties();
+    m_announceCache.clear();
   }
   return updated;
 }
@@ -1454,6 +1709,14 @@ void TopicData::RefreshProperties() {
       retained = *val;
     }
   }
+
+  delta = false;
+  auto deltaIt = properties.find("delta");
+  if (deltaIt != properties.end()) {
+    if (auto val = deltaIt->get_ptr<bool*>()) {
+      delta = *val;
+    }
+  }
 }
 
 bool TopicData::SetFlags(unsigned int flags_) {
@@ -1467,9 +1730,96 @@ bool TopicData::SetFlags(unsigned int flags_) {
     persistent = false;
     properties.erase("persistent");
   }
+  if (updated) {
+    m_announceCache.clear();
+  }
   return updated;
 }
 
+std::string_view TopicData::GetAnnounceCache() {
+  if (m_announceCache.empty()) {
+    wpi::raw_string_ostream os{m_announceCache};
+    WireEncodeAnnounce(os, name, id, typeStr, properties, std::nullopt);
+  }
+  return m_announceCache;
+}
+
+// identity comparison for fan-out caching: exact for scalar types; for
+// heap-backed types compares the backing pointers, so copies of the same
+// value match and distinct allocations conservatively re-encode
+static bool IsSameValue(const Value& a, const Value& b) {
+  if (a.type() != b.type() || a.time() != b.time() ||
+      a.server_time() != b.server_time()) {
+    return false;
+  }
+  auto& av = a.value();
+  auto& bv = b.value();
+  switch (a.type()) {
+    case NT_BOOLEAN:
+      return av.data.v_boolean == bv.data.v_boolean;
+    case NT_INTEGER:
+      return av.data.v_int == bv.data.v_int;
+    case NT_FLOAT:
+      return av.data.v_float == bv.data.v_float;
+    case NT_DOUBLE:
+      return av.data.v_double == bv.data.v_double;
+    case NT_STRING:
+      return av.data.v_string.str == bv.data.v_string.str;
+    case NT_RAW:
+      return av.data.v_raw.data == bv.data.v_raw.data;
+    case NT_BOOLEAN_ARRAY:
+      return av.data.arr_boolean.arr == bv.data.arr_boolean.arr;
+    case NT_INTEGER_ARRAY:
+      return av.data.arr_int.arr == bv.data.arr_int.arr;
+    case NT_FLOAT_ARRAY:
+      return av.data.arr_float.arr == bv.data.arr_float.arr;
+    case NT_DOUBLE_ARRAY:
+      return av.data.arr_double.arr == bv.data.arr_double.arr;
+    case NT_STRING_ARRAY:
+      return av.data.arr_string.arr == bv.data.arr_string.arr;
+    default:
+      return false;
+  }
+}
+
+std::string_view TopicData::GetBinaryCache(int64_t time, const Value& value) {
+  if (time != value.time()) {
+    return {};
+  }
+  if (!IsSameValue(m_binaryCacheValue, value)) {
+    m_binaryCache.clear();
+    wpi::raw_string_ostream os{m_binaryCache};
+    WireEncodeBinary(os, id, time, value);
+    m_binaryCacheValue = value;
+  }
+  return m_binaryCache;
+}
+
+bool ClientData4::WriteBinary(int64_t id, int64_t time, const Value& value) {
+  if (m_deltaCapable &&
+      (value.type() == NT_STRING || value.type() == NT_RAW)) {
+    if (auto rv = TryWriteBinaryDelta(id, time, value)) {
+      return *rv;
+    }
+  }
+  // fan-out fast path: identical non-delta frames are encoded once per topic
+  // and the cached bytes appended for each subscriber.  Large raw values are
+  // excluded so the wire's zero-copy borrow path still applies to them.
+  bool borrowable = (value.type() == NT_RAW || value.type() == NT_RPC) &&
+                    value.value().data.v_raw.size >= 512;
+  if (!borrowable && id >= 0 &&
+      static_cast<size_t>(id) < m_server.m_topics.size()) {
+    if (auto topic = m_server.m_topics[id].get()) {
+      auto frame = topic->GetBinaryCache(time, value);
+      if (!frame.empty()) {
+        SendBinary().Add() << frame;
+        return false;
+      }
+    }
+  }
+  return SendBinary().WriteValue(id, time, value);
+}
+
 bool SubscriberData::Matches(std::string_view name, bool special) {
   for (auto&& topicName : topicNames) {
     if ((!options.prefixMatch && name == topicName) ||
@@ -1732,6 +2082,7 @@ void SImpl::DumpPersistent(wpi::raw_ostream& os) {
     os << "\n  }";
   }
   os << "\n]\n";
+  m_dirtyPersistent.clear();  // a full dump subsumes pending journal records
 }
 
 static std::string* ObjGetString(wpi::json::object_t& obj, std::string_view key,
@@ -1965,6 +2316,7 @@ std::string SImpl::LoadPersistent(std::string_view in) {
   }
 
   m_persistentChanged = persistentChanged;  // restore flag
+  m_dirtyPersistent.clear();  // just-loaded values don't need journaling
 
   return allerrors;
 }
@@ -1988,6 +2340,11 @@ TopicData* SImpl::CreateTopic(ClientData* client, std::string_view name,
     topic->id = id;
     topic->special = special;
 
+    if (m_dataLog && !special && !topic->typeStr.empty() &&
+        wpi::starts_with(topic->name, m_dataLogPrefix)) {
+      StartDataLogEntry(topic, Now());
+    }
+
     for (auto&& aClient : m_clients) {
       if (!aClient) {
         continue;
@@ -2034,6 +2391,11 @@ void SImpl::DeleteTopic(TopicData* topic) {
     return;
   }
 
+  // drop any deferred meta updates and pending journal record
+  m_dirtyMetaTopicPub.Remove(topic);
+  m_dirtyMetaTopicSub.Remove(topic);
+  m_dirtyPersistent.Remove(topic);
+
   // delete meta topics
   if (topic->metaPub) {
     DeleteTopic(topic->metaPub);
@@ -2057,6 +2419,11 @@ void SImpl::DeleteTopic(TopicData* topic) {
     }
   }
 
+  if (m_dataLog && topic->datalogEntry >= 0) {
+    m_dataLog->Finish(topic->datalogEntry, Now());
+    topic->datalogEntry = -1;
+  }
+
   // erase the topic
   m_nameTopics.erase(topic->name);
   m_topics.erase(topic->id);
@@ -2093,6 +2460,105 @@ void SImpl::SetFlags(ClientData* client, TopicData* topic, unsigned int flags) {
   }
 }
 
+static std::string MakeDataLogMetadata(const wpi::json& properties) {
+  return fmt::format("{{\"properties\":{},\"source\":\"NT\"}}",
+                     properties.dump());
+}
+
+// DataLog records use the data log encoding, not msgpack, so primitive and
+// array values are transcoded here; string and raw payloads are appended
+// directly from the value's existing buffer.
+static void AppendToDataLog(wpi::log::DataLog& log, int entry, const Value& v) {
+  auto time = v.time();
+  switch (v.type()) {
+    case NT_BOOLEAN:
+      log.AppendBoolean(entry, v.GetBoolean(), time);
+      break;
+    case NT_INTEGER:
+      log.AppendInteger(entry, v.GetInteger(), time);
+      break;
+    case NT_FLOAT:
+      log.AppendFloat(entry, v.GetFloat(), time);
+      break;
+    case NT_DOUBLE:
+      log.AppendDouble(entry, v.GetDouble(), time);
+      break;
+    case NT_STRING:
+      log.AppendString(entry, v.GetString(), time);
+      break;
+    case NT_RAW: {
+      auto val = v.GetRaw();
+      log.AppendRaw(entry,
+                    {reinterpret_cast<const uint8_t*>(val.data()), val.size()},
+                    time);
+      break;
+    }
+    case NT_BOOLEAN_ARRAY:
+      log.AppendBooleanArray(entry, v.GetBooleanArray(), time);
+      break;
+    case NT_INTEGER_ARRAY:
+      log.AppendIntegerArray(entry, v.GetIntegerArray(), time);
+      break;
+    case NT_FLOAT_ARRAY:
+      log.AppendFloatArray(entry, v.GetFloatArray(), time);
+      break;
+    case NT_DOUBLE_ARRAY:
+      log.AppendDoubleArray(entry, v.GetDoubleArray(), time);
+      break;
+    case NT_STRING_ARRAY:
+      log.AppendStringArray(entry, v.GetStringArray(), time);
+      break;
+    default:
+      break;
+  }
+}
+
+void SImpl::StartDataLog(wpi::log::DataLog& log, std::string_view prefix,
+                         std::string_view logPrefix) {
+  StopDataLog();
+  m_dataLog = &log;
+  m_dataLogPrefix = prefix;
+  m_dataLogLogPrefix = logPrefix;
+
+  // start logging any matching topics
+  auto now = Now();
+  for (auto&& topic : m_topics) {
+    if (topic->special || !wpi::starts_with(topic->name, prefix) ||
+        topic->typeStr.empty()) {
+      continue;
+    }
+    StartDataLogEntry(topic.get(), now);
+
+    // log current value, if any
+    if (topic->lastValue && topic->datalogType == topic->lastValue.type()) {
+      AppendToDataLog(log, topic->datalogEntry, topic->lastValue);
+    }
+  }
+}
+
+void SImpl::StopDataLog() {
+  if (!m_dataLog) {
+    return;
+  }
+  auto now = Now();
+  for (auto&& topic : m_topics) {
+    if (topic->datalogEntry >= 0) {
+      m_dataLog->Finish(topic->datalogEntry, now);
+      topic->datalogEntry = -1;
+      topic->datalogType = NT_UNASSIGNED;
+    }
+  }
+  m_dataLog = nullptr;
+}
+
+void SImpl::StartDataLogEntry(TopicData* topic, int64_t time) {
+  topic->datalogEntry = m_dataLog->Start(
+      fmt::format("{}{}", m_dataLogLogPrefix,
+                  wpi::drop_front(topic->name, m_dataLogPrefix.size())),
+      topic->typeStr, MakeDataLogMetadata(topic->properties), time);
+  topic->datalogType = StringToType(topic->typeStr);
+}
+
 void SImpl::SetValue(ClientData* client, TopicData* topic, const Value& value) {
   // update retained value if from same client or timestamp newer
   if (!topic->lastValue || topic->lastValueClient == client ||
@@ -2102,9 +2568,17 @@ void SImpl::SetValue(ClientData* client, TopicData* topic, const Value& value) {
     topic->lastValue = value;
     topic->lastValueClient = client;
 
-    // if persistent, update flag
+    // if persistent, queue a journal record
     if (topic->persistent) {
-      m_persistentChanged = true;
+      if (std::find(m_dirtyPersistent.begin(), m_dirtyPersistent.end(),
+                    topic) == m_dirtyPersistent.end()) {
+        m_dirtyPersistent.Add(topic);
+      }
+    }
+
+    if (m_dataLog && topic->datalogEntry >= 0 &&
+        topic->datalogType == value.type()) {
+      AppendToDataLog(*m_dataLog, topic->datalogEntry, value);
     }
   }
 
@@ -2160,6 +2634,44 @@ void SImpl::UpdateMetaClients(const std::vector<ConnectionInfo>& conns) {
 }
 
 void SImpl::UpdateMetaTopicPub(TopicData* topic) {
+  if (!topic->metaPub) {
+    return;
+  }
+  if (std::find(m_dirtyMetaTopicPub.begin(), m_dirtyMetaTopicPub.end(),
+                topic) == m_dirtyMetaTopicPub.end()) {
+    m_dirtyMetaTopicPub.Add(topic);
+  }
+  m_controlReady = true;
+}
+
+void SImpl::UpdateMetaTopicSub(TopicData* topic) {
+  if (!topic->metaSub) {
+    return;
+  }
+  if (std::find(m_dirtyMetaTopicSub.begin(), m_dirtyMetaTopicSub.end(),
+                topic) == m_dirtyMetaTopicSub.end()) {
+    m_dirtyMetaTopicSub.Add(topic);
+  }
+  m_controlReady = true;
+}
+
+void SImpl::FlushMetaUpdates() {
+  for (auto topic : m_dirtyMetaTopicPub) {
+    EncodeMetaTopicPub(topic);
+  }
+  m_dirtyMetaTopicPub.clear();
+  for (auto topic : m_dirtyMetaTopicSub) {
+    EncodeMetaTopicSub(topic);
+  }
+  m_dirtyMetaTopicSub.clear();
+  for (auto&& client : m_clients) {
+    if (client) {
+      client->FlushMetaUpdates();
+    }
+  }
+}
+
+void SImpl::EncodeMetaTopicPub(TopicData* topic) {
   if (!topic->metaPub) {
     return;
   }
@@ -2183,7 +2695,7 @@ void SImpl::UpdateMetaTopicPub(TopicData* topic) {
   }
 }
 
-void SImpl::UpdateMetaTopicSub(TopicData* topic) {
+void SImpl::EncodeMetaTopicSub(TopicData* topic) {
   if (!topic->metaSub) {
     return;
   }
@@ -2229,6 +2741,10 @@ void SImpl::PropertiesChanged(ClientData* client, TopicData* topic,
         aClient->SendPropertiesUpdate(topic, update, aClient == client);
       }
     }
+    if (m_dataLog && topic->datalogEntry >= 0) {
+      m_dataLog->SetMetadata(topic->datalogEntry,
+                             MakeDataLogMetadata(topic->properties));
+    }
   }
 }
 
@@ -2248,6 +2764,9 @@ void ServerImpl::SendControl(uint64_t curTimeMs) {
   }
   m_impl->m_controlReady = false;
 
+  // encode any deferred meta topic updates before flushing clients
+  m_impl->FlushMetaUpdates();
+
   for (auto&& client : m_impl->m_clients) {
     if (client) {
       // to ensure ordering, just send everything
@@ -2314,6 +2833,206 @@ void ServerImpl::ConnectionsChanged(const std::vector<ConnectionInfo>& conns) {
   m_impl->UpdateMetaClients(conns);
 }
 
+// snapshot format: msgpack stream of a version integer followed by an array
+// of [name, typeStr, propertiesJson, valueBin] entries, where valueBin is the
+// standard binary value frame (WireEncodeBinary with id 0)
+static constexpr int kSnapshotVersion = 1;
+
+std::string SImpl::DumpPersistentSnapshot() {
+  size_t count = 0;
+  for (const auto& topic : m_topics) {
+    if (topic->persistent && topic->lastValue) {
+      ++count;
+    }
+  }
+  Writer w;
+  mpack_write_int(&w, kSnapshotVersion);
+  mpack_start_array(&w, count);
+  wpi::SmallVector<char, 128> valueBuf;
+  for (const auto& topic : m_topics) {
+    if (!topic->persistent || !topic->lastValue) {
+      continue;
+    }
+    mpack_start_array(&w, 4);
+    mpack_write_str(&w, topic->name.data(), topic->name.size());
+    mpack_write_str(&w, topic->typeStr.data(), topic->typeStr.size());
+    auto props = topic->properties.dump();
+    mpack_write_str(&w, props.data(), props.size());
+    valueBuf.clear();
+    wpi::raw_svector_ostream vos{valueBuf};
+    WireEncodeBinary(vos, 0, topic->lastValue.time(), topic->lastValue);
+    mpack_write_bin(&w, valueBuf.data(), valueBuf.size());
+    mpack_finish_array(&w);
+  }
+  mpack_finish_array(&w);
+  m_dirtyPersistent.clear();  // a full dump subsumes pending journal records
+  if (mpack_writer_destroy(&w) != mpack_ok) {
+    return {};
+  }
+  return std::string{reinterpret_cast<char*>(w.bytes.data()), w.bytes.size()};
+}
+
+bool SImpl::LoadPersistentSnapshot(std::span<const uint8_t> in) {
+  if (in.empty()) {
+    return false;
+  }
+  mpack_reader_t reader;
+  mpack_reader_init_data(&reader, reinterpret_cast<const char*>(in.data()),
+                         in.size());
+  if (mpack_expect_int(&reader) != kSnapshotVersion) {
+    mpack_reader_destroy(&reader);
+    return false;
+  }
+  auto count = mpack_expect_array(&reader);
+  auto time = nt::Now();
+  for (uint32_t i = 0; i < count; ++i) {
+    mpack_expect_array_match(&reader, 4);
+    auto nameLen = mpack_expect_str(&reader);
+    auto nameData = mpack_read_bytes_inplace(&reader, nameLen);
+    std::string name{nameData, nameLen};
+    mpack_done_str(&reader);
+    auto typeLen = mpack_expect_str(&reader);
+    auto typeData = mpack_read_bytes_inplace(&reader, typeLen);
+    std::string typeStr{typeData, typeLen};
+    mpack_done_str(&reader);
+    auto propsLen = mpack_expect_str(&reader);
+    auto propsData = mpack_read_bytes_inplace(&reader, propsLen);
+    std::string propsStr{propsData, propsLen};
+    mpack_done_str(&reader);
+    auto valueLen = mpack_expect_bin(&reader);
+    auto valueData = mpack_read_bytes_inplace(&reader, valueLen);
+    if (mpack_reader_error(&reader) != mpack_ok) {
+      break;
+    }
+    std::span<const uint8_t> valueSpan{
+        reinterpret_cast<const uint8_t*>(valueData), valueLen};
+    int64_t id;
+    Value value;
+    std::string error;
+    if (!WireDecodeBinary(&valueSpan, &id, &value, &error, 0)) {
+      mpack_reader_destroy(&reader);
+      return false;
+    }
+    mpack_done_bin(&reader);
+    mpack_done_array(&reader);
+
+    wpi::json props;
+    try {
+      props = wpi::json::parse(propsStr);
+    } catch (wpi::json::parse_error&) {
+      mpack_reader_destroy(&reader);
+      return false;
+    }
+    if (!props.is_object()) {
+      mpack_reader_destroy(&reader);
+      return false;
+    }
+    // re-stamp with the local clock, same as the JSON persistent load
+    value.SetTime(time);
+    value.SetServerTime(time);
+    auto topic = CreateTopic(nullptr, name, typeStr, props);
+    SetValue(nullptr, topic, value);
+  }
+  mpack_done_array(&reader);
+  m_dirtyPersistent.clear();  // just-loaded values don't need journaling
+  return mpack_reader_destroy(&reader) == mpack_ok;
+}
+
+// journal format: a headerless sequence of snapshot-style [name, typeStr,
+// propertiesJson, valueBin] entries; each server flush appends the entries
+// for topics whose values changed since the previous flush.  The journal is
+// only meaningful alongside the snapshot/JSON files it was appended after;
+// NetworkServer truncates it on every full save.
+std::string SImpl::DumpPersistentJournal() {
+  if (m_dirtyPersistent.empty()) {
+    return {};
+  }
+  Writer w;
+  wpi::SmallVector<char, 128> valueBuf;
+  for (auto topic : m_dirtyPersistent) {
+    if (!topic->persistent || !topic->lastValue) {
+      continue;
+    }
+    mpack_start_array(&w, 4);
+    mpack_write_str(&w, topic->name.data(), topic->name.size());
+    mpack_write_str(&w, topic->typeStr.data(), topic->typeStr.size());
+    auto props = topic->properties.dump();
+    mpack_write_str(&w, props.data(), props.size());
+    valueBuf.clear();
+    wpi::raw_svector_ostream vos{valueBuf};
+    WireEncodeBinary(vos, 0, topic->lastValue.time(), topic->lastValue);
+    mpack_write_bin(&w, valueBuf.data(), valueBuf.size());
+    mpack_finish_array(&w);
+  }
+  m_dirtyPersistent.clear();
+  if (mpack_writer_destroy(&w) != mpack_ok) {
+    return {};
+  }
+  return std::string{reinterpret_cast<char*>(w.bytes.data()), w.bytes.size()};
+}
+
+bool SImpl::LoadPersistentJournal(std::span<const uint8_t> in) {
+  if (in.empty()) {
+    return false;
+  }
+  mpack_reader_t reader;
+  mpack_reader_init_data(&reader, reinterpret_cast<const char*>(in.data()),
+                         in.size());
+  auto time = nt::Now();
+  bool any = false;
+  while (mpack_reader_remaining(&reader, nullptr) > 0) {
+    mpack_expect_array_match(&reader, 4);
+    auto nameLen = mpack_expect_str(&reader);
+    auto nameData = mpack_read_bytes_inplace(&reader, nameLen);
+    std::string name{nameData, nameLen};
+    mpack_done_str(&reader);
+    auto typeLen = mpack_expect_str(&reader);
+    auto typeData = mpack_read_bytes_inplace(&reader, typeLen);
+    std::string typeStr{typeData, typeLen};
+    mpack_done_str(&reader);
+    auto propsLen = mpack_expect_str(&reader);
+    auto propsData = mpack_read_bytes_inplace(&reader, propsLen);
+    std::string propsStr{propsData, propsLen};
+    mpack_done_str(&reader);
+    auto valueLen = mpack_expect_bin(&reader);
+    auto valueData = mpack_read_bytes_inplace(&reader, valueLen);
+    if (mpack_reader_error(&reader) != mpack_ok) {
+      // torn tail from an interrupted append; keep the records already
+      // applied
+      break;
+    }
+    std::span<const uint8_t> valueSpan{
+        reinterpret_cast<const uint8_t*>(valueData), valueLen};
+    int64_t id;
+    Value value;
+    std::string error;
+    if (!WireDecodeBinary(&valueSpan, &id, &value, &error, 0)) {
+      break;
+    }
+    mpack_done_bin(&reader);
+    mpack_done_array(&reader);
+
+    wpi::json props;
+    try {
+      props = wpi::json::parse(propsStr);
+    } catch (wpi::json::parse_error&) {
+      break;
+    }
+    if (!props.is_object()) {
+      break;
+    }
+    // re-stamp with the local clock, same as the JSON persistent load
+    value.SetTime(time);
+    value.SetServerTime(time);
+    auto topic = CreateTopic(nullptr, name, typeStr, props);
+    SetValue(nullptr, topic, value);
+    any = true;
+  }
+  mpack_reader_destroy(&reader);
+  m_dirtyPersistent.clear();  // just-loaded values don't need journaling
+  return any;
+}
+
 bool ServerImpl::PersistentChanged() {
   return m_impl->PersistentChanged();
 }
@@ -2330,6 +3049,31 @@ std::string ServerImpl::LoadPersistent(std::string_view in) {
   return m_impl->LoadPersistent(in);
 }
 
+std::string ServerImpl::DumpPersistentSnapshot() {
+  return m_impl->DumpPersistentSnapshot();
+}
+
+bool ServerImpl::LoadPersistentSnapshot(std::span<const uint8_t> in) {
+  return m_impl->LoadPersistentSnapshot(in);
+}
+
+std::string ServerImpl::DumpPersistentJournal() {
+  return m_impl->DumpPersistentJournal();
+}
+
+bool ServerImpl::LoadPersistentJournal(std::span<const uint8_t> in) {
+  return m_impl->LoadPersistentJournal(in);
+}
+
+void ServerImpl::StartDataLog(wpi::log::DataLog& log, std::string_view prefix,
+                              std::string_view logPrefix) {
+  m_impl->StartDataLog(log, prefix, logPrefix);
+}
+
+void ServerImpl::StopDataLog() {
+  m_impl->StopDataLog();
+}
+
 void ServerStartup::Publish(NT_Publisher pubHandle, NT_Topic topicHandle,
                             std::string_view name, std::string_view typeStr,
                             const wpi::json& properties,
@@ -20,6 +20,10 @@ namespace wpi {
 class Logger;
 }  // namespace wpi
 
+namespace wpi::log {
+class DataLog;
+}  // namespace wpi::log
+
 namespace nt::net3 {
 class WireConnection3;
 }  // namespace nt::net3
@@ -62,12 +66,42 @@ class ServerImpl final {
 
   void ConnectionsChanged(const std::vector<ConnectionInfo>& conns);
 
-  // if any persistent values changed since the last call to this function
+  // if the persistent topic set or properties changed since the last call to
+  // this function (requires a full rewrite of the persistent file);
+  // value-only changes are instead reported via DumpPersistentJournal()
   bool PersistentChanged();
   std::string DumpPersistent();
   // returns newline-separated errors
   std::string LoadPersistent(std::string_view in);
 
+  // binary snapshot of the persistent topic table (names, types, properties,
+  // last values); much faster to load than the JSON persistent file.  The
+  // JSON file remains the interoperable source of truth; the snapshot is a
+  // startup accelerator only.
+  std::string DumpPersistentSnapshot();
+  // returns true on success; on failure the caller should fall back to
+  // LoadPersistent() with the JSON file
+  bool LoadPersistentSnapshot(std::span<const uint8_t> in);
+
+  // journal of persistent value changes since the last call (or the last
+  // full dump); records use the snapshot entry framing.  NetworkServer
+  // appends this to a sidecar file each flush so steady-state value updates
+  // cost an append instead of a full-file rewrite
+  std::string DumpPersistentJournal();
+  // replays journal records on top of the loaded persistent data; stops at
+  // the first malformed record (e.g. a torn append from a crash) and
+  // returns true if any record was applied
+  bool LoadPersistentJournal(std::span<const uint8_t> in);
+
+  // In-process data log bridge: topics matching prefix are appended to the
+  // data log directly from the server's value-set path, so values published
+  // by remote clients are logged without going through a local subscriber.
+  // Only one bridge may be active at a time.  Must be called from the server
+  // loop thread (see NetworkServer::StartDataLog).
+  void StartDataLog(wpi::log::DataLog& log, std::string_view prefix,
+                    std::string_view logPrefix);
+  void StopDataLog();
+
  private:
   class Impl;
   std::unique_ptr<Impl> m_impl;
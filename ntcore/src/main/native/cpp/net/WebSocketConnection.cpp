@@ -9,12 +9,16 @@
 #include <wpi/SpanExtras.h>
 #include <wpinet/WebSocket.h>
 
+#include "networktables/NetworkTableValue.h"
+
 using namespace nt;
 using namespace nt::net;
 
 static constexpr size_t kAllocSize = 4096;
 static constexpr size_t kTextFrameRolloverSize = 4096;
 static constexpr size_t kBinaryFrameRolloverSize = 8192;
+// minimum raw value size for the zero-copy (borrowed buffer) send path
+static constexpr size_t kBorrowMinSize = 1024;
 
 WebSocketConnection::WebSocketConnection(wpi::WebSocket& ws)
     : m_ws{ws},
@@ -44,14 +48,30 @@ void WebSocketConnection::Flush() {
   }
 
   ++m_sendsActive;
-  m_ws.SendFrames(m_ws_frames, [selfweak = weak_from_this()](auto bufs, auto) {
+  m_ws.SendFrames(m_ws_frames, [selfweak = weak_from_this(),
+                                borrowed = std::move(m_borrowed)](auto bufs,
+                                                                 auto) {
     if (auto self = selfweak.lock()) {
-      self->m_buf_pool.insert(self->m_buf_pool.end(), bufs.begin(), bufs.end());
+      for (auto&& buf : bufs) {
+        // borrowed buffers reference value storage owned by the keep-alive
+        // references in this lambda; don't return them to the pool
+        bool isBorrowed = false;
+        for (auto&& b : borrowed) {
+          if (b.first == buf.base) {
+            isBorrowed = true;
+            break;
+          }
+        }
+        if (!isBorrowed) {
+          self->m_buf_pool.emplace_back(buf);
+        }
+      }
       if (self->m_sendsActive > 0) {
         --self->m_sendsActive;
       }
     }
   });
+  m_borrowed.clear();
   m_frames.clear();
   m_text_buffers.clear();
   m_binary_buffers.clear();
@@ -116,6 +136,26 @@ void WebSocketConnection::FinishSendBinary() {
   m_binary_os.reset();
 }
 
+bool WebSocketConnection::WriteBinaryValue(wpi::raw_ostream& os, int64_t id,
+                                           int64_t time, const Value& value) {
+  if (value.type() == NT_RAW || value.type() == NT_RPC) {
+    auto data = value.GetRaw();
+    if (data.size() >= kBorrowMinSize) {
+      StartSendBinary();
+      WireEncodeBinaryRawHeader(os, id, time, data.size());
+      // reference the value's backing storage directly rather than copying
+      // it into pooled send buffers; a copy of the value keeps the storage
+      // alive until the uv write completes
+      m_binary_os.reset();
+      m_binary_buffers.emplace_back(data);
+      m_borrowed.emplace_back(reinterpret_cast<const char*>(data.data()),
+                              std::make_shared<Value>(value));
+      return true;
+    }
+  }
+  return WireConnection::WriteBinaryValue(os, id, time, value);
+}
+
 wpi::uv::Buffer WebSocketConnection::AllocBuf() {
   if (!m_buf_pool.empty()) {
     auto buf = m_buf_pool.back();
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include <wpi/SmallVector.h>
@@ -34,11 +35,15 @@ class WebSocketConnection final
 
   void Disconnect(std::string_view reason) final;
 
+  wpi::WebSocket& GetWebSocket() { return m_ws; }
+
  private:
   void StartSendText() final;
   void FinishSendText() final;
   void StartSendBinary() final;
   void FinishSendBinary() final;
+  bool WriteBinaryValue(wpi::raw_ostream& os, int64_t id, int64_t time,
+                        const Value& value) final;
 
   wpi::uv::Buffer AllocBuf();
 
@@ -58,6 +63,10 @@ class WebSocketConnection final
   wpi::SmallVector<wpi::uv::Buffer, 4> m_text_buffers;
   wpi::SmallVector<wpi::uv::Buffer, 4> m_binary_buffers;
   std::vector<wpi::uv::Buffer> m_buf_pool;
+  // buffers referencing value backing storage (zero-copy raw sends); these
+  // must not be returned to the pool, and the keep-alive reference is held
+  // until the write completes
+  std::vector<std::pair<const char*, std::shared_ptr<void>>> m_borrowed;
   wpi::raw_uv_ostream m_text_os;
   wpi::raw_uv_ostream m_binary_os;
   size_t m_text_pos = 0;
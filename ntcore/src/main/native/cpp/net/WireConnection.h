@@ -10,6 +10,12 @@
 
 #include <wpi/raw_ostream.h>
 
+#include "WireEncoder.h"
+
+namespace nt {
+class Value;
+}  // namespace nt
+
 namespace nt::net {
 
 class BinaryWriter;
@@ -37,6 +43,15 @@ class WireConnection {
   virtual void FinishSendText() = 0;
   virtual void StartSendBinary() = 0;
   virtual void FinishSendBinary() = 0;
+
+  // Append a value message to the binary stream.  The default implementation
+  // encodes the value into the stream; implementations may take a zero-copy
+  // path that references the value's backing storage directly.
+  virtual bool WriteBinaryValue(wpi::raw_ostream& os, int64_t id, int64_t time,
+                                const Value& value) {
+    StartSendBinary();
+    return WireEncodeBinary(os, id, time, value);
+  }
 };
 
 class TextWriter {
@@ -100,6 +115,13 @@ class BinaryWriter {
     m_wire->StartSendBinary();
     return *m_os;
   }
+
+  // Append a value message.  The wire may take a zero-copy path for large
+  // raw values (see WireConnection::WriteBinaryValue).
+  bool WriteValue(int64_t id, int64_t time, const Value& value) {
+    return m_wire->WriteBinaryValue(*m_os, id, time, value);
+  }
+
   WireConnection& wire() { return *m_wire; }
 
  private:
@@ -5,8 +5,11 @@
 #include "WireDecoder.h"
 
 #include <algorithm>
+#include <bit>
+#include <cstring>
 
 #include <fmt/format.h>
+#include <wpi/Endian.h>
 #include <wpi/Logger.h>
 #include <wpi/SpanExtras.h>
 #include <wpi/json.h>
@@ -266,6 +269,30 @@ static void WireDecodeTextImpl(std::string_view in, T& out,
               options.topicsOnly = *topicsOnly;
             }
 
+            // delta capability
+            auto deltaIt = joptions->find("delta");
+            if (deltaIt != joptions->end()) {
+              auto delta = deltaIt->second.get_ptr<bool*>();
+              if (!delta) {
+                error = "delta value must be a boolean";
+                goto err;
+              }
+              options.deltaCapable = *delta;
+            }
+
+            // server-side coalescing window depth
+            auto coalesceIt = joptions->find("coalesce");
+            if (coalesceIt != joptions->end()) {
+              double coalesce;
+              if (!GetNumber(coalesceIt->second, &coalesce)) {
+                error = "coalesce value must be a number";
+                goto err;
+              }
+              if (coalesce > 1) {
+                options.serverCoalesce = static_cast<size_t>(coalesce);
+              }
+            }
+
             // prefix match
             auto prefixMatchIt = joptions->find("prefix");
             if (prefixMatchIt != joptions->end()) {
@@ -420,7 +447,10 @@ void nt::net::WireDecodeText(std::string_view in, ServerMessageHandler& out,
 
 bool nt::net::WireDecodeBinary(std::span<const uint8_t>* in, int64_t* outId,
                                Value* outValue, std::string* error,
-                               int64_t localTimeOffset) {
+                               int64_t localTimeOffset, bool* outIsDelta) {
+  if (outIsDelta) {
+    *outIsDelta = false;
+  }
   mpack_reader_t reader;
   mpack_reader_init_data(&reader, reinterpret_cast<const char*>(in->data()),
                          in->size());
@@ -463,6 +493,36 @@ bool nt::net::WireDecodeBinary(std::span<const uint8_t>* in, int64_t* outId,
     case 16: {  // boolean array
       auto length = mpack_expect_array(&reader);
       std::vector<int> arr;
+#if !MPACK_READ_TRACKING
+      // fast path: a homogeneous boolean array body is one tag byte per
+      // element; validate and convert it in a single pass
+      {
+        const char* data;
+        size_t remaining = mpack_reader_remaining(&reader, &data);
+        if (mpack_reader_error(&reader) == mpack_ok && remaining >= length) {
+          bool homogeneous = true;
+          for (uint32_t i = 0; i < length; ++i) {
+            auto tag = static_cast<uint8_t>(data[i]);
+            if (tag != 0xc2u && tag != 0xc3u) {
+              homogeneous = false;
+              break;
+            }
+          }
+          if (homogeneous) {
+            arr.resize(length);
+            for (uint32_t i = 0; i < length; ++i) {
+              arr[i] = static_cast<uint8_t>(data[i]) == 0xc3u;
+            }
+            mpack_skip_bytes(&reader, length);
+            if (mpack_reader_error(&reader) == mpack_ok) {
+              *outValue = Value::MakeBooleanArray(std::move(arr), 1);
+            }
+            mpack_done_array(&reader);
+            break;
+          }
+        }
+      }
+#endif
       arr.reserve((std::min)(length, 1000u));
       for (uint32_t i = 0; i < length; ++i) {
         arr.emplace_back(mpack_expect_bool(&reader));
@@ -495,6 +555,38 @@ bool nt::net::WireDecodeBinary(std::span<const uint8_t>* in, int64_t* outId,
     case 19: {  // float array
       auto length = mpack_expect_array(&reader);
       std::vector<float> arr;
+#if !MPACK_READ_TRACKING
+      // fast path: a homogeneous float32 array body (as our encoder emits)
+      // is a fixed-stride run of 0xca-prefixed big-endian floats; byteswap
+      // and convert the whole array in one pass
+      {
+        const char* data;
+        size_t remaining = mpack_reader_remaining(&reader, &data);
+        if (mpack_reader_error(&reader) == mpack_ok &&
+            remaining >= static_cast<size_t>(length) * 5) {
+          bool homogeneous = true;
+          for (uint32_t i = 0; i < length; ++i) {
+            if (static_cast<uint8_t>(data[i * 5]) != 0xcau) {
+              homogeneous = false;
+              break;
+            }
+          }
+          if (homogeneous) {
+            arr.resize(length);
+            for (uint32_t i = 0; i < length; ++i) {
+              arr[i] = std::bit_cast<float>(
+                  wpi::support::endian::read32be(&data[i * 5 + 1]));
+            }
+            mpack_skip_bytes(&reader, static_cast<size_t>(length) * 5);
+            if (mpack_reader_error(&reader) == mpack_ok) {
+              *outValue = Value::MakeFloatArray(std::move(arr), 1);
+            }
+            mpack_done_array(&reader);
+            break;
+          }
+        }
+      }
+#endif
       arr.reserve((std::min)(length, 1000u));
       for (uint32_t i = 0; i < length; ++i) {
         arr.emplace_back(mpack_expect_float(&reader));
@@ -511,6 +603,39 @@ bool nt::net::WireDecodeBinary(std::span<const uint8_t>* in, int64_t* outId,
     case 17: {  // double array
       auto length = mpack_expect_array(&reader);
       std::vector<double> arr;
+#if !MPACK_READ_TRACKING
+      // fast path: a homogeneous float64 array body (as our encoder emits)
+      // is a fixed-stride run of 0xcb-prefixed big-endian doubles; byteswap
+      // and convert the whole array in one pass instead of going
+      // element-by-element through mpack
+      {
+        const char* data;
+        size_t remaining = mpack_reader_remaining(&reader, &data);
+        if (mpack_reader_error(&reader) == mpack_ok &&
+            remaining >= static_cast<size_t>(length) * 9) {
+          bool homogeneous = true;
+          for (uint32_t i = 0; i < length; ++i) {
+            if (static_cast<uint8_t>(data[i * 9]) != 0xcbu) {
+              homogeneous = false;
+              break;
+            }
+          }
+          if (homogeneous) {
+            arr.resize(length);
+            for (uint32_t i = 0; i < length; ++i) {
+              arr[i] = std::bit_cast<double>(
+                  wpi::support::endian::read64be(&data[i * 9 + 1]));
+            }
+            mpack_skip_bytes(&reader, static_cast<size_t>(length) * 9);
+            if (mpack_reader_error(&reader) == mpack_ok) {
+              *outValue = Value::MakeDoubleArray(std::move(arr), 1);
+            }
+            mpack_done_array(&reader);
+            break;
+          }
+        }
+      }
+#endif
       arr.reserve((std::min)(length, 1000u));
       for (uint32_t i = 0; i < length; ++i) {
         arr.emplace_back(mpack_expect_double(&reader));
@@ -544,6 +669,21 @@ bool nt::net::WireDecodeBinary(std::span<const uint8_t>* in, int64_t* outId,
       mpack_done_array(&reader);
       break;
     }
+    case kBinaryDeltaType: {  // string/raw delta (internal extension)
+      if (!outIsDelta) {
+        *error = "unexpected delta value";
+        return false;
+      }
+      auto length = mpack_expect_bin(&reader);
+      auto data = mpack_read_bytes_inplace(&reader, length);
+      if (mpack_reader_error(&reader) == mpack_ok) {
+        *outValue =
+            Value::MakeRaw({reinterpret_cast<const uint8_t*>(data), length}, 1);
+        *outIsDelta = true;
+      }
+      mpack_done_bin(&reader);
+      break;
+    }
     default:
       *error = fmt::format("unrecognized type {}", type);
       return false;
@@ -57,8 +57,11 @@ void WireDecodeText(std::string_view in, ServerMessageHandler& out,
                     wpi::Logger& logger);
 
 // returns true if successfully decoded a message
+// outIsDelta, if provided, enables decoding of delta value frames (see
+// kBinaryDeltaType); for a delta frame, outValue receives the raw patch blob
+// and *outIsDelta is set to true
 bool WireDecodeBinary(std::span<const uint8_t>* in, int64_t* outId,
                       Value* outValue, std::string* error,
-                      int64_t localTimeOffset);
+                      int64_t localTimeOffset, bool* outIsDelta = nullptr);
 
 }  // namespace nt::net
@@ -5,6 +5,7 @@
 #include "WireEncoder.h"
 
 #include <optional>
+#include <variant>
 
 #include <wpi/json_serializer.h>
 #include <wpi/mpack.h>
@@ -80,10 +81,12 @@ static void WireEncodeSubscribeImpl(wpi::raw_ostream& os, int64_t subuid,
   wpi::json::serializer s{os, ' ', 0};
   os << "{\"method\":\"" << SubscribeMsg::kMethodStr << "\",\"params\":{";
   os << "\"options\":{";
-  bool first = true;
+  // always advertise delta-decode capability; servers without delta support
+  // ignore unknown option keys
+  os << "\"delta\":true";
+  bool first = false;
   if (options.sendAll) {
-    os << "\"all\":true";
-    first = false;
+    os << ",\"all\":true";
   }
   if (options.topicsOnly) {
     if (!first) {
@@ -105,6 +108,14 @@ static void WireEncodeSubscribeImpl(wpi::raw_ostream& os, int64_t subuid,
     }
     os << "\"periodic\":";
     s.dump_float(options.periodic);
+    first = false;
+  }
+  if (options.serverCoalesce > 1) {
+    if (!first) {
+      os << ',';
+    }
+    os << "\"coalesce\":";
+    s.dump_integer(static_cast<uint64_t>(options.serverCoalesce));
   }
   os << "},\"topics\":";
   EncodePrefixes(os, topicNames, s);
@@ -314,3 +325,136 @@ bool nt::net::WireEncodeBinary(wpi::raw_ostream& os, int64_t id, int64_t time,
   mpack_finish_array(&writer);
   return mpack_writer_destroy(&writer) == mpack_ok;
 }
+
+// canonical shortest-form MessagePack integer encoding; hand-encoded so the
+// header can be emitted without running the payload through an mpack writer
+static void EncodeMPackInt(wpi::raw_ostream& os, int64_t v) {
+  auto u8 = [&](uint8_t b) { os << static_cast<char>(b); };
+  auto be = [&](uint64_t val, unsigned int bytes) {
+    for (unsigned int i = bytes; i != 0; --i) {
+      u8(static_cast<uint8_t>(val >> ((i - 1) * 8)));
+    }
+  };
+  if (v >= 0) {
+    if (v < 0x80) {
+      u8(static_cast<uint8_t>(v));
+    } else if (v <= UINT8_MAX) {
+      u8(0xccu);
+      be(v, 1);
+    } else if (v <= UINT16_MAX) {
+      u8(0xcdu);
+      be(v, 2);
+    } else if (v <= UINT32_MAX) {
+      u8(0xceu);
+      be(v, 4);
+    } else {
+      u8(0xcfu);
+      be(v, 8);
+    }
+  } else {
+    if (v >= -32) {
+      u8(static_cast<uint8_t>(v));
+    } else if (v >= INT8_MIN) {
+      u8(0xd0u);
+      be(static_cast<uint64_t>(v), 1);
+    } else if (v >= INT16_MIN) {
+      u8(0xd1u);
+      be(static_cast<uint64_t>(v), 2);
+    } else if (v >= INT32_MIN) {
+      u8(0xd2u);
+      be(static_cast<uint64_t>(v), 4);
+    } else {
+      u8(0xd3u);
+      be(static_cast<uint64_t>(v), 8);
+    }
+  }
+}
+
+static void EncodeMPackBinHeader(wpi::raw_ostream& os, size_t size) {
+  auto u8 = [&](uint8_t b) { os << static_cast<char>(b); };
+  if (size <= UINT8_MAX) {
+    u8(0xc4u);  // bin 8
+    u8(static_cast<uint8_t>(size));
+  } else if (size <= UINT16_MAX) {
+    u8(0xc5u);  // bin 16
+    u8(static_cast<uint8_t>(size >> 8));
+    u8(static_cast<uint8_t>(size));
+  } else {
+    u8(0xc6u);  // bin 32
+    u8(static_cast<uint8_t>(size >> 24));
+    u8(static_cast<uint8_t>(size >> 16));
+    u8(static_cast<uint8_t>(size >> 8));
+    u8(static_cast<uint8_t>(size));
+  }
+}
+
+void nt::net::WireEncodeBinaryRawHeader(wpi::raw_ostream& os, int64_t id,
+                                        int64_t time, size_t size) {
+  auto u8 = [&](uint8_t b) { os << static_cast<char>(b); };
+  u8(0x94u);  // 4-element array
+  EncodeMPackInt(os, id);
+  EncodeMPackInt(os, time);
+  u8(5);  // raw type
+  EncodeMPackBinHeader(os, size);
+}
+
+void nt::net::WireEncodeBinaryDelta(wpi::raw_ostream& os, int64_t id,
+                                    int64_t time, uint32_t prefixLen,
+                                    uint32_t suffixLen,
+                                    std::span<const uint8_t> middle) {
+  auto u8 = [&](uint8_t b) { os << static_cast<char>(b); };
+  auto be32 = [&](uint32_t val) {
+    for (unsigned int i = 4; i != 0; --i) {
+      u8(static_cast<uint8_t>(val >> ((i - 1) * 8)));
+    }
+  };
+  u8(0x94u);  // 4-element array
+  EncodeMPackInt(os, id);
+  EncodeMPackInt(os, time);
+  EncodeMPackInt(os, kBinaryDeltaType);
+  EncodeMPackBinHeader(os, middle.size() + 8);
+  be32(prefixLen);
+  be32(suffixLen);
+  os << std::string_view{reinterpret_cast<const char*>(middle.data()),
+                         middle.size()};
+}
+
+size_t nt::net::WireEncodeTextBatch(WireEncodeBuffer& buf,
+                                    std::span<const ClientMessage> msgs) {
+  size_t count = 0;
+  auto& os = buf.stream();
+  for (auto&& msg : msgs) {
+    if (std::holds_alternative<ClientValueMsg>(msg.contents)) {
+      continue;
+    }
+    if (count != 0) {
+      os << ',';
+    }
+    if (!WireEncodeText(os, msg)) {
+      // shouldn't happen, but just in case...
+      os << "{}";
+    }
+    ++count;
+  }
+  return count;
+}
+
+size_t nt::net::WireEncodeBinaryBatch(WireEncodeBuffer& buf,
+                                      std::span<const ClientMessage> msgs,
+                                      int64_t serverTimeOffsetUs) {
+  size_t count = 0;
+  auto& os = buf.stream();
+  for (auto&& msg : msgs) {
+    if (auto m = std::get_if<ClientValueMsg>(&msg.contents)) {
+      int64_t time = m->value.time();
+      if (time != 0) {
+        time += serverTimeOffsetUs;
+      }
+      if (WireEncodeBinary(os, Handle{m->pubHandle}.GetIndex(), time,
+                           m->value)) {
+        ++count;
+      }
+    }
+  }
+  return count;
+}
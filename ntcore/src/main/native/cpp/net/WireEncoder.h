@@ -9,9 +9,11 @@
 #include <string>
 #include <string_view>
 
+#include <wpi/SmallVector.h>
+#include <wpi/raw_ostream.h>
+
 namespace wpi {
 class json;
-class raw_ostream;
 }  // namespace wpi
 
 namespace nt {
@@ -58,4 +60,51 @@ bool WireEncodeText(wpi::raw_ostream& os, const ServerMessage& msg);
 bool WireEncodeBinary(wpi::raw_ostream& os, int64_t id, int64_t time,
                       const Value& value);
 
+// Encode the header of a binary raw-value message (everything except the
+// payload bytes).  Used by zero-copy send paths that append the value's
+// backing storage directly after the header.
+// encodes a complete delta value frame (type kBinaryDeltaType); middle is
+// the replacement bytes between the retained prefix and suffix
+void WireEncodeBinaryDelta(wpi::raw_ostream& os, int64_t id, int64_t time,
+                           uint32_t prefixLen, uint32_t suffixLen,
+                           std::span<const uint8_t> middle);
+
+void WireEncodeBinaryRawHeader(wpi::raw_ostream& os, int64_t id, int64_t time,
+                               size_t size);
+
+// Reusable buffer for batch encoding.  Clear() retains the underlying
+// storage, so once the buffer has grown to the flush high-water mark,
+// encoding a steady-state outgoing queue performs no heap allocation.
+class WireEncodeBuffer {
+ public:
+  WireEncodeBuffer() : m_os{m_buf} {}
+  WireEncodeBuffer(const WireEncodeBuffer&) = delete;
+  WireEncodeBuffer& operator=(const WireEncodeBuffer&) = delete;
+
+  wpi::raw_ostream& stream() { return m_os; }
+  std::string_view view() const { return {m_buf.data(), m_buf.size()}; }
+  size_t size() const { return m_buf.size(); }
+  bool empty() const { return m_buf.empty(); }
+  void Clear() { m_buf.clear(); }
+
+ private:
+  wpi::SmallVector<char, 4096> m_buf;
+  wpi::raw_svector_ostream m_os;
+};
+
+// Batch encode an entire queue of client text messages in a single pass.
+// Messages are appended comma-separated without surrounding brackets; as
+// with WireEncodeText, the caller's framing must supply the enclosing JSON
+// array.  Value messages in the queue are skipped (use
+// WireEncodeBinaryBatch).  Returns the number of messages encoded.
+size_t WireEncodeTextBatch(WireEncodeBuffer& buf,
+                           std::span<const ClientMessage> msgs);
+
+// Batch encode the value messages in a queue of client messages as
+// consecutive binary messages, applying the given local-to-server time
+// offset to nonzero timestamps.  Returns the number of messages encoded.
+size_t WireEncodeBinaryBatch(WireEncodeBuffer& buf,
+                             std::span<const ClientMessage> msgs,
+                             int64_t serverTimeOffsetUs);
+
 }  // namespace nt::net
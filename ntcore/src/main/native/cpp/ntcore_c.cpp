@@ -416,6 +416,10 @@ NT_Bool NT_WaitForListenerQueue(NT_Handle handle, double timeout) {
   return nt::WaitForListenerQueue(handle, timeout);
 }
 
+void NT_SetListenerDispatchThreadCount(NT_Inst inst, unsigned int count) {
+  nt::SetListenerDispatchThreadCount(inst, count);
+}
+
 NT_Listener NT_AddListenerSingle(NT_Inst inst, const char* prefix,
                                  size_t prefix_len, unsigned int mask,
                                  void* data, NT_ListenerCallback callback) {
@@ -554,6 +558,13 @@ NT_Bool NT_IsConnected(NT_Inst inst) {
   return nt::IsConnected(inst);
 }
 
+void NT_GetTimeSyncInfo(NT_Inst inst, struct NT_TimeSyncInfo* info) {
+  auto cppInfo = nt::GetTimeSyncInfo(inst);
+  info->serverTimeOffset = cppInfo.serverTimeOffset;
+  info->uncertainty = cppInfo.uncertainty;
+  info->valid = cppInfo.valid;
+}
+
 struct NT_ConnectionInfo* NT_GetConnections(NT_Inst inst, size_t* count) {
   auto conn_v = nt::GetConnections(inst);
   return ConvertToC<NT_ConnectionInfo>(conn_v, count);
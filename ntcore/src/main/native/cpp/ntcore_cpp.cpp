@@ -145,6 +145,23 @@ std::vector<Value> ReadQueueValue(NT_Handle subentry) {
   }
 }
 
+size_t ReadQueueValue(NT_Handle subentry, std::vector<Value>* out) {
+  if (auto ii = InstanceImpl::GetHandle(subentry)) {
+    return ii->localStorage.ReadQueueValue(subentry, out);
+  } else {
+    out->clear();
+    return 0;
+  }
+}
+
+std::shared_ptr<LatestValueCell> GetLatestValueCell(NT_Handle subentry) {
+  if (auto ii = InstanceImpl::GetHandle(subentry)) {
+    return ii->localStorage.GetLatestValueCell(subentry);
+  } else {
+    return nullptr;
+  }
+}
+
 /*
  * Topic Functions
  */
@@ -457,6 +474,12 @@ bool WaitForListenerQueue(NT_Handle handle, double timeout) {
   }
 }
 
+void SetListenerDispatchThreadCount(NT_Inst inst, unsigned int count) {
+  if (auto ii = InstanceImpl::GetTyped(inst, Handle::kInstance)) {
+    ii->listenerStorage.SetDispatchThreadCount(count);
+  }
+}
+
 NT_Listener AddListener(NT_Inst inst,
                         std::span<const std::string_view> prefixes,
                         unsigned int mask, ListenerCallback callback) {
@@ -576,6 +599,24 @@ void StopConnectionDataLog(NT_ConnectionDataLogger logger) {
   }
 }
 
+void StartServerEntryDataLog(NT_Inst inst, wpi::log::DataLog& log,
+                             std::string_view prefix,
+                             std::string_view logPrefix) {
+  if (auto ii = InstanceImpl::GetTyped(inst, Handle::kInstance)) {
+    if (auto server = ii->GetServer()) {
+      server->StartDataLog(log, prefix, logPrefix);
+    }
+  }
+}
+
+void StopServerEntryDataLog(NT_Inst inst) {
+  if (auto ii = InstanceImpl::GetTyped(inst, Handle::kInstance)) {
+    if (auto server = ii->GetServer()) {
+      server->StopDataLog();
+    }
+  }
+}
+
 /*
  * Client/Server Functions
  */
@@ -729,6 +770,19 @@ bool IsConnected(NT_Inst inst) {
   }
 }
 
+TimeSyncInfo GetTimeSyncInfo(NT_Inst inst) {
+  if (auto ii = InstanceImpl::GetTyped(inst, Handle::kInstance)) {
+    if (auto client = ii->GetClient()) {
+      return client->GetTimeSyncInfo();
+    }
+    // servers and local-only instances are the time authority
+    if ((ii->networkMode & (NT_NET_MODE_SERVER | NT_NET_MODE_LOCAL)) != 0) {
+      return {0, 0, true};
+    }
+  }
+  return {};
+}
+
 NT_Listener AddLogger(NT_Inst inst, unsigned int minLevel,
                       unsigned int maxLevel, ListenerCallback func) {
   if (auto ii = InstanceImpl::GetTyped(inst, Handle::kInstance)) {
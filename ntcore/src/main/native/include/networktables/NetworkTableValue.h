@@ -414,11 +414,13 @@ class Value final {
    *             time)
    * @return The entry value
    */
-  template <typename T, typename std::enable_if<
-                            std::is_same<T, std::vector<uint8_t>>::value>::type>
+  template <typename T,
+            typename std::enable_if<
+                std::is_same<std::remove_cvref_t<T>,
+                             std::vector<uint8_t>>::value>::type* = nullptr>
   static Value MakeRaw(T&& value, int64_t time = 0) {
     Value val{NT_RAW, time, private_init{}};
-    auto data = std::make_shared<std::vector<uint8_t>>(std::forward(value));
+    auto data = std::make_shared<std::vector<uint8_t>>(std::forward<T>(value));
     val.m_val.data.v_raw.data = const_cast<uint8_t*>(data->data());
     val.m_val.data.v_raw.size = data->size();
     val.m_storage = std::move(data);
@@ -0,0 +1,362 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "networktables/Topic.h"
+
+namespace wpi {
+class json;
+}  // namespace wpi
+
+namespace nt {
+
+template <typename T>
+class StructTopic;
+
+/**
+ * Timestamped struct.
+ *
+ * @tparam T struct type; must be trivially copyable and standard layout
+ */
+template <typename T>
+struct TimestampedStruct {
+  TimestampedStruct() = default;
+  TimestampedStruct(int64_t time, int64_t serverTime, T value)
+      : time{time}, serverTime{serverTime}, value{value} {}
+
+  /**
+   * Time in local time base.
+   */
+  int64_t time = 0;
+
+  /**
+   * Time in server time base.  May be 0 or 1 for locally set values.
+   */
+  int64_t serverTime = 0;
+
+  /**
+   * Value.
+   */
+  T value = {};
+};
+
+/**
+ * NetworkTables packed-struct subscriber.
+ *
+ * @tparam T struct type; must be trivially copyable and standard layout
+ */
+template <typename T>
+class StructSubscriber : public Subscriber {
+  static_assert(std::is_trivially_copyable_v<T> && std::is_standard_layout_v<T>,
+                "StructSubscriber requires a trivially copyable standard "
+                "layout type");
+
+ public:
+  using TopicType = StructTopic<T>;
+  using ValueType = T;
+  using ParamType = const T&;
+  using TimestampedValueType = TimestampedStruct<T>;
+
+  StructSubscriber() = default;
+
+  /**
+   * Construct from a subscriber handle; recommended to use
+   * StructTopic::Subscribe() instead.
+   *
+   * @param handle Native handle
+   * @param defaultValue Default value
+   */
+  StructSubscriber(NT_Subscriber handle, ParamType defaultValue);
+
+  /**
+   * Get the last published value.
+   * If no value has been published, or the published value's size does not
+   * match sizeof(T), returns the stored default value.
+   *
+   * @return value
+   */
+  ValueType Get() const;
+
+  /**
+   * Get the last published value.
+   * If no value has been published, or the published value's size does not
+   * match sizeof(T), returns the passed defaultValue.
+   *
+   * @param defaultValue default value to return if no value has been published
+   * @return value
+   */
+  ValueType Get(ParamType defaultValue) const;
+
+  /**
+   * Get the last published value along with its timestamp.
+   * If no value has been published, returns the stored default value and a
+   * timestamp of 0.
+   *
+   * @return timestamped value
+   */
+  TimestampedValueType GetAtomic() const;
+
+  /**
+   * Get the last published value along with its timestamp.
+   * If no value has been published, returns the passed defaultValue and a
+   * timestamp of 0.
+   *
+   * @param defaultValue default value to return if no value has been published
+   * @return timestamped value
+   */
+  TimestampedValueType GetAtomic(ParamType defaultValue) const;
+
+  /**
+   * Get an array of all value changes since the last call to ReadQueue.
+   * Also provides a timestamp for each value.  Values whose size does not
+   * match sizeof(T) are skipped.
+   *
+   * @note The "poll storage" subscribe option can be used to set the queue
+   *     depth.
+   *
+   * @return Array of timestamped values; empty array if no new changes have
+   *     been published since the previous call.
+   */
+  std::vector<TimestampedValueType> ReadQueue();
+
+  /**
+   * Get the corresponding topic.
+   *
+   * @return Topic
+   */
+  TopicType GetTopic() const;
+
+ private:
+  ValueType m_defaultValue;
+};
+
+/**
+ * NetworkTables packed-struct publisher.
+ *
+ * @tparam T struct type; must be trivially copyable and standard layout
+ */
+template <typename T>
+class StructPublisher : public Publisher {
+  static_assert(std::is_trivially_copyable_v<T> && std::is_standard_layout_v<T>,
+                "StructPublisher requires a trivially copyable standard "
+                "layout type");
+
+ public:
+  using TopicType = StructTopic<T>;
+  using ValueType = T;
+  using ParamType = const T&;
+
+  using TimestampedValueType = TimestampedStruct<T>;
+
+  StructPublisher() = default;
+
+  /**
+   * Construct from a publisher handle; recommended to use
+   * StructTopic::Publish() instead.
+   *
+   * @param handle Native handle
+   */
+  explicit StructPublisher(NT_Publisher handle);
+
+  /**
+   * Publish a new value.  The struct's bytes are sent directly as a
+   * fixed-layout raw value with no per-field encoding.
+   *
+   * @param value value to publish
+   * @param time timestamp; 0 indicates current NT time should be used
+   */
+  void Set(ParamType value, int64_t time = 0);
+
+  /**
+   * Publish a default value.
+   * On reconnect, a default value will never be used in preference to a
+   * published value.
+   *
+   * @param value value
+   */
+  void SetDefault(ParamType value);
+
+  /**
+   * Get the corresponding topic.
+   *
+   * @return Topic
+   */
+  TopicType GetTopic() const;
+};
+
+/**
+ * NetworkTables packed-struct entry.
+ *
+ * @note Unlike NetworkTableEntry, the entry goes away when this is destroyed.
+ *
+ * @tparam T struct type; must be trivially copyable and standard layout
+ */
+template <typename T>
+class StructEntry final : public StructSubscriber<T>,
+                          public StructPublisher<T> {
+ public:
+  using SubscriberType = StructSubscriber<T>;
+  using PublisherType = StructPublisher<T>;
+  using TopicType = StructTopic<T>;
+  using ValueType = T;
+  using ParamType = const T&;
+
+  using TimestampedValueType = TimestampedStruct<T>;
+
+  StructEntry() = default;
+
+  /**
+   * Construct from an entry handle; recommended to use
+   * StructTopic::GetEntry() instead.
+   *
+   * @param handle Native handle
+   * @param defaultValue Default value
+   */
+  StructEntry(NT_Entry handle, ParamType defaultValue);
+
+  /**
+   * Determines if the native handle is valid.
+   *
+   * @return True if the native handle is valid, false otherwise.
+   */
+  explicit operator bool() const { return this->m_subHandle != 0; }
+
+  /**
+   * Gets the native handle for the entry.
+   *
+   * @return Native handle
+   */
+  NT_Entry GetHandle() const { return this->m_subHandle; }
+
+  /**
+   * Get the corresponding topic.
+   *
+   * @return Topic
+   */
+  TopicType GetTopic() const;
+
+  /**
+   * Stops publishing the entry if it's published.
+   */
+  void Unpublish();
+};
+
+/**
+ * NetworkTables packed-struct topic.  Values are sent as fixed-layout binary
+ * blobs using the raw data type: one memcpy-equivalent encode per value
+ * instead of per-field encoding, which matters for high-rate topics like
+ * pose streams.  Publishers register the field-layout schema (a JSON array
+ * of name/type/offset objects, e.g. from wpi::log::StructSchemaBuilder) as
+ * the "struct" topic property once, so subscribers in any language can
+ * decode the blobs without compiled-in knowledge of the type.
+ *
+ * The publisher and subscriber must use the same struct layout; the type
+ * string (e.g. "struct:Pose2d") and schema property can be checked at
+ * runtime to verify this.
+ *
+ * @tparam T struct type; must be trivially copyable and standard layout
+ */
+template <typename T>
+class StructTopic final : public Topic {
+  static_assert(std::is_trivially_copyable_v<T> && std::is_standard_layout_v<T>,
+                "StructTopic requires a trivially copyable standard layout "
+                "type");
+
+ public:
+  using SubscriberType = StructSubscriber<T>;
+  using PublisherType = StructPublisher<T>;
+  using EntryType = StructEntry<T>;
+  using ValueType = T;
+  using ParamType = const T&;
+  using TimestampedValueType = TimestampedStruct<T>;
+
+  StructTopic() = default;
+
+  /**
+   * Construct from a topic handle.
+   *
+   * @param handle Native handle
+   */
+  explicit StructTopic(NT_Topic handle) : Topic{handle} {}
+
+  /**
+   * Construct from a generic topic.
+   *
+   * @param topic Topic
+   */
+  explicit StructTopic(Topic topic) : Topic{topic} {}
+
+  /**
+   * Create a new subscriber to the topic.
+   *
+   * <p>The subscriber is only active as long as the returned object
+   * is not destroyed.
+   *
+   * @note Subscribers that do not match the published data type do not return
+   *     any values. To determine if the data type matches, use the appropriate
+   *     Topic functions.
+   *
+   * @param typeString type string (e.g. "struct:Pose2d"); must match the
+   *        publisher's type string
+   * @param defaultValue default value used when a default is not provided to a
+   *        getter function
+   * @param options subscribe options
+   * @return subscriber
+   */
+  [[nodiscard]] SubscriberType Subscribe(
+      std::string_view typeString, ParamType defaultValue = T{},
+      std::span<const PubSubOption> options = {});
+
+  /**
+   * Create a new publisher to the topic.  The field-layout schema is
+   * registered as the "struct" topic property.
+   *
+   * The publisher is only active as long as the returned object
+   * is not destroyed.
+   *
+   * @note It is not possible to publish two different data types to the same
+   *     topic. Conflicts between publishers are typically resolved by the
+   *     server on a first-come, first-served basis. Any published values that
+   *     do not match the topic's data type are dropped (ignored). To determine
+   *     if the data type matches, use the appropriate Topic functions.
+   *
+   * @param typeString type string (e.g. "struct:Pose2d")
+   * @param schema field-layout schema (JSON array of name/type/offset
+   *        objects)
+   * @param options publish options
+   * @return publisher
+   */
+  [[nodiscard]] PublisherType Publish(
+      std::string_view typeString, const wpi::json& schema,
+      std::span<const PubSubOption> options = {});
+
+  /**
+   * Create a new entry for the topic.  The field-layout schema is registered
+   * as the "struct" topic property when the entry is first published to.
+   *
+   * About the entry lifetime: it is the subscriber's lifetime.
+   *
+   * @param typeString type string (e.g. "struct:Pose2d"); must match the
+   *        publisher's type string
+   * @param defaultValue default value used when a default is not provided to a
+   *        getter function
+   * @param options subscribe options
+   * @return entry
+   */
+  [[nodiscard]] EntryType GetEntry(std::string_view typeString,
+                                   ParamType defaultValue = T{},
+                                   std::span<const PubSubOption> options = {});
+};
+
+}  // namespace nt
+
+#include "networktables/StructTopic.inc"
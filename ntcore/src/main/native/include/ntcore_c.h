@@ -95,6 +95,7 @@ enum NT_PubSubOptionType {
   NT_PUBSUB_TOPICSONLY,     /* only send topic changes, no value changes */
   NT_PUBSUB_POLLSTORAGE,    /* polling storage for subscription */
   NT_PUBSUB_KEEPDUPLICATES, /* preserve duplicate values */
+  NT_PUBSUB_COALESCE,       /* newest N samples per period over the network */
 };
 
 /** Event notification flags. */
@@ -229,6 +230,21 @@ struct NT_ConnectionInfo {
   unsigned int protocol_version;
 };
 
+/** NetworkTables Time Sync Information */
+struct NT_TimeSyncInfo {
+  /**
+   * Current estimate of the offset between the server clock and the local
+   * clock (server time - local time), in microseconds.
+   */
+  int64_t serverTimeOffset;
+
+  /** Bound on the error of serverTimeOffset, in microseconds. */
+  int64_t uncertainty;
+
+  /** True if the offset estimate is valid. */
+  NT_Bool valid;
+};
+
 /** NetworkTables value event data. */
 struct NT_ValueEventData {
   /** Topic handle. */
@@ -863,6 +879,19 @@ void NT_RemoveListener(NT_Listener listener);
  */
 NT_Bool NT_WaitForListenerQueue(NT_Handle handle, double timeout);
 
+/**
+ * Sets the number of threads used to dispatch callback listeners for an
+ * instance. Callback listeners added after the count is raised are
+ * partitioned round-robin across the dispatch threads; a slow or blocked
+ * callback only stalls listeners on its own thread. Per-listener event
+ * ordering is preserved. The default is 1 (a single dispatch thread);
+ * listeners added before the count is raised stay on their original thread.
+ *
+ * @param inst  instance handle
+ * @param count number of dispatch threads (minimum 1)
+ */
+void NT_SetListenerDispatchThreadCount(NT_Inst inst, unsigned int count);
+
 /**
  * Create a listener for changes to topics with names that start with
  * the given prefix. This creates a corresponding internal subscriber with the
@@ -1151,6 +1180,19 @@ struct NT_ConnectionInfo* NT_GetConnections(NT_Inst inst, size_t* count);
  */
 NT_Bool NT_IsConnected(NT_Inst inst);
 
+/**
+ * Get the current time sync state.
+ *
+ * For a client, returns the filtered estimate of the server clock offset
+ * along with an uncertainty bound.  For a server or local-only instance, the
+ * offset is 0 with no uncertainty.  Returns an invalid (valid == 0) result
+ * for a client that has not completed a time sync exchange.
+ *
+ * @param inst  instance handle
+ * @param info  returns the time sync information
+ */
+void NT_GetTimeSyncInfo(NT_Inst inst, struct NT_TimeSyncInfo* info);
+
 /** @} */
 
 /**
@@ -6,6 +6,7 @@
 
 #include <stdint.h>
 
+#include <atomic>
 #include <cassert>
 #include <functional>
 #include <memory>
@@ -148,6 +149,29 @@ struct ConnectionInfo {
   }
 };
 
+/** NetworkTables Time Sync Information */
+struct TimeSyncInfo {
+  /**
+   * Current estimate of the offset between the server clock and the local
+   * clock (server time - local time, same scale as returned by nt::Now()),
+   * in microseconds.
+   */
+  int64_t serverTimeOffset{0};
+
+  /**
+   * Bound on the error of serverTimeOffset, in microseconds.  Derived from
+   * the round trip time of the best recent time sync exchange plus an
+   * allowance for clock drift since that exchange.
+   */
+  int64_t uncertainty{0};
+
+  /**
+   * True if the offset estimate is valid (a time sync exchange has completed
+   * since connecting, or the instance is the time authority).
+   */
+  bool valid{false};
+};
+
 /** NetworkTables Value Event Data */
 class ValueEventData {
  public:
@@ -324,6 +348,20 @@ class PubSubOption {
     return PubSubOption{NT_PUBSUB_POLLSTORAGE, static_cast<double>(depth)};
   }
 
+  /**
+   * Server-side coalescing for high-rate topics. The server keeps the newest
+   * count samples per periodic window for this subscription instead of only
+   * the latest one, so the wire carries a bounded number of samples per
+   * period. Has no effect if SendAll is enabled, and does not affect local
+   * subscribers or polling storage, which remain full rate. Defaults to 1.
+   *
+   * @param count number of newest samples to send per period
+   * @return option
+   */
+  static constexpr PubSubOption Coalesce(int count) {
+    return PubSubOption{NT_PUBSUB_COALESCE, static_cast<double>(count)};
+  }
+
   NT_PubSubOptionType type;
   double value;
 };
@@ -468,6 +506,94 @@ unsigned int GetEntryFlags(NT_Entry entry);
  */
 std::vector<Value> ReadQueueValue(NT_Handle subentry);
 
+/**
+ * Read Entry Queue.
+ *
+ * Fills a caller-provided buffer with new entry values since last call.
+ * Reusing the same buffer across calls avoids allocation on steady-state
+ * reads.
+ *
+ * @param subentry     subscriber or entry handle
+ * @param out          buffer to fill (cleared first)
+ * @return number of values read
+ */
+size_t ReadQueueValue(NT_Handle subentry, std::vector<Value>* out);
+
+/**
+ * A wait-free snapshot cell for the latest value of a topic.  The cell is
+ * updated on every value publish (under the storage lock) and may be read
+ * from any thread without taking the storage lock; a read is a bounded
+ * optimistic (seqlock) copy of a fixed-size slot, so worst-case read cost
+ * does not depend on concurrent publishes or other storage activity.  Only
+ * boolean, integer, float, and double values are captured.
+ */
+class LatestValueCell {
+ public:
+  /** Snapshot of the cell contents. */
+  struct Snapshot {
+    NT_Type type = NT_UNASSIGNED;
+    int64_t time = 0;
+    int64_t serverTime = 0;
+    union {
+      bool valueBoolean;
+      int64_t valueInteger;
+      float valueFloat;
+      double valueDouble = 0;
+    };
+  };
+
+  /**
+   * Reads the latest value.  Retries only while a concurrent writer is
+   * mid-update (a handful of stores).
+   *
+   * @param out snapshot to fill
+   * @return false if no numeric value has been published yet
+   */
+  bool TryRead(Snapshot* out) const {
+    for (;;) {
+      unsigned int seq1 = m_seq.load(std::memory_order_acquire);
+      if (seq1 == 0) {
+        return false;
+      }
+      if ((seq1 & 1) != 0) {
+        continue;
+      }
+      Snapshot val = m_data;
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (m_seq.load(std::memory_order_relaxed) == seq1) {
+        *out = val;
+        return true;
+      }
+    }
+  }
+
+  /**
+   * Updates the cell.  Only called by storage internals; callers must hold
+   * the storage lock (single writer).
+   */
+  void Write(const Snapshot& data) {
+    unsigned int seq = m_seq.load(std::memory_order_relaxed);
+    m_seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_data = data;
+    m_seq.store(seq + 2, std::memory_order_release);
+  }
+
+ private:
+  std::atomic<unsigned int> m_seq{0};
+  Snapshot m_data;
+};
+
+/**
+ * Gets a wait-free reader cell for the latest value of the subscribed topic.
+ * The cell is shared by all subscribers to the topic and remains safe to
+ * read (but is no longer updated) after the subscriber is destroyed.
+ *
+ * @param subentry     subscriber or entry handle
+ * @return cell, or nullptr if the handle is invalid
+ */
+std::shared_ptr<LatestValueCell> GetLatestValueCell(NT_Handle subentry);
+
 /** @} */
 
 /**
@@ -849,6 +975,19 @@ void RemoveListener(NT_Listener listener);
  */
 bool WaitForListenerQueue(NT_Handle handle, double timeout);
 
+/**
+ * Sets the number of threads used to dispatch callback listeners for an
+ * instance. Callback listeners added after the count is raised are
+ * partitioned round-robin across the dispatch threads; a slow or blocked
+ * callback only stalls listeners on its own thread. Per-listener event
+ * ordering is preserved. The default is 1 (a single dispatch thread);
+ * listeners added before the count is raised stay on their original thread.
+ *
+ * @param inst  instance handle
+ * @param count number of dispatch threads (minimum 1)
+ */
+void SetListenerDispatchThreadCount(NT_Inst inst, unsigned int count);
+
 /**
  * Create a listener for changes to topics with names that start with any of
  * the given prefixes. This creates a corresponding internal subscriber with the
@@ -1089,6 +1228,21 @@ std::vector<ConnectionInfo> GetConnections(NT_Inst inst);
  */
 bool IsConnected(NT_Inst inst);
 
+/**
+ * Get the current time sync state.
+ *
+ * For a client, returns the filtered estimate of the server clock offset
+ * along with an uncertainty bound, so timestamps received from the network
+ * (e.g. vision measurements) can be weighted by their time quality.  For a
+ * server or local-only instance, the instance is the time authority and the
+ * offset is 0 with no uncertainty.  Returns an invalid (valid == false)
+ * result for a client that has not completed a time sync exchange.
+ *
+ * @param inst  instance handle
+ * @return time sync information
+ */
+TimeSyncInfo GetTimeSyncInfo(NT_Inst inst);
+
 /** @} */
 
 /**
@@ -1183,6 +1337,31 @@ NT_ConnectionDataLogger StartConnectionDataLog(NT_Inst inst,
  */
 void StopConnectionDataLog(NT_ConnectionDataLogger logger);
 
+/**
+ * Starts logging topic changes to a DataLog directly from the server's
+ * value-set path.  Unlike StartEntryDataLog(), values published by remote
+ * clients are appended without going through a local subscriber.  Only one
+ * server data log may be active at a time; has no effect if the instance is
+ * not running as a server.
+ *
+ * @param inst instance handle
+ * @param log data log object; lifetime must extend until StopServerEntryDataLog
+ *            is called or the server is stopped
+ * @param prefix only store topics with names that start with this prefix;
+ *               the prefix is not included in the data log entry name
+ * @param logPrefix prefix to add to data log entry names
+ */
+void StartServerEntryDataLog(NT_Inst inst, wpi::log::DataLog& log,
+                             std::string_view prefix,
+                             std::string_view logPrefix);
+
+/**
+ * Stops logging topic changes started with StartServerEntryDataLog().
+ *
+ * @param inst instance handle
+ */
+void StopServerEntryDataLog(NT_Inst inst);
+
 /** @} */
 
 /**
@@ -0,0 +1,99 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <wpi/Synchronization.h>
+
+#include "gtest/gtest.h"
+#include "ntcore_c.h"
+#include "ntcore_cpp.h"
+
+namespace nt {
+
+// Test only local here; it's more reliable to mock the network
+class ListenerDispatchTest : public ::testing::Test {
+ public:
+  ListenerDispatchTest() : m_inst{nt::CreateInstance()} {}
+
+  ~ListenerDispatchTest() override { nt::DestroyInstance(m_inst); }
+
+ protected:
+  NT_Inst m_inst;
+};
+
+TEST_F(ListenerDispatchTest, BlockedCallbackDoesNotStallOtherThread) {
+  nt::SetListenerDispatchThreadCount(m_inst, 2);
+
+  wpi::Event blockedEntered;
+  wpi::Event release;
+  wpi::Event blockerDone;
+  wpi::Event fastFired;
+
+  auto blockTopic = nt::GetTopic(m_inst, "block");
+  auto fastTopic = nt::GetTopic(m_inst, "fast");
+
+  // with 2 dispatch threads, these round-robin onto separate threads
+  auto blocker = nt::AddListener(blockTopic, nt::EventFlags::kValueAll,
+                                 [&](const nt::Event&) {
+                                   blockedEntered.Set();
+                                   wpi::WaitForObject(release.GetHandle());
+                                   blockerDone.Set();
+                                 });
+  auto fast = nt::AddListener(fastTopic, nt::EventFlags::kValueAll,
+                              [&](const nt::Event&) { fastFired.Set(); });
+
+  auto blockPub = nt::Publish(blockTopic, NT_DOUBLE, "double");
+  auto fastPub = nt::Publish(fastTopic, NT_DOUBLE, "double");
+
+  ASSERT_TRUE(nt::SetDouble(blockPub, 1.0));
+  bool timedOut = false;
+  ASSERT_TRUE(wpi::WaitForObject(blockedEntered.GetHandle(), 1.0, &timedOut));
+
+  // the listener on the other dispatch thread must still make progress while
+  // the first callback is blocked
+  ASSERT_TRUE(nt::SetDouble(fastPub, 2.0));
+  ASSERT_TRUE(wpi::WaitForObject(fastFired.GetHandle(), 1.0, &timedOut))
+      << "listener stalled behind a blocked callback on another thread";
+
+  // let the blocked callback finish before anything it references goes away
+  release.Set();
+  ASSERT_TRUE(wpi::WaitForObject(blockerDone.GetHandle(), 1.0, &timedOut));
+
+  nt::RemoveListener(blocker);
+  nt::RemoveListener(fast);
+  nt::Unpublish(blockPub);
+  nt::Unpublish(fastPub);
+}
+
+TEST_F(ListenerDispatchTest, SingleThreadDefault) {
+  // without raising the count, both callbacks share one dispatch thread and
+  // events are delivered in order
+  wpi::Event secondFired;
+
+  auto topic = nt::GetTopic(m_inst, "foo");
+  auto pub = nt::Publish(topic, NT_DOUBLE, "double");
+  int order = 0;
+  int first = 0;
+  int second = 0;
+  auto h1 = nt::AddListener(topic, nt::EventFlags::kValueAll,
+                            [&](const nt::Event&) { first = ++order; });
+  auto h2 = nt::AddListener(topic, nt::EventFlags::kValueAll,
+                            [&](const nt::Event&) {
+                              second = ++order;
+                              secondFired.Set();
+                            });
+
+  ASSERT_TRUE(nt::SetDouble(pub, 1.0));
+  bool timedOut = false;
+  ASSERT_TRUE(wpi::WaitForObject(secondFired.GetHandle(), 1.0, &timedOut));
+  // both callbacks run on the same dispatch thread, in listener add order;
+  // the wait on secondFired orders these reads after both callbacks
+  ASSERT_EQ(first, 1);
+  ASSERT_EQ(second, 2);
+
+  nt::RemoveListener(h1);
+  nt::RemoveListener(h2);
+  nt::Unpublish(pub);
+}
+
+}  // namespace nt
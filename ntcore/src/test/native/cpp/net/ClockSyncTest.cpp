@@ -0,0 +1,81 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "gtest/gtest.h"
+#include "net/ClockSync.h"
+
+using namespace nt::net;
+
+class ClockSyncTest : public ::testing::Test {
+ protected:
+  ClockSync sync;
+};
+
+TEST_F(ClockSyncTest, Empty) {
+  ASSERT_FALSE(sync.HaveOffset());
+  ASSERT_EQ(sync.GetOffset(0), 0);
+  ASSERT_EQ(sync.GetUncertainty(0), INT64_MAX);
+}
+
+TEST_F(ClockSyncTest, SingleSample) {
+  sync.AddSample(5000, 500, 1'000'000);
+  ASSERT_TRUE(sync.HaveOffset());
+  ASSERT_EQ(sync.GetOffset(1'000'000), 5000);
+  // uncertainty at the sample time is the half-RTT
+  ASSERT_EQ(sync.GetUncertainty(1'000'000), 500);
+}
+
+TEST_F(ClockSyncTest, PrefersLowDelaySample) {
+  // a high-delay sample with a perturbed offset arrives after a clean one
+  sync.AddSample(5000, 500, 1'000'000);
+  sync.AddSample(9000, 4000, 4'000'000);
+  ASSERT_EQ(sync.GetOffset(4'000'000), 5000);
+
+  // a new clean sample takes over the selection
+  sync.AddSample(5100, 400, 7'000'000);
+  ASSERT_EQ(sync.GetOffset(7'000'000), 5100);
+}
+
+TEST_F(ClockSyncTest, HighDelaySampleAgesOut) {
+  sync.AddSample(5000, 400, 0);
+  // window holds 8 samples; after 8 more the first (lowest-delay) is gone
+  for (int i = 1; i <= 8; ++i) {
+    sync.AddSample(7000, 1000, i * 1'000'000);
+  }
+  ASSERT_EQ(sync.GetOffset(8 * 1'000'000), 7000);
+}
+
+TEST_F(ClockSyncTest, TracksDrift) {
+  // server clock runs 50 ppm fast: offset grows 50 us per second
+  for (int i = 0; i < 40; ++i) {
+    int64_t t = i * 3'000'000;
+    sync.AddSample(t * 50 / 1'000'000, 500, t);
+  }
+  // extrapolating 10 s past the last sample should track the drift
+  int64_t t = 39 * 3'000'000 + 10'000'000;
+  EXPECT_NEAR(sync.GetOffset(t), t * 50 / 1'000'000, 100);
+}
+
+TEST_F(ClockSyncTest, UncertaintyGrowsWithAge) {
+  sync.AddSample(5000, 500, 0);
+  auto atSample = sync.GetUncertainty(0);
+  auto later = sync.GetUncertainty(60'000'000);
+  EXPECT_GT(later, atSample);
+}
+
+TEST_F(ClockSyncTest, FullWindow) {
+  for (int i = 0; i < 7; ++i) {
+    sync.AddSample(5000, 500, i * 500'000);
+    ASSERT_FALSE(sync.HaveFullWindow());
+  }
+  sync.AddSample(5000, 500, 8 * 500'000);
+  ASSERT_TRUE(sync.HaveFullWindow());
+}
+
+TEST_F(ClockSyncTest, Reset) {
+  sync.AddSample(5000, 500, 1'000'000);
+  sync.Reset();
+  ASSERT_FALSE(sync.HaveOffset());
+  ASSERT_EQ(sync.GetOffset(1'000'000), 0);
+}
@@ -152,6 +152,21 @@ static void DisplayGui() {
 
     std::string setString = fmt::format("Set team to {}", teamNumber);
 
+    // Fleet fan-out: each device's action runs on its own async session, so
+    // all targets are configured in parallel.  Devices with an action already
+    // outstanding are skipped.
+    if (ImGui::Button(fmt::format("Set all to {}", teamNumber).c_str())) {
+      for (auto&& i : foundDevices) {
+        deploySession.ChangeTeamNumber(i.first, teamNumber, i.second.first);
+      }
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Reboot all")) {
+      for (auto&& i : foundDevices) {
+        deploySession.Reboot(i.first, i.second.first);
+      }
+    }
+
     if (ImGui::BeginTable("Table", 6)) {
       ImGui::TableSetupColumn(
           "Name",
@@ -38,6 +38,13 @@ static constexpr std::string_view kPassword = "";
 
 std::unordered_map<std::string, std::future<int>> s_outstanding;
 
+// Cached sessions, keyed by host.  Sessions stay open across actions so a
+// fleet operation pays one handshake per target total, not one per action;
+// per-target exclusivity is already guaranteed by s_outstanding.
+static std::mutex s_sessionsMutex;
+static std::unordered_map<std::string, std::shared_ptr<sysid::SshSession>>
+    s_sessions;
+
 DeploySession::DeploySession(wpi::Logger& logger) : m_logger{logger} {}
 
 template <typename T>
@@ -59,41 +66,68 @@ void DeploySession::DestroyFuture(const std::string& macAddress) {
   s_outstanding.erase(macAddress);
 }
 
-bool DeploySession::ChangeTeamNumber(const std::string& macAddress,
-                                     int teamNumber, unsigned int ipAddress) {
+std::shared_ptr<SshSession> DeploySession::AcquireSession(
+    const std::string& host) {
+  {
+    std::scoped_lock lock{s_sessionsMutex};
+    auto itr = s_sessions.find(host);
+    if (itr != s_sessions.end()) {
+      return itr->second;
+    }
+  }
+  DEBUG("Trying to establish SSH connection to {}.", host);
+  auto session =
+      std::make_shared<SshSession>(host, kPort, kUsername, kPassword, m_logger);
+  session->Open();
+  DEBUG("SSH connection to {} was successful.", host);
+  std::scoped_lock lock{s_sessionsMutex};
+  s_sessions[host] = session;
+  return session;
+}
+
+void DeploySession::DropSession(const std::string& host) {
+  std::scoped_lock lock{s_sessionsMutex};
+  s_sessions.erase(host);
+}
+
+bool DeploySession::RunCommand(const std::string& macAddress,
+                               unsigned int ipAddress, std::string cmd,
+                               bool dropSessionAfter) {
   auto itr = s_outstanding.find(macAddress);
   if (itr != s_outstanding.end()) {
     return false;
   }
 
   std::future<int> future = std::async(
-      std::launch::async, [this, ipAddress, teamNumber, mac = macAddress]() {
+      std::launch::async,
+      [this, ipAddress, cmd = std::move(cmd), dropSessionAfter]() {
         //  Convert to IP address.
         wpi::SmallString<16> ip;
         in_addr addr;
         addr.s_addr = ipAddress;
         wpi::uv::AddrToName(addr, &ip);
-        DEBUG("Trying to establish SSH connection to {}.", ip);
+        std::string host{ip.str()};
         try {
-          SshSession session{ip.str(), kPort, kUsername, kPassword, m_logger};
-          session.Open();
-          DEBUG("SSH connection to {} was successful.", ip);
+          auto session = AcquireSession(host);
 
           SUCCESS("roboRIO Connected!");
 
           try {
-            session.Execute(fmt::format(
-                "/usr/local/natinst/bin/nirtcfg "
-                "--file=/etc/natinst/share/ni-rt.ini --set "
-                "section=systemsettings,token=host_name,value=roborio-{"
-                "}-FRC ; sync",
-                teamNumber));
+            session->Execute(cmd);
           } catch (const SshSession::SshException& e) {
+            // The cached connection may have gone stale (e.g. the target
+            // rebooted since the last action); reconnect and retry once.
             ERROR("An exception occurred: {}", e.what());
-            throw e;
+            DropSession(host);
+            auto fresh = AcquireSession(host);
+            fresh->Execute(cmd);
+          }
+          if (dropSessionAfter) {
+            DropSession(host);
           }
         } catch (const SshSession::SshException& e) {
-          DEBUG("SSH connection to {} failed with {}.", ip, e.what());
+          DropSession(host);
+          DEBUG("SSH connection to {} failed with {}.", host, e.what());
           throw e;
         }
         return 0;
@@ -103,84 +137,31 @@ bool DeploySession::ChangeTeamNumber(const std::string& macAddress,
   return true;
 }
 
+bool DeploySession::ChangeTeamNumber(const std::string& macAddress,
+                                     int teamNumber, unsigned int ipAddress) {
+  return RunCommand(
+      macAddress, ipAddress,
+      fmt::format("/usr/local/natinst/bin/nirtcfg "
+                  "--file=/etc/natinst/share/ni-rt.ini --set "
+                  "section=systemsettings,token=host_name,value=roborio-{"
+                  "}-FRC ; sync",
+                  teamNumber),
+      false);
+}
+
 bool DeploySession::Reboot(const std::string& macAddress,
                            unsigned int ipAddress) {
-  auto itr = s_outstanding.find(macAddress);
-  if (itr != s_outstanding.end()) {
-    return false;
-  }
-
-  std::future<int> future =
-      std::async(std::launch::async, [this, ipAddress, mac = macAddress]() {
-        //  Convert to IP address.
-        wpi::SmallString<16> ip;
-        in_addr addr;
-        addr.s_addr = ipAddress;
-        wpi::uv::AddrToName(addr, &ip);
-        DEBUG("Trying to establish SSH connection to {}.", ip);
-        try {
-          SshSession session{ip.str(), kPort, kUsername, kPassword, m_logger};
-          session.Open();
-          DEBUG("SSH connection to {} was successful.", ip);
-
-          SUCCESS("roboRIO Connected!");
-
-          try {
-            session.Execute(fmt::format("sync ; shutdown -r now"));
-          } catch (const SshSession::SshException& e) {
-            ERROR("An exception occurred: {}", e.what());
-            throw e;
-          }
-        } catch (const SshSession::SshException& e) {
-          DEBUG("SSH connection to {} failed with {}.", ip, e.what());
-          throw e;
-        }
-        return 0;
-      });
-
-  s_outstanding[macAddress] = std::move(future);
-  return true;
+  // The connection dies with the reboot, so don't keep the session.
+  return RunCommand(macAddress, ipAddress, "sync ; shutdown -r now", true);
 }
 
 bool DeploySession::Blink(const std::string& macAddress,
                           unsigned int ipAddress) {
-  auto itr = s_outstanding.find(macAddress);
-  if (itr != s_outstanding.end()) {
-    return false;
-  }
-
-  std::future<int> future =
-      std::async(std::launch::async, [this, ipAddress, mac = macAddress]() {
-        //  Convert to IP address.
-        wpi::SmallString<16> ip;
-        in_addr addr;
-        addr.s_addr = ipAddress;
-        wpi::uv::AddrToName(addr, &ip);
-        DEBUG("Trying to establish SSH connection to {}.", ip);
-        try {
-          SshSession session{ip.str(), kPort, kUsername, kPassword, m_logger};
-          session.Open();
-          DEBUG("SSH connection to {} was successful.", ip);
-
-          SUCCESS("roboRIO Connected!");
-
-          try {
-            session.Execute(fmt::format(
-                "for i in 1 2 3 4 5  ;  do ` echo 255 > "
-                "/sys/class/leds/nilrt:wifi:primary/brightness; sleep 0.5; "
-                "echo 0 > /sys/class/leds/nilrt:wifi:primary/brightness; sleep "
-                "0.5 ` ; done"));
-          } catch (const SshSession::SshException& e) {
-            ERROR("An exception occurred: {}", e.what());
-            throw e;
-          }
-        } catch (const SshSession::SshException& e) {
-          DEBUG("SSH connection to {} failed with {}.", ip, e.what());
-          throw e;
-        }
-        return 0;
-      });
-
-  s_outstanding[macAddress] = std::move(future);
-  return true;
+  return RunCommand(
+      macAddress, ipAddress,
+      "for i in 1 2 3 4 5  ;  do ` echo 255 > "
+      "/sys/class/leds/nilrt:wifi:primary/brightness; sleep 0.5; "
+      "echo 0 > /sys/class/leds/nilrt:wifi:primary/brightness; sleep "
+      "0.5 ` ; done",
+      false);
 }
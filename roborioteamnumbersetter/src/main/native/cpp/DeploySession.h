@@ -14,6 +14,8 @@
 #include <wpi/Logger.h>
 
 namespace sysid {
+class SshSession;
+
 // Define an integer for a successful message in the log (shown in green on the
 // GUI).
 static constexpr unsigned int kLogSuccess = 31;
@@ -60,6 +62,30 @@ class DeploySession {
   Status GetStatus() const;
 
  private:
+  /**
+   * Launches an asynchronous command execution against a target, reusing the
+   * target's cached SSH session if one is open.  Returns false if an action
+   * is already outstanding for the target.
+   *
+   * @param macAddress       The target's MAC address (future key).
+   * @param ipAddress        The target's IP address.
+   * @param cmd              The command to execute.
+   * @param dropSessionAfter Whether to close the cached session after the
+   *                         command (e.g. for reboots).
+   */
+  bool RunCommand(const std::string& macAddress, unsigned int ipAddress,
+                  std::string cmd, bool dropSessionAfter);
+
+  /**
+   * Returns an open session for the given host, opening (and caching) a new
+   * one if none exists.  Sessions persist across actions so repeated fleet
+   * operations skip the SSH handshake.
+   */
+  std::shared_ptr<SshSession> AcquireSession(const std::string& host);
+
+  /** Closes and forgets the cached session for the given host, if any. */
+  static void DropSession(const std::string& host);
+
   // Logger reference where log messages will be sent.
   wpi::Logger& m_logger;
 
@@ -253,10 +253,14 @@ void DSCommPacket::ReadJoystickDescriptionTag(std::span<const uint8_t> data) {
 void DSCommPacket::SendJoysticks(void) {
   for (int i = 0; i < HAL_kMaxJoysticks; i++) {
     DSCommJoystickPacket& packet = m_joystick_packets[i];
-    HALSIM_SetJoystickAxes(i, &packet.axes);
-    HALSIM_SetJoystickPOVs(i, &packet.povs);
-    HALSIM_SetJoystickButtons(i, &packet.buttons);
-    HALSIM_SetJoystickDescriptor(i, &packet.descriptor);
+    // Apply the UDP joystick data under a single sim data lock per stick
+    HALSIM_SetJoystickData(i, &packet.axes, &packet.povs, &packet.buttons);
+    // Descriptors only change when a TCP description tag arrives, so skip
+    // re-sending them on every UDP packet
+    if (packet.descriptorChanged) {
+      HALSIM_SetJoystickDescriptor(i, &packet.descriptor);
+      packet.descriptorChanged = false;
+    }
   }
 }
 
@@ -15,6 +15,7 @@ struct DSCommJoystickPacket {
   HAL_JoystickButtons buttons;
   HAL_JoystickPOVs povs;
   HAL_JoystickDescriptor descriptor;
+  bool descriptorChanged = false;
 
   void ResetUdp() {
     std::memset(&axes, 0, sizeof(axes));
@@ -22,7 +23,10 @@ struct DSCommJoystickPacket {
     std::memset(&povs, 0, sizeof(povs));
   }
 
-  void ResetTcp() { std::memset(&descriptor, 0, sizeof(descriptor)); }
+  void ResetTcp() {
+    std::memset(&descriptor, 0, sizeof(descriptor));
+    descriptorChanged = true;
+  }
 };
 
 }  // namespace halsim
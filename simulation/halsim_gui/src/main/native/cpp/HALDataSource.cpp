@@ -0,0 +1,42 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "HALDataSource.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <wpi/SmallVector.h>
+#include <wpi/mutex.h>
+
+using namespace halsimgui;
+
+static wpi::mutex gRegistryMutex;
+static std::vector<HALDataSource*> gRegistry;
+
+void HALDataSource::Register() {
+  std::scoped_lock lock{gRegistryMutex};
+  gRegistry.push_back(this);
+}
+
+void HALDataSource::Unregister() {
+  std::scoped_lock lock{gRegistryMutex};
+  auto it = std::find(gRegistry.begin(), gRegistry.end(), this);
+  if (it != gRegistry.end()) {
+    gRegistry.erase(it);
+  }
+}
+
+void HALDataSource::UpdateAll() {
+  // copy so valueChanged handlers can create/destroy sources without
+  // holding the registry lock
+  wpi::SmallVector<HALDataSource*, 128> sources;
+  {
+    std::scoped_lock lock{gRegistryMutex};
+    sources.assign(gRegistry.begin(), gRegistry.end());
+  }
+  for (auto source : sources) {
+    source->Flush();
+  }
+}
@@ -10,6 +10,8 @@
 #include <imgui.h>
 #include <wpigui.h>
 
+#include "HALDataSource.h"
+
 using namespace halsimgui;
 
 glass::MainMenuBar HALSimGui::mainMenu;
@@ -28,6 +30,9 @@ void HALSimGui::GlobalInit() {
       glass::GetStorageRoot().GetChild("NTProvider"));
   ntProvider->GlobalInit();
 
+  // publish buffered HAL sim data values to the GUI once per frame
+  wpi::gui::AddEarlyExecute([] { HALDataSource::UpdateAll(); });
+
   wpi::gui::AddLateExecute([] { mainMenu.Display(); });
 
   glass::AddStandardNetworkTablesViews(*ntProvider);
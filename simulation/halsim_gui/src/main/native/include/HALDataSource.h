@@ -4,13 +4,66 @@
 
 #pragma once
 
+#include <atomic>
+#include <string_view>
+
 #include <glass/DataSource.h>
 
+namespace halsimgui {
+
+/**
+ * A DataSource fed from a HAL simulation data callback.
+ *
+ * Callbacks fire on whatever thread sets the sim data (e.g. a physics model
+ * stepping at several kHz), so they only store the latest value into an
+ * atomic back buffer here; UpdateAll(), run once per GUI frame, publishes
+ * the buffered values through SetValue() (and thus the valueChanged signal)
+ * on the GUI thread.  This keeps per-set callback cost constant regardless
+ * of the sim data update rate.
+ */
+class HALDataSource : public glass::DataSource {
+ public:
+  ~HALDataSource() override { Unregister(); }
+
+  /** Publishes all buffered values; called once per frame on the GUI thread. */
+  static void UpdateAll();
+
+ protected:
+  explicit HALDataSource(std::string_view id) : DataSource{id} { Register(); }
+  HALDataSource(std::string_view id, int index) : DataSource{id, index} {
+    Register();
+  }
+  HALDataSource(std::string_view id, int index, int index2)
+      : DataSource{id, index, index2} {
+    Register();
+  }
+
+  void PublishValue(double value) {
+    m_latest.store(value, std::memory_order_relaxed);
+    m_hasNew.store(true, std::memory_order_release);
+  }
+
+ private:
+  void Register();
+  void Unregister();
+
+  void Flush() {
+    if (m_hasNew.exchange(false, std::memory_order_acquire)) {
+      SetValue(m_latest.load(std::memory_order_relaxed));
+    }
+  }
+
+  std::atomic<double> m_latest{0.0};
+  std::atomic<bool> m_hasNew{false};
+};
+
+}  // namespace halsimgui
+
 #define HALSIMGUI_DATASOURCE(cbname, id, TYPE, vtype)                         \
-  class cbname##Source : public ::glass::DataSource {                         \
+  class cbname##Source : public ::halsimgui::HALDataSource {                  \
    public:                                                                    \
     cbname##Source()                                                          \
-        : DataSource(id),                                                     \
+        : HALDataSource(id),                                                  \
           m_callback{                                                         \
               HALSIM_Register##cbname##Callback(CallbackFunc, this, true)} {  \
       SetDigital(HAL_##TYPE == HAL_BOOLEAN);                                  \
@@ -25,7 +78,8 @@
     static void CallbackFunc(const char*, void* param,                        \
                              const HAL_Value* value) {                        \
       if (value->type == HAL_##TYPE)                                          \
-        static_cast<cbname##Source*>(param)->SetValue(value->data.v_##vtype); \
+        static_cast<cbname##Source*>(param)->PublishValue(                    \
+            value->data.v_##vtype);                                           \
     }                                                                         \
                                                                               \
     int32_t m_callback;                                                       \
@@ -41,10 +95,10 @@
   HALSIMGUI_DATASOURCE(cbname, id, INT, int)
 
 #define HALSIMGUI_DATASOURCE_INDEXED(cbname, id, TYPE, vtype)                 \
-  class cbname##Source : public ::glass::DataSource {                         \
+  class cbname##Source : public ::halsimgui::HALDataSource {                  \
    public:                                                                    \
     explicit cbname##Source(int32_t index, int channel = -1)                  \
-        : DataSource(id, channel < 0 ? index : channel),                      \
+        : HALDataSource(id, channel < 0 ? index : channel),                   \
           m_index{index},                                                     \
           m_channel{channel < 0 ? index : channel},                           \
           m_callback{HALSIM_Register##cbname##Callback(index, CallbackFunc,   \
@@ -65,7 +119,8 @@
     static void CallbackFunc(const char*, void* param,                        \
                              const HAL_Value* value) {                        \
       if (value->type == HAL_##TYPE)                                          \
-        static_cast<cbname##Source*>(param)->SetValue(value->data.v_##vtype); \
+        static_cast<cbname##Source*>(param)->PublishValue(                    \
+            value->data.v_##vtype);                                           \
     }                                                                         \
                                                                               \
     int32_t m_index;                                                          \
@@ -80,10 +135,10 @@
   HALSIMGUI_DATASOURCE_INDEXED(cbname, id, DOUBLE, double)
 
 #define HALSIMGUI_DATASOURCE_INDEXED2(cbname, id, TYPE, vtype)                \
-  class cbname##Source : public ::glass::DataSource {                         \
+  class cbname##Source : public ::halsimgui::HALDataSource {                  \
    public:                                                                    \
     explicit cbname##Source(int32_t index, int32_t channel)                   \
-        : DataSource(id, index, channel),                                     \
+        : HALDataSource(id, index, channel),                                  \
           m_index{index},                                                     \
           m_channel{channel},                                                 \
           m_callback{HALSIM_Register##cbname##Callback(                       \
@@ -104,7 +159,8 @@
     static void CallbackFunc(const char*, void* param,                        \
                              const HAL_Value* value) {                        \
       if (value->type == HAL_##TYPE)                                          \
-        static_cast<cbname##Source*>(param)->SetValue(value->data.v_##vtype); \
+        static_cast<cbname##Source*>(param)->PublishValue(                    \
+            value->data.v_##vtype);                                           \
     }                                                                         \
                                                                               \
     int32_t m_index;                                                          \
@@ -14,6 +14,9 @@
 
 static constexpr int kTcpConnectAttemptTimeout = 1000;
 
+// must be no longer than the smallest provider coalescing window
+static constexpr int kFlushTimerPeriodMs = 5;
+
 namespace uv = wpi::uv;
 
 using namespace wpilibws;
@@ -33,10 +36,11 @@ HALSimWS::HALSimWS(wpi::uv::Loop& loop, ProviderContainer& providers,
     m_exec->wakeup.connect([](auto func) { func(); });
   }
   m_connect_timer = uv::Timer::Create(m_loop);
+  m_flush_timer = uv::Timer::Create(m_loop);
 }
 
 bool HALSimWS::Initialize() {
-  if (!m_tcp_client || !m_exec || !m_connect_timer) {
+  if (!m_tcp_client || !m_exec || !m_connect_timer || !m_flush_timer) {
     return false;
   }
 
@@ -95,6 +99,16 @@ void HALSimWS::Start() {
   // Set up the timer to attempt connection
   m_connect_timer->timeout.connect([this] { AttemptConnect(); });
 
+  // Periodically flush coalesced provider state
+  m_flush_timer->timeout.connect([this] {
+    m_providers.ForEach([](std::shared_ptr<HALSimWSBaseProvider> provider) {
+      provider->Flush();
+    });
+  });
+  m_flush_timer->Start(uv::Timer::Time(kFlushTimerPeriodMs),
+                       uv::Timer::Time(kFlushTimerPeriodMs));
+  m_flush_timer->Unreference();
+
   // Run the initial connect immediately
   m_connect_timer->Start(uv::Timer::Time(0));
   m_connect_timer->Unreference();
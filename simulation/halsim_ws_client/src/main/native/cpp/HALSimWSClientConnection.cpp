@@ -19,10 +19,13 @@ void HALSimWSClientConnection::Initialize() {
   // Get a shared pointer to ourselves
   auto self = this->shared_from_this();
 
+  // offer msgpack binary encoding; the connection falls back to JSON if the
+  // server doesn't select the subprotocol
   auto ws = wpi::WebSocket::CreateClient(
       *m_stream, m_client->GetTargetUri(),
       fmt::format("{}:{}", m_client->GetTargetHost(),
-                  m_client->GetTargetPort()));
+                  m_client->GetTargetPort()),
+      {kMsgpackProtocol});
 
   ws->SetData(self);
 
@@ -37,6 +40,7 @@ void HALSimWSClientConnection::Initialize() {
       return;
     }
 
+    m_binary = m_websocket->GetProtocol() == kMsgpackProtocol;
     m_ws_connected = true;
     std::puts("HALSimWS: WebSocket Connected");
   });
@@ -60,6 +64,25 @@ void HALSimWSClientConnection::Initialize() {
     m_client->OnNetValueChanged(j);
   });
 
+  m_websocket->binary.connect([this](auto msg, bool) {
+    if (!m_ws_connected) {
+      return;
+    }
+
+    wpi::json j;
+    try {
+      j = wpi::json::from_msgpack(msg);
+    } catch (const wpi::json::parse_error& e) {
+      std::string err("msgpack parse failed: ");
+      err += e.what();
+      fmt::print(stderr, "{}\n", err);
+      m_websocket->Fail(1003, err);
+      return;
+    }
+
+    m_client->OnNetValueChanged(j);
+  });
+
   m_websocket->closed.connect([this](uint16_t, auto) {
     if (m_ws_connected) {
       std::puts("HALSimWS: Websocket Disconnected");
@@ -80,21 +103,29 @@ void HALSimWSClientConnection::OnSimValueChanged(const wpi::json& msg) {
                            return m_buffers.Allocate();
                          }};
 
-  os << msg;
+  if (m_binary) {
+    wpi::json::to_msgpack(os, msg);
+  } else {
+    os << msg;
+  }
 
   // Call the websocket send function on the uv loop
   m_client->GetExec().Send([self = shared_from_this(), sendBufs] {
-    self->m_websocket->SendText(sendBufs,
-                                [self](auto bufs, wpi::uv::Error err) {
-                                  {
-                                    std::lock_guard lock(self->m_buffers_mutex);
-                                    self->m_buffers.Release(bufs);
-                                  }
-
-                                  if (err) {
-                                    fmt::print(stderr, "{}\n", err.str());
-                                    std::fflush(stderr);
-                                  }
-                                });
+    auto complete = [self](auto bufs, wpi::uv::Error err) {
+      {
+        std::lock_guard lock(self->m_buffers_mutex);
+        self->m_buffers.Release(bufs);
+      }
+
+      if (err) {
+        fmt::print(stderr, "{}\n", err.str());
+        std::fflush(stderr);
+      }
+    };
+    if (self->m_binary) {
+      self->m_websocket->SendBinary(sendBufs, complete);
+    } else {
+      self->m_websocket->SendText(sendBufs, complete);
+    }
   });
 }
@@ -55,6 +55,9 @@ class HALSimWS : public std::enable_shared_from_this<HALSimWS> {
   std::shared_ptr<wpi::uv::Timer> m_connect_timer;
   int m_connect_attempts = 0;
 
+  // periodically sends provider state held back by change coalescing
+  std::shared_ptr<wpi::uv::Timer> m_flush_timer;
+
   std::weak_ptr<HALSimBaseWebSocketConnection> m_hws;
 
   wpi::uv::Loop& m_loop;
@@ -42,6 +42,8 @@ class HALSimWSClientConnection
   std::shared_ptr<wpi::uv::Stream> m_stream;
 
   bool m_ws_connected = false;
+  // msgpack binary encoding negotiated via subprotocol?
+  bool m_binary = false;
   wpi::WebSocket* m_websocket = nullptr;
 
   wpi::uv::SimpleBufferPool<4> m_buffers;
@@ -4,10 +4,37 @@
 
 #include "WSHalProviders.h"
 
+#include <cstdlib>
+#include <utility>
+
 #include <fmt/format.h>
+#include <wpi/timestamp.h>
 
 namespace wpilibws {
 
+// Coalescing window per device type, in microseconds. High-rate devices
+// (e.g. fast-toggling DIOs) can generate thousands of changes per second;
+// within the window only the latest state is sent. Low-rate device types
+// send immediately. The HALSIMWS_COALESCE_MS environment variable overrides
+// the default window for the high-rate types (0 disables coalescing).
+static uint64_t GetCoalescingWindow(std::string_view type) {
+  if (type == "DIO" || type == "PWM" || type == "dPWM" || type == "Encoder" ||
+      type == "AI" || type == "AO") {
+    static const uint64_t window = [] {
+      if (const char* env = std::getenv("HALSIMWS_COALESCE_MS")) {
+        return static_cast<uint64_t>(std::strtoul(env, nullptr, 10)) * 1000;
+      }
+      return static_cast<uint64_t>(10000);
+    }();
+    return window;
+  }
+  return 0;
+}
+
+HALSimWSHalProvider::HALSimWSHalProvider(std::string_view key,
+                                         std::string_view type)
+    : HALSimWSBaseProvider(key, type), m_windowUs(GetCoalescingWindow(type)) {}
+
 void HALSimWSHalProvider::OnNetworkConnected(
     std::shared_ptr<HALSimBaseWebSocketConnection> ws) {
   {
@@ -23,6 +50,49 @@ void HALSimWSHalProvider::OnNetworkDisconnected() {
 }
 
 void HALSimWSHalProvider::ProcessHalCallback(const wpi::json& payload) {
+  if (m_windowUs == 0) {
+    SendDiff(payload);
+    return;
+  }
+
+  wpi::json toSend;
+  {
+    std::scoped_lock lock(m_pendingMutex);
+    // merge into the pending diff; later values for the same key win
+    m_pending.update(payload);
+    m_hasPending = true;
+
+    uint64_t now = wpi::Now();
+    if (now - m_lastSendTime < m_windowUs) {
+      // inside the window; Flush() (or a later callback) sends the
+      // latest state
+      return;
+    }
+    m_lastSendTime = now;
+    m_hasPending = false;
+    toSend = std::move(m_pending);
+    m_pending = wpi::json::object();
+  }
+  SendDiff(toSend);
+}
+
+void HALSimWSHalProvider::Flush() {
+  wpi::json toSend;
+  {
+    std::scoped_lock lock(m_pendingMutex);
+    uint64_t now = wpi::Now();
+    if (!m_hasPending || now - m_lastSendTime < m_windowUs) {
+      return;
+    }
+    m_lastSendTime = now;
+    m_hasPending = false;
+    toSend = std::move(m_pending);
+    m_pending = wpi::json::object();
+  }
+  SendDiff(toSend);
+}
+
+void HALSimWSHalProvider::SendDiff(const wpi::json& payload) {
   auto ws = m_ws.lock();
   if (ws) {
     wpi::json netValue = {
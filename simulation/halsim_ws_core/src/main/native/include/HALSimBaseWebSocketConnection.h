@@ -5,11 +5,20 @@
 #pragma once
 
 #include <memory>
+#include <string_view>
 
 #include <wpi/json.h>
 
 namespace wpilibws {
 
+/**
+ * WebSocket subprotocol name for msgpack binary message encoding.  When the
+ * client offers this subprotocol and the server selects it, both sides
+ * exchange the same message objects as msgpack-encoded binary frames instead
+ * of JSON text; otherwise the connection falls back to JSON.
+ */
+constexpr std::string_view kMsgpackProtocol = "wpilib.sim.msgpack";
+
 class HALSimBaseWebSocketConnection {
  public:
   virtual void OnSimValueChanged(const wpi::json& msg) = 0;
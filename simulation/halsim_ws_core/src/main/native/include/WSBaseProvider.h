@@ -36,6 +36,10 @@ class HALSimWSBaseProvider {
   // network -> sim
   virtual void OnNetValueChanged(const wpi::json& json);
 
+  // sim -> network: send any state held back by change coalescing.
+  // Called periodically from the websocket event loop.
+  virtual void Flush() {}
+
   const std::string& GetDeviceType() { return m_type; }
   const std::string& GetDeviceId() { return m_deviceId; }
 
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <stdint.h>
+
 #include <functional>
 #include <memory>
 #include <string>
@@ -26,17 +28,31 @@ using HALCbRegisterSingleFunc = void (*)(HAL_NotifyCallback callback,
 // provider generates diffs based on values
 class HALSimWSHalProvider : public HALSimWSBaseProvider {
  public:
-  using HALSimWSBaseProvider::HALSimWSBaseProvider;
+  explicit HALSimWSHalProvider(std::string_view key,
+                               std::string_view type = "");
 
   void OnNetworkConnected(
       std::shared_ptr<HALSimBaseWebSocketConnection> ws) override;
   void OnNetworkDisconnected() override;
 
   void ProcessHalCallback(const wpi::json& payload);
+  void Flush() override;
 
  protected:
   virtual void RegisterCallbacks() = 0;
   virtual void CancelCallbacks() = 0;
+
+ private:
+  void SendDiff(const wpi::json& payload);
+
+  // High-rate devices coalesce changes: diffs arriving inside the window
+  // are merged and the latest state is sent by Flush() (or by the first
+  // callback after the window elapses). Zero means send immediately.
+  uint64_t m_windowUs;
+  wpi::mutex m_pendingMutex;
+  wpi::json m_pending = wpi::json::object();
+  bool m_hasPending = false;
+  uint64_t m_lastSendTime = 0;
 };
 
 // provider generates per-channel diffs
@@ -32,6 +32,8 @@ bool HALSimHttpConnection::IsValidWsUpgrade(std::string_view protocol) {
 }
 
 void HALSimHttpConnection::ProcessWsUpgrade() {
+  m_binary = m_websocket->GetProtocol() == kMsgpackProtocol;
+
   m_websocket->open.connect_extended([this](auto conn, auto) {
     conn.disconnect();  // one-shot
 
@@ -64,6 +66,24 @@ void HALSimHttpConnection::ProcessWsUpgrade() {
     m_server->OnNetValueChanged(j);
   });
 
+  // parse incoming msgpack (if negotiated), dispatch to parent
+  m_websocket->binary.connect([this](auto msg, bool) {
+    if (!m_isWsConnected) {
+      return;
+    }
+
+    wpi::json j;
+    try {
+      j = wpi::json::from_msgpack(msg);
+    } catch (const wpi::json::parse_error& e) {
+      std::string err("msgpack parse failed: ");
+      err += e.what();
+      m_websocket->Fail(400, err);
+      return;
+    }
+    m_server->OnNetValueChanged(j);
+  });
+
   m_websocket->closed.connect([this](uint16_t, auto) {
     // unset the global, allow another websocket to connect
     if (m_isWsConnected) {
@@ -76,28 +96,36 @@ void HALSimHttpConnection::ProcessWsUpgrade() {
 }
 
 void HALSimHttpConnection::OnSimValueChanged(const wpi::json& msg) {
-  // render json to buffers
+  // render json (or msgpack, if negotiated) to buffers
   wpi::SmallVector<uv::Buffer, 4> sendBufs;
   wpi::raw_uv_ostream os{sendBufs, [this]() -> uv::Buffer {
                            std::lock_guard lock(m_buffers_mutex);
                            return m_buffers.Allocate();
                          }};
-  os << msg;
+  if (m_binary) {
+    wpi::json::to_msgpack(os, msg);
+  } else {
+    os << msg;
+  }
 
   // call the websocket send function on the uv loop
   m_server->GetExec().Send([self = shared_from_this(), sendBufs] {
-    self->m_websocket->SendText(sendBufs,
-                                [self](auto bufs, wpi::uv::Error err) {
-                                  {
-                                    std::lock_guard lock(self->m_buffers_mutex);
-                                    self->m_buffers.Release(bufs);
-                                  }
-
-                                  if (err) {
-                                    fmt::print(stderr, "{}\n", err.str());
-                                    std::fflush(stderr);
-                                  }
-                                });
+    auto complete = [self](auto bufs, wpi::uv::Error err) {
+      {
+        std::lock_guard lock(self->m_buffers_mutex);
+        self->m_buffers.Release(bufs);
+      }
+
+      if (err) {
+        fmt::print(stderr, "{}\n", err.str());
+        std::fflush(stderr);
+      }
+    };
+    if (self->m_binary) {
+      self->m_websocket->SendBinary(sendBufs, complete);
+    } else {
+      self->m_websocket->SendText(sendBufs, complete);
+    }
   });
 }
 
@@ -15,6 +15,9 @@
 
 #include "HALSimHttpConnection.h"
 
+// must be no longer than the smallest provider coalescing window
+static constexpr int kFlushTimerPeriodMs = 5;
+
 namespace uv = wpi::uv;
 
 using namespace wpilibws;
@@ -33,10 +36,11 @@ HALSimWeb::HALSimWeb(wpi::uv::Loop& loop, ProviderContainer& providers,
   if (m_exec) {
     m_exec->wakeup.connect([](auto func) { func(); });
   }
+  m_flushTimer = uv::Timer::Create(m_loop);
 }
 
 bool HALSimWeb::Initialize() {
-  if (!m_server || !m_exec) {
+  if (!m_server || !m_exec || !m_flushTimer) {
     return false;
   }
 
@@ -96,6 +100,16 @@ void HALSimWeb::Start() {
     tcp->SetData(conn);
   });
 
+  // periodically flush coalesced provider state
+  m_flushTimer->timeout.connect([this] {
+    m_providers.ForEach([](std::shared_ptr<HALSimWSBaseProvider> provider) {
+      provider->Flush();
+    });
+  });
+  m_flushTimer->Start(uv::Timer::Time(kFlushTimerPeriodMs),
+                      uv::Timer::Time(kFlushTimerPeriodMs));
+  m_flushTimer->Unreference();
+
   // start listening for incoming connections
   m_server->Listen();
   fmt::print("Listening at http://localhost:{}\n", m_port);
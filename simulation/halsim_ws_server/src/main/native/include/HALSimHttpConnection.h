@@ -29,7 +29,8 @@ class HALSimHttpConnection
  public:
   HALSimHttpConnection(std::shared_ptr<HALSimWeb> server,
                        std::shared_ptr<wpi::uv::Stream> stream)
-      : wpi::HttpWebSocketServerConnection<HALSimHttpConnection>(stream, {}),
+      : wpi::HttpWebSocketServerConnection<HALSimHttpConnection>(
+            stream, {kMsgpackProtocol}),
         m_server(std::move(server)),
         m_buffers(128) {}
 
@@ -54,6 +55,9 @@ class HALSimHttpConnection
   // is the websocket connected?
   bool m_isWsConnected = false;
 
+  // msgpack binary encoding negotiated via subprotocol?
+  bool m_binary = false;
+
   // these are only valid if the websocket is connected
   wpi::uv::SimpleBufferPool<4> m_buffers;
   std::mutex m_buffers_mutex;
@@ -14,6 +14,7 @@
 #include <wpinet/uv/Async.h>
 #include <wpinet/uv/Loop.h>
 #include <wpinet/uv/Tcp.h>
+#include <wpinet/uv/Timer.h>
 
 namespace wpi {
 class json;
@@ -57,6 +58,9 @@ class HALSimWeb : public std::enable_shared_from_this<HALSimWeb> {
   std::shared_ptr<wpi::uv::Tcp> m_server;
   std::shared_ptr<UvExecFunc> m_exec;
 
+  // periodically sends provider state held back by change coalescing
+  std::shared_ptr<wpi::uv::Timer> m_flushTimer;
+
   // list of providers
   ProviderContainer& m_providers;
   HALSimWSProviderSimDevices& m_simDevicesProvider;
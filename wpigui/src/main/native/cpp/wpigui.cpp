@@ -53,6 +53,55 @@ static void WindowPosCallback(GLFWwindow* window, int xpos, int ypos) {
   }
 }
 
+// after this much time without input, drop from full frame rate to the idle
+// tick rate; long enough to cover tooltips and other short ImGui animations
+static constexpr double kActiveRedrawTime = 0.5;  // seconds
+
+// input callbacks chain to those installed by the ImGui GLFW backend; we
+// only note the input time so the main loop knows to render at full rate
+static GLFWcursorposfun gPrevCursorPosCallback;
+static GLFWmousebuttonfun gPrevMouseButtonCallback;
+static GLFWscrollfun gPrevScrollCallback;
+static GLFWkeyfun gPrevKeyCallback;
+static GLFWcharfun gPrevCharCallback;
+
+static void CursorPosCallback(GLFWwindow* window, double xpos, double ypos) {
+  gContext->lastInputTime = glfwGetTime();
+  if (gPrevCursorPosCallback) {
+    gPrevCursorPosCallback(window, xpos, ypos);
+  }
+}
+
+static void MouseButtonCallback(GLFWwindow* window, int button, int action,
+                                int mods) {
+  gContext->lastInputTime = glfwGetTime();
+  if (gPrevMouseButtonCallback) {
+    gPrevMouseButtonCallback(window, button, action, mods);
+  }
+}
+
+static void ScrollCallback(GLFWwindow* window, double xoffset, double yoffset) {
+  gContext->lastInputTime = glfwGetTime();
+  if (gPrevScrollCallback) {
+    gPrevScrollCallback(window, xoffset, yoffset);
+  }
+}
+
+static void KeyCallback(GLFWwindow* window, int key, int scancode, int action,
+                        int mods) {
+  gContext->lastInputTime = glfwGetTime();
+  if (gPrevKeyCallback) {
+    gPrevKeyCallback(window, key, scancode, action, mods);
+  }
+}
+
+static void CharCallback(GLFWwindow* window, unsigned int codepoint) {
+  gContext->lastInputTime = glfwGetTime();
+  if (gPrevCharCallback) {
+    gPrevCharCallback(window, codepoint);
+  }
+}
+
 static void* IniReadOpen(ImGuiContext* ctx, ImGuiSettingsHandler* handler,
                          const char* name) {
   if (std::strcmp(name, "GLOBAL") != 0) {
@@ -287,14 +336,34 @@ bool gui::Initialize(const char* title, int width, int height,
     return false;
   }
 
+  // install input activity tracking, chaining to the callbacks the ImGui
+  // backend installed in PlatformInitRenderer()
+  gPrevCursorPosCallback =
+      glfwSetCursorPosCallback(gContext->window, CursorPosCallback);
+  gPrevMouseButtonCallback =
+      glfwSetMouseButtonCallback(gContext->window, MouseButtonCallback);
+  gPrevScrollCallback = glfwSetScrollCallback(gContext->window, ScrollCallback);
+  gPrevKeyCallback = glfwSetKeyCallback(gContext->window, KeyCallback);
+  gPrevCharCallback = glfwSetCharCallback(gContext->window, CharCallback);
+
   return true;
 }
 
 void gui::Main() {
   // Main loop
   while (!glfwWindowShouldClose(gContext->window) && !gContext->exit) {
-    // Poll and handle events (inputs, window resize, etc.)
-    glfwPollEvents();
+    // Poll and handle events (inputs, window resize, etc.).  When there has
+    // been no recent input and no redraw request, block for up to an idle
+    // tick instead of polling, so an idle GUI consumes (nearly) no CPU/GPU;
+    // input events or RequestRedraw() wake the wait immediately.
+    bool active = gContext->redrawRequested.exchange(false) ||
+                  gContext->idleFrameRate <= 0 ||
+                  (glfwGetTime() - gContext->lastInputTime) < kActiveRedrawTime;
+    if (active) {
+      glfwPollEvents();
+    } else {
+      glfwWaitEventsTimeout(1.0 / gContext->idleFrameRate);
+    }
     gContext->isPlatformRendering = true;
     PlatformRenderFrame();
     gContext->isPlatformRendering = false;
@@ -371,6 +440,21 @@ void gui::Exit() {
     return;
   }
   gContext->exit = true;
+  if (gContext->window) {
+    glfwPostEmptyEvent();
+  }
+}
+
+void gui::RequestRedraw() {
+  if (!gContext) {
+    return;
+  }
+  gContext->redrawRequested = true;
+  glfwPostEmptyEvent();
+}
+
+void gui::SetIdleFrameRate(double fps) {
+  gContext->idleFrameRate = fps;
 }
 
 void gui::AddInit(std::function<void()> initialize) {
@@ -534,8 +618,11 @@ bool gui::UpdateTextureFromImage(ImTextureID* texture, int width, int height,
   }
 
   if (width2 == width && height2 == height) {
-    UpdateTexture(texture, kPixelRGBA, width2, height2, imgData);
+    UpdateTexture(*texture, kPixelRGBA, width2, height2, imgData);
   } else {
+    // delete the old texture rather than leaking it; resizes are rare
+    // (e.g. a camera stream changing resolution)
+    DeleteTexture(*texture);
     *texture = CreateTexture(kPixelRGBA, width2, height2, imgData);
   }
 
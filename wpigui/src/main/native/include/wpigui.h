@@ -47,6 +47,23 @@ void Main();
  */
 void Exit();
 
+/**
+ * Requests the GUI redraw at full frame rate.  The main loop normally drops
+ * to an idle tick rate (see SetIdleFrameRate()) when there has been no user
+ * input for a short time; call this when data shown in the GUI has changed
+ * to get it on screen immediately.  Safe to call from any thread.
+ */
+void RequestRedraw();
+
+/**
+ * Sets the frame rate used when the GUI is idle (no user input and no
+ * RequestRedraw() calls).  Defaults to 4 frames/sec.  Pass 0 or a negative
+ * value to disable idle throttling and render every vsync.
+ *
+ * @param fps idle frames per second
+ */
+void SetIdleFrameRate(double fps);
+
 /**
  * Adds initializer to GUI.  The passed function is called once, immediately
  * after the GUI (both GLFW and Dear ImGui) are initialized in Initialize().
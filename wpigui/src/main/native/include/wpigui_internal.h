@@ -38,6 +38,9 @@ struct Context : public SavedSettings {
   int defaultWidth;
   int defaultHeight;
   bool isPlatformRendering{false};
+  std::atomic_bool redrawRequested{true};
+  double idleFrameRate = 4.0;  // frames/sec when idle; <= 0 renders every vsync
+  double lastInputTime = 0;    // glfwGetTime() of last user input event
 
   GLFWwindow* window = nullptr;
 
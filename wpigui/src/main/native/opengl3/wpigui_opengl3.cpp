@@ -3,6 +3,7 @@
 // the WPILib BSD license file in the root directory of this project.
 
 #include <cstdio>
+#include <unordered_map>
 
 #include <GL/gl3w.h>
 #include <GLFW/glfw3.h>
@@ -17,6 +18,23 @@ using namespace wpi::gui;
 
 static bool gPlatformValid = false;
 
+namespace {
+
+// Double-buffered pixel unpack buffers for a frequently updated texture.
+// While the driver DMAs the texture update out of one buffer, the next
+// frame's pixels are copied into the other, so UpdateTexture() never
+// blocks on the GPU for streaming sources such as camera previews.
+struct StreamingState {
+  GLuint pbos[2] = {0, 0};
+  size_t pboSize = 0;
+  int writePbo = 0;
+  bool primed = false;
+};
+
+}  // namespace
+
+static std::unordered_map<GLuint, StreamingState> gStreamingTextures;
+
 namespace wpi {
 
 void gui::PlatformCreateContext() {}
@@ -93,6 +111,12 @@ void gui::PlatformRenderFrame() {
 
 void gui::PlatformShutdown() {
   gPlatformValid = false;
+  for (auto&& stream : gStreamingTextures) {
+    if (stream.second.pbos[0] != 0) {
+      glDeleteBuffers(2, stream.second.pbos);
+    }
+  }
+  gStreamingTextures.clear();
   ImGui_ImplOpenGL3_Shutdown();
 }
 
@@ -120,14 +144,18 @@ ImTextureID gui::CreateTexture(PixelFormat format, int width, int height,
   glGenTextures(1, &texture);
   glBindTexture(GL_TEXTURE_2D, texture);
 
-  // Setup filtering parameters for display
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+  // Setup filtering parameters for display; use the mip chain when
+  // minifying so large images (e.g. field bitmaps) render cleanly and
+  // cheaply when zoomed out
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+                  GL_LINEAR_MIPMAP_LINEAR);
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
   // Upload pixels into texture
   glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
   glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0,
                GLPixelFormat(format), GL_UNSIGNED_BYTE, data);
+  glGenerateMipmap(GL_TEXTURE_2D);
 
   return reinterpret_cast<ImTextureID>(static_cast<uintptr_t>(texture));
 }
@@ -138,9 +166,45 @@ void gui::UpdateTexture(ImTextureID texture, PixelFormat format, int width,
   if (glTexture == 0) {
     return;
   }
+
+  // stream through double-buffered PBOs; the glTexSubImage2D below then
+  // sources from GPU-side memory and returns without waiting for the copy
+  size_t size = static_cast<size_t>(width) * height * 4;
+  auto& stream = gStreamingTextures[glTexture];
+  if (stream.pbos[0] == 0) {
+    glGenBuffers(2, stream.pbos);
+  }
+  if (stream.pboSize != size) {
+    for (GLuint pbo : stream.pbos) {
+      glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo);
+      glBufferData(GL_PIXEL_UNPACK_BUFFER, size, nullptr, GL_STREAM_DRAW);
+    }
+    stream.pboSize = size;
+    stream.primed = false;
+  }
+
+  // copy this frame's pixels into the write buffer (orphan first so we don't
+  // stall if the driver is still reading the previous contents)
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, stream.pbos[stream.writePbo]);
+  glBufferData(GL_PIXEL_UNPACK_BUFFER, size, nullptr, GL_STREAM_DRAW);
+  glBufferSubData(GL_PIXEL_UNPACK_BUFFER, 0, size, data);
+
+  // update the texture from the buffer filled on the previous update; on the
+  // first update after (re)allocation use this frame's buffer directly
+  if (stream.primed) {
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, stream.pbos[1 - stream.writePbo]);
+  }
   glBindTexture(GL_TEXTURE_2D, glTexture);
+  if (!stream.primed) {
+    // streaming updates only touch the base level; don't sample stale mips
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+  }
   glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GLPixelFormat(format),
-                  GL_UNSIGNED_BYTE, data);
+                  GL_UNSIGNED_BYTE, nullptr);
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+  stream.primed = true;
+  stream.writePbo = 1 - stream.writePbo;
 }
 
 void gui::DeleteTexture(ImTextureID texture) {
@@ -149,6 +213,13 @@ void gui::DeleteTexture(ImTextureID texture) {
   }
   GLuint glTexture = static_cast<GLuint>(reinterpret_cast<uintptr_t>(texture));
   if (glTexture != 0) {
+    auto it = gStreamingTextures.find(glTexture);
+    if (it != gStreamingTextures.end()) {
+      if (it->second.pbos[0] != 0) {
+        glDeleteBuffers(2, it->second.pbos);
+      }
+      gStreamingTextures.erase(it);
+    }
     glDeleteTextures(1, &glTexture);
   }
 }
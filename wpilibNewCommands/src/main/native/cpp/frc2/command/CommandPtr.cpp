@@ -4,6 +4,8 @@
 
 #include "frc2/command/CommandPtr.h"
 
+#include <typeinfo>
+
 #include "frc2/command/CommandScheduler.h"
 #include "frc2/command/ConditionalCommand.h"
 #include "frc2/command/InstantCommand.h"
@@ -20,6 +22,25 @@
 
 using namespace frc2;
 
+namespace {
+// If the wrapped command is already a group of the shape the decorator would
+// create, append to it instead of nesting another group around it, so long
+// decorator chains stay one flat group instead of a pointer-chasing tree.
+// Exact-type match only: a subclass may override behavior that flattening
+// would bypass.
+template <typename TGroup>
+bool AppendIfSameGroup(std::unique_ptr<Command>& self,
+                       std::unique_ptr<Command>&& next) {
+  if (typeid(*self) != typeid(TGroup)) {
+    return false;
+  }
+  std::vector<std::unique_ptr<Command>> temp;
+  temp.emplace_back(std::move(next));
+  static_cast<CommandGroupBase&>(*self).AddCommands(std::move(temp));
+  return true;
+}
+}  // namespace
+
 CommandPtr CommandPtr::Repeatedly() && {
   m_ptr = std::make_unique<RepeatCommand>(std::move(m_ptr));
   return std::move(*this);
@@ -86,9 +107,13 @@ CommandPtr CommandPtr::AndThen(
 }
 
 CommandPtr CommandPtr::AndThen(CommandPtr&& next) && {
+  auto nextPtr = std::move(next).Unwrap();
+  if (AppendIfSameGroup<SequentialCommandGroup>(m_ptr, std::move(nextPtr))) {
+    return std::move(*this);
+  }
   std::vector<std::unique_ptr<Command>> temp;
   temp.emplace_back(std::move(m_ptr));
-  temp.emplace_back(std::move(next).Unwrap());
+  temp.emplace_back(std::move(nextPtr));
   m_ptr = std::make_unique<SequentialCommandGroup>(std::move(temp));
   return std::move(*this);
 }
@@ -115,16 +140,25 @@ CommandPtr CommandPtr::BeforeStarting(CommandPtr&& before) && {
 }
 
 CommandPtr CommandPtr::WithTimeout(units::second_t duration) && {
+  std::unique_ptr<Command> wait = std::make_unique<WaitCommand>(duration);
+  if (AppendIfSameGroup<ParallelRaceGroup>(m_ptr, std::move(wait))) {
+    return std::move(*this);
+  }
   std::vector<std::unique_ptr<Command>> temp;
-  temp.emplace_back(std::make_unique<WaitCommand>(duration));
+  temp.emplace_back(std::move(wait));
   temp.emplace_back(std::move(m_ptr));
   m_ptr = std::make_unique<ParallelRaceGroup>(std::move(temp));
   return std::move(*this);
 }
 
 CommandPtr CommandPtr::Until(std::function<bool()> condition) && {
+  std::unique_ptr<Command> wait =
+      std::make_unique<WaitUntilCommand>(std::move(condition));
+  if (AppendIfSameGroup<ParallelRaceGroup>(m_ptr, std::move(wait))) {
+    return std::move(*this);
+  }
   std::vector<std::unique_ptr<Command>> temp;
-  temp.emplace_back(std::make_unique<WaitUntilCommand>(std::move(condition)));
+  temp.emplace_back(std::move(wait));
   temp.emplace_back(std::move(m_ptr));
   m_ptr = std::make_unique<ParallelRaceGroup>(std::move(temp));
   return std::move(*this);
@@ -146,17 +180,25 @@ CommandPtr CommandPtr::DeadlineWith(CommandPtr&& parallel) && {
 }
 
 CommandPtr CommandPtr::AlongWith(CommandPtr&& parallel) && {
+  auto parallelPtr = std::move(parallel).Unwrap();
+  if (AppendIfSameGroup<ParallelCommandGroup>(m_ptr, std::move(parallelPtr))) {
+    return std::move(*this);
+  }
   std::vector<std::unique_ptr<Command>> vec;
   vec.emplace_back(std::move(m_ptr));
-  vec.emplace_back(std::move(parallel).Unwrap());
+  vec.emplace_back(std::move(parallelPtr));
   m_ptr = std::make_unique<ParallelCommandGroup>(std::move(vec));
   return std::move(*this);
 }
 
 CommandPtr CommandPtr::RaceWith(CommandPtr&& parallel) && {
+  auto parallelPtr = std::move(parallel).Unwrap();
+  if (AppendIfSameGroup<ParallelRaceGroup>(m_ptr, std::move(parallelPtr))) {
+    return std::move(*this);
+  }
   std::vector<std::unique_ptr<Command>> vec;
   vec.emplace_back(std::move(m_ptr));
-  vec.emplace_back(std::move(parallel).Unwrap());
+  vec.emplace_back(std::move(parallelPtr));
   m_ptr = std::make_unique<ParallelRaceGroup>(std::move(vec));
   return std::move(*this);
 }
@@ -219,6 +261,7 @@ bool CommandPtr::HasRequirement(Subsystem* requirement) const {
 std::vector<std::unique_ptr<Command>> CommandPtr::UnwrapVector(
     std::vector<CommandPtr>&& vec) {
   std::vector<std::unique_ptr<Command>> ptrs;
+  ptrs.reserve(vec.size());
   for (auto&& ptr : vec) {
     ptrs.emplace_back(std::move(ptr).Unwrap());
   }
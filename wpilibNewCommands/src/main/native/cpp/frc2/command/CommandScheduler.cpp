@@ -4,8 +4,14 @@
 
 #include "frc2/command/CommandScheduler.h"
 
+#include <algorithm>
+#include <atomic>
+#include <bit>
 #include <cstdio>
+#include <thread>
+#include <vector>
 
+#include <fmt/format.h>
 #include <frc/RobotBase.h>
 #include <frc/RobotState.h>
 #include <frc/TimedRobot.h>
@@ -15,9 +21,14 @@
 #include <networktables/IntegerArrayTopic.h>
 #include <networktables/NTSendableBuilder.h>
 #include <networktables/StringArrayTopic.h>
+#include <wpi/DataLog.h>
 #include <wpi/DenseMap.h>
 #include <wpi/SmallVector.h>
+#include <wpi/StringMap.h>
+#include <wpi/condition_variable.h>
+#include <wpi/mutex.h>
 #include <wpi/sendable/SendableRegistry.h>
+#include <wpi/timestamp.h>
 
 #include "frc2/command/CommandGroupBase.h"
 #include "frc2/command/CommandPtr.h"
@@ -27,8 +38,15 @@ using namespace frc2;
 
 class CommandScheduler::Impl {
  public:
-  // A set of the currently-running commands.
-  wpi::SmallSet<Command*, 12> scheduledCommands;
+  // The currently-running commands, in scheduling order.  Kept flat so the
+  // run loop walks a contiguous pointer array; membership checks are linear
+  // scans, which beats hashing at the dozens-of-commands scale.
+  wpi::SmallVector<Command*, 12> scheduledCommands;
+
+  bool IsScheduled(const Command* command) const {
+    return std::find(scheduledCommands.begin(), scheduledCommands.end(),
+                     command) != scheduledCommands.end();
+  }
 
   // A map from required subsystems to their requiring commands.  Also used as a
   // set of the currently-required subsystems.
@@ -58,6 +76,207 @@ class CommandScheduler::Impl {
   bool inRunLoop = false;
   wpi::SmallVector<Command*, 4> toSchedule;
   wpi::SmallVector<Command*, 4> toCancel;
+
+  // Execution timing accumulators, keyed by command or subsystem name.
+  wpi::StringMap<CommandScheduler::TimingData> timingData;
+
+  // Lazily-created log entries for LogTimingData(), keyed like timingData.
+  struct TimingLogEntries {
+    wpi::log::IntegerLogEntry count;
+    wpi::log::IntegerLogEntry totalTime;
+    wpi::log::IntegerLogEntry maxTime;
+    wpi::log::IntegerArrayLogEntry histogram;
+  };
+  wpi::StringMap<TimingLogEntries> timingLogEntries;
+  wpi::log::DataLog* timingLog = nullptr;
+
+  void RecordTiming(std::string_view name, uint64_t elapsed) {
+    auto& data = timingData[name];
+    data.count++;
+    data.totalTime += elapsed;
+    if (elapsed > data.maxTime) {
+      data.maxTime = elapsed;
+    }
+    // bucket i covers [2^i, 2^(i+1)) microseconds; 0 lands in bucket 0 and
+    // anything past the last bucket is clamped into it
+    size_t bucket =
+        elapsed == 0
+            ? 0
+            : std::min<size_t>(std::bit_width(elapsed) - 1,
+                               CommandScheduler::TimingData::kNumBuckets - 1);
+    data.histogram[bucket]++;
+  }
+
+  // User-declared Periodic() data dependencies (subsystem -> the producers it
+  // consumes from) and the levelized batches derived from them.  Subsystems
+  // in the same level have no ordering constraints between each other.
+  wpi::DenseMap<Subsystem*, wpi::SmallVector<Subsystem*, 2>> periodicDeps;
+  std::vector<std::vector<Subsystem*>> periodicLevels;
+  std::vector<uint64_t> periodicTimes;
+  bool periodicLevelsDirty = true;
+
+  // Worker pool for running a level's periodics concurrently; the thread
+  // calling Run() joins each batch.  Workers claim batch entries with an
+  // atomic index, so a level needs no per-item allocation or queueing.
+  std::vector<std::thread> workers;
+  wpi::mutex workerMutex;
+  wpi::condition_variable workerWake;
+  wpi::condition_variable workerDone;
+  const std::vector<Subsystem*>* batch = nullptr;
+  std::vector<uint64_t>* batchTimes = nullptr;
+  std::atomic<size_t> batchIndex{0};
+  size_t batchRemaining = 0;
+  bool workersShutdown = false;
+
+  ~Impl() { StopWorkers(); }
+
+  void StopWorkers() {
+    {
+      std::scoped_lock lock{workerMutex};
+      workersShutdown = true;
+    }
+    workerWake.notify_all();
+    for (auto& worker : workers) {
+      worker.join();
+    }
+    workers.clear();
+    workersShutdown = false;
+  }
+
+  static void RunOnePeriodic(Subsystem* subsystem, uint64_t* elapsed) {
+    uint64_t start = wpi::Now();
+    subsystem->Periodic();
+    if constexpr (frc::RobotBase::IsSimulation()) {
+      subsystem->SimulationPeriodic();
+    }
+    *elapsed = wpi::Now() - start;
+  }
+
+  void WorkOnBatch() {
+    const std::vector<Subsystem*>* work;
+    std::vector<uint64_t>* times;
+    {
+      std::scoped_lock lock{workerMutex};
+      work = batch;
+      times = batchTimes;
+    }
+    if (!work) {
+      return;
+    }
+    size_t size = work->size();
+    size_t i;
+    while ((i = batchIndex.fetch_add(1, std::memory_order_relaxed)) < size) {
+      RunOnePeriodic((*work)[i], &(*times)[i]);
+      bool done;
+      {
+        std::scoped_lock lock{workerMutex};
+        done = (--batchRemaining == 0);
+      }
+      if (done) {
+        workerDone.notify_one();
+      }
+    }
+  }
+
+  void WorkerMain() {
+    for (;;) {
+      {
+        std::unique_lock lock{workerMutex};
+        workerWake.wait(lock, [this] {
+          return workersShutdown ||
+                 (batch && batchIndex.load(std::memory_order_relaxed) <
+                               batch->size());
+        });
+        if (workersShutdown) {
+          return;
+        }
+      }
+      WorkOnBatch();
+    }
+  }
+
+  // Runs one level of the execution graph, recording per-subsystem elapsed
+  // times into periodicTimes (indexed like the level).
+  void RunPeriodicBatch(const std::vector<Subsystem*>& level, bool serial) {
+    periodicTimes.resize(level.size());
+    if (serial || workers.empty() || level.size() == 1) {
+      for (size_t i = 0; i < level.size(); ++i) {
+        RunOnePeriodic(level[i], &periodicTimes[i]);
+      }
+      return;
+    }
+    {
+      std::scoped_lock lock{workerMutex};
+      batch = &level;
+      batchTimes = &periodicTimes;
+      batchIndex.store(0, std::memory_order_relaxed);
+      batchRemaining = level.size();
+    }
+    workerWake.notify_all();
+    WorkOnBatch();
+    std::unique_lock lock{workerMutex};
+    workerDone.wait(lock, [this] { return batchRemaining == 0; });
+    batch = nullptr;
+    batchTimes = nullptr;
+  }
+
+  // Levelizes the dependency graph: a subsystem's level is one past the
+  // deepest of its producers, so each level only depends on earlier ones.
+  void ComputePeriodicLevels() {
+    periodicLevels.clear();
+    // unsatisfied producer count per subsystem; -1 marks already placed
+    wpi::DenseMap<Subsystem*, int> remaining;
+    for (auto&& subsystem : subsystems) {
+      int count = 0;
+      auto deps = periodicDeps.find(subsystem.getFirst());
+      if (deps != periodicDeps.end()) {
+        for (Subsystem* dep : deps->second) {
+          if (subsystems.count(dep) != 0) {
+            ++count;
+          }
+        }
+      }
+      remaining[subsystem.getFirst()] = count;
+    }
+    for (;;) {
+      std::vector<Subsystem*> level;
+      for (auto&& entry : remaining) {
+        if (entry.second == 0) {
+          level.emplace_back(entry.first);
+          entry.second = -1;
+        }
+      }
+      if (level.empty()) {
+        break;
+      }
+      for (auto&& entry : remaining) {
+        if (entry.second <= 0) {
+          continue;
+        }
+        for (Subsystem* dep : periodicDeps[entry.first]) {
+          if (std::find(level.begin(), level.end(), dep) != level.end()) {
+            --entry.second;
+          }
+        }
+      }
+      periodicLevels.emplace_back(std::move(level));
+    }
+    // anything still unplaced is part of a dependency cycle; run it last
+    // (serially, since the declared ordering cannot be honored)
+    std::vector<Subsystem*> cycle;
+    for (auto&& entry : remaining) {
+      if (entry.second > 0) {
+        cycle.emplace_back(entry.first);
+      }
+    }
+    lastLevelIsCycle = !cycle.empty();
+    if (lastLevelIsCycle) {
+      periodicLevels.emplace_back(std::move(cycle));
+    }
+    periodicLevelsDirty = false;
+  }
+
+  bool lastLevelIsCycle = false;
 };
 
 template <typename TMap, typename TKey>
@@ -126,7 +345,7 @@ void CommandScheduler::Schedule(Command* command) {
   }
   if (m_impl->disabled ||
       (frc::RobotState::IsDisabled() && !command->RunsWhenDisabled()) ||
-      m_impl->scheduledCommands.contains(command)) {
+      m_impl->IsScheduled(command)) {
     return;
   }
 
@@ -134,14 +353,18 @@ void CommandScheduler::Schedule(Command* command) {
 
   wpi::SmallVector<Command*, 8> intersection;
 
+  // Check only this command's own (typically few) requirements against the
+  // currently-required subsystems instead of scanning every requirement held
+  // by every running command.
   bool isDisjoint = true;
   bool allInterruptible = true;
-  for (auto&& i1 : m_impl->requirements) {
-    if (requirements.find(i1.first) != requirements.end()) {
+  for (auto&& requirement : requirements) {
+    auto find = m_impl->requirements.find(requirement);
+    if (find != m_impl->requirements.end()) {
       isDisjoint = false;
-      allInterruptible &= (i1.second->GetInterruptionBehavior() ==
+      allInterruptible &= (find->second->GetInterruptionBehavior() ==
                            Command::InterruptionBehavior::kCancelSelf);
-      intersection.emplace_back(i1.second);
+      intersection.emplace_back(find->second);
     }
   }
 
@@ -151,7 +374,7 @@ void CommandScheduler::Schedule(Command* command) {
         Cancel(cmdToCancel);
       }
     }
-    m_impl->scheduledCommands.insert(command);
+    m_impl->scheduledCommands.emplace_back(command);
     for (auto&& requirement : requirements) {
       m_impl->requirements[requirement] = command;
     }
@@ -187,12 +410,34 @@ void CommandScheduler::Run() {
   m_watchdog.Reset();
 
   // Run the periodic method of all registered subsystems.
-  for (auto&& subsystem : m_impl->subsystems) {
-    subsystem.getFirst()->Periodic();
-    if constexpr (frc::RobotBase::IsSimulation()) {
-      subsystem.getFirst()->SimulationPeriodic();
+  if (m_impl->periodicDeps.empty() && m_impl->workers.empty()) {
+    for (auto&& subsystem : m_impl->subsystems) {
+      uint64_t start = wpi::Now();
+      subsystem.getFirst()->Periodic();
+      if constexpr (frc::RobotBase::IsSimulation()) {
+        subsystem.getFirst()->SimulationPeriodic();
+      }
+      m_impl->RecordTiming(subsystem.getFirst()->GetName(), wpi::Now() - start);
+      m_watchdog.AddEpoch("Subsystem Periodic()");
+    }
+  } else {
+    // Execution-graph mode: run the levelized batches, each level only after
+    // the previous one has fully completed.  Timing is recorded after each
+    // batch joins, as the accumulator map is not thread-safe.
+    if (m_impl->periodicLevelsDirty) {
+      m_impl->ComputePeriodicLevels();
+    }
+    for (size_t levelNum = 0; levelNum < m_impl->periodicLevels.size();
+         ++levelNum) {
+      auto& level = m_impl->periodicLevels[levelNum];
+      bool serial = m_impl->lastLevelIsCycle &&
+                    levelNum == m_impl->periodicLevels.size() - 1;
+      m_impl->RunPeriodicBatch(level, serial);
+      for (size_t i = 0; i < level.size(); ++i) {
+        m_impl->RecordTiming(level[i]->GetName(), m_impl->periodicTimes[i]);
+      }
+      m_watchdog.AddEpoch("Subsystem Periodic()");
     }
-    m_watchdog.AddEpoch("Subsystem Periodic()");
   }
 
   // Cache the active instance to avoid concurrency problems if SetActiveLoop()
@@ -203,18 +448,25 @@ void CommandScheduler::Run() {
   m_watchdog.AddEpoch("buttons.Run()");
 
   m_impl->inRunLoop = true;
-  // Run scheduled commands, remove finished commands.
-  for (Command* command : m_impl->scheduledCommands) {
+  // Run scheduled commands, remove finished commands.  Indexed iteration so
+  // finished commands can be erased in place.
+  for (size_t i = 0; i < m_impl->scheduledCommands.size();) {
+    Command* command = m_impl->scheduledCommands[i];
     if (!command->RunsWhenDisabled() && frc::RobotState::IsDisabled()) {
       Cancel(command);
+      ++i;
       continue;
     }
 
+    uint64_t start = wpi::Now();
     command->Execute();
+    uint64_t elapsed = wpi::Now() - start;
     for (auto&& action : m_impl->executeActions) {
       action(*command);
     }
-    m_watchdog.AddEpoch(command->GetName() + ".Execute()");
+    std::string name = command->GetName();
+    m_impl->RecordTiming(name, elapsed);
+    m_watchdog.AddEpoch(name + ".Execute()");
 
     if (command->IsFinished()) {
       command->End(false);
@@ -226,8 +478,10 @@ void CommandScheduler::Run() {
         m_impl->requirements.erase(requirement);
       }
 
-      m_impl->scheduledCommands.erase(command);
+      m_impl->scheduledCommands.erase(m_impl->scheduledCommands.begin() + i);
       m_watchdog.AddEpoch(command->GetName() + ".End(false)");
+    } else {
+      ++i;
     }
   }
   m_impl->inRunLoop = false;
@@ -259,12 +513,28 @@ void CommandScheduler::Run() {
 
 void CommandScheduler::RegisterSubsystem(Subsystem* subsystem) {
   m_impl->subsystems[subsystem] = nullptr;
+  m_impl->periodicLevelsDirty = true;
 }
 
 void CommandScheduler::UnregisterSubsystem(Subsystem* subsystem) {
   auto s = m_impl->subsystems.find(subsystem);
   if (s != m_impl->subsystems.end()) {
     m_impl->subsystems.erase(s);
+    m_impl->periodicLevelsDirty = true;
+  }
+}
+
+void CommandScheduler::AddPeriodicDependency(Subsystem* subsystem,
+                                             Subsystem* dependency) {
+  m_impl->periodicDeps[subsystem].emplace_back(dependency);
+  m_impl->periodicLevelsDirty = true;
+}
+
+void CommandScheduler::SetPeriodicWorkerCount(int workers) {
+  m_impl->StopWorkers();
+  for (int i = 0; i < workers; ++i) {
+    m_impl->workers.emplace_back(
+        [impl = m_impl.get()] { impl->WorkerMain(); });
   }
 }
 
@@ -329,14 +599,18 @@ void CommandScheduler::Cancel(Command* command) {
     return;
   }
 
-  auto find = m_impl->scheduledCommands.find(command);
+  auto find = std::find(m_impl->scheduledCommands.begin(),
+                        m_impl->scheduledCommands.end(), command);
   if (find == m_impl->scheduledCommands.end()) {
     return;
   }
-  m_impl->scheduledCommands.erase(*find);
-  for (auto&& requirement : m_impl->requirements) {
-    if (requirement.second == command) {
-      m_impl->requirements.erase(requirement.first);
+  m_impl->scheduledCommands.erase(find);
+  // The command's requirements map entries are exactly its own requirement
+  // keys, so release those directly rather than scanning the whole map.
+  for (auto&& requirement : command->GetRequirements()) {
+    auto entry = m_impl->requirements.find(requirement);
+    if (entry != m_impl->requirements.end() && entry->second == command) {
+      m_impl->requirements.erase(entry);
     }
   }
   command->End(true);
@@ -391,11 +665,11 @@ bool CommandScheduler::IsScheduled(
 }
 
 bool CommandScheduler::IsScheduled(const Command* command) const {
-  return m_impl->scheduledCommands.contains(command);
+  return m_impl->IsScheduled(command);
 }
 
 bool CommandScheduler::IsScheduled(const CommandPtr& command) const {
-  return m_impl->scheduledCommands.contains(command.get());
+  return m_impl->IsScheduled(command.get());
 }
 
 Command* CommandScheduler::Requiring(const Subsystem* subsystem) const {
@@ -431,6 +705,53 @@ void CommandScheduler::OnCommandFinish(Action action) {
   m_impl->finishActions.emplace_back(std::move(action));
 }
 
+std::vector<std::pair<std::string, CommandScheduler::TimingData>>
+CommandScheduler::GetTimingData() const {
+  std::vector<std::pair<std::string, TimingData>> result;
+  result.reserve(m_impl->timingData.size());
+  for (const auto& entry : m_impl->timingData) {
+    result.emplace_back(entry.getKey(), entry.getValue());
+  }
+  return result;
+}
+
+void CommandScheduler::LogTimingData(wpi::log::DataLog& log,
+                                     std::string_view prefix) {
+  if (m_impl->timingLog != &log) {
+    // entry handles belong to the previous log; start over
+    m_impl->timingLogEntries.clear();
+    m_impl->timingLog = &log;
+  }
+  int64_t timestamp = wpi::Now();
+  for (const auto& dataEntry : m_impl->timingData) {
+    auto it = m_impl->timingLogEntries.find(dataEntry.getKey());
+    if (it == m_impl->timingLogEntries.end()) {
+      std::string_view name = dataEntry.getKey();
+      it = m_impl->timingLogEntries
+               .try_emplace(
+                   name,
+                   Impl::TimingLogEntries{
+                       {log, fmt::format("{}/{}/count", prefix, name)},
+                       {log, fmt::format("{}/{}/totalTime", prefix, name)},
+                       {log, fmt::format("{}/{}/maxTime", prefix, name)},
+                       {log, fmt::format("{}/{}/histogram", prefix, name)}})
+               .first;
+    }
+    const TimingData& data = dataEntry.getValue();
+    auto& entries = it->getValue();
+    entries.count.Append(data.count, timestamp);
+    entries.totalTime.Append(data.totalTime, timestamp);
+    entries.maxTime.Append(data.maxTime, timestamp);
+    std::array<int64_t, TimingData::kNumBuckets> histogram;
+    std::copy(data.histogram.begin(), data.histogram.end(), histogram.begin());
+    entries.histogram.Append(histogram, timestamp);
+  }
+}
+
+void CommandScheduler::ResetTimingData() {
+  m_impl->timingData.clear();
+}
+
 void CommandScheduler::InitSendable(nt::NTSendableBuilder& builder) {
   builder.SetSmartDashboardType("Scheduler");
   builder.SetUpdateTable(
@@ -444,8 +765,7 @@ void CommandScheduler::InitSendable(nt::NTSendableBuilder& builder) {
           for (auto cancel : cancelEntry.Get()) {
             uintptr_t ptrTmp = static_cast<uintptr_t>(cancel);
             Command* command = reinterpret_cast<Command*>(ptrTmp);
-            if (m_impl->scheduledCommands.find(command) !=
-                m_impl->scheduledCommands.end()) {
+            if (m_impl->IsScheduled(command)) {
               Cancel(command);
             }
           }
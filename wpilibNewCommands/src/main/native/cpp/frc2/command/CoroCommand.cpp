@@ -0,0 +1,37 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "frc2/command/CoroCommand.h"
+
+using namespace frc2;
+
+CoroCommand::CoroCommand(std::function<CommandCoroutine()> body,
+                         std::initializer_list<Subsystem*> requirements)
+    : m_body{std::move(body)} {
+  AddRequirements(requirements);
+}
+
+CoroCommand::CoroCommand(std::function<CommandCoroutine()> body,
+                         std::span<Subsystem* const> requirements)
+    : m_body{std::move(body)} {
+  AddRequirements(requirements);
+}
+
+void CoroCommand::Initialize() {
+  m_coroutine = m_body();
+  // run the body up to its first suspension point
+  m_coroutine.Step();
+}
+
+void CoroCommand::Execute() {
+  m_coroutine.Step();
+}
+
+void CoroCommand::End(bool interrupted) {
+  m_coroutine.Reset();
+}
+
+bool CoroCommand::IsFinished() {
+  return m_coroutine.IsDone();
+}
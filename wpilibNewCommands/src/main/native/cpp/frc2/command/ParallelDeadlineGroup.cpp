@@ -65,6 +65,7 @@ void ParallelDeadlineGroup::AddCommands(
                         "while the group is running");
   }
 
+  m_commands.reserve(m_commands.size() + commands.size());
   for (auto&& command : commands) {
     if (RequirementsDisjoint(this, command.get())) {
       command->SetGrouped(true);
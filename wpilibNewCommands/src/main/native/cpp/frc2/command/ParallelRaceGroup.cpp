@@ -55,6 +55,7 @@ void ParallelRaceGroup::AddCommands(
                         "while the group is running");
   }
 
+  m_commands.reserve(m_commands.size() + commands.size());
   for (auto&& command : commands) {
     if (RequirementsDisjoint(this, command.get())) {
       command->SetGrouped(true);
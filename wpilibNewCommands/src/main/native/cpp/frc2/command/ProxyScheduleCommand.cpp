@@ -22,7 +22,15 @@ ProxyScheduleCommand::ProxyScheduleCommand(
   SetInsert(m_toSchedule, {&ptr, 1});
 }
 
+ProxyScheduleCommand::ProxyScheduleCommand(std::function<CommandPtr()> factory)
+    : m_factory{std::move(factory)} {}
+
 void ProxyScheduleCommand::Initialize() {
+  if (m_factory) {
+    m_owning = m_factory().Unwrap();
+    m_toSchedule.clear();
+    m_toSchedule.emplace_back(m_owning.get());
+  }
   for (auto* command : m_toSchedule) {
     command->Schedule();
   }
@@ -34,6 +42,11 @@ void ProxyScheduleCommand::End(bool interrupted) {
       command->Cancel();
     }
   }
+  if (m_factory) {
+    // the deferred command is materialized per-run; release between runs
+    m_toSchedule.clear();
+    m_owning.reset();
+  }
 }
 
 void ProxyScheduleCommand::Execute() {
@@ -65,6 +65,7 @@ void SequentialCommandGroup::AddCommands(
                         "while the group is running");
   }
 
+  m_commands.reserve(m_commands.size() + commands.size());
   for (auto&& command : commands) {
     command->SetGrouped(true);
     AddRequirements(command->GetRequirements());
@@ -4,6 +4,10 @@
 
 #include "frc2/command/Subsystem.h"
 
+#include <typeinfo>
+
+#include <wpi/Demangle.h>
+
 #include "frc2/command/CommandPtr.h"
 
 using namespace frc2;
@@ -15,6 +19,10 @@ void Subsystem::Periodic() {}
 
 void Subsystem::SimulationPeriodic() {}
 
+std::string Subsystem::GetName() const {
+  return wpi::Demangle(typeid(*this).name());
+}
+
 void Subsystem::SetDefaultCommand(CommandPtr&& defaultCommand) {
   CommandScheduler::GetInstance().SetDefaultCommand(this,
                                                     std::move(defaultCommand));
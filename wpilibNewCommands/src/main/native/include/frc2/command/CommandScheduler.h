@@ -4,10 +4,15 @@
 
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <initializer_list>
 #include <memory>
 #include <span>
+#include <string>
+#include <string_view>
 #include <utility>
+#include <vector>
 
 #include <frc/Errors.h>
 #include <frc/Watchdog.h>
@@ -18,6 +23,10 @@
 #include <wpi/deprecated.h>
 #include <wpi/sendable/SendableHelper.h>
 
+namespace wpi::log {
+class DataLog;
+}  // namespace wpi::log
+
 namespace frc2 {
 class Command;
 class CommandPtr;
@@ -164,6 +173,38 @@ class CommandScheduler final : public nt::NTSendable,
   void UnregisterSubsystem(std::initializer_list<Subsystem*> subsystems);
   void UnregisterSubsystem(std::span<Subsystem* const> subsystems);
 
+  /**
+   * Declares a data dependency between the Periodic() methods of two
+   * registered subsystems: subsystem's Periodic() runs after dependency's in
+   * each scheduler run.  Subsystems with no ordering constraint between them
+   * are batched together, and when a periodic worker pool is configured (see
+   * SetPeriodicWorkerCount()) a batch runs concurrently.  With no declared
+   * dependencies and no worker pool, periodics run in registration order as
+   * before.
+   *
+   * <p>Dependency cycles are not supported; subsystems involved in a cycle
+   * run serially after all others.
+   *
+   * @param subsystem  the subsystem whose Periodic() consumes the data
+   * @param dependency the subsystem whose Periodic() produces it
+   */
+  void AddPeriodicDependency(Subsystem* subsystem, Subsystem* dependency);
+
+  /**
+   * Sets the number of worker threads used to run batches of independent
+   * subsystem Periodic() methods (see AddPeriodicDependency()).  The calling
+   * thread joins each batch, so n workers give n+1 periodics in flight.  0
+   * (the default) runs everything on the calling thread; batching from
+   * declared dependencies still applies.
+   *
+   * <p>Periodic() methods that may run on a worker must not touch state
+   * shared with subsystems in the same batch without their own
+   * synchronization.
+   *
+   * @param workers the number of worker threads
+   */
+  void SetPeriodicWorkerCount(int workers);
+
   /**
    * Sets the default command for a subsystem.  Registers that subsystem if it
    * is not already registered.  Default commands will run whenever there is no
@@ -355,6 +396,53 @@ class CommandScheduler final : public nt::NTSendable,
    */
   void OnCommandFinish(Action action);
 
+  /**
+   * Execution timing statistics for one command or subsystem periodic method,
+   * accumulated by Run().  All times are in microseconds.  Histogram bucket i
+   * counts executions that took [2^i, 2^(i+1)) microseconds; the last bucket
+   * also counts anything longer.
+   */
+  struct TimingData {
+    /// Number of recorded executions.
+    uint64_t count = 0;
+    /// Total execution time (microseconds).
+    uint64_t totalTime = 0;
+    /// Longest single execution (microseconds).
+    uint64_t maxTime = 0;
+    /// Number of histogram buckets.
+    static constexpr size_t kNumBuckets = 16;
+    /// Power-of-two histogram of execution times.
+    std::array<uint64_t, kNumBuckets> histogram{};
+  };
+
+  /**
+   * Returns the execution timing data accumulated since startup (or since the
+   * last ResetTimingData() call), keyed by command name.  Subsystem Periodic()
+   * time is included under the subsystem's name.
+   *
+   * @return pairs of name and timing data
+   */
+  std::vector<std::pair<std::string, TimingData>> GetTimingData() const;
+
+  /**
+   * Appends all accumulated timing data to a data log, creating entries named
+   * "<prefix>/<name>/count", ".../totalTime", ".../maxTime", and
+   * ".../histogram".  Counters are cumulative, so periodic drains (for
+   * example every few seconds into frc::DataLogManager::GetLog()) can be
+   * diffed afterwards.  Log entries are reused across calls with the same
+   * log.
+   *
+   * @param log the data log to append to
+   * @param prefix the prefix for entry names
+   */
+  void LogTimingData(wpi::log::DataLog& log,
+                     std::string_view prefix = "scheduler/timing");
+
+  /**
+   * Clears all accumulated timing data.
+   */
+  void ResetTimingData();
+
   void InitSendable(nt::NTSendableBuilder& builder) override;
 
  private:
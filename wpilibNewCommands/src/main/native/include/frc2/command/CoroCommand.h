@@ -0,0 +1,303 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <initializer_list>
+#include <span>
+#include <utility>
+
+#include <frc/Timer.h>
+#include <units/time.h>
+
+#include "frc2/command/CommandBase.h"
+#include "frc2/command/CommandHelper.h"
+
+namespace frc2 {
+
+/**
+ * Coroutine return type for CoroCommand bodies.
+ *
+ * The coroutine frame holds the body's locals and the pending awaitable, so a
+ * multi-step sequence lives in a single allocation instead of a tree of
+ * command-group wrappers.  The pending awaitable registers a poll function in
+ * the promise; CoroCommand checks it once per scheduler cycle and resumes the
+ * coroutine when it reports ready.
+ *
+ * This class is provided by the NewCommands VendorDep
+ */
+class CommandCoroutine {
+ public:
+  struct promise_type {
+    CommandCoroutine get_return_object() {
+      return CommandCoroutine{
+          std::coroutine_handle<promise_type>::from_promise(*this)};
+    }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    std::suspend_always final_suspend() noexcept { return {}; }
+    void return_void() noexcept {}
+    void unhandled_exception() noexcept {
+      exception = std::current_exception();
+    }
+
+    // Set by awaitables on suspension: polled once per scheduler cycle, and
+    // the coroutine is resumed when it returns true.  When null the
+    // coroutine resumes every cycle.  The awaitable pointer is into the
+    // coroutine frame, so no allocation is made per suspension point.
+    bool (*ready)(void* awaitable) = nullptr;
+    void* awaitable = nullptr;
+    std::exception_ptr exception;
+  };
+
+  CommandCoroutine() = default;
+
+  ~CommandCoroutine() {
+    if (m_handle) {
+      m_handle.destroy();
+    }
+  }
+
+  CommandCoroutine(CommandCoroutine&& other) noexcept
+      : m_handle{std::exchange(other.m_handle, nullptr)} {}
+
+  CommandCoroutine& operator=(CommandCoroutine&& other) noexcept {
+    if (&other != this) {
+      if (m_handle) {
+        m_handle.destroy();
+      }
+      m_handle = std::exchange(other.m_handle, nullptr);
+    }
+    return *this;
+  }
+
+  CommandCoroutine(const CommandCoroutine&) = delete;
+  CommandCoroutine& operator=(const CommandCoroutine&) = delete;
+
+  /**
+   * Returns true if the coroutine has run to completion (or was never
+   * created).
+   */
+  bool IsDone() const { return !m_handle || m_handle.done(); }
+
+  /**
+   * Polls the pending awaitable and resumes the coroutine if it is ready.
+   * Rethrows any exception that escaped the coroutine body.
+   */
+  void Step() {
+    if (IsDone()) {
+      return;
+    }
+    auto& promise = m_handle.promise();
+    if (promise.ready && !promise.ready(promise.awaitable)) {
+      return;
+    }
+    m_handle.resume();
+    if (m_handle.done() && promise.exception) {
+      std::rethrow_exception(promise.exception);
+    }
+  }
+
+  /**
+   * Destroys the coroutine frame, running the destructors of any locals in
+   * scope at the current suspension point.
+   */
+  void Reset() {
+    if (m_handle) {
+      m_handle.destroy();
+      m_handle = nullptr;
+    }
+  }
+
+ private:
+  explicit CommandCoroutine(
+      std::coroutine_handle<promise_type> handle)
+      : m_handle{handle} {}
+
+  std::coroutine_handle<promise_type> m_handle;
+};
+
+/**
+ * Awaitables for use inside CommandCoroutine bodies.
+ */
+namespace coro {
+
+/**
+ * Awaitable that suspends the coroutine until the next scheduler cycle.
+ */
+struct NextCycle {
+  bool await_ready() const noexcept { return false; }
+  void await_suspend(
+      std::coroutine_handle<CommandCoroutine::promise_type> handle)
+      const noexcept {
+    handle.promise().ready = nullptr;
+    handle.promise().awaitable = nullptr;
+  }
+  void await_resume() const noexcept {}
+};
+
+/**
+ * Awaitable that suspends the coroutine until a condition returns true,
+ * checked once per scheduler cycle.
+ */
+template <typename Condition>
+class WaitUntil {
+ public:
+  explicit WaitUntil(Condition condition)
+      : m_condition{std::move(condition)} {}
+
+  bool await_ready() { return m_condition(); }
+  void await_suspend(
+      std::coroutine_handle<CommandCoroutine::promise_type> handle) {
+    handle.promise().awaitable = this;
+    handle.promise().ready = [](void* self) {
+      return static_cast<WaitUntil*>(self)->m_condition();
+    };
+  }
+  void await_resume() const noexcept {}
+
+ private:
+  Condition m_condition;
+};
+
+/**
+ * Awaitable that suspends the coroutine for the specified duration.
+ */
+class Wait {
+ public:
+  explicit Wait(units::second_t duration) : m_duration{duration} {}
+
+  bool await_ready() {
+    m_timer.Reset();
+    m_timer.Start();
+    return m_timer.HasElapsed(m_duration);
+  }
+  void await_suspend(
+      std::coroutine_handle<CommandCoroutine::promise_type> handle) {
+    handle.promise().awaitable = this;
+    handle.promise().ready = [](void* self) {
+      auto& wait = *static_cast<Wait*>(self);
+      return wait.m_timer.HasElapsed(wait.m_duration);
+    };
+  }
+  void await_resume() const noexcept {}
+
+ private:
+  units::second_t m_duration;
+  frc::Timer m_timer;
+};
+
+/**
+ * Awaitable that runs another command inline to completion, one Execute()
+ * per scheduler cycle.  The inner command is not seen by the scheduler; the
+ * enclosing CoroCommand must declare the inner command's requirements.  If
+ * the coroutine is destroyed while the inner command is still running (the
+ * enclosing command was interrupted), the inner command's End(true) is
+ * called.
+ */
+class Await {
+ public:
+  explicit Await(Command& command) : m_command{&command} {}
+
+  Await(const Await&) = delete;
+  Await& operator=(const Await&) = delete;
+
+  ~Await() {
+    if (m_running) {
+      m_command->End(true);
+    }
+  }
+
+  bool await_ready() {
+    m_command->Initialize();
+    if (m_command->IsFinished()) {
+      m_command->End(false);
+      return true;
+    }
+    m_running = true;
+    return false;
+  }
+  void await_suspend(
+      std::coroutine_handle<CommandCoroutine::promise_type> handle) {
+    handle.promise().awaitable = this;
+    handle.promise().ready = [](void* self) {
+      auto& await = *static_cast<Await*>(self);
+      await.m_command->Execute();
+      if (await.m_command->IsFinished()) {
+        await.m_command->End(false);
+        await.m_running = false;
+        return true;
+      }
+      return false;
+    };
+  }
+  void await_resume() const noexcept {}
+
+ private:
+  Command* m_command;
+  bool m_running = false;
+};
+
+}  // namespace coro
+
+/**
+ * A command whose body is a C++20 coroutine.  co_await suspension points take
+ * the place of wrapper commands, so a sequence that would otherwise be a
+ * SequentialCommandGroup of individually-allocated decorators is one object
+ * with one resumption per scheduler cycle:
+ *
+ * @code{.cpp}
+ * CoroCommand shoot{[&]() -> CommandCoroutine {
+ *   intake.Deploy();
+ *   co_await coro::WaitUntil{[&] { return shooter.AtSpeed(); }};
+ *   feeder.Feed();
+ *   co_await coro::Wait{0.5_s};
+ *   feeder.Stop();
+ * }, {&intake, &shooter, &feeder}};
+ * @endcode
+ *
+ * The body factory is invoked on each initialization, so the command can be
+ * scheduled repeatedly.  Code before the first co_await runs during
+ * Initialize(); ending the command (including interruption) destroys the
+ * coroutine frame, running the destructors of locals in scope.
+ *
+ * This class is provided by the NewCommands VendorDep
+ */
+class CoroCommand : public CommandHelper<CommandBase, CoroCommand> {
+ public:
+  /**
+   * Creates a new CoroCommand.
+   *
+   * @param body         factory for the coroutine run by this command
+   * @param requirements the subsystems required by this command
+   */
+  CoroCommand(std::function<CommandCoroutine()> body,
+              std::initializer_list<Subsystem*> requirements);
+
+  /**
+   * Creates a new CoroCommand.
+   *
+   * @param body         factory for the coroutine run by this command
+   * @param requirements the subsystems required by this command
+   */
+  explicit CoroCommand(std::function<CommandCoroutine()> body,
+                       std::span<Subsystem* const> requirements = {});
+
+  CoroCommand(CoroCommand&& other) = default;
+
+  void Initialize() override;
+
+  void Execute() override;
+
+  void End(bool interrupted) override;
+
+  bool IsFinished() override;
+
+ private:
+  std::function<CommandCoroutine()> m_body;
+  CommandCoroutine m_coroutine;
+};
+}  // namespace frc2
@@ -76,6 +76,7 @@ class ParallelDeadlineGroup
                 std::is_base_of<Command, std::remove_reference_t<Types>>...>>>
   void AddCommands(Types&&... commands) {
     std::vector<std::unique_ptr<Command>> foo;
+    foo.reserve(sizeof...(Types));
     ((void)foo.emplace_back(std::make_unique<std::remove_reference_t<Types>>(
          std::forward<Types>(commands))),
      ...);
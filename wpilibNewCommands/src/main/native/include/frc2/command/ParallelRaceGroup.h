@@ -56,6 +56,7 @@ class ParallelRaceGroup
   template <class... Types>
   void AddCommands(Types&&... commands) {
     std::vector<std::unique_ptr<Command>> foo;
+    foo.reserve(sizeof...(Types));
     ((void)foo.emplace_back(std::make_unique<std::remove_reference_t<Types>>(
          std::forward<Types>(commands))),
      ...);
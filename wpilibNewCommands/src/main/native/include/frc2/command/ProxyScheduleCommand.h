@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <span>
 
@@ -11,6 +12,7 @@
 
 #include "frc2/command/CommandBase.h"
 #include "frc2/command/CommandHelper.h"
+#include "frc2/command/CommandPtr.h"
 #include "frc2/command/SetUtilities.h"
 
 namespace frc2 {
@@ -46,6 +48,17 @@ class ProxyScheduleCommand
    */
   explicit ProxyScheduleCommand(std::unique_ptr<Command>&& toSchedule);
 
+  /**
+   * Creates a new ProxyScheduleCommand with a deferred command.  The command
+   * is not constructed until this command is initialized: the factory is
+   * invoked on each initialization and the materialized command is scheduled,
+   * then destroyed again when this command ends.  Useful when the proxied
+   * command is expensive to build and rarely runs.
+   *
+   * @param factory a factory for the command to schedule
+   */
+  explicit ProxyScheduleCommand(std::function<CommandPtr()> factory);
+
   ProxyScheduleCommand(ProxyScheduleCommand&& other) = default;
 
   void Initialize() override;
@@ -59,6 +72,7 @@ class ProxyScheduleCommand
  private:
   wpi::SmallVector<Command*, 4> m_toSchedule;
   std::unique_ptr<Command> m_owning;
+  std::function<CommandPtr()> m_factory;
   bool m_finished{false};
 };
 }  // namespace frc2
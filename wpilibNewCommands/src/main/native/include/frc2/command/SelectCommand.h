@@ -9,7 +9,9 @@
 #pragma warning(disable : 4521)
 #endif
 
+#include <functional>
 #include <memory>
+#include <span>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
@@ -17,6 +19,7 @@
 
 #include "frc2/command/CommandBase.h"
 #include "frc2/command/CommandGroupBase.h"
+#include "frc2/command/CommandPtr.h"
 #include "frc2/command/PrintCommand.h"
 
 namespace frc2 {
@@ -90,6 +93,34 @@ class SelectCommand : public CommandHelper<CommandBase, SelectCommand<Key>> {
     }
   }
 
+  /**
+   * Creates a new selectcommand with deferred branches.  Branches are stored
+   * as factories rather than constructed commands; only the selected branch
+   * is materialized, on each initialization, and it is destroyed again when
+   * this command ends.  This keeps robot-init time and idle memory
+   * proportional to one branch instead of all of them.
+   *
+   * <p>Because no branch command exists until selection, requirements cannot
+   * be derived from the branches and must be passed explicitly: supply the
+   * union of the requirements of all branches.  For the same reason this
+   * command does not run when disabled.
+   *
+   * @param selector     the selector to determine which command to run
+   * @param factories    the map of command factories to choose from
+   * @param requirements the union of the subsystems required by the branches
+   */
+  SelectCommand(
+      std::function<Key()> selector,
+      std::vector<std::pair<Key, std::function<CommandPtr()>>>&& factories,
+      std::span<Subsystem* const> requirements = {})
+      : m_selector{std::move(selector)} {
+    for (auto&& factory : factories) {
+      m_factories.emplace(std::move(factory.first), std::move(factory.second));
+    }
+    this->AddRequirements(requirements);
+    m_runsWhenDisabled = false;
+  }
+
   // No copy constructors for command groups
   SelectCommand(const SelectCommand& other) = delete;
 
@@ -111,7 +142,12 @@ class SelectCommand : public CommandHelper<CommandBase, SelectCommand<Key>> {
   void Execute() override { m_selectedCommand->Execute(); }
 
   void End(bool interrupted) override {
-    return m_selectedCommand->End(interrupted);
+    m_selectedCommand->End(interrupted);
+    if (m_selectedOwned) {
+      // deferred branches are materialized per-run; release between runs
+      m_selectedCommand = nullptr;
+      m_selectedOwned.reset();
+    }
   }
 
   bool IsFinished() override { return m_selectedCommand->IsFinished(); }
@@ -125,19 +161,31 @@ class SelectCommand : public CommandHelper<CommandBase, SelectCommand<Key>> {
 
  private:
   std::unordered_map<Key, std::unique_ptr<Command>> m_commands;
+  std::unordered_map<Key, std::function<CommandPtr()>> m_factories;
   std::function<Key()> m_selector;
   std::function<Command*()> m_toRun;
+  std::unique_ptr<Command> m_selectedOwned;
   Command* m_selectedCommand;
   bool m_runsWhenDisabled = true;
 };
 
 template <typename T>
 void SelectCommand<T>::Initialize() {
-  if (m_selector) {
+  if (!m_factories.empty()) {
+    auto find = m_factories.find(m_selector());
+    if (find != m_factories.end()) {
+      m_selectedOwned = find->second().Unwrap();
+    } else {
+      m_selectedOwned = std::make_unique<PrintCommand>(
+          "SelectCommand selector value does not correspond to any command!");
+    }
+    m_selectedCommand = m_selectedOwned.get();
+  } else if (m_selector) {
     auto find = m_commands.find(m_selector());
     if (find == m_commands.end()) {
-      m_selectedCommand = new PrintCommand(
+      m_selectedOwned = std::make_unique<PrintCommand>(
           "SelectCommand selector value does not correspond to any command!");
+      m_selectedCommand = m_selectedOwned.get();
       return;
     }
     m_selectedCommand = find->second.get();
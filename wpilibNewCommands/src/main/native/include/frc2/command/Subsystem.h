@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <string>
 #include <type_traits>
 #include <utility>
 
@@ -56,6 +57,15 @@ class Subsystem {
    */
   virtual void SimulationPeriodic();
 
+  /**
+   * Gets the name of this Subsystem.  Defaults to the demangled type name;
+   * SubsystemBase overrides this to return the name registered with
+   * SendableRegistry.
+   *
+   * @return the subsystem's name
+   */
+  virtual std::string GetName() const;
+
   /**
    * Sets the default Command of the subsystem.  The default command will be
    * automatically scheduled when no other commands are scheduled that require
@@ -0,0 +1,92 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "CommandTestBase.h"
+#include "frc2/command/CoroCommand.h"
+#include "frc2/command/InstantCommand.h"
+
+using namespace frc2;
+class CoroCommandTest : public CommandTestBase {};
+
+TEST_F(CoroCommandTest, CoroCommandSchedule) {
+  CommandScheduler scheduler = GetScheduler();
+
+  int stage = 0;
+  bool go = false;
+
+  CoroCommand command{[&]() -> CommandCoroutine {
+    stage = 1;
+    co_await coro::WaitUntil{[&] { return go; }};
+    stage = 2;
+  }};
+
+  scheduler.Schedule(&command);
+  EXPECT_EQ(1, stage);  // body runs to first co_await on initialize
+  scheduler.Run();
+  EXPECT_TRUE(scheduler.IsScheduled(&command));
+  EXPECT_EQ(1, stage);
+  go = true;
+  scheduler.Run();
+  EXPECT_EQ(2, stage);
+  scheduler.Run();
+  EXPECT_FALSE(scheduler.IsScheduled(&command));
+}
+
+TEST_F(CoroCommandTest, CoroCommandReschedule) {
+  CommandScheduler scheduler = GetScheduler();
+
+  int runs = 0;
+
+  CoroCommand command{[&]() -> CommandCoroutine {
+    runs++;
+    co_await coro::NextCycle{};
+  }};
+
+  scheduler.Schedule(&command);
+  scheduler.Run();
+  scheduler.Run();
+  EXPECT_FALSE(scheduler.IsScheduled(&command));
+  scheduler.Schedule(&command);
+  EXPECT_EQ(2, runs);  // body factory reruns on each initialize
+}
+
+TEST_F(CoroCommandTest, CoroCommandInterrupt) {
+  CommandScheduler scheduler = GetScheduler();
+
+  bool cleanedUp = false;
+
+  struct Cleanup {
+    bool* flag;
+    ~Cleanup() { *flag = true; }
+  };
+
+  CoroCommand command{[&]() -> CommandCoroutine {
+    Cleanup cleanup{&cleanedUp};
+    co_await coro::WaitUntil{[] { return false; }};
+  }};
+
+  scheduler.Schedule(&command);
+  scheduler.Run();
+  EXPECT_FALSE(cleanedUp);
+  scheduler.Cancel(&command);
+  EXPECT_TRUE(cleanedUp);  // locals in scope are destroyed on interruption
+}
+
+TEST_F(CoroCommandTest, CoroCommandAwaitCommand) {
+  CommandScheduler scheduler = GetScheduler();
+
+  int counter = 0;
+  InstantCommand inner{[&counter] { counter++; }};
+
+  CoroCommand command{[&]() -> CommandCoroutine {
+    co_await coro::Await{inner};
+    counter += 10;
+  }};
+
+  scheduler.Schedule(&command);
+  scheduler.Run();
+  scheduler.Run();
+  EXPECT_FALSE(scheduler.IsScheduled(&command));
+  EXPECT_EQ(11, counter);
+}
@@ -61,6 +61,25 @@ TEST_F(ProxyScheduleCommandTest, OwningCommandSchedule) {
   EXPECT_TRUE(scheduled);
 }
 
+TEST_F(ProxyScheduleCommandTest, DeferredCommandSchedule) {
+  CommandScheduler& scheduler = CommandScheduler::GetInstance();
+
+  int constructed = 0;
+  bool scheduled = false;
+
+  ProxyScheduleCommand command([&]() -> CommandPtr {
+    constructed++;
+    return InstantCommand([&scheduled] { scheduled = true; }).ToPtr();
+  });
+
+  EXPECT_EQ(0, constructed);  // not built until this command initializes
+  scheduler.Schedule(&command);
+  scheduler.Run();
+
+  EXPECT_EQ(1, constructed);
+  EXPECT_TRUE(scheduled);
+}
+
 TEST_F(ProxyScheduleCommandTest, OwningCommandEnd) {
   CommandScheduler& scheduler = CommandScheduler::GetInstance();
 
@@ -2,9 +2,13 @@
 // Open Source Software; you can modify and/or share it under the terms of
 // the WPILib BSD license file in the root directory of this project.
 
+#include <atomic>
+#include <vector>
+
 #include "CommandTestBase.h"
 #include "frc2/command/InstantCommand.h"
 #include "frc2/command/RunCommand.h"
+#include "frc2/command/SubsystemBase.h"
 
 using namespace frc2;
 class SchedulerTest : public CommandTestBase {};
@@ -52,6 +56,67 @@ TEST_F(SchedulerTest, UnregisterSubsystem) {
   EXPECT_NO_FATAL_FAILURE(scheduler.UnregisterSubsystem(&system));
 }
 
+TEST_F(SchedulerTest, PeriodicDependencyOrder) {
+  CommandScheduler scheduler = GetScheduler();
+
+  std::vector<int> order;
+
+  class OrderedSubsystem : public SubsystemBase {
+   public:
+    OrderedSubsystem(std::vector<int>& order, int id)
+        : m_order{order}, m_id{id} {}
+    void Periodic() override { m_order.push_back(m_id); }
+
+   private:
+    std::vector<int>& m_order;
+    int m_id;
+  };
+
+  OrderedSubsystem producer{order, 0};
+  OrderedSubsystem consumer{order, 1};
+
+  scheduler.RegisterSubsystem(&producer);
+  scheduler.RegisterSubsystem(&consumer);
+  scheduler.AddPeriodicDependency(&consumer, &producer);
+
+  scheduler.Run();
+
+  ASSERT_EQ(2u, order.size());
+  EXPECT_EQ(0, order[0]);  // producer's Periodic() runs first
+  EXPECT_EQ(1, order[1]);
+}
+
+TEST_F(SchedulerTest, PeriodicWorkerPool) {
+  CommandScheduler scheduler = GetScheduler();
+
+  std::atomic<int> counter{0};
+
+  class CountingSubsystem : public SubsystemBase {
+   public:
+    explicit CountingSubsystem(std::atomic<int>& counter)
+        : m_counter{counter} {}
+    void Periodic() override { m_counter++; }
+
+   private:
+    std::atomic<int>& m_counter;
+  };
+
+  CountingSubsystem subsystems[]{
+      CountingSubsystem{counter}, CountingSubsystem{counter},
+      CountingSubsystem{counter}, CountingSubsystem{counter}};
+  for (auto& subsystem : subsystems) {
+    scheduler.RegisterSubsystem(&subsystem);
+  }
+  scheduler.SetPeriodicWorkerCount(2);
+
+  for (int i = 0; i < 10; ++i) {
+    scheduler.Run();
+  }
+
+  EXPECT_EQ(40, counter);  // each subsystem ran exactly once per cycle
+  scheduler.SetPeriodicWorkerCount(0);
+}
+
 TEST_F(SchedulerTest, SchedulerCancelAll) {
   CommandScheduler scheduler = GetScheduler();
 
@@ -36,6 +36,34 @@ TEST_F(SelectCommandTest, SelectCommand) {
   EXPECT_FALSE(scheduler.IsScheduled(&select));
 }
 
+TEST_F(SelectCommandTest, SelectCommandDeferred) {
+  CommandScheduler scheduler = GetScheduler();
+
+  int constructed = 0;
+  int counter = 0;
+
+  std::vector<std::pair<int, std::function<CommandPtr()>>> factories;
+  factories.emplace_back(1, [&]() -> CommandPtr {
+    constructed++;
+    return InstantCommand([&counter] { counter++; }).ToPtr();
+  });
+  factories.emplace_back(2, [&]() -> CommandPtr {
+    constructed++;
+    return InstantCommand().ToPtr();
+  });
+
+  SelectCommand<int> select([] { return 1; }, std::move(factories));
+
+  EXPECT_EQ(0, constructed);  // no branch is built until selection
+  scheduler.Schedule(&select);
+  scheduler.Run();
+  scheduler.Run();
+
+  EXPECT_FALSE(scheduler.IsScheduled(&select));
+  EXPECT_EQ(1, constructed);
+  EXPECT_EQ(1, counter);
+}
+
 TEST_F(SelectCommandTest, SelectCommandRequirement) {
   CommandScheduler scheduler = GetScheduler();
 
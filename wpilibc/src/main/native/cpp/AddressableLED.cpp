@@ -4,6 +4,8 @@
 
 #include "frc/AddressableLED.h"
 
+#include <cmath>
+
 #include <hal/AddressableLED.h>
 #include <hal/FRCUsageReporting.h>
 #include <hal/HALBase.h>
@@ -46,6 +48,8 @@ void AddressableLED::SetLength(int length) {
   int32_t status = 0;
   HAL_SetAddressableLEDLength(m_handle, length, &status);
   FRC_CheckErrorStatus(status, "Port {} length {}", m_port, length);
+  m_buffer.resize(length);
+  m_converted.resize(length);
 }
 
 static_assert(sizeof(AddressableLED::LEDData) == sizeof(HAL_AddressableLEDData),
@@ -65,6 +69,83 @@ void AddressableLED::SetData(std::initializer_list<LEDData> ledData) {
   FRC_CheckErrorStatus(status, "Port {}", m_port);
 }
 
+void AddressableLED::SetColorOrder(ColorOrder order) {
+  m_colorOrder = order;
+  if (!m_converted.empty()) {
+    ConvertRange(0, m_converted.size());
+  }
+}
+
+void AddressableLED::SetGamma(double gamma) {
+  m_gammaEnabled = gamma != 1.0;
+  if (m_gammaEnabled) {
+    for (int i = 0; i < 256; i++) {
+      m_gammaLUT[i] = static_cast<uint8_t>(
+          std::lround(255.0 * std::pow(i / 255.0, gamma)));
+    }
+  }
+  if (!m_converted.empty()) {
+    ConvertRange(0, m_converted.size());
+  }
+}
+
+std::span<AddressableLED::LEDData> AddressableLED::GetWriteBuffer() {
+  return m_buffer;
+}
+
+void AddressableLED::Commit() {
+  Commit(0, m_buffer.size());
+}
+
+void AddressableLED::Commit(int start, int length) {
+  if (start < 0 || length < 0 ||
+      static_cast<size_t>(start) + static_cast<size_t>(length) >
+          m_buffer.size()) {
+    throw FRC_MakeError(err::ParameterOutOfRange, "range [{}, {}) length {}",
+                        start, start + length, m_buffer.size());
+  }
+  ConvertRange(start, length);
+  int32_t status = 0;
+  HAL_WriteAddressableLEDData(m_handle, m_converted.data(), m_converted.size(),
+                              &status);
+  FRC_CheckErrorStatus(status, "Port {}", m_port);
+}
+
+void AddressableLED::ConvertRange(int start, int length) {
+  for (int i = start; i < start + length; i++) {
+    const auto& in = m_buffer[i];
+    uint8_t r = in.r;
+    uint8_t g = in.g;
+    uint8_t b = in.b;
+    if (m_gammaEnabled) {
+      r = m_gammaLUT[r];
+      g = m_gammaLUT[g];
+      b = m_gammaLUT[b];
+    }
+    auto& out = m_converted[i];
+    switch (m_colorOrder) {
+      case ColorOrder::kRGB:
+        out.SetRGB(r, g, b);
+        break;
+      case ColorOrder::kRBG:
+        out.SetRGB(r, b, g);
+        break;
+      case ColorOrder::kGRB:
+        out.SetRGB(g, r, b);
+        break;
+      case ColorOrder::kGBR:
+        out.SetRGB(g, b, r);
+        break;
+      case ColorOrder::kBRG:
+        out.SetRGB(b, r, g);
+        break;
+      case ColorOrder::kBGR:
+        out.SetRGB(b, g, r);
+        break;
+    }
+  }
+}
+
 void AddressableLED::SetBitTiming(units::nanosecond_t lowTime0,
                                   units::nanosecond_t highTime0,
                                   units::nanosecond_t lowTime1,
@@ -195,7 +195,8 @@ void AnalogInput::SetSimDevice(HAL_SimDeviceHandle device) {
 }
 
 void AnalogInput::InitSendable(wpi::SendableBuilder& builder) {
+  static constexpr wpi::SendableProperty kProperties[] = {
+      wpi::SendableProperty::Double<&AnalogInput::GetAverageVoltage>("Value")};
   builder.SetSmartDashboardType("Analog Input");
-  builder.AddDoubleProperty(
-      "Value", [=, this] { return GetAverageVoltage(); }, nullptr);
+  builder.AddPropertyTable(this, kProperties);
 }
@@ -0,0 +1,99 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "frc/DMASnapshot.h"
+
+#include <cstring>
+
+#include "frc/Counter.h"
+#include "frc/Encoder.h"
+#include "frc/Errors.h"
+
+using namespace frc;
+
+// deep enough that captures queued between Update() calls are not dropped
+// even with a fast trigger period and a slow loop
+static constexpr int kQueueDepth = 64;
+
+DMASnapshot::DMASnapshot(units::second_t period) : m_period{period} {
+  std::memset(static_cast<HAL_DMASample*>(&m_sample), 0, sizeof(HAL_DMASample));
+}
+
+void DMASnapshot::AddEncoder(const Encoder* encoder) {
+  m_dma.AddEncoder(encoder);
+}
+
+void DMASnapshot::AddEncoderPeriod(const Encoder* encoder) {
+  m_dma.AddEncoderPeriod(encoder);
+}
+
+void DMASnapshot::AddCounter(const Counter* counter) {
+  m_dma.AddCounter(counter);
+}
+
+void DMASnapshot::AddCounterPeriod(const Counter* counter) {
+  m_dma.AddCounterPeriod(counter);
+}
+
+void DMASnapshot::Start() {
+  m_dma.SetTimedTrigger(m_period);
+  m_dma.Start(kQueueDepth);
+}
+
+void DMASnapshot::Stop() {
+  m_dma.Stop();
+}
+
+bool DMASnapshot::Update() {
+  bool updated = false;
+  DMASample sample;
+  int32_t remaining = 0;
+  do {
+    int32_t status = 0;
+    auto readStatus =
+        sample.Update(&m_dma, units::second_t{0}, &remaining, &status);
+    FRC_CheckErrorStatus(status, "Update");
+    if (readStatus != DMASample::DMAReadStatus::kOk) {
+      break;
+    }
+    m_sample = sample;
+    updated = true;
+  } while (remaining > 0);
+  return updated;
+}
+
+int32_t DMASnapshot::GetEncoderRaw(const Encoder* encoder) const {
+  int32_t status = 0;
+  int32_t val = m_sample.GetEncoderRaw(encoder, &status);
+  FRC_CheckErrorStatus(status, "GetEncoderRaw");
+  return val;
+}
+
+double DMASnapshot::GetEncoderDistance(const Encoder* encoder) const {
+  int32_t status = 0;
+  double val = m_sample.GetEncoderDistance(encoder, &status);
+  FRC_CheckErrorStatus(status, "GetEncoderDistance");
+  return val;
+}
+
+int32_t DMASnapshot::GetEncoderPeriodRaw(const Encoder* encoder) const {
+  int32_t status = 0;
+  int32_t val = m_sample.GetEncoderPeriodRaw(encoder, &status);
+  FRC_CheckErrorStatus(status, "GetEncoderPeriodRaw");
+  return val;
+}
+
+int32_t DMASnapshot::GetCounter(const Counter* counter) const {
+  int32_t status = 0;
+  int32_t val = m_sample.GetCounter(counter, &status);
+  FRC_CheckErrorStatus(status, "GetCounter");
+  return val;
+}
+
+int32_t DMASnapshot::GetCounterPeriod(const Counter* counter) const {
+  int32_t status = 0;
+  int32_t val = m_sample.GetCounterPeriod(counter, &status);
+  FRC_CheckErrorStatus(status, "GetCounterPeriod");
+  return val;
+}
@@ -91,6 +91,7 @@ Thread::Thread(std::string_view dir, std::string_view filename, double period)
       m_filenameOverride{!filename.empty()},
       m_log{dir, MakeLogFilename(filename), period},
       m_messageLog{m_log, "messages"} {
+  SetTelemetryName("DataLogManager");
   StartNTLog();
 }
 
@@ -154,6 +155,7 @@ void Thread::Main() {
     bool timedOut = false;
     bool newData =
         wpi::WaitForObject(newDataEvent.GetHandle(), 0.25, &timedOut);
+    RecordWake();
     if (!m_active) {
       break;
     }
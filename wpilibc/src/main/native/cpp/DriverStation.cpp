@@ -122,6 +122,26 @@ struct Instance {
   MatchDataSender matchDataSender;
   std::atomic<DataLogSender*> dataLogSender{nullptr};
 
+  // Per-packet snapshot of the control word and joystick data, rebuilt once
+  // per RefreshData() call.  Double-buffered: RefreshData() fills the buffer
+  // not currently published and then flips snapshotIndex with release, so
+  // the hot getters are wait-free loads with no HAL calls or locks.  A
+  // reader would have to stall across two full DS packets (40 ms) in the
+  // middle of a few-byte copy to observe a torn snapshot.
+  struct DSSnapshot {
+    HAL_ControlWord controlWord = {};
+    std::array<HAL_JoystickAxes, DriverStation::kJoystickPorts> axes = {};
+    std::array<HAL_JoystickPOVs, DriverStation::kJoystickPorts> povs = {};
+    std::array<HAL_JoystickButtons, DriverStation::kJoystickPorts> buttons =
+        {};
+  };
+  std::array<DSSnapshot, 2> snapshots;
+  std::atomic<int> snapshotIndex{0};
+
+  const DSSnapshot& Snapshot() {
+    return snapshots[snapshotIndex.load(std::memory_order_acquire)];
+  }
+
   // Joystick button rising/falling edge flags
   wpi::mutex buttonEdgeMutex;
   std::array<HAL_JoystickButtons, DriverStation::kJoystickPorts>
@@ -208,8 +228,7 @@ bool DriverStation::GetStickButton(int stick, int button) {
     return false;
   }
 
-  HAL_JoystickButtons buttons;
-  HAL_GetJoystickButtons(stick, &buttons);
+  const auto& buttons = ::GetInstance().Snapshot().buttons[stick];
 
   if (button > buttons.count) {
     ReportJoystickUnpluggedWarning(
@@ -233,8 +252,8 @@ bool DriverStation::GetStickButtonPressed(int stick, int button) {
     return false;
   }
 
-  HAL_JoystickButtons buttons;
-  HAL_GetJoystickButtons(stick, &buttons);
+  auto& inst = ::GetInstance();
+  const auto& buttons = inst.Snapshot().buttons[stick];
 
   if (button > buttons.count) {
     ReportJoystickUnpluggedWarning(
@@ -243,7 +262,6 @@ bool DriverStation::GetStickButtonPressed(int stick, int button) {
         button, buttons.count);
     return false;
   }
-  auto& inst = ::GetInstance();
   std::unique_lock lock(inst.buttonEdgeMutex);
   // If button was pressed, clear flag and return true
   if (inst.joystickButtonsPressed[stick] & 1 << (button - 1)) {
@@ -264,8 +282,8 @@ bool DriverStation::GetStickButtonReleased(int stick, int button) {
     return false;
   }
 
-  HAL_JoystickButtons buttons;
-  HAL_GetJoystickButtons(stick, &buttons);
+  auto& inst = ::GetInstance();
+  const auto& buttons = inst.Snapshot().buttons[stick];
 
   if (button > buttons.count) {
     ReportJoystickUnpluggedWarning(
@@ -274,7 +292,6 @@ bool DriverStation::GetStickButtonReleased(int stick, int button) {
         button, buttons.count);
     return false;
   }
-  auto& inst = ::GetInstance();
   std::unique_lock lock(inst.buttonEdgeMutex);
   // If button was released, clear flag and return true
   if (inst.joystickButtonsReleased[stick] & 1 << (button - 1)) {
@@ -294,8 +311,7 @@ double DriverStation::GetStickAxis(int stick, int axis) {
     return 0.0;
   }
 
-  HAL_JoystickAxes axes;
-  HAL_GetJoystickAxes(stick, &axes);
+  const auto& axes = ::GetInstance().Snapshot().axes[stick];
 
   if (axis >= axes.count) {
     ReportJoystickUnpluggedWarning(
@@ -318,8 +334,7 @@ int DriverStation::GetStickPOV(int stick, int pov) {
     return -1;
   }
 
-  HAL_JoystickPOVs povs;
-  HAL_GetJoystickPOVs(stick, &povs);
+  const auto& povs = ::GetInstance().Snapshot().povs[stick];
 
   if (pov >= povs.count) {
     ReportJoystickUnpluggedWarning(
@@ -338,10 +353,7 @@ int DriverStation::GetStickButtons(int stick) {
     return 0;
   }
 
-  HAL_JoystickButtons buttons;
-  HAL_GetJoystickButtons(stick, &buttons);
-
-  return buttons.buttons;
+  return ::GetInstance().Snapshot().buttons[stick].buttons;
 }
 
 int DriverStation::GetStickAxisCount(int stick) {
@@ -350,10 +362,7 @@ int DriverStation::GetStickAxisCount(int stick) {
     return 0;
   }
 
-  HAL_JoystickAxes axes;
-  HAL_GetJoystickAxes(stick, &axes);
-
-  return axes.count;
+  return ::GetInstance().Snapshot().axes[stick].count;
 }
 
 int DriverStation::GetStickPOVCount(int stick) {
@@ -362,10 +371,7 @@ int DriverStation::GetStickPOVCount(int stick) {
     return 0;
   }
 
-  HAL_JoystickPOVs povs;
-  HAL_GetJoystickPOVs(stick, &povs);
-
-  return povs.count;
+  return ::GetInstance().Snapshot().povs[stick].count;
 }
 
 int DriverStation::GetStickButtonCount(int stick) {
@@ -374,10 +380,7 @@ int DriverStation::GetStickButtonCount(int stick) {
     return 0;
   }
 
-  HAL_JoystickButtons buttons;
-  HAL_GetJoystickButtons(stick, &buttons);
-
-  return buttons.count;
+  return ::GetInstance().Snapshot().buttons[stick].count;
 }
 
 bool DriverStation::GetJoystickIsXbox(int stick) {
@@ -437,62 +440,52 @@ bool DriverStation::IsJoystickConnected(int stick) {
 }
 
 bool DriverStation::IsEnabled() {
-  HAL_ControlWord controlWord;
-  HAL_GetControlWord(&controlWord);
+  HAL_ControlWord controlWord = ::GetInstance().Snapshot().controlWord;
   return controlWord.enabled && controlWord.dsAttached;
 }
 
 bool DriverStation::IsDisabled() {
-  HAL_ControlWord controlWord;
-  HAL_GetControlWord(&controlWord);
+  HAL_ControlWord controlWord = ::GetInstance().Snapshot().controlWord;
   return !(controlWord.enabled && controlWord.dsAttached);
 }
 
 bool DriverStation::IsEStopped() {
-  HAL_ControlWord controlWord;
-  HAL_GetControlWord(&controlWord);
+  HAL_ControlWord controlWord = ::GetInstance().Snapshot().controlWord;
   return controlWord.eStop;
 }
 
 bool DriverStation::IsAutonomous() {
-  HAL_ControlWord controlWord;
-  HAL_GetControlWord(&controlWord);
+  HAL_ControlWord controlWord = ::GetInstance().Snapshot().controlWord;
   return controlWord.autonomous;
 }
 
 bool DriverStation::IsAutonomousEnabled() {
-  HAL_ControlWord controlWord;
-  HAL_GetControlWord(&controlWord);
+  HAL_ControlWord controlWord = ::GetInstance().Snapshot().controlWord;
   return controlWord.autonomous && controlWord.enabled;
 }
 
 bool DriverStation::IsTeleop() {
-  HAL_ControlWord controlWord;
-  HAL_GetControlWord(&controlWord);
+  HAL_ControlWord controlWord = ::GetInstance().Snapshot().controlWord;
   return !(controlWord.autonomous || controlWord.test);
 }
 
 bool DriverStation::IsTeleopEnabled() {
-  HAL_ControlWord controlWord;
-  HAL_GetControlWord(&controlWord);
+  HAL_ControlWord controlWord = ::GetInstance().Snapshot().controlWord;
   return !controlWord.autonomous && !controlWord.test && controlWord.enabled;
 }
 
 bool DriverStation::IsTest() {
-  HAL_ControlWord controlWord;
-  HAL_GetControlWord(&controlWord);
+  HAL_ControlWord controlWord = ::GetInstance().Snapshot().controlWord;
   return controlWord.test;
 }
 
 bool DriverStation::IsDSAttached() {
-  HAL_ControlWord controlWord;
-  HAL_GetControlWord(&controlWord);
+  HAL_ControlWord controlWord = ::GetInstance().Snapshot().controlWord;
   return controlWord.dsAttached;
 }
 
 bool DriverStation::IsFMSAttached() {
-  HAL_ControlWord controlWord;
-  HAL_GetControlWord(&controlWord);
+  HAL_ControlWord controlWord = ::GetInstance().Snapshot().controlWord;
   return controlWord.fmsAttached;
 }
 
@@ -585,12 +578,20 @@ void DriverStation::RefreshData() {
   HAL_RefreshDSData();
   auto& inst = ::GetInstance();
   {
-    // Compute the pressed and released buttons
-    HAL_JoystickButtons currentButtons;
+    // Decode the packet once into the snapshot not currently visible to
+    // readers, then publish it.  buttonEdgeMutex doubles as the writer lock,
+    // so concurrent RefreshData() calls can't fill the same buffer.
     std::unique_lock lock(inst.buttonEdgeMutex);
+    int back = 1 - inst.snapshotIndex.load(std::memory_order_relaxed);
+    auto& snap = inst.snapshots[back];
+    HAL_GetControlWord(&snap.controlWord);
+    HAL_GetAllJoystickData(snap.axes.data(), snap.povs.data(),
+                           snap.buttons.data());
+    inst.snapshotIndex.store(back, std::memory_order_release);
 
+    // Compute the pressed and released buttons
     for (int32_t i = 0; i < DriverStation::kJoystickPorts; i++) {
-      HAL_GetJoystickButtons(i, &currentButtons);
+      HAL_JoystickButtons currentButtons = snap.buttons[i];
 
       // If buttons weren't pressed and are now, set flags in m_buttonsPressed
       inst.joystickButtonsPressed[i] |=
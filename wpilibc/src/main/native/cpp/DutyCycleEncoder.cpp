@@ -12,6 +12,7 @@
 #include "frc/DigitalSource.h"
 #include "frc/DutyCycle.h"
 #include "frc/Errors.h"
+#include "frc/Notifier.h"
 
 using namespace frc;
 
@@ -88,6 +89,14 @@ units::turn_t DutyCycleEncoder::Get() const {
     return units::turn_t{m_simPosition.Get()};
   }
 
+  if (m_refreshActive.load(std::memory_order_acquire)) {
+    return units::turn_t{m_cachedPosition.load(std::memory_order_acquire)};
+  }
+
+  return ReadPosition();
+}
+
+units::turn_t DutyCycleEncoder::ReadPosition() const {
   // As the values are not atomic, keep trying until we get 2 reads of the same
   // value If we don't within 10 attempts, error
   for (int i = 0; i < 10; i++) {
@@ -111,6 +120,29 @@ units::turn_t DutyCycleEncoder::Get() const {
   return m_lastPosition;
 }
 
+void DutyCycleEncoder::StartPeriodicRefresh(units::second_t period) {
+  if (m_simPosition) {
+    return;  // sim reads are already a single variable load
+  }
+  if (!m_refreshNotifier) {
+    m_refreshNotifier = std::make_unique<Notifier>(Notifier::Pooled([this] {
+      m_cachedPosition.store(ReadPosition().value(), std::memory_order_release);
+    }));
+    m_refreshNotifier->SetName("DutyCycleEncoderRefresh");
+  }
+  // Prime the cache so the first Get() after enabling isn't stale.
+  m_cachedPosition.store(ReadPosition().value(), std::memory_order_release);
+  m_refreshActive.store(true, std::memory_order_release);
+  m_refreshNotifier->StartPeriodic(period);
+}
+
+void DutyCycleEncoder::StopPeriodicRefresh() {
+  m_refreshActive.store(false, std::memory_order_release);
+  if (m_refreshNotifier) {
+    m_refreshNotifier->Stop();
+  }
+}
+
 double DutyCycleEncoder::MapSensorRange(double pos) const {
   if (pos < m_sensorMin) {
     pos = m_sensorMin;
@@ -189,6 +221,52 @@ int DutyCycleEncoder::GetSourceChannel() const {
   return m_dutyCycle->GetSourceChannel();
 }
 
+DutyCycleEncoder::~DutyCycleEncoder() = default;
+
+DutyCycleEncoder::DutyCycleEncoder(DutyCycleEncoder&& rhs)
+    : wpi::SendableHelper<DutyCycleEncoder>{std::move(rhs)} {
+  // The refresh notifier's handler captures the object it was started on, so
+  // it can't follow a move; stop it and let the new object restart it.
+  rhs.StopPeriodicRefresh();
+  m_dutyCycle = std::move(rhs.m_dutyCycle);
+  m_analogTrigger = std::move(rhs.m_analogTrigger);
+  m_counter = std::move(rhs.m_counter);
+  m_frequencyThreshold = rhs.m_frequencyThreshold;
+  m_positionOffset = rhs.m_positionOffset;
+  m_distancePerRotation = rhs.m_distancePerRotation;
+  m_lastPosition = rhs.m_lastPosition;
+  m_sensorMin = rhs.m_sensorMin;
+  m_sensorMax = rhs.m_sensorMax;
+  m_cachedPosition.store(rhs.m_cachedPosition.load());
+  m_simDevice = std::move(rhs.m_simDevice);
+  m_simPosition = std::move(rhs.m_simPosition);
+  m_simAbsolutePosition = std::move(rhs.m_simAbsolutePosition);
+  m_simDistancePerRotation = std::move(rhs.m_simDistancePerRotation);
+  m_simIsConnected = std::move(rhs.m_simIsConnected);
+}
+
+DutyCycleEncoder& DutyCycleEncoder::operator=(DutyCycleEncoder&& rhs) {
+  StopPeriodicRefresh();
+  rhs.StopPeriodicRefresh();
+  wpi::SendableHelper<DutyCycleEncoder>::operator=(std::move(rhs));
+  m_dutyCycle = std::move(rhs.m_dutyCycle);
+  m_analogTrigger = std::move(rhs.m_analogTrigger);
+  m_counter = std::move(rhs.m_counter);
+  m_frequencyThreshold = rhs.m_frequencyThreshold;
+  m_positionOffset = rhs.m_positionOffset;
+  m_distancePerRotation = rhs.m_distancePerRotation;
+  m_lastPosition = rhs.m_lastPosition;
+  m_sensorMin = rhs.m_sensorMin;
+  m_sensorMax = rhs.m_sensorMax;
+  m_cachedPosition.store(rhs.m_cachedPosition.load());
+  m_simDevice = std::move(rhs.m_simDevice);
+  m_simPosition = std::move(rhs.m_simPosition);
+  m_simAbsolutePosition = std::move(rhs.m_simAbsolutePosition);
+  m_simDistancePerRotation = std::move(rhs.m_simDistancePerRotation);
+  m_simIsConnected = std::move(rhs.m_simIsConnected);
+  return *this;
+}
+
 void DutyCycleEncoder::InitSendable(wpi::SendableBuilder& builder) {
   builder.SetSmartDashboardType("AbsoluteEncoder");
   builder.AddDoubleProperty(
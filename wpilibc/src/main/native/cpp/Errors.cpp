@@ -5,14 +5,74 @@
 #include "frc/Errors.h"
 
 #include <exception>
+#include <utility>
+#include <vector>
 
 #include <hal/DriverStation.h>
 #include <hal/HALBase.h>
+#include <wpi/SafeThread.h>
 #include <wpi/StackTrace.h>
 #include <wpi/fs.h>
 
 using namespace frc;
 
+namespace {
+
+// Symbolicating a stack trace is far too slow for the robot loop (a warning
+// storm can cause a loop overrun), so ReportErrorV captures raw frame
+// addresses and hands the report to this thread, which symbolicates and
+// sends it to the driver station.
+struct ReportThread final : public wpi::SafeThread {
+  ReportThread() { SetTelemetryName("ErrorReporter"); }
+
+  void Main() final;
+
+  struct Report {
+    bool isError;
+    int32_t code;
+    std::string details;
+    std::string location;
+    std::vector<void*> stack;
+  };
+  std::vector<Report> m_reports;
+
+  void Send(const Report& report) {
+    HAL_SendError(report.isError, report.code, 0, report.details.c_str(),
+                  report.location.c_str(),
+                  wpi::SymbolizeStackTrace(report.stack).c_str(), 1);
+  }
+};
+
+void ReportThread::Main() {
+  std::unique_lock lock{m_mutex};
+  while (m_active) {
+    m_cond.wait(lock, [&] { return !m_active || !m_reports.empty(); });
+    RecordWake(m_reports.size());
+    std::vector<Report> reports;
+    reports.swap(m_reports);
+    lock.unlock();
+    for (auto&& report : reports) {
+      Send(report);
+    }
+    lock.lock();
+  }
+  // drain anything still queued at shutdown
+  for (auto&& report : m_reports) {
+    Send(report);
+  }
+}
+
+wpi::SafeThreadOwner<ReportThread>& GetReportThread() {
+  static wpi::SafeThreadOwner<ReportThread> owner = [] {
+    wpi::SafeThreadOwner<ReportThread> o;
+    o.Start();
+    return o;
+  }();
+  return owner;
+}
+
+}  // namespace
+
 RuntimeError::RuntimeError(int32_t code, std::string&& loc, std::string&& stack,
                            std::string&& message)
     : runtime_error{std::move(message)}, m_data{std::make_shared<Data>()} {
@@ -61,9 +121,17 @@ void frc::ReportErrorV(int32_t status, const char* fileName, int lineNumber,
   fmt::memory_buffer out;
   fmt::format_to(fmt::appender{out}, "{}: ", GetErrorMessage(&status));
   fmt::vformat_to(fmt::appender{out}, format, args);
-  out.push_back('\0');
-  HAL_SendError(status < 0, status, 0, out.data(), funcName,
-                wpi::GetStackTrace(2).c_str(), 1);
+  auto stack = wpi::CaptureStackTrace(2);
+  if (auto thr = GetReportThread().GetThread()) {
+    thr->m_reports.emplace_back(ReportThread::Report{
+        status < 0, status, fmt::to_string(out), funcName, std::move(stack)});
+    thr->m_cond.notify_one();
+  } else {
+    // report thread shut down; fall back to reporting inline
+    out.push_back('\0');
+    HAL_SendError(status < 0, status, 0, out.data(), funcName,
+                  wpi::SymbolizeStackTrace(stack).c_str(), 1);
+  }
 }
 
 RuntimeError frc::MakeErrorV(int32_t status, const char* fileName,
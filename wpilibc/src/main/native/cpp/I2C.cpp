@@ -4,15 +4,81 @@
 
 #include "frc/I2C.h"
 
+#include <algorithm>
 #include <utility>
+#include <vector>
 
 #include <hal/FRCUsageReporting.h>
 #include <hal/I2C.h>
+#include <wpi/SafeThread.h>
+#include <wpi/SmallVector.h>
+#include <wpi/mutex.h>
 
 #include "frc/Errors.h"
 
 using namespace frc;
 
+namespace {
+// Shared bus thread for asynchronous transactions; completion callbacks run
+// here so the control loop never blocks for a bus round trip.
+struct BusThread final : public wpi::SafeThread {
+  BusThread() { SetTelemetryName("I2CBus"); }
+
+  void Main() final;
+
+  struct Request {
+    HAL_I2CPort port;
+    int deviceAddress;
+    wpi::SmallVector<uint8_t, 8> dataToSend;
+    int receiveSize;
+    std::function<void(bool, std::span<const uint8_t>)> onComplete;
+  };
+  std::vector<Request> m_requests;
+};
+
+void BusThread::Main() {
+  std::unique_lock lock{m_mutex};
+  while (m_active) {
+    m_cond.wait(lock, [&] { return !m_active || !m_requests.empty(); });
+    RecordWake(m_requests.size());
+    std::vector<Request> requests;
+    requests.swap(m_requests);
+    lock.unlock();
+    for (auto&& req : requests) {
+      wpi::SmallVector<uint8_t, 32> received;
+      received.resize(req.receiveSize);
+      int32_t status = HAL_TransactionI2C(
+          req.port, req.deviceAddress, req.dataToSend.data(),
+          req.dataToSend.size(), received.data(), req.receiveSize);
+      if (req.onComplete) {
+        req.onComplete(status < 0,
+                       std::span<const uint8_t>{received.data(),
+                                                received.size()});
+      }
+    }
+    lock.lock();
+  }
+}
+
+wpi::SafeThreadOwner<BusThread>& GetBusThread() {
+  static wpi::SafeThreadOwner<BusThread> owner = [] {
+    wpi::SafeThreadOwner<BusThread> o;
+    o.Start();
+    return o;
+  }();
+  return owner;
+}
+}  // namespace
+
+// Double buffer for ready-polled asynchronous reads: the bus thread fills a
+// back buffer and swaps it in under the mutex, so the reader's copy never
+// overlaps a fill and neither side waits on bus I/O.
+struct I2C::AsyncReadState {
+  wpi::mutex mutex;
+  std::vector<uint8_t> data;
+  bool valid = false;
+};
+
 I2C::I2C(Port port, int deviceAddress)
     : m_port(static_cast<HAL_I2CPort>(port)), m_deviceAddress(deviceAddress) {
   int32_t status = 0;
@@ -50,6 +116,61 @@ bool I2C::Transaction(uint8_t* dataToSend, int sendSize, uint8_t* dataReceived,
   return status < 0;
 }
 
+void I2C::TransactionAsync(
+    std::span<const uint8_t> dataToSend, int receiveSize,
+    std::function<void(bool aborted, std::span<const uint8_t> dataReceived)>
+        onComplete) {
+  if (receiveSize < 0) {
+    throw FRC_MakeError(err::ParameterOutOfRange, "receiveSize {}",
+                        receiveSize);
+  }
+  if (auto thr = GetBusThread().GetThread()) {
+    thr->m_requests.emplace_back(BusThread::Request{
+        m_port,
+        m_deviceAddress,
+        {dataToSend.begin(), dataToSend.end()},
+        receiveSize,
+        std::move(onComplete)});
+    thr->m_cond.notify_one();
+  }
+}
+
+void I2C::RequestReadAsync(int registerAddress, int count) {
+  if (count < 1) {
+    throw FRC_MakeError(err::ParameterOutOfRange, "count {}", count);
+  }
+  if (!m_asyncRead) {
+    m_asyncRead = std::make_shared<AsyncReadState>();
+  }
+  auto state = m_asyncRead;
+  uint8_t regAddr = registerAddress;
+  TransactionAsync(
+      {&regAddr, 1}, count,
+      [state](bool aborted, std::span<const uint8_t> dataReceived) {
+        if (aborted) {
+          return;
+        }
+        std::vector<uint8_t> data{dataReceived.begin(), dataReceived.end()};
+        std::scoped_lock lock(state->mutex);
+        state->data.swap(data);
+        state->valid = true;
+      });
+}
+
+bool I2C::GetAsyncReadResult(std::span<uint8_t> buffer) {
+  if (!m_asyncRead) {
+    return false;
+  }
+  std::scoped_lock lock(m_asyncRead->mutex);
+  if (!m_asyncRead->valid) {
+    return false;
+  }
+  std::copy_n(m_asyncRead->data.begin(),
+              (std::min)(buffer.size(), m_asyncRead->data.size()),
+              buffer.begin());
+  return true;
+}
+
 bool I2C::AddressOnly() {
   return Transaction(nullptr, 0, nullptr, 0);
 }
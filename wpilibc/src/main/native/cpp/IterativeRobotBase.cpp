@@ -4,11 +4,17 @@
 
 #include "frc/IterativeRobotBase.h"
 
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <utility>
+
 #include <frc/DriverStation.h>
 
 #include <fmt/format.h>
 #include <hal/DriverStation.h>
 #include <networktables/NetworkTableInstance.h>
+#include <wpi/timestamp.h>
 
 #include "frc/DSControlWord.h"
 #include "frc/Errors.h"
@@ -98,6 +104,60 @@ units::second_t IterativeRobotBase::GetPeriod() const {
   return m_period;
 }
 
+static constexpr std::array<std::string_view, 5> kPhaseNames = {
+    "ModePeriodic", "RobotPeriodic", "SmartDashboard", "LiveWindow",
+    "Shuffleboard"};
+
+std::vector<IterativeRobotBase::PhaseTiming>
+IterativeRobotBase::GetPhaseTimings() const {
+  std::vector<PhaseTiming> timings;
+  timings.reserve(kNumPhases);
+  for (size_t i = 0; i < kNumPhases; ++i) {
+    const auto& stats = m_phaseStats[i];
+    PhaseTiming timing;
+    timing.phase = kPhaseNames[i];
+    timing.count = stats.count;
+    timing.min = units::second_t{stats.minUs * 1e-6};
+    timing.max = units::second_t{stats.maxUs * 1e-6};
+    timing.total = units::second_t{stats.totalUs * 1e-6};
+    timing.histogram = stats.buckets;
+    timings.emplace_back(std::move(timing));
+  }
+  return timings;
+}
+
+void IterativeRobotBase::StartPhaseDataLog(wpi::log::DataLog& log,
+                                           std::string_view name) {
+  wpi::log::StructSchemaBuilder schema;
+  schema
+      .AddField("modePeriodicUs", "uint32",
+                offsetof(LoopPhaseDurations, modePeriodicUs))
+      .AddField("robotPeriodicUs", "uint32",
+                offsetof(LoopPhaseDurations, robotPeriodicUs))
+      .AddField("smartDashboardUs", "uint32",
+                offsetof(LoopPhaseDurations, smartDashboardUs))
+      .AddField("liveWindowUs", "uint32",
+                offsetof(LoopPhaseDurations, liveWindowUs))
+      .AddField("shuffleboardUs", "uint32",
+                offsetof(LoopPhaseDurations, shuffleboardUs));
+  m_phaseLogEntry.emplace(log, name, "struct:LoopPhaseDurations",
+                          schema.Build());
+}
+
+void IterativeRobotBase::RecordPhase(Phase phase, uint64_t durationUs) {
+  auto& stats = m_phaseStats[static_cast<size_t>(phase)];
+  if (stats.count == 0 || durationUs < stats.minUs) {
+    stats.minUs = durationUs;
+  }
+  if (durationUs > stats.maxUs) {
+    stats.maxUs = durationUs;
+  }
+  stats.totalUs += durationUs;
+  ++stats.count;
+  size_t bucket = durationUs == 0 ? 0 : std::bit_width(durationUs) - 1;
+  ++stats.buckets[(std::min)(bucket, kNumPhaseBuckets - 1)];
+}
+
 void IterativeRobotBase::LoopFunc() {
   DriverStation::RefreshData();
   m_watchdog.Reset();
@@ -151,6 +211,7 @@ void IterativeRobotBase::LoopFunc() {
   }
 
   // Call the appropriate function depending upon the current robot mode
+  uint64_t phaseStart = wpi::Now();
   if (mode == Mode::kDisabled) {
     HAL_ObserveUserProgramDisabled();
     DisabledPeriodic();
@@ -168,16 +229,35 @@ void IterativeRobotBase::LoopFunc() {
     TestPeriodic();
     m_watchdog.AddEpoch("TestPeriodic()");
   }
+  uint64_t modePeriodicEnd = wpi::Now();
+  RecordPhase(Phase::kModePeriodic, modePeriodicEnd - phaseStart);
 
   RobotPeriodic();
   m_watchdog.AddEpoch("RobotPeriodic()");
+  uint64_t robotPeriodicEnd = wpi::Now();
+  RecordPhase(Phase::kRobotPeriodic, robotPeriodicEnd - modePeriodicEnd);
 
   SmartDashboard::UpdateValues();
   m_watchdog.AddEpoch("SmartDashboard::UpdateValues()");
+  uint64_t smartDashboardEnd = wpi::Now();
+  RecordPhase(Phase::kSmartDashboard, smartDashboardEnd - robotPeriodicEnd);
   LiveWindow::UpdateValues();
   m_watchdog.AddEpoch("LiveWindow::UpdateValues()");
+  uint64_t liveWindowEnd = wpi::Now();
+  RecordPhase(Phase::kLiveWindow, liveWindowEnd - smartDashboardEnd);
   Shuffleboard::Update();
   m_watchdog.AddEpoch("Shuffleboard::Update()");
+  uint64_t shuffleboardEnd = wpi::Now();
+  RecordPhase(Phase::kShuffleboard, shuffleboardEnd - liveWindowEnd);
+
+  if (m_phaseLogEntry) {
+    m_phaseLogEntry->Append(LoopPhaseDurations{
+        static_cast<uint32_t>(modePeriodicEnd - phaseStart),
+        static_cast<uint32_t>(robotPeriodicEnd - modePeriodicEnd),
+        static_cast<uint32_t>(smartDashboardEnd - robotPeriodicEnd),
+        static_cast<uint32_t>(liveWindowEnd - smartDashboardEnd),
+        static_cast<uint32_t>(shuffleboardEnd - liveWindowEnd)});
+  }
 
   if constexpr (IsSimulation()) {
     HAL_SimPeriodicBefore();
@@ -5,11 +5,13 @@
 #include "frc/MotorSafety.h"
 
 #include <algorithm>
+#include <memory>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include <hal/DriverStation.h>
 #include <wpi/SafeThread.h>
-#include <wpi/SmallPtrSet.h>
 
 #include "frc/DriverStation.h"
 #include "frc/Errors.h"
@@ -58,7 +60,16 @@ struct MotorSafetyManager {
   ~MotorSafetyManager() { gShutdown = true; }
 
   wpi::SafeThreadOwner<Thread> thread;
-  wpi::SmallPtrSet<MotorSafety*, 32> instanceList;
+  // Published-snapshot registration list: writers (construction/destruction)
+  // copy and republish under listMutex; CheckMotors() just loads the current
+  // snapshot, so checking never takes a lock the control path can contend on.
+  // Accessed via the std::atomic_load/atomic_store free functions; libc++
+  // doesn't provide std::atomic<std::shared_ptr>.
+  std::shared_ptr<const std::vector<MotorSafety*>> instances;
+  // Scan generation counter; odd while CheckMotors() is iterating a
+  // snapshot.  Lets destruction wait out a scan that may still reference the
+  // object being destroyed.
+  std::atomic<uint64_t> scanGen{0};
   wpi::mutex listMutex;
   bool threadStarted = false;
 };
@@ -74,7 +85,11 @@ namespace frc::impl {
 void ResetMotorSafety() {
   auto& manager = GetManager();
   std::scoped_lock lock(manager.listMutex);
-  manager.instanceList.clear();
+  std::atomic_store_explicit(
+      &manager.instances,
+      std::shared_ptr<const std::vector<MotorSafety*>>{
+          std::make_shared<std::vector<MotorSafety*>>()},
+      std::memory_order_release);
   manager.thread.Stop();
   manager.thread.Join();
   manager.thread = wpi::SafeThreadOwner<Thread>{};
@@ -86,7 +101,16 @@ void ResetMotorSafety() {
 MotorSafety::MotorSafety() {
   auto& manager = GetManager();
   std::scoped_lock lock(manager.listMutex);
-  manager.instanceList.insert(this);
+  auto updated = std::make_shared<std::vector<MotorSafety*>>();
+  if (auto current = std::atomic_load_explicit(&manager.instances,
+                                               std::memory_order_acquire)) {
+    *updated = *current;
+  }
+  updated->push_back(this);
+  std::atomic_store_explicit(
+      &manager.instances,
+      std::shared_ptr<const std::vector<MotorSafety*>>{std::move(updated)},
+      std::memory_order_release);
   if (!manager.threadStarted) {
     manager.threadStarted = true;
     manager.thread.Start();
@@ -95,64 +119,79 @@ MotorSafety::MotorSafety() {
 
 MotorSafety::~MotorSafety() {
   auto& manager = GetManager();
-  std::scoped_lock lock(manager.listMutex);
-  manager.instanceList.erase(this);
+  {
+    std::scoped_lock lock(manager.listMutex);
+    auto updated = std::make_shared<std::vector<MotorSafety*>>();
+    if (auto current = std::atomic_load_explicit(&manager.instances,
+                                                 std::memory_order_acquire)) {
+      for (auto elem : *current) {
+        if (elem != this) {
+          updated->push_back(elem);
+        }
+      }
+    }
+    // seq_cst store→load pairs with CheckMotors()'s seq_cst increment→load:
+    // either the scan sees the list without this object, or this thread sees
+    // the odd generation below and waits the scan out; weaker orderings let
+    // both sides miss each other on ARM
+    std::atomic_store_explicit(
+        &manager.instances,
+        std::shared_ptr<const std::vector<MotorSafety*>>{std::move(updated)},
+        std::memory_order_seq_cst);
+  }
+  // if a check scan is in progress it may still be iterating a snapshot
+  // containing this object; wait for it to finish
+  uint64_t gen = manager.scanGen.load(std::memory_order_seq_cst);
+  while ((gen & 1) != 0 &&
+         manager.scanGen.load(std::memory_order_acquire) == gen) {
+    std::this_thread::yield();
+  }
 }
 
 MotorSafety::MotorSafety(MotorSafety&& rhs)
-    : m_expiration(std::move(rhs.m_expiration)),
-      m_enabled(std::move(rhs.m_enabled)),
-      m_stopTime(std::move(rhs.m_stopTime)) {}
+    : m_expiration(rhs.m_expiration.load()),
+      m_enabled(rhs.m_enabled.load()),
+      m_stopTime(rhs.m_stopTime.load()) {}
 
 MotorSafety& MotorSafety::operator=(MotorSafety&& rhs) {
-  std::scoped_lock lock(m_thisMutex, rhs.m_thisMutex);
-
-  m_expiration = std::move(rhs.m_expiration);
-  m_enabled = std::move(rhs.m_enabled);
-  m_stopTime = std::move(rhs.m_stopTime);
+  m_expiration = rhs.m_expiration.load();
+  m_enabled = rhs.m_enabled.load();
+  m_stopTime = rhs.m_stopTime.load();
 
   return *this;
 }
 
 void MotorSafety::Feed() {
-  std::scoped_lock lock(m_thisMutex);
-  m_stopTime = Timer::GetFPGATimestamp() + m_expiration;
+  m_stopTime.store(Timer::GetFPGATimestamp().value() +
+                       m_expiration.load(std::memory_order_relaxed),
+                   std::memory_order_relaxed);
 }
 
 void MotorSafety::SetExpiration(units::second_t expirationTime) {
-  std::scoped_lock lock(m_thisMutex);
-  m_expiration = expirationTime;
+  m_expiration.store(expirationTime.value(), std::memory_order_relaxed);
 }
 
 units::second_t MotorSafety::GetExpiration() const {
-  std::scoped_lock lock(m_thisMutex);
-  return m_expiration;
+  return units::second_t{m_expiration.load(std::memory_order_relaxed)};
 }
 
 bool MotorSafety::IsAlive() const {
-  std::scoped_lock lock(m_thisMutex);
-  return !m_enabled || m_stopTime > Timer::GetFPGATimestamp();
+  return !m_enabled.load(std::memory_order_relaxed) ||
+         m_stopTime.load(std::memory_order_relaxed) >
+             Timer::GetFPGATimestamp().value();
 }
 
 void MotorSafety::SetSafetyEnabled(bool enabled) {
-  std::scoped_lock lock(m_thisMutex);
-  m_enabled = enabled;
+  m_enabled.store(enabled, std::memory_order_relaxed);
 }
 
 bool MotorSafety::IsSafetyEnabled() const {
-  std::scoped_lock lock(m_thisMutex);
-  return m_enabled;
+  return m_enabled.load(std::memory_order_relaxed);
 }
 
 void MotorSafety::Check() {
-  bool enabled;
-  units::second_t stopTime;
-
-  {
-    std::scoped_lock lock(m_thisMutex);
-    enabled = m_enabled;
-    stopTime = m_stopTime;
-  }
+  bool enabled = m_enabled.load(std::memory_order_relaxed);
+  units::second_t stopTime{m_stopTime.load(std::memory_order_relaxed)};
 
   if (!enabled || DriverStation::IsDisabled() || DriverStation::IsTest()) {
     return;
@@ -175,8 +214,14 @@ void MotorSafety::Check() {
 
 void MotorSafety::CheckMotors() {
   auto& manager = GetManager();
-  std::scoped_lock lock(manager.listMutex);
-  for (auto elem : manager.instanceList) {
-    elem->Check();
+  // the seq_cst increment→load pairs with the destructor's seq_cst list
+  // store→generation load (see ~MotorSafety)
+  manager.scanGen.fetch_add(1, std::memory_order_seq_cst);  // now odd
+  if (auto instances = std::atomic_load_explicit(&manager.instances,
+                                                 std::memory_order_seq_cst)) {
+    for (auto elem : *instances) {
+      elem->Check();
+    }
   }
+  manager.scanGen.fetch_add(1, std::memory_order_release);  // even again
 }
@@ -4,18 +4,305 @@
 
 #include "frc/Notifier.h"
 
+#include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 #include <hal/FRCUsageReporting.h>
+#include <hal/HALBase.h>
 #include <hal/Notifier.h>
 #include <hal/Threads.h>
+#include <wpi/condition_variable.h>
 
 #include "frc/Errors.h"
 #include "frc/Timer.h"
 
 using namespace frc;
 
+namespace frc {
+
+/**
+ * Shared scheduler for pooled Notifiers.  One dispatcher thread waits on a
+ * single HAL notifier alarm armed for the earliest pending expiration and
+ * hands expired handlers to a small worker pool, so N pooled Notifiers cost
+ * 1 + kNumWorkers threads instead of N.  Workers inherit the highest priority
+ * requested by any pooled Notifier.
+ */
+class NotifierPool {
+ public:
+  static NotifierPool& GetInstance();
+
+  void Add(Notifier* notifier, int priority);
+  void Remove(Notifier* notifier);
+  void Replace(Notifier* oldNotifier, Notifier* newNotifier);
+  void SetName(Notifier* notifier, std::string_view name);
+  void Schedule(Notifier* notifier, uint64_t expirationUs, uint64_t periodUs,
+                bool periodic);
+  void Cancel(Notifier* notifier);
+
+ private:
+  static constexpr int kNumWorkers = 2;
+
+  struct Entry {
+    Notifier* notifier;
+    std::string name = "Notifier";
+    uint64_t expirationUs = UINT64_MAX;
+    uint64_t periodUs = 0;
+    bool periodic = false;
+    bool queued = false;   // on the ready queue or running
+    bool running = false;  // a worker is inside the handler
+    uint64_t lastOverrunReportUs = 0;
+  };
+
+  NotifierPool();
+  ~NotifierPool();
+
+  Entry* Find(Notifier* notifier);
+  void UpdateAlarmLocked();
+  void DispatcherMain();
+  void WorkerMain();
+
+  wpi::mutex m_mutex;
+  std::vector<std::unique_ptr<Entry>> m_entries;
+  std::vector<Entry*> m_ready;
+  wpi::condition_variable m_workerCond;
+  wpi::condition_variable m_idleCond;
+  int m_maxPriority = 0;
+  bool m_active = true;
+
+  std::atomic<HAL_NotifierHandle> m_alarm{0};
+  std::thread m_dispatcher;
+  std::vector<std::thread> m_workers;
+};
+
+}  // namespace frc
+
+NotifierPool& NotifierPool::GetInstance() {
+  static NotifierPool instance;
+  return instance;
+}
+
+NotifierPool::NotifierPool() {
+  int32_t status = 0;
+  m_alarm = HAL_InitializeNotifier(&status);
+  FRC_CheckErrorStatus(status, "InitializeNotifier");
+  status = 0;
+  HAL_SetNotifierName(m_alarm, "NotifierPool", &status);
+
+  m_dispatcher = std::thread([this] { DispatcherMain(); });
+  for (int i = 0; i < kNumWorkers; i++) {
+    m_workers.emplace_back([this] { WorkerMain(); });
+  }
+}
+
+NotifierPool::~NotifierPool() {
+  int32_t status = 0;
+  HAL_NotifierHandle alarm = m_alarm.exchange(0);
+  HAL_StopNotifier(alarm, &status);
+  {
+    std::scoped_lock lock(m_mutex);
+    m_active = false;
+  }
+  m_workerCond.notify_all();
+  if (m_dispatcher.joinable()) {
+    m_dispatcher.join();
+  }
+  for (auto& worker : m_workers) {
+    if (worker.joinable()) {
+      worker.join();
+    }
+  }
+  HAL_CleanNotifier(alarm, &status);
+}
+
+NotifierPool::Entry* NotifierPool::Find(Notifier* notifier) {
+  for (auto& entry : m_entries) {
+    if (entry->notifier == notifier) {
+      return entry.get();
+    }
+  }
+  return nullptr;
+}
+
+void NotifierPool::Add(Notifier* notifier, int priority) {
+  std::scoped_lock lock(m_mutex);
+  auto entry = std::make_unique<Entry>();
+  entry->notifier = notifier;
+  m_entries.emplace_back(std::move(entry));
+  if (priority > m_maxPriority) {
+    m_maxPriority = priority;
+    // wake the workers so they pick up the new priority
+    m_workerCond.notify_all();
+  }
+}
+
+void NotifierPool::Remove(Notifier* notifier) {
+  std::unique_lock lock(m_mutex);
+  auto entry = Find(notifier);
+  if (!entry) {
+    return;
+  }
+  // wait for any in-progress handler call to finish so the handler can't
+  // outlive the Notifier it belongs to
+  m_idleCond.wait(lock, [&] { return !entry->running; });
+  std::erase_if(m_ready, [&](Entry* e) { return e == entry; });
+  std::erase_if(m_entries,
+                [&](const auto& e) { return e.get() == entry; });
+  UpdateAlarmLocked();
+}
+
+void NotifierPool::Replace(Notifier* oldNotifier, Notifier* newNotifier) {
+  std::unique_lock lock(m_mutex);
+  auto entry = Find(oldNotifier);
+  if (!entry) {
+    return;
+  }
+  // a worker reads through the stored pointer while running; wait it out
+  m_idleCond.wait(lock, [&] { return !entry->running; });
+  entry->notifier = newNotifier;
+}
+
+void NotifierPool::SetName(Notifier* notifier, std::string_view name) {
+  std::scoped_lock lock(m_mutex);
+  if (auto entry = Find(notifier)) {
+    entry->name = name;
+  }
+}
+
+void NotifierPool::Schedule(Notifier* notifier, uint64_t expirationUs,
+                            uint64_t periodUs, bool periodic) {
+  std::scoped_lock lock(m_mutex);
+  auto entry = Find(notifier);
+  if (!entry) {
+    return;
+  }
+  entry->expirationUs = expirationUs;
+  entry->periodUs = periodUs;
+  entry->periodic = periodic;
+  UpdateAlarmLocked();
+}
+
+void NotifierPool::Cancel(Notifier* notifier) {
+  std::scoped_lock lock(m_mutex);
+  auto entry = Find(notifier);
+  if (!entry) {
+    return;
+  }
+  entry->expirationUs = UINT64_MAX;
+  entry->periodic = false;
+  std::erase_if(m_ready, [&](Entry* e) { return e == entry; });
+  if (!entry->running) {
+    entry->queued = false;
+  }
+  UpdateAlarmLocked();
+}
+
+void NotifierPool::UpdateAlarmLocked() {
+  auto alarm = m_alarm.load();
+  if (alarm == 0) {
+    return;
+  }
+  uint64_t earliest = UINT64_MAX;
+  for (auto& entry : m_entries) {
+    if (entry->expirationUs < earliest) {
+      earliest = entry->expirationUs;
+    }
+  }
+  int32_t status = 0;
+  HAL_UpdateNotifierAlarm(alarm, earliest, &status);
+  FRC_CheckErrorStatus(status, "UpdateNotifierAlarm");
+}
+
+void NotifierPool::DispatcherMain() {
+  for (;;) {
+    int32_t status = 0;
+    HAL_NotifierHandle alarm = m_alarm.load();
+    if (alarm == 0) {
+      break;
+    }
+    uint64_t curTime = HAL_WaitForNotifierAlarm(alarm, &status);
+    if (curTime == 0 || status != 0) {
+      break;
+    }
+
+    bool anyReady = false;
+    {
+      std::scoped_lock lock(m_mutex);
+      for (auto& entry : m_entries) {
+        if (!entry->queued && entry->expirationUs <= curTime) {
+          if (entry->periodic) {
+            entry->expirationUs += entry->periodUs;
+          } else {
+            entry->expirationUs = UINT64_MAX;
+          }
+          entry->queued = true;
+          m_ready.push_back(entry.get());
+          anyReady = true;
+        }
+      }
+      UpdateAlarmLocked();
+    }
+    if (anyReady) {
+      m_workerCond.notify_all();
+    }
+  }
+}
+
+void NotifierPool::WorkerMain() {
+  int appliedPriority = 0;
+  std::unique_lock lock(m_mutex);
+  while (m_active) {
+    if (m_maxPriority != appliedPriority) {
+      appliedPriority = m_maxPriority;
+      int32_t status = 0;
+      HAL_SetCurrentThreadPriority(true, appliedPriority, &status);
+    }
+    m_workerCond.wait(lock, [&] { return !m_active || !m_ready.empty(); });
+    if (!m_active) {
+      break;
+    }
+    if (m_ready.empty()) {
+      continue;
+    }
+    Entry* entry = m_ready.front();
+    m_ready.erase(m_ready.begin());
+    entry->running = true;
+    // for periodic handlers the deadline is the next expiration; a handler
+    // still running then has overrun its period
+    uint64_t deadlineUs = entry->periodic ? entry->expirationUs : 0;
+    Notifier* notifier = entry->notifier;
+    lock.unlock();
+
+    std::function<void()> handler;
+    {
+      std::scoped_lock processLock(notifier->m_processMutex);
+      handler = notifier->m_handler;
+    }
+    if (handler) {
+      handler();
+    }
+
+    int32_t status = 0;
+    uint64_t now = HAL_GetFPGATime(&status);
+
+    lock.lock();
+    entry->running = false;
+    entry->queued = false;
+    if (deadlineUs != 0 && now > deadlineUs &&
+        now - entry->lastOverrunReportUs > 1000000) {
+      entry->lastOverrunReportUs = now;
+      FRC_ReportError(warn::Warning,
+                      "Pooled notifier '{}' handler overran its {} s period "
+                      "by {} s",
+                      entry->name, entry->periodUs * 1e-6,
+                      (now - deadlineUs) * 1e-6);
+    }
+    m_idleCond.notify_all();
+  }
+}
+
 Notifier::Notifier(std::function<void()> handler) {
   if (!handler) {
     throw FRC_MakeError(err::NullParameter, "handler");
@@ -101,7 +388,27 @@ Notifier::Notifier(int priority, std::function<void()> handler) {
   });
 }
 
+Notifier Notifier::Pooled(std::function<void()> handler) {
+  return Pooled(0, std::move(handler));
+}
+
+Notifier Notifier::Pooled(int priority, std::function<void()> handler) {
+  if (!handler) {
+    throw FRC_MakeError(err::NullParameter, "handler");
+  }
+  Notifier notifier;
+  notifier.m_handler = std::move(handler);
+  notifier.m_pooled = true;
+  NotifierPool::GetInstance().Add(&notifier, priority);
+  return notifier;
+}
+
 Notifier::~Notifier() {
+  if (m_pooled) {
+    NotifierPool::GetInstance().Remove(this);
+    return;
+  }
+
   int32_t status = 0;
   // atomically set handle to 0, then clean
   HAL_NotifierHandle handle = m_notifier.exchange(0);
@@ -122,8 +429,13 @@ Notifier::Notifier(Notifier&& rhs)
       m_handler(std::move(rhs.m_handler)),
       m_expirationTime(std::move(rhs.m_expirationTime)),
       m_period(std::move(rhs.m_period)),
-      m_periodic(std::move(rhs.m_periodic)) {
+      m_periodic(std::move(rhs.m_periodic)),
+      m_pooled(rhs.m_pooled) {
   rhs.m_notifier = HAL_kInvalidHandle;
+  if (m_pooled) {
+    NotifierPool::GetInstance().Replace(&rhs, this);
+    rhs.m_pooled = false;
+  }
 }
 
 Notifier& Notifier::operator=(Notifier&& rhs) {
@@ -134,11 +446,21 @@ Notifier& Notifier::operator=(Notifier&& rhs) {
   m_expirationTime = std::move(rhs.m_expirationTime);
   m_period = std::move(rhs.m_period);
   m_periodic = std::move(rhs.m_periodic);
+  m_pooled = rhs.m_pooled;
+  if (m_pooled) {
+    NotifierPool::GetInstance().Replace(&rhs, this);
+    rhs.m_pooled = false;
+  }
 
   return *this;
 }
 
 void Notifier::SetName(std::string_view name) {
+  if (m_pooled) {
+    NotifierPool::GetInstance().SetName(this, name);
+    return;
+  }
+
   fmt::memory_buffer buf;
   fmt::format_to(fmt::appender{buf}, "{}", name);
   buf.push_back('\0');  // null terminate
@@ -152,6 +474,14 @@ void Notifier::SetHandler(std::function<void()> handler) {
 }
 
 void Notifier::StartSingle(units::second_t delay) {
+  if (m_pooled) {
+    units::second_t expirationTime = Timer::GetFPGATimestamp() + delay;
+    NotifierPool::GetInstance().Schedule(
+        this, static_cast<uint64_t>(expirationTime * 1e6),
+        static_cast<uint64_t>(delay * 1e6), false);
+    return;
+  }
+
   std::scoped_lock lock(m_processMutex);
   m_periodic = false;
   m_period = delay;
@@ -160,6 +490,14 @@ void Notifier::StartSingle(units::second_t delay) {
 }
 
 void Notifier::StartPeriodic(units::second_t period) {
+  if (m_pooled) {
+    units::second_t expirationTime = Timer::GetFPGATimestamp() + period;
+    NotifierPool::GetInstance().Schedule(
+        this, static_cast<uint64_t>(expirationTime * 1e6),
+        static_cast<uint64_t>(period * 1e6), true);
+    return;
+  }
+
   std::scoped_lock lock(m_processMutex);
   m_periodic = true;
   m_period = period;
@@ -168,6 +506,11 @@ void Notifier::StartPeriodic(units::second_t period) {
 }
 
 void Notifier::Stop() {
+  if (m_pooled) {
+    NotifierPool::GetInstance().Cancel(this);
+    return;
+  }
+
   std::scoped_lock lock(m_processMutex);
   m_periodic = false;
   int32_t status = 0;
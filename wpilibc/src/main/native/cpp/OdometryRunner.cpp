@@ -0,0 +1,66 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "frc/OdometryRunner.h"
+
+#include <utility>
+
+#include "frc/Timer.h"
+
+using namespace frc;
+
+OdometryRunner::OdometryRunner(std::function<Pose2d()> update,
+                               units::second_t period, int priority)
+    : m_update{std::move(update)},
+      m_notifier{priority, [this] { Tick(); }},
+      m_period{period} {
+  m_notifier.SetName("OdometryRunner");
+}
+
+OdometryRunner::~OdometryRunner() {
+  Stop();
+}
+
+void OdometryRunner::Start() {
+  m_notifier.StartPeriodic(m_period);
+}
+
+void OdometryRunner::Stop() {
+  m_notifier.Stop();
+}
+
+void OdometryRunner::Tick() {
+  Pose2d pose = m_update();
+  double timestamp = Timer::GetFPGATimestamp().value();
+
+  // publish; the odd sequence value tells readers a write is in progress
+  m_seq.fetch_add(1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  m_x.store(pose.X().value(), std::memory_order_relaxed);
+  m_y.store(pose.Y().value(), std::memory_order_relaxed);
+  m_theta.store(pose.Rotation().Radians().value(), std::memory_order_relaxed);
+  m_timestamp.store(timestamp, std::memory_order_relaxed);
+  m_seq.fetch_add(1, std::memory_order_release);
+}
+
+OdometryRunner::PoseSample OdometryRunner::GetPose() const {
+  double x, y, theta, timestamp;
+  for (;;) {
+    uint32_t seq = m_seq.load(std::memory_order_acquire);
+    if ((seq & 1) == 0) {
+      x = m_x.load(std::memory_order_relaxed);
+      y = m_y.load(std::memory_order_relaxed);
+      theta = m_theta.load(std::memory_order_relaxed);
+      timestamp = m_timestamp.load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (m_seq.load(std::memory_order_relaxed) == seq) {
+        break;
+      }
+    }
+  }
+  return PoseSample{
+      Pose2d{units::meter_t{x}, units::meter_t{y},
+             Rotation2d{units::radian_t{theta}}},
+      units::second_t{timestamp}};
+}
@@ -87,6 +87,16 @@ double PowerDistribution::GetCurrent(int channel) const {
   return current;
 }
 
+std::vector<double> PowerDistribution::GetAllCurrents() const {
+  int32_t status = 0;
+  int32_t numChannels = HAL_GetPowerDistributionNumChannels(m_handle, &status);
+  std::vector<double> currents(numChannels);
+  HAL_GetPowerDistributionAllChannelCurrents(m_handle, currents.data(),
+                                             numChannels, &status);
+  FRC_ReportError(status, "Module {}", m_module);
+  return currents;
+}
+
 double PowerDistribution::GetTotalCurrent() const {
   int32_t status = 0;
   double current = HAL_GetPowerDistributionTotalCurrent(m_handle, &status);
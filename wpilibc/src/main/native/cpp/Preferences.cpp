@@ -5,6 +5,8 @@
 #include "frc/Preferences.h"
 
 #include <algorithm>
+#include <string>
+#include <utility>
 
 #include <fmt/format.h>
 #include <hal/FRCUsageReporting.h>
@@ -12,7 +14,10 @@
 #include <networktables/NetworkTable.h>
 #include <networktables/NetworkTableInstance.h>
 #include <networktables/NetworkTableListener.h>
+#include <networktables/NetworkTableValue.h>
 #include <networktables/StringTopic.h>
+#include <wpi/StringMap.h>
+#include <wpi/mutex.h>
 
 using namespace frc;
 
@@ -20,6 +25,27 @@ using namespace frc;
 static constexpr std::string_view kTableName{"Preferences"};
 
 namespace {
+// Local typed cache of preference values, populated lazily on first access
+// and kept coherent by the value listener in Instance.  Steady-state Gets are
+// served from here instead of round-tripping through NT entry resolution and
+// local storage for every call.  Kept outside Instance so the listener
+// callback never touches the Instance singleton while it is being
+// constructed or reset.
+struct Cache {
+  struct Entry {
+    // Last known value; updated synchronously by Set*/Init* and
+    // asynchronously by the value listener when another client edits the
+    // preference.
+    nt::Value value;
+    // Whether SetPersistent() has already been issued for this key, so
+    // repeated Sets skip the redundant persistence request.
+    bool persistent = false;
+  };
+
+  wpi::mutex mutex;
+  wpi::StringMap<Entry> entries;
+};
+
 struct Instance {
   Instance();
 
@@ -29,9 +55,15 @@ struct Instance {
   nt::MultiSubscriber tableSubscriber{nt::NetworkTableInstance::GetDefault(),
                                       {{fmt::format("{}/", table->GetPath())}}};
   nt::NetworkTableListener listener;
+  nt::NetworkTableListener valueListener;
 };
 }  // namespace
 
+static Cache& GetCache() {
+  static Cache cache;
+  return cache;
+}
+
 static Instance& GetInstance() {
   static Instance instance;
   return instance;
@@ -40,110 +72,167 @@ static Instance& GetInstance() {
 #ifndef __FRC_ROBORIO__
 namespace frc::impl {
 void ResetPreferencesInstance() {
+  {
+    auto& cache = GetCache();
+    std::scoped_lock lock{cache.mutex};
+    cache.entries.clear();
+  }
   GetInstance() = Instance();
 }
 }  // namespace frc::impl
 #endif
 
+/**
+ * Returns the cached value for a key, resolving the NT entry and caching its
+ * current value on first access.
+ */
+static nt::Value GetCachedValue(std::string_view key) {
+  auto& cache = GetCache();
+  std::scoped_lock lock{cache.mutex};
+  auto it = cache.entries.find(key);
+  if (it == cache.entries.end()) {
+    it = cache.entries
+             .try_emplace(key, Cache::Entry{::GetInstance()
+                                                .table->GetEntry(key)
+                                                .GetValue(),
+                                            false})
+             .first;
+  }
+  return it->second.value;
+}
+
+/**
+ * Refreshes the cached value for a key after a Set/Init and requests
+ * persistence if this key hasn't been persisted yet.
+ */
+static void FinishSet(std::string_view key, nt::NetworkTableEntry entry) {
+  auto& cache = GetCache();
+  std::scoped_lock lock{cache.mutex};
+  auto& cached = cache.entries[key];
+  cached.value = entry.GetValue();
+  if (!cached.persistent) {
+    entry.SetPersistent();
+    cached.persistent = true;
+  }
+}
+
+// Entry numeric Gets convert between integer/float/double; mirror that here.
+template <typename T>
+static T GetNumber(const nt::Value& value, T defaultValue) {
+  if (value.IsInteger()) {
+    return static_cast<T>(value.GetInteger());
+  } else if (value.IsFloat()) {
+    return static_cast<T>(value.GetFloat());
+  } else if (value.IsDouble()) {
+    return static_cast<T>(value.GetDouble());
+  }
+  return defaultValue;
+}
+
 std::vector<std::string> Preferences::GetKeys() {
   return ::GetInstance().table->GetKeys();
 }
 
 std::string Preferences::GetString(std::string_view key,
                                    std::string_view defaultValue) {
-  return ::GetInstance().table->GetEntry(key).GetString(defaultValue);
+  auto value = GetCachedValue(key);
+  if (value.IsString()) {
+    return std::string{value.GetString()};
+  }
+  return std::string{defaultValue};
 }
 
 int Preferences::GetInt(std::string_view key, int defaultValue) {
-  return ::GetInstance().table->GetEntry(key).GetInteger(defaultValue);
+  return GetNumber(GetCachedValue(key), defaultValue);
 }
 
 double Preferences::GetDouble(std::string_view key, double defaultValue) {
-  return ::GetInstance().table->GetEntry(key).GetDouble(defaultValue);
+  return GetNumber(GetCachedValue(key), defaultValue);
 }
 
 float Preferences::GetFloat(std::string_view key, float defaultValue) {
-  return ::GetInstance().table->GetEntry(key).GetFloat(defaultValue);
+  return GetNumber(GetCachedValue(key), defaultValue);
 }
 
 bool Preferences::GetBoolean(std::string_view key, bool defaultValue) {
-  return ::GetInstance().table->GetEntry(key).GetBoolean(defaultValue);
+  auto value = GetCachedValue(key);
+  return value.IsBoolean() ? value.GetBoolean() : defaultValue;
 }
 
 int64_t Preferences::GetLong(std::string_view key, int64_t defaultValue) {
-  return ::GetInstance().table->GetEntry(key).GetInteger(defaultValue);
+  return GetNumber(GetCachedValue(key), defaultValue);
 }
 
 void Preferences::SetString(std::string_view key, std::string_view value) {
   auto entry = ::GetInstance().table->GetEntry(key);
   entry.SetString(value);
-  entry.SetPersistent();
+  FinishSet(key, entry);
 }
 
 void Preferences::InitString(std::string_view key, std::string_view value) {
   auto entry = ::GetInstance().table->GetEntry(key);
   entry.SetDefaultString(value);
-  entry.SetPersistent();
+  FinishSet(key, entry);
 }
 
 void Preferences::SetInt(std::string_view key, int value) {
   auto entry = ::GetInstance().table->GetEntry(key);
   entry.SetInteger(value);
-  entry.SetPersistent();
+  FinishSet(key, entry);
 }
 
 void Preferences::InitInt(std::string_view key, int value) {
   auto entry = ::GetInstance().table->GetEntry(key);
   entry.SetDefaultInteger(value);
-  entry.SetPersistent();
+  FinishSet(key, entry);
 }
 
 void Preferences::SetDouble(std::string_view key, double value) {
   auto entry = ::GetInstance().table->GetEntry(key);
   entry.SetDouble(value);
-  entry.SetPersistent();
+  FinishSet(key, entry);
 }
 
 void Preferences::InitDouble(std::string_view key, double value) {
   auto entry = ::GetInstance().table->GetEntry(key);
   entry.SetDefaultDouble(value);
-  entry.SetPersistent();
+  FinishSet(key, entry);
 }
 
 void Preferences::SetFloat(std::string_view key, float value) {
   auto entry = ::GetInstance().table->GetEntry(key);
   entry.SetFloat(value);
-  entry.SetPersistent();
+  FinishSet(key, entry);
 }
 
 void Preferences::InitFloat(std::string_view key, float value) {
   auto entry = ::GetInstance().table->GetEntry(key);
   entry.SetDefaultFloat(value);
-  entry.SetPersistent();
+  FinishSet(key, entry);
 }
 
 void Preferences::SetBoolean(std::string_view key, bool value) {
   auto entry = ::GetInstance().table->GetEntry(key);
   entry.SetBoolean(value);
-  entry.SetPersistent();
+  FinishSet(key, entry);
 }
 
 void Preferences::InitBoolean(std::string_view key, bool value) {
   auto entry = ::GetInstance().table->GetEntry(key);
   entry.SetDefaultBoolean(value);
-  entry.SetPersistent();
+  FinishSet(key, entry);
 }
 
 void Preferences::SetLong(std::string_view key, int64_t value) {
   auto entry = ::GetInstance().table->GetEntry(key);
   entry.SetInteger(value);
-  entry.SetPersistent();
+  FinishSet(key, entry);
 }
 
 void Preferences::InitLong(std::string_view key, int64_t value) {
   auto entry = ::GetInstance().table->GetEntry(key);
   entry.SetDefaultInteger(value);
-  entry.SetPersistent();
+  FinishSet(key, entry);
 }
 
 bool Preferences::ContainsKey(std::string_view key) {
@@ -154,6 +243,9 @@ void Preferences::Remove(std::string_view key) {
   auto entry = ::GetInstance().table->GetEntry(key);
   entry.ClearPersistent();
   entry.Unpublish();
+  auto& cache = GetCache();
+  std::scoped_lock lock{cache.mutex};
+  cache.entries.erase(key);
 }
 
 void Preferences::RemoveAll() {
@@ -175,5 +267,34 @@ Instance::Instance() {
           }
         }
       });
+  // Keep the local value cache coherent with edits made by other clients
+  // (e.g. a dashboard) and drop cached values whose topics go away.  Only
+  // keys already in the cache are updated; unknown keys are cached lazily on
+  // first Get.
+  valueListener = nt::NetworkTableListener::CreateListener(
+      tableSubscriber,
+      NT_EVENT_VALUE_ALL | NT_EVENT_UNPUBLISH | NT_EVENT_IMMEDIATE,
+      [prefixLen = table->GetPath().size() + 1](auto& event) {
+        auto& cache = GetCache();
+        if (auto valueData = event.GetValueEventData()) {
+          auto name = nt::GetTopicName(valueData->topic);
+          if (name.size() <= prefixLen) {
+            return;
+          }
+          std::scoped_lock lock{cache.mutex};
+          auto it =
+              cache.entries.find(std::string_view{name}.substr(prefixLen));
+          if (it != cache.entries.end()) {
+            it->second.value = valueData->value;
+          }
+        } else if (auto topicInfo = event.GetTopicInfo()) {
+          if (topicInfo->name.size() <= prefixLen) {
+            return;
+          }
+          std::scoped_lock lock{cache.mutex};
+          cache.entries.erase(
+              std::string_view{topicInfo->name}.substr(prefixLen));
+        }
+      });
   HAL_Report(HALUsageReporting::kResourceType_Preferences, 0);
 }
@@ -10,6 +10,7 @@
 
 #include <hal/FRCUsageReporting.h>
 #include <hal/SPI.h>
+#include <wpi/SafeThread.h>
 #include <wpi/SmallVector.h>
 #include <wpi/mutex.h>
 
@@ -19,6 +20,54 @@
 
 using namespace frc;
 
+namespace {
+// Shared bus thread for asynchronous transactions; completion callbacks run
+// here so the control loop never blocks for a bus round trip.
+struct BusThread final : public wpi::SafeThread {
+  BusThread() { SetTelemetryName("SPIBus"); }
+
+  void Main() final;
+
+  struct Request {
+    HAL_SPIPort port;
+    wpi::SmallVector<uint8_t, 16> dataToSend;
+    std::function<void(int, std::span<const uint8_t>)> onComplete;
+  };
+  std::vector<Request> m_requests;
+};
+
+void BusThread::Main() {
+  std::unique_lock lock{m_mutex};
+  while (m_active) {
+    m_cond.wait(lock, [&] { return !m_active || !m_requests.empty(); });
+    RecordWake(m_requests.size());
+    std::vector<Request> requests;
+    requests.swap(m_requests);
+    lock.unlock();
+    for (auto&& req : requests) {
+      wpi::SmallVector<uint8_t, 16> received;
+      received.resize(req.dataToSend.size());
+      int count = HAL_TransactionSPI(req.port, req.dataToSend.data(),
+                                     received.data(), req.dataToSend.size());
+      if (req.onComplete) {
+        req.onComplete(count, std::span<const uint8_t>{received.data(),
+                                                       received.size()});
+      }
+    }
+    lock.lock();
+  }
+}
+
+wpi::SafeThreadOwner<BusThread>& GetBusThread() {
+  static wpi::SafeThreadOwner<BusThread> owner = [] {
+    wpi::SafeThreadOwner<BusThread> o;
+    o.Start();
+    return o;
+  }();
+  return owner;
+}
+}  // namespace
+
 static constexpr int kAccumulateDepth = 2048;
 
 class SPI::Accumulator {
@@ -256,6 +305,19 @@ int SPI::Transaction(uint8_t* dataToSend, uint8_t* dataReceived, int size) {
   return retVal;
 }
 
+void SPI::TransactionAsync(
+    std::span<const uint8_t> dataToSend,
+    std::function<void(int count, std::span<const uint8_t> dataReceived)>
+        onComplete) {
+  if (auto thr = GetBusThread().GetThread()) {
+    thr->m_requests.emplace_back(BusThread::Request{
+        m_port,
+        {dataToSend.begin(), dataToSend.end()},
+        std::move(onComplete)});
+    thr->m_cond.notify_one();
+  }
+}
+
 void SPI::InitAuto(int bufferSize) {
   int32_t status = 0;
   HAL_InitSPIAuto(m_port, bufferSize, &status);
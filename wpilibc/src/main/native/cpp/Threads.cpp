@@ -6,6 +6,7 @@
 
 #include <hal/FRCUsageReporting.h>
 #include <hal/Threads.h>
+#include <wpi/ThreadPolicy.h>
 
 #include "frc/Errors.h"
 
@@ -45,4 +46,17 @@ bool SetCurrentThreadPriority(bool realTime, int priority) {
   return ret;
 }
 
+bool SetLibraryThreadPolicy(std::string_view pattern, bool realTime,
+                            int priority, uint64_t affinityMask) {
+  wpi::ThreadPolicy policy;
+  policy.realTime = realTime;
+  policy.priority = priority;
+  policy.affinityMask = affinityMask;
+  return wpi::SetThreadPolicy(pattern, policy);
+}
+
+std::vector<std::string> GetLibraryThreadNames() {
+  return wpi::GetRegisteredThreadNames();
+}
+
 }  // namespace frc
@@ -6,6 +6,7 @@
 
 #include <stdint.h>
 
+#include <cmath>
 #include <cstdio>
 #include <utility>
 
@@ -47,9 +48,7 @@ void TimedRobot::StartCompetition() {
       break;
     }
 
-    callback.func();
-
-    callback.expirationTime += callback.period;
+    RunCallback(callback);
     m_callbacks.push(std::move(callback));
 
     // Process all other callbacks that are ready to run
@@ -57,9 +56,7 @@ void TimedRobot::StartCompetition() {
            curTime) {
       callback = m_callbacks.pop();
 
-      callback.func();
-
-      callback.expirationTime += callback.period;
+      RunCallback(callback);
       m_callbacks.push(std::move(callback));
     }
   }
@@ -94,5 +91,37 @@ TimedRobot::~TimedRobot() {
 
 void TimedRobot::AddPeriodic(std::function<void()> callback,
                              units::second_t period, units::second_t offset) {
-  m_callbacks.emplace(callback, m_startTime, period, offset);
+  auto stats = std::make_shared<PeriodicStats>(PeriodicStats{period});
+  m_periodicStats.emplace_back(stats);
+  m_callbacks.emplace(callback, m_startTime, period, offset, std::move(stats));
+}
+
+std::vector<TimedRobot::PeriodicStats> TimedRobot::GetPeriodicStats() const {
+  std::vector<PeriodicStats> result;
+  result.reserve(m_periodicStats.size());
+  for (auto&& stats : m_periodicStats) {
+    result.emplace_back(*stats);
+  }
+  return result;
+}
+
+void TimedRobot::RunCallback(Callback& callback) {
+  auto start = Timer::GetFPGATimestamp();
+  callback.func();
+  auto now = Timer::GetFPGATimestamp();
+  if (now - start > callback.period) {
+    callback.stats->overrunCount++;
+  }
+
+  callback.expirationTime += callback.period;
+  // If the loop has fallen behind by whole periods (e.g. a slow callback ran
+  // first), skip the missed runs instead of running this callback
+  // back-to-back to catch up, so it returns to its phase-aligned schedule.
+  if (callback.expirationTime <= now) {
+    double missed =
+        std::floor(((now - callback.expirationTime) / callback.period).value()) +
+        1;
+    callback.stats->skippedRuns += static_cast<uint64_t>(missed);
+    callback.expirationTime += missed * callback.period;
+  }
 }
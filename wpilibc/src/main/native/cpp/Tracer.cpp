@@ -22,13 +22,37 @@ void Tracer::ResetTimer() {
 
 void Tracer::ClearEpochs() {
   ResetTimer();
-  m_epochs.clear();
+  // Keep the interned labels and their log entries; just mark the slots
+  // empty so steady-state loops don't rehash or reallocate.
+  for (auto& epoch : m_epochs) {
+    epoch.duration = std::chrono::nanoseconds{0};
+    epoch.set = false;
+  }
 }
 
 void Tracer::AddEpoch(std::string_view epochName) {
   auto currentTime = hal::fpga_clock::now();
-  m_epochs[epochName] = currentTime - m_startTime;
+  auto duration = currentTime - m_startTime;
   m_startTime = currentTime;
+
+  auto [it, isNew] = m_labelIndex.try_emplace(epochName, m_epochs.size());
+  if (isNew) {
+    auto& epoch = m_epochs.emplace_back();
+    epoch.name = epochName;
+    if (m_dataLog) {
+      epoch.logEntry = wpi::log::DoubleLogEntry{
+          *m_dataLog, fmt::format("{}/{}", m_dataLogPrefix, epoch.name)};
+    }
+  }
+  auto& epoch = m_epochs[it->second];
+  epoch.duration = duration;
+  epoch.set = true;
+  if (epoch.logEntry) {
+    epoch.logEntry.Append(
+        std::chrono::duration_cast<std::chrono::microseconds>(duration)
+            .count() /
+        1.0e6);
+  }
 }
 
 void Tracer::PrintEpochs() {
@@ -48,9 +72,21 @@ void Tracer::PrintEpochs(wpi::raw_ostream& os) {
   if (now - m_lastEpochsPrintTime > kMinPrintPeriod) {
     m_lastEpochsPrintTime = now;
     for (const auto& epoch : m_epochs) {
+      if (!epoch.set) {
+        continue;
+      }
       os << fmt::format(
-          "\t{}: {:.6f}s\n", epoch.getKey(),
-          duration_cast<microseconds>(epoch.getValue()).count() / 1.0e6);
+          "\t{}: {:.6f}s\n", epoch.name,
+          duration_cast<microseconds>(epoch.duration).count() / 1.0e6);
     }
   }
 }
+
+void Tracer::StartDataLog(wpi::log::DataLog& log, std::string_view prefix) {
+  m_dataLog = &log;
+  m_dataLogPrefix = prefix;
+  for (auto& epoch : m_epochs) {
+    epoch.logEntry = wpi::log::DoubleLogEntry{
+        log, fmt::format("{}/{}", m_dataLogPrefix, epoch.name)};
+  }
+}
@@ -4,17 +4,21 @@
 
 #include "frc/Ultrasonic.h"
 
+#include <memory>
 #include <utility>
 
 #include <hal/FRCUsageReporting.h>
 #include <wpi/NullDeleter.h>
+#include <wpi/mutex.h>
 #include <wpi/sendable/SendableBuilder.h>
 #include <wpi/sendable/SendableRegistry.h>
 
+#include "frc/AsynchronousInterrupt.h"
 #include "frc/Counter.h"
 #include "frc/DigitalInput.h"
 #include "frc/DigitalOutput.h"
 #include "frc/Errors.h"
+#include "frc/Notifier.h"
 #include "frc/Timer.h"
 
 using namespace frc;
@@ -23,7 +27,14 @@ using namespace frc;
 std::atomic<bool> Ultrasonic::m_automaticEnabled{false};
 
 std::vector<Ultrasonic*> Ultrasonic::m_sensors;
-std::thread Ultrasonic::m_thread;
+units::second_t Ultrasonic::m_pingSpacing = Ultrasonic::kDefaultPingSpacing;
+
+// Automatic mode scheduler state.  The notifier fires either m_pingSpacing
+// after an echo returns or kMaxUltrasonicTime after a ping whose echo never
+// came back, so the round robin is driven entirely by events.
+static wpi::mutex gSchedulerMutex;
+static size_t gCurrentIndex = 0;
+static std::unique_ptr<Notifier> gScheduler;
 
 Ultrasonic::Ultrasonic(int pingChannel, int echoChannel)
     : m_pingChannel(std::make_shared<DigitalOutput>(pingChannel)),
@@ -71,9 +82,15 @@ Ultrasonic::~Ultrasonic() {
   bool wasAutomaticMode = m_automaticEnabled;
   SetAutomaticMode(false);
 
-  // No synchronization needed because the background task is stopped.
-  m_sensors.erase(std::remove(m_sensors.begin(), m_sensors.end(), this),
-                  m_sensors.end());
+  // Notifier::Stop() doesn't wait for an in-flight callback, so a PingNext()
+  // may still be running; removal must hold the scheduler lock (PingNext()
+  // re-checks m_automaticEnabled under the same lock before touching the
+  // list).
+  {
+    std::scoped_lock lock(gSchedulerMutex);
+    m_sensors.erase(std::remove(m_sensors.begin(), m_sensors.end(), this),
+                    m_sensors.end());
+  }
 
   if (!m_sensors.empty() && wasAutomaticMode) {
     SetAutomaticMode(true);
@@ -112,29 +129,105 @@ void Ultrasonic::SetAutomaticMode(bool enabling) {
   m_automaticEnabled = enabling;
 
   if (enabling) {
-    /* Clear all the counters so no data is valid. No synchronization is needed
-     * because the background task is stopped.
-     */
+    // Clear all the counters so no data is valid, and attach an echo
+    // interrupt to each sensor.  No synchronization is needed because the
+    // scheduler is stopped.
     for (auto& sensor : m_sensors) {
       sensor->m_counter.Reset();
+      sensor->m_interrupt = std::make_unique<AsynchronousInterrupt>(
+          *sensor->m_echoChannel, [sensor](bool rising, bool falling) {
+            sensor->HandleEcho(rising, falling);
+          });
+      // the falling edge marks the end of the echo pulse
+      sensor->m_interrupt->SetInterruptEdges(false, true);
+      sensor->m_interrupt->Enable();
     }
 
-    m_thread = std::thread(&Ultrasonic::UltrasonicChecker);
+    {
+      std::scoped_lock lock(gSchedulerMutex);
+      if (!gScheduler) {
+        gScheduler = std::make_unique<Notifier>([] { PingNext(); });
+        gScheduler->SetName("UltrasonicScheduler");
+      }
+    }
+    PingNext();
   } else {
-    // Wait for background task to stop running
-    if (m_thread.joinable()) {
-      m_thread.join();
+    // Stop the scheduler and detach the echo interrupts; a callback already
+    // in flight exits early on m_automaticEnabled.
+    {
+      std::scoped_lock lock(gSchedulerMutex);
+      if (gScheduler) {
+        gScheduler->Stop();
+      }
     }
 
     // Clear all the counters (data now invalid) since automatic mode is
-    // disabled. No synchronization is needed because the background task is
-    // stopped.
+    // disabled.
     for (auto& sensor : m_sensors) {
+      sensor->m_interrupt.reset();
       sensor->m_counter.Reset();
     }
   }
 }
 
+void Ultrasonic::SetPingSpacing(units::second_t spacing) {
+  std::scoped_lock lock(gSchedulerMutex);
+  m_pingSpacing = spacing;
+}
+
+void Ultrasonic::SetRangeCallback(
+    std::function<void(units::second_t timestamp, units::meter_t range)>
+        callback) {
+  m_rangeCallback = std::move(callback);
+}
+
+void Ultrasonic::HandleEcho(bool risingEdge, bool fallingEdge) {
+  if (!fallingEdge || !m_automaticEnabled) {
+    return;
+  }
+  units::second_t timestamp = m_interrupt->GetFallingTimestamp();
+
+  {
+    std::scoped_lock lock(gSchedulerMutex);
+    if (gCurrentIndex >= m_sensors.size() ||
+        m_sensors[gCurrentIndex] != this) {
+      return;  // residual echo from an earlier ping
+    }
+  }
+
+  if (m_rangeCallback && IsRangeValid()) {
+    m_rangeCallback(timestamp, GetRange());
+  }
+
+  // schedule the next sensor's ping after the minimum safe spacing
+  std::scoped_lock lock(gSchedulerMutex);
+  if (gScheduler) {
+    gScheduler->StartSingle(m_pingSpacing);
+  }
+}
+
+void Ultrasonic::PingNext() {
+  std::scoped_lock lock(gSchedulerMutex);
+  // checked under the lock: once a destructor or SetAutomaticMode(false)
+  // holds the lock and has cleared the flag, a late-firing callback can't
+  // get past this point and race the sensor list
+  if (!m_automaticEnabled) {
+    return;
+  }
+  size_t count = m_sensors.size();
+  for (size_t i = 0; i < count; i++) {
+    gCurrentIndex = (gCurrentIndex + 1) % count;
+    Ultrasonic* sensor = m_sensors[gCurrentIndex];
+    if (sensor->IsEnabled()) {
+      sensor->m_counter.Reset();  // reset the counter to zero (invalid data)
+      sensor->m_pingChannel->Pulse(kPingTime);  // do the ping
+      // re-arm as a timeout in case the echo never returns
+      gScheduler->StartSingle(kMaxUltrasonicTime);
+      return;
+    }
+  }
+}
+
 units::meter_t Ultrasonic::GetRange() const {
   if (IsRangeValid()) {
     if (m_simRange) {
@@ -172,8 +265,12 @@ void Ultrasonic::Initialize() {
 
   bool originalMode = m_automaticEnabled;
   SetAutomaticMode(false);  // Kill task when adding a new sensor
-  // Link this instance on the list
-  m_sensors.emplace_back(this);
+  // Link this instance on the list; an in-flight scheduler callback may
+  // still be iterating it (see ~Ultrasonic)
+  {
+    std::scoped_lock lock(gSchedulerMutex);
+    m_sensors.emplace_back(this);
+  }
 
   m_counter.SetMaxPeriod(1_s);
   m_counter.SetSemiPeriodMode(true);
@@ -187,18 +284,5 @@ void Ultrasonic::Initialize() {
   wpi::SendableRegistry::AddLW(this, "Ultrasonic", m_echoChannel->GetChannel());
 }
 
-void Ultrasonic::UltrasonicChecker() {
-  while (m_automaticEnabled) {
-    for (auto& sensor : m_sensors) {
-      if (!m_automaticEnabled) {
-        break;
-      }
-
-      if (sensor->IsEnabled()) {
-        sensor->m_pingChannel->Pulse(kPingTime);  // do the ping
-      }
-
-      Wait(100_ms);  // wait for ping to return
-    }
-  }
-}
+Ultrasonic::Ultrasonic(Ultrasonic&&) = default;
+Ultrasonic& Ultrasonic::operator=(Ultrasonic&&) = default;
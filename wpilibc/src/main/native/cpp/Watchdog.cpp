@@ -123,6 +123,10 @@ void Watchdog::Impl::Main() {
     // clobbered.
     watchdog->m_isExpired = true;
 
+    if (watchdog->m_logOverrun) {
+      watchdog->m_logOverrun.Append(watchdog->m_timeout.value());
+    }
+
     lock.unlock();
     watchdog->m_callback();
     lock.lock();
@@ -156,6 +160,7 @@ Watchdog& Watchdog::operator=(Watchdog&& rhs) {
   m_lastTimeoutPrintTime = rhs.m_lastTimeoutPrintTime;
   m_suppressTimeoutMessage = rhs.m_suppressTimeoutMessage;
   m_tracer = std::move(rhs.m_tracer);
+  m_logOverrun = std::move(rhs.m_logOverrun);
   m_isExpired = rhs.m_isExpired;
   if (m_expirationTime != 0_s) {
     m_impl->m_watchdogs.remove(&rhs);
@@ -231,6 +236,14 @@ void Watchdog::SuppressTimeoutMessage(bool suppress) {
   m_suppressTimeoutMessage = suppress;
 }
 
+void Watchdog::StartDataLog(wpi::log::DataLog& log, std::string_view prefix) {
+  m_tracer.StartDataLog(log, fmt::format("{}/epochs", prefix));
+
+  std::scoped_lock lock(m_impl->m_mutex);
+  m_logOverrun =
+      wpi::log::DoubleLogEntry{log, fmt::format("{}/overrun", prefix)};
+}
+
 bool Watchdog::operator>(const Watchdog& rhs) const {
   return m_expirationTime > rhs.m_expirationTime;
 }
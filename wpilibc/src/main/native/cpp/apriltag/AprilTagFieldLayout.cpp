@@ -4,6 +4,7 @@
 
 #include "frc/apriltag/AprilTagFieldLayout.h"
 
+#include <algorithm>
 #include <system_error>
 
 #include <units/angle.h>
@@ -30,6 +31,7 @@ AprilTagFieldLayout::AprilTagFieldLayout(std::string_view path) {
   }
   m_fieldWidth = units::meter_t{json.at("field").at("width").get<double>()};
   m_fieldLength = units::meter_t{json.at("field").at("height").get<double>()};
+  RebuildPoseCache();
 }
 
 AprilTagFieldLayout::AprilTagFieldLayout(std::vector<AprilTag> apriltags,
@@ -40,6 +42,33 @@ AprilTagFieldLayout::AprilTagFieldLayout(std::vector<AprilTag> apriltags,
   for (const auto& tag : apriltags) {
     m_apriltags[tag.ID] = tag;
   }
+  RebuildPoseCache();
+}
+
+void AprilTagFieldLayout::RebuildPoseCache() {
+  int maxID = -1;
+  for (const auto& pair : m_apriltags) {
+    maxID = (std::max)(maxID, pair.first);
+  }
+  for (auto& cache : m_poseCache) {
+    cache.clear();
+    cache.resize(maxID + 1);
+  }
+
+  Pose3d mirrorPose{m_fieldLength, m_fieldWidth, 0_m,
+                    Rotation3d{0_deg, 0_deg, 180_deg}};
+  for (const auto& [id, tag] : m_apriltags) {
+    if (id < 0) {
+      continue;
+    }
+    Pose3d pose = tag.pose;
+    m_poseCache[0][id] = CachedTag{
+        pose, Transform3d{pose.Translation(), pose.Rotation()}.Inverse()};
+    Pose3d mirrored = pose.RelativeTo(mirrorPose);
+    m_poseCache[1][id] = CachedTag{
+        mirrored,
+        Transform3d{mirrored.Translation(), mirrored.Rotation()}.Inverse()};
+  }
 }
 
 void AprilTagFieldLayout::SetAlliance(DriverStation::Alliance alliance) {
@@ -47,16 +76,30 @@ void AprilTagFieldLayout::SetAlliance(DriverStation::Alliance alliance) {
 }
 
 std::optional<frc::Pose3d> AprilTagFieldLayout::GetTagPose(int ID) const {
-  const auto& it = m_apriltags.find(ID);
-  if (it == m_apriltags.end()) {
+  const auto& cache = m_poseCache[m_mirror ? 1 : 0];
+  if (ID < 0 || static_cast<size_t>(ID) >= cache.size() || !cache[ID]) {
     return std::nullopt;
   }
-  Pose3d returnPose = it->second.pose;
-  if (m_mirror) {
-    returnPose = returnPose.RelativeTo(Pose3d{
-        m_fieldLength, m_fieldWidth, 0_m, Rotation3d{0_deg, 0_deg, 180_deg}});
+  return cache[ID]->pose;
+}
+
+std::optional<frc::Transform3d> AprilTagFieldLayout::GetTagPoseInverse(
+    int ID) const {
+  const auto& cache = m_poseCache[m_mirror ? 1 : 0];
+  if (ID < 0 || static_cast<size_t>(ID) >= cache.size() || !cache[ID]) {
+    return std::nullopt;
+  }
+  return cache[ID]->inverse;
+}
+
+std::vector<std::optional<frc::Pose3d>> AprilTagFieldLayout::GetTagPoses(
+    std::span<const int> IDs) const {
+  std::vector<std::optional<Pose3d>> poses;
+  poses.reserve(IDs.size());
+  for (int ID : IDs) {
+    poses.push_back(GetTagPose(ID));
   }
-  return returnPose;
+  return poses;
 }
 
 void AprilTagFieldLayout::Serialize(std::string_view path) {
@@ -105,4 +148,5 @@ void frc::from_json(const wpi::json& json, AprilTagFieldLayout& layout) {
       units::meter_t{json.at("field").at("length").get<double>()};
   layout.m_fieldWidth =
       units::meter_t{json.at("field").at("width").get<double>()};
+  layout.RebuildPoseCache();
 }
@@ -4,10 +4,43 @@
 
 #include "frc/event/BooleanEvent.h"
 
+#include <memory>
+#include <utility>
+
 using namespace frc;
 
+namespace {
+struct ConditionCache {
+  explicit ConditionCache(std::function<bool()> signal)
+      : signal(std::move(signal)) {}
+
+  std::function<bool()> signal;
+  uint64_t poll = 0;
+  bool value = false;
+};
+}  // namespace
+
 BooleanEvent::BooleanEvent(EventLoop* loop, std::function<bool()> condition)
-    : m_loop(loop), m_condition(std::move(condition)) {}
+    : m_loop(loop) {
+  // Evaluate the underlying condition at most once per Poll() of the loop.
+  // Several bindings and composed events typically share one source
+  // condition (every OnTrue/WhileTrue on a trigger re-binds it), so without
+  // this each poll re-reads the source once per use instead of once.
+  // Outside of a poll the condition is always evaluated directly, so
+  // GetAsBoolean() and events polled through a different loop stay fresh.
+  auto cache = std::make_shared<ConditionCache>(std::move(condition));
+  m_condition = [loop, cache] {
+    uint64_t poll = loop->m_currentPoll;
+    if (poll == 0) {
+      return cache->signal();
+    }
+    if (cache->poll != poll) {
+      cache->poll = poll;
+      cache->value = cache->signal();
+    }
+    return cache->value;
+  };
+}
 
 BooleanEvent::operator std::function<bool()>() {
   return m_condition;
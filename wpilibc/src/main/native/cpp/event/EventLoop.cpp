@@ -20,9 +20,11 @@ void EventLoop::Bind(std::function<bool()> condition,
 }
 
 void EventLoop::Poll() {
+  m_currentPoll = ++m_pollCount;
   for (Binding& binding : m_bindings) {
     binding.Poll();
   }
+  m_currentPoll = 0;
 }
 
 void EventLoop::Clear() {
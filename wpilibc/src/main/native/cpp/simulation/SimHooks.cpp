@@ -48,4 +48,8 @@ void StepTimingAsync(units::second_t delta) {
   HALSIM_StepTimingAsync(static_cast<uint64_t>(delta.value() * 1e6));
 }
 
+void FastForwardTiming(units::second_t delta) {
+  HALSIM_FastForwardTiming(static_cast<uint64_t>(delta.value() * 1e6));
+}
+
 }  // namespace frc::sim
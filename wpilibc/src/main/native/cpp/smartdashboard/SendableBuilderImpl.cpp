@@ -21,12 +21,35 @@
 
 using namespace frc;
 
-template <typename Topic>
-void SendableBuilderImpl::PropertyImpl<Topic>::Update(bool controllable,
-                                                      int64_t time) {
-  if (controllable && sub && updateLocal) {
+namespace {
+
+// Callables binding a property-table thunk to its object pointer; used in
+// place of std::function for AddPropertyTable() entries so the NT backend
+// stores two raw pointers per accessor with no type erasure.
+template <typename T>
+struct TableGetter {
+  void* obj;
+  T (*fn)(void*);
+  explicit operator bool() const { return fn != nullptr; }
+  T operator()() const { return fn(obj); }
+};
+
+template <typename T, typename Param = T>
+struct TableSetter {
+  void* obj;
+  void (*fn)(void*, Param);
+  explicit operator bool() const { return fn != nullptr; }
+  void operator()(Param value) const { fn(obj, value); }
+};
+
+}  // namespace
+
+template <typename Topic, typename UpdateNetwork, typename UpdateLocal>
+void SendableBuilderImpl::PropertyImpl<Topic, UpdateNetwork, UpdateLocal>::
+    Update(bool controllable, int64_t time) {
+  if (controllable && sub) {
     updateLocal(sub);
-  } else if (pub && updateNetwork) {
+  } else if (pub) {
     updateNetwork(pub, time);
   }
 }
@@ -121,20 +144,22 @@ nt::Topic SendableBuilderImpl::GetTopic(std::string_view key) {
 template <typename Topic, typename Getter, typename Setter>
 void SendableBuilderImpl::AddPropertyImpl(Topic topic, Getter getter,
                                           Setter setter) {
-  auto prop = std::make_unique<PropertyImpl<Topic>>();
+  auto updateNetwork = [getter](auto& pub, int64_t time) {
+    pub.Set(getter(), time);
+  };
+  auto updateLocal = [setter](auto& sub) {
+    for (auto&& val : sub.ReadQueue()) {
+      setter(val.value);
+    }
+  };
+  auto prop = std::make_unique<
+      PropertyImpl<Topic, decltype(updateNetwork), decltype(updateLocal)>>(
+      std::move(updateNetwork), std::move(updateLocal));
   if (getter) {
     prop->pub = topic.Publish();
-    prop->updateNetwork = [=](auto& pub, int64_t time) {
-      pub.Set(getter(), time);
-    };
   }
   if (setter) {
     prop->sub = topic.Subscribe({});
-    prop->updateLocal = [=](auto& sub) {
-      for (auto&& val : sub.ReadQueue()) {
-        setter(val.value);
-      }
-    };
   }
   m_properties.emplace_back(std::move(prop));
 }
@@ -214,20 +239,22 @@ void SendableBuilderImpl::AddRawProperty(
     std::function<std::vector<uint8_t>()> getter,
     std::function<void(std::span<const uint8_t>)> setter) {
   auto topic = m_table->GetRawTopic(key);
-  auto prop = std::make_unique<PropertyImpl<nt::RawTopic>>();
+  auto updateNetwork = [getter](auto& pub, int64_t time) {
+    pub.Set(getter(), time);
+  };
+  auto updateLocal = [setter](auto& sub) {
+    for (auto&& val : sub.ReadQueue()) {
+      setter(val.value);
+    }
+  };
+  auto prop = std::make_unique<PropertyImpl<
+      nt::RawTopic, decltype(updateNetwork), decltype(updateLocal)>>(
+      std::move(updateNetwork), std::move(updateLocal));
   if (getter) {
     prop->pub = topic.Publish(typeString);
-    prop->updateNetwork = [=](auto& pub, int64_t time) {
-      pub.Set(getter(), time);
-    };
   }
   if (setter) {
     prop->sub = topic.Subscribe(typeString, {});
-    prop->updateLocal = [=](auto& sub) {
-      for (auto&& val : sub.ReadQueue()) {
-        setter(val.value);
-      }
-    };
   }
   m_properties.emplace_back(std::move(prop));
 }
@@ -236,21 +263,23 @@ template <typename T, size_t Size, typename Topic, typename Getter,
           typename Setter>
 void SendableBuilderImpl::AddSmallPropertyImpl(Topic topic, Getter getter,
                                                Setter setter) {
-  auto prop = std::make_unique<PropertyImpl<Topic>>();
+  auto updateNetwork = [getter](auto& pub, int64_t time) {
+    wpi::SmallVector<T, Size> buf;
+    pub.Set(getter(buf), time);
+  };
+  auto updateLocal = [setter](auto& sub) {
+    for (auto&& val : sub.ReadQueue()) {
+      setter(val.value);
+    }
+  };
+  auto prop = std::make_unique<
+      PropertyImpl<Topic, decltype(updateNetwork), decltype(updateLocal)>>(
+      std::move(updateNetwork), std::move(updateLocal));
   if (getter) {
     prop->pub = topic.Publish();
-    prop->updateNetwork = [=](auto& pub, int64_t time) {
-      wpi::SmallVector<T, Size> buf;
-      pub.Set(getter(buf), time);
-    };
   }
   if (setter) {
     prop->sub = topic.Subscribe({});
-    prop->updateLocal = [=](auto& sub) {
-      for (auto&& val : sub.ReadQueue()) {
-        setter(val.value);
-      }
-    };
   }
   m_properties.emplace_back(std::move(prop));
 }
@@ -314,21 +343,50 @@ void SendableBuilderImpl::AddSmallRawProperty(
         getter,
     std::function<void(std::span<const uint8_t>)> setter) {
   auto topic = m_table->GetRawTopic(key);
-  auto prop = std::make_unique<PropertyImpl<nt::RawTopic>>();
+  auto updateNetwork = [getter](auto& pub, int64_t time) {
+    wpi::SmallVector<uint8_t, 128> buf;
+    pub.Set(getter(buf), time);
+  };
+  auto updateLocal = [setter](auto& sub) {
+    for (auto&& val : sub.ReadQueue()) {
+      setter(val.value);
+    }
+  };
+  auto prop = std::make_unique<PropertyImpl<
+      nt::RawTopic, decltype(updateNetwork), decltype(updateLocal)>>(
+      std::move(updateNetwork), std::move(updateLocal));
   if (getter) {
     prop->pub = topic.Publish(typeString);
-    prop->updateNetwork = [=](auto& pub, int64_t time) {
-      wpi::SmallVector<uint8_t, 128> buf;
-      pub.Set(getter(buf), time);
-    };
   }
   if (setter) {
     prop->sub = topic.Subscribe(typeString, {});
-    prop->updateLocal = [=](auto& sub) {
-      for (auto&& val : sub.ReadQueue()) {
-        setter(val.value);
-      }
-    };
   }
   m_properties.emplace_back(std::move(prop));
 }
+
+void SendableBuilderImpl::AddPropertyTable(
+    void* obj, std::span<const wpi::SendableProperty> table) {
+  for (auto&& prop : table) {
+    if (prop.boolGetter || prop.boolSetter) {
+      AddPropertyImpl(m_table->GetBooleanTopic(prop.key),
+                      TableGetter<bool>{obj, prop.boolGetter},
+                      TableSetter<bool>{obj, prop.boolSetter});
+    } else if (prop.intGetter || prop.intSetter) {
+      AddPropertyImpl(m_table->GetIntegerTopic(prop.key),
+                      TableGetter<int64_t>{obj, prop.intGetter},
+                      TableSetter<int64_t>{obj, prop.intSetter});
+    } else if (prop.floatGetter || prop.floatSetter) {
+      AddPropertyImpl(m_table->GetFloatTopic(prop.key),
+                      TableGetter<float>{obj, prop.floatGetter},
+                      TableSetter<float>{obj, prop.floatSetter});
+    } else if (prop.doubleGetter || prop.doubleSetter) {
+      AddPropertyImpl(m_table->GetDoubleTopic(prop.key),
+                      TableGetter<double>{obj, prop.doubleGetter},
+                      TableSetter<double>{obj, prop.doubleSetter});
+    } else if (prop.stringGetter || prop.stringSetter) {
+      AddPropertyImpl(m_table->GetStringTopic(prop.key),
+                      TableGetter<std::string>{obj, prop.stringGetter},
+                      TableSetter<std::string_view>{obj, prop.stringSetter});
+    }
+  }
+}
@@ -15,6 +15,7 @@
 #include <hal/FRCUsageReporting.h>
 #include <hal/HALBase.h>
 #include <networktables/NetworkTableInstance.h>
+#include <wpi/raw_ostream.h>
 #include <wpimath/MathShared.h>
 
 #include "WPILibVersion.h"
@@ -22,6 +23,7 @@
 #include "frc/Errors.h"
 #include "frc/Notifier.h"
 #include "frc/RobotState.h"
+#include "frc/Tracer.h"
 #include "frc/livewindow/LiveWindow.h"
 #include "frc/smartdashboard/SmartDashboard.h"
 
@@ -215,31 +217,28 @@ RuntimeType RobotBase::GetRuntimeType() {
 RobotBase::RobotBase() {
   m_threadId = std::this_thread::get_id();
 
+  // Trace the startup phases so the remaining serial chain shows up in the
+  // DS console when construction is slow.
+  Tracer tracer;
+
   SetupCameraServerShared();
   SetupMathShared();
+  tracer.AddEpoch("SetupShared");
 
   auto inst = nt::NetworkTableInstance::GetDefault();
   // subscribe to "" to force persistent values to progagate to local
   nt::SubscribeMultiple(inst.GetHandle(), {{std::string_view{}}});
+  // The server finishes starting in the background; the remaining setup here
+  // is independent of it, so the wait happens last to overlap the two.
 #ifdef __FRC_ROBORIO__
   inst.StartServer("/home/lvuser/networktables.json");
 #else
   inst.StartServer();
 #endif
-
-  // wait for the NT server to actually start
-  int count = 0;
-  while ((inst.GetNetworkMode() & NT_NET_MODE_STARTING) != 0) {
-    using namespace std::chrono_literals;
-    std::this_thread::sleep_for(10ms);
-    ++count;
-    if (count > 100) {
-      fmt::print(stderr, "timed out while waiting for NT server to start\n");
-      break;
-    }
-  }
+  tracer.AddEpoch("StartNTServer");
 
   SmartDashboard::init();
+  tracer.AddEpoch("SmartDashboard::init");
 
   if (IsReal()) {
     std::FILE* file = nullptr;
@@ -250,6 +249,7 @@ RobotBase::RobotBase() {
       std::fputs(GetWPILibVersion(), file);
       std::fclose(file);
     }
+    tracer.AddEpoch("VersionFile");
   }
 
   // Call DriverStation::RefreshData() to kick things off
@@ -257,4 +257,22 @@ RobotBase::RobotBase() {
 
   // First and one-time initialization
   LiveWindow::SetEnabled(false);
+  tracer.AddEpoch("DriverStation/LiveWindow");
+
+  // wait for the NT server to actually start
+  int count = 0;
+  while ((inst.GetNetworkMode() & NT_NET_MODE_STARTING) != 0) {
+    using namespace std::chrono_literals;
+    std::this_thread::sleep_for(10ms);
+    ++count;
+    if (count > 100) {
+      fmt::print(stderr, "timed out while waiting for NT server to start\n");
+      break;
+    }
+  }
+  tracer.AddEpoch("NTServerReady");
+
+  wpi::outs() << "RobotBase startup phases:\n";
+  tracer.PrintEpochs(wpi::outs());
+  wpi::outs().flush();
 }
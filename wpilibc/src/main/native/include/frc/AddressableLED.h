@@ -4,8 +4,12 @@
 
 #pragma once
 
+#include <stdint.h>
+
+#include <array>
 #include <initializer_list>
 #include <span>
+#include <vector>
 
 #include <hal/AddressableLEDTypes.h>
 #include <hal/Types.h>
@@ -119,6 +123,58 @@ class AddressableLED {
    */
   void SetData(std::initializer_list<LEDData> ledData);
 
+  /**
+   * Order in which each pixel's channels are sent on the wire, for strips
+   * whose physical ordering differs from RGB.
+   */
+  enum class ColorOrder { kRGB, kRBG, kGRB, kGBR, kBRG, kBGR };
+
+  /**
+   * Sets the color order applied to pixels written through Commit().
+   * Defaults to kRGB (no reordering).
+   *
+   * @param order the strip's physical color order
+   */
+  void SetColorOrder(ColorOrder order);
+
+  /**
+   * Sets the gamma applied to pixels written through Commit().
+   *
+   * The correction is precomputed into a 256-entry lookup table, so it costs
+   * one table probe per channel during the commit copy.  A gamma of 1.0
+   * (the default) disables the table entirely.
+   *
+   * @param gamma gamma exponent (typically 2.2-2.8 for WS2812s)
+   */
+  void SetGamma(double gamma);
+
+  /**
+   * Returns the internal write buffer, sized by SetLength().
+   *
+   * Write pixels in place (e.g. each animation frame updates only the pixels
+   * that changed), then call Commit() to send them.  Unlike SetData(), no
+   * user-side staging copy is needed and gamma/color-order conversion happens
+   * once, during the single copy to the driver.
+   */
+  std::span<LEDData> GetWriteBuffer();
+
+  /**
+   * Converts the entire write buffer (gamma and color order applied from the
+   * precomputed tables) and writes it to the driver.
+   */
+  void Commit();
+
+  /**
+   * Converts only the given dirty range of the write buffer and writes the
+   * buffer to the driver.  Pixels outside the range keep their previously
+   * converted values, so animations touching a few pixels per frame don't pay
+   * for reconverting the whole strip.
+   *
+   * @param start  index of the first modified pixel
+   * @param length number of modified pixels
+   */
+  void Commit(int start, int length);
+
   /**
    * Sets the bit timing.
    *
@@ -157,8 +213,19 @@ class AddressableLED {
   void Stop();
 
  private:
+  void ConvertRange(int start, int length);
+
   hal::Handle<HAL_DigitalHandle> m_pwmHandle;
   hal::Handle<HAL_AddressableLEDHandle> m_handle;
   int m_port;
+
+  // Write buffer the user mutates in place and its converted shadow; Commit()
+  // converts the dirty range from one to the other and hands the shadow to
+  // the driver in a single write.
+  std::vector<LEDData> m_buffer;
+  std::vector<LEDData> m_converted;
+  std::array<uint8_t, 256> m_gammaLUT;
+  bool m_gammaEnabled = false;
+  ColorOrder m_colorOrder = ColorOrder::kRGB;
 };
 }  // namespace frc
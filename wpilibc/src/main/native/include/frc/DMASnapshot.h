@@ -0,0 +1,122 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <units/time.h>
+
+#include "frc/DMA.h"
+#include "frc/DMASample.h"
+
+namespace frc {
+class Encoder;
+class Counter;
+
+/**
+ * Captures a coherent snapshot of multiple encoder and counter values with a
+ * single timestamp using the FPGA DMA engine.
+ *
+ * Reading N sensors through their individual Get() calls costs N separate
+ * FPGA round trips, and each value is latched at a slightly different time.
+ * The DMA engine instead latches every added sensor in one FPGA transaction,
+ * so all values in a snapshot are from the same instant and reading them back
+ * is a memory access rather than an FPGA read.
+ *
+ * Add the sensors to capture, then call Start().  Each call to Update()
+ * drains the DMA queue and retains the most recent sample; the accessors then
+ * read out of that sample with no further FPGA round trips.  Typical use is
+ * one Update() at the top of each control loop iteration followed by the
+ * per-sensor accessors (e.g. for odometry).
+ */
+class DMASnapshot {
+ public:
+  /**
+   * Constructs a snapshot reader.
+   *
+   * @param period how often the FPGA captures a sample; should be at most the
+   *               period of the loop calling Update()
+   */
+  explicit DMASnapshot(units::second_t period = units::millisecond_t{1});
+
+  /**
+   * Adds an encoder count to the snapshot.  Must be called before Start().
+   */
+  void AddEncoder(const Encoder* encoder);
+
+  /**
+   * Adds an encoder period to the snapshot.  Must be called before Start().
+   */
+  void AddEncoderPeriod(const Encoder* encoder);
+
+  /**
+   * Adds a counter count to the snapshot.  Must be called before Start().
+   */
+  void AddCounter(const Counter* counter);
+
+  /**
+   * Adds a counter period to the snapshot.  Must be called before Start().
+   */
+  void AddCounterPeriod(const Counter* counter);
+
+  /**
+   * Starts periodic captures.
+   */
+  void Start();
+
+  /**
+   * Stops captures.
+   */
+  void Stop();
+
+  /**
+   * Drains the DMA queue, retaining the most recent capture.
+   *
+   * @return true if at least one new sample was captured since the last call
+   */
+  bool Update();
+
+  /**
+   * Returns the FPGA timestamp of the retained sample; all accessor values
+   * were latched at this time.
+   */
+  units::second_t GetTimestamp() const { return m_sample.GetTimeStamp(); }
+
+  /**
+   * Returns the raw encoder count from the retained sample.
+   */
+  int32_t GetEncoderRaw(const Encoder* encoder) const;
+
+  /**
+   * Returns the scaled encoder distance from the retained sample.
+   */
+  double GetEncoderDistance(const Encoder* encoder) const;
+
+  /**
+   * Returns the raw encoder period from the retained sample.
+   */
+  int32_t GetEncoderPeriodRaw(const Encoder* encoder) const;
+
+  /**
+   * Returns the counter count from the retained sample.
+   */
+  int32_t GetCounter(const Counter* counter) const;
+
+  /**
+   * Returns the counter period from the retained sample.
+   */
+  int32_t GetCounterPeriod(const Counter* counter) const;
+
+  /**
+   * Returns the retained sample for direct access to other captured values.
+   */
+  const DMASample& GetSample() const { return m_sample; }
+
+ private:
+  DMA m_dma;
+  DMASample m_sample;
+  units::second_t m_period;
+};
+}  // namespace frc
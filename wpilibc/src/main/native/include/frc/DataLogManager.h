@@ -7,9 +7,7 @@
 #include <string>
 #include <string_view>
 
-namespace wpi::log {
-class DataLog;
-}  // namespace wpi::log
+#include <wpi/DataLog.h>
 
 namespace frc {
 
@@ -72,6 +70,27 @@ class DataLogManager final {
    */
   static std::string GetLogDir();
 
+  /**
+   * Start a channel group on the managed log. A channel group logs a whole
+   * struct of related signals (e.g. one subsystem's state) as a single packed
+   * record per append instead of one record per signal; the field layout is
+   * published once in the entry's start-record metadata. Starts the data log
+   * manager if not already started.
+   *
+   * @param name entry name (e.g. "/drive/state")
+   * @param typeString type name recorded in the entry's start record (e.g.
+   *                   "struct:DriveState")
+   * @param schema field-layout schema built with
+   *               wpi::log::StructSchemaBuilder
+   * @return struct log entry on the managed log
+   */
+  template <typename T>
+  static wpi::log::StructLogEntry<T> StartChannelGroup(
+      std::string_view name, std::string_view typeString,
+      std::string_view schema) {
+    return wpi::log::StructLogEntry<T>{GetLog(), name, typeString, schema};
+  }
+
   /**
    * Enable or disable logging of NetworkTables data. Note that unlike the
    * network interface for NetworkTables, this will capture every value change.
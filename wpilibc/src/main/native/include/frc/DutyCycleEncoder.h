@@ -4,11 +4,13 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 
 #include <hal/SimDevice.h>
 #include <hal/Types.h>
 #include <units/angle.h>
+#include <units/time.h>
 #include <wpi/sendable/Sendable.h>
 #include <wpi/sendable/SendableHelper.h>
 
@@ -18,6 +20,7 @@
 namespace frc {
 class DutyCycle;
 class DigitalSource;
+class Notifier;
 
 /**
  * Class for supporting duty cycle/PWM encoders, such as the US Digital MA3 with
@@ -76,10 +79,10 @@ class DutyCycleEncoder : public wpi::Sendable,
    */
   explicit DutyCycleEncoder(std::shared_ptr<DigitalSource> digitalSource);
 
-  ~DutyCycleEncoder() override = default;
+  ~DutyCycleEncoder() override;
 
-  DutyCycleEncoder(DutyCycleEncoder&&) = default;
-  DutyCycleEncoder& operator=(DutyCycleEncoder&&) = default;
+  DutyCycleEncoder(DutyCycleEncoder&&);
+  DutyCycleEncoder& operator=(DutyCycleEncoder&&);
 
   /**
    * Get the frequency in Hz of the duty cycle signal from the encoder.
@@ -121,6 +124,29 @@ class DutyCycleEncoder : public wpi::Sendable,
    */
   units::turn_t Get() const;
 
+  /**
+   * Start refreshing the position from a shared timer thread at the given
+   * period.
+   *
+   * Rollovers are always accumulated by the FPGA counter, but each Get()
+   * normally has to retry duty cycle and counter reads until it sees a
+   * consistent pair.  With periodic refresh enabled, that consistency loop
+   * runs on the timer thread instead and Get() returns the latest refreshed
+   * position with a single atomic load, so reads are cheap and their cost
+   * doesn't depend on the caller's poll rate.
+   *
+   * Configuration (offset, duty cycle range, reset) should be done before
+   * starting the refresh.
+   *
+   * @param period period between position refreshes
+   */
+  void StartPeriodicRefresh(units::second_t period);
+
+  /**
+   * Stop the periodic refresh; Get() reads the hardware directly again.
+   */
+  void StopPeriodicRefresh();
+
   /**
    * Get the absolute position of the duty cycle encoder encoder.
    *
@@ -217,10 +243,14 @@ class DutyCycleEncoder : public wpi::Sendable,
  private:
   void Init();
   double MapSensorRange(double pos) const;
+  units::turn_t ReadPosition() const;
 
   std::shared_ptr<DutyCycle> m_dutyCycle;
   std::unique_ptr<AnalogTrigger> m_analogTrigger;
   std::unique_ptr<Counter> m_counter;
+  std::unique_ptr<Notifier> m_refreshNotifier;
+  mutable std::atomic<double> m_cachedPosition{0.0};
+  std::atomic<bool> m_refreshActive{false};
   int m_frequencyThreshold = 100;
   double m_positionOffset = 0;
   double m_distancePerRotation = 1.0;
@@ -110,6 +110,31 @@ class GenericHID {
    */
   double GetRawAxis(int axis) const;
 
+  /**
+   * Constructs an event instance that is active when the axis value is less
+   * than threshold
+   *
+   * @param axis The axis to read, starting at 0
+   * @param threshold The value below which this event should return true.
+   * @param loop the event loop instance to attach the event to.
+   * @return an event instance that is active when the axis value is less than
+   * the provided threshold.
+   */
+  BooleanEvent AxisLessThan(int axis, double threshold, EventLoop* loop) const;
+
+  /**
+   * Constructs an event instance that is active when the axis value is greater
+   * than threshold
+   *
+   * @param axis The axis to read, starting at 0
+   * @param threshold The value above which this event should return true.
+   * @param loop the event loop instance to attach the event to.
+   * @return an event instance that is active when the axis value is greater
+   * than the provided threshold.
+   */
+  BooleanEvent AxisGreaterThan(int axis, double threshold,
+                               EventLoop* loop) const;
+
   /**
    * Get the angle in degrees of a POV on the HID.
    *
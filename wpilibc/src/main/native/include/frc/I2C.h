@@ -6,6 +6,10 @@
 
 #include <stdint.h>
 
+#include <functional>
+#include <memory>
+#include <span>
+
 #include <hal/I2CTypes.h>
 
 namespace frc {
@@ -57,6 +61,50 @@ class I2C {
   bool Transaction(uint8_t* dataToSend, int sendSize, uint8_t* dataReceived,
                    int receiveSize);
 
+  /**
+   * Generic asynchronous transaction.
+   *
+   * The transaction is executed on a shared I2C bus thread, so the calling
+   * thread doesn't block for the bus round trip and sensor I/O can overlap
+   * with control computation.  The completion callback is invoked on the bus
+   * thread and must not block.  This object must remain alive until the
+   * callback has run.
+   *
+   * @param dataToSend  Data to send as part of the transaction.
+   * @param receiveSize Number of bytes to read from the device.
+   * @param onComplete  Called on the bus thread with the abort flag (false
+   *                    for success, true for aborted) and the received data.
+   */
+  void TransactionAsync(
+      std::span<const uint8_t> dataToSend, int receiveSize,
+      std::function<void(bool aborted, std::span<const uint8_t> dataReceived)>
+          onComplete);
+
+  /**
+   * Starts an asynchronous register read into an internal double buffer.
+   *
+   * The read executes on the shared I2C bus thread; poll for the result with
+   * GetAsyncReadResult().  Intended for the common poll-a-sensor case where a
+   * completion callback is overkill: request the next read at the top of the
+   * loop and consume the previous result immediately.
+   *
+   * @param registerAddress The register to read first in the transaction.
+   * @param count           The number of bytes to read in the transaction.
+   */
+  void RequestReadAsync(int registerAddress, int count);
+
+  /**
+   * Gets the most recently completed asynchronous read.
+   *
+   * Never blocks on the bus; the buffer swap with the bus thread is O(1).
+   *
+   * @param buffer Buffer to copy the received data into; at most
+   *               buffer.size() bytes are copied.
+   * @return true if a completed read was available, false if no asynchronous
+   * read has completed yet.
+   */
+  bool GetAsyncReadResult(std::span<uint8_t> buffer);
+
   /**
    * Attempt to address a device on the I2C bus.
    *
@@ -139,8 +187,11 @@ class I2C {
   bool VerifySensor(int registerAddress, int count, const uint8_t* expected);
 
  private:
+  struct AsyncReadState;
+
   hal::I2CPort m_port;
   int m_deviceAddress;
+  std::shared_ptr<AsyncReadState> m_asyncRead;
 };
 
 }  // namespace frc
@@ -4,7 +4,15 @@
 
 #pragma once
 
+#include <stdint.h>
+
+#include <array>
+#include <optional>
+#include <string_view>
+#include <vector>
+
 #include <units/time.h>
+#include <wpi/DataLog.h>
 
 #include "frc/RobotBase.h"
 #include "frc/Watchdog.h"
@@ -201,6 +209,62 @@ class IterativeRobotBase : public RobotBase {
    */
   void SetNetworkTablesFlushEnabled(bool enabled);
 
+  /// Number of power-of-two histogram buckets in PhaseTiming; bucket i counts
+  /// phase durations in [2^i, 2^(i+1)) microseconds, with longer durations
+  /// clamped into the last bucket.
+  static constexpr size_t kNumPhaseBuckets = 20;
+
+  /**
+   * Timing statistics for one phase of the main loop, accumulated over every
+   * iteration since program start (not just overruns).
+   */
+  struct PhaseTiming {
+    /// Phase name (e.g. "RobotPeriodic").
+    std::string_view phase;
+    /// Number of loop iterations recorded.
+    uint64_t count = 0;
+    /// Shortest recorded duration.
+    units::second_t min = 0_s;
+    /// Longest recorded duration.
+    units::second_t max = 0_s;
+    /// Sum of all recorded durations.
+    units::second_t total = 0_s;
+    /// Power-of-two microsecond duration histogram.
+    std::array<uint64_t, kNumPhaseBuckets> histogram{};
+  };
+
+  /**
+   * Returns per-phase loop timing statistics, one entry per phase (mode
+   * periodic, RobotPeriodic, SmartDashboard, LiveWindow, Shuffleboard).
+   *
+   * The statistics are updated by the main loop; call this from the main
+   * robot thread.
+   */
+  std::vector<PhaseTiming> GetPhaseTimings() const;
+
+  /**
+   * Durations of one loop iteration's phases, in microseconds, as logged by
+   * StartPhaseDataLog().
+   */
+  struct LoopPhaseDurations {
+    uint32_t modePeriodicUs;
+    uint32_t robotPeriodicUs;
+    uint32_t smartDashboardUs;
+    uint32_t liveWindowUs;
+    uint32_t shuffleboardUs;
+  };
+
+  /**
+   * Starts logging loop phase durations to a data log.  Each loop iteration
+   * appends a single packed LoopPhaseDurations record, so every iteration's
+   * phase breakdown (not just overruns) is queryable post-match.
+   *
+   * @param log  data log
+   * @param name entry name
+   */
+  void StartPhaseDataLog(wpi::log::DataLog& log,
+                         std::string_view name = "loopPhases");
+
   /**
    * Gets time period between calls to Periodic() functions.
    */
@@ -224,10 +288,33 @@ class IterativeRobotBase : public RobotBase {
  private:
   enum class Mode { kNone, kDisabled, kAutonomous, kTeleop, kTest };
 
+  enum class Phase {
+    kModePeriodic,
+    kRobotPeriodic,
+    kSmartDashboard,
+    kLiveWindow,
+    kShuffleboard
+  };
+  static constexpr size_t kNumPhases = 5;
+
+  // Accumulated min/max/total and power-of-two microsecond histogram for one
+  // phase; cheap enough to update unconditionally every iteration.
+  struct PhaseStats {
+    uint64_t count = 0;
+    uint64_t minUs = 0;
+    uint64_t maxUs = 0;
+    uint64_t totalUs = 0;
+    std::array<uint64_t, kNumPhaseBuckets> buckets{};
+  };
+
   Mode m_lastMode = Mode::kNone;
   units::second_t m_period;
   Watchdog m_watchdog;
   bool m_ntFlushEnabled = true;
+  std::array<PhaseStats, kNumPhases> m_phaseStats;
+  std::optional<wpi::log::StructLogEntry<LoopPhaseDurations>> m_phaseLogEntry;
+
+  void RecordPhase(Phase phase, uint64_t durationUs);
 
   void PrintLoopOverrunMessage();
 };
@@ -4,10 +4,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <string>
 
 #include <units/time.h>
-#include <wpi/mutex.h>
 
 #include "frc/Timer.h"
 
@@ -34,6 +34,9 @@ class MotorSafety {
    * Feed the motor safety object.
    *
    * Resets the timer on this object that is used to do the timeouts.
+   *
+   * This is a single atomic store, so feeding from the control loop never
+   * contends with the safety check thread.
    */
   void Feed();
 
@@ -105,16 +108,14 @@ class MotorSafety {
  private:
   static constexpr auto kDefaultSafetyExpiration = 100_ms;
 
-  // The expiration time for this object
-  units::second_t m_expiration = kDefaultSafetyExpiration;
+  // The expiration time for this object, in seconds
+  std::atomic<double> m_expiration{kDefaultSafetyExpiration.value()};
 
   // True if motor safety is enabled for this motor
-  bool m_enabled = false;
-
-  // The FPGA clock value when the motor has expired
-  units::second_t m_stopTime = Timer::GetFPGATimestamp();
+  std::atomic<bool> m_enabled{false};
 
-  mutable wpi::mutex m_thisMutex;
+  // The FPGA clock value when the motor has expired, in seconds
+  std::atomic<double> m_stopTime{Timer::GetFPGATimestamp().value()};
 };
 
 }  // namespace frc
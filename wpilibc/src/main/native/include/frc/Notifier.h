@@ -19,6 +19,8 @@
 
 namespace frc {
 
+class NotifierPool;
+
 /**
  * Notifiers run a callback function on a separate thread at a specified period.
  *
@@ -64,6 +66,39 @@ class Notifier {
                  std::bind(std::forward<Callable>(f), std::forward<Arg>(arg),
                            std::forward<Args>(args)...)) {}
 
+  /**
+   * Create a Notifier that runs its handler on the shared notifier pool
+   * instead of a dedicated thread.
+   *
+   * All pooled Notifiers share one alarm-dispatcher thread and a small worker
+   * pool, so each additional pooled Notifier costs a scheduling entry rather
+   * than a full thread stack.  SetHandler(), StartSingle(), StartPeriodic(),
+   * and Stop() behave as for a dedicated-thread Notifier.  Handlers that
+   * block can delay other pooled handlers; use a dedicated-thread Notifier
+   * for those.
+   *
+   * @param handler The handler is called at the notification time which is
+   *                set using StartSingle or StartPeriodic.
+   */
+  static Notifier Pooled(std::function<void()> handler);
+
+  /**
+   * Create a Notifier that runs its handler on the shared notifier pool
+   * instead of a dedicated thread.
+   *
+   * The pool workers run at the highest real-time priority requested by any
+   * pooled Notifier, so a high-priority handler is never stuck behind workers
+   * scheduled below it.
+   *
+   * @param priority The FIFO real-time scheduler priority ([1..99] where a
+   *                 higher number represents higher priority) the pool workers
+   *                 should run at or above. See "man 7 sched" for more
+   *                 details.
+   * @param handler  The handler is called at the notification time which is
+   *                 set using StartSingle or StartPeriodic.
+   */
+  static Notifier Pooled(int priority, std::function<void()> handler);
+
   /**
    * Free the resources for a timer event.
    */
@@ -139,6 +174,12 @@ class Notifier {
   static bool SetHALThreadPriority(bool realTime, int32_t priority);
 
  private:
+  friend class NotifierPool;
+
+  // Used by Pooled(); pooled notifiers have no thread or HAL handle of their
+  // own
+  Notifier() = default;
+
   /**
    * Update the HAL alarm time.
    *
@@ -171,6 +212,9 @@ class Notifier {
 
   // True if this is a periodic event
   bool m_periodic = false;
+
+  // True if this notifier is scheduled by the shared pool
+  bool m_pooled = false;
 };
 
 }  // namespace frc
@@ -0,0 +1,108 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+#include <functional>
+
+#include <units/time.h>
+
+#include "frc/Notifier.h"
+#include "frc/geometry/Pose2d.h"
+
+namespace frc {
+
+/**
+ * Runs odometry updates on a dedicated real-time Notifier thread and
+ * publishes the latest pose through a seqlock.
+ *
+ * The update callback runs at the configured period on the Notifier thread;
+ * it should sample the drive sensors (ideally through a DMASnapshot for a
+ * coherent set), feed them to a SwerveDriveOdometry or
+ * DifferentialDriveOdometry, and return the updated pose:
+ *
+ * @code
+ * frc::OdometryRunner runner{[&] {
+ *   snapshot.Update();
+ *   return odometry.Update(gyro.GetRotation2d(),
+ *                          {snapshot.GetEncoderDistance(&leftEncoder)},
+ *                          {snapshot.GetEncoderDistance(&rightEncoder)});
+ * }, 4_ms};
+ * runner.Start();
+ * @endcode
+ *
+ * GetPose() may then be called from any thread.  It never blocks the odometry
+ * tick and never observes a torn pose: the pose is published under a sequence
+ * counter and the read is retried on the rare occasion it overlaps a write,
+ * so reads cost a few loads rather than a mutex acquisition.
+ */
+class OdometryRunner {
+ public:
+  /** A published pose and the time at which it was computed. */
+  struct PoseSample {
+    /** The pose at the time of the odometry update. */
+    Pose2d pose;
+
+    /** FPGA timestamp of the odometry update. */
+    units::second_t timestamp{0};
+  };
+
+  /**
+   * Constructs an OdometryRunner.
+   *
+   * @param update   Callback run each period on the odometry thread; samples
+   *                 the sensors, updates the odometry, and returns the new
+   *                 pose.
+   * @param period   The update period.
+   * @param priority The FIFO real-time priority of the odometry thread
+   *                 ([1..99] where a higher number represents higher
+   *                 priority).  See "man 7 sched" for more details.
+   */
+  explicit OdometryRunner(std::function<Pose2d()> update,
+                          units::second_t period = units::millisecond_t{4},
+                          int priority = 15);
+
+  ~OdometryRunner();
+
+  OdometryRunner(OdometryRunner&&) = delete;
+  OdometryRunner& operator=(OdometryRunner&&) = delete;
+
+  /**
+   * Starts periodic odometry updates.
+   */
+  void Start();
+
+  /**
+   * Stops odometry updates.
+   */
+  void Stop();
+
+  /**
+   * Returns the most recently published pose and its timestamp.
+   *
+   * Safe to call from any thread; never blocks the odometry thread.
+   */
+  PoseSample GetPose() const;
+
+ private:
+  void Tick();
+
+  std::function<Pose2d()> m_update;
+  Notifier m_notifier;
+  units::second_t m_period;
+
+  // latest pose, published seqlock-style: m_seq is bumped to odd before the
+  // fields are written and to even after, so a reader that observes a stable
+  // even sequence around its loads got a coherent sample
+  std::atomic<uint32_t> m_seq{0};
+  std::atomic<double> m_x{0.0};
+  std::atomic<double> m_y{0.0};
+  std::atomic<double> m_theta{0.0};
+  std::atomic<double> m_timestamp{0.0};
+};
+
+}  // namespace frc
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include <hal/Types.h>
 #include <wpi/sendable/Sendable.h>
 #include <wpi/sendable/SendableHelper.h>
@@ -62,6 +64,16 @@ class PowerDistribution : public wpi::Sendable,
    */
   double GetCurrent(int channel) const;
 
+  /**
+   * Query all currents of the PDP/PDH.
+   *
+   * Reads every channel from the device's bulk status frames, so sampling
+   * full power telemetry costs one call instead of one per channel.
+   *
+   * @return The currents of each channel in Amperes
+   */
+  std::vector<double> GetAllCurrents() const;
+
   /**
    * Query the total current of all monitored PDP/PDH channels.
    *
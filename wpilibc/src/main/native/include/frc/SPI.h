@@ -6,6 +6,7 @@
 
 #include <stdint.h>
 
+#include <functional>
 #include <memory>
 #include <span>
 
@@ -172,6 +173,25 @@ class SPI {
    */
   virtual int Transaction(uint8_t* dataToSend, uint8_t* dataReceived, int size);
 
+  /**
+   * Perform an asynchronous simultaneous read/write transaction with the
+   * device.
+   *
+   * The transaction is executed on a shared SPI bus thread, so the calling
+   * thread doesn't block for the bus round trip and sensor I/O can overlap
+   * with control computation.  The completion callback is invoked on the bus
+   * thread and must not block.  This object must remain alive until the
+   * callback has run.
+   *
+   * @param dataToSend The data to be written out to the device
+   * @param onComplete Called on the bus thread with the number of bytes
+   *                   transferred (-1 on error) and the received data
+   */
+  void TransactionAsync(
+      std::span<const uint8_t> dataToSend,
+      std::function<void(int count, std::span<const uint8_t> dataReceived)>
+          onComplete);
+
   /**
    * Initialize automatic SPI transfer engine.
    *
@@ -4,7 +4,12 @@
 
 #pragma once
 
+#include <stdint.h>
+
+#include <string>
+#include <string_view>
 #include <thread>
+#include <vector>
 
 namespace frc {
 
@@ -54,4 +59,31 @@ bool SetThreadPriority(std::thread& thread, bool realTime, int priority);
  */
 bool SetCurrentThreadPriority(bool realTime, int priority);
 
+/**
+ * Sets the scheduling policy for library-created threads (NT networking,
+ * DataLog writer, etc.) whose registered name matches the given pattern.
+ * '*' in the pattern matches any sequence of characters.  The pattern is
+ * remembered, so threads started later that match also get the policy.
+ *
+ * @param pattern      thread name pattern (e.g. "NT*")
+ * @param realTime     Set to true to set a real-time priority, false for
+ *                     standard priority.
+ * @param priority     Priority to set the threads to. For real-time, this is
+ *                     1-99 with 99 being highest. For non-real-time, this is
+ *                     forced to 0. See "man 7 sched" for more details.
+ * @param affinityMask CPU affinity mask; bit N allows the threads to run on
+ *                     core N. 0 leaves affinity unchanged.
+ * @return             True if the policy was applied to all currently
+ *                     matching threads.
+ */
+bool SetLibraryThreadPolicy(std::string_view pattern, bool realTime,
+                            int priority, uint64_t affinityMask = 0);
+
+/**
+ * Returns the names of all registered library threads.
+ *
+ * @return thread names
+ */
+std::vector<std::string> GetLibraryThreadNames();
+
 }  // namespace frc
@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -57,7 +59,10 @@ class TimedRobot : public IterativeRobotBase {
    * Add a callback to run at a specific period with a starting time offset.
    *
    * This is scheduled on TimedRobot's Notifier, so TimedRobot and the callback
-   * run synchronously. Interactions between them are thread-safe.
+   * run synchronously. Interactions between them are thread-safe.  When
+   * several callbacks are due at once, shorter-period callbacks run first;
+   * callbacks that need deadlines fully independent of other callbacks should
+   * run on their own thread via frc::Notifier instead.
    *
    * @param callback The callback to run.
    * @param period   The period at which to run the callback.
@@ -68,12 +73,35 @@ class TimedRobot : public IterativeRobotBase {
   void AddPeriodic(std::function<void()> callback, units::second_t period,
                    units::second_t offset = 0_s);
 
+  /**
+   * Scheduling statistics for one periodic callback.  The main loop itself is
+   * the first entry; AddPeriodic() callbacks follow in registration order.
+   */
+  struct PeriodicStats {
+    /// The callback's period.
+    units::second_t period = 0_s;
+    /// Number of runs that took longer than the period.
+    uint64_t overrunCount = 0;
+    /// Number of scheduled runs skipped to get back on schedule after the
+    /// loop fell behind.
+    uint64_t skippedRuns = 0;
+  };
+
+  /**
+   * Returns scheduling statistics for the main loop and all AddPeriodic()
+   * callbacks.
+   *
+   * @return per-callback statistics, in registration order
+   */
+  std::vector<PeriodicStats> GetPeriodicStats() const;
+
  private:
   class Callback {
    public:
     std::function<void()> func;
     units::second_t period;
     units::second_t expirationTime;
+    std::shared_ptr<PeriodicStats> stats;
 
     /**
      * Construct a callback container.
@@ -82,19 +110,27 @@ class TimedRobot : public IterativeRobotBase {
      * @param startTime The common starting point for all callback scheduling.
      * @param period    The period at which to run the callback.
      * @param offset    The offset from the common starting time.
+     * @param stats     Shared statistics storage for the callback.
      */
     Callback(std::function<void()> func, units::second_t startTime,
-             units::second_t period, units::second_t offset)
+             units::second_t period, units::second_t offset,
+             std::shared_ptr<PeriodicStats> stats)
         : func{std::move(func)},
           period{period},
           expirationTime{startTime + offset +
                          units::math::floor(
                              (Timer::GetFPGATimestamp() - startTime) / period) *
                              period +
-                         period} {}
+                         period},
+          stats{std::move(stats)} {}
 
     bool operator>(const Callback& rhs) const {
-      return expirationTime > rhs.expirationTime;
+      // Among callbacks due at the same time, run the shorter-period
+      // (tighter-deadline) callback first.
+      if (expirationTime != rhs.expirationTime) {
+        return expirationTime > rhs.expirationTime;
+      }
+      return period > rhs.period;
     }
   };
 
@@ -103,6 +139,10 @@ class TimedRobot : public IterativeRobotBase {
 
   wpi::priority_queue<Callback, std::vector<Callback>, std::greater<Callback>>
       m_callbacks;
+
+  std::vector<std::shared_ptr<PeriodicStats>> m_periodicStats;
+
+  void RunCallback(Callback& callback);
 };
 
 }  // namespace frc
@@ -5,9 +5,12 @@
 #pragma once
 
 #include <chrono>
+#include <string>
 #include <string_view>
+#include <vector>
 
 #include <hal/cpp/fpga_clock.h>
+#include <wpi/DataLog.h>
 #include <wpi/StringMap.h>
 
 namespace wpi {
@@ -62,12 +65,34 @@ class Tracer {
    */
   void PrintEpochs(wpi::raw_ostream& os);
 
+  /**
+   * Starts logging epoch durations to a data log.  Each label gets its own
+   * double entry named "<prefix>/<label>" (in seconds), appended on every
+   * AddEpoch() call, so per-section timing is queryable post-match.
+   *
+   * @param log    data log
+   * @param prefix entry name prefix
+   */
+  void StartDataLog(wpi::log::DataLog& log, std::string_view prefix);
+
  private:
   static constexpr std::chrono::milliseconds kMinPrintPeriod{1000};
 
   hal::fpga_clock::time_point m_startTime;
   hal::fpga_clock::time_point m_lastEpochsPrintTime = hal::fpga_clock::epoch();
 
-  wpi::StringMap<std::chrono::nanoseconds> m_epochs;
+  // Epochs are interned: the first AddEpoch() for a label allocates a slot
+  // (and its log entry, if logging); later calls are a map probe plus an
+  // indexed store, and ClearEpochs() just resets the slots.
+  struct Epoch {
+    std::string name;
+    std::chrono::nanoseconds duration{0};
+    bool set = false;
+    wpi::log::DoubleLogEntry logEntry;
+  };
+  wpi::StringMap<size_t> m_labelIndex;
+  std::vector<Epoch> m_epochs;
+  wpi::log::DataLog* m_dataLog = nullptr;
+  std::string m_dataLogPrefix;
 };
 }  // namespace frc
@@ -5,8 +5,8 @@
 #pragma once
 
 #include <atomic>
+#include <functional>
 #include <memory>
-#include <thread>
 #include <vector>
 
 #include <hal/SimDevice.h>
@@ -20,6 +20,7 @@
 
 namespace frc {
 
+class AsynchronousInterrupt;
 class DigitalInput;
 class DigitalOutput;
 
@@ -87,8 +88,8 @@ class Ultrasonic : public wpi::Sendable,
 
   ~Ultrasonic() override;
 
-  Ultrasonic(Ultrasonic&&) = default;
-  Ultrasonic& operator=(Ultrasonic&&) = default;
+  Ultrasonic(Ultrasonic&&);
+  Ultrasonic& operator=(Ultrasonic&&);
 
   int GetEchoChannel() const;
 
@@ -114,8 +115,11 @@ class Ultrasonic : public wpi::Sendable,
   /**
    * Turn Automatic mode on/off.
    *
-   * When in Automatic mode, all sensors will fire in round robin, waiting a set
-   * time between each sensor.
+   * When in Automatic mode, all sensors fire in an interleaved round robin:
+   * each sensor's echo interrupt triggers the next sensor's ping after the
+   * minimum safe spacing (see SetPingSpacing()), so the data rate tracks
+   * actual echo return times instead of a fixed per-sensor wait, and no
+   * polling thread is needed.
    *
    * @param enabling Set to true if round robin scheduling should start for all
    *                 the ultrasonic sensors. This scheduling method assures that
@@ -126,6 +130,28 @@ class Ultrasonic : public wpi::Sendable,
    */
   static void SetAutomaticMode(bool enabling);
 
+  /**
+   * Sets the minimum quiet time between one sensor's echo and the next
+   * sensor's ping in automatic mode, so residual echoes can't be mistaken for
+   * the next sensor's return.  Defaults to 10 ms (suitable for the SRF04).
+   *
+   * @param spacing minimum time between an echo and the next ping
+   */
+  static void SetPingSpacing(units::second_t spacing);
+
+  /**
+   * Sets a callback invoked each time this sensor completes a range
+   * measurement in automatic mode.
+   *
+   * The callback runs on the echo interrupt's thread with the FPGA timestamp
+   * of the echo's falling edge and the measured range; it must not block.
+   *
+   * @param callback the callback, or nullptr to remove an existing callback
+   */
+  void SetRangeCallback(
+      std::function<void(units::second_t timestamp, units::meter_t range)>
+          callback);
+
   /**
    * Get the range from the ultrasonic sensor.
    *
@@ -153,16 +179,18 @@ class Ultrasonic : public wpi::Sendable,
   void Initialize();
 
   /**
-   * Background task that goes through the list of ultrasonic sensors and pings
-   * each one in turn. The counter is configured to read the timing of the
-   * returned echo pulse.
-   *
-   * DANGER WILL ROBINSON, DANGER WILL ROBINSON:
-   * This code runs as a task and assumes that none of the ultrasonic sensors
-   * will change while it's running. Make sure to disable automatic mode before
-   * touching the list.
+   * Handles this sensor's echo interrupt in automatic mode: reports the
+   * measurement and schedules the next sensor's ping after the minimum safe
+   * spacing.
+   */
+  void HandleEcho(bool risingEdge, bool fallingEdge);
+
+  /**
+   * Pings the next enabled sensor in the round robin.  Runs from the
+   * scheduler notifier, either after the previous echo (plus spacing) or on
+   * timeout if the echo never returned.
    */
-  static void UltrasonicChecker();
+  static void PingNext();
 
   // Time (usec) for the ping trigger pulse.
   static constexpr auto kPingTime = 10_us;
@@ -171,8 +199,9 @@ class Ultrasonic : public wpi::Sendable,
   static constexpr auto kMaxUltrasonicTime = 0.1_s;
   static constexpr auto kSpeedOfSound = 1130_fps;
 
-  // Thread doing the round-robin automatic sensing
-  static std::thread m_thread;
+  // Minimum quiet time between an echo and the next ping
+  static constexpr auto kDefaultPingSpacing = 10_ms;
+  static units::second_t m_pingSpacing;
 
   // Ultrasonic sensors
   static std::vector<Ultrasonic*> m_sensors;
@@ -184,6 +213,8 @@ class Ultrasonic : public wpi::Sendable,
   std::shared_ptr<DigitalInput> m_echoChannel;
   bool m_enabled = false;
   Counter m_counter;
+  std::unique_ptr<AsynchronousInterrupt> m_interrupt;
+  std::function<void(units::second_t, units::meter_t)> m_rangeCallback;
 
   hal::SimDevice m_simDevice;
   hal::SimBoolean m_simRangeValid;
@@ -110,6 +110,17 @@ class Watchdog {
    */
   void SuppressTimeoutMessage(bool suppress);
 
+  /**
+   * Starts logging watchdog activity to a data log.  Timeouts are recorded
+   * as "<prefix>/overrun" (the timeout in seconds at expiry) and epoch
+   * durations as "<prefix>/epochs/<name>", so overrun forensics are
+   * queryable post-match instead of console-only.
+   *
+   * @param log    data log
+   * @param prefix entry name prefix
+   */
+  void StartDataLog(wpi::log::DataLog& log, std::string_view prefix);
+
  private:
   // Used for timeout print rate-limiting
   static constexpr auto kMinPrintPeriod = 1_s;
@@ -121,6 +132,7 @@ class Watchdog {
   units::second_t m_lastTimeoutPrintTime = 0_s;
 
   Tracer m_tracer;
+  wpi::log::DoubleLogEntry m_logOverrun;
   bool m_isExpired = false;
 
   bool m_suppressTimeoutMessage = false;
@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include <array>
 #include <optional>
+#include <span>
 #include <string_view>
 #include <unordered_map>
 #include <vector>
@@ -15,6 +17,7 @@
 #include "frc/DriverStation.h"
 #include "frc/apriltag/AprilTag.h"
 #include "frc/geometry/Pose3d.h"
+#include "frc/geometry/Transform3d.h"
 
 namespace wpi {
 class json;
@@ -78,6 +81,27 @@ class WPILIB_DLLEXPORT AprilTagFieldLayout {
    */
   std::optional<Pose3d> GetTagPose(int ID) const;
 
+  /**
+   * Gets the inverse of an AprilTag pose by its ID, as a transform mapping
+   * points in the tag's frame to the field frame inverted (precomputed, so
+   * localizers don't invert the pose per detection).
+   *
+   * @param ID The ID of the tag.
+   * @return The inverse transform corresponding to the ID that was passed in
+   * or an empty optional if a tag with that ID is not found.
+   */
+  std::optional<Transform3d> GetTagPoseInverse(int ID) const;
+
+  /**
+   * Gets AprilTag poses for multiple IDs at once (e.g. all detections from
+   * one camera frame).
+   *
+   * @param IDs The IDs of the tags.
+   * @return One pose per ID, in the same order; empty optionals for IDs that
+   * are not in the layout.
+   */
+  std::vector<std::optional<Pose3d>> GetTagPoses(std::span<const int> IDs) const;
+
   /**
    * Serializes an AprilTagFieldLayout to a JSON file.
    *
@@ -102,7 +126,22 @@ class WPILIB_DLLEXPORT AprilTagFieldLayout {
   bool operator!=(const AprilTagFieldLayout& other) const;
 
  private:
+  struct CachedTag {
+    Pose3d pose;
+    Transform3d inverse;
+  };
+
+  /**
+   * Rebuilds the ID-indexed pose caches from m_apriltags.  Called whenever
+   * the tag set changes so lookups are constant-time loads of precomputed
+   * poses (both alliance orientations) rather than per-query construction.
+   */
+  void RebuildPoseCache();
+
   std::unordered_map<int, AprilTag> m_apriltags;
+  // flat caches indexed by tag ID; [0] = as-imported (blue) poses,
+  // [1] = mirrored (red) poses
+  std::array<std::vector<std::optional<CachedTag>>, 2> m_poseCache;
   units::meter_t m_fieldLength;
   units::meter_t m_fieldWidth;
   bool m_mirror = false;
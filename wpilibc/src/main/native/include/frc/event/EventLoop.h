@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <vector>
 
@@ -39,6 +40,8 @@ class EventLoop {
   void Clear();
 
  private:
+  friend class BooleanEvent;
+
   struct Binding {
     std::function<bool()> condition;
     wpi::unique_function<void()> action;
@@ -46,5 +49,10 @@ class EventLoop {
     void Poll();
   };
   std::vector<Binding> m_bindings;
+  // Serial number of the Poll() call currently in progress, or 0 when no
+  // poll is in progress; lets BooleanEvent evaluate each condition at most
+  // once per poll no matter how many bindings share it.
+  uint64_t m_currentPoll = 0;
+  uint64_t m_pollCount = 0;
 };
 }  // namespace frc
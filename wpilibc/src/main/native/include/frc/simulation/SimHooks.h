@@ -60,4 +60,13 @@ void StepTiming(units::second_t delta);
  */
 void StepTimingAsync(units::second_t delta);
 
+/**
+ * Advance the simulator time as fast as notifier callbacks can execute,
+ * jumping directly from one alarm deadline to the next instead of stepping
+ * in fixed increments.
+ *
+ * @param delta the amount to advance (in seconds)
+ */
+void FastForwardTiming(units::second_t delta);
+
 }  // namespace frc::sim
@@ -177,22 +177,34 @@ class SendableBuilderImpl : public nt::NTSendableBuilder {
           getter,
       std::function<void(std::span<const uint8_t>)> setter) override;
 
+  void AddPropertyTable(void* obj,
+                        std::span<const wpi::SendableProperty> table) override;
+
  private:
   struct Property {
     virtual ~Property() = default;
     virtual void Update(bool controllable, int64_t time) = 0;
   };
 
-  template <typename Topic>
+  template <typename Topic, typename UpdateNetwork, typename UpdateLocal>
   struct PropertyImpl : public Property {
-    void Update(bool controllable, int64_t time) override;
+    PropertyImpl(UpdateNetwork updateNetwork, UpdateLocal updateLocal)
+        : updateNetwork{std::move(updateNetwork)},
+          updateLocal{std::move(updateLocal)} {}
+
+    void Update(bool controllable, int64_t time) final;
 
     using Publisher = typename Topic::PublisherType;
     using Subscriber = typename Topic::SubscriberType;
     Publisher pub;
     Subscriber sub;
-    std::function<void(Publisher& pub, int64_t time)> updateNetwork;
-    std::function<void(Subscriber& sub)> updateLocal;
+    // The update callables are stored with their own types rather than
+    // type-erased through std::function, so each Update() goes straight from
+    // the virtual call into the property's getter or setter.  pub/sub are
+    // only initialized when a getter/setter was provided; an invalid handle
+    // means the corresponding callable is never invoked.
+    UpdateNetwork updateNetwork;
+    UpdateLocal updateLocal;
   };
 
   template <typename Topic, typename Getter, typename Setter>
@@ -0,0 +1,59 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <vector>
+
+#include "frc/apriltag/AprilTag.h"
+#include "frc/apriltag/AprilTagFieldLayout.h"
+#include "frc/geometry/Pose3d.h"
+#include "gtest/gtest.h"
+
+using namespace frc;
+
+TEST(AprilTagPoseLookupTest, BulkLookup) {
+  auto layout = AprilTagFieldLayout{
+      std::vector<AprilTag>{
+          AprilTag{1,
+                   Pose3d{0_ft, 0_ft, 0_ft, Rotation3d{0_deg, 0_deg, 0_deg}}},
+          AprilTag{
+              3, Pose3d{4_ft, 4_ft, 4_ft, Rotation3d{0_deg, 0_deg, 180_deg}}}},
+      54_ft, 27_ft};
+
+  int ids[] = {1, 2, 3, 42};
+  auto poses = layout.GetTagPoses(ids);
+  ASSERT_EQ(4u, poses.size());
+  EXPECT_EQ(*layout.GetTagPose(1), *poses[0]);
+  EXPECT_FALSE(poses[1].has_value());
+  EXPECT_EQ(*layout.GetTagPose(3), *poses[2]);
+  EXPECT_FALSE(poses[3].has_value());
+}
+
+TEST(AprilTagPoseLookupTest, InverseRoundTrips) {
+  auto layout = AprilTagFieldLayout{
+      std::vector<AprilTag>{AprilTag{
+          2, Pose3d{4_ft, 4_ft, 4_ft, Rotation3d{0_deg, 0_deg, 180_deg}}}},
+      54_ft, 27_ft};
+
+  auto pose = *layout.GetTagPose(2);
+  auto inverse = *layout.GetTagPoseInverse(2);
+  // applying the cached inverse to the tag pose lands on the field origin
+  EXPECT_EQ(Pose3d{}, pose + inverse);
+}
+
+TEST(AprilTagPoseLookupTest, MirroredLookupMatchesCache) {
+  auto layout = AprilTagFieldLayout{
+      std::vector<AprilTag>{
+          AprilTag{1,
+                   Pose3d{0_ft, 0_ft, 0_ft, Rotation3d{0_deg, 0_deg, 0_deg}}}},
+      54_ft, 27_ft};
+
+  layout.SetAlliance(DriverStation::Alliance::kRed);
+  auto mirrorPose =
+      Pose3d{54_ft, 27_ft, 0_ft, Rotation3d{0_deg, 0_deg, 180_deg}};
+  EXPECT_EQ(mirrorPose, *layout.GetTagPose(1));
+  EXPECT_EQ(Pose3d{}, mirrorPose + *layout.GetTagPoseInverse(1));
+
+  layout.SetAlliance(DriverStation::Alliance::kBlue);
+  EXPECT_EQ(Pose3d{}, *layout.GetTagPose(1));
+}
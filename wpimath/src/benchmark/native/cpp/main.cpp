@@ -0,0 +1,344 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+// Micro-benchmarks for the wpimath hot paths: kinematics/odometry updates,
+// state observer predict-correct cycles, spline parameterization, and
+// trajectory generation. Run with no arguments for a human-readable table, or
+// with --json for a machine-readable baseline suitable for diffing between
+// releases (e.g. on a roboRIO: ./wpimathBenchmarks --json > baseline.json).
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <wpi/json.h>
+
+#include "frc/controller/PIDController.h"
+#include "frc/controller/SimpleMotorFeedforward.h"
+#include "frc/estimator/ExtendedKalmanFilter.h"
+#include "frc/estimator/KalmanFilter.h"
+#include "frc/estimator/UnscentedKalmanFilter.h"
+#include "frc/geometry/Pose2d.h"
+#include "frc/kinematics/DifferentialDriveOdometry.h"
+#include "frc/kinematics/SwerveDriveKinematics.h"
+#include "frc/kinematics/SwerveDriveOdometry.h"
+#include "frc/spline/SplineHelper.h"
+#include "frc/spline/SplineParameterizer.h"
+#include "frc/system/plant/DCMotor.h"
+#include "frc/system/plant/LinearSystemId.h"
+#include "frc/trajectory/TrajectoryGenerator.h"
+#include "units/moment_of_inertia.h"
+
+namespace {
+
+struct BenchmarkResult {
+  std::string name;
+  double nsPerIteration;
+  size_t iterations;
+};
+
+// Keeps the optimizer from discarding a benchmark's result.
+volatile double g_sink;
+
+/**
+ * Times fn by doubling the iteration count until the measurement window is at
+ * least 100 ms long, which keeps short and long benchmarks equally accurate
+ * without a per-benchmark iteration count.
+ */
+template <typename Fn>
+BenchmarkResult RunBenchmark(std::string_view name, Fn&& fn) {
+  using std::chrono::steady_clock;
+
+  // Warmup
+  g_sink = fn();
+
+  size_t iterations = 1;
+  while (true) {
+    auto start = steady_clock::now();
+    double accumulator = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+      accumulator += fn();
+    }
+    auto elapsed = steady_clock::now() - start;
+    g_sink = accumulator;
+
+    auto elapsedNs =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    if (elapsedNs >= 100'000'000 || iterations >= size_t{1} << 30) {
+      return BenchmarkResult{std::string{name},
+                             static_cast<double>(elapsedNs) / iterations,
+                             iterations};
+    }
+    iterations *= 2;
+  }
+}
+
+double BenchPose2dExp() {
+  static const frc::Pose2d pose{1_m, 2_m, 45_deg};
+  static const frc::Twist2d twist{0.5_m, 0.1_m, 5_deg};
+  auto result = pose.Exp(twist);
+  return result.X().value();
+}
+
+double BenchPose2dLog() {
+  static const frc::Pose2d start{1_m, 2_m, 45_deg};
+  static const frc::Pose2d end{1.5_m, 2.2_m, 55_deg};
+  auto twist = start.Log(end);
+  return twist.dx.value();
+}
+
+double BenchSwerveToChassisSpeeds() {
+  static const frc::SwerveDriveKinematics<4> kinematics{
+      frc::Translation2d{12_in, 12_in}, frc::Translation2d{12_in, -12_in},
+      frc::Translation2d{-12_in, 12_in}, frc::Translation2d{-12_in, -12_in}};
+  auto speeds = kinematics.ToChassisSpeeds(
+      frc::SwerveModuleState{3_mps, frc::Rotation2d{10_deg}},
+      frc::SwerveModuleState{2.5_mps, frc::Rotation2d{20_deg}},
+      frc::SwerveModuleState{3.1_mps, frc::Rotation2d{-15_deg}},
+      frc::SwerveModuleState{2.9_mps, frc::Rotation2d{5_deg}});
+  return speeds.vx.value();
+}
+
+double BenchSwerveToModuleStates() {
+  static const frc::SwerveDriveKinematics<4> kinematics{
+      frc::Translation2d{12_in, 12_in}, frc::Translation2d{12_in, -12_in},
+      frc::Translation2d{-12_in, 12_in}, frc::Translation2d{-12_in, -12_in}};
+  auto states = kinematics.ToSwerveModuleStates(
+      frc::ChassisSpeeds{2_mps, 1_mps, 0.5_rad_per_s});
+  return states[0].speed.value();
+}
+
+double BenchDifferentialDriveOdometryUpdate() {
+  static frc::DifferentialDriveOdometry odometry{frc::Rotation2d{}};
+  static double distance = 0.0;
+  distance += 0.001;
+  auto pose = odometry.Update(frc::Rotation2d{units::radian_t{distance * 0.1}},
+                              units::meter_t{distance},
+                              units::meter_t{distance * 1.01});
+  return pose.X().value();
+}
+
+double BenchSwerveDriveOdometryUpdate() {
+  static const frc::SwerveDriveKinematics<4> kinematics{
+      frc::Translation2d{12_in, 12_in}, frc::Translation2d{12_in, -12_in},
+      frc::Translation2d{-12_in, 12_in}, frc::Translation2d{-12_in, -12_in}};
+  static frc::SwerveDriveOdometry<4> odometry{
+      kinematics,
+      frc::Rotation2d{},
+      {frc::SwerveModulePosition{}, frc::SwerveModulePosition{},
+       frc::SwerveModulePosition{}, frc::SwerveModulePosition{}}};
+  static double distance = 0.0;
+  distance += 0.001;
+  frc::SwerveModulePosition position{units::meter_t{distance},
+                                     frc::Rotation2d{5_deg}};
+  auto pose =
+      odometry.Update(frc::Rotation2d{units::radian_t{distance * 0.1}},
+                      {position, position, position, position});
+  return pose.X().value();
+}
+
+double BenchKalmanFilterPredictCorrect() {
+  static auto plant = frc::LinearSystemId::ElevatorSystem(
+      frc::DCMotor::Vex775Pro(4), 8_kg, 0.75_in, 14.67);
+  static frc::KalmanFilter<2, 1, 1> observer{plant, {0.05, 1.0}, {0.0001},
+                                             5_ms};
+  frc::Vectord<1> u{4.0};
+  observer.Predict(u, 5_ms);
+  observer.Correct(u, frc::Vectord<1>{observer.Xhat(0)});
+  return observer.Xhat(0);
+}
+
+frc::Vectord<5> DrivetrainDynamics(const frc::Vectord<5>& x,
+                                   const frc::Vectord<2>& u) {
+  auto motors = frc::DCMotor::CIM(2);
+
+  constexpr double Ghigh = 7.08;       // High gear ratio
+  constexpr auto rb = 0.8382_m / 2.0;  // Robot radius
+  constexpr auto r = 0.0746125_m;      // Wheel radius
+  constexpr auto m = 63.503_kg;        // Robot mass
+  constexpr auto J = 5.6_kg_sq_m;      // Robot moment of inertia
+
+  auto C1 = -std::pow(Ghigh, 2) * motors.Kt /
+            (motors.Kv * motors.R * units::math::pow<2>(r));
+  auto C2 = Ghigh * motors.Kt / (motors.R * r);
+  auto k1 = (1 / m + units::math::pow<2>(rb) / J);
+  auto k2 = (1 / m - units::math::pow<2>(rb) / J);
+
+  units::meters_per_second_t vl{x(3)};
+  units::meters_per_second_t vr{x(4)};
+  units::volt_t Vl{u(0)};
+  units::volt_t Vr{u(1)};
+
+  auto v = 0.5 * (vl + vr);
+  return frc::Vectord<5>{
+      v.value() * std::cos(x(2)), v.value() * std::sin(x(2)),
+      ((vr - vl) / (2.0 * rb)).value(),
+      k1.value() * ((C1 * vl).value() + (C2 * Vl).value()) +
+          k2.value() * ((C1 * vr).value() + (C2 * Vr).value()),
+      k2.value() * ((C1 * vl).value() + (C2 * Vl).value()) +
+          k1.value() * ((C1 * vr).value() + (C2 * Vr).value())};
+}
+
+frc::Vectord<3> DrivetrainLocalMeasurementModel(const frc::Vectord<5>& x,
+                                                const frc::Vectord<2>& u) {
+  static_cast<void>(u);
+  return frc::Vectord<3>{x(2), x(3), x(4)};
+}
+
+double BenchExtendedKalmanFilterPredictCorrect() {
+  static frc::ExtendedKalmanFilter<5, 2, 3> observer{
+      DrivetrainDynamics,
+      DrivetrainLocalMeasurementModel,
+      {0.5, 0.5, 10.0, 1.0, 1.0},
+      {0.0001, 0.01, 0.01},
+      5_ms};
+  frc::Vectord<2> u{12.0, 12.0};
+  observer.Predict(u, 5_ms);
+  observer.Correct(u, DrivetrainLocalMeasurementModel(observer.Xhat(), u));
+  return observer.Xhat(0);
+}
+
+double BenchUnscentedKalmanFilterPredictCorrect() {
+  static frc::UnscentedKalmanFilter<5, 2, 3> observer{
+      DrivetrainDynamics,
+      DrivetrainLocalMeasurementModel,
+      {0.5, 0.5, 10.0, 1.0, 1.0},
+      {0.0001, 0.01, 0.01},
+      5_ms};
+  frc::Vectord<2> u{12.0, 12.0};
+  observer.Predict(u, 5_ms);
+  observer.Correct(u, DrivetrainLocalMeasurementModel(observer.Xhat(), u));
+  return observer.Xhat(0);
+}
+
+// The next four benchmarks compare unit_t arithmetic against a raw-double
+// port of the same math. With zero-overhead lowering (see
+// UnitsZeroOverheadTest.cpp) the paired results should be within noise of
+// each other; a gap means unit conversions stopped folding away.
+
+double BenchSimpleMotorFeedforwardUnits() {
+  static const frc::SimpleMotorFeedforward<units::meters> feedforward{
+      1_V, 2_V / 1_mps, 0.5_V / 1_mps_sq};
+  static double velocity = 0.0;
+  velocity += 0.001;
+  return feedforward
+      .Calculate(units::meters_per_second_t{velocity},
+                 units::meters_per_second_squared_t{0.5})
+      .value();
+}
+
+double BenchSimpleMotorFeedforwardRawDouble() {
+  static constexpr double kS = 1.0;
+  static constexpr double kV = 2.0;
+  static constexpr double kA = 0.5;
+  static double velocity = 0.0;
+  velocity += 0.001;
+  return kS * ((velocity > 0.0) - (velocity < 0.0)) + kV * velocity + kA * 0.5;
+}
+
+// frc::PIDController already stores raw doubles, so this pair measures the
+// class's abstraction overhead (error filtering, continuous-input support)
+// rather than unit conversions.
+double BenchPIDControllerClass() {
+  static frc::PIDController controller{1.0, 0.25, 0.1};
+  static double measurement = 0.0;
+  measurement += 0.001;
+  return controller.Calculate(measurement, 5.0);
+}
+
+double BenchPIDControllerRawDouble() {
+  static constexpr double kP = 1.0;
+  static constexpr double kI = 0.25;
+  static constexpr double kD = 0.1;
+  static constexpr double dt = 0.02;
+  static double measurement = 0.0;
+  static double prevError = 0.0;
+  static double totalError = 0.0;
+  measurement += 0.001;
+  double error = 5.0 - measurement;
+  totalError += error * dt;
+  double result =
+      kP * error + kI * totalError + kD * (error - prevError) / dt;
+  prevError = error;
+  return result;
+}
+
+double BenchQuinticSplineParameterization() {
+  static const auto splines = frc::SplineHelper::QuinticSplinesFromWaypoints(
+      {frc::Pose2d{0_m, 0_m, 0_deg}, frc::Pose2d{2_m, 1_m, 45_deg},
+       frc::Pose2d{4_m, 0_m, 0_deg}});
+  auto points = frc::SplineParameterizer::Parameterize(splines[0]);
+  return points.back().first.X().value();
+}
+
+double BenchTrajectoryGeneration() {
+  static const frc::TrajectoryConfig config{4_mps, 3_mps_sq};
+  auto trajectory = frc::TrajectoryGenerator::GenerateTrajectory(
+      {frc::Pose2d{0_m, 0_m, 0_deg}, frc::Pose2d{2_m, 1_m, 45_deg},
+       frc::Pose2d{4_m, 0_m, 0_deg}},
+      config);
+  return trajectory.TotalTime().value();
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  bool json = argc > 1 && std::strcmp(argv[1], "--json") == 0;
+
+  std::vector<BenchmarkResult> results;
+  results.push_back(RunBenchmark("Pose2d_Exp", BenchPose2dExp));
+  results.push_back(RunBenchmark("Pose2d_Log", BenchPose2dLog));
+  results.push_back(
+      RunBenchmark("SwerveDriveKinematics_ToChassisSpeeds",
+                   BenchSwerveToChassisSpeeds));
+  results.push_back(RunBenchmark("SwerveDriveKinematics_ToSwerveModuleStates",
+                                 BenchSwerveToModuleStates));
+  results.push_back(RunBenchmark("DifferentialDriveOdometry_Update",
+                                 BenchDifferentialDriveOdometryUpdate));
+  results.push_back(RunBenchmark("SwerveDriveOdometry_Update",
+                                 BenchSwerveDriveOdometryUpdate));
+  results.push_back(RunBenchmark("KalmanFilter_PredictCorrect",
+                                 BenchKalmanFilterPredictCorrect));
+  results.push_back(RunBenchmark("ExtendedKalmanFilter_PredictCorrect",
+                                 BenchExtendedKalmanFilterPredictCorrect));
+  results.push_back(RunBenchmark("UnscentedKalmanFilter_PredictCorrect",
+                                 BenchUnscentedKalmanFilterPredictCorrect));
+  results.push_back(RunBenchmark("SimpleMotorFeedforward_Units",
+                                 BenchSimpleMotorFeedforwardUnits));
+  results.push_back(RunBenchmark("SimpleMotorFeedforward_RawDouble",
+                                 BenchSimpleMotorFeedforwardRawDouble));
+  results.push_back(
+      RunBenchmark("PIDController_Class", BenchPIDControllerClass));
+  results.push_back(
+      RunBenchmark("PIDController_RawDouble", BenchPIDControllerRawDouble));
+  results.push_back(RunBenchmark("SplineParameterizer_Quintic",
+                                 BenchQuinticSplineParameterization));
+  results.push_back(
+      RunBenchmark("TrajectoryGenerator_Generate", BenchTrajectoryGeneration));
+
+  if (json) {
+    wpi::json baseline;
+    baseline["benchmarks"] = wpi::json::array();
+    for (const auto& result : results) {
+      baseline["benchmarks"].push_back(
+          {{"name", result.name},
+           {"ns_per_iteration", result.nsPerIteration},
+           {"iterations", result.iterations}});
+    }
+    std::printf("%s\n", baseline.dump(2).c_str());
+  } else {
+    std::printf("%-45s %15s %12s\n", "Benchmark", "ns/iteration",
+                "iterations");
+    for (const auto& result : results) {
+      std::printf("%-45s %15.1f %12zu\n", result.name.c_str(),
+                  result.nsPerIteration, result.iterations);
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,85 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "frc/controller/DifferentialDriveVelocityController.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "frc/MathUtil.h"
+
+using namespace frc;
+
+DifferentialDriveVelocityController::DifferentialDriveVelocityController(
+    const SimpleMotorFeedforward<units::meters>& feedforward,
+    units::meters_per_second_t maxSpeed, double Kp, double Ki, double Kd,
+    units::second_t period)
+    : m_feedforward{feedforward},
+      m_maxSpeed{maxSpeed},
+      m_leftController{Kp, Ki, Kd, period},
+      m_rightController{Kp, Ki, Kd, period} {
+  RebuildShapingTable();
+}
+
+void DifferentialDriveVelocityController::SetDeadband(double deadband) {
+  m_deadband = deadband;
+  RebuildShapingTable();
+}
+
+void DifferentialDriveVelocityController::SetSquareInputs(bool squareInputs) {
+  m_squareInputs = squareInputs;
+  RebuildShapingTable();
+}
+
+DifferentialDriveWheelVoltages DifferentialDriveVelocityController::Calculate(
+    double leftInput, double rightInput,
+    units::meters_per_second_t leftVelocity,
+    units::meters_per_second_t rightVelocity) {
+  return Calculate(Shape(leftInput) * m_maxSpeed,
+                   Shape(rightInput) * m_maxSpeed, leftVelocity,
+                   rightVelocity);
+}
+
+DifferentialDriveWheelVoltages DifferentialDriveVelocityController::Calculate(
+    units::meters_per_second_t leftSetpoint,
+    units::meters_per_second_t rightSetpoint,
+    units::meters_per_second_t leftVelocity,
+    units::meters_per_second_t rightVelocity) {
+  return {m_feedforward.Calculate(leftSetpoint) +
+              units::volt_t{m_leftController.Calculate(leftVelocity.value(),
+                                                       leftSetpoint.value())},
+          m_feedforward.Calculate(rightSetpoint) +
+              units::volt_t{m_rightController.Calculate(
+                  rightVelocity.value(), rightSetpoint.value())}};
+}
+
+void DifferentialDriveVelocityController::Reset() {
+  m_leftController.Reset();
+  m_rightController.Reset();
+}
+
+double DifferentialDriveVelocityController::Shape(double input) const {
+  double magnitude = std::min(std::abs(input), 1.0);
+  double position = magnitude * (kShapingTableSize - 1);
+  int index = static_cast<int>(position);
+  double frac = position - index;
+
+  double shaped =
+      index + 1 < kShapingTableSize
+          ? m_shapingTable[index] +
+                frac * (m_shapingTable[index + 1] - m_shapingTable[index])
+          : m_shapingTable[index];
+  return std::copysign(shaped, input);
+}
+
+void DifferentialDriveVelocityController::RebuildShapingTable() {
+  for (int i = 0; i < kShapingTableSize; ++i) {
+    double value = static_cast<double>(i) / (kShapingTableSize - 1);
+    double shaped = ApplyDeadband(value, m_deadband);
+    if (m_squareInputs) {
+      shaped *= shaped;
+    }
+    m_shapingTable[i] = shaped;
+  }
+}
@@ -5,10 +5,17 @@
 #include "frc/controller/LTVDifferentialDriveController.h"
 
 #include <cmath>
+#include <stdexcept>
+#include <string>
 
+#include "Eigen/Cholesky"
+#include "frc/DARE.h"
 #include "frc/MathUtil.h"
 #include "frc/StateSpaceUtil.h"
-#include "frc/controller/LinearQuadraticRegulator.h"
+#include "frc/fmt/Eigen.h"
+#include "frc/system/Discretization.h"
+#include "units/math.h"
+#include "wpimath/MathShared.h"
 
 using namespace frc;
 
@@ -65,6 +72,12 @@ LTVDifferentialDriveController::LTVDifferentialDriveController(
   units::meters_per_second_t maxV{
       -plant.A().householderQr().solve(plant.B() * Vectord<2>{12.0, 12.0})(0)};
 
+  m_table.reserve(static_cast<size_t>(2.0 * maxV / 0.01_mps) + 1);
+
+  // Adjacent velocity samples produce nearly identical plants, so each DARE
+  // solve is warm-started from the previous sample's solution.
+  Matrixd<5, 5> S;
+  bool haveS = false;
   for (auto velocity = -maxV; velocity < maxV; velocity += 0.01_mps) {
     // The DARE is ill-conditioned if the velocity is close to zero, so don't
     // let the system stop.
@@ -72,8 +85,34 @@ LTVDifferentialDriveController::LTVDifferentialDriveController(
       m_table.insert(velocity, Matrixd<2, 5>::Zero());
     } else {
       A(State::kY, State::kHeading) = velocity.value();
-      m_table.insert(velocity,
-                     frc::LinearQuadraticRegulator<5, 2>{A, B, Q, R, dt}.K());
+
+      Matrixd<5, 5> discA;
+      Matrixd<5, 2> discB;
+      DiscretizeAB<5, 2>(A, B, dt, &discA, &discB);
+
+      // Velocity only scales one entry of A, so stabilizability is the same
+      // for every nonzero sample; check it once.
+      if (!haveS && !IsStabilizable<5, 2>(discA, discB)) {
+        std::string msg = fmt::format(
+            "The system passed to the LTV differential drive controller is "
+            "uncontrollable!\n\nA =\n{}\nB =\n{}\n",
+            discA, discB);
+
+        wpi::math::MathSharedStore::ReportError(msg);
+        throw std::invalid_argument(msg);
+      }
+
+      if (haveS) {
+        S = DARE<5, 2>(discA, discB, Q, R, S);
+      } else {
+        S = DARE<5, 2>(discA, discB, Q, R);
+        haveS = true;
+      }
+
+      // K = (BᵀSB + R)⁻¹BᵀSA
+      m_table.insert(velocity, (discB.transpose() * S * discB + R)
+                                   .llt()
+                                   .solve(discB.transpose() * S * discA));
     }
   }
 }
@@ -4,8 +4,10 @@
 
 #include "frc/controller/LTVUnicycleController.h"
 
+#include "Eigen/Cholesky"
+#include "frc/DARE.h"
 #include "frc/StateSpaceUtil.h"
-#include "frc/controller/LinearQuadraticRegulator.h"
+#include "frc/system/Discretization.h"
 #include "units/math.h"
 
 using namespace frc;
@@ -74,6 +76,12 @@ LTVUnicycleController::LTVUnicycleController(
   Matrixd<3, 3> Q = frc::MakeCostMatrix(Qelems);
   Matrixd<2, 2> R = frc::MakeCostMatrix(Relems);
 
+  m_table.reserve(static_cast<size_t>(2.0 * maxVelocity / 0.01_mps) + 1);
+
+  // Adjacent velocity samples produce nearly identical plants, so each DARE
+  // solve is warm-started from the previous sample's solution.
+  Matrixd<3, 3> S;
+  bool haveS = false;
   for (auto velocity = -maxVelocity; velocity < maxVelocity;
        velocity += 0.01_mps) {
     // The DARE is ill-conditioned if the velocity is close to zero, so don't
@@ -82,8 +90,22 @@ LTVUnicycleController::LTVUnicycleController(
       m_table.insert(velocity, Matrixd<2, 3>::Zero());
     } else {
       A(State::kY, State::kHeading) = velocity.value();
-      m_table.insert(velocity,
-                     frc::LinearQuadraticRegulator<3, 2>{A, B, Q, R, dt}.K());
+
+      Matrixd<3, 3> discA;
+      Matrixd<3, 2> discB;
+      DiscretizeAB<3, 2>(A, B, dt, &discA, &discB);
+
+      if (haveS) {
+        S = DARE<3, 2>(discA, discB, Q, R, S);
+      } else {
+        S = DARE<3, 2>(discA, discB, Q, R);
+        haveS = true;
+      }
+
+      // K = (BᵀSB + R)⁻¹BᵀSA
+      m_table.insert(velocity, (discB.transpose() * S * discB + R)
+                                   .llt()
+                                   .solve(discB.transpose() * S * discA));
     }
   }
 }
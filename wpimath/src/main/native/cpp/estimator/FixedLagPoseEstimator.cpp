@@ -0,0 +1,228 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "frc/estimator/FixedLagPoseEstimator.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <wpi/timestamp.h>
+
+#include "Eigen/Cholesky"
+
+#include "frc/MathUtil.h"
+
+using namespace frc;
+
+namespace {
+
+// Huber loss threshold for vision residuals, as a Mahalanobis distance over
+// the three pose dimensions (the expected distance for an inlier is about
+// sqrt(3)). Residuals beyond this are down-weighted linearly instead of
+// quadratically, which keeps a single bad multi-tag solve from dragging the
+// whole window.
+constexpr double kHuberThreshold = 3.0;
+
+Eigen::Matrix3d MakeInfoMatrix(const wpi::array<double, 3>& stdDevs) {
+  Eigen::Matrix3d info = Eigen::Matrix3d::Zero();
+  for (int i = 0; i < 3; ++i) {
+    info(i, i) = 1.0 / (stdDevs[i] * stdDevs[i]);
+  }
+  return info;
+}
+
+Vectord<3> PoseToVector(const Pose2d& pose) {
+  return Vectord<3>{pose.X().value(), pose.Y().value(),
+                    pose.Rotation().Radians().value()};
+}
+
+}  // namespace
+
+FixedLagPoseEstimator::FixedLagPoseEstimator(
+    size_t windowSize, const Pose2d& initialPose,
+    const wpi::array<double, 3>& odometryStdDevs,
+    const wpi::array<double, 3>& visionMeasurementStdDevs)
+    : m_windowSize(std::max<size_t>(windowSize, 2)),
+      m_odometryInfo(MakeInfoMatrix(odometryStdDevs)),
+      m_seedPose(initialPose) {
+  SetVisionMeasurementStdDevs(visionMeasurementStdDevs);
+}
+
+void FixedLagPoseEstimator::SetVisionMeasurementStdDevs(
+    const wpi::array<double, 3>& visionMeasurementStdDevs) {
+  m_visionInfo = MakeInfoMatrix(visionMeasurementStdDevs);
+}
+
+void FixedLagPoseEstimator::ResetPosition(const Pose2d& pose) {
+  m_nodes.clear();
+  m_seedPose = pose;
+}
+
+Pose2d FixedLagPoseEstimator::GetEstimatedPosition() const {
+  return m_nodes.empty() ? m_seedPose : m_nodes.back().estimate;
+}
+
+void FixedLagPoseEstimator::AddVisionMeasurement(const Pose2d& visionRobotPose,
+                                                 units::second_t timestamp) {
+  if (m_nodes.empty() || timestamp < m_nodes.front().time) {
+    // older than the lag window (or no odometry yet); nothing to attach to
+    return;
+  }
+
+  // attach to the node closest in time
+  auto it = std::lower_bound(
+      m_nodes.begin(), m_nodes.end(), timestamp,
+      [](const Node& node, units::second_t t) { return node.time < t; });
+  if (it == m_nodes.end()) {
+    it = std::prev(it);
+  } else if (it != m_nodes.begin() &&
+             timestamp - std::prev(it)->time < it->time - timestamp) {
+    it = std::prev(it);
+  }
+
+  it->vision.emplace_back(
+      VisionMeasurement{PoseToVector(visionRobotPose), m_visionInfo});
+  Optimize();
+}
+
+void FixedLagPoseEstimator::AddVisionMeasurement(
+    const Pose2d& visionRobotPose, units::second_t timestamp,
+    const wpi::array<double, 3>& visionMeasurementStdDevs) {
+  SetVisionMeasurementStdDevs(visionMeasurementStdDevs);
+  AddVisionMeasurement(visionRobotPose, timestamp);
+}
+
+Pose2d FixedLagPoseEstimator::Update(const Pose2d& odometryPose) {
+  return UpdateWithTime(units::microsecond_t(wpi::Now()), odometryPose);
+}
+
+Pose2d FixedLagPoseEstimator::UpdateWithTime(units::second_t currentTime,
+                                             const Pose2d& odometryPose) {
+  if (m_nodes.empty()) {
+    m_nodes.emplace_back(
+        Node{currentTime, odometryPose, Transform2d{}, m_seedPose, {}});
+  } else {
+    const auto& prev = m_nodes.back();
+    Transform2d delta = odometryPose - prev.odometryPose;
+    Pose2d estimate = prev.estimate + delta;
+    m_nodes.emplace_back(Node{currentTime, odometryPose, delta, estimate, {}});
+
+    // retire the oldest pose; the new oldest node keeps its smoothed
+    // estimate and becomes the anchor
+    if (m_nodes.size() > m_windowSize) {
+      m_nodes.erase(m_nodes.begin());
+    }
+  }
+
+  return m_nodes.back().estimate;
+}
+
+void FixedLagPoseEstimator::Optimize() {
+  // The oldest node is the fixed anchor, so the variables are nodes
+  // 1..n-1 and the normal equations are block-tridiagonal: diagonal blocks
+  // D[i], upper off-diagonal blocks U[i] between consecutive nodes, and
+  // right-hand side b[i].
+  size_t n = m_nodes.size();
+  if (n < 2) {
+    return;
+  }
+  size_t numVars = n - 1;
+
+  std::vector<Eigen::Matrix3d> D(numVars);
+  std::vector<Eigen::Matrix3d> U(numVars > 1 ? numVars - 1 : 0);
+  std::vector<Vectord<3>> b(numVars);
+  std::vector<Vectord<3>> dx(numVars);
+
+  constexpr int kMaxIterations = 10;
+  for (int iteration = 0; iteration < kMaxIterations; ++iteration) {
+    for (auto& block : D) {
+      block.setZero();
+    }
+    for (auto& block : U) {
+      block.setZero();
+    }
+    for (auto& rhs : b) {
+      rhs.setZero();
+    }
+
+    // odometry factors between consecutive nodes
+    for (size_t j = 1; j < n; ++j) {
+      const auto& a = m_nodes[j - 1];
+      const auto& node = m_nodes[j];
+
+      double thetaA = a.estimate.Rotation().Radians().value();
+      double ca = std::cos(thetaA);
+      double sa = std::sin(thetaA);
+      double dxWorld = (node.estimate.X() - a.estimate.X()).value();
+      double dyWorld = (node.estimate.Y() - a.estimate.Y()).value();
+
+      // residual: measured motion vs. estimated motion, in node a's frame
+      Vectord<3> r{
+          ca * dxWorld + sa * dyWorld - node.delta.X().value(),
+          -sa * dxWorld + ca * dyWorld - node.delta.Y().value(),
+          frc::AngleModulus(node.estimate.Rotation().Radians() -
+                            a.estimate.Rotation().Radians() -
+                            node.delta.Rotation().Radians())
+              .value()};
+
+      // Jacobians with respect to [x, y, theta] of each endpoint
+      Eigen::Matrix3d Ja{{-ca, -sa, -sa * dxWorld + ca * dyWorld},
+                         {sa, -ca, -ca * dxWorld - sa * dyWorld},
+                         {0.0, 0.0, -1.0}};
+      Eigen::Matrix3d Jb{{ca, sa, 0.0}, {-sa, ca, 0.0}, {0.0, 0.0, 1.0}};
+
+      size_t ib = j - 1;
+      D[ib] += Jb.transpose() * m_odometryInfo * Jb;
+      b[ib] += Jb.transpose() * m_odometryInfo * r;
+      if (j >= 2) {
+        size_t ia = j - 2;
+        D[ia] += Ja.transpose() * m_odometryInfo * Ja;
+        b[ia] += Ja.transpose() * m_odometryInfo * r;
+        U[ia] += Ja.transpose() * m_odometryInfo * Jb;
+      }
+    }
+
+    // vision factors (Huber-weighted); measurements on the anchor are
+    // already folded into its fixed estimate
+    for (size_t j = 1; j < n; ++j) {
+      for (const auto& meas : m_nodes[j].vision) {
+        Vectord<3> r = PoseToVector(m_nodes[j].estimate) - meas.y;
+        r(2) = frc::AngleModulus(units::radian_t{r(2)}).value();
+
+        double mahalanobis = std::sqrt(r.dot(meas.info * r));
+        double weight =
+            mahalanobis > kHuberThreshold ? kHuberThreshold / mahalanobis : 1.0;
+
+        D[j - 1] += weight * meas.info;
+        b[j - 1] += weight * meas.info * r;
+      }
+    }
+
+    // block Cholesky sweep: forward elimination then back substitution
+    for (size_t i = 1; i < numVars; ++i) {
+      Eigen::Matrix3d L =
+          U[i - 1].transpose() * D[i - 1].ldlt().solve(Eigen::Matrix3d::Identity());
+      D[i] -= L * U[i - 1];
+      b[i] -= L * b[i - 1];
+    }
+    dx[numVars - 1] = D[numVars - 1].ldlt().solve(-b[numVars - 1]);
+    for (size_t i = numVars - 1; i-- > 0;) {
+      dx[i] = D[i].ldlt().solve(-b[i] - U[i] * dx[i + 1]);
+    }
+
+    double maxStep = 0.0;
+    for (size_t i = 0; i < numVars; ++i) {
+      maxStep = std::max(maxStep, dx[i].lpNorm<Eigen::Infinity>());
+      auto& estimate = m_nodes[i + 1].estimate;
+      estimate = Pose2d{estimate.X() + units::meter_t{dx[i](0)},
+                        estimate.Y() + units::meter_t{dx[i](1)},
+                        estimate.Rotation() + Rotation2d{units::radian_t{
+                                                  dx[i](2)}}};
+    }
+
+    if (maxStep < 1e-6) {
+      break;
+    }
+  }
+}
@@ -0,0 +1,48 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "frc/geometry/BatchTransform.h"
+
+using namespace frc;
+
+std::vector<Pose3d> frc::ExpPoses(const Pose3d& start,
+                                  std::span<const Twist3d> twists) {
+  std::vector<Pose3d> poses;
+  poses.reserve(twists.size());
+
+  for (const auto& twist : twists) {
+    // The exponential at the identity is the relative transform; composing
+    // it onto the start pose is a quaternion multiply and a vector rotate.
+    Pose3d relative = Pose3d{}.Exp(twist);
+    poses.emplace_back(start.TransformBy(
+        Transform3d{relative.Translation(), relative.Rotation()}));
+  }
+
+  return poses;
+}
+
+std::vector<Twist3d> frc::LogPoses(const Pose3d& start,
+                                   std::span<const Pose3d> ends) {
+  std::vector<Twist3d> twists;
+  twists.reserve(ends.size());
+
+  // Invert the start pose once; each end pose then only pays for its own
+  // relative transform and logarithm.
+  const Quaternion startQInv = start.Rotation().GetQuaternion().Inverse();
+  const Translation3d& startT = start.Translation();
+
+  for (const auto& end : ends) {
+    auto relativeT = startQInv.Rotate(
+        Eigen::Vector3d{(end.X() - startT.X()).value(),
+                        (end.Y() - startT.Y()).value(),
+                        (end.Z() - startT.Z()).value()});
+    Rotation3d relativeR{startQInv * end.Rotation().GetQuaternion()};
+
+    twists.emplace_back(Pose3d{}.Log(
+        Pose3d{units::meter_t{relativeT(0)}, units::meter_t{relativeT(1)},
+               units::meter_t{relativeT(2)}, relativeR}));
+  }
+
+  return twists;
+}
@@ -50,6 +50,21 @@ Quaternion Quaternion::Normalize() const {
   }
 }
 
+Eigen::Vector3d Quaternion::Rotate(const Eigen::Vector3d& v) const {
+  // For a unit quaternion q = (r, 𝗏), conjugation q v q⁻¹ expands to
+  // v' = v + 2𝗏 × (𝗏 × v + rv)
+
+  // t = 𝗏 × v + rv
+  Eigen::Vector3d t{m_v(1) * v(2) - v(1) * m_v(2) + m_r * v(0),
+                    v(0) * m_v(2) - m_v(0) * v(2) + m_r * v(1),
+                    m_v(0) * v(1) - v(0) * m_v(1) + m_r * v(2)};
+
+  // v' = v + 2𝗏 × t
+  return Eigen::Vector3d{v(0) + 2.0 * (m_v(1) * t(2) - t(1) * m_v(2)),
+                         v(1) + 2.0 * (t(0) * m_v(2) - m_v(0) * t(2)),
+                         v(2) + 2.0 * (m_v(0) * t(1) - t(0) * m_v(1))};
+}
+
 double Quaternion::W() const {
   return m_r;
 }
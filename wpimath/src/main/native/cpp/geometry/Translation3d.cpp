@@ -29,10 +29,10 @@ units::meter_t Translation3d::Norm() const {
 }
 
 Translation3d Translation3d::RotateBy(const Rotation3d& other) const {
-  Quaternion p{0.0, m_x.value(), m_y.value(), m_z.value()};
-  auto qprime = other.GetQuaternion() * p * other.GetQuaternion().Inverse();
-  return Translation3d{units::meter_t{qprime.X()}, units::meter_t{qprime.Y()},
-                       units::meter_t{qprime.Z()}};
+  auto rotated = other.GetQuaternion().Rotate(
+      Eigen::Vector3d{m_x.value(), m_y.value(), m_z.value()});
+  return Translation3d{units::meter_t{rotated(0)}, units::meter_t{rotated(1)},
+                       units::meter_t{rotated(2)}};
 }
 
 bool Translation3d::operator==(const Translation3d& other) const {
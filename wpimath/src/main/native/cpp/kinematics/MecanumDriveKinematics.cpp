@@ -42,7 +42,7 @@ ChassisSpeeds MecanumDriveKinematics::ToChassisSpeeds(
       wheelSpeeds.rearLeft.value(), wheelSpeeds.rearRight.value()};
 
   Eigen::Vector3d chassisSpeedsVector =
-      m_forwardKinematics.solve(wheelSpeedsVector);
+      m_forwardKinematics * wheelSpeedsVector;
 
   return {units::meters_per_second_t{chassisSpeedsVector(0)},  // NOLINT
           units::meters_per_second_t{chassisSpeedsVector(1)},
@@ -55,7 +55,7 @@ Twist2d MecanumDriveKinematics::ToTwist2d(
       wheelDeltas.frontLeft.value(), wheelDeltas.frontRight.value(),
       wheelDeltas.rearLeft.value(), wheelDeltas.rearRight.value()};
 
-  Eigen::Vector3d twistVector = m_forwardKinematics.solve(wheelDeltasVector);
+  Eigen::Vector3d twistVector = m_forwardKinematics * wheelDeltasVector;
 
   return {units::meter_t{twistVector(0)},  // NOLINT
           units::meter_t{twistVector(1)}, units::radian_t{twistVector(2)}};
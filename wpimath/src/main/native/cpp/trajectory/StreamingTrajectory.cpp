@@ -0,0 +1,178 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "frc/trajectory/StreamingTrajectory.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "frc/spline/SplineHelper.h"
+#include "frc/trajectory/TrajectoryGenerator.h"
+#include "frc/trajectory/TrajectoryParameterizer.h"
+#include "units/math.h"
+
+using namespace frc;
+
+namespace {
+
+// Windows shorter than this are all overhead; degenerate configs (a very low
+// max velocity or a very high max acceleration) get clamped up to it.
+constexpr auto kMinLookahead = 0.25_m;
+
+units::meter_t ArcLength(
+    const std::vector<StreamingTrajectory::PoseWithCurvature>& points) {
+  units::meter_t length = 0_m;
+  for (size_t i = 1; i < points.size(); ++i) {
+    length += points[i].first.Translation().Distance(
+        points[i - 1].first.Translation());
+  }
+  return length;
+}
+
+}  // namespace
+
+StreamingTrajectory::StreamingTrajectory(const std::vector<Pose2d>& waypoints,
+                                         TrajectoryConfig config)
+    : m_config(std::move(config)),
+      m_boundaryVelocity(m_config.StartVelocity()) {
+  // The backward pass's influence decays within the braking distance
+  // v_max²/(2a_max); double it so velocity-dependent acceleration constraints
+  // that brake slower than the global limit still converge in the window.
+  m_lookahead = units::math::max(
+      m_config.MaxVelocity() * m_config.MaxVelocity() /
+          m_config.MaxAcceleration(),
+      kMinLookahead);
+
+  auto newWaypoints = waypoints;
+  const Transform2d flip{Translation2d{}, 180_deg};
+  if (m_config.IsReversed()) {
+    for (auto& waypoint : newWaypoints) {
+      waypoint = waypoint + flip;
+    }
+  }
+
+  m_splines = SplineHelper::QuinticSplinesFromWaypoints(newWaypoints);
+
+  auto firstPoint = m_splines.front().GetPoint(0.0);
+  if (m_config.IsReversed()) {
+    firstPoint = {firstPoint.first + flip, -firstPoint.second};
+  }
+  m_pendingPoints.push_back(firstPoint);
+
+  // Parameterize the first window so the start of the trajectory can be
+  // sampled immediately.
+  AdvanceWindow();
+}
+
+Trajectory::State StreamingTrajectory::Sample(units::second_t t) {
+  while (!m_exhausted && t > m_window.back().t) {
+    AdvanceWindow();
+  }
+
+  if (t <= m_window.front().t) {
+    return m_window.front();
+  }
+  if (t >= m_window.back().t) {
+    return m_window.back();
+  }
+
+  // Use binary search to get the element with a timestamp no less than the
+  // requested timestamp. This starts at 1 because we use the previous state
+  // later on for interpolation.
+  auto sample =
+      std::lower_bound(m_window.cbegin() + 1, m_window.cend(), t,
+                       [](const auto& a, const auto& b) { return a.t < b; });
+
+  auto prevSample = sample - 1;
+
+  // If the difference in states is negligible, then we are spot on!
+  if (units::math::abs(sample->t - prevSample->t) < 1E-9_s) {
+    return *sample;
+  }
+
+  // Interpolate between the two states for the state that we want.
+  return prevSample->Interpolate(
+      *sample, (t - prevSample->t) / (sample->t - prevSample->t));
+}
+
+units::second_t StreamingTrajectory::TotalTime() {
+  while (!m_exhausted) {
+    AdvanceWindow();
+  }
+  return m_window.back().t;
+}
+
+void StreamingTrajectory::FillPoints(units::meter_t length) {
+  const Transform2d flip{Translation2d{}, 180_deg};
+  while (ArcLength(m_pendingPoints) < length &&
+         m_nextSpline < m_splines.size()) {
+    auto splinePoints =
+        SplineParameterizer::Parameterize(m_splines[m_nextSpline]);
+    if (m_config.IsReversed()) {
+      for (auto& point : splinePoints) {
+        point = {point.first + flip, -point.second};
+      }
+    }
+
+    // Skip the first point because it's a duplicate of the last point from
+    // the previous spline.
+    m_pendingPoints.insert(m_pendingPoints.end(), splinePoints.begin() + 1,
+                           splinePoints.end());
+    ++m_nextSpline;
+  }
+}
+
+void StreamingTrajectory::AdvanceWindow() {
+  if (m_exhausted) {
+    return;
+  }
+
+  try {
+    FillPoints(2 * m_lookahead);
+  } catch (SplineParameterizer::MalformedSplineException& e) {
+    TrajectoryGenerator::ReportError(e.what());
+    m_window = TrajectoryGenerator::kDoNothingTrajectory.States();
+    m_exhausted = true;
+    return;
+  }
+
+  // Once all splines are buffered there's no memory left to save, so finish
+  // the path in one window with the real end velocity.
+  bool finalWindow = m_nextSpline == m_splines.size();
+
+  // End a non-final window at rest; with at least the braking distance left
+  // after the emitted states, the artificial stop cannot constrain them.
+  auto trajectory = TrajectoryParameterizer::TimeParameterizeTrajectory(
+      m_pendingPoints, m_config.Constraints(), m_boundaryVelocity,
+      finalWindow ? m_config.EndVelocity() : 0_mps, m_config.MaxVelocity(),
+      m_config.MaxAcceleration(), m_config.IsReversed());
+  const auto& states = trajectory.States();
+
+  // Emit everything up to the last state with at least the lookahead distance
+  // remaining after it; the tail is re-parameterized with the next window.
+  size_t boundary = states.size() - 1;
+  if (!finalWindow) {
+    units::meter_t tail = 0_m;
+    while (boundary > 1 && tail < m_lookahead) {
+      tail += states[boundary].pose.Translation().Distance(
+          states[boundary - 1].pose.Translation());
+      --boundary;
+    }
+  }
+
+  m_window.assign(states.begin(), states.begin() + boundary + 1);
+  for (auto& state : m_window) {
+    state.t += m_timeOffset;
+  }
+
+  m_boundaryVelocity = states[boundary].velocity;
+  m_timeOffset = m_window.back().t;
+  if (finalWindow) {
+    m_pendingPoints.clear();
+    m_exhausted = true;
+  } else {
+    m_pendingPoints.erase(m_pendingPoints.begin(),
+                          m_pendingPoints.begin() + boundary);
+  }
+}
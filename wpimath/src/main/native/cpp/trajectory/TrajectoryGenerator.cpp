@@ -146,3 +146,56 @@ void TrajectoryGenerator::SetErrorHandler(
     std::function<void(const char*)> func) {
   s_errorFunc = std::move(func);
 }
+
+Trajectory IncrementalTrajectoryGenerator::Generate(
+    const std::vector<Pose2d>& waypoints, const TrajectoryConfig& config) {
+  auto newWaypoints = waypoints;
+  const Transform2d flip{Translation2d{}, 180_deg};
+  if (config.IsReversed()) {
+    for (auto& waypoint : newWaypoints) {
+      waypoint = waypoint + flip;
+    }
+  }
+
+  std::vector<SplineParameterizer::PoseWithCurvature> points;
+  try {
+    auto splines = SplineHelper::QuinticSplinesFromWaypoints(newWaypoints);
+    m_cache.resize(splines.size());
+
+    points.push_back(splines.front().GetPoint(0.0));
+    for (size_t i = 0; i < splines.size(); ++i) {
+      auto& entry = m_cache[i];
+
+      // Each quintic spline depends only on its two bounding waypoints, so a
+      // cache entry is stale only if one of them moved.
+      if (entry.points.empty() || entry.start != newWaypoints[i] ||
+          entry.end != newWaypoints[i + 1]) {
+        auto splinePoints = SplineParameterizer::Parameterize(splines[i]);
+        entry.start = newWaypoints[i];
+        entry.end = newWaypoints[i + 1];
+        entry.points = std::move(splinePoints);
+      }
+
+      // Append the cached points, removing the first point because it's a
+      // duplicate of the last point from the previous spline.
+      points.insert(std::end(points), std::begin(entry.points) + 1,
+                    std::end(entry.points));
+    }
+  } catch (SplineParameterizer::MalformedSplineException& e) {
+    TrajectoryGenerator::ReportError(e.what());
+    return TrajectoryGenerator::kDoNothingTrajectory;
+  }
+
+  // After trajectory generation, flip theta back so it's relative to the
+  // field. Also fix curvature.
+  if (config.IsReversed()) {
+    for (auto& point : points) {
+      point = {point.first + flip, -point.second};
+    }
+  }
+
+  return TrajectoryParameterizer::TimeParameterizeTrajectory(
+      points, config.Constraints(), config.StartVelocity(),
+      config.EndVelocity(), config.MaxVelocity(), config.MaxAcceleration(),
+      config.IsReversed());
+}
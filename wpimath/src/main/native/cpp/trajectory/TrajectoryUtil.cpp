@@ -4,9 +4,16 @@
 
 #include "frc/trajectory/TrajectoryUtil.h"
 
+#include <stdint.h>
+
+#include <bit>
+#include <cstring>
 #include <system_error>
+#include <vector>
 
 #include <fmt/format.h>
+#include <wpi/Endian.h>
+#include <wpi/MemoryBuffer.h>
 #include <wpi/SmallString.h>
 #include <wpi/json.h>
 #include <wpi/raw_istream.h>
@@ -14,6 +21,18 @@
 
 using namespace frc;
 
+namespace {
+
+// Binary trajectory format: 16-byte header (8-byte magic, version, state
+// count) followed by fixed-stride records of 7 little-endian doubles per
+// state (time, velocity, acceleration, x, y, heading in radians, curvature)
+constexpr char kBinaryMagic[8] = {'W', 'P', 'T', 'R', 'A', 'J', '\0', '\0'};
+constexpr uint32_t kBinaryVersion = 1;
+constexpr size_t kBinaryHeaderSize = 16;
+constexpr size_t kStateStride = 7 * sizeof(double);
+
+}  // namespace
+
 void TrajectoryUtil::ToPathweaverJson(const Trajectory& trajectory,
                                       std::string_view path) {
   std::error_code error_code;
@@ -42,6 +61,89 @@ Trajectory TrajectoryUtil::FromPathweaverJson(std::string_view path) {
   return Trajectory{json.get<std::vector<Trajectory::State>>()};
 }
 
+void TrajectoryUtil::ToBinary(const Trajectory& trajectory,
+                              std::string_view path) {
+  std::error_code error_code;
+
+  wpi::raw_fd_ostream output{path, error_code};
+  if (error_code) {
+    throw std::runtime_error(fmt::format("Cannot open file: {}", path));
+  }
+
+  uint8_t header[kBinaryHeaderSize];
+  std::memcpy(header, kBinaryMagic, sizeof(kBinaryMagic));
+  wpi::support::endian::write32le(header + 8, kBinaryVersion);
+  wpi::support::endian::write32le(header + 12, trajectory.States().size());
+  output.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+  for (auto&& state : trajectory.States()) {
+    const double record[7] = {state.t.value(),
+                              state.velocity.value(),
+                              state.acceleration.value(),
+                              state.pose.X().value(),
+                              state.pose.Y().value(),
+                              state.pose.Rotation().Radians().value(),
+                              state.curvature.value()};
+    uint8_t buf[kStateStride];
+    for (size_t i = 0; i < 7; ++i) {
+      wpi::support::endian::write64le(buf + i * sizeof(double),
+                                      std::bit_cast<uint64_t>(record[i]));
+    }
+    output.write(reinterpret_cast<const char*>(buf), sizeof(buf));
+  }
+  output.flush();
+}
+
+Trajectory TrajectoryUtil::FromBinary(std::string_view path) {
+  std::error_code error_code;
+
+  auto fileBuffer = wpi::MemoryBuffer::GetFile(path, error_code);
+  if (error_code || !fileBuffer) {
+    throw std::runtime_error(fmt::format("Cannot open file: {}", path));
+  }
+
+  auto buf = fileBuffer->GetBuffer();
+  if (buf.size() < kBinaryHeaderSize ||
+      std::memcmp(buf.data(), kBinaryMagic, sizeof(kBinaryMagic)) != 0) {
+    throw std::runtime_error(
+        fmt::format("{}: not a binary trajectory file", path));
+  }
+  uint32_t version = wpi::support::endian::read32le(buf.data() + 8);
+  if (version != kBinaryVersion) {
+    throw std::runtime_error(fmt::format(
+        "{}: unsupported binary trajectory version {}", path, version));
+  }
+  size_t numStates = wpi::support::endian::read32le(buf.data() + 12);
+  if (buf.size() < kBinaryHeaderSize + numStates * kStateStride) {
+    throw std::runtime_error(
+        fmt::format("{}: binary trajectory file truncated", path));
+  }
+
+  std::vector<Trajectory::State> states;
+  states.reserve(numStates);
+  const uint8_t* record = buf.data() + kBinaryHeaderSize;
+  for (size_t i = 0; i < numStates; ++i, record += kStateStride) {
+    double v[7];
+    for (size_t j = 0; j < 7; ++j) {
+      v[j] = std::bit_cast<double>(
+          wpi::support::endian::read64le(record + j * sizeof(double)));
+    }
+    states.emplace_back(Trajectory::State{
+        units::second_t{v[0]}, units::meters_per_second_t{v[1]},
+        units::meters_per_second_squared_t{v[2]},
+        Pose2d{units::meter_t{v[3]}, units::meter_t{v[4]},
+               Rotation2d{units::radian_t{v[5]}}},
+        units::curvature_t{v[6]}});
+  }
+
+  return Trajectory{states};
+}
+
+void TrajectoryUtil::ConvertJsonToBinary(std::string_view jsonPath,
+                                         std::string_view binaryPath) {
+  ToBinary(FromPathweaverJson(jsonPath), binaryPath);
+}
+
 std::string TrajectoryUtil::SerializeTrajectory(const Trajectory& trajectory) {
   wpi::json json = trajectory.States();
   return json.dump();
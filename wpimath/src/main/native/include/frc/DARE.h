@@ -0,0 +1,124 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include "Eigen/Cholesky"
+#include "Eigen/LU"
+#include "frc/EigenCore.h"
+
+namespace frc {
+
+/**
+ * Computes the unique stabilizing solution X to the discrete-time algebraic
+ * Riccati equation:
+ *
+ *   AᵀXA − X − AᵀXB(BᵀXB + R)⁻¹BᵀXA + Q = 0
+ *
+ * This uses the structured doubling algorithm, so convergence is quadratic.
+ * All matrices are fixed size on the States/Inputs template parameters, so
+ * the solve performs no heap allocations; this makes it cheap enough to
+ * re-solve per loop iteration for gain scheduling.
+ *
+ * @tparam States Number of states.
+ * @tparam Inputs Number of inputs.
+ * @param A The system matrix.
+ * @param B The input matrix.
+ * @param Q The state cost matrix.
+ * @param R The input cost matrix.
+ * @return Solution of DARE.
+ */
+template <int States, int Inputs>
+Matrixd<States, States> DARE(const Matrixd<States, States>& A,
+                             const Matrixd<States, Inputs>& B,
+                             const Matrixd<States, States>& Q,
+                             const Matrixd<Inputs, Inputs>& R) {
+  using StateMatrix = Matrixd<States, States>;
+
+  // Doubling iteration for the discrete-time Riccati equation:
+  //
+  //   A₀ = A, G₀ = BR⁻¹Bᵀ, H₀ = Q
+  //   Aₖ₊₁ = Aₖ(I + GₖHₖ)⁻¹Aₖ
+  //   Gₖ₊₁ = Gₖ + Aₖ(I + GₖHₖ)⁻¹GₖAₖᵀ
+  //   Hₖ₊₁ = Hₖ + AₖᵀHₖ(I + GₖHₖ)⁻¹Aₖ
+  //
+  // Hₖ converges to the stabilizing solution.
+  StateMatrix A_k = A;
+  StateMatrix G_k = B * R.llt().solve(B.transpose());
+  StateMatrix H_k;
+  StateMatrix H_k1 = Q;
+  do {
+    H_k = H_k1;
+    Eigen::PartialPivLU<StateMatrix> W{StateMatrix::Identity() + G_k * H_k};
+    StateMatrix V1 = W.solve(A_k);  // (I + GₖHₖ)⁻¹Aₖ
+    StateMatrix V2 = W.solve(G_k);  // (I + GₖHₖ)⁻¹Gₖ
+    G_k += A_k * V2 * A_k.transpose();
+    H_k1 = H_k + A_k.transpose() * H_k * V1;
+    A_k *= V1;
+  } while ((H_k1 - H_k).norm() > 1e-10 * H_k1.norm());
+  return H_k1;
+}
+
+/**
+ * Computes the unique stabilizing solution X to the discrete-time algebraic
+ * Riccati equation, warm-started from a previous solution.
+ *
+ * Runs Newton's method (the Kleinman iteration) from the given guess: each
+ * step computes the gain for the current solution estimate and solves the
+ * resulting discrete Lyapunov equation by doubling.  Convergence is
+ * quadratic, so when the guess is close to the solution (e.g. the plant
+ * changed slightly between gain-schedule updates) one or two steps suffice.
+ * Falls back to the cold solver if the iteration fails to converge (e.g.
+ * the guess does not stabilize the plant).
+ *
+ * @tparam States Number of states.
+ * @tparam Inputs Number of inputs.
+ * @param A The system matrix.
+ * @param B The input matrix.
+ * @param Q The state cost matrix.
+ * @param R The input cost matrix.
+ * @param guess Initial guess, typically the solution for a nearby plant.
+ * @return Solution of DARE.
+ */
+template <int States, int Inputs>
+Matrixd<States, States> DARE(const Matrixd<States, States>& A,
+                             const Matrixd<States, Inputs>& B,
+                             const Matrixd<States, States>& Q,
+                             const Matrixd<Inputs, Inputs>& R,
+                             const Matrixd<States, States>& guess) {
+  using StateMatrix = Matrixd<States, States>;
+
+  StateMatrix X = guess;
+  for (int i = 0; i < 10; ++i) {
+    // K = (BᵀXB + R)⁻¹BᵀXA for the current estimate
+    Matrixd<Inputs, States> K =
+        (B.transpose() * X * B + R).llt().solve(B.transpose() * X * A);
+
+    // solve X' = AᵀclX'Acl + Q + KᵀRK by doubling:
+    //   X'ⱼ₊₁ = X'ⱼ + PⱼᵀX'ⱼPⱼ,  Pⱼ₊₁ = Pⱼ²,  P₀ = Acl
+    StateMatrix P = A - B * K;
+    StateMatrix X_k1 = Q + K.transpose() * R * K;
+    bool diverged = false;
+    for (int j = 0; j < 64 && P.norm() > 1e-12; ++j) {
+      X_k1 += P.transpose() * X_k1 * P;
+      P *= P;
+      if (!(X_k1.norm() < 1e30)) {
+        // Acl is not stable; the guess doesn't stabilize the plant
+        diverged = true;
+        break;
+      }
+    }
+    if (diverged) {
+      break;
+    }
+    if ((X_k1 - X).norm() <= 1e-10 * X_k1.norm()) {
+      return X_k1;
+    }
+    X = X_k1;
+  }
+  // guess was too far away; do a cold solve instead
+  return DARE<States, Inputs>(A, B, Q, R);
+}
+
+}  // namespace frc
@@ -0,0 +1,138 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <array>
+
+#include <wpi/SymbolExports.h>
+
+#include "frc/controller/DifferentialDriveWheelVoltages.h"
+#include "frc/controller/PIDController.h"
+#include "frc/controller/SimpleMotorFeedforward.h"
+#include "units/length.h"
+#include "units/time.h"
+#include "units/velocity.h"
+#include "units/voltage.h"
+
+namespace frc {
+
+/**
+ * Closed-loop velocity helper for differential drivetrains.
+ *
+ * Combines joystick shaping, per-side feedforward, and per-side velocity PID
+ * into a single call so an inner velocity loop only does one pass of work per
+ * iteration. The deadband and input squaring are precomputed into a lookup
+ * table when configured, so the per-call cost of shaping is a table
+ * interpolation instead of branch-heavy deadband math.
+ *
+ * Joystick-shaped setpoints are produced the same way as
+ * DifferentialDrive::TankDrive(): the deadband is removed with the remaining
+ * range rescaled to full output, and inputs are optionally squared to decrease
+ * sensitivity at low speeds.
+ */
+class WPILIB_DLLEXPORT DifferentialDriveVelocityController {
+ public:
+  /**
+   * Constructs a DifferentialDriveVelocityController.
+   *
+   * The same PID gains are applied to both sides; the two sides keep
+   * independent controller state.
+   *
+   * @param feedforward The feedforward shared by both sides.
+   * @param maxSpeed The speed a full-scale joystick input maps to.
+   * @param Kp The proportional coefficient, in volt seconds per meter.
+   * @param Ki The integral coefficient.
+   * @param Kd The differential coefficient.
+   * @param period The period between controller updates.
+   */
+  DifferentialDriveVelocityController(
+      const SimpleMotorFeedforward<units::meters>& feedforward,
+      units::meters_per_second_t maxSpeed, double Kp, double Ki, double Kd,
+      units::second_t period = 20_ms);
+
+  /**
+   * Sets the input deadband and rebuilds the shaping table. Inputs smaller
+   * than the deadband map to zero, and larger values are rescaled so the full
+   * output range is still used.
+   *
+   * @param deadband The deadband to apply to the joystick inputs [0..1).
+   */
+  void SetDeadband(double deadband);
+
+  /**
+   * Sets whether joystick inputs are squared (decreasing sensitivity at low
+   * speeds) and rebuilds the shaping table.
+   *
+   * @param squareInputs Whether to square the inputs.
+   */
+  void SetSquareInputs(bool squareInputs);
+
+  /**
+   * Calculates both sides' output voltages from joystick inputs in one pass:
+   * the inputs are shaped through the precomputed table into velocity
+   * setpoints, and each side's feedforward and PID are evaluated against the
+   * measured velocity.
+   *
+   * @param leftInput The left joystick input [-1.0..1.0]. Forward is positive.
+   * @param rightInput The right joystick input [-1.0..1.0]. Forward is
+   *                   positive.
+   * @param leftVelocity The measured left side velocity.
+   * @param rightVelocity The measured right side velocity.
+   * @return The voltages to apply to each side.
+   */
+  DifferentialDriveWheelVoltages Calculate(
+      double leftInput, double rightInput,
+      units::meters_per_second_t leftVelocity,
+      units::meters_per_second_t rightVelocity);
+
+  /**
+   * Calculates both sides' output voltages from velocity setpoints, skipping
+   * joystick shaping. This overload is intended for trajectory followers that
+   * already produce wheel velocity setpoints.
+   *
+   * @param leftSetpoint The left side velocity setpoint.
+   * @param rightSetpoint The right side velocity setpoint.
+   * @param leftVelocity The measured left side velocity.
+   * @param rightVelocity The measured right side velocity.
+   * @return The voltages to apply to each side.
+   */
+  DifferentialDriveWheelVoltages Calculate(
+      units::meters_per_second_t leftSetpoint,
+      units::meters_per_second_t rightSetpoint,
+      units::meters_per_second_t leftVelocity,
+      units::meters_per_second_t rightVelocity);
+
+  /**
+   * Resets both sides' controller state (e.g. after being disabled).
+   */
+  void Reset();
+
+  /**
+   * Shapes a joystick input through the precomputed deadband/squaring table.
+   *
+   * @param input The joystick input [-1.0..1.0].
+   * @return The shaped input [-1.0..1.0].
+   */
+  double Shape(double input) const;
+
+ private:
+  static constexpr int kShapingTableSize = 256;
+
+  void RebuildShapingTable();
+
+  SimpleMotorFeedforward<units::meters> m_feedforward;
+  units::meters_per_second_t m_maxSpeed;
+  PIDController m_leftController;
+  PIDController m_rightController;
+
+  double m_deadband = 0.02;
+  bool m_squareInputs = true;
+
+  // shaped output for evenly spaced |input| values in [0..1]; lookups
+  // linearly interpolate between adjacent entries and apply the input's sign
+  std::array<double, kShapingTableSize> m_shapingTable;
+};
+
+}  // namespace frc
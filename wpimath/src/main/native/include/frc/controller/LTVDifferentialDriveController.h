@@ -6,7 +6,7 @@
 
 #include <wpi/SymbolExports.h>
 #include <wpi/array.h>
-#include <wpi/interpolating_map.h>
+#include <wpi/flat_interpolating_map.h>
 
 #include "frc/EigenCore.h"
 #include "frc/controller/DifferentialDriveWheelVoltages.h"
@@ -115,8 +115,10 @@ class WPILIB_DLLEXPORT LTVDifferentialDriveController {
  private:
   units::meter_t m_trackwidth;
 
-  // LUT from drivetrain linear velocity to LQR gain
-  wpi::interpolating_map<units::meters_per_second_t, Matrixd<2, 5>> m_table;
+  // LUT from drivetrain linear velocity to LQR gain; flat storage keeps the
+  // per-Calculate lookup contiguous in cache
+  wpi::flat_interpolating_map<units::meters_per_second_t, Matrixd<2, 5>>
+      m_table;
 
   Vectord<5> m_error;
   Vectord<5> m_tolerance;
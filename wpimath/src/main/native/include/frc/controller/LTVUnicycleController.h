@@ -6,7 +6,7 @@
 
 #include <wpi/SymbolExports.h>
 #include <wpi/array.h>
-#include <wpi/interpolating_map.h>
+#include <wpi/flat_interpolating_map.h>
 
 #include "frc/EigenCore.h"
 #include "frc/geometry/Pose2d.h"
@@ -112,8 +112,10 @@ class WPILIB_DLLEXPORT LTVUnicycleController {
   void SetEnabled(bool enabled);
 
  private:
-  // LUT from drivetrain linear velocity to LQR gain
-  wpi::interpolating_map<units::meters_per_second_t, Matrixd<2, 3>> m_table;
+  // LUT from drivetrain linear velocity to LQR gain; flat storage keeps the
+  // per-Calculate lookup contiguous in cache
+  wpi::flat_interpolating_map<units::meters_per_second_t, Matrixd<2, 3>>
+      m_table;
 
   Pose2d m_poseError;
   Pose2d m_poseTolerance;
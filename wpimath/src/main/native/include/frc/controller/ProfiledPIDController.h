@@ -289,8 +289,24 @@ class ProfiledPIDController
       m_setpoint.position = setpointMinDistance + measurement;
     }
 
-    frc::TrapezoidProfile<Distance> profile{m_constraints, m_goal, m_setpoint};
-    m_setpoint = profile.Calculate(GetPeriod());
+    // Only re-plan the profile when the goal, constraints, or setpoint have
+    // changed since it was planned (e.g. after Reset() or a continuous-input
+    // wraparound). Otherwise the setpoint lies on the cached profile and we
+    // just advance along it, skipping the profile math.
+    if (!m_hasProfile || m_goal != m_profileGoal ||
+        m_setpoint != m_profileSetpoint ||
+        m_constraints.maxVelocity != m_profileConstraints.maxVelocity ||
+        m_constraints.maxAcceleration != m_profileConstraints.maxAcceleration) {
+      m_profile = frc::TrapezoidProfile<Distance>{m_constraints, m_goal,
+                                                  m_setpoint};
+      m_profileTime = 0_s;
+      m_profileGoal = m_goal;
+      m_profileConstraints = m_constraints;
+      m_hasProfile = true;
+    }
+    m_profileTime += GetPeriod();
+    m_setpoint = m_profile.Calculate(m_profileTime);
+    m_profileSetpoint = m_setpoint;
     return m_controller.Calculate(measurement.value(),
                                   m_setpoint.position.value());
   }
@@ -380,6 +396,16 @@ class ProfiledPIDController
   typename frc::TrapezoidProfile<Distance>::State m_goal;
   typename frc::TrapezoidProfile<Distance>::State m_setpoint;
   typename frc::TrapezoidProfile<Distance>::Constraints m_constraints;
+
+  // Cached profile and the goal, constraints, and last output it was planned
+  // with, so Calculate() can tell when a re-plan is needed.
+  frc::TrapezoidProfile<Distance> m_profile{m_constraints, m_goal, m_setpoint};
+  units::second_t m_profileTime{0};
+  typename frc::TrapezoidProfile<Distance>::State m_profileGoal;
+  typename frc::TrapezoidProfile<Distance>::State m_profileSetpoint;
+  typename frc::TrapezoidProfile<Distance>::Constraints m_profileConstraints =
+      m_constraints;
+  bool m_hasProfile = false;
 };
 
 }  // namespace frc
@@ -39,7 +39,7 @@ Vectord<States> AngleResidual(const Vectord<States>& a,
 template <int States>
 std::function<Vectord<States>(const Vectord<States>&, const Vectord<States>&)>
 AngleResidual(int angleStateIdx) {
-  return [=](auto a, auto b) {
+  return [=](const auto& a, const auto& b) {
     return AngleResidual<States>(a, b, angleStateIdx);
   };
 }
@@ -72,7 +72,9 @@ Vectord<States> AngleAdd(const Vectord<States>& a, const Vectord<States>& b,
 template <int States>
 std::function<Vectord<States>(const Vectord<States>&, const Vectord<States>&)>
 AngleAdd(int angleStateIdx) {
-  return [=](auto a, auto b) { return AngleAdd<States>(a, b, angleStateIdx); };
+  return [=](const auto& a, const auto& b) {
+    return AngleAdd<States>(a, b, angleStateIdx);
+  };
 }
 
 /**
@@ -119,7 +121,7 @@ template <int CovDim, int States>
 std::function<Vectord<CovDim>(const Matrixd<CovDim, 2 * States + 1>&,
                               const Vectord<2 * States + 1>&)>
 AngleMean(int angleStateIdx) {
-  return [=](auto sigmas, auto Wm) {
+  return [=](const auto& sigmas, const auto& Wm) {
     return AngleMean<CovDim, States>(sigmas, Wm, angleStateIdx);
   };
 }
@@ -143,6 +143,24 @@ class ExtendedKalmanFilter {
   void Reset() {
     m_xHat.setZero();
     m_P = m_initP;
+    m_discValid = false;
+  }
+
+  /**
+   * Sets how far the state estimate may move (infinity norm) before Predict()
+   * relinearizes the model and re-discretizes A and Q.
+   *
+   * The default of zero re-discretizes on every call. A small nonzero
+   * threshold reuses the cached discretization while the linearization point
+   * is nearly unchanged, which skips the Jacobian evaluation and the Taylor
+   * series entirely; choose it well below the state scale at which your
+   * dynamics' Jacobian meaningfully changes. A change of control input or
+   * timestep always re-discretizes.
+   *
+   * @param epsilon Maximum state change before relinearizing.
+   */
+  void SetRelinearizationThreshold(double epsilon) {
+    m_relinearizationThreshold = epsilon;
   }
 
   /**
@@ -208,6 +226,16 @@ class ExtendedKalmanFilter {
   units::second_t m_dt;
 
   StateMatrix m_initP;
+
+  // Cached discretization, reused while the linearization point stays within
+  // m_relinearizationThreshold of where it was computed
+  StateMatrix m_discA;
+  StateMatrix m_discQ;
+  StateVector m_linearizationX;
+  InputVector m_linearizationU;
+  units::second_t m_linearizationDt;
+  bool m_discValid = false;
+  double m_relinearizationThreshold = 0.0;
 };
 
 }  // namespace frc
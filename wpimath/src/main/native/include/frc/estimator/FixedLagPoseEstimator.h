@@ -0,0 +1,199 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <vector>
+
+#include <wpi/SymbolExports.h>
+#include <wpi/array.h>
+
+#include "frc/EigenCore.h"
+#include "frc/geometry/Pose2d.h"
+#include "frc/geometry/Transform2d.h"
+#include "units/time.h"
+
+namespace frc {
+/**
+ * A fixed-lag smoother for fusing vision measurements with odometry. This is
+ * an alternative to the Kalman filter based pose estimators that keeps a short
+ * sliding window of recent poses instead of a single state estimate.
+ *
+ * Consecutive poses in the window are connected by odometry factors, and
+ * vision measurements (e.g. multi-tag AprilTag solves) attach to the pose
+ * closest in time, which gives latency compensation without extrapolating the
+ * measurement forward. Each vision measurement triggers a Gauss-Newton solve
+ * over the whole window, so every measurement still inside the lag window is
+ * re-evaluated against the current estimate: a vision outlier is down-weighted
+ * (via a Huber loss) on the next solve rather than permanently folded into the
+ * state as it would be in a filter.
+ *
+ * Because the factor graph is a chain with unary measurement factors, the
+ * normal equations are block-tridiagonal and are solved with a block Cholesky
+ * sweep. Per-update cost is therefore linear in the window size - bounded and
+ * predictable, suitable for the roboRIO.
+ *
+ * This class is drivetrain-agnostic: feed it the pose reported by any odometry
+ * class (e.g. DifferentialDriveOdometry or SwerveDriveOdometry) every loop via
+ * Update(), and the smoother works with the relative motion between
+ * consecutive odometry poses.
+ *
+ * AddVisionMeasurement() can be called as infrequently as you want; if you
+ * never call it, then this class will behave like regular encoder odometry.
+ */
+class WPILIB_DLLEXPORT FixedLagPoseEstimator {
+ public:
+  /**
+   * Constructs a FixedLagPoseEstimator.
+   *
+   * @param windowSize              The number of poses kept in the sliding
+   *                                window. With a 20 ms loop, a window of 50
+   *                                gives a 1 second lag. Larger windows accept
+   *                                older vision measurements at higher
+   *                                per-solve cost. Must be at least 2.
+   * @param initialPose             The starting pose estimate.
+   * @param odometryStdDevs         Standard deviations of the relative
+   *                                odometry motion between consecutive loops.
+   *                                Increase these numbers to trust the
+   *                                odometry less. This matrix is in the form
+   *                                [x, y, theta]ᵀ, with units in meters and
+   *                                radians.
+   * @param visionMeasurementStdDevs Standard deviations of the vision
+   *                                measurements. Increase these numbers to
+   *                                trust global measurements from vision
+   *                                less. This matrix is in the form
+   *                                [x, y, theta]ᵀ, with units in meters and
+   *                                radians.
+   */
+  FixedLagPoseEstimator(size_t windowSize, const Pose2d& initialPose,
+                        const wpi::array<double, 3>& odometryStdDevs,
+                        const wpi::array<double, 3>& visionMeasurementStdDevs);
+
+  /**
+   * Sets the pose estimator's trust of global measurements. This might be used
+   * to change trust in vision measurements after the autonomous period, or to
+   * change trust as distance to a vision target increases.
+   *
+   * Only affects measurements added after this call.
+   *
+   * @param visionMeasurementStdDevs Standard deviations of the vision
+   *                                 measurements. Increase these numbers to
+   *                                 trust global measurements from vision
+   *                                 less. This matrix is in the form
+   *                                 [x, y, theta]ᵀ, with units in meters and
+   *                                 radians.
+   */
+  void SetVisionMeasurementStdDevs(
+      const wpi::array<double, 3>& visionMeasurementStdDevs);
+
+  /**
+   * Resets the robot's position on the field. This clears the window, so
+   * vision measurements older than the reset are discarded.
+   *
+   * @param pose The position on the field that your robot is at.
+   */
+  void ResetPosition(const Pose2d& pose);
+
+  /**
+   * Gets the latest smoothed pose of the robot.
+   *
+   * @return The estimated robot pose in meters.
+   */
+  Pose2d GetEstimatedPosition() const;
+
+  /**
+   * Adds a vision measurement to the smoother and re-solves the window. The
+   * measurement is attached to the pose in the window closest to the given
+   * timestamp; measurements older than the window are ignored.
+   *
+   * @param visionRobotPose The pose of the robot as measured by the vision
+   *                        camera.
+   * @param timestamp       The timestamp of the vision measurement in seconds.
+   *                        Note that if you don't use your own time source by
+   *                        calling UpdateWithTime() then you must use a
+   *                        timestamp with an epoch since FPGA startup
+   *                        (i.e. the epoch of this timestamp is the same
+   *                        epoch as Timer#GetFPGATimestamp.) This means
+   *                        that you should use Timer#GetFPGATimestamp as your
+   *                        time source or sync the epochs.
+   */
+  void AddVisionMeasurement(const Pose2d& visionRobotPose,
+                            units::second_t timestamp);
+
+  /**
+   * Adds a vision measurement to the smoother and re-solves the window.
+   *
+   * Note that the vision measurement standard deviations passed into this
+   * method will continue to apply to future measurements until a subsequent
+   * call to SetVisionMeasurementStdDevs() or this method.
+   *
+   * @param visionRobotPose          The pose of the robot as measured by the
+   *                                 vision camera.
+   * @param timestamp                The timestamp of the vision measurement in
+   *                                 seconds.
+   * @param visionMeasurementStdDevs Standard deviations of the vision
+   *                                 measurements. This matrix is in the form
+   *                                 [x, y, theta]ᵀ, with units in meters and
+   *                                 radians.
+   */
+  void AddVisionMeasurement(
+      const Pose2d& visionRobotPose, units::second_t timestamp,
+      const wpi::array<double, 3>& visionMeasurementStdDevs);
+
+  /**
+   * Advances the smoother with the latest odometry pose. This should be
+   * called every robot loop.
+   *
+   * @param odometryPose The pose reported by the odometry class.
+   * @return The estimated pose of the robot in meters.
+   */
+  Pose2d Update(const Pose2d& odometryPose);
+
+  /**
+   * Advances the smoother with the latest odometry pose. This should be
+   * called every robot loop.
+   *
+   * @param currentTime  Time at which this method was called, in seconds.
+   * @param odometryPose The pose reported by the odometry class.
+   * @return The estimated pose of the robot in meters.
+   */
+  Pose2d UpdateWithTime(units::second_t currentTime,
+                        const Pose2d& odometryPose);
+
+ private:
+  struct VisionMeasurement {
+    // measured [x, y, theta]
+    Vectord<3> y;
+    // information matrix (inverse covariance) at measurement time
+    Eigen::Matrix3d info;
+  };
+
+  struct Node {
+    units::second_t time;
+    // raw odometry pose at this node; deltas between consecutive raw poses
+    // form the odometry factors
+    Pose2d odometryPose;
+    // odometry motion from the previous node, in the previous node's frame
+    Transform2d delta;
+    // smoothed estimate
+    Pose2d estimate;
+    std::vector<VisionMeasurement> vision;
+  };
+
+  // Gauss-Newton solve over the window. The oldest node is held fixed as the
+  // anchor, so the system is block-tridiagonal in the remaining nodes.
+  void Optimize();
+
+  size_t m_windowSize;
+  std::vector<Node> m_nodes;
+
+  Eigen::Matrix3d m_odometryInfo;
+  Eigen::Matrix3d m_visionInfo;
+
+  // estimate to seed the first node with (initial pose, or pose from
+  // ResetPosition())
+  Pose2d m_seedPose;
+};
+
+}  // namespace frc
@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <array>
 #include <functional>
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -34,9 +35,12 @@ class KalmanFilterLatencyCompensator {
   };
 
   /**
-   * Clears the observer snapshot buffer.
+   * Clears the observer snapshot buffer and any queued global measurements.
    */
-  void Reset() { m_pastObserverSnapshots.clear(); }
+  void Reset() {
+    m_pastObserverSnapshots.clear();
+    m_queuedGlobalMeasurements.clear();
+  }
 
   /**
    * Add past observer states to the observer snapshots list.
@@ -81,46 +85,14 @@ class KalmanFilterLatencyCompensator {
       return;
     }
 
-    // Perform a binary search to find the index of first snapshot whose
-    // timestamp is greater than or equal to the global measurement timestamp
-    auto it = std::lower_bound(
-        m_pastObserverSnapshots.cbegin(), m_pastObserverSnapshots.cend(),
-        timestamp,
-        [](const auto& entry, const auto& ts) { return entry.first < ts; });
-
-    size_t indexOfClosestEntry;
-
-    if (it == m_pastObserverSnapshots.cbegin()) {
+    auto closestEntry = IndexOfClosestEntry(timestamp);
+    if (!closestEntry) {
       // If the global measurement is older than any snapshot, throw out the
       // measurement because there's no state estimate into which to incorporate
       // the measurement
-      if (timestamp < it->first) {
-        return;
-      }
-
-      // If the first snapshot has same timestamp as the global measurement, use
-      // that snapshot
-      indexOfClosestEntry = 0;
-    } else if (it == m_pastObserverSnapshots.cend()) {
-      // If all snapshots are older than the global measurement, use the newest
-      // snapshot
-      indexOfClosestEntry = m_pastObserverSnapshots.size() - 1;
-    } else {
-      // Index of snapshot taken after the global measurement
-      int nextIdx = std::distance(m_pastObserverSnapshots.cbegin(), it);
-
-      // Index of snapshot taken before the global measurement. Since we already
-      // handled the case where the index points to the first snapshot, this
-      // computation is guaranteed to be nonnegative.
-      int prevIdx = nextIdx - 1;
-
-      // Find the snapshot closest in time to global measurement
-      units::second_t prevTimeDiff =
-          units::math::abs(timestamp - m_pastObserverSnapshots[prevIdx].first);
-      units::second_t nextTimeDiff =
-          units::math::abs(timestamp - m_pastObserverSnapshots[nextIdx].first);
-      indexOfClosestEntry = prevTimeDiff < nextTimeDiff ? prevIdx : nextIdx;
+      return;
     }
+    size_t indexOfClosestEntry = closestEntry.value();
 
     units::second_t lastTimestamp =
         m_pastObserverSnapshots[indexOfClosestEntry].first - nominalDt;
@@ -157,9 +129,159 @@ class KalmanFilterLatencyCompensator {
     }
   }
 
+  /**
+   * Queue a past global measurement for a later batched replay.
+   *
+   * ApplyPastGlobalMeasurement() replays every snapshot from the measurement
+   * timestamp to the present, so N measurements per loop cost N replays. When
+   * several measurements arrive in one loop iteration (e.g. multiple
+   * cameras), queue them all with this method and call
+   * ApplyQueuedGlobalMeasurements() once; the snapshots are then replayed a
+   * single time with each measurement incorporated at its own timestamp.
+   *
+   * @param y                        The measurement.
+   * @param globalMeasurementCorrect The function that calls correct() on the
+   *                                 observer.
+   * @param timestamp                The timestamp of the measurement.
+   */
+  template <int Rows>
+  void QueuePastGlobalMeasurement(
+      Vectord<Rows> y,
+      std::function<void(const Vectord<Inputs>& u, const Vectord<Rows>& y)>
+          globalMeasurementCorrect,
+      units::second_t timestamp) {
+    m_queuedGlobalMeasurements.emplace_back(
+        timestamp, [y = std::move(y), correct = std::move(
+                                          globalMeasurementCorrect)](
+                       const Vectord<Inputs>& u) { correct(u, y); });
+  }
+
+  /**
+   * Apply all queued global measurements in one replay of the snapshot
+   * buffer.
+   *
+   * The queued measurements are sorted by timestamp, measurements sharing a
+   * timestamp are corrected back-to-back at the same snapshot, and the
+   * observer states from the oldest measurement onward are re-integrated
+   * exactly once: O(buffer) instead of O(measurements * buffer)
+   * predict-correct steps for applying the measurements one at a time with
+   * ApplyPastGlobalMeasurement().
+   *
+   * @param observer  The observer to apply the queued global measurements.
+   * @param nominalDt The nominal timestep.
+   */
+  void ApplyQueuedGlobalMeasurements(KalmanFilterType* observer,
+                                     units::second_t nominalDt) {
+    if (m_queuedGlobalMeasurements.empty()) {
+      return;
+    }
+    if (m_pastObserverSnapshots.empty()) {
+      // State map was empty, which means that we got measurements right at
+      // startup. The only thing we can do is ignore them.
+      m_queuedGlobalMeasurements.clear();
+      return;
+    }
+
+    // Sort by timestamp so one forward pass visits the measurements in
+    // order; stable so same-timestamp measurements merge in arrival order.
+    std::stable_sort(
+        m_queuedGlobalMeasurements.begin(), m_queuedGlobalMeasurements.end(),
+        [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    // Resolve each measurement to the snapshot closest to its timestamp,
+    // dropping measurements older than the oldest snapshot. The snapshot
+    // indices are nondecreasing because the queue is sorted.
+    std::vector<std::pair<size_t, std::function<void(const Vectord<Inputs>&)>>>
+        corrections;
+    corrections.reserve(m_queuedGlobalMeasurements.size());
+    for (auto& [timestamp, correct] : m_queuedGlobalMeasurements) {
+      if (auto index = IndexOfClosestEntry(timestamp)) {
+        corrections.emplace_back(index.value(), std::move(correct));
+      }
+    }
+    m_queuedGlobalMeasurements.clear();
+    if (corrections.empty()) {
+      return;
+    }
+
+    size_t startIndex = corrections.front().first;
+    units::second_t lastTimestamp =
+        m_pastObserverSnapshots[startIndex].first - nominalDt;
+    size_t nextCorrection = 0;
+
+    for (size_t i = startIndex; i < m_pastObserverSnapshots.size(); ++i) {
+      auto& [key, snapshot] = m_pastObserverSnapshots[i];
+
+      if (i == startIndex) {
+        observer->SetS(snapshot.squareRootErrorCovariances);
+        observer->SetXhat(snapshot.xHat);
+      }
+
+      observer->Predict(snapshot.inputs, key - lastTimestamp);
+      observer->Correct(snapshot.inputs, snapshot.localMeasurements);
+
+      while (nextCorrection < corrections.size() &&
+             corrections[nextCorrection].first == i) {
+        corrections[nextCorrection].second(snapshot.inputs);
+        ++nextCorrection;
+      }
+
+      lastTimestamp = key;
+      snapshot = ObserverSnapshot{*observer, snapshot.inputs,
+                                  snapshot.localMeasurements};
+    }
+  }
+
  private:
   static constexpr size_t kMaxPastObserverStates = 300;
   std::vector<std::pair<units::second_t, ObserverSnapshot>>
       m_pastObserverSnapshots;
+  std::vector<std::pair<units::second_t,
+                        std::function<void(const Vectord<Inputs>&)>>>
+      m_queuedGlobalMeasurements;
+
+  /**
+   * Finds the index of the snapshot closest in time to the given timestamp,
+   * or std::nullopt if the timestamp is older than every snapshot.
+   */
+  std::optional<size_t> IndexOfClosestEntry(units::second_t timestamp) const {
+    // Perform a binary search to find the index of first snapshot whose
+    // timestamp is greater than or equal to the global measurement timestamp
+    auto it = std::lower_bound(
+        m_pastObserverSnapshots.cbegin(), m_pastObserverSnapshots.cend(),
+        timestamp,
+        [](const auto& entry, const auto& ts) { return entry.first < ts; });
+
+    if (it == m_pastObserverSnapshots.cbegin()) {
+      // If the global measurement is older than any snapshot, there's no
+      // state estimate into which to incorporate the measurement
+      if (timestamp < it->first) {
+        return std::nullopt;
+      }
+
+      // If the first snapshot has same timestamp as the global measurement,
+      // use that snapshot
+      return 0;
+    } else if (it == m_pastObserverSnapshots.cend()) {
+      // If all snapshots are older than the global measurement, use the
+      // newest snapshot
+      return m_pastObserverSnapshots.size() - 1;
+    } else {
+      // Index of snapshot taken after the global measurement
+      size_t nextIdx = std::distance(m_pastObserverSnapshots.cbegin(), it);
+
+      // Index of snapshot taken before the global measurement. Since we
+      // already handled the case where the index points to the first
+      // snapshot, this computation is guaranteed to be nonnegative.
+      size_t prevIdx = nextIdx - 1;
+
+      // Find the snapshot closest in time to global measurement
+      units::second_t prevTimeDiff =
+          units::math::abs(timestamp - m_pastObserverSnapshots[prevIdx].first);
+      units::second_t nextTimeDiff =
+          units::math::abs(timestamp - m_pastObserverSnapshots[nextIdx].first);
+      return prevTimeDiff < nextTimeDiff ? prevIdx : nextIdx;
+    }
+  }
 };
 }  // namespace frc
@@ -114,6 +114,46 @@ class UnscentedKalmanFilter {
           addFuncX,
       units::second_t dt);
 
+  /**
+   * Sets a batched version of the process model used to propagate the sigma
+   * points in Predict().
+   *
+   * The callback receives all 2 * States + 1 sigma points as the columns of a
+   * matrix and returns the matrix of column-wise state derivatives. This lets
+   * the model evaluate all sigma points in one fused Eigen expression instead
+   * of being dispatched once per sigma point. It must compute the same
+   * dynamics as the f passed to the constructor, which is still used for the
+   * process noise discretization Jacobian.
+   *
+   * @param batchF A matrix-valued function of the sigma points and u that
+   *               returns the column-wise derivatives of the sigma points.
+   */
+  void SetBatchedF(
+      std::function<Matrixd<States, 2 * States + 1>(
+          const Matrixd<States, 2 * States + 1>&, const InputVector&)>
+          batchF) {
+    m_batchF = batchF;
+  }
+
+  /**
+   * Sets a batched version of the measurement model used to transform the
+   * sigma points in Correct().
+   *
+   * The callback receives all 2 * States + 1 sigma points as the columns of a
+   * matrix and returns the matrix of column-wise measurements. It must
+   * compute the same measurements as the h passed to the constructor, and is
+   * only used by the two-argument version of Correct().
+   *
+   * @param batchH A matrix-valued function of the sigma points and u that
+   *               returns the column-wise measurements of the sigma points.
+   */
+  void SetBatchedH(
+      std::function<Matrixd<Outputs, 2 * States + 1>(
+          const Matrixd<States, 2 * States + 1>&, const InputVector&)>
+          batchH) {
+    m_batchH = batchH;
+  }
+
   /**
    * Returns the square-root error covariance matrix S.
    */
@@ -199,7 +239,7 @@ class UnscentedKalmanFilter {
    */
   void Correct(const InputVector& u, const OutputVector& y) {
     Correct<Outputs>(u, y, m_h, m_contR, m_meanFuncY, m_residualFuncY,
-                     m_residualFuncX, m_addFuncX);
+                     m_residualFuncX, m_addFuncX, m_batchH);
   }
 
   /**
@@ -240,6 +280,10 @@ class UnscentedKalmanFilter {
    * @param residualFuncX A function that computes the residual of two state
    *                      vectors (i.e. it subtracts them.)
    * @param addFuncX      A function that adds two state vectors.
+   * @param batchH        An optional matrix-valued function of the sigma
+   *                      points and u that returns the column-wise
+   *                      measurements of the sigma points. If provided, it's
+   *                      used instead of dispatching h once per sigma point.
    */
   template <int Rows>
   void Correct(
@@ -254,7 +298,10 @@ class UnscentedKalmanFilter {
       std::function<StateVector(const StateVector&, const StateVector&)>
           residualFuncX,
       std::function<StateVector(const StateVector&, const StateVector&)>
-          addFuncX);
+          addFuncX,
+      std::function<Matrixd<Rows, 2 * States + 1>(
+          const Matrixd<States, 2 * States + 1>&, const InputVector&)>
+          batchH = nullptr);
 
  private:
   std::function<StateVector(const StateVector&, const InputVector&)> m_f;
@@ -270,6 +317,12 @@ class UnscentedKalmanFilter {
   std::function<OutputVector(const OutputVector&, const OutputVector&)>
       m_residualFuncY;
   std::function<StateVector(const StateVector&, const StateVector&)> m_addFuncX;
+  std::function<Matrixd<States, 2 * States + 1>(
+      const Matrixd<States, 2 * States + 1>&, const InputVector&)>
+      m_batchF;
+  std::function<Matrixd<Outputs, 2 * States + 1>(
+      const Matrixd<States, 2 * States + 1>&, const InputVector&)>
+      m_batchH;
   StateVector m_xHat;
   StateMatrix m_S;
   StateMatrix m_contQ;
@@ -12,7 +12,6 @@
 #include <vector>
 
 #include <wpi/array.h>
-#include <wpi/circular_buffer.h>
 
 #include "Eigen/QR"
 #include "frc/EigenCore.h"
@@ -81,17 +80,10 @@ class LinearFilter {
    * @param fbGains The "feedback" or IIR gains.
    */
   LinearFilter(std::span<const double> ffGains, std::span<const double> fbGains)
-      : m_inputs(ffGains.size()),
-        m_outputs(fbGains.size()),
+      : m_inputs(ffGains.size(), T{0.0}),
+        m_outputs(fbGains.size(), T{0.0}),
         m_inputGains(ffGains.begin(), ffGains.end()),
         m_outputGains(fbGains.begin(), fbGains.end()) {
-    for (size_t i = 0; i < ffGains.size(); ++i) {
-      m_inputs.emplace_front(0.0);
-    }
-    for (size_t i = 0; i < fbGains.size(); ++i) {
-      m_outputs.emplace_front(0.0);
-    }
-
     static int instances = 0;
     instances++;
     wpi::math::MathSharedStore::ReportUsage(
@@ -281,9 +273,13 @@ class LinearFilter {
   T Calculate(T input) {
     T retVal{0.0};
 
-    // Rotate the inputs
+    // Rotate the inputs. The histories are stored newest-first in contiguous
+    // vectors rather than circular buffers so the tap loops below are plain
+    // strided dot products the compiler can vectorize; the shift is one small
+    // memmove.
     if (m_inputGains.size() > 0) {
-      m_inputs.push_front(input);
+      std::copy_backward(m_inputs.begin(), m_inputs.end() - 1, m_inputs.end());
+      m_inputs[0] = input;
     }
 
     // Calculate the new value
@@ -296,15 +292,17 @@ class LinearFilter {
 
     // Rotate the outputs
     if (m_outputGains.size() > 0) {
-      m_outputs.push_front(retVal);
+      std::copy_backward(m_outputs.begin(), m_outputs.end() - 1,
+                         m_outputs.end());
+      m_outputs[0] = retVal;
     }
 
     return retVal;
   }
 
  private:
-  wpi::circular_buffer<T> m_inputs;
-  wpi::circular_buffer<T> m_outputs;
+  std::vector<T> m_inputs;
+  std::vector<T> m_outputs;
   std::vector<double> m_inputGains;
   std::vector<double> m_outputGains;
 
@@ -40,11 +40,12 @@ class MedianFilter {
     size_t curSize = m_orderedValues.size();
 
     // If buffer is at max size, pop element off of end of circular buffer
-    // and remove from ordered list
+    // and remove from ordered list. The list is sorted, so binary search for
+    // the value instead of scanning.
     if (curSize > m_size) {
-      m_orderedValues.erase(std::find(m_orderedValues.begin(),
-                                      m_orderedValues.end(),
-                                      m_valueBuffer.pop_back()));
+      m_orderedValues.erase(std::lower_bound(m_orderedValues.begin(),
+                                             m_orderedValues.end(),
+                                             m_valueBuffer.pop_back()));
       --curSize;
     }
 
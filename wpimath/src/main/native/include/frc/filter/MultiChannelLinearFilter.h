@@ -0,0 +1,130 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <algorithm>
+#include <initializer_list>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace frc {
+
+/**
+ * Applies the same linear FIR or IIR filter to several channels at once.
+ *
+ * This is equivalent to one LinearFilter per channel, but the tap histories
+ * for all channels are stored contiguously (tap-major) and each Calculate()
+ * call filters every channel in one pass, so the per-tap inner loops are
+ * contiguous multiply-adds across channels that the compiler can vectorize.
+ * Useful when filtering a sensor array on a tight loop period.
+ *
+ * See LinearFilter for the filter equation and gain conventions.
+ */
+template <class T>
+class MultiChannelLinearFilter {
+ public:
+  /**
+   * Create a multi-channel linear FIR or IIR filter.
+   *
+   * @param channelCount The number of channels to filter.
+   * @param ffGains      The "feedforward" or FIR gains, shared by every
+   *                     channel.
+   * @param fbGains      The "feedback" or IIR gains, shared by every channel.
+   * @throws std::invalid_argument if the channel count is zero.
+   */
+  MultiChannelLinearFilter(size_t channelCount, std::span<const double> ffGains,
+                           std::span<const double> fbGains)
+      : m_channelCount(channelCount),
+        m_inputs(ffGains.size() * channelCount, T{0.0}),
+        m_outputs(fbGains.size() * channelCount, T{0.0}),
+        m_inputGains(ffGains.begin(), ffGains.end()),
+        m_outputGains(fbGains.begin(), fbGains.end()) {
+    if (channelCount == 0) {
+      throw std::invalid_argument("Channel count must be greater than zero.");
+    }
+  }
+
+  /**
+   * Create a multi-channel linear FIR or IIR filter.
+   *
+   * @param channelCount The number of channels to filter.
+   * @param ffGains      The "feedforward" or FIR gains, shared by every
+   *                     channel.
+   * @param fbGains      The "feedback" or IIR gains, shared by every channel.
+   */
+  MultiChannelLinearFilter(size_t channelCount,
+                           std::initializer_list<double> ffGains,
+                           std::initializer_list<double> fbGains)
+      : MultiChannelLinearFilter(channelCount,
+                                 {ffGains.begin(), ffGains.end()},
+                                 {fbGains.begin(), fbGains.end()}) {}
+
+  /**
+   * Reset the filter state for all channels.
+   */
+  void Reset() {
+    std::fill(m_inputs.begin(), m_inputs.end(), T{0.0});
+    std::fill(m_outputs.begin(), m_outputs.end(), T{0.0});
+  }
+
+  /**
+   * Calculates the next value of the filter for every channel.
+   *
+   * @param inputs  Current input values, one per channel.
+   * @param outputs Receives the filtered value for each channel; may not
+   *                alias the inputs.
+   * @throws std::invalid_argument if either span's size doesn't match the
+   *         channel count.
+   */
+  void Calculate(std::span<const T> inputs, std::span<T> outputs) {
+    if (inputs.size() != m_channelCount || outputs.size() != m_channelCount) {
+      throw std::invalid_argument(
+          "Input and output spans must match the channel count.");
+    }
+
+    // Rotate the input history one tap toward older and store the new
+    // samples in the newest row
+    if (!m_inputGains.empty()) {
+      std::copy_backward(m_inputs.begin(), m_inputs.end() - m_channelCount,
+                         m_inputs.end());
+      std::copy(inputs.begin(), inputs.end(), m_inputs.begin());
+    }
+
+    std::fill(outputs.begin(), outputs.end(), T{0.0});
+    for (size_t tap = 0; tap < m_inputGains.size(); ++tap) {
+      const T* row = &m_inputs[tap * m_channelCount];
+      double gain = m_inputGains[tap];
+      for (size_t ch = 0; ch < m_channelCount; ++ch) {
+        outputs[ch] += row[ch] * gain;
+      }
+    }
+    for (size_t tap = 0; tap < m_outputGains.size(); ++tap) {
+      const T* row = &m_outputs[tap * m_channelCount];
+      double gain = m_outputGains[tap];
+      for (size_t ch = 0; ch < m_channelCount; ++ch) {
+        outputs[ch] -= row[ch] * gain;
+      }
+    }
+
+    // Rotate the output history
+    if (!m_outputGains.empty()) {
+      std::copy_backward(m_outputs.begin(), m_outputs.end() - m_channelCount,
+                         m_outputs.end());
+      std::copy(outputs.begin(), outputs.end(), m_outputs.begin());
+    }
+  }
+
+ private:
+  size_t m_channelCount;
+
+  // Tap-major histories: row i holds every channel's sample from i taps ago
+  std::vector<T> m_inputs;
+  std::vector<T> m_outputs;
+  std::vector<double> m_inputGains;
+  std::vector<double> m_outputGains;
+};
+
+}  // namespace frc
@@ -0,0 +1,117 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include <wpi/SymbolExports.h>
+
+#include "frc/geometry/Pose2d.h"
+#include "frc/geometry/Pose3d.h"
+#include "frc/geometry/Rotation2d.h"
+#include "frc/geometry/Transform2d.h"
+#include "frc/geometry/Translation2d.h"
+#include "frc/geometry/Twist3d.h"
+
+namespace frc {
+
+/**
+ * Rotates a batch of translations in place by the given rotation.
+ *
+ * The rotation's cosine and sine are loaded once for the whole batch, so the
+ * per-point work is a handful of multiplies and adds that the compiler can
+ * vectorize; prefer this over calling Translation2d::RotateBy() in a loop
+ * when processing many points (e.g. a frame of vision targets).
+ *
+ * @param points   The translations to rotate, modified in place.
+ * @param rotation The rotation to rotate the translations by.
+ */
+constexpr void RotatePoints(std::span<Translation2d> points,
+                            const Rotation2d& rotation) {
+  const double cos = rotation.Cos();
+  const double sin = rotation.Sin();
+  for (auto& point : points) {
+    const double x = point.X().value();
+    const double y = point.Y().value();
+    point = Translation2d{units::meter_t{x * cos - y * sin},
+                          units::meter_t{x * sin + y * cos}};
+  }
+}
+
+/**
+ * Applies a transform to a batch of translations in place: each point is
+ * rotated by the transform's rotation and offset by its translation.
+ *
+ * Equivalent to point.RotateBy(transform.Rotation()) +
+ * transform.Translation() for each point, with the rotation's cosine and
+ * sine hoisted out of the loop.
+ *
+ * @param points    The translations to transform, modified in place.
+ * @param transform The transform to apply.
+ */
+constexpr void TransformPoints(std::span<Translation2d> points,
+                               const Transform2d& transform) {
+  const double cos = transform.Rotation().Cos();
+  const double sin = transform.Rotation().Sin();
+  const double dx = transform.X().value();
+  const double dy = transform.Y().value();
+  for (auto& point : points) {
+    const double x = point.X().value();
+    const double y = point.Y().value();
+    point = Translation2d{units::meter_t{x * cos - y * sin + dx},
+                          units::meter_t{x * sin + y * cos + dy}};
+  }
+}
+
+/**
+ * Applies a transform to a batch of poses in place.
+ *
+ * Equivalent to pose.TransformBy(transform) for each pose. Note that unlike
+ * the translation batches, composing the rotations requires renormalizing
+ * each result, so this is a convenience rather than a vectorization win.
+ *
+ * @param poses     The poses to transform, modified in place.
+ * @param transform The transform to apply.
+ */
+constexpr void TransformPoses(std::span<Pose2d> poses,
+                              const Transform2d& transform) {
+  for (auto& pose : poses) {
+    pose = pose.TransformBy(transform);
+  }
+}
+
+/**
+ * Computes the pose exponential of a batch of twists applied to a common
+ * start pose.
+ *
+ * Equivalent to start.Exp(twist) for each twist. Useful for propagating a
+ * pose covariance through sigma points, where every sigma twist is applied
+ * to the same mean pose; the start pose's rotation is composed
+ * quaternion-natively with each result.
+ *
+ * @param start  The pose the twists are applied to.
+ * @param twists The twists to apply.
+ * @return The resulting poses, in the same order as the twists.
+ */
+WPILIB_DLLEXPORT
+std::vector<Pose3d> ExpPoses(const Pose3d& start,
+                             std::span<const Twist3d> twists);
+
+/**
+ * Computes the pose logarithm of a batch of poses relative to a common start
+ * pose.
+ *
+ * Equivalent to start.Log(end) for each end pose, with the start pose's
+ * inverse computed once for the whole batch instead of per call.
+ *
+ * @param start The pose the twists are relative to.
+ * @param ends  The end poses.
+ * @return The twists that map the start pose to each end pose.
+ */
+WPILIB_DLLEXPORT
+std::vector<Twist3d> LogPoses(const Pose3d& start, std::span<const Pose3d> ends);
+
+}  // namespace frc
@@ -64,6 +64,18 @@ class WPILIB_DLLEXPORT Quaternion {
    */
   Quaternion Normalize() const;
 
+  /**
+   * Rotates a vector by this quaternion, which must be normalized.
+   *
+   * This is equivalent to conjugation by the quaternion (q * v * q⁻¹), but
+   * expands to two cross products instead of two quaternion multiplies and
+   * builds no intermediate quaternions.
+   *
+   * @param v The vector to rotate.
+   * @return The rotated vector.
+   */
+  Eigen::Vector3d Rotate(const Eigen::Vector3d& v) const;
+
   /**
    * Returns W component of the quaternion.
    */
@@ -4,16 +4,13 @@
 
 #pragma once
 
-#include <algorithm>
-#include <array>
 #include <functional>
-#include <map>
 #include <optional>
 #include <utility>
-#include <vector>
 
 #include <wpi/MathExtras.h>
 #include <wpi/SymbolExports.h>
+#include <wpi/time_series_buffer.h>
 
 #include "frc/geometry/Pose2d.h"
 #include "units/time.h"
@@ -64,19 +61,8 @@ class TimeInterpolatableBuffer {
    * @param sample The sample object.
    */
   void AddSample(units::second_t time, T sample) {
-    // Add the new state into the vector.
-    if (m_pastSnapshots.size() == 0 || time > m_pastSnapshots.back().first) {
-      m_pastSnapshots.emplace_back(time, sample);
-    } else {
-      m_pastSnapshots.insert(
-          std::upper_bound(
-              m_pastSnapshots.begin(), m_pastSnapshots.end(), time,
-              [](auto t, const auto& pair) { return t < pair.first; }),
-          std::pair(time, sample));
-    }
-    while (time - m_pastSnapshots[0].first > m_historySize) {
-      m_pastSnapshots.erase(m_pastSnapshots.begin());
-    }
+    m_pastSnapshots.insert(time.value(), std::move(sample));
+    m_pastSnapshots.expire_before((time - m_historySize).value());
   }
 
   /** Clear all old samples. */
@@ -93,36 +79,39 @@ class TimeInterpolatableBuffer {
       return {};
     }
 
-    // We will perform a binary search to find the index of the element in the
-    // vector that has a timestamp that is equal to or greater than the vision
+    // We will perform a binary search to find the index of the sample that
+    // has a timestamp that is equal to or greater than the vision
     // measurement timestamp.
 
-    if (time <= m_pastSnapshots.front().first) {
-      return m_pastSnapshots.front().second;
-    }
-    if (time > m_pastSnapshots.back().first) {
-      return m_pastSnapshots.back().second;
+    double t = time.value();
+    if (t <= m_pastSnapshots.time(0)) {
+      return m_pastSnapshots.value(0);
     }
-    if (m_pastSnapshots.size() < 2) {
-      return m_pastSnapshots[0].second;
+    size_t last = m_pastSnapshots.size() - 1;
+    if (t > m_pastSnapshots.time(last)) {
+      return m_pastSnapshots.value(last);
     }
 
-    // Get the iterator which has a key no less than the requested key.
-    auto upper_bound = std::lower_bound(
-        m_pastSnapshots.begin(), m_pastSnapshots.end(), time,
-        [](const auto& pair, auto t) { return t > pair.first; });
+    // Index of the first sample with a timestamp no less than the requested
+    // time; the sample before it brackets the time from below.
+    size_t upper = m_pastSnapshots.lower_bound(t);
+    size_t lower = upper - 1;
 
-    auto lower_bound = upper_bound - 1;
+    double frac = (t - m_pastSnapshots.time(lower)) /
+                  (m_pastSnapshots.time(upper) - m_pastSnapshots.time(lower));
 
-    double t = ((time - lower_bound->first) /
-                (upper_bound->first - lower_bound->first));
-
-    return m_interpolatingFunc(lower_bound->second, upper_bound->second, t);
+    return m_interpolatingFunc(m_pastSnapshots.value(lower),
+                               m_pastSnapshots.value(upper), frac);
   }
 
  private:
+  // sized for sample rates up to ~250 Hz over the history window
+  static constexpr size_t CapacityFor(units::second_t historySize) {
+    return static_cast<size_t>(historySize.value() * 250) + 8;
+  }
+
   units::second_t m_historySize;
-  std::vector<std::pair<units::second_t, T>> m_pastSnapshots;
+  wpi::time_series_buffer<T> m_pastSnapshots{CapacityFor(m_historySize)};
   std::function<T(const T&, const T&, double)> m_interpolatingFunc;
 };
 
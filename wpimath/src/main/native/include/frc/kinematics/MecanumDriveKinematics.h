@@ -63,7 +63,11 @@ class WPILIB_DLLEXPORT MecanumDriveKinematics {
         m_rearRightWheel{rearRightWheel} {
     SetInverseKinematics(frontLeftWheel, frontRightWheel, rearLeftWheel,
                          rearRightWheel);
-    m_forwardKinematics = m_inverseKinematics.householderQr();
+    // Cache the pseudoinverse so forward kinematics is a coefficient
+    // multiply instead of a least-squares solve per call, like
+    // SwerveDriveKinematics does.
+    m_forwardKinematics = m_inverseKinematics.householderQr().solve(
+        Matrixd<4, 4>::Identity());
     wpi::math::MathSharedStore::ReportUsage(
         wpi::math::MathUsageId::kKinematics_MecanumDrive, 1);
   }
@@ -130,7 +134,7 @@ class WPILIB_DLLEXPORT MecanumDriveKinematics {
 
  private:
   mutable Matrixd<4, 3> m_inverseKinematics;
-  Eigen::HouseholderQR<Matrixd<4, 3>> m_forwardKinematics;
+  Matrixd<3, 4> m_forwardKinematics;
   Translation2d m_frontLeftWheel;
   Translation2d m_frontRightWheel;
   Translation2d m_rearLeftWheel;
@@ -115,6 +115,32 @@ class SwerveDriveOdometry {
       const Rotation2d& gyroAngle,
       const wpi::array<SwerveModulePosition, NumModules> modulePositions);
 
+  /**
+   * Updates the robot's position on the field and returns the measured
+   * chassis speeds in one pass. The speeds are derived from the same twist
+   * used to integrate the pose, so callers that want both (e.g. a high-rate
+   * odometry thread feeding a velocity controller) don't pay for a separate
+   * ToChassisSpeeds() solve.
+   *
+   * This path also applies a second-order correction: each module's delta is
+   * taken along the midpoint of its previous and current azimuth angle
+   * rather than the end angle, which reduces the error from modules steering
+   * during the sample period.
+   *
+   * @param gyroAngle The angle reported by the gyroscope.
+   * @param modulePositions The current position of all swerve modules. Please
+   * provide the positions in the same order in which you instantiated your
+   * SwerveDriveKinematics.
+   * @param period The time between this update and the previous one.
+   *
+   * @return The measured chassis speeds over the period. The new pose is
+   *         available from GetPose().
+   */
+  ChassisSpeeds UpdateWithSpeeds(
+      const Rotation2d& gyroAngle,
+      const wpi::array<SwerveModulePosition, NumModules>& modulePositions,
+      units::second_t period);
+
  private:
   SwerveDriveKinematics<NumModules> m_kinematics;
   Pose2d m_pose;
@@ -28,11 +28,11 @@
 
 #pragma once
 
-#include <stack>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include <wpi/SmallVector.h>
 #include <wpi/SymbolExports.h>
 
 #include "frc/spline/Spline.h"
@@ -75,12 +75,28 @@ class WPILIB_DLLEXPORT SplineParameterizer {
     std::vector<PoseWithCurvature> splinePoints;
 
     // The parameterization does not add the initial point. Let's add that.
-    splinePoints.push_back(spline.GetPoint(t0));
+    // Reserve ahead based on the spline's approximate arc length so the
+    // common case fills the vector without regrowth. Segment length is
+    // usually limited by kMaxDx, so arc length / kMaxDx is a good lower
+    // bound on the point count; double it to cover curvature-limited
+    // segments.
+    {
+      const auto start = spline.GetPoint(t0);
+      const auto mid = spline.GetPoint((t0 + t1) / 2);
+      const auto end = spline.GetPoint(t1);
+      const auto arcLength =
+          start.first.Translation().Distance(mid.first.Translation()) +
+          mid.first.Translation().Distance(end.first.Translation());
+      splinePoints.reserve(2 * static_cast<size_t>(arcLength / kMaxDx) + 8);
+      splinePoints.push_back(start);
+    }
 
     // We use an "explicit stack" to simulate recursion, instead of a recursive
-    // function call This give us greater control, instead of a stack overflow
-    std::stack<StackContents> stack;
-    stack.emplace(StackContents{t0, t1});
+    // function call This give us greater control, instead of a stack overflow.
+    // The stack stays shallow (around 30 entries even for complex paths), so
+    // a fixed-capacity SmallVector keeps it off the heap.
+    wpi::SmallVector<StackContents, 64> stack;
+    stack.push_back(StackContents{t0, t1});
 
     StackContents current;
     PoseWithCurvature start;
@@ -88,8 +104,8 @@ class WPILIB_DLLEXPORT SplineParameterizer {
     int iterations = 0;
 
     while (!stack.empty()) {
-      current = stack.top();
-      stack.pop();
+      current = stack.back();
+      stack.pop_back();
       start = spline.GetPoint(current.t0);
       end = spline.GetPoint(current.t1);
 
@@ -98,10 +114,13 @@ class WPILIB_DLLEXPORT SplineParameterizer {
       if (units::math::abs(twist.dy) > kMaxDy ||
           units::math::abs(twist.dx) > kMaxDx ||
           units::math::abs(twist.dtheta) > kMaxDtheta) {
-        stack.emplace(StackContents{(current.t0 + current.t1) / 2, current.t1});
-        stack.emplace(StackContents{current.t0, (current.t0 + current.t1) / 2});
+        // Process the left half next to preserve point ordering
+        stack.push_back(
+            StackContents{(current.t0 + current.t1) / 2, current.t1});
+        stack.push_back(
+            StackContents{current.t0, (current.t0 + current.t1) / 2});
       } else {
-        splinePoints.push_back(spline.GetPoint(current.t1));
+        splinePoints.push_back(end);
       }
 
       if (iterations++ >= kMaxIterations) {
@@ -0,0 +1,128 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include <wpi/SymbolExports.h>
+
+#include "frc/spline/QuinticHermiteSpline.h"
+#include "frc/spline/SplineParameterizer.h"
+#include "frc/trajectory/Trajectory.h"
+#include "frc/trajectory/TrajectoryConfig.h"
+#include "units/length.h"
+#include "units/time.h"
+
+namespace frc {
+/**
+ * A lazily time-parameterized trajectory. Unlike Trajectory, which stores
+ * every state up front and requires generation to finish before following can
+ * start, this class keeps the splines and parameterizes them on demand, one
+ * lookahead window at a time. Memory use stays constant no matter how long
+ * the path is, and the first sample is available as soon as the splines have
+ * been constructed.
+ *
+ * Each window extends past the states it emits by at least the braking
+ * distance v_max²/(2a_max), so the backward (deceleration) pass inside the
+ * window sees every constraint that could influence the emitted states and
+ * the samples match what TrajectoryGenerator would have produced for the
+ * whole path.
+ *
+ * Sampling is forward-only: Sample() may be called with any non-decreasing
+ * sequence of times, but once a window has been discarded the trajectory
+ * cannot be rewound past it.
+ */
+class WPILIB_DLLEXPORT StreamingTrajectory {
+ public:
+  using PoseWithCurvature = std::pair<Pose2d, units::curvature_t>;
+
+  /**
+   * Constructs a streaming trajectory from the given waypoints and config.
+   * Only the splines are constructed here; time parameterization happens
+   * incrementally as the trajectory is sampled. Like
+   * TrajectoryGenerator::GenerateTrajectory, all waypoints must be
+   * represented by Pose2d objects and quintic hermite splines are used.
+   *
+   * @param waypoints List of waypoints.
+   * @param config    The configuration for the trajectory. The config is
+   *                  consumed because its constraints are needed for the
+   *                  lifetime of the trajectory.
+   */
+  StreamingTrajectory(const std::vector<Pose2d>& waypoints,
+                      TrajectoryConfig config);
+
+  /**
+   * Sample the trajectory at a point in time, parameterizing further windows
+   * as needed. Times before the current window are clamped to its first
+   * state; times past the end of the path are clamped to the final state.
+   *
+   * @param t The point in time since the beginning of the trajectory to
+   *          sample.
+   * @return The state at that point in time.
+   */
+  Trajectory::State Sample(units::second_t t);
+
+  /**
+   * Returns whether the given time is at or past the end of the path. Unlike
+   * Trajectory::TotalTime(), this never forces parameterization of the
+   * remaining windows.
+   *
+   * @param t The point in time since the beginning of the trajectory.
+   * @return Whether the trajectory has ended by that time.
+   */
+  bool IsDone(units::second_t t) const {
+    return m_exhausted && t >= m_window.back().t;
+  }
+
+  /**
+   * Returns the overall duration of the trajectory. This parameterizes all
+   * remaining windows, so it defeats the purpose of streaming; it is mainly
+   * useful for tests and telemetry.
+   *
+   * @return The duration of the trajectory.
+   */
+  units::second_t TotalTime();
+
+  /**
+   * Returns the pose at the start of the trajectory.
+   *
+   * @return The pose at the start of the trajectory.
+   */
+  Pose2d InitialPose() const { return m_window.front().pose; }
+
+ private:
+  // Parameterizes the next window of states, replacing the current one. The
+  // first state of the new window coincides with the last emitted state.
+  void AdvanceWindow();
+
+  // Appends geometric points from the remaining splines until the pending
+  // buffer covers the given arc length (or the splines run out).
+  void FillPoints(units::meter_t length);
+
+  TrajectoryConfig m_config;
+  std::vector<QuinticHermiteSpline> m_splines;
+  size_t m_nextSpline = 0;
+
+  // Geometric points not yet emitted as states. The first entry coincides
+  // with the last state of the current window.
+  std::vector<PoseWithCurvature> m_pendingPoints;
+
+  // Distance past the emitted states each window must cover so that the
+  // backward pass converges before reaching them.
+  units::meter_t m_lookahead;
+
+  // The current window of time-parameterized states, with absolute times.
+  std::vector<Trajectory::State> m_window;
+
+  // Velocity and time at the boundary where the next window begins.
+  units::meters_per_second_t m_boundaryVelocity;
+  units::second_t m_timeOffset = 0_s;
+
+  // True once the final window (which uses the real end velocity) has been
+  // generated.
+  bool m_exhausted = false;
+};
+}  // namespace frc
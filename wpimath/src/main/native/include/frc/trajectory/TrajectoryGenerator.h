@@ -5,7 +5,9 @@
 #pragma once
 
 #include <functional>
+#include <future>
 #include <memory>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -101,15 +103,32 @@ class WPILIB_DLLEXPORT TrajectoryGenerator {
     // Add the first point to the vector.
     splinePoints.push_back(splines.front().GetPoint(0.0));
 
-    // Iterate through the vector and parameterize each spline, adding the
-    // parameterized points to the final vector.
-    for (auto&& spline : splines) {
-      auto points = SplineParameterizer::Parameterize(spline);
-      // Append the array of poses to the vector. We are removing the first
-      // point because it's a duplicate of the last point from the previous
-      // spline.
-      splinePoints.insert(std::end(splinePoints), std::begin(points) + 1,
-                          std::end(points));
+    // Parameterize each spline, adding the parameterized points to the final
+    // vector. Each spline parameterizes independently, so when there are
+    // multiple splines and multiple cores, parameterize them concurrently.
+    // When we append each array of poses to the vector, we remove the first
+    // point because it's a duplicate of the last point from the previous
+    // spline.
+    if (splines.size() > 1 && std::thread::hardware_concurrency() > 1) {
+      std::vector<std::future<std::vector<PoseWithCurvature>>> futures;
+      futures.reserve(splines.size());
+      for (auto&& spline : splines) {
+        futures.emplace_back(std::async(std::launch::async, [&spline] {
+          return SplineParameterizer::Parameterize(spline);
+        }));
+      }
+      for (auto&& future : futures) {
+        // get() rethrows MalformedSplineException from the worker thread
+        auto points = future.get();
+        splinePoints.insert(std::end(splinePoints), std::begin(points) + 1,
+                            std::end(points));
+      }
+    } else {
+      for (auto&& spline : splines) {
+        auto points = SplineParameterizer::Parameterize(spline);
+        splinePoints.insert(std::end(splinePoints), std::begin(points) + 1,
+                            std::end(points));
+      }
     }
     return splinePoints;
   }
@@ -126,5 +145,45 @@ class WPILIB_DLLEXPORT TrajectoryGenerator {
 
   static const Trajectory kDoNothingTrajectory;
   static std::function<void(const char*)> s_errorFunc;
+
+  friend class IncrementalTrajectoryGenerator;
+  friend class StreamingTrajectory;
+};
+
+/**
+ * Generates trajectories like TrajectoryGenerator, but keeps the parameterized
+ * spline points for each waypoint pair between calls. When a trajectory is
+ * regenerated with only some waypoints changed (e.g. the start pose updated to
+ * the robot's current pose), only the splines touching the changed waypoints
+ * are re-parameterized; the rest are served from the cache. Time
+ * parameterization always reruns, since velocities propagate along the whole
+ * path.
+ *
+ * Each instance owns its cache, so reuse the same instance for repeated
+ * regenerations of the same route.
+ */
+class WPILIB_DLLEXPORT IncrementalTrajectoryGenerator {
+ public:
+  /**
+   * Generates a trajectory from the given waypoints and config. This method
+   * uses quintic hermite splines, so each spline depends only on its two
+   * bounding waypoints and cached spline points stay valid for waypoint pairs
+   * that are unchanged since the previous call.
+   *
+   * @param waypoints List of waypoints.
+   * @param config    The configuration for the trajectory.
+   * @return The generated trajectory.
+   */
+  Trajectory Generate(const std::vector<Pose2d>& waypoints,
+                      const TrajectoryConfig& config);
+
+ private:
+  struct CachedSpline {
+    Pose2d start;
+    Pose2d end;
+    std::vector<TrajectoryGenerator::PoseWithCurvature> points;
+  };
+
+  std::vector<CachedSpline> m_cache;
 };
 }  // namespace frc
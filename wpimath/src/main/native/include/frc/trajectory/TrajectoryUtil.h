@@ -33,6 +33,41 @@ class WPILIB_DLLEXPORT TrajectoryUtil {
    */
   static Trajectory FromPathweaverJson(std::string_view path);
 
+  /**
+   * Exports a Trajectory to a compact binary file.
+   *
+   * The file is a small header followed by fixed-stride state records, so it
+   * can be imported with a bulk copy instead of JSON parsing; prefer it for
+   * paths loaded at robot startup.
+   *
+   * @param trajectory the trajectory to export
+   * @param path the path of the file to export to
+   */
+  static void ToBinary(const Trajectory& trajectory, std::string_view path);
+
+  /**
+   * Imports a Trajectory from a binary file created by ToBinary().
+   *
+   * The file is memory-mapped and the states are constructed in a single
+   * pass over the fixed-stride records, so importing is dramatically faster
+   * than FromPathweaverJson().
+   *
+   * @param path The path of the binary file to import from.
+   *
+   * @return The trajectory represented by the file.
+   */
+  static Trajectory FromBinary(std::string_view path);
+
+  /**
+   * Converts a PathWeaver-style JSON trajectory file to the binary format
+   * read by FromBinary().
+   *
+   * @param jsonPath the path of the JSON file to convert
+   * @param binaryPath the path of the binary file to write
+   */
+  static void ConvertJsonToBinary(std::string_view jsonPath,
+                                  std::string_view binaryPath);
+
   /**
    * Deserializes a Trajectory from JSON exported from PathWeaver.
    *
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <type_traits>
+
 #include "units/time.h"
 #include "wpimath/MathShared.h"
 
@@ -51,14 +53,19 @@ class TrapezoidProfile {
 
   class Constraints {
    public:
-    Constraints() {
-      wpi::math::MathSharedStore::ReportUsage(
-          wpi::math::MathUsageId::kTrajectory_TrapezoidProfile, 1);
+    constexpr Constraints() {
+      if (!std::is_constant_evaluated()) {
+        wpi::math::MathSharedStore::ReportUsage(
+            wpi::math::MathUsageId::kTrajectory_TrapezoidProfile, 1);
+      }
     }
-    Constraints(Velocity_t maxVelocity_, Acceleration_t maxAcceleration_)
+    constexpr Constraints(Velocity_t maxVelocity_,
+                          Acceleration_t maxAcceleration_)
         : maxVelocity{maxVelocity_}, maxAcceleration{maxAcceleration_} {
-      wpi::math::MathSharedStore::ReportUsage(
-          wpi::math::MathUsageId::kTrajectory_TrapezoidProfile, 1);
+      if (!std::is_constant_evaluated()) {
+        wpi::math::MathSharedStore::ReportUsage(
+            wpi::math::MathUsageId::kTrajectory_TrapezoidProfile, 1);
+      }
     }
     Velocity_t maxVelocity{0};
     Acceleration_t maxAcceleration{0};
@@ -68,10 +75,12 @@ class TrapezoidProfile {
    public:
     Distance_t position{0};
     Velocity_t velocity{0};
-    bool operator==(const State& rhs) const {
+    constexpr bool operator==(const State& rhs) const {
       return position == rhs.position && velocity == rhs.velocity;
     }
-    bool operator!=(const State& rhs) const { return !(*this == rhs); }
+    constexpr bool operator!=(const State& rhs) const {
+      return !(*this == rhs);
+    }
   };
 
   /**
@@ -81,8 +90,9 @@ class TrapezoidProfile {
    * @param goal        The desired state when the profile is complete.
    * @param initial     The initial state (usually the current state).
    */
-  TrapezoidProfile(Constraints constraints, State goal,
-                   State initial = State{Distance_t{0}, Velocity_t{0}});
+  constexpr TrapezoidProfile(Constraints constraints, State goal,
+                             State initial = State{Distance_t{0},
+                                                   Velocity_t{0}});
 
   TrapezoidProfile(const TrapezoidProfile&) = default;
   TrapezoidProfile& operator=(const TrapezoidProfile&) = default;
@@ -95,7 +105,7 @@ class TrapezoidProfile {
    *
    * @param t The time since the beginning of the profile.
    */
-  State Calculate(units::second_t t) const;
+  constexpr State Calculate(units::second_t t) const;
 
   /**
    * Returns the time left until a target distance in the profile is reached.
@@ -107,7 +117,7 @@ class TrapezoidProfile {
   /**
    * Returns the total time the profile takes to reach the goal.
    */
-  units::second_t TotalTime() const { return m_endDeccel; }
+  constexpr units::second_t TotalTime() const { return m_endDeccel; }
 
   /**
    * Returns true if the profile has reached the goal.
@@ -117,7 +127,9 @@ class TrapezoidProfile {
    *
    * @param t The time since the beginning of the profile.
    */
-  bool IsFinished(units::second_t t) const { return t >= TotalTime(); }
+  constexpr bool IsFinished(units::second_t t) const {
+    return t >= TotalTime();
+  }
 
  private:
   /**
@@ -128,16 +140,14 @@ class TrapezoidProfile {
    * @param initial The initial state (usually the current state).
    * @param goal    The desired state when the profile is complete.
    */
-  static bool ShouldFlipAcceleration(const State& initial, const State& goal) {
+  static constexpr bool ShouldFlipAcceleration(const State& initial,
+                                               const State& goal) {
     return initial.position > goal.position;
   }
 
   // Flip the sign of the velocity and position if the profile is inverted
-  State Direct(const State& in) const {
-    State result = in;
-    result.position *= m_direction;
-    result.velocity *= m_direction;
-    return result;
+  constexpr State Direct(const State& in) const {
+    return State{in.position * m_direction, in.velocity * m_direction};
   }
 
   // The direction of the profile, either 1 for forwards or -1 for inverted
@@ -0,0 +1,162 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <cmath>
+#include <numbers>
+
+// Trig kernels for wpimath's hot paths (Rotation2d construction, swerve
+// module optimization, odometry).
+//
+// By default the dispatch functions below forward to libm, so behavior is
+// bit-identical to calling <cmath> directly. Building with
+// WPIMATH_USE_FAST_TRIG defined switches them to the polynomial
+// approximations in wpi::math::detail, which trade bounded accuracy for
+// speed on targets where libm trig is expensive (e.g. the armv7 roboRIO):
+//
+//   Sin/Cos: absolute error < 1e-9 (degree-13 Taylor on [-π/2, π/2] after
+//            range reduction; the truncation term is (π/2)¹⁵/15! ≈ 7e-10)
+//   ATan2:   absolute error < 1e-9 rad (degree-19 Taylor on [0, tan(π/8)]
+//            after octant reduction; the truncation term is
+//            tan(π/8)²¹/21 ≈ 5e-10)
+//   Hypot:   √(x² + y²) with no overflow/underflow protection
+//
+// The approximations assume finite inputs of robot-scale magnitude; they are
+// not substitutes for libm in general-purpose code. Define the flag for the
+// whole wpimath build, not per translation unit, so every inline call site
+// agrees on one definition.
+
+namespace wpi::math {
+
+namespace detail {
+
+/// Polynomial sine for |x| ≤ π/2; see the error bound above.
+inline double SinPoly(double x) {
+  double x2 = x * x;
+  // x − x³/3! + x⁵/5! − x⁷/7! + x⁹/9! − x¹¹/11! + x¹³/13!
+  return x *
+         (1.0 +
+          x2 * (-1.0 / 6.0 +
+                x2 * (1.0 / 120.0 +
+                      x2 * (-1.0 / 5040.0 +
+                            x2 * (1.0 / 362880.0 +
+                                  x2 * (-1.0 / 39916800.0 +
+                                        x2 * (1.0 / 6227020800.0)))))));
+}
+
+inline double SinApprox(double x) {
+  // Reduce to [-π, π], then fold into [-π/2, π/2]
+  double y =
+      x - 2.0 * std::numbers::pi *
+              std::nearbyint(x * (0.5 * std::numbers::inv_pi));
+  if (y > 0.5 * std::numbers::pi) {
+    y = std::numbers::pi - y;
+  } else if (y < -0.5 * std::numbers::pi) {
+    y = -std::numbers::pi - y;
+  }
+  return SinPoly(y);
+}
+
+inline double CosApprox(double x) {
+  return SinApprox(x + 0.5 * std::numbers::pi);
+}
+
+/// Polynomial arctangent for |z| ≤ tan(π/8); see the error bound above.
+inline double ATanPoly(double z) {
+  double z2 = z * z;
+  // z − z³/3 + z⁵/5 − … + z¹⁷/17 − z¹⁹/19
+  return z *
+         (1.0 +
+          z2 * (-1.0 / 3.0 +
+                z2 * (1.0 / 5.0 +
+                      z2 * (-1.0 / 7.0 +
+                            z2 * (1.0 / 9.0 +
+                                  z2 * (-1.0 / 11.0 +
+                                        z2 * (1.0 / 13.0 +
+                                              z2 * (-1.0 / 15.0 +
+                                                    z2 * (1.0 / 17.0 +
+                                                          z2 * (-1.0 /
+                                                                19.0))))))))));
+}
+
+inline double ATanApprox(double z) {
+  double absZ = std::abs(z);
+  bool invert = absZ > 1.0;
+  if (invert) {
+    absZ = 1.0 / absZ;
+  }
+
+  double result;
+  if (absZ > 0.41421356237309503) {  // tan(π/8)
+    // atan(z) = π/4 + atan((z − 1)/(z + 1)); the argument is in
+    // (tan(-π/8), 0] so the same polynomial applies
+    result = 0.25 * std::numbers::pi + ATanPoly((absZ - 1.0) / (absZ + 1.0));
+  } else {
+    result = ATanPoly(absZ);
+  }
+
+  if (invert) {
+    result = 0.5 * std::numbers::pi - result;
+  }
+  return z < 0.0 ? -result : result;
+}
+
+inline double ATan2Approx(double y, double x) {
+  if (x == 0.0) {
+    if (y > 0.0) {
+      return 0.5 * std::numbers::pi;
+    }
+    if (y < 0.0) {
+      return -0.5 * std::numbers::pi;
+    }
+    return 0.0;
+  }
+
+  double result = ATanApprox(y / x);
+  if (x < 0.0) {
+    result += y >= 0.0 ? std::numbers::pi : -std::numbers::pi;
+  }
+  return result;
+}
+
+inline double HypotApprox(double x, double y) {
+  return std::sqrt(x * x + y * y);
+}
+
+}  // namespace detail
+
+#ifdef WPIMATH_USE_FAST_TRIG
+
+inline double Sin(double x) {
+  return detail::SinApprox(x);
+}
+inline double Cos(double x) {
+  return detail::CosApprox(x);
+}
+inline double ATan2(double y, double x) {
+  return detail::ATan2Approx(y, x);
+}
+inline double Hypot(double x, double y) {
+  return detail::HypotApprox(x, y);
+}
+
+#else
+
+inline double Sin(double x) {
+  return std::sin(x);
+}
+inline double Cos(double x) {
+  return std::cos(x);
+}
+inline double ATan2(double y, double x) {
+  return std::atan2(y, x);
+}
+inline double Hypot(double x, double y) {
+  return std::hypot(x, y);
+}
+
+#endif  // WPIMATH_USE_FAST_TRIG
+
+}  // namespace wpi::math
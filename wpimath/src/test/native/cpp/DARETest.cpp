@@ -0,0 +1,78 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <gtest/gtest.h>
+
+#include "frc/DARE.h"
+#include "frc/EigenCore.h"
+
+namespace frc {
+
+template <int States, int Inputs>
+void ExpectDARESolution(const Matrixd<States, States>& A,
+                        const Matrixd<States, Inputs>& B,
+                        const Matrixd<States, States>& Q,
+                        const Matrixd<Inputs, Inputs>& R,
+                        const Matrixd<States, States>& X) {
+  // verify AᵀXA − X − AᵀXB(BᵀXB + R)⁻¹BᵀXA + Q = 0
+  Matrixd<States, States> residual =
+      A.transpose() * X * A - X -
+      A.transpose() * X * B *
+          (B.transpose() * X * B + R).llt().solve(B.transpose() * X * A) +
+      Q;
+  EXPECT_LT(residual.norm(), 1e-8);
+}
+
+TEST(DARETest, DoubleIntegrator) {
+  // discretized double integrator (dt = 5 ms)
+  Matrixd<2, 2> A{{1.0, 0.005}, {0.0, 1.0}};
+  Matrixd<2, 1> B{0.0000125, 0.005};
+  Matrixd<2, 2> Q{{10.0, 0.0}, {0.0, 1.0}};
+  Matrixd<1, 1> R{0.25};
+
+  Matrixd<2, 2> X = DARE<2, 1>(A, B, Q, R);
+  ExpectDARESolution(A, B, Q, R, X);
+}
+
+TEST(DARETest, Scalar) {
+  Matrixd<1, 1> A{0.9};
+  Matrixd<1, 1> B{0.5};
+  Matrixd<1, 1> Q{3.0};
+  Matrixd<1, 1> R{2.0};
+
+  Matrixd<1, 1> X = DARE<1, 1>(A, B, Q, R);
+  ExpectDARESolution(A, B, Q, R, X);
+}
+
+TEST(DARETest, MoreInputsThanStates) {
+  Matrixd<2, 2> A{{1.0, 0.01}, {0.0, 1.0}};
+  Matrixd<2, 3> B{{0.0, 0.01, 0.01}, {0.01, 0.0, 0.01}};
+  Matrixd<2, 2> Q{{1.0, 0.0}, {0.0, 1.0}};
+  Matrixd<3, 3> R{{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}};
+
+  Matrixd<2, 2> X = DARE<2, 3>(A, B, Q, R);
+  ExpectDARESolution(A, B, Q, R, X);
+}
+
+TEST(DARETest, WarmStart) {
+  Matrixd<2, 2> A{{1.0, 0.005}, {0.0, 1.0}};
+  Matrixd<2, 1> B{0.0000125, 0.005};
+  Matrixd<2, 2> Q{{10.0, 0.0}, {0.0, 1.0}};
+  Matrixd<1, 1> R{0.25};
+
+  Matrixd<2, 2> X = DARE<2, 1>(A, B, Q, R);
+
+  // perturb the plant slightly, as a gain-schedule update would
+  Matrixd<2, 2> A2 = A;
+  A2(0, 1) = 0.0055;
+  Matrixd<2, 2> X2 = DARE<2, 1>(A2, B, Q, R, X);
+  ExpectDARESolution(A2, B, Q, R, X2);
+
+  // warm start from a bad guess still produces the solution
+  Matrixd<2, 2> X3 = DARE<2, 1>(A2, B, Q, R, Matrixd<2, 2>::Zero());
+  ExpectDARESolution(A2, B, Q, R, X3);
+  EXPECT_LT((X3 - X2).norm(), 1e-6 * X2.norm());
+}
+
+}  // namespace frc
@@ -0,0 +1,54 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <cmath>
+#include <numbers>
+
+#include "gtest/gtest.h"
+#include "wpimath/TrigKernels.h"
+
+// The approximations are tested directly through wpi::math::detail so the
+// bounds hold regardless of whether WPIMATH_USE_FAST_TRIG is defined for
+// this build.
+
+TEST(TrigKernelsTest, SinCosBounds) {
+  for (double x = -4.0 * std::numbers::pi; x <= 4.0 * std::numbers::pi;
+       x += 1e-3) {
+    EXPECT_NEAR(std::sin(x), wpi::math::detail::SinApprox(x), 1e-9);
+    EXPECT_NEAR(std::cos(x), wpi::math::detail::CosApprox(x), 1e-9);
+  }
+}
+
+TEST(TrigKernelsTest, ATan2Bounds) {
+  for (double y = -2.0; y <= 2.0; y += 0.01) {
+    for (double x = -2.0; x <= 2.0; x += 0.01) {
+      if (x == 0.0 && y == 0.0) {
+        continue;
+      }
+      EXPECT_NEAR(std::atan2(y, x), wpi::math::detail::ATan2Approx(y, x),
+                  1e-9);
+    }
+  }
+
+  // x == 0 column
+  EXPECT_DOUBLE_EQ(0.5 * std::numbers::pi,
+                   wpi::math::detail::ATan2Approx(1.0, 0.0));
+  EXPECT_DOUBLE_EQ(-0.5 * std::numbers::pi,
+                   wpi::math::detail::ATan2Approx(-1.0, 0.0));
+}
+
+TEST(TrigKernelsTest, Hypot) {
+  EXPECT_NEAR(5.0, wpi::math::detail::HypotApprox(3.0, 4.0), 1e-12);
+  EXPECT_NEAR(std::hypot(0.1, -0.2), wpi::math::detail::HypotApprox(0.1, -0.2),
+              1e-12);
+}
+
+TEST(TrigKernelsTest, DispatchMatchesLibmByDefault) {
+#ifndef WPIMATH_USE_FAST_TRIG
+  EXPECT_EQ(std::sin(1.234), wpi::math::Sin(1.234));
+  EXPECT_EQ(std::cos(1.234), wpi::math::Cos(1.234));
+  EXPECT_EQ(std::atan2(0.5, -0.25), wpi::math::ATan2(0.5, -0.25));
+  EXPECT_EQ(std::hypot(3.0, 4.0), wpi::math::Hypot(3.0, 4.0));
+#endif
+}
@@ -0,0 +1,81 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+// Compile-time audit that the unit_t types used on wpimath hot paths lower to
+// raw double math. Every check here is a static_assert, so a units library
+// change that introduces storage overhead, a non-trivial special member, or a
+// runtime conversion in a same-dimension operation fails the build of this
+// translation unit rather than showing up as a regression on a robot.
+
+#include <type_traits>
+
+#include "frc/controller/SimpleMotorFeedforward.h"
+#include "gtest/gtest.h"
+#include "units/acceleration.h"
+#include "units/angle.h"
+#include "units/angular_velocity.h"
+#include "units/length.h"
+#include "units/time.h"
+#include "units/velocity.h"
+#include "units/voltage.h"
+
+namespace {
+
+// A unit_t must be exactly one double: no vtable, no stored conversion
+// factor, no padding. Passing one by value is then identical to passing a
+// double in a floating-point register.
+template <typename T>
+constexpr bool IsDoubleSized = sizeof(T) == sizeof(double) &&
+                               alignof(T) == alignof(double) &&
+                               std::is_trivially_copyable_v<T> &&
+                               std::is_trivially_destructible_v<T> &&
+                               std::is_standard_layout_v<T>;
+
+static_assert(IsDoubleSized<units::meter_t>);
+static_assert(IsDoubleSized<units::second_t>);
+static_assert(IsDoubleSized<units::volt_t>);
+static_assert(IsDoubleSized<units::radian_t>);
+static_assert(IsDoubleSized<units::meters_per_second_t>);
+static_assert(IsDoubleSized<units::meters_per_second_squared_t>);
+static_assert(IsDoubleSized<units::radians_per_second_t>);
+
+using Feedforward = frc::SimpleMotorFeedforward<units::meters>;
+static_assert(IsDoubleSized<units::unit_t<Feedforward::kv_unit>>);
+static_assert(IsDoubleSized<units::unit_t<Feedforward::ka_unit>>);
+static_assert(sizeof(Feedforward) == 3 * sizeof(double));
+
+// The hot arithmetic must be usable in a constant expression; anything that
+// folds at compile time here cannot contain a runtime call in the lowered
+// code, only the same multiply/add chain a raw-double port would emit.
+static_assert(units::meter_t{2.0} + units::meter_t{3.0} ==
+              units::meter_t{5.0});
+static_assert(units::meter_t{6.0} - units::meter_t{2.0} ==
+              units::meter_t{4.0});
+static_assert(units::meter_t{6.0} / units::second_t{2.0} ==
+              units::meters_per_second_t{3.0});
+static_assert(units::meters_per_second_t{3.0} * units::second_t{2.0} ==
+              units::meter_t{6.0});
+static_assert(2.0 * units::volt_t{3.0} == units::volt_t{6.0});
+static_assert(units::meter_t{2.0} < units::meter_t{3.0});
+
+// Same-dimension, same-ratio conversions must be the identity; value() and
+// the explicit constructor cannot scale.
+static_assert(units::meters_per_second_t{1.5}.value() == 1.5);
+static_assert(units::convert<units::meters, units::meters>(1.5) == 1.5);
+
+// The full feedforward expression — the loop body the request measured —
+// folds at compile time, so the unit bookkeeping is entirely in the type
+// system.
+static_assert(Feedforward{1_V, 2_V / 1_mps, 0.5_V / 1_mps_sq}.Calculate(
+                  2_mps, 1_mps_sq) == 5.5_V);
+static_assert(Feedforward{1_V, 2_V / 1_mps}.MaxAchievableVelocity(
+                  11_V, 0_mps_sq) == 5_mps);
+
+}  // namespace
+
+// The static_asserts above are the test; this keeps the file visible in the
+// test runner and catches a translation unit that compiled to nothing.
+TEST(UnitsZeroOverheadTest, AuditCompiles) {
+  SUCCEED();
+}
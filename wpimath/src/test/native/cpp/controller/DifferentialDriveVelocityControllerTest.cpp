@@ -0,0 +1,64 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "frc/MathUtil.h"
+#include "frc/controller/DifferentialDriveVelocityController.h"
+#include "units/velocity.h"
+#include "units/voltage.h"
+
+static constexpr units::volt_t kS = 0.5_V;
+static constexpr auto kV = 2_V / 1_mps;
+static constexpr units::meters_per_second_t kMaxSpeed = 4_mps;
+static constexpr double kP = 8.0;
+
+TEST(DifferentialDriveVelocityControllerTest, ShapeMatchesDeadbandAndSquare) {
+  frc::DifferentialDriveVelocityController controller{
+      frc::SimpleMotorFeedforward<units::meters>{kS, kV}, kMaxSpeed, kP, 0.0,
+      0.0};
+
+  for (double input = -1.0; input <= 1.0; input += 0.01) {
+    double deadbanded = frc::ApplyDeadband(input, 0.02);
+    double expected = std::copysign(deadbanded * deadbanded, deadbanded);
+    EXPECT_NEAR(controller.Shape(input), expected, 1e-3);
+  }
+
+  // inside the deadband maps exactly to zero
+  EXPECT_EQ(controller.Shape(0.015), 0.0);
+  EXPECT_EQ(controller.Shape(-0.015), 0.0);
+}
+
+TEST(DifferentialDriveVelocityControllerTest, FeedforwardAtSetpoint) {
+  frc::DifferentialDriveVelocityController controller{
+      frc::SimpleMotorFeedforward<units::meters>{kS, kV}, kMaxSpeed, kP, 0.0,
+      0.0};
+
+  // measured velocity at the setpoint leaves only the feedforward
+  auto voltages = controller.Calculate(1.0, -1.0, kMaxSpeed, -kMaxSpeed);
+  EXPECT_NEAR(voltages.left.value(), (kS + kV * kMaxSpeed).value(), 1e-9);
+  EXPECT_NEAR(voltages.right.value(), -(kS + kV * kMaxSpeed).value(), 1e-9);
+}
+
+TEST(DifferentialDriveVelocityControllerTest, ProportionalCorrection) {
+  frc::DifferentialDriveVelocityController controller{
+      frc::SimpleMotorFeedforward<units::meters>{0_V, kV}, kMaxSpeed, kP, 0.0,
+      0.0};
+
+  // left is 1 m/s below the 4 m/s setpoint, right is at its zero setpoint
+  auto voltages = controller.Calculate(4_mps, 0_mps, 3_mps, 0_mps);
+  EXPECT_NEAR(voltages.left.value(), (kV * 4_mps).value() + kP * 1.0, 1e-9);
+  EXPECT_NEAR(voltages.right.value(), 0.0, 1e-9);
+}
+
+TEST(DifferentialDriveVelocityControllerTest, SquaringDisabled) {
+  frc::DifferentialDriveVelocityController controller{
+      frc::SimpleMotorFeedforward<units::meters>{0_V, kV}, kMaxSpeed, 0.0, 0.0,
+      0.0};
+  controller.SetSquareInputs(false);
+
+  EXPECT_NEAR(controller.Shape(0.51), frc::ApplyDeadband(0.51, 0.02), 1e-3);
+}
@@ -148,3 +148,69 @@ TEST(ExtendedKalmanFilterTest, Convergence) {
   ASSERT_NEAR(0.0, observer.Xhat(3), 1.0);
   ASSERT_NEAR(0.0, observer.Xhat(4), 1.0);
 }
+
+TEST(ExtendedKalmanFilterTest, RelinearizationThreshold) {
+  constexpr auto dt = 0.00505_s;
+
+  frc::ExtendedKalmanFilter<5, 2, 3> alwaysRelinearize{
+      Dynamics,
+      LocalMeasurementModel,
+      {0.5, 0.5, 10.0, 1.0, 1.0},
+      {0.0001, 0.01, 0.01},
+      dt};
+  frc::ExtendedKalmanFilter<5, 2, 3> cached{Dynamics,
+                                            LocalMeasurementModel,
+                                            {0.5, 0.5, 10.0, 1.0, 1.0},
+                                            {0.0001, 0.01, 0.01},
+                                            dt};
+  cached.SetRelinearizationThreshold(1e-3);
+
+  frc::Vectord<2> u{12.0, 12.0};
+  for (int i = 0; i < 100; ++i) {
+    alwaysRelinearize.Predict(u, dt);
+    cached.Predict(u, dt);
+
+    auto localY = LocalMeasurementModel(alwaysRelinearize.Xhat(), u);
+    alwaysRelinearize.Correct(u, localY);
+    cached.Correct(u, localY);
+  }
+
+  // With a small threshold the cached discretization must stay close to the
+  // always-relinearized filter
+  for (int row = 0; row < 5; ++row) {
+    EXPECT_NEAR(alwaysRelinearize.Xhat(row), cached.Xhat(row), 1e-3);
+    for (int col = 0; col < 5; ++col) {
+      EXPECT_NEAR(alwaysRelinearize.P(row, col), cached.P(row, col), 1e-3);
+    }
+  }
+}
+
+TEST(ExtendedKalmanFilterTest, DefaultThresholdMatchesRelinearizeEveryStep) {
+  constexpr auto dt = 0.00505_s;
+
+  frc::ExtendedKalmanFilter<5, 2, 3> observer{Dynamics,
+                                              LocalMeasurementModel,
+                                              {0.5, 0.5, 10.0, 1.0, 1.0},
+                                              {0.0001, 0.01, 0.01},
+                                              dt};
+  frc::ExtendedKalmanFilter<5, 2, 3> reference{Dynamics,
+                                               LocalMeasurementModel,
+                                               {0.5, 0.5, 10.0, 1.0, 1.0},
+                                               {0.0001, 0.01, 0.01},
+                                               dt};
+
+  frc::Vectord<2> u{12.0, 12.0};
+  for (int i = 0; i < 50; ++i) {
+    observer.Predict(u, dt);
+    reference.Predict(u, dt);
+  }
+
+  // Default threshold of zero relinearizes every step, so the results are
+  // bit-identical to the previous behavior
+  for (int row = 0; row < 5; ++row) {
+    EXPECT_DOUBLE_EQ(reference.Xhat(row), observer.Xhat(row));
+    for (int col = 0; col < 5; ++col) {
+      EXPECT_DOUBLE_EQ(reference.P(row, col), observer.P(row, col));
+    }
+  }
+}
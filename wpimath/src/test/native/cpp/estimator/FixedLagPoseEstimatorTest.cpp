@@ -0,0 +1,170 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <limits>
+#include <random>
+
+#include "frc/estimator/FixedLagPoseEstimator.h"
+#include "frc/geometry/Pose2d.h"
+#include "frc/geometry/Rotation2d.h"
+#include "frc/trajectory/TrajectoryGenerator.h"
+#include "gtest/gtest.h"
+#include "units/angle.h"
+#include "units/length.h"
+#include "units/time.h"
+
+TEST(FixedLagPoseEstimatorTest, Accuracy) {
+  frc::FixedLagPoseEstimator estimator{
+      50, frc::Pose2d{}, {0.02, 0.02, 0.01}, {0.1, 0.1, 0.01}};
+
+  frc::Trajectory trajectory = frc::TrajectoryGenerator::GenerateTrajectory(
+      std::vector{frc::Pose2d{0_m, 0_m, 45_deg}, frc::Pose2d{3_m, 0_m, -90_deg},
+                  frc::Pose2d{0_m, 0_m, 135_deg},
+                  frc::Pose2d{-3_m, 0_m, -90_deg},
+                  frc::Pose2d{0_m, 0_m, 45_deg}},
+      frc::TrajectoryConfig(10_mps, 5.0_mps_sq));
+
+  std::default_random_engine generator;
+  std::normal_distribution<double> distribution(0.0, 1.0);
+
+  units::second_t dt = 0.02_s;
+  units::second_t t = 0.0_s;
+
+  units::second_t kVisionUpdateRate = 0.1_s;
+  frc::Pose2d lastVisionPose;
+  units::second_t lastVisionUpdateTime{-std::numeric_limits<double>::max()};
+
+  // drifting odometry: integrate the ground truth motion with noise
+  frc::Pose2d odometryPose;
+  frc::Pose2d lastGroundTruthPose = trajectory.Sample(0_s).pose;
+
+  double maxError = -std::numeric_limits<double>::max();
+  double errorSum = 0;
+
+  while (t <= trajectory.TotalTime()) {
+    auto groundTruthState = trajectory.Sample(t);
+
+    if (lastVisionUpdateTime + kVisionUpdateRate < t) {
+      if (lastVisionPose != frc::Pose2d{}) {
+        estimator.AddVisionMeasurement(lastVisionPose, lastVisionUpdateTime);
+      }
+      lastVisionPose =
+          groundTruthState.pose +
+          frc::Transform2d{
+              frc::Translation2d{distribution(generator) * 0.1 * 1_m,
+                                 distribution(generator) * 0.1 * 1_m},
+              frc::Rotation2d{distribution(generator) * 0.01 * 1_rad}};
+
+      lastVisionUpdateTime = t;
+    }
+
+    auto delta = groundTruthState.pose - lastGroundTruthPose;
+    lastGroundTruthPose = groundTruthState.pose;
+    odometryPose =
+        odometryPose +
+        frc::Transform2d{
+            frc::Translation2d{
+                delta.X() * (1 + distribution(generator) * 0.01),
+                delta.Y() * (1 + distribution(generator) * 0.01)},
+            delta.Rotation() +
+                frc::Rotation2d{distribution(generator) * 0.001 * 1_rad}};
+
+    auto xhat = estimator.UpdateWithTime(t, odometryPose);
+
+    double error = groundTruthState.pose.Translation()
+                       .Distance(xhat.Translation())
+                       .value();
+
+    if (error > maxError) {
+      maxError = error;
+    }
+    errorSum += error;
+
+    t += dt;
+  }
+
+  EXPECT_NEAR(0.0, errorSum / (trajectory.TotalTime().value() / dt.value()),
+              0.08);
+  EXPECT_NEAR(0.0, maxError, 0.2);
+}
+
+TEST(FixedLagPoseEstimatorTest, VisionOutliers) {
+  frc::FixedLagPoseEstimator estimator{
+      50, frc::Pose2d{}, {0.02, 0.02, 0.01}, {0.1, 0.1, 0.01}};
+
+  frc::Trajectory trajectory = frc::TrajectoryGenerator::GenerateTrajectory(
+      std::vector{frc::Pose2d{0_m, 0_m, 45_deg}, frc::Pose2d{3_m, 0_m, -90_deg},
+                  frc::Pose2d{0_m, 0_m, 135_deg},
+                  frc::Pose2d{-3_m, 0_m, -90_deg},
+                  frc::Pose2d{0_m, 0_m, 45_deg}},
+      frc::TrajectoryConfig(10_mps, 5.0_mps_sq));
+
+  std::default_random_engine generator;
+  std::normal_distribution<double> distribution(0.0, 1.0);
+
+  units::second_t dt = 0.02_s;
+  units::second_t t = 0.0_s;
+
+  units::second_t kVisionUpdateRate = 0.1_s;
+  units::second_t lastVisionUpdateTime{-std::numeric_limits<double>::max()};
+  int visionCount = 0;
+
+  frc::Pose2d odometryPose;
+  frc::Pose2d lastGroundTruthPose = trajectory.Sample(0_s).pose;
+
+  double maxError = -std::numeric_limits<double>::max();
+  double errorSum = 0;
+
+  while (t <= trajectory.TotalTime()) {
+    auto groundTruthState = trajectory.Sample(t);
+
+    if (lastVisionUpdateTime + kVisionUpdateRate < t) {
+      frc::Pose2d visionPose;
+      if (++visionCount % 5 == 0) {
+        // a wildly wrong solve, e.g. from an AprilTag misdetection
+        visionPose = groundTruthState.pose +
+                     frc::Transform2d{frc::Translation2d{5_m, -5_m},
+                                      frc::Rotation2d{90_deg}};
+      } else {
+        visionPose =
+            groundTruthState.pose +
+            frc::Transform2d{
+                frc::Translation2d{distribution(generator) * 0.1 * 1_m,
+                                   distribution(generator) * 0.1 * 1_m},
+                frc::Rotation2d{distribution(generator) * 0.01 * 1_rad}};
+      }
+      estimator.AddVisionMeasurement(visionPose, t);
+      lastVisionUpdateTime = t;
+    }
+
+    auto delta = groundTruthState.pose - lastGroundTruthPose;
+    lastGroundTruthPose = groundTruthState.pose;
+    odometryPose =
+        odometryPose +
+        frc::Transform2d{
+            frc::Translation2d{
+                delta.X() * (1 + distribution(generator) * 0.01),
+                delta.Y() * (1 + distribution(generator) * 0.01)},
+            delta.Rotation() +
+                frc::Rotation2d{distribution(generator) * 0.001 * 1_rad}};
+
+    auto xhat = estimator.UpdateWithTime(t, odometryPose);
+
+    double error = groundTruthState.pose.Translation()
+                       .Distance(xhat.Translation())
+                       .value();
+
+    if (error > maxError) {
+      maxError = error;
+    }
+    errorSum += error;
+
+    t += dt;
+  }
+
+  // the Huber loss keeps periodic outliers from dragging the estimate
+  EXPECT_NEAR(0.0, errorSum / (trajectory.TotalTime().value() / dt.value()),
+              0.15);
+  EXPECT_NEAR(0.0, maxError, 0.5);
+}
@@ -62,6 +62,47 @@ frc::Vectord<5> GlobalMeasurementModel(const frc::Vectord<5>& x,
   static_cast<void>(u);
   return frc::Vectord<5>{x(0), x(1), x(2), x(3), x(4)};
 }
+
+// Dynamics() vectorized across all sigma point columns
+frc::Matrixd<5, 11> BatchedDynamics(const frc::Matrixd<5, 11>& x,
+                                    const frc::Vectord<2>& u) {
+  auto motors = frc::DCMotor::CIM(2);
+
+  constexpr double Ghigh = 7.08;       // High gear ratio
+  constexpr auto rb = 0.8382_m / 2.0;  // Robot radius
+  constexpr auto r = 0.0746125_m;      // Wheel radius
+  constexpr auto m = 63.503_kg;        // Robot mass
+  constexpr auto J = 5.6_kg_sq_m;      // Robot moment of inertia
+
+  auto C1 = -std::pow(Ghigh, 2) * motors.Kt /
+            (motors.Kv * motors.R * units::math::pow<2>(r));
+  auto C2 = Ghigh * motors.Kt / (motors.R * r);
+  auto k1 = (1 / m + units::math::pow<2>(rb) / J);
+  auto k2 = (1 / m - units::math::pow<2>(rb) / J);
+
+  auto vl = x.row(3).array();
+  auto vr = x.row(4).array();
+  double Vl = u(0);
+  double Vr = u(1);
+
+  auto v = 0.5 * (vl + vr);
+  frc::Matrixd<5, 11> xdot;
+  xdot.row(0) = v * x.row(2).array().cos();
+  xdot.row(1) = v * x.row(2).array().sin();
+  xdot.row(2) = (vr - vl) / (2.0 * rb.value());
+  xdot.row(3) = k1.value() * (C1.value() * vl + C2.value() * Vl) +
+                k2.value() * (C1.value() * vr + C2.value() * Vr);
+  xdot.row(4) = k2.value() * (C1.value() * vl + C2.value() * Vl) +
+                k1.value() * (C1.value() * vr + C2.value() * Vr);
+  return xdot;
+}
+
+// LocalMeasurementModel() vectorized across all sigma point columns
+frc::Matrixd<3, 11> BatchedLocalMeasurementModel(const frc::Matrixd<5, 11>& x,
+                                                 const frc::Vectord<2>& u) {
+  static_cast<void>(u);
+  return x.block<3, 11>(2, 0);
+}
 }  // namespace
 
 TEST(UnscentedKalmanFilterTest, Init) {
@@ -170,6 +211,46 @@ TEST(UnscentedKalmanFilterTest, Convergence) {
   EXPECT_NEAR(0.0, observer.Xhat(4), 0.1);
 }
 
+TEST(UnscentedKalmanFilterTest, BatchedSigmaPropagation) {
+  constexpr auto dt = 5_ms;
+
+  frc::UnscentedKalmanFilter<5, 2, 3> observer{Dynamics,
+                                               LocalMeasurementModel,
+                                               {0.5, 0.5, 10.0, 1.0, 1.0},
+                                               {0.0001, 0.01, 0.01},
+                                               frc::AngleMean<5, 5>(2),
+                                               frc::AngleMean<3, 5>(0),
+                                               frc::AngleResidual<5>(2),
+                                               frc::AngleResidual<3>(0),
+                                               frc::AngleAdd<5>(2),
+                                               dt};
+  frc::UnscentedKalmanFilter<5, 2, 3> batchedObserver{Dynamics,
+                                                      LocalMeasurementModel,
+                                                      {0.5, 0.5, 10.0, 1.0, 1.0},
+                                                      {0.0001, 0.01, 0.01},
+                                                      frc::AngleMean<5, 5>(2),
+                                                      frc::AngleMean<3, 5>(0),
+                                                      frc::AngleResidual<5>(2),
+                                                      frc::AngleResidual<3>(0),
+                                                      frc::AngleAdd<5>(2),
+                                                      dt};
+  batchedObserver.SetBatchedF(BatchedDynamics);
+  batchedObserver.SetBatchedH(BatchedLocalMeasurementModel);
+
+  frc::Vectord<2> u{12.0, 12.0};
+  for (int i = 0; i < 100; ++i) {
+    observer.Predict(u, dt);
+    batchedObserver.Predict(u, dt);
+
+    auto localY = LocalMeasurementModel(observer.Xhat(), u);
+    observer.Correct(u, localY);
+    batchedObserver.Correct(u, localY);
+  }
+
+  EXPECT_TRUE(batchedObserver.Xhat().isApprox(observer.Xhat(), 1e-9));
+  EXPECT_TRUE(batchedObserver.S().isApprox(observer.S(), 1e-9));
+}
+
 TEST(UnscentedKalmanFilterTest, RoundTripP) {
   constexpr auto dt = 5_ms;
 
@@ -0,0 +1,72 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include "frc/filter/LinearFilter.h"
+#include "frc/filter/MultiChannelLinearFilter.h"
+#include "gtest/gtest.h"
+#include "units/time.h"
+
+TEST(MultiChannelLinearFilterTest, MatchesPerChannelMovingAverage) {
+  constexpr size_t kChannels = 4;
+
+  std::vector<frc::LinearFilter<double>> reference;
+  for (size_t i = 0; i < kChannels; ++i) {
+    reference.emplace_back(frc::LinearFilter<double>::MovingAverage(5));
+  }
+  frc::MultiChannelLinearFilter<double> batch{
+      kChannels, std::vector<double>(5, 1.0 / 5.0), {}};
+
+  std::array<double, kChannels> inputs;
+  std::array<double, kChannels> outputs;
+  for (int n = 0; n < 100; ++n) {
+    for (size_t ch = 0; ch < kChannels; ++ch) {
+      inputs[ch] = std::sin(0.1 * n + ch);
+    }
+    batch.Calculate(inputs, outputs);
+
+    for (size_t ch = 0; ch < kChannels; ++ch) {
+      EXPECT_DOUBLE_EQ(reference[ch].Calculate(inputs[ch]), outputs[ch]);
+    }
+  }
+}
+
+TEST(MultiChannelLinearFilterTest, MatchesPerChannelSinglePoleIIR) {
+  constexpr size_t kChannels = 3;
+  const double gain = std::exp(-0.02 / 1.0);
+
+  std::vector<frc::LinearFilter<double>> reference;
+  for (size_t i = 0; i < kChannels; ++i) {
+    reference.emplace_back(
+        frc::LinearFilter<double>::SinglePoleIIR(1.0, 20_ms));
+  }
+  frc::MultiChannelLinearFilter<double> batch{kChannels, {1.0 - gain}, {-gain}};
+
+  std::array<double, kChannels> inputs;
+  std::array<double, kChannels> outputs;
+  for (int n = 0; n < 100; ++n) {
+    for (size_t ch = 0; ch < kChannels; ++ch) {
+      inputs[ch] = std::cos(0.05 * n) + 0.5 * ch;
+    }
+    batch.Calculate(inputs, outputs);
+
+    for (size_t ch = 0; ch < kChannels; ++ch) {
+      EXPECT_DOUBLE_EQ(reference[ch].Calculate(inputs[ch]), outputs[ch]);
+    }
+  }
+}
+
+TEST(MultiChannelLinearFilterTest, SizeChecks) {
+  frc::MultiChannelLinearFilter<double> batch{2, {1.0}, {}};
+
+  std::array<double, 3> inputs{};
+  std::array<double, 2> outputs{};
+  EXPECT_THROW(batch.Calculate(inputs, outputs), std::invalid_argument);
+
+  EXPECT_THROW((frc::MultiChannelLinearFilter<double>{0, {1.0}, {}}),
+               std::invalid_argument);
+}
@@ -0,0 +1,101 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <vector>
+
+#include "frc/geometry/BatchTransform.h"
+#include "gtest/gtest.h"
+
+using namespace frc;
+
+TEST(BatchTransformTest, RotatePoints) {
+  std::vector<Translation2d> points{Translation2d{3_m, 0_m},
+                                    Translation2d{1_m, 2_m},
+                                    Translation2d{-2_m, 1_m}};
+  const Rotation2d rotation{90_deg};
+
+  auto expected = points;
+  for (auto& point : expected) {
+    point = point.RotateBy(rotation);
+  }
+
+  RotatePoints(points, rotation);
+
+  for (size_t i = 0; i < points.size(); ++i) {
+    EXPECT_NEAR(expected[i].X().value(), points[i].X().value(), 1e-9);
+    EXPECT_NEAR(expected[i].Y().value(), points[i].Y().value(), 1e-9);
+  }
+}
+
+TEST(BatchTransformTest, TransformPoints) {
+  std::vector<Translation2d> points;
+  for (int i = 0; i < 100; ++i) {
+    points.emplace_back(units::meter_t{0.1 * i}, units::meter_t{-0.2 * i});
+  }
+  const Transform2d transform{Translation2d{1_m, 2_m}, Rotation2d{30_deg}};
+
+  auto expected = points;
+  for (auto& point : expected) {
+    point = point.RotateBy(transform.Rotation()) + transform.Translation();
+  }
+
+  TransformPoints(points, transform);
+
+  for (size_t i = 0; i < points.size(); ++i) {
+    EXPECT_NEAR(expected[i].X().value(), points[i].X().value(), 1e-9);
+    EXPECT_NEAR(expected[i].Y().value(), points[i].Y().value(), 1e-9);
+  }
+}
+
+TEST(BatchTransformTest, TransformPoses) {
+  std::vector<Pose2d> poses{Pose2d{0_m, 0_m, 0_deg}, Pose2d{1_m, 2_m, 45_deg},
+                            Pose2d{-3_m, 1_m, -90_deg}};
+  const Transform2d transform{Translation2d{1_m, 2_m}, Rotation2d{30_deg}};
+
+  auto expected = poses;
+  for (auto& pose : expected) {
+    pose = pose.TransformBy(transform);
+  }
+
+  TransformPoses(poses, transform);
+
+  for (size_t i = 0; i < poses.size(); ++i) {
+    EXPECT_EQ(expected[i], poses[i]);
+  }
+}
+
+TEST(BatchTransformTest, ExpPoses) {
+  const Pose3d start{1_m, 2_m, 3_m, Rotation3d{0.1_rad, -0.2_rad, 0.3_rad}};
+  std::vector<Twist3d> twists{
+      Twist3d{},
+      Twist3d{1_m, 0_m, 0_m, 0_rad, 0_rad, 0.5_rad},
+      Twist3d{0.5_m, -0.5_m, 0.25_m, 0.1_rad, 0.2_rad, -0.3_rad}};
+
+  auto poses = ExpPoses(start, twists);
+
+  ASSERT_EQ(twists.size(), poses.size());
+  for (size_t i = 0; i < twists.size(); ++i) {
+    EXPECT_EQ(start.Exp(twists[i]), poses[i]);
+  }
+}
+
+TEST(BatchTransformTest, LogPoses) {
+  const Pose3d start{1_m, 2_m, 3_m, Rotation3d{0.1_rad, -0.2_rad, 0.3_rad}};
+  std::vector<Pose3d> ends{
+      start, Pose3d{2_m, 1_m, 3.5_m, Rotation3d{0_rad, 0_rad, 0.5_rad}},
+      Pose3d{-1_m, 0.5_m, 2_m, Rotation3d{-0.2_rad, 0.1_rad, -0.4_rad}}};
+
+  auto twists = LogPoses(start, ends);
+
+  ASSERT_EQ(ends.size(), twists.size());
+  for (size_t i = 0; i < ends.size(); ++i) {
+    auto expected = start.Log(ends[i]);
+    EXPECT_NEAR(expected.dx.value(), twists[i].dx.value(), 1e-9);
+    EXPECT_NEAR(expected.dy.value(), twists[i].dy.value(), 1e-9);
+    EXPECT_NEAR(expected.dz.value(), twists[i].dz.value(), 1e-9);
+    EXPECT_NEAR(expected.rx.value(), twists[i].rx.value(), 1e-9);
+    EXPECT_NEAR(expected.ry.value(), twists[i].ry.value(), 1e-9);
+    EXPECT_NEAR(expected.rz.value(), twists[i].rz.value(), 1e-9);
+  }
+}
@@ -80,3 +80,17 @@ TEST(QuaternionTest, Inverse) {
   EXPECT_DOUBLE_EQ(-q.Y(), inv.Y());
   EXPECT_DOUBLE_EQ(-q.Z(), inv.Z());
 }
+
+TEST(QuaternionTest, Rotate) {
+  Quaternion q = Quaternion{0.75, 0.3, 0.4, 0.5}.Normalize();
+  Eigen::Vector3d v{1.0, -2.0, 3.0};
+
+  // Rotate() is the fused form of conjugation by the quaternion
+  Quaternion p{0.0, v(0), v(1), v(2)};
+  auto expected = q * p * q.Inverse();
+
+  auto actual = q.Rotate(v);
+  EXPECT_NEAR(expected.X(), actual(0), 1e-9);
+  EXPECT_NEAR(expected.Y(), actual(1), 1e-9);
+  EXPECT_NEAR(expected.Z(), actual(2), 1e-9);
+}
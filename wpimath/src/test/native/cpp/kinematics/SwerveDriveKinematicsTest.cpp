@@ -256,3 +256,45 @@ TEST_F(SwerveDriveKinematicsTest, Desaturate) {
   EXPECT_NEAR(arr[2].speed.value(), 4.0 * kFactor, kEpsilon);
   EXPECT_NEAR(arr[3].speed.value(), 7.0 * kFactor, kEpsilon);
 }
+
+TEST_F(SwerveDriveKinematicsTest, DesaturatedModuleStates) {
+  ChassisSpeeds speeds{0.0_mps, 0.0_mps, 2 * std::numbers::pi * 1_rad_per_s};
+
+  // With the modules already at the target angles, the fused pipeline should
+  // match inverse kinematics followed by desaturation.
+  auto plain = m_kinematics.ToSwerveModuleStates(speeds);
+  wpi::array<Rotation2d, 4> currentAngles{plain[0].angle, plain[1].angle,
+                                          plain[2].angle, plain[3].angle};
+  SwerveDriveKinematics<4>::DesaturateWheelSpeeds(&plain, 5.5_mps);
+
+  auto fused = m_kinematics.ToDesaturatedSwerveModuleStates(
+      speeds, currentAngles, 5.5_mps);
+
+  for (size_t i = 0; i < 4; ++i) {
+    EXPECT_NEAR(fused[i].speed.value(), plain[i].speed.value(), kEpsilon);
+    EXPECT_NEAR(fused[i].angle.Radians().value(),
+                plain[i].angle.Radians().value(), kEpsilon);
+  }
+}
+
+TEST_F(SwerveDriveKinematicsTest, DesaturatedModuleStatesOptimization) {
+  ChassisSpeeds speeds{5.0_mps, 0.0_mps, 0.0_rad_per_s};
+
+  // fl is reversed rather than rotated 180 degrees; fr is scaled by the
+  // cosine of its 60 degree heading error; bl and br are already aligned.
+  wpi::array<Rotation2d, 4> currentAngles{Rotation2d{180_deg},
+                                          Rotation2d{60_deg}, Rotation2d{0_deg},
+                                          Rotation2d{0_deg}};
+
+  auto [fl, fr, bl, br] = m_kinematics.ToDesaturatedSwerveModuleStates(
+      speeds, currentAngles, 5.5_mps);
+
+  EXPECT_NEAR(fl.speed.value(), -5.0, kEpsilon);
+  EXPECT_NEAR(fl.angle.Degrees().value(), 180.0, kEpsilon);
+
+  EXPECT_NEAR(fr.speed.value(), 5.0 * 0.5, kEpsilon);
+  EXPECT_NEAR(fr.angle.Degrees().value(), 0.0, kEpsilon);
+
+  EXPECT_NEAR(bl.speed.value(), 5.0, kEpsilon);
+  EXPECT_NEAR(br.speed.value(), 5.0, kEpsilon);
+}
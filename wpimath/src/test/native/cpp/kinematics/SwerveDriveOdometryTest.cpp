@@ -194,3 +194,55 @@ TEST_F(SwerveDriveOdometryTest, AccuracyFacingXAxis) {
   EXPECT_LT(errorSum / (trajectory.TotalTime().value() / dt.value()), 0.06);
   EXPECT_LT(maxError, 0.125);
 }
+
+TEST_F(SwerveDriveOdometryTest, FusedUpdateWithSpeeds) {
+  m_odometry.ResetPosition(Pose2d{}, 0_rad, zero, zero, zero, zero);
+
+  SwerveModulePosition position{0.5_m, 0_deg};
+  auto speeds = m_odometry.UpdateWithSpeeds(
+      0_deg, {position, position, position, position}, 20_ms);
+  auto pose = m_odometry.GetPose();
+
+  // 0.5 m over 20 ms straight ahead
+  EXPECT_NEAR(25.0, speeds.vx.value(), kEpsilon);
+  EXPECT_NEAR(0.0, speeds.vy.value(), kEpsilon);
+  EXPECT_NEAR(0.0, speeds.omega.value(), kEpsilon);
+
+  EXPECT_NEAR(0.5, pose.X().value(), kEpsilon);
+  EXPECT_NEAR(0.0, pose.Y().value(), kEpsilon);
+  EXPECT_NEAR(0.0, pose.Rotation().Degrees().value(), kEpsilon);
+}
+
+TEST_F(SwerveDriveOdometryTest, FusedUpdateMatchesUpdate) {
+  SwerveDriveOdometry<4> reference{m_kinematics, 0_rad,
+                                   {zero, zero, zero, zero}};
+  m_odometry.ResetPosition(Pose2d{}, 0_rad, zero, zero, zero, zero);
+
+  // Module azimuths are constant, so the midpoint-angle correction is a
+  // no-op and both paths must integrate the same pose.
+  SwerveModulePosition fl{18.85_m, 90_deg};
+  SwerveModulePosition fr{42.15_m, 26.565_deg};
+  SwerveModulePosition bl{18.85_m, -90_deg};
+  SwerveModulePosition br{42.15_m, -26.565_deg};
+
+  // seed the previous azimuths so the midpoint matches the end angle
+  reference.Update(0_deg, SwerveModulePosition{0_m, fl.angle},
+                   SwerveModulePosition{0_m, fr.angle},
+                   SwerveModulePosition{0_m, bl.angle},
+                   SwerveModulePosition{0_m, br.angle});
+  m_odometry.UpdateWithSpeeds(0_deg,
+                              {SwerveModulePosition{0_m, fl.angle},
+                               SwerveModulePosition{0_m, fr.angle},
+                               SwerveModulePosition{0_m, bl.angle},
+                               SwerveModulePosition{0_m, br.angle}},
+                              20_ms);
+
+  auto expected = reference.Update(90_deg, fl, fr, bl, br);
+  m_odometry.UpdateWithSpeeds(90_deg, {fl, fr, bl, br}, 20_ms);
+  auto actual = m_odometry.GetPose();
+
+  EXPECT_NEAR(expected.X().value(), actual.X().value(), kEpsilon);
+  EXPECT_NEAR(expected.Y().value(), actual.Y().value(), kEpsilon);
+  EXPECT_NEAR(expected.Rotation().Degrees().value(),
+              actual.Rotation().Degrees().value(), kEpsilon);
+}
@@ -0,0 +1,82 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <vector>
+
+#include "frc/trajectory/StreamingTrajectory.h"
+#include "frc/trajectory/TrajectoryGenerator.h"
+#include "frc/trajectory/constraint/CentripetalAccelerationConstraint.h"
+#include "gtest/gtest.h"
+#include "units/acceleration.h"
+#include "units/math.h"
+#include "units/velocity.h"
+
+namespace {
+
+std::vector<frc::Pose2d> GetTestWaypoints() {
+  return {frc::Pose2d{0_m, 0_m, 0_deg}, frc::Pose2d{3_m, 2_m, 45_deg},
+          frc::Pose2d{6_m, 0_m, 0_deg}, frc::Pose2d{9_m, -2_m, -45_deg},
+          frc::Pose2d{12_m, 0_m, 0_deg}};
+}
+
+void CompareToMonolithic(const std::vector<frc::Pose2d>& waypoints,
+                         frc::TrajectoryConfig&& monolithicConfig,
+                         frc::TrajectoryConfig&& streamingConfig) {
+  auto trajectory =
+      frc::TrajectoryGenerator::GenerateTrajectory(waypoints, monolithicConfig);
+  frc::StreamingTrajectory streaming{waypoints, std::move(streamingConfig)};
+
+  units::second_t dt = 0.02_s;
+  for (units::second_t t = 0_s; t < trajectory.TotalTime(); t += dt) {
+    auto expected = trajectory.Sample(t);
+    auto actual = streaming.Sample(t);
+
+    EXPECT_NEAR(expected.pose.X().value(), actual.pose.X().value(), 1E-6);
+    EXPECT_NEAR(expected.pose.Y().value(), actual.pose.Y().value(), 1E-6);
+    EXPECT_NEAR(expected.velocity.value(), actual.velocity.value(), 1E-6);
+  }
+
+  EXPECT_FALSE(streaming.IsDone(trajectory.TotalTime() - dt));
+  EXPECT_NEAR(trajectory.TotalTime().value(), streaming.TotalTime().value(),
+              1E-6);
+  EXPECT_TRUE(streaming.IsDone(trajectory.TotalTime() + dt));
+}
+
+}  // namespace
+
+TEST(StreamingTrajectoryTest, MatchesMonolithicGeneration) {
+  CompareToMonolithic(GetTestWaypoints(),
+                      frc::TrajectoryConfig{3_mps, 3_mps_sq},
+                      frc::TrajectoryConfig{3_mps, 3_mps_sq});
+}
+
+TEST(StreamingTrajectoryTest, MatchesMonolithicWithConstraint) {
+  frc::TrajectoryConfig monolithicConfig{3_mps, 3_mps_sq};
+  monolithicConfig.AddConstraint(
+      frc::CentripetalAccelerationConstraint{1_mps_sq});
+
+  frc::TrajectoryConfig streamingConfig{3_mps, 3_mps_sq};
+  streamingConfig.AddConstraint(
+      frc::CentripetalAccelerationConstraint{1_mps_sq});
+
+  CompareToMonolithic(GetTestWaypoints(), std::move(monolithicConfig),
+                      std::move(streamingConfig));
+}
+
+TEST(StreamingTrajectoryTest, Reversed) {
+  frc::TrajectoryConfig monolithicConfig{3_mps, 3_mps_sq};
+  monolithicConfig.SetReversed(true);
+
+  frc::TrajectoryConfig streamingConfig{3_mps, 3_mps_sq};
+  streamingConfig.SetReversed(true);
+
+  CompareToMonolithic(GetTestWaypoints(), std::move(monolithicConfig),
+                      std::move(streamingConfig));
+}
+
+TEST(StreamingTrajectoryTest, InitialPose) {
+  frc::StreamingTrajectory streaming{GetTestWaypoints(),
+                                     frc::TrajectoryConfig{3_mps, 3_mps_sq}};
+  EXPECT_EQ(frc::Pose2d(0_m, 0_m, 0_deg), streaming.InitialPose());
+}
@@ -0,0 +1,37 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <cstdio>
+#include <string>
+
+#include "frc/trajectory/TrajectoryConfig.h"
+#include "frc/trajectory/TrajectoryUtil.h"
+#include "gtest/gtest.h"
+#include "trajectory/TestTrajectory.h"
+
+using namespace frc;
+
+TEST(TrajectoryBinaryTest, RoundTripMatches) {
+  TrajectoryConfig config{12_fps, 12_fps_sq};
+  auto trajectory = TestTrajectory::GetTrajectory(config);
+
+  std::string path = testing::TempDir() + "trajectory.wpitraj";
+  Trajectory deserialized;
+  EXPECT_NO_THROW(TrajectoryUtil::ToBinary(trajectory, path));
+  EXPECT_NO_THROW(deserialized = TrajectoryUtil::FromBinary(path));
+  EXPECT_EQ(trajectory.States(), deserialized.States());
+  std::remove(path.c_str());
+}
+
+TEST(TrajectoryBinaryTest, BadFileThrows) {
+  std::string path = testing::TempDir() + "trajectory.json";
+  {
+    std::FILE* f = std::fopen(path.c_str(), "w");
+    ASSERT_NE(f, nullptr);
+    std::fputs("[]", f);
+    std::fclose(f);
+  }
+  EXPECT_THROW(TrajectoryUtil::FromBinary(path), std::runtime_error);
+  std::remove(path.c_str());
+}
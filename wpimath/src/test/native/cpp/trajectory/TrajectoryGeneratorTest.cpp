@@ -40,3 +40,27 @@ TEST(TrajectoryGenertionTest, ReturnsEmptyOnMalformed) {
   ASSERT_EQ(t.States().size(), 1u);
   ASSERT_EQ(t.TotalTime(), 0_s);
 }
+
+TEST(TrajectoryGenerationTest, IncrementalMatchesFullGeneration) {
+  TrajectoryConfig config{12_fps, 12_fps_sq};
+  std::vector<Pose2d> waypoints{Pose2d{0_m, 0_m, 0_deg},
+                                Pose2d{2_m, 1_m, 45_deg},
+                                Pose2d{4_m, 0_m, 0_deg}};
+
+  IncrementalTrajectoryGenerator generator;
+  auto incremental = generator.Generate(waypoints, config);
+  auto full = TrajectoryGenerator::GenerateTrajectory(waypoints, config);
+  EXPECT_EQ(incremental.States().size(), full.States().size());
+  EXPECT_EQ(incremental.TotalTime(), full.TotalTime());
+
+  // Move only the start pose; the cached interior spline should still produce
+  // the same trajectory as regenerating from scratch.
+  waypoints[0] = Pose2d{0.5_m, 0.25_m, 10_deg};
+  incremental = generator.Generate(waypoints, config);
+  full = TrajectoryGenerator::GenerateTrajectory(waypoints, config);
+  ASSERT_EQ(incremental.States().size(), full.States().size());
+  EXPECT_EQ(incremental.TotalTime(), full.TotalTime());
+  for (size_t i = 0; i < full.States().size(); ++i) {
+    EXPECT_EQ(incremental.States()[i].pose, full.States()[i].pose);
+  }
+}
@@ -7,7 +7,6 @@
 #include <fmt/format.h>
 #include <wpi/Logger.h>
 #include <wpi/StringExtras.h>
-#include <wpi/json.h>
 
 #include "wpinet/uv/Tcp.h"
 #include "wpinet/uv/Timer.h"
@@ -23,6 +22,7 @@ DsClient::DsClient(wpi::uv::Loop& loop, wpi::Logger& logger,
       m_timer{uv::Timer::Create(loop)} {
   m_tcp->end.connect([this] {
     WPI_DEBUG4(m_logger, "DS connection closed");
+    m_lastIp.reset();
     clearIp();
     // try to connect again
     m_tcp->Reuse([this] { m_timer->Start(kReconnectTime); });
@@ -39,6 +39,7 @@ DsClient::~DsClient() = default;
 void DsClient::Close() {
   m_tcp->Close();
   m_timer->Close();
+  m_lastIp.reset();
   clearIp();
 }
 
@@ -87,13 +88,37 @@ void DsClient::HandleIncoming(std::string_view in) {
 
 void DsClient::ParseJson() {
   WPI_DEBUG4(m_logger, "DsClient JSON: {}", m_json);
-  unsigned int ip = 0;
-  try {
-    ip = wpi::json::parse(m_json).at("robotIP").get<unsigned int>();
-  } catch (wpi::json::exception& e) {
-    WPI_INFO(m_logger, "DsClient JSON error: {}", e.what());
+
+  // Extract the robotIP value without building a JSON DOM; this runs on
+  // every DS status tick and the messages are flat key/value objects
+  std::string_view rest{m_json};
+  auto keyPos = rest.find("\"robotIP\"");
+  if (keyPos == std::string_view::npos) {
+    return;
+  }
+  rest = wpi::ltrim(wpi::drop_front(rest, keyPos + 9));
+  if (!wpi::starts_with(rest, ':')) {
+    WPI_INFO(m_logger, "DsClient JSON error: expected ':' after robotIP");
+    return;
+  }
+  rest = wpi::ltrim(wpi::drop_front(rest));
+  size_t numDigits = 0;
+  while (numDigits < rest.size() && wpi::isDigit(rest[numDigits])) {
+    ++numDigits;
+  }
+  auto parsed =
+      wpi::parse_integer<unsigned int>(wpi::slice(rest, 0, numDigits), 10);
+  if (!parsed) {
+    WPI_INFO(m_logger, "DsClient JSON error: invalid robotIP value");
+    return;
+  }
+  unsigned int ip = *parsed;
+
+  // only fire the callback when the IP actually changes
+  if (m_lastIp && *m_lastIp == ip) {
     return;
   }
+  m_lastIp = ip;
 
   if (ip == 0) {
     clearIp();
@@ -4,20 +4,44 @@
 
 #include "wpinet/EventLoopRunner.h"
 
+#include <atomic>
+#include <bit>
+
 #include <wpi/SmallVector.h>
 #include <wpi/condition_variable.h>
 #include <wpi/mutex.h>
+#include <wpi/timestamp.h>
 
 #include "wpinet/uv/AsyncFunction.h"
 #include "wpinet/uv/Loop.h"
+#include "wpinet/uv/Prepare.h"
 
 using namespace wpi;
 
+namespace {
+
+// loop timing counters; written from the loop thread, snapshotted from any
+// thread, so everything is a relaxed atomic
+struct ProfileData {
+  std::atomic<uint64_t> iterations{0};
+  std::atomic<uint64_t> buckets[EventLoopRunner::LoopProfile::kNumBuckets] = {};
+  std::atomic<uint64_t> maxTimeUs{0};
+
+  std::atomic<uint64_t> stallThresholdUs{0};
+  // only taken when installing the callback or when a stall fires
+  wpi::mutex stallMutex;
+  std::function<void(uint64_t)> stallCallback;
+};
+
+}  // namespace
+
 class EventLoopRunner::Thread : public SafeThread {
  public:
   using UvExecFunc = uv::AsyncFunction<void(LoopFunc)>;
 
-  Thread() : m_loop(uv::Loop::Create()) {
+  Thread()
+      : m_loop(uv::Loop::Create()),
+        m_profile{std::make_shared<ProfileData>()} {
     // set up async handles
     if (!m_loop) {
       return;
@@ -29,6 +53,53 @@ class EventLoopRunner::Thread : public SafeThread {
           func(*loop);
           out.set_value();
         });
+
+    // loop instrumentation: one full iteration elapses between consecutive
+    // prepare callbacks; subtracting the loop's own idle (poll wait) time
+    // over the same interval leaves the time spent running callbacks
+    uv_loop_configure(m_loop->GetRaw(), UV_METRICS_IDLE_TIME);
+    struct IterState {
+      uint64_t lastTime = 0;
+      uint64_t lastIdleUs = 0;
+    };
+    auto state = std::make_shared<IterState>();
+
+    auto prepare = uv::Prepare::Create(m_loop);
+    prepare->prepare.connect([state, loop = m_loop.get(),
+                              profile = m_profile] {
+      uint64_t now = wpi::Now();
+      uint64_t idleUs = uv_metrics_idle_time(loop->GetRaw()) / 1000;
+      if (state->lastTime == 0) {
+        state->lastTime = now;
+        state->lastIdleUs = idleUs;
+        return;
+      }
+      uint64_t wall = now - state->lastTime;
+      uint64_t idle = idleUs - state->lastIdleUs;
+      state->lastTime = now;
+      state->lastIdleUs = idleUs;
+      // the two clocks aren't the same source, so guard the subtraction
+      uint64_t delta = wall > idle ? wall - idle : 0;
+      profile->iterations.fetch_add(1, std::memory_order_relaxed);
+      size_t bucket = std::bit_width(delta);
+      if (bucket >= LoopProfile::kNumBuckets) {
+        bucket = LoopProfile::kNumBuckets - 1;
+      }
+      profile->buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+      if (delta > profile->maxTimeUs.load(std::memory_order_relaxed)) {
+        profile->maxTimeUs.store(delta, std::memory_order_relaxed);
+      }
+      uint64_t threshold =
+          profile->stallThresholdUs.load(std::memory_order_relaxed);
+      if (threshold != 0 && delta >= threshold) {
+        std::scoped_lock lock{profile->stallMutex};
+        if (profile->stallCallback) {
+          profile->stallCallback(delta);
+        }
+      }
+    });
+    prepare->Start();
+    prepare->Unreference();  // don't hold the loop open
   }
 
   void Main() override {
@@ -42,6 +113,9 @@ class EventLoopRunner::Thread : public SafeThread {
 
   // run function
   std::weak_ptr<UvExecFunc> m_doExec;
+
+  // loop timing instrumentation
+  std::shared_ptr<ProfileData> m_profile;
 };
 
 EventLoopRunner::EventLoopRunner() {
@@ -89,3 +163,31 @@ std::shared_ptr<uv::Loop> EventLoopRunner::GetLoop() {
   }
   return nullptr;
 }
+
+EventLoopRunner::LoopProfile EventLoopRunner::GetLoopProfile() {
+  LoopProfile profile;
+  if (auto thr = m_owner.GetThread()) {
+    auto& data = *thr->m_profile;
+    profile.iterations = data.iterations.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < LoopProfile::kNumBuckets; ++i) {
+      profile.buckets[i] = data.buckets[i].load(std::memory_order_relaxed);
+    }
+    profile.maxTimeUs = data.maxTimeUs.load(std::memory_order_relaxed);
+  }
+  return profile;
+}
+
+void EventLoopRunner::SetStallCallback(
+    uint64_t thresholdUs, std::function<void(uint64_t durationUs)> callback) {
+  if (auto thr = m_owner.GetThread()) {
+    auto& data = *thr->m_profile;
+    bool enabled;
+    {
+      std::scoped_lock lock{data.stallMutex};
+      data.stallCallback = std::move(callback);
+      enabled = static_cast<bool>(data.stallCallback);
+    }
+    data.stallThresholdUs.store(enabled ? thresholdUs : 0,
+                                std::memory_order_relaxed);
+  }
+}
@@ -9,12 +9,143 @@
 #include <wpi/SmallVector.h>
 #include <wpi/SpanExtras.h>
 #include <wpi/StringExtras.h>
+#include <wpi/StringMap.h>
 #include <wpi/fmt/raw_ostream.h>
+#include <wpi/mutex.h>
 
 #include "wpinet/raw_uv_ostream.h"
 
 using namespace wpi;
 
+namespace {
+
+struct CachedFile {
+  uv_file fd = -1;
+  uint64_t size = 0;
+  uint64_t mtimeSec = 0;
+  uint64_t mtimeNsec = 0;
+};
+
+// Process-wide cache of open file descriptors for static assets, keyed by
+// path and revalidated against size and modification time with a single
+// stat per request.  Cached descriptors stay open for the life of the
+// process; the cache is bounded, and files beyond the bound are opened and
+// closed per-request (cached = false).
+CachedFile GetCachedFile(std::string_view filename, bool* cached) {
+  static wpi::mutex mutex;
+  static StringMap<CachedFile> files;
+  static constexpr size_t kMaxCachedFiles = 32;
+
+  *cached = false;
+  SmallString<128> pathBuf{filename};
+  const char* pathStr = pathBuf.c_str();
+
+  uv_fs_t req;
+  if (uv_fs_stat(nullptr, &req, pathStr, nullptr) < 0) {
+    uv_fs_req_cleanup(&req);
+    return {};
+  }
+  uv_stat_t st = *static_cast<uv_stat_t*>(req.ptr);
+  uv_fs_req_cleanup(&req);
+
+  std::scoped_lock lock{mutex};
+  auto it = files.find(filename);
+  if (it != files.end()) {
+    auto& file = it->second;
+    if (file.size == st.st_size &&
+        file.mtimeSec == static_cast<uint64_t>(st.st_mtim.tv_sec) &&
+        file.mtimeNsec == static_cast<uint64_t>(st.st_mtim.tv_nsec)) {
+      *cached = true;
+      return file;
+    }
+    // stale; close and reopen below
+    uv_fs_t closeReq;
+    uv_fs_close(nullptr, &closeReq, file.fd, nullptr);
+    uv_fs_req_cleanup(&closeReq);
+    files.erase(it);
+  }
+
+  uv_fs_t openReq;
+  int fd = uv_fs_open(nullptr, &openReq, pathStr, UV_FS_O_RDONLY, 0, nullptr);
+  uv_fs_req_cleanup(&openReq);
+  if (fd < 0) {
+    return {};
+  }
+
+  CachedFile file;
+  file.fd = fd;
+  file.size = st.st_size;
+  file.mtimeSec = static_cast<uint64_t>(st.st_mtim.tv_sec);
+  file.mtimeNsec = static_cast<uint64_t>(st.st_mtim.tv_nsec);
+  if (files.size() < kMaxCachedFiles) {
+    files.insert(std::make_pair(filename, file));
+    *cached = true;
+  }
+  return file;
+}
+
+#ifndef _WIN32
+// Self-deleting sendfile request chain; sends the file content to the
+// socket after the header write completes, reissuing until the full length
+// has been sent.
+struct SendfileHelper {
+  uv_fs_t req;
+  std::shared_ptr<uv::Stream> stream;
+  uv_file outFd;
+  uv_file inFd;
+  bool closeFd;  // close inFd when done (file was not cached)
+  bool closeAfter;
+  int64_t offset = 0;
+  uint64_t remaining;
+
+  void Start() {
+    req.data = this;
+    int err = uv_fs_sendfile(stream->GetLoopRef().GetRaw(), &req, outFd, inFd,
+                             offset, remaining, Callback);
+    if (err < 0) {
+      stream->GetLoopRef().ReportError(err);
+      stream->Close();
+      Done();
+    }
+  }
+
+  static void Callback(uv_fs_t* r) {
+    auto self = static_cast<SendfileHelper*>(r->data);
+    auto result = r->result;
+    uv_fs_req_cleanup(r);
+    if (result <= 0) {
+      if (result < 0) {
+        self->stream->GetLoopRef().ReportError(result);
+      }
+      self->stream->Close();
+      self->Done();
+      return;
+    }
+    self->offset += result;
+    self->remaining -= result;
+    if (self->remaining > 0) {
+      self->Start();
+      return;
+    }
+    if (self->closeAfter) {
+      self->stream->Close();
+    }
+    self->Done();
+  }
+
+  void Done() {
+    if (closeFd) {
+      uv_fs_t closeReq;
+      uv_fs_close(nullptr, &closeReq, inFd, nullptr);
+      uv_fs_req_cleanup(&closeReq);
+    }
+    delete this;
+  }
+};
+#endif  // !_WIN32
+
+}  // namespace
+
 HttpServerConnection::HttpServerConnection(std::shared_ptr<uv::Stream> stream)
     : m_stream(*stream) {
   // process HTTP messages
@@ -138,6 +269,81 @@ void HttpServerConnection::SendStaticResponse(
   });
 }
 
+void HttpServerConnection::SendFileResponse(int code, std::string_view codeText,
+                                            std::string_view contentType,
+                                            std::string_view filename,
+                                            std::string_view extraHeader) {
+  bool cached;
+  CachedFile file = GetCachedFile(filename, &cached);
+  if (file.fd < 0) {
+    SendError(404);
+    return;
+  }
+
+  SmallVector<uv::Buffer, 4> toSend;
+  raw_uv_ostream os{toSend, 4096};
+  BuildHeader(os, code, codeText, contentType, file.size, extraHeader);
+
+#ifdef _WIN32
+  // no OS sendfile path to a socket here; read the content and send it
+  std::unique_ptr<char[]> data{new char[file.size]};
+  uv_buf_t readBuf = uv_buf_init(data.get(), file.size);
+  uv_fs_t readReq;
+  auto nread = uv_fs_read(nullptr, &readReq, file.fd, &readBuf, 1, 0, nullptr);
+  uv_fs_req_cleanup(&readReq);
+  if (!cached) {
+    uv_fs_t closeReq;
+    uv_fs_close(nullptr, &closeReq, file.fd, nullptr);
+    uv_fs_req_cleanup(&closeReq);
+  }
+  if (nread < 0 || static_cast<uint64_t>(nread) != file.size) {
+    for (auto&& buf : toSend) {
+      buf.Deallocate();
+    }
+    SendError(500);
+    return;
+  }
+  os << std::string_view{data.get(), file.size};
+  SendData(os.bufs(), !m_keepAlive);
+#else
+  uv_os_fd_t outFd;
+  if (uv_fileno(m_stream.GetRawHandle(), &outFd) < 0) {
+    for (auto&& buf : toSend) {
+      buf.Deallocate();
+    }
+    if (!cached) {
+      uv_fs_t closeReq;
+      uv_fs_close(nullptr, &closeReq, file.fd, nullptr);
+      uv_fs_req_cleanup(&closeReq);
+    }
+    SendError(500);
+    return;
+  }
+
+  auto helper = new SendfileHelper;
+  helper->stream = m_stream.shared_from_this();
+  helper->outFd = outFd;
+  helper->inFd = file.fd;
+  helper->closeFd = !cached;
+  helper->closeAfter = !m_keepAlive;
+  helper->remaining = file.size;
+
+  // start the sendfile chain once the header write has been queued and
+  // completed, so file content can't pass the header on the wire
+  m_stream.Write(os.bufs(), [helper](auto bufs, uv::Error err) {
+    for (auto&& buf : bufs) {
+      buf.Deallocate();
+    }
+    if (err) {
+      helper->stream->Close();
+      helper->Done();
+      return;
+    }
+    helper->Start();
+  });
+#endif
+}
+
 void HttpServerConnection::SendError(int code, std::string_view message) {
   std::string_view codeText, extra, baseMessage;
   switch (code) {
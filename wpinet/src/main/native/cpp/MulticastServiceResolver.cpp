@@ -5,9 +5,74 @@
 #include "wpinet/MulticastServiceResolver.h"
 
 #include <wpi/MemAlloc.h>
+#include <wpi/StringMap.h>
+#include <wpi/timestamp.h>
 
 #include "MulticastHandleManager.h"
 
+namespace {
+
+struct CacheEntry {
+  wpi::MulticastServiceResolver::ServiceData data;
+  uint64_t expires;
+};
+
+// Process-wide cache of passively received announcements, keyed by service
+// type.  Fed by every running resolver's PushData(), so resolves from a
+// fresh resolver instance can be served without a new active query.
+struct AnnouncementCache {
+  wpi::mutex mutex;
+  uint64_t ttl = 120'000'000;  // us
+  wpi::StringMap<std::vector<CacheEntry>> byType;
+};
+
+AnnouncementCache& GetAnnouncementCache() {
+  static AnnouncementCache cache;
+  return cache;
+}
+
+}  // namespace
+
+void wpi::MulticastServiceResolver::SetCacheTtl(uint64_t seconds) {
+  auto& cache = GetAnnouncementCache();
+  std::scoped_lock lock{cache.mutex};
+  cache.ttl = seconds * 1000000;
+}
+
+void wpi::MulticastServiceResolver::CacheData(const ServiceData& data) {
+  auto& cache = GetAnnouncementCache();
+  std::scoped_lock lock{cache.mutex};
+  auto& entries = cache.byType[serviceTypeKey];
+  uint64_t expires = wpi::Now() + cache.ttl;
+  for (auto&& entry : entries) {
+    if (entry.data.serviceName == data.serviceName) {
+      entry.data = data;
+      entry.expires = expires;
+      return;
+    }
+  }
+  entries.emplace_back(CacheEntry{data, expires});
+}
+
+std::vector<wpi::MulticastServiceResolver::ServiceData>
+wpi::MulticastServiceResolver::GetCachedData() const {
+  std::vector<ServiceData> rv;
+  auto& cache = GetAnnouncementCache();
+  std::scoped_lock lock{cache.mutex};
+  auto it = cache.byType.find(serviceTypeKey);
+  if (it == cache.byType.end()) {
+    return rv;
+  }
+  uint64_t now = wpi::Now();
+  std::erase_if(it->second,
+                [&](const CacheEntry& entry) { return entry.expires <= now; });
+  rv.reserve(it->second.size());
+  for (auto&& entry : it->second) {
+    rv.emplace_back(entry.data);
+  }
+  return rv;
+}
+
 extern "C" {
 WPI_MulticastServiceResolverHandle WPI_CreateMulticastServiceResolver(
     const char* serviceType)
@@ -4,8 +4,13 @@
 
 #include "wpinet/ParallelTcpConnector.h"
 
+#include <algorithm>
+#include <cstring>
+#include <string>
+
 #include <fmt/format.h>
 #include <wpi/Logger.h>
+#include <wpi/SmallVector.h>
 
 #include "wpinet/uv/GetAddrInfo.h"
 #include "wpinet/uv/Loop.h"
@@ -15,6 +20,28 @@
 
 using namespace wpi;
 
+// How long resolution results are considered fresh; stale entries are still
+// used for immediate connection attempts while re-resolution happens in the
+// background.
+static constexpr uv::Timer::Time kResolutionTtl{15000};
+
+// Maximum number of retry cycles a repeatedly-failing address is skipped.
+static constexpr unsigned int kMaxSkipCycles = 3;
+
+static bool SameAddr(const sockaddr_storage& a, const sockaddr_storage& b) {
+  if (a.ss_family != b.ss_family) {
+    return false;
+  }
+  switch (a.ss_family) {
+    case AF_INET:
+      return std::memcmp(&a, &b, sizeof(sockaddr_in)) == 0;
+    case AF_INET6:
+      return std::memcmp(&a, &b, sizeof(sockaddr_in6)) == 0;
+    default:
+      return std::memcmp(&a, &b, sizeof(sockaddr_storage)) == 0;
+  }
+}
+
 ParallelTcpConnector::ParallelTcpConnector(
     wpi::uv::Loop& loop, wpi::uv::Timer::Time reconnectRate,
     wpi::Logger& logger, std::function<void(wpi::uv::Tcp& tcp)> connected,
@@ -42,6 +69,25 @@ void ParallelTcpConnector::Close() {
 void ParallelTcpConnector::SetServers(
     std::span<const std::pair<std::string, unsigned int>> servers) {
   m_servers.assign(servers.begin(), servers.end());
+
+  // prune cached resolutions for servers no longer in the list
+  SmallVector<std::string, 4> removeKeys;
+  for (auto&& entry : m_resolveCache) {
+    bool found = false;
+    for (auto&& server : m_servers) {
+      if (entry.getKey() == fmt::format("{}:{}", server.first, server.second)) {
+        found = true;
+        break;
+      }
+    }
+    if (!found) {
+      removeKeys.emplace_back(entry.getKey());
+    }
+  }
+  for (auto&& key : removeKeys) {
+    m_resolveCache.erase(key);
+  }
+
   if (!IsConnected()) {
     Connect();
   }
@@ -72,85 +118,202 @@ void ParallelTcpConnector::Connect() {
 
   WPI_DEBUG3(m_logger, "starting new connection attempts");
 
-  // kick off parallel lookups
+  auto now = m_loop.Now();
   for (auto&& server : m_servers) {
-    auto req = std::make_shared<uv::GetAddrInfoReq>();
-    m_resolvers.emplace_back(req);
+    auto key = fmt::format("{}:{}", server.first, server.second);
+    auto it = m_resolveCache.find(key);
+    bool haveCache = it != m_resolveCache.end() && !it->second.addrs.empty();
+    if (haveCache) {
+      // connect immediately from cached addresses; a stale entry is still
+      // used while re-resolution happens in the background
+      WPI_DEBUG4(m_logger, "using {} cached address(es) for {}",
+                 it->second.addrs.size(), key);
+      StartAttempts(key, it->second);
+    }
+    if (!haveCache || (now - it->second.resolvedTime) > kResolutionTtl) {
+      StartResolution(server.first, server.second, key);
+    }
+  }
+}
 
-    req->resolved.connect(
-        [this, req = req.get()](const addrinfo& addrinfo) {
-          if (IsConnected()) {
-            return;
+void ParallelTcpConnector::StartResolution(std::string_view host,
+                                           unsigned int port,
+                                           std::string_view key) {
+  auto req = std::make_shared<uv::GetAddrInfoReq>();
+  m_resolvers.emplace_back(req);
+
+  req->resolved.connect(
+      [this, req = req.get(), key = std::string{key}](const addrinfo& addrinfo) {
+        if (IsConnected()) {
+          return;
+        }
+
+        auto& entry = m_resolveCache[key];
+        entry.resolvedTime = m_loop.Now();
+
+        // build the new address list, preserving backoff state for
+        // addresses we already knew about
+        std::vector<CachedAddress> newAddrs;
+        for (auto ai = &addrinfo; ai; ai = ai->ai_next) {
+          CachedAddress ca;
+          std::memset(&ca.addr, 0, sizeof(ca.addr));
+          std::memcpy(&ca.addr, ai->ai_addr,
+                      (std::min)(static_cast<size_t>(ai->ai_addrlen),
+                                 sizeof(ca.addr)));
+          for (auto&& old : entry.addrs) {
+            if (SameAddr(old.addr, ca.addr)) {
+              ca.failCount = old.failCount;
+              ca.skipCycles = old.skipCycles;
+              break;
+            }
           }
+          newAddrs.emplace_back(ca);
+        }
 
-          // kick off parallel connection attempts
-          for (auto ai = &addrinfo; ai; ai = ai->ai_next) {
-            auto tcp = uv::Tcp::Create(m_loop);
-            m_attempts.emplace_back(tcp);
-
-            auto connreq = std::make_shared<uv::TcpConnectReq>();
-            connreq->connected.connect(
-                [this, tcp = tcp.get()] {
-                  if (m_logger.min_level() <= wpi::WPI_LOG_DEBUG4) {
-                    std::string ip;
-                    unsigned int port = 0;
-                    uv::AddrToName(tcp->GetPeer(), &ip, &port);
-                    WPI_DEBUG4(m_logger,
-                               "successful connection ({}) to {} port {}",
-                               static_cast<void*>(tcp), ip, port);
-                  }
-                  if (IsConnected()) {
-                    tcp->Shutdown([tcp] { tcp->Close(); });
-                    return;
-                  }
-                  if (m_connected) {
-                    m_connected(*tcp);
-                  }
-                },
-                shared_from_this());
-
-            connreq->error = [selfWeak = weak_from_this(),
-                              tcp = tcp.get()](uv::Error err) {
-              if (auto self = selfWeak.lock()) {
-                WPI_DEBUG1(self->m_logger, "connect failure ({}): {}",
-                           static_cast<void*>(tcp), err.str());
-              }
-            };
-
-            if (m_logger.min_level() <= wpi::WPI_LOG_DEBUG4) {
-              std::string ip;
-              unsigned int port = 0;
-              uv::AddrToName(*reinterpret_cast<sockaddr_storage*>(ai->ai_addr),
-                             &ip, &port);
-              WPI_DEBUG4(
-                  m_logger,
-                  "Info({}) starting connection attempt ({}) to {} port {}",
-                  static_cast<void*>(req), static_cast<void*>(tcp.get()), ip,
-                  port);
+        // if the address set is unchanged, keep the existing entry (and
+        // generation) so in-flight attempts still update backoff state
+        bool unchanged = newAddrs.size() == entry.addrs.size();
+        if (unchanged) {
+          for (size_t i = 0; i < newAddrs.size(); ++i) {
+            if (!SameAddr(newAddrs[i].addr, entry.addrs[i].addr)) {
+              unchanged = false;
+              break;
             }
-            tcp->Connect(*ai->ai_addr, connreq);
+          }
+        }
+        if (unchanged) {
+          // cached addresses were already attempted when this cycle
+          // started (or resolution returned nothing); no new attempts
+          return;
+        }
+
+        std::vector<CachedAddress> oldAddrs = std::move(entry.addrs);
+        entry.addrs = std::move(newAddrs);
+        ++entry.generation;
+
+        // only attempt addresses that weren't already tried from the cache
+        // this cycle
+        if (oldAddrs.empty()) {
+          StartAttempts(key, entry);
+        } else {
+          StartAttempts(key, entry, &oldAddrs);
+        }
+      },
+      shared_from_this());
+
+  req->error = [req = req.get(), selfWeak = weak_from_this()](uv::Error err) {
+    if (auto self = selfWeak.lock()) {
+      WPI_DEBUG1(self->m_logger, "GetAddrInfo({}) failure: {}",
+                 static_cast<void*>(req), err.str());
+    }
+  };
+
+  WPI_DEBUG4(m_logger, "starting GetAddrInfo({}) for {} port {}",
+             static_cast<void*>(req.get()), host, port);
+  addrinfo hints;
+  std::memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  hints.ai_protocol = IPPROTO_TCP;
+  hints.ai_flags = AI_NUMERICSERV | AI_ADDRCONFIG;
+  uv::GetAddrInfo(m_loop, req, host, fmt::format("{}", port), &hints);
+}
+
+void ParallelTcpConnector::StartAttempts(
+    std::string_view key, ResolutionEntry& entry,
+    const std::vector<CachedAddress>* exclude) {
+  // apply backoff only if it leaves at least one address to attempt;
+  // otherwise attempt everything so a recovering server is found promptly
+  bool anyReady = false;
+  for (auto&& ca : entry.addrs) {
+    if (ca.skipCycles == 0) {
+      anyReady = true;
+      break;
+    }
+  }
+
+  unsigned int gen = entry.generation;
+  for (size_t i = 0; i < entry.addrs.size(); ++i) {
+    auto& ca = entry.addrs[i];
+    if (anyReady && ca.skipCycles > 0) {
+      --ca.skipCycles;
+      WPI_DEBUG4(m_logger, "backing off address {} of {} for {} cycle(s)", i,
+                 key, ca.skipCycles + 1);
+      continue;
+    }
+    if (exclude) {
+      bool skip = false;
+      for (auto&& old : *exclude) {
+        if (SameAddr(old.addr, ca.addr)) {
+          skip = true;
+          break;
+        }
+      }
+      if (skip) {
+        continue;
+      }
+    }
+
+    auto tcp = uv::Tcp::Create(m_loop);
+    m_attempts.emplace_back(tcp);
+
+    auto connreq = std::make_shared<uv::TcpConnectReq>();
+    connreq->connected.connect(
+        [this, tcp = tcp.get(), key = std::string{key}, i, gen] {
+          if (auto* entry = FindCacheEntry(key, gen);
+              entry && i < entry->addrs.size()) {
+            entry->addrs[i].failCount = 0;
+            entry->addrs[i].skipCycles = 0;
+          }
+          if (m_logger.min_level() <= wpi::WPI_LOG_DEBUG4) {
+            std::string ip;
+            unsigned int port = 0;
+            uv::AddrToName(tcp->GetPeer(), &ip, &port);
+            WPI_DEBUG4(m_logger, "successful connection ({}) to {} port {}",
+                       static_cast<void*>(tcp), ip, port);
+          }
+          if (IsConnected()) {
+            tcp->Shutdown([tcp] { tcp->Close(); });
+            return;
+          }
+          if (m_connected) {
+            m_connected(*tcp);
           }
         },
         shared_from_this());
 
-    req->error = [req = req.get(), selfWeak = weak_from_this()](uv::Error err) {
+    connreq->error = [selfWeak = weak_from_this(), tcp = tcp.get(),
+                      key = std::string{key}, i, gen](uv::Error err) {
       if (auto self = selfWeak.lock()) {
-        WPI_DEBUG1(self->m_logger, "GetAddrInfo({}) failure: {}",
-                   static_cast<void*>(req), err.str());
+        WPI_DEBUG1(self->m_logger, "connect failure ({}): {}",
+                   static_cast<void*>(tcp), err.str());
+        if (auto* entry = self->FindCacheEntry(key, gen);
+            entry && i < entry->addrs.size()) {
+          auto& ca = entry->addrs[i];
+          ++ca.failCount;
+          ca.skipCycles = (std::min)(ca.failCount, kMaxSkipCycles);
+        }
       }
     };
 
-    WPI_DEBUG4(m_logger, "starting GetAddrInfo({}) for {} port {}",
-               static_cast<void*>(req.get()), server.first, server.second);
-    addrinfo hints;
-    std::memset(&hints, 0, sizeof(hints));
-    hints.ai_family = AF_UNSPEC;
-    hints.ai_socktype = SOCK_STREAM;
-    hints.ai_protocol = IPPROTO_TCP;
-    hints.ai_flags = AI_NUMERICSERV | AI_ADDRCONFIG;
-    uv::GetAddrInfo(m_loop, req, server.first, fmt::format("{}", server.second),
-                    &hints);
+    if (m_logger.min_level() <= wpi::WPI_LOG_DEBUG4) {
+      std::string ip;
+      unsigned int port = 0;
+      uv::AddrToName(ca.addr, &ip, &port);
+      WPI_DEBUG4(m_logger, "starting connection attempt ({}) to {} port {}",
+                 static_cast<void*>(tcp.get()), ip, port);
+    }
+    tcp->Connect(reinterpret_cast<const sockaddr&>(ca.addr), connreq);
+  }
+}
+
+ParallelTcpConnector::ResolutionEntry* ParallelTcpConnector::FindCacheEntry(
+    std::string_view key, unsigned int gen) {
+  auto it = m_resolveCache.find(key);
+  if (it == m_resolveCache.end() || it->second.generation != gen) {
+    return nullptr;
   }
+  return &it->second;
 }
 
 void ParallelTcpConnector::CancelAll(wpi::uv::Tcp* except) {
@@ -4,6 +4,13 @@
 
 #include "wpinet/PortForwarder.h"
 
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#endif
+
 #include <fmt/format.h>
 #include <wpi/DenseMap.h>
 
@@ -14,6 +21,232 @@
 
 using namespace wpi;
 
+#ifdef __linux__
+namespace {
+
+// Zero-copy relay between two established TCP connections.  Bytes are
+// moved with splice() through a kernel pipe per direction, so forwarded
+// data never enters userspace.  The relay duplicates the socket fds (the
+// uv::Tcp handles are closed by the caller after a successful Start) and
+// runs uv_poll handles on the duplicates; it closes everything and deletes
+// itself when either side reaches EOF or errors.
+class SpliceRelay {
+ public:
+  // Returns true on success, in which case the relay takes over both
+  // connections (caller should close the uv handles and not start reads).
+  static bool Start(uv::Loop& loop, uv::Tcp& first, uv::Tcp& second);
+
+ private:
+  struct Dir {
+    int pipeFds[2]{-1, -1};
+    size_t pipeBytes{0};
+    bool pipeFull{false};
+    bool open{true};  // input socket not yet at EOF
+  };
+
+  SpliceRelay() = default;
+  bool Init(uv::Loop& loop, int fdFirst, int fdSecond);
+  static void PollCb(uv_poll_t* handle, int status, int events);
+  void OnPoll(int idx, int status, int events);
+  bool Fill(Dir& dir, int inFd);
+  bool Flush(Dir& dir, int outFd);
+  void UpdateMasks();
+  void Close();
+  void CloseFds();
+
+  int m_fds[2]{-1, -1};
+  Dir m_dirs[2];  // [0]: fds[0] -> fds[1], [1]: fds[1] -> fds[0]
+  uv_poll_t m_polls[2];
+  int m_pollsActive{0};
+  bool m_closing{false};
+};
+
+bool SpliceRelay::Start(uv::Loop& loop, uv::Tcp& first, uv::Tcp& second) {
+  uv_os_fd_t fdFirst;
+  uv_os_fd_t fdSecond;
+  if (uv_fileno(first.GetRawHandle(), &fdFirst) < 0 ||
+      uv_fileno(second.GetRawHandle(), &fdSecond) < 0) {
+    return false;
+  }
+  int dupFirst = fcntl(fdFirst, F_DUPFD_CLOEXEC, 0);
+  if (dupFirst < 0) {
+    return false;
+  }
+  int dupSecond = fcntl(fdSecond, F_DUPFD_CLOEXEC, 0);
+  if (dupSecond < 0) {
+    ::close(dupFirst);
+    return false;
+  }
+  // relay manages its own lifetime from here on
+  auto relay = new SpliceRelay;
+  return relay->Init(loop, dupFirst, dupSecond);
+}
+
+bool SpliceRelay::Init(uv::Loop& loop, int fdFirst, int fdSecond) {
+  m_fds[0] = fdFirst;
+  m_fds[1] = fdSecond;
+  for (auto& dir : m_dirs) {
+    if (pipe2(dir.pipeFds, O_NONBLOCK | O_CLOEXEC) < 0) {
+      CloseFds();
+      delete this;
+      return false;
+    }
+  }
+  for (int i = 0; i < 2; ++i) {
+    if (uv_poll_init(loop.GetRaw(), &m_polls[i], m_fds[i]) < 0) {
+      if (m_pollsActive > 0) {
+        Close();  // defers delete until close callbacks run
+      } else {
+        CloseFds();
+        delete this;
+      }
+      return false;
+    }
+    m_polls[i].data = this;
+    ++m_pollsActive;
+  }
+  UpdateMasks();
+  return true;
+}
+
+void SpliceRelay::PollCb(uv_poll_t* handle, int status, int events) {
+  auto self = static_cast<SpliceRelay*>(handle->data);
+  self->OnPoll(handle == &self->m_polls[0] ? 0 : 1, status, events);
+}
+
+void SpliceRelay::OnPoll(int idx, int status, int events) {
+  if (m_closing) {
+    return;
+  }
+  if (status < 0) {
+    Close();
+    return;
+  }
+  if ((events & UV_READABLE) != 0) {
+    // data flowing from socket idx; fill its pipe, then drain to the peer
+    if (!Fill(m_dirs[idx], m_fds[idx]) ||
+        !Flush(m_dirs[idx], m_fds[1 - idx])) {
+      Close();
+      return;
+    }
+  }
+  if ((events & UV_WRITABLE) != 0) {
+    if (!Flush(m_dirs[1 - idx], m_fds[idx])) {
+      Close();
+      return;
+    }
+  }
+  for (auto& dir : m_dirs) {
+    if (!dir.open && dir.pipeBytes == 0) {
+      // one side hit EOF and everything is drained; close both ends to
+      // match the copying relay's behavior
+      Close();
+      return;
+    }
+  }
+  UpdateMasks();
+}
+
+bool SpliceRelay::Fill(Dir& dir, int inFd) {
+  if (!dir.open) {
+    return true;
+  }
+  for (;;) {
+    ssize_t n = splice(inFd, nullptr, dir.pipeFds[1], nullptr, 65536,
+                       SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+    if (n > 0) {
+      dir.pipeBytes += n;
+      continue;
+    }
+    if (n == 0) {
+      dir.open = false;  // EOF; close once the pipe is drained
+      return true;
+    }
+    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+      // either the socket is drained or the pipe is full; treating both
+      // as "pipe full" while data is pending just defers reads until the
+      // peer accepts some bytes, which is fine either way
+      if (dir.pipeBytes > 0) {
+        dir.pipeFull = true;
+      }
+      return true;
+    }
+    return false;
+  }
+}
+
+bool SpliceRelay::Flush(Dir& dir, int outFd) {
+  while (dir.pipeBytes > 0) {
+    ssize_t n = splice(dir.pipeFds[0], nullptr, outFd, nullptr, dir.pipeBytes,
+                       SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+    if (n > 0) {
+      dir.pipeBytes -= n;
+      dir.pipeFull = false;
+      continue;
+    }
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+      return true;
+    }
+    return false;
+  }
+  return true;
+}
+
+void SpliceRelay::UpdateMasks() {
+  for (int i = 0; i < 2; ++i) {
+    auto& in = m_dirs[i];       // data read from socket i
+    auto& out = m_dirs[1 - i];  // data written to socket i
+    int events = 0;
+    if (in.open && !in.pipeFull) {
+      events |= UV_READABLE;
+    }
+    if (out.pipeBytes > 0) {
+      events |= UV_WRITABLE;
+    }
+    if (events != 0) {
+      uv_poll_start(&m_polls[i], events, PollCb);
+    } else {
+      uv_poll_stop(&m_polls[i]);
+    }
+  }
+}
+
+void SpliceRelay::Close() {
+  if (m_closing) {
+    return;
+  }
+  m_closing = true;
+  int count = m_pollsActive;
+  for (int i = 0; i < count; ++i) {
+    uv_poll_stop(&m_polls[i]);
+    uv_close(reinterpret_cast<uv_handle_t*>(&m_polls[i]), [](uv_handle_t* h) {
+      auto self = static_cast<SpliceRelay*>(h->data);
+      if (--self->m_pollsActive == 0) {
+        self->CloseFds();
+        delete self;
+      }
+    });
+  }
+}
+
+void SpliceRelay::CloseFds() {
+  for (int fd : m_fds) {
+    if (fd >= 0) {
+      ::close(fd);
+    }
+  }
+  for (auto& dir : m_dirs) {
+    for (int fd : dir.pipeFds) {
+      if (fd >= 0) {
+        ::close(fd);
+      }
+    }
+  }
+}
+
+}  // namespace
+#endif  // __linux__
+
 struct PortForwarder::Impl {
  public:
   EventLoopRunner runner;
@@ -114,6 +347,17 @@ void PortForwarder::Add(unsigned int port, std::string_view remoteHost,
                 }
               });
 
+#ifdef __linux__
+              // relay in the kernel via splice(); the relay duplicates the
+              // socket fds, so close the uv handles and let it take over
+              if (SpliceRelay::Start(remotePtr->GetLoopRef(), *client,
+                                     *remotePtr)) {
+                client->Close();
+                remotePtr->Close();
+                return;
+              }
+#endif
+
               // copy bidirectionally
               client->StartRead();
               remotePtr->StartRead();
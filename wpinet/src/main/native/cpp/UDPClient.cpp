@@ -232,6 +232,66 @@ int UDPClient::receive(uint8_t* data_received, int receive_len,
   return result;
 }
 
+int UDPClient::receive_batch(uint8_t* buffer, int datagram_len,
+                             std::span<ReceivedDatagram> datagrams) {
+  if (m_port == 0) {
+    return -1;  // return if not receiving
+  }
+  if (datagrams.empty() || datagram_len <= 0) {
+    return 0;
+  }
+
+#ifdef __linux__
+  constexpr size_t kMaxBatch = 64;
+  size_t count = datagrams.size() < kMaxBatch ? datagrams.size() : kMaxBatch;
+
+  struct mmsghdr msgs[kMaxBatch];
+  struct iovec iovs[kMaxBatch];
+  struct sockaddr_in remotes[kMaxBatch];
+  std::memset(msgs, 0, count * sizeof(mmsghdr));
+  for (size_t i = 0; i < count; ++i) {
+    iovs[i].iov_base = buffer + i * static_cast<size_t>(datagram_len);
+    iovs[i].iov_len = datagram_len;
+    msgs[i].msg_hdr.msg_iov = &iovs[i];
+    msgs[i].msg_hdr.msg_iovlen = 1;
+    msgs[i].msg_hdr.msg_name = &remotes[i];
+    msgs[i].msg_hdr.msg_namelen = sizeof(remotes[i]);
+  }
+
+  // block for the first datagram, then take whatever else is queued
+  int result = recvmmsg(m_lsd, msgs, count, MSG_WAITFORONE, nullptr);
+  if (result < 0) {
+    return result;
+  }
+
+  for (int i = 0; i < result; ++i) {
+    auto& out = datagrams[i];
+    out.data = {buffer + i * static_cast<size_t>(datagram_len),
+                msgs[i].msg_len};
+
+    char ip[50];
+    inet_ntop(PF_INET, &(remotes[i].sin_addr.s_addr), ip, sizeof(ip) - 1);
+    ip[49] = '\0';
+    out.addr = ip;
+    out.port = ntohs(remotes[i].sin_port);
+  }
+  return result;
+#else
+  // no batch receive syscall; receive a single datagram
+  SmallVector<char, 50> addr;
+  int port = 0;
+  int result = receive(buffer, datagram_len, &addr, &port);
+  if (result < 0) {
+    return result;
+  }
+  auto& out = datagrams[0];
+  out.data = {buffer, static_cast<size_t>(result)};
+  out.addr.assign(addr.begin(), addr.end());
+  out.port = port;
+  return 1;
+#endif
+}
+
 int UDPClient::set_timeout(double timeout) {
   if (timeout < 0) {
     return -1;
@@ -4,6 +4,8 @@
 
 #include "wpinet/WebSocket.h"
 
+#include <algorithm>
+#include <cstring>
 #include <random>
 
 #include <fmt/format.h>
@@ -18,8 +20,196 @@
 #include "wpinet/raw_uv_ostream.h"
 #include "wpinet/uv/Stream.h"
 
+#ifdef WPINET_WEBSOCKET_DEFLATE
+#include <zlib.h>
+
+#include <vector>
+
+#include <wpi/mutex.h>
+#endif
+
 using namespace wpi;
 
+// RSV1; indicates a permessage-deflate compressed message
+static constexpr uint8_t kFlagCompressed = 0x40;
+
+#ifdef WPINET_WEBSOCKET_DEFLATE
+
+// Per-connection compression state.  The zlib streams (and their ~300 KB of
+// window/state allocations) are pooled and reused across connections rather
+// than allocated per handshake.
+class WebSocket::DeflateContext {
+ public:
+  DeflateContext() {
+    std::memset(&m_deflate, 0, sizeof(m_deflate));
+    std::memset(&m_inflate, 0, sizeof(m_inflate));
+    m_ok = deflateInit2(&m_deflate, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -15, 8,
+                        Z_DEFAULT_STRATEGY) == Z_OK &&
+           inflateInit2(&m_inflate, -15) == Z_OK;
+  }
+  DeflateContext(const DeflateContext&) = delete;
+  DeflateContext& operator=(const DeflateContext&) = delete;
+  ~DeflateContext() {
+    deflateEnd(&m_deflate);
+    inflateEnd(&m_inflate);
+  }
+
+  // Get a context from the pool (or create one).  Returns nullptr if zlib
+  // initialization failed.
+  static std::unique_ptr<DeflateContext> Acquire(bool serverNoContextTakeover);
+
+  // Return a context to the pool for reuse by a future connection.
+  static void Release(std::unique_ptr<DeflateContext> ctx);
+
+  // Compress a message fragment with Z_SYNC_FLUSH; on the final fragment the
+  // trailing 00 00 ff ff is stripped per RFC 7692.  Returns false on zlib
+  // error.
+  bool Compress(std::span<const uv::Buffer> data, bool fin,
+                SmallVectorImpl<uint8_t>& out);
+
+  // Decompress a message fragment (appending the 00 00 ff ff tail when fin).
+  // Returns 0 on success, 1 on invalid compressed data, 2 if the decompressed
+  // message exceeds maxSize.
+  int Decompress(std::span<const uint8_t> data, bool fin, size_t maxSize,
+                 SmallVectorImpl<uint8_t>& out);
+
+ private:
+  z_stream m_deflate;
+  z_stream m_inflate;
+  bool m_ok = false;
+  bool m_serverNoContextTakeover = false;
+
+  static wpi::mutex s_poolMutex;
+  static std::vector<std::unique_ptr<DeflateContext>> s_pool;
+};
+
+wpi::mutex WebSocket::DeflateContext::s_poolMutex;
+std::vector<std::unique_ptr<WebSocket::DeflateContext>>
+    WebSocket::DeflateContext::s_pool;
+
+std::unique_ptr<WebSocket::DeflateContext> WebSocket::DeflateContext::Acquire(
+    bool serverNoContextTakeover) {
+  std::unique_ptr<DeflateContext> ctx;
+  {
+    std::scoped_lock lock{s_poolMutex};
+    if (!s_pool.empty()) {
+      ctx = std::move(s_pool.back());
+      s_pool.pop_back();
+    }
+  }
+  if (ctx) {
+    deflateReset(&ctx->m_deflate);
+    inflateReset(&ctx->m_inflate);
+  } else {
+    ctx = std::make_unique<DeflateContext>();
+    if (!ctx->m_ok) {
+      return nullptr;
+    }
+  }
+  ctx->m_serverNoContextTakeover = serverNoContextTakeover;
+  return ctx;
+}
+
+void WebSocket::DeflateContext::Release(std::unique_ptr<DeflateContext> ctx) {
+  static constexpr size_t kMaxPooled = 4;
+  if (!ctx || !ctx->m_ok) {
+    return;
+  }
+  std::scoped_lock lock{s_poolMutex};
+  if (s_pool.size() < kMaxPooled) {
+    s_pool.emplace_back(std::move(ctx));
+  }
+}
+
+bool WebSocket::DeflateContext::Compress(std::span<const uv::Buffer> data,
+                                         bool fin,
+                                         SmallVectorImpl<uint8_t>& out) {
+  auto deflatePass = [&](const char* base, size_t len, int flush) -> bool {
+    m_deflate.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(base));
+    m_deflate.avail_in = len;
+    do {
+      size_t oldSize = out.size();
+      out.resize(oldSize + 4096);
+      m_deflate.next_out = out.data() + oldSize;
+      m_deflate.avail_out = 4096;
+      if (deflate(&m_deflate, flush) == Z_STREAM_ERROR) {
+        return false;
+      }
+      out.resize(oldSize + 4096 - m_deflate.avail_out);
+    } while (m_deflate.avail_out == 0);
+    return true;
+  };
+  if (data.empty()) {
+    // still need the sync flush output for an empty fragment
+    if (!deflatePass(nullptr, 0, Z_SYNC_FLUSH)) {
+      return false;
+    }
+  } else {
+    size_t remaining = data.size();
+    for (auto&& buf : data) {
+      --remaining;
+      if (!deflatePass(buf.base, buf.len,
+                       remaining == 0 ? Z_SYNC_FLUSH : Z_NO_FLUSH)) {
+        return false;
+      }
+    }
+  }
+  if (fin) {
+    // strip the trailing empty stored block emitted by the sync flush
+    if (out.size() >= 4 && out[out.size() - 4] == 0x00 &&
+        out[out.size() - 3] == 0x00 && out[out.size() - 2] == 0xff &&
+        out[out.size() - 1] == 0xff) {
+      out.resize(out.size() - 4);
+    }
+    if (out.empty()) {
+      out.push_back(0x00);  // an empty message is a single empty block
+    }
+    if (m_serverNoContextTakeover) {
+      deflateReset(&m_deflate);
+    }
+  }
+  return true;
+}
+
+int WebSocket::DeflateContext::Decompress(std::span<const uint8_t> data,
+                                          bool fin, size_t maxSize,
+                                          SmallVectorImpl<uint8_t>& out) {
+  static const uint8_t tail[4] = {0x00, 0x00, 0xff, 0xff};
+  for (int pass = 0; pass < (fin ? 2 : 1); ++pass) {
+    if (pass == 0) {
+      m_inflate.next_in = const_cast<Bytef*>(data.data());
+      m_inflate.avail_in = data.size();
+    } else {
+      m_inflate.next_in = const_cast<Bytef*>(tail);
+      m_inflate.avail_in = sizeof(tail);
+    }
+    do {
+      size_t oldSize = out.size();
+      if (oldSize >= maxSize) {
+        return 2;
+      }
+      size_t chunk = (std::min)(maxSize - oldSize, size_t{4096});
+      out.resize(oldSize + chunk);
+      m_inflate.next_out = out.data() + oldSize;
+      m_inflate.avail_out = chunk;
+      int ret = inflate(&m_inflate, Z_NO_FLUSH);
+      out.resize(oldSize + chunk - m_inflate.avail_out);
+      if (ret != Z_OK && ret != Z_BUF_ERROR && ret != Z_STREAM_END) {
+        return 1;
+      }
+    } while (m_inflate.avail_out == 0);
+  }
+  return 0;
+}
+
+#else  // WPINET_WEBSOCKET_DEFLATE
+
+// stub so std::unique_ptr<DeflateContext> has a complete type; never
+// instantiated when compression support is compiled out
+class WebSocket::DeflateContext {};
+
+#endif  // WPINET_WEBSOCKET_DEFLATE
+
 namespace {
 class WebSocketWriteReq : public uv::WriteReq {
  public:
@@ -101,7 +291,11 @@ WebSocket::WebSocket(uv::Stream& stream, bool server, const private_init&)
       [this]() { Terminate(1006, "remote end closed connection"); });
 }
 
-WebSocket::~WebSocket() = default;
+WebSocket::~WebSocket() {
+#ifdef WPINET_WEBSOCKET_DEFLATE
+  DeflateContext::Release(std::move(m_deflate));
+#endif
+}
 
 std::shared_ptr<WebSocket> WebSocket::CreateClient(
     uv::Stream& stream, std::string_view uri, std::string_view host,
@@ -112,13 +306,12 @@ std::shared_ptr<WebSocket> WebSocket::CreateClient(
   return ws;
 }
 
-std::shared_ptr<WebSocket> WebSocket::CreateServer(uv::Stream& stream,
-                                                   std::string_view key,
-                                                   std::string_view version,
-                                                   std::string_view protocol) {
+std::shared_ptr<WebSocket> WebSocket::CreateServer(
+    uv::Stream& stream, std::string_view key, std::string_view version,
+    std::string_view protocol, const ServerExtensions& extensions) {
   auto ws = std::make_shared<WebSocket>(stream, true, private_init{});
   stream.SetData(ws);
-  ws->StartServer(key, version, protocol);
+  ws->StartServer(key, version, protocol, extensions);
   return ws;
 }
 
@@ -267,7 +460,8 @@ void WebSocket::StartClient(std::string_view uri, std::string_view host,
 }
 
 void WebSocket::StartServer(std::string_view key, std::string_view version,
-                            std::string_view protocol) {
+                            std::string_view protocol,
+                            const ServerExtensions& extensions) {
   m_protocol = protocol;
 
   // Build server response
@@ -302,6 +496,28 @@ void WebSocket::StartServer(std::string_view key, std::string_view version,
     os << "Sec-WebSocket-Protocol: " << protocol << "\r\n";
   }
 
+#ifdef WPINET_WEBSOCKET_DEFLATE
+  if (extensions.permessageDeflate) {
+    m_deflate = DeflateContext::Acquire(extensions.serverNoContextTakeover);
+    // only accept the extension if zlib initialization succeeded
+    if (m_deflate) {
+      os << "Sec-WebSocket-Extensions: permessage-deflate";
+      if (extensions.echoServerMaxWindowBits) {
+        os << "; server_max_window_bits=15";
+      }
+      if (extensions.serverNoContextTakeover) {
+        os << "; server_no_context_takeover";
+      }
+      if (extensions.clientNoContextTakeover) {
+        os << "; client_no_context_takeover";
+      }
+      os << "\r\n";
+    }
+  }
+#else
+  static_cast<void>(extensions);
+#endif
+
   // end headers
   os << "\r\n";
 
@@ -386,9 +602,17 @@ void WebSocket::HandleIncoming(uv::Buffer& buf, size_t size) {
           return;  // need more data
         }
 
-        // Validate RSV bits are zero
-        if ((m_header[0] & 0x70) != 0) {
+        // Validate RSV bits are zero; RSV1 is allowed on data frames when
+        // permessage-deflate was negotiated, and marks the message compressed
+        uint8_t rsv = m_header[0] & 0x70;
+        uint8_t rsvOpcode = m_header[0] & kOpMask;
+        if (rsv == kFlagCompressed && m_deflate &&
+            (rsvOpcode == kOpText || rsvOpcode == kOpBinary)) {
+          m_messageCompressed = true;
+        } else if (rsv != 0) {
           return Fail(1002, "nonzero RSV");
+        } else if (rsvOpcode == kOpText || rsvOpcode == kOpBinary) {
+          m_messageCompressed = false;
         }
       }
 
@@ -476,20 +700,41 @@ void WebSocket::HandleIncoming(uv::Buffer& buf, size_t size) {
         // Handle message
         bool fin = (m_header[0] & kFlagFin) != 0;
         uint8_t opcode = m_header[0] & kOpMask;
+
+        // data frames of a compressed message are decompressed at delivery
+        // time (so fragments combine before inflation when configured)
+        std::span<uint8_t> payload{m_payload.data(), m_payload.size()};
+#ifdef WPINET_WEBSOCKET_DEFLATE
+        SmallVector<uint8_t, 1024> decompressed;
+        if (m_deflate && m_messageCompressed &&
+            (opcode == kOpCont || opcode == kOpText || opcode == kOpBinary) &&
+            (fin || !m_combineFragments)) {
+          switch (m_deflate->Decompress(payload, fin, m_maxMessageSize,
+                                        decompressed)) {
+            case 1:
+              return Fail(1007, "invalid compressed data");
+            case 2:
+              return Fail(1009, "message too large");
+            default:
+              break;
+          }
+          payload = decompressed;
+        }
+#endif
+
         switch (opcode) {
           case kOpCont:
             switch (m_fragmentOpcode) {
               case kOpText:
                 if (!m_combineFragments || fin) {
-                  text(std::string_view{reinterpret_cast<char*>(
-                                            m_payload.data()),
-                                        m_payload.size()},
+                  text(std::string_view{reinterpret_cast<char*>(payload.data()),
+                                        payload.size()},
                        fin);
                 }
                 break;
               case kOpBinary:
                 if (!m_combineFragments || fin) {
-                  binary(m_payload, fin);
+                  binary(payload, fin);
                 }
                 break;
               default:
@@ -508,11 +753,11 @@ void WebSocket::HandleIncoming(uv::Buffer& buf, size_t size) {
 #ifdef WPINET_WEBSOCKET_VERBOSE_DEBUG
               fmt::print(
                   "WS RecvText({})\n",
-                  std::string_view{reinterpret_cast<char*>(m_payload.data()),
-                                   m_payload.size()});
+                  std::string_view{reinterpret_cast<char*>(payload.data()),
+                                   payload.size()});
 #endif
-              text(std::string_view{reinterpret_cast<char*>(m_payload.data()),
-                                    m_payload.size()},
+              text(std::string_view{reinterpret_cast<char*>(payload.data()),
+                                    payload.size()},
                    fin);
             }
             if (!fin) {
@@ -527,13 +772,13 @@ void WebSocket::HandleIncoming(uv::Buffer& buf, size_t size) {
 #ifdef WPINET_WEBSOCKET_VERBOSE_DEBUG
               SmallString<128> str;
               raw_svector_ostream stros{str};
-              for (auto ch : m_payload) {
+              for (auto ch : payload) {
                 stros << fmt::format("{:02x},",
                                      static_cast<unsigned int>(ch) & 0xff);
               }
               fmt::print("WS RecvBinary({})\n", str.str());
 #endif
-              binary(m_payload, fin);
+              binary(payload, fin);
             }
             if (!fin) {
               m_fragmentOpcode = opcode;
@@ -596,7 +841,8 @@ void WebSocket::HandleIncoming(uv::Buffer& buf, size_t size) {
 
 static void WriteFrame(WebSocketWriteReq& req,
                        SmallVectorImpl<uv::Buffer>& bufs, bool server,
-                       uint8_t opcode, std::span<const uv::Buffer> data) {
+                       uint8_t opcode, std::span<const uv::Buffer> data,
+                       bool dataInternal = false) {
   SmallVector<uv::Buffer, 4> internalBufs;
   raw_uv_ostream os{internalBufs, 4096};
 
@@ -619,53 +865,71 @@ static void WriteFrame(WebSocketWriteReq& req,
   }
 #endif
 
-  // opcode (includes FIN bit)
-  os << static_cast<unsigned char>(opcode);
-
-  // payload length
+  // format the frame header (opcode including FIN bit, then payload length)
+  // into a stack buffer and emit it as a single write
   uint64_t size = 0;
   for (auto&& buf : data) {
     size += buf.len;
   }
+  uint8_t header[10];
+  size_t headerLen = 2;
+  header[0] = opcode;
   if (size < 126) {
-    os << static_cast<unsigned char>((server ? 0x00 : kFlagMasking) | size);
+    header[1] = static_cast<uint8_t>((server ? 0x00 : kFlagMasking) | size);
   } else if (size <= 0xffff) {
-    os << static_cast<unsigned char>((server ? 0x00 : kFlagMasking) | 126);
-    const uint8_t sizeMsb[] = {static_cast<uint8_t>((size >> 8) & 0xff),
-                               static_cast<uint8_t>(size & 0xff)};
-    os << std::span{sizeMsb};
+    header[1] = (server ? 0x00 : kFlagMasking) | 126;
+    header[2] = static_cast<uint8_t>((size >> 8) & 0xff);
+    header[3] = static_cast<uint8_t>(size & 0xff);
+    headerLen = 4;
   } else {
-    os << static_cast<unsigned char>((server ? 0x00 : kFlagMasking) | 127);
-    const uint8_t sizeMsb[] = {static_cast<uint8_t>((size >> 56) & 0xff),
-                               static_cast<uint8_t>((size >> 48) & 0xff),
-                               static_cast<uint8_t>((size >> 40) & 0xff),
-                               static_cast<uint8_t>((size >> 32) & 0xff),
-                               static_cast<uint8_t>((size >> 24) & 0xff),
-                               static_cast<uint8_t>((size >> 16) & 0xff),
-                               static_cast<uint8_t>((size >> 8) & 0xff),
-                               static_cast<uint8_t>(size & 0xff)};
-    os << std::span{sizeMsb};
+    header[1] = (server ? 0x00 : kFlagMasking) | 127;
+    for (int i = 0; i < 8; ++i) {
+      header[2 + i] = static_cast<uint8_t>((size >> (8 * (7 - i))) & 0xff);
+    }
+    headerLen = 10;
   }
+  os << std::span<const uint8_t>{header, headerLen};
 
   // clients need to mask the input data
   if (!server) {
     // generate masking key
     static std::random_device rd;
     static std::default_random_engine gen{rd()};
-    std::uniform_int_distribution<unsigned int> dist(0, 255);
+    std::uniform_int_distribution<uint32_t> dist;
     uint8_t key[4];
-    for (uint8_t& v : key) {
-      v = dist(gen);
-    }
+    uint32_t keyVal = dist(gen);
+    std::memcpy(key, &keyVal, 4);
     os << std::span<const uint8_t>{key, 4};
-    // copy and mask data
-    int n = 0;
+    // copy and mask data; XOR a word at a time (the compiler vectorizes
+    // this), handling the sub-word remainder of each chunk bytewise
+    char chunk[1024];
+    size_t n = 0;
     for (auto&& buf : data) {
-      for (auto&& ch : buf.data()) {
-        os << static_cast<unsigned char>(static_cast<uint8_t>(ch) ^ key[n++]);
-        if (n >= 4) {
-          n = 0;
+      const char* p = buf.base;
+      size_t left = buf.len;
+      while (left > 0) {
+        size_t amt = (std::min)(left, sizeof(chunk));
+        std::memcpy(chunk, p, amt);
+        // rotate the key to the current payload offset so the XOR word is
+        // constant within this chunk
+        const uint8_t k[4] = {key[n & 3], key[(n + 1) & 3], key[(n + 2) & 3],
+                              key[(n + 3) & 3]};
+        uint32_t keyWord;
+        std::memcpy(&keyWord, k, 4);
+        size_t i = 0;
+        for (; i + 4 <= amt; i += 4) {
+          uint32_t word;
+          std::memcpy(&word, &chunk[i], 4);
+          word ^= keyWord;
+          std::memcpy(&chunk[i], &word, 4);
+        }
+        for (; i < amt; ++i) {
+          chunk[i] ^= k[i & 3];
         }
+        os << std::string_view{chunk, amt};
+        p += amt;
+        left -= amt;
+        n += amt;
       }
     }
     bufs.append(internalBufs.begin(), internalBufs.end());
@@ -676,7 +940,13 @@ static void WriteFrame(WebSocketWriteReq& req,
     bufs.append(data.begin(), data.end());
   }
   req.m_internalBufs.append(internalBufs.begin(), internalBufs.end());
-  req.m_userBufs.append(data.begin(), data.end());
+  if (dataInternal) {
+    // data buffers are owned by the request (e.g. compressed copies), not
+    // the caller
+    req.m_internalBufs.append(data.begin(), data.end());
+  } else {
+    req.m_userBufs.append(data.begin(), data.end());
+  }
 }
 
 void WebSocket::SendFrames(
@@ -700,6 +970,35 @@ void WebSocket::SendFrames(
 
   auto req = std::make_shared<WebSocketWriteReq>(std::move(callback));
   SmallVector<uv::Buffer, 4> bufs;
+#ifdef WPINET_WEBSOCKET_DEFLATE
+  if (m_deflate) {
+    for (auto&& frame : frames) {
+      uint8_t opcode = frame.opcode & kOpMask;
+      bool fin = (frame.opcode & kFlagFin) != 0;
+      SmallVector<uint8_t, 1024> compressed;
+      if ((opcode != kOpText && opcode != kOpBinary && opcode != kOpCont) ||
+          !m_deflate->Compress(frame.data, fin, compressed)) {
+        // control frames are never compressed; on a zlib error just send
+        // the frame uncompressed (each message marks itself via RSV1)
+        WriteFrame(*req, bufs, m_server, frame.opcode, frame.data);
+        continue;
+      }
+      uv::Buffer compressedBufs[1] = {uv::Buffer::Allocate(compressed.size())};
+      std::memcpy(compressedBufs[0].base, compressed.data(),
+                  compressed.size());
+      // RSV1 is only set on the first frame of a message
+      uint8_t sendOpcode = frame.opcode;
+      if (opcode != kOpCont) {
+        sendOpcode |= kFlagCompressed;
+      }
+      WriteFrame(*req, bufs, m_server, sendOpcode, compressedBufs, true);
+      // the caller still gets its own buffers back in the callback
+      req->m_userBufs.append(frame.data.begin(), frame.data.end());
+    }
+    m_stream.Write(bufs, req);
+    return;
+  }
+#endif
   for (auto&& frame : frames) {
     WriteFrame(*req, bufs, m_server, frame.opcode, frame.data);
   }
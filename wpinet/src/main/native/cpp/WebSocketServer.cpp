@@ -37,6 +37,55 @@ WebSocketServerHelper::WebSocketServerHelper(HttpParser& req) {
           m_protocols.emplace_back(protocol);
         }
       }
+#ifdef WPINET_WEBSOCKET_DEFLATE
+    } else if (equals_lower(name, "sec-websocket-extensions")) {
+      // Offers are comma delimited; accept the first permessage-deflate
+      // offer whose parameters we can honor (RFC 7692)
+      if (m_extensions.permessageDeflate) {
+        return;
+      }
+      SmallVector<std::string_view, 4> offers;
+      split(value, offers, ",", -1, false);
+      for (auto offer : offers) {
+        SmallVector<std::string_view, 4> params;
+        split(offer, params, ";", -1, false);
+        if (params.empty() ||
+            !equals_lower(trim(params[0]), "permessage-deflate")) {
+          continue;
+        }
+        WebSocket::ServerExtensions ext;
+        ext.permessageDeflate = true;
+        bool ok = true;
+        for (size_t i = 1; i < params.size(); ++i) {
+          auto [pname, pvalue] = split(params[i], '=');
+          pname = trim(pname);
+          pvalue = trim(pvalue);
+          if (equals_lower(pname, "server_no_context_takeover")) {
+            ext.serverNoContextTakeover = true;
+          } else if (equals_lower(pname, "client_no_context_takeover")) {
+            ext.clientNoContextTakeover = true;
+          } else if (equals_lower(pname, "client_max_window_bits")) {
+            // any client window size inflates fine with a full window
+          } else if (equals_lower(pname, "server_max_window_bits")) {
+            // we always compress with a full 15-bit window, so we can only
+            // honor this parameter when the client allows 15
+            if (pvalue != "15") {
+              ok = false;
+              break;
+            }
+            ext.echoServerMaxWindowBits = true;
+          } else {
+            // unknown parameter; decline this offer
+            ok = false;
+            break;
+          }
+        }
+        if (ok) {
+          m_extensions = ext;
+          break;
+        }
+      }
+#endif
     }
   });
   req.headersComplete.connect([&req, this](bool) {
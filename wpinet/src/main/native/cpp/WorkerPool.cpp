@@ -0,0 +1,115 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "wpinet/WorkerPool.h"
+
+#include <atomic>
+#include <deque>
+#include <thread>
+#include <vector>
+
+#include <wpi/condition_variable.h>
+#include <wpi/mutex.h>
+
+using namespace wpi;
+using namespace wpi::detail;
+
+struct WorkerPoolExecutor::Impl {
+  struct Worker {
+    wpi::mutex mutex;
+    std::deque<std::function<void()>> queue;
+  };
+
+  explicit Impl(size_t numThreads);
+
+  void ThreadMain(size_t index);
+
+  std::vector<std::unique_ptr<Worker>> workers;
+  std::atomic<size_t> nextWorker{0};
+  std::atomic<size_t> pending{0};
+
+  // sleep/wakeup for idle workers
+  wpi::mutex sleepMutex;
+  wpi::condition_variable wakeup;
+};
+
+WorkerPoolExecutor::Impl::Impl(size_t numThreads) {
+  workers.reserve(numThreads);
+  for (size_t i = 0; i < numThreads; ++i) {
+    workers.emplace_back(std::make_unique<Worker>());
+  }
+  for (size_t i = 0; i < numThreads; ++i) {
+    // the pool lives for the life of the process
+    std::thread{[this, i] { ThreadMain(i); }}.detach();
+  }
+}
+
+void WorkerPoolExecutor::Impl::ThreadMain(size_t index) {
+  for (;;) {
+    std::function<void()> task;
+
+    // take from our own queue first
+    {
+      auto& worker = *workers[index];
+      std::scoped_lock lock{worker.mutex};
+      if (!worker.queue.empty()) {
+        task = std::move(worker.queue.front());
+        worker.queue.pop_front();
+      }
+    }
+
+    // otherwise steal from the other end of another worker's queue
+    if (!task) {
+      for (size_t i = 1; i < workers.size(); ++i) {
+        auto& worker = *workers[(index + i) % workers.size()];
+        std::scoped_lock lock{worker.mutex};
+        if (!worker.queue.empty()) {
+          task = std::move(worker.queue.back());
+          worker.queue.pop_back();
+          break;
+        }
+      }
+    }
+
+    if (task) {
+      --pending;
+      task();
+      continue;
+    }
+
+    std::unique_lock lock{sleepMutex};
+    wakeup.wait(lock, [this] { return pending.load() != 0; });
+  }
+}
+
+WorkerPoolExecutor& WorkerPoolExecutor::GetInstance() {
+  // intentionally leaked; joining detached pool threads at process exit
+  // isn't possible, and tasks may be queued from static destructors
+  static WorkerPoolExecutor* inst = new WorkerPoolExecutor;
+  return *inst;
+}
+
+WorkerPoolExecutor::WorkerPoolExecutor() {
+  size_t numThreads = std::thread::hardware_concurrency();
+  if (numThreads < 2) {
+    numThreads = 2;
+  }
+  m_impl = new Impl{numThreads};
+}
+
+void WorkerPoolExecutor::Enqueue(std::function<void()> task) {
+  size_t index = m_impl->nextWorker.fetch_add(1) % m_impl->workers.size();
+  {
+    auto& worker = *m_impl->workers[index];
+    std::scoped_lock lock{worker.mutex};
+    worker.queue.emplace_back(std::move(task));
+  }
+  ++m_impl->pending;
+  // take the sleep lock so a worker can't check the predicate and block
+  // between our increment and the notify
+  {
+    std::scoped_lock lock{m_impl->sleepMutex};
+  }
+  m_impl->wakeup.notify_one();
+}
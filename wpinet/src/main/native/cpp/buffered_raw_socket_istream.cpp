@@ -0,0 +1,58 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "wpinet/buffered_raw_socket_istream.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "wpinet/NetworkStream.h"
+
+using namespace wpi;
+
+void buffered_raw_socket_istream::read_impl(void* data, size_t len) {
+  char* cdata = static_cast<char*>(data);
+  size_t pos = 0;
+
+  while (pos < len) {
+    if (m_pos == m_end) {
+      NetworkStream::Error err;
+      // read large requests directly into the destination to avoid a
+      // double copy
+      if (len - pos >= m_bufSize) {
+        size_t count =
+            m_stream.receive(&cdata[pos], len - pos, &err, m_timeout);
+        if (count == 0) {
+          error_detected();
+          break;
+        }
+        pos += count;
+        continue;
+      }
+
+      // refill the buffer with whatever's available (partial reads are fine)
+      size_t count = m_stream.receive(m_buf.get(), m_bufSize, &err, m_timeout);
+      if (count == 0) {
+        error_detected();
+        break;
+      }
+      m_pos = 0;
+      m_end = count;
+    }
+
+    size_t amt = (std::min)(m_end - m_pos, len - pos);
+    std::memcpy(&cdata[pos], m_buf.get() + m_pos, amt);
+    m_pos += amt;
+    pos += amt;
+  }
+  set_read_count(pos);
+}
+
+void buffered_raw_socket_istream::close() {
+  m_stream.close();
+}
+
+size_t buffered_raw_socket_istream::in_avail() const {
+  return m_end - m_pos;
+}
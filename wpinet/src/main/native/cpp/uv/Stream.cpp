@@ -4,6 +4,8 @@
 
 #include "wpinet/uv/Stream.h"
 
+#include <cstring>
+
 #include <wpi/SmallVector.h>
 
 using namespace wpi;
@@ -97,6 +99,36 @@ void Stream::Write(std::span<const Buffer> bufs,
   Write(bufs, std::make_shared<CallbackWriteReq>(bufs, std::move(callback)));
 }
 
+void Stream::WriteCopy(std::span<const Buffer> bufs) {
+  size_t total = 0;
+  for (auto&& buf : bufs) {
+    total += buf.len;
+  }
+  if (total == 0) {
+    return;
+  }
+
+  auto& pool = GetLoopRef().GetBufferPool();
+  bool pooled = total <= pool.GetBufferSize();
+  Buffer out = pooled ? pool.Allocate() : Buffer::Allocate(total);
+  size_t pos = 0;
+  for (auto&& buf : bufs) {
+    std::memcpy(out.base + pos, buf.base, buf.len);
+    pos += buf.len;
+  }
+  out.len = total;
+
+  Write({out}, [this, pooled](std::span<Buffer> written, Error) {
+    if (pooled) {
+      GetLoopRef().GetBufferPool().Release(written);
+    } else {
+      for (auto&& buf : written) {
+        buf.Deallocate();
+      }
+    }
+  });
+}
+
 int Stream::TryWrite(std::span<const Buffer> bufs) {
   int val = uv_try_write(GetRawStream(), bufs.data(), bufs.size());
   if (val < 0) {
@@ -0,0 +1,118 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "wpinet/uv/TimerWheel.h"
+
+#include "wpinet/uv/Loop.h"
+
+namespace wpi::uv {
+
+TimerWheel::Entry::~Entry() {
+  if (m_wheel) {
+    m_wheel->Disarm(*this);
+  }
+}
+
+TimerWheel::TimerWheel(Loop& loop, Time resolution)
+    : m_loop{loop}, m_resolution{resolution.count()} {
+  if (m_resolution == 0) {
+    m_resolution = 1;
+  }
+  for (auto& slot : m_slots) {
+    slot.m_next = &slot;
+    slot.m_prev = &slot;
+  }
+  m_timer = Timer::Create(loop);
+  if (m_timer) {
+    m_timer->timeout.connect([this] { Tick(); });
+  }
+}
+
+TimerWheel::~TimerWheel() {
+  for (auto& slot : m_slots) {
+    Entry* e = slot.m_next;
+    while (e != &slot) {
+      Entry* next = e->m_next;
+      e->m_next = nullptr;
+      e->m_prev = nullptr;
+      e->m_armed = false;
+      e->m_wheel = nullptr;
+      e = next;
+    }
+  }
+  if (m_timer) {
+    m_timer->Close();
+  }
+}
+
+void TimerWheel::Arm(Entry& entry, Time timeout) {
+  Disarm(entry);
+  if (!m_timer) {
+    return;
+  }
+  uint64_t now = m_loop.Now().count();
+  if (m_count == 0) {
+    // wheel was idle; resynchronize the tick counter before scheduling
+    m_tick = now / m_resolution;
+    m_timer->Start(Time{m_resolution}, Time{m_resolution});
+  }
+  // round up so entries never fire early, and always fire asynchronously
+  uint64_t expire =
+      (now + timeout.count() + m_resolution - 1) / m_resolution;
+  if (expire <= m_tick) {
+    expire = m_tick + 1;
+  }
+  entry.m_expireTick = expire;
+  entry.m_wheel = this;
+  entry.m_armed = true;
+  entry.InsertAfter(&m_slots[expire & (kNumSlots - 1)]);
+  ++m_count;
+}
+
+void TimerWheel::Disarm(Entry& entry) {
+  if (entry.m_next) {
+    entry.Unlink();
+  }
+  if (entry.m_armed) {
+    entry.m_armed = false;
+    --m_count;
+    if (m_count == 0) {
+      m_timer->Stop();
+    }
+  }
+}
+
+void TimerWheel::Tick() {
+  uint64_t target = m_loop.Now().count() / m_resolution;
+  Entry fired;  // local sentinel; expired entries are parked here
+  fired.m_next = &fired;
+  fired.m_prev = &fired;
+  while (m_tick < target) {
+    ++m_tick;
+    Entry& slot = m_slots[m_tick & (kNumSlots - 1)];
+    Entry* e = slot.m_next;
+    while (e != &slot) {
+      Entry* next = e->m_next;
+      if (e->m_expireTick <= m_tick) {
+        e->Unlink();
+        e->InsertAfter(&fired);
+        e->m_armed = false;
+        --m_count;
+      }
+      e = next;
+    }
+    // fire after the slot scan so callbacks may freely arm and disarm
+    // other entries (including back into this slot)
+    while (fired.m_next != &fired) {
+      Entry* f = fired.m_next;
+      f->Unlink();
+      f->timeout();
+    }
+  }
+  if (m_count == 0) {
+    m_timer->Stop();
+  }
+}
+
+}  // namespace wpi::uv
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 
@@ -50,6 +51,7 @@ class DsClient : public std::enable_shared_from_this<DsClient> {
   std::shared_ptr<wpi::uv::Timer> m_timer;
 
   std::string m_json;
+  std::optional<unsigned int> m_lastIp;
 };
 
 }  // namespace wpi
@@ -5,6 +5,8 @@
 #ifndef WPINET_EVENTLOOPRUNNER_H_
 #define WPINET_EVENTLOOPRUNNER_H_
 
+#include <stdint.h>
+
 #include <functional>
 #include <memory>
 
@@ -21,6 +23,30 @@ class EventLoopRunner {
  public:
   using LoopFunc = std::function<void(uv::Loop&)>;
 
+  /**
+   * Snapshot of loop timing instrumentation.  An "iteration" is the active
+   * phase of one loop pass: everything run between returning from polling
+   * for I/O and the next poll (I/O callbacks, timers, close callbacks).
+   * Time spent blocked waiting for I/O is not counted.
+   */
+  struct LoopProfile {
+    /** Number of histogram buckets. */
+    static constexpr size_t kNumBuckets = 20;
+
+    /** Total number of loop iterations measured. */
+    uint64_t iterations = 0;
+
+    /**
+     * Iteration duration histogram with power-of-2 microsecond buckets;
+     * bucket N counts iterations that took less than 2^N microseconds
+     * (the last bucket also counts everything longer).
+     */
+    uint64_t buckets[kNumBuckets] = {};
+
+    /** Longest iteration observed, in microseconds. */
+    uint64_t maxTimeUs = 0;
+  };
+
   EventLoopRunner();
   virtual ~EventLoopRunner();
 
@@ -53,6 +79,29 @@ class EventLoopRunner {
    */
   std::shared_ptr<uv::Loop> GetLoop();
 
+  /**
+   * Get a snapshot of the loop timing instrumentation.  The counters are
+   * updated from the loop thread with relaxed atomics, so the snapshot is
+   * cheap and safe to take from any thread (including during matches).
+   * If the loop thread is not running, returns a zeroed profile.
+   * @return The profile snapshot
+   */
+  LoopProfile GetLoopProfile();
+
+  /**
+   * Set a callback to be called (on the loop thread) whenever a loop
+   * iteration takes at least the given threshold.  The callback is passed
+   * the iteration duration in microseconds; it runs before the loop polls
+   * again, so it can e.g. log or Walk() the loop's handles to identify the
+   * culprit.  Pass a zero threshold or nullptr callback to disable.
+   * This is safe to call from any thread.
+   *
+   * @param thresholdUs stall threshold in microseconds
+   * @param callback function called on the loop thread with the duration
+   */
+  void SetStallCallback(uint64_t thresholdUs,
+                        std::function<void(uint64_t durationUs)> callback);
+
  private:
   class Thread;
   SafeThreadOwner<Thread> m_owner;
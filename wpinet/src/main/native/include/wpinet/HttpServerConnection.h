@@ -114,6 +114,29 @@ class HttpServerConnection {
                                   std::string_view content, bool gzipped,
                                   std::string_view extraHeader = {});
 
+  /**
+   * Send HTTP response with the content served directly from a file.
+   * Calls BuildHeader().
+   *
+   * On platforms with OS-level sendfile support the file content is sent
+   * kernel-to-kernel without passing through userspace, and file
+   * descriptors are cached by path (revalidated by size and modification
+   * time) so repeated requests for the same static asset skip the open.
+   * On other platforms the file is read and sent normally.
+   *
+   * Responds with a 404 error if the file cannot be opened.
+   *
+   * @param code HTTP response code (e.g. 200)
+   * @param codeText HTTP response code text (e.g. "OK")
+   * @param contentType MIME content type (e.g. "text/html")
+   * @param filename Path to the file to send
+   * @param extraHeader Extra HTTP headers to send, including final "\r\n"
+   */
+  virtual void SendFileResponse(int code, std::string_view codeText,
+                                std::string_view contentType,
+                                std::string_view filename,
+                                std::string_view extraHeader = {});
+
   /**
    * Send error header and message.
    * This provides standard code responses for 400, 401, 403, 404, 500, and 503.
@@ -30,6 +30,24 @@ class MulticastServiceResolver {
   void Start();
   void Stop();
   WPI_EventHandle GetEventHandle() const { return event.GetHandle(); }
+
+  /**
+   * Returns unexpired cached announcements for this service type without
+   * waiting for a new announcement.  The cache is process-wide and fed
+   * passively by every running resolver, so a resolver recreated for a
+   * reconnect attempt starts warm.  If this returns empty, fall back to an
+   * active query: Start(), wait on GetEventHandle(), then call GetData().
+   */
+  std::vector<ServiceData> GetCachedData() const;
+
+  /**
+   * Sets the time-to-live for cached announcements.  Announcements older
+   * than this are dropped from the cache (default 120 seconds).
+   *
+   * @param seconds cache time-to-live in seconds
+   */
+  static void SetCacheTtl(uint64_t seconds);
+
   std::vector<ServiceData> GetData() {
     std::scoped_lock lock{mutex};
     event.Reset();
@@ -45,13 +63,16 @@ class MulticastServiceResolver {
 
  private:
   void PushData(ServiceData&& data) {
+    CacheData(data);
     std::scoped_lock lock{mutex};
     queue.emplace_back(std::forward<ServiceData>(data));
     event.Set();
   }
+  void CacheData(const ServiceData& data);
   wpi::Event event{true};
   std::vector<ServiceData> queue;
   wpi::mutex mutex;
+  std::string serviceTypeKey;
   std::unique_ptr<Impl> pImpl;
 };
 }  // namespace wpi
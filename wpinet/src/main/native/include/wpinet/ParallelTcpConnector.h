@@ -5,14 +5,18 @@
 #pragma once
 
 #include <stdint.h>
+#include <uv.h>
 
 #include <functional>
 #include <memory>
 #include <span>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
+#include <wpi/StringMap.h>
+
 #include "wpinet/uv/Timer.h"
 
 namespace wpi {
@@ -38,6 +42,12 @@ class Timer;
  *
  * After the reconnect rate times out, all remaining active connection attempts
  * are canceled and new ones started.
+ *
+ * Name resolution results are cached with a TTL so reconnection attempts
+ * start immediately from cached addresses instead of waiting on DNS/mDNS;
+ * stale results are still used while a refresh happens in the background.
+ * Addresses that repeatedly fail to connect are skipped for a few retry
+ * cycles when other addresses are available.
  */
 class ParallelTcpConnector
     : public std::enable_shared_from_this<ParallelTcpConnector> {
@@ -101,8 +111,25 @@ class ParallelTcpConnector
   void Succeeded(wpi::uv::Tcp& tcp);
 
  private:
+  // Cached resolution result for one server, with per-address backoff state.
+  struct CachedAddress {
+    sockaddr_storage addr;
+    unsigned int failCount{0};
+    unsigned int skipCycles{0};
+  };
+  struct ResolutionEntry {
+    std::vector<CachedAddress> addrs;
+    wpi::uv::Timer::Time resolvedTime{0};
+    unsigned int generation{0};
+  };
+
   bool IsConnected() const { return m_isConnected || m_servers.empty(); }
   void Connect();
+  void StartResolution(std::string_view host, unsigned int port,
+                       std::string_view key);
+  void StartAttempts(std::string_view key, ResolutionEntry& entry,
+                     const std::vector<CachedAddress>* exclude = nullptr);
+  ResolutionEntry* FindCacheEntry(std::string_view key, unsigned int gen);
   void CancelAll(wpi::uv::Tcp* except = nullptr);
 
   wpi::uv::Loop& m_loop;
@@ -113,6 +140,7 @@ class ParallelTcpConnector
   std::vector<std::pair<std::string, unsigned int>> m_servers;
   std::vector<std::weak_ptr<wpi::uv::GetAddrInfoReq>> m_resolvers;
   std::vector<std::weak_ptr<wpi::uv::Tcp>> m_attempts;
+  wpi::StringMap<ResolutionEntry> m_resolveCache;
   bool m_isConnected{false};
 };
 
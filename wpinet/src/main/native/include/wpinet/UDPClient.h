@@ -9,6 +9,7 @@
 #include <string>
 #include <string_view>
 
+#include <wpi/SmallString.h>
 #include <wpi/SmallVector.h>
 #include <wpi/mutex.h>
 
@@ -41,6 +42,30 @@ class UDPClient {
   int receive(uint8_t* data_received, int receive_len);
   int receive(uint8_t* data_received, int receive_len,
               SmallVectorImpl<char>* addr_received, int* port_received);
+
+  // A single datagram received by receive_batch().
+  struct ReceivedDatagram {
+    // Received data; points into the buffer passed to receive_batch() and
+    // is only valid until the next receive call.
+    std::span<uint8_t> data;
+    // Sender IP address.
+    SmallString<50> addr;
+    // Sender port.
+    int port = 0;
+  };
+
+  // Receive up to datagrams.size() datagrams in one call.  On Linux this
+  // performs a single recvmmsg() syscall, blocking until at least one
+  // datagram arrives (subject to set_timeout()) and also delivering
+  // whatever else is already queued; on other platforms it receives a
+  // single datagram.  The buffer is divided into datagrams.size() slots of
+  // datagram_len bytes each and is reused across calls, so receiving does
+  // not allocate per packet.  The buffer must be at least
+  // datagram_len * datagrams.size() bytes.
+  // Returns the number of datagrams received, or negative on error.
+  int receive_batch(uint8_t* buffer, int datagram_len,
+                    std::span<ReceivedDatagram> datagrams);
+
   int set_timeout(double timeout);
 };
 
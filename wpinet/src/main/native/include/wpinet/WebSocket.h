@@ -133,6 +133,26 @@ class WebSocket : public std::enable_shared_from_this<WebSocket> {
                         options);
   }
 
+  /**
+   * Negotiated server extension options, as determined from the client's
+   * Sec-WebSocket-Extensions offer (see WebSocketServerHelper).  Compression
+   * is only performed when the library is built with WPINET_WEBSOCKET_DEFLATE
+   * (requires zlib); otherwise these options are ignored and no extension
+   * response is sent.
+   */
+  struct ServerExtensions {
+    ServerExtensions() {}
+
+    /** Enable RFC 7692 permessage-deflate for this connection. */
+    bool permessageDeflate = false;
+    /** Reset the server's compression context after each message. */
+    bool serverNoContextTakeover = false;
+    /** Echo client_no_context_takeover (client resets after each message). */
+    bool clientNoContextTakeover = false;
+    /** Echo server_max_window_bits=15 (client offered it with value 15). */
+    bool echoServerMaxWindowBits = false;
+  };
+
   /**
    * Starts a server connection by performing the initial server side handshake.
    * This should be called after the HTTP headers have been received.
@@ -145,10 +165,12 @@ class WebSocket : public std::enable_shared_from_this<WebSocket> {
    *                client request
    * @param protocol The subprotocol to send to the client (in the
    *                 Sec-WebSocket-Protocol header field).
+   * @param extensions The negotiated extensions (in the
+   *                   Sec-WebSocket-Extensions header field).
    */
   static std::shared_ptr<WebSocket> CreateServer(
       uv::Stream& stream, std::string_view key, std::string_view version,
-      std::string_view protocol = {});
+      std::string_view protocol = {}, const ServerExtensions& extensions = {});
 
   /**
    * Get connection state.
@@ -495,6 +517,12 @@ class WebSocket : public std::enable_shared_from_this<WebSocket> {
   uint64_t m_frameSize = UINT64_MAX;
   uint8_t m_fragmentOpcode = 0;
 
+  // permessage-deflate state; only non-null when negotiated (and the library
+  // was built with WPINET_WEBSOCKET_DEFLATE)
+  class DeflateContext;
+  std::unique_ptr<DeflateContext> m_deflate;
+  bool m_messageCompressed = false;
+
   // temporary data used only during client handshake
   class ClientHandshakeData;
   std::unique_ptr<ClientHandshakeData> m_clientHandshake;
@@ -503,7 +531,8 @@ class WebSocket : public std::enable_shared_from_this<WebSocket> {
                    std::span<const std::string_view> protocols,
                    const ClientOptions& options);
   void StartServer(std::string_view key, std::string_view version,
-                   std::string_view protocol);
+                   std::string_view protocol,
+                   const ServerExtensions& extensions);
   void SendClose(uint16_t code, std::string_view reason);
   void SetClosed(uint16_t code, std::string_view reason, bool failed = false);
   void HandleIncoming(uv::Buffer& buf, size_t size);
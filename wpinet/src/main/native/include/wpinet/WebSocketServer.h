@@ -70,6 +70,15 @@ class WebSocketServerHelper {
     return MatchProtocol({protocols.begin(), protocols.end()});
   }
 
+  /**
+   * Get the negotiated extensions, as determined from the client's
+   * Sec-WebSocket-Extensions offers.  Only valid during and after the upgrade
+   * event.  Always empty unless built with WPINET_WEBSOCKET_DEFLATE.
+   */
+  const WebSocket::ServerExtensions& GetExtensions() const {
+    return m_extensions;
+  }
+
   /**
    * Accept the upgrade.  Disconnect other readers (such as the HttpParser
    * reader) before calling this.  See also WebSocket::CreateServer().
@@ -78,7 +87,8 @@ class WebSocketServerHelper {
    */
   std::shared_ptr<WebSocket> Accept(uv::Stream& stream,
                                     std::string_view protocol = {}) {
-    return WebSocket::CreateServer(stream, m_key, m_version, protocol);
+    return WebSocket::CreateServer(stream, m_key, m_version, protocol,
+                                   m_extensions);
   }
 
   bool IsUpgrade() const { return m_gotHost && m_websocket; }
@@ -94,6 +104,7 @@ class WebSocketServerHelper {
   SmallVector<std::string, 2> m_protocols;
   SmallString<64> m_key;
   SmallString<16> m_version;
+  WebSocket::ServerExtensions m_extensions;
 };
 
 /**
@@ -0,0 +1,184 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#ifndef WPINET_WORKERPOOL_H_
+#define WPINET_WORKERPOOL_H_
+
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <utility>
+
+#include <wpi/future.h>
+
+#include "wpinet/WorkerThread.h"
+
+namespace wpi {
+
+namespace detail {
+
+/**
+ * Process-wide pool of worker threads executing type-erased tasks.
+ * One thread per hardware core; each worker has its own task deque and
+ * steals from other workers when its own deque is empty, so independent
+ * submitters scale across cores instead of serializing on one queue.
+ *
+ * The pool is started on first use and lives for the life of the process.
+ */
+class WorkerPoolExecutor {
+ public:
+  static WorkerPoolExecutor& GetInstance();
+
+  void Enqueue(std::function<void()> task);
+
+  WorkerPoolExecutor(const WorkerPoolExecutor&) = delete;
+  WorkerPoolExecutor& operator=(const WorkerPoolExecutor&) = delete;
+
+ private:
+  WorkerPoolExecutor();
+  ~WorkerPoolExecutor() = default;
+
+  struct Impl;
+  Impl* m_impl;
+};
+
+template <typename R, typename... T>
+struct WorkerPoolState {
+  PromiseFactory<R> promises;
+  WorkerThreadAsync<R> async;
+};
+
+}  // namespace detail
+
+template <typename T>
+class WorkerPool;
+
+/**
+ * Submits work to the shared work-stealing thread pool.  Same interface
+ * and loop-integration semantics as WorkerThread, but work functions run
+ * on a process-wide pool with one thread per core rather than a dedicated
+ * thread, so independent work items from multiple submitters execute in
+ * parallel.  Unlike WorkerThread, work functions queued through the same
+ * WorkerPool may run concurrently with each other; use WorkerThread when
+ * requests must be serialized.
+ */
+template <typename R, typename... T>
+class WorkerPool<R(T...)> final {
+ public:
+  using WorkFunction = std::function<R(T...)>;
+  using AfterWorkFunction =
+      typename detail::WorkerThreadAsync<R>::AfterWorkFunction;
+
+  WorkerPool() : m_state{std::make_shared<detail::WorkerPoolState<R, T...>>()} {}
+
+  /**
+   * Set the loop.  This must be called from the loop thread.
+   * Subsequent calls to QueueWorkThen will run afterWork on the provided
+   * loop (via an async handle).
+   *
+   * @param loop the loop to use for running afterWork routines
+   */
+  void SetLoop(uv::Loop& loop) { m_state->async.SetLoop(loop); }
+
+  /**
+   * Set the loop.  This must be called from the loop thread.
+   * Subsequent calls to QueueWorkThen will run afterWork on the provided
+   * loop (via an async handle).
+   *
+   * @param loop the loop to use for running afterWork routines
+   */
+  void SetLoop(std::shared_ptr<uv::Loop> loop) { SetLoop(*loop); }
+
+  /**
+   * Unset the loop.  This must be called from the loop thread.
+   * Subsequent calls to QueueWorkThen will no longer run afterWork.
+   */
+  void UnsetLoop() { m_state->async.UnsetLoop(); }
+
+  /**
+   * Get the handle used by QueueWorkThen() to run afterWork.
+   * This handle is set by SetLoop().
+   * Calling Close() on this handle is the same as calling UnsetLoop().
+   *
+   * @return The handle (if nullptr, no handle is set)
+   */
+  std::shared_ptr<uv::Handle> GetHandle() const {
+    return m_state->async.m_async.lock();
+  }
+
+  /**
+   * Run the work function on the pool and return a future for the result.
+   *
+   * It’s safe to call this function from any thread.
+   * The work function will be called on a pool thread.
+   *
+   * @param work Work function (called on a pool thread)
+   * @param u Arguments to work function
+   */
+  template <typename... U>
+  future<R> QueueWork(WorkFunction work, U&&... u) {
+    // create the future
+    uint64_t req = m_state->promises.CreateRequest();
+
+    detail::WorkerPoolExecutor::GetInstance().Enqueue(
+        [state = m_state, req, work = std::move(work),
+         params = std::tuple<T...>{std::forward<U>(u)...}]() mutable {
+          if constexpr (std::is_void_v<R>) {
+            std::apply(work, std::move(params));
+            state->promises.SetValue(req);
+          } else {
+            state->promises.SetValue(req,
+                                     std::apply(work, std::move(params)));
+          }
+          state->promises.Notify();
+        });
+
+    // return future
+    return m_state->promises.CreateFuture(req);
+  }
+
+  /**
+   * Run the work function on the pool, then call the afterWork function
+   * with the result on the loop set by SetLoop().
+   *
+   * It’s safe to call this function from any thread.
+   * The work function will be called on a pool thread, and the afterWork
+   * function will be called on the loop thread.
+   *
+   * SetLoop() must be called prior to calling this function for afterWork to
+   * be called.
+   *
+   * @param work Work function (called on a pool thread)
+   * @param afterWork After work function (called on loop thread)
+   * @param u Arguments to work function
+   */
+  template <typename... U>
+  void QueueWorkThen(WorkFunction work, AfterWorkFunction afterWork, U&&... u) {
+    detail::WorkerPoolExecutor::GetInstance().Enqueue(
+        [state = m_state, work = std::move(work),
+         afterWork = std::move(afterWork),
+         params = std::tuple<T...>{std::forward<U>(u)...}]() mutable {
+          if constexpr (std::is_void_v<R>) {
+            std::apply(work, std::move(params));
+            if (auto async = state->async.m_async.lock()) {
+              async->Send(std::move(afterWork));
+            }
+          } else {
+            R result = std::apply(work, std::move(params));
+            if (auto async = state->async.m_async.lock()) {
+              async->Send(std::move(afterWork), std::move(result));
+            }
+          }
+        });
+  }
+
+ private:
+  // held by queued tasks as well, so results can be delivered even if
+  // this object is destroyed while work is in flight
+  std::shared_ptr<detail::WorkerPoolState<R, T...>> m_state;
+};
+
+}  // namespace wpi
+
+#endif  // WPINET_WORKERPOOL_H_
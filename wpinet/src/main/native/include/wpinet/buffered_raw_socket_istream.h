@@ -0,0 +1,47 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#ifndef WPINET_BUFFERED_RAW_SOCKET_ISTREAM_H_
+#define WPINET_BUFFERED_RAW_SOCKET_ISTREAM_H_
+
+#include <memory>
+
+#include <wpi/raw_istream.h>
+
+namespace wpi {
+
+class NetworkStream;
+
+// raw_istream backed by a NetworkStream that receives from the socket in
+// large blocks.  Small reads (e.g. header parsing and multipart boundary
+// scanning) are served out of the buffer rather than each costing a socket
+// receive; reads at least as large as the buffer bypass it to avoid a
+// double copy.  Because reads may be buffered, do not mix reads through
+// this stream with direct reads from the underlying NetworkStream.
+class buffered_raw_socket_istream : public raw_istream {
+ public:
+  explicit buffered_raw_socket_istream(NetworkStream& stream, int timeout = 0,
+                                       size_t bufSize = 4096)
+      : m_stream(stream),
+        m_timeout(timeout),
+        m_bufSize(bufSize),
+        m_buf(new char[bufSize]) {}
+
+  void close() override;
+  size_t in_avail() const override;
+
+ private:
+  void read_impl(void* data, size_t len) override;
+
+  NetworkStream& m_stream;
+  int m_timeout;
+  size_t m_bufSize;
+  std::unique_ptr<char[]> m_buf;
+  size_t m_pos{0};
+  size_t m_end{0};
+};
+
+}  // namespace wpi
+
+#endif  // WPINET_BUFFERED_RAW_SOCKET_ISTREAM_H_
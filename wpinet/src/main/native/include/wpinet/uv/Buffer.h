@@ -153,6 +153,11 @@ class SimpleBufferPool {
    */
   size_t Remaining() const { return m_pool.size(); }
 
+  /**
+   * Get the size of each allocated buffer.
+   */
+  size_t GetBufferSize() const { return m_size; }
+
  private:
   SmallVector<Buffer, DEPTH> m_pool;
   size_t m_size;  // NOLINT
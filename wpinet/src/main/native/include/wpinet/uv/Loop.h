@@ -17,6 +17,7 @@
 #include <wpi/Signal.h>
 #include <wpi/function_ref.h>
 
+#include "wpinet/uv/Buffer.h"
 #include "wpinet/uv/Error.h"
 
 namespace wpi::uv {
@@ -231,6 +232,15 @@ class Loop final : public std::enable_shared_from_this<Loop> {
    */
   std::thread::id GetThreadId() const { return m_tid; }
 
+  /**
+   * Get the loop-wide shared buffer pool.  Used to amortize allocation cost
+   * for high-frequency small writes (see Stream::WriteCopy).  Only safe to
+   * use from the loop thread.
+   *
+   * @return Buffer pool.
+   */
+  SimpleBufferPool<4>& GetBufferPool() { return m_bufferPool; }
+
   /**
    * Error signal
    */
@@ -247,6 +257,7 @@ class Loop final : public std::enable_shared_from_this<Loop> {
   uv_loop_t* m_loop;
   uv_loop_t m_loopStruct;
   std::atomic<std::thread::id> m_tid;
+  SimpleBufferPool<4> m_bufferPool;
 };
 
 }  // namespace wpi::uv
@@ -186,6 +186,31 @@ class Stream : public Handle {
     Write({bufs.begin(), bufs.end()}, std::move(callback));
   }
 
+  /**
+   * Write data to the stream, copying it into a single buffer first.
+   *
+   * Unlike Write(), the data is copied before this call returns, so the
+   * caller retains ownership of bufs and may free or reuse them
+   * immediately.  Small writes are coalesced into one buffer drawn from the
+   * loop's buffer pool, so high-frequency small messages amortize both the
+   * allocation and the per-buffer syscall overhead; writes larger than the
+   * pool's buffer size use a one-shot heap buffer instead.
+   *
+   * Errors will be reported to the stream error handler.
+   *
+   * @param bufs The buffers to be written to the stream.
+   */
+  void WriteCopy(std::span<const Buffer> bufs);
+
+  /**
+   * Write data to the stream, copying it into a single buffer first.
+   *
+   * @param bufs The buffers to be written to the stream.
+   */
+  void WriteCopy(std::initializer_list<Buffer> bufs) {
+    WriteCopy({bufs.begin(), bufs.end()});
+  }
+
   /**
    * Queue a write request if it can be completed immediately.
    *
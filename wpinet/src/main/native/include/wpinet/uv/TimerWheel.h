@@ -0,0 +1,131 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#ifndef WPINET_UV_TIMERWHEEL_H_
+#define WPINET_UV_TIMERWHEEL_H_
+
+#include <array>
+#include <memory>
+
+#include <wpi/Signal.h>
+
+#include "wpinet/uv/Timer.h"
+
+namespace wpi::uv {
+
+class Loop;
+
+/**
+ * Hashed timer wheel for lightweight one-shot timeouts.
+ *
+ * A single wheel multiplexes any number of pending timeouts onto one
+ * underlying Timer handle, so arming and disarming an Entry allocates no
+ * memory and creates no libuv handles.  Timeouts fire with the granularity
+ * of the wheel resolution (rounded up, never early), which is sufficient
+ * for connection retry, heartbeat, and flush scheduling; use Timer directly
+ * when exact expiration matters.
+ *
+ * Destroy the wheel before closing the loop (it owns a handle).  Entries
+ * may outlive the wheel; the wheel's destructor disarms any still-armed
+ * entries.
+ *
+ * All functions may only be called from the loop thread.
+ */
+class TimerWheel {
+ public:
+  using Time = Timer::Time;
+
+  /**
+   * A pending timeout.  Entries are owned by the caller and may be armed
+   * and disarmed repeatedly; destroying an armed entry disarms it.  An
+   * entry must not be destroyed from within its own timeout callback.
+   */
+  class Entry {
+    friend class TimerWheel;
+
+   public:
+    Entry() = default;
+    Entry(const Entry&) = delete;
+    Entry& operator=(const Entry&) = delete;
+    ~Entry();
+
+    /**
+     * Returns true if the entry is armed (timeout pending).
+     */
+    bool IsArmed() const { return m_armed; }
+
+    /**
+     * Timeout expired signal.
+     */
+    sig::Signal<> timeout;
+
+   private:
+    void Unlink() {
+      m_prev->m_next = m_next;
+      m_next->m_prev = m_prev;
+      m_next = nullptr;
+      m_prev = nullptr;
+    }
+
+    void InsertAfter(Entry* pos) {
+      m_prev = pos;
+      m_next = pos->m_next;
+      pos->m_next->m_prev = this;
+      pos->m_next = this;
+    }
+
+    TimerWheel* m_wheel = nullptr;
+    Entry* m_next = nullptr;
+    Entry* m_prev = nullptr;
+    uint64_t m_expireTick = 0;
+    bool m_armed = false;
+  };
+
+  /**
+   * Constructor.
+   *
+   * @param loop Loop object where timeouts run.
+   * @param resolution Wheel tick period; armed timeouts are rounded up to
+   *                   the next tick.
+   */
+  explicit TimerWheel(Loop& loop, Time resolution = Time{16});
+  ~TimerWheel();
+
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+
+  /**
+   * Arm an entry to fire its timeout signal once after the given interval.
+   * If the entry is already armed, the previous timeout is replaced.
+   *
+   * @param entry Entry to arm.
+   * @param timeout Time interval (rounded up to the wheel resolution).
+   */
+  void Arm(Entry& entry, Time timeout);
+
+  /**
+   * Disarm an entry.  Does nothing if the entry is not armed.  An entry
+   * disarmed before its timeout fires (including from another entry's
+   * callback in the same tick) will not fire.
+   *
+   * @param entry Entry to disarm.
+   */
+  void Disarm(Entry& entry);
+
+ private:
+  static constexpr size_t kNumSlots = 64;  // must be a power of 2
+
+  void Tick();
+
+  Loop& m_loop;
+  std::shared_ptr<Timer> m_timer;
+  uint64_t m_resolution;
+  uint64_t m_tick = 0;
+  size_t m_count = 0;
+  std::array<Entry, kNumSlots> m_slots;  // circular list sentinels
+};
+
+}  // namespace wpi::uv
+
+#endif  // WPINET_UV_TIMERWHEEL_H_
@@ -47,6 +47,7 @@ struct MulticastServiceResolver::Impl {
 
 MulticastServiceResolver::MulticastServiceResolver(
     std::string_view serviceType) {
+  serviceTypeKey = serviceType;
   pImpl = std::make_unique<Impl>();
   pImpl->serviceType = serviceType;
   pImpl->resolver = this;
@@ -35,6 +35,7 @@ struct MulticastServiceResolver::Impl {
 
 MulticastServiceResolver::MulticastServiceResolver(
     std::string_view serviceType) {
+  serviceTypeKey = serviceType;
   pImpl = std::make_unique<Impl>();
   pImpl->resolver = this;
 
@@ -0,0 +1,46 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "wpinet/EventLoopRunner.h"  // NOLINT(build/include_order)
+
+#include "gtest/gtest.h"  // NOLINT(build/include_order)
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "wpinet/uv/Loop.h"
+
+namespace wpi {
+
+TEST(EventLoopRunnerTest, Profile) {
+  EventLoopRunner runner;
+  // run a few iterations through the loop
+  for (int i = 0; i < 10; ++i) {
+    runner.ExecSync([](uv::Loop&) {});
+  }
+  auto profile = runner.GetLoopProfile();
+  ASSERT_GT(profile.iterations, 0u);
+  uint64_t total = 0;
+  for (uint64_t count : profile.buckets) {
+    total += count;
+  }
+  ASSERT_EQ(total, profile.iterations);
+}
+
+TEST(EventLoopRunnerTest, StallCallback) {
+  EventLoopRunner runner;
+  std::atomic<uint64_t> stallTime{0};
+  runner.SetStallCallback(
+      5000, [&](uint64_t durationUs) { stallTime = durationUs; });
+  runner.ExecSync([](uv::Loop&) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  });
+  // the stall callback fires before the loop polls again, so one more
+  // round trip through the loop guarantees it has run
+  runner.ExecSync([](uv::Loop&) {});
+  ASSERT_GE(stallTime, 5000u);
+}
+
+}  // namespace wpi
@@ -50,3 +50,33 @@ TEST(MulticastServiceAnnouncerTest, SingleText) {
     std::this_thread::sleep_for(std::chrono::seconds(1));
   }
 }
+
+TEST(MulticastServiceResolverTest, CachedDataEmptyOnMiss) {
+  wpi::MulticastServiceResolver resolver("_wpinevercached");
+  EXPECT_TRUE(resolver.GetCachedData().empty());
+}
+
+TEST(MulticastServiceResolverTest, CacheWarmAcrossInstances) {
+  const std::string_view serviceName = "TestServiceCached";
+  const std::string_view serviceType = "_wpicache";
+  const int port = std::rand();
+  wpi::MulticastServiceAnnouncer announcer(serviceName, serviceType, port);
+  wpi::MulticastServiceResolver resolver(serviceType);
+
+  if (announcer.HasImplementation() && resolver.HasImplementation()) {
+    announcer.Start();
+    resolver.Start();
+
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+
+    // Only check the cache if an announcement actually arrived; a fresh
+    // resolver for the same service type should then start warm
+    if (!resolver.GetData().empty()) {
+      wpi::MulticastServiceResolver second(serviceType);
+      EXPECT_FALSE(second.GetCachedData().empty());
+    }
+
+    resolver.Stop();
+    announcer.Stop();
+  }
+}
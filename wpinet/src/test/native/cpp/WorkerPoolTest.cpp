@@ -0,0 +1,97 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "wpinet/WorkerPool.h"  // NOLINT(build/include_order)
+
+#include "gtest/gtest.h"  // NOLINT(build/include_order)
+
+#include <atomic>
+#include <vector>
+
+#include <wpi/condition_variable.h>
+#include <wpi/mutex.h>
+
+#include "wpinet/EventLoopRunner.h"
+#include "wpinet/uv/Loop.h"
+
+namespace wpi {
+
+TEST(WorkerPoolTest, Future) {
+  WorkerPool<int(bool)> pool;
+  future<int> f = pool.QueueWork([](bool v) -> int { return v ? 1 : 2; }, true);
+  ASSERT_EQ(f.get(), 1);
+}
+
+TEST(WorkerPoolTest, FutureVoid) {
+  std::atomic<int> callbacks{0};
+  WorkerPool<void(int)> pool;
+  future<void> f = pool.QueueWork(
+      [&](int v) {
+        ++callbacks;
+        ASSERT_EQ(v, 3);
+      },
+      3);
+  f.get();
+  ASSERT_EQ(callbacks, 1);
+}
+
+TEST(WorkerPoolTest, ManyParallel) {
+  WorkerPool<int(int)> pool;
+  std::vector<future<int>> futures;
+  for (int i = 0; i < 100; ++i) {
+    futures.emplace_back(pool.QueueWork([](int v) -> int { return v * 2; }, i));
+  }
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_EQ(futures[i].get(), i * 2);
+  }
+}
+
+TEST(WorkerPoolTest, Loop) {
+  mutex m;
+  condition_variable cv;
+  int callbacks = 0;
+
+  WorkerPool<int(bool)> pool;
+  EventLoopRunner runner;
+  runner.ExecSync([&](uv::Loop& loop) { pool.SetLoop(loop); });
+  pool.QueueWorkThen([](bool v) -> int { return v ? 1 : 2; },
+                     [&](int v2) {
+                       std::scoped_lock lock{m};
+                       ++callbacks;
+                       cv.notify_all();
+                       ASSERT_EQ(v2, 1);
+                     },
+                     true);
+  auto f = pool.QueueWork([&](bool) -> int { return 2; }, true);
+  ASSERT_EQ(f.get(), 2);
+
+  std::unique_lock lock{m};
+  cv.wait(lock, [&] { return callbacks == 1; });
+  ASSERT_EQ(callbacks, 1);
+}
+
+TEST(WorkerPoolTest, LoopVoid) {
+  mutex m;
+  condition_variable cv;
+  int callbacks = 0;
+
+  WorkerPool<void(bool)> pool;
+  EventLoopRunner runner;
+  runner.ExecSync([&](uv::Loop& loop) { pool.SetLoop(loop); });
+  pool.QueueWorkThen([](bool) {},
+                     [&]() {
+                       std::scoped_lock lock{m};
+                       ++callbacks;
+                       cv.notify_all();
+                     },
+                     true);
+  auto f = pool.QueueWork([](bool) {}, true);
+  f.get();
+
+  std::unique_lock lock{m};
+  cv.wait(lock, [&] { return callbacks == 1; });
+  ASSERT_EQ(callbacks, 1);
+}
+
+}  // namespace wpi
@@ -0,0 +1,110 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "wpinet/buffered_raw_socket_istream.h"  // NOLINT(build/include_order)
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "wpinet/NetworkStream.h"
+
+namespace wpi {
+
+namespace {
+
+// NetworkStream that serves a fixed string in bounded-size chunks so the
+// buffered stream sees partial receives.
+class MockNetworkStream : public NetworkStream {
+ public:
+  MockNetworkStream(std::string_view data, size_t maxChunk)
+      : m_data(data), m_maxChunk(maxChunk) {}
+
+  size_t send(const char* buffer, size_t len, Error* err) override {
+    return len;
+  }
+
+  size_t receive(char* buffer, size_t len, Error* err,
+                 int timeout = 0) override {
+    size_t amt = (std::min)({len, m_maxChunk, m_data.size() - m_pos});
+    if (amt == 0) {
+      *err = kConnectionClosed;
+      return 0;
+    }
+    std::memcpy(buffer, m_data.data() + m_pos, amt);
+    m_pos += amt;
+    ++m_receiveCount;
+    return amt;
+  }
+
+  void close() override {}
+  std::string_view getPeerIP() const override { return "127.0.0.1"; }
+  int getPeerPort() const override { return 0; }
+  void setNoDelay() override {}
+  bool setBlocking(bool enabled) override { return true; }
+  int getNativeHandle() const override { return -1; }
+
+  int GetReceiveCount() const { return m_receiveCount; }
+
+ private:
+  std::string m_data;
+  size_t m_maxChunk;
+  size_t m_pos = 0;
+  int m_receiveCount = 0;
+};
+
+}  // namespace
+
+TEST(BufferedRawSocketIstreamTest, SmallReadsBuffered) {
+  MockNetworkStream stream{"abcdefghij", 100};
+  buffered_raw_socket_istream is{stream, 0, 8};
+
+  char buf[4];
+  is.read(buf, 4);
+  ASSERT_FALSE(is.has_error());
+  EXPECT_EQ(std::string_view(buf, 4), "abcd");
+  EXPECT_EQ(is.in_avail(), 4u);
+
+  is.read(buf, 4);
+  ASSERT_FALSE(is.has_error());
+  EXPECT_EQ(std::string_view(buf, 4), "efgh");
+
+  // 8 bytes were served by a single receive
+  EXPECT_EQ(stream.GetReceiveCount(), 1);
+}
+
+TEST(BufferedRawSocketIstreamTest, LargeReadBypassesBuffer) {
+  std::string data(100, 'x');
+  MockNetworkStream stream{data, 100};
+  buffered_raw_socket_istream is{stream, 0, 8};
+
+  char buf[100];
+  is.read(buf, 100);
+  ASSERT_FALSE(is.has_error());
+  EXPECT_EQ(std::string_view(buf, 100), data);
+  EXPECT_EQ(is.in_avail(), 0u);
+  EXPECT_EQ(stream.GetReceiveCount(), 1);
+}
+
+TEST(BufferedRawSocketIstreamTest, PartialReceives) {
+  MockNetworkStream stream{"abcdefghijklmnop", 3};
+  buffered_raw_socket_istream is{stream, 0, 8};
+
+  char buf[16];
+  is.read(buf, 16);
+  ASSERT_FALSE(is.has_error());
+  EXPECT_EQ(std::string_view(buf, 16), "abcdefghijklmnop");
+}
+
+TEST(BufferedRawSocketIstreamTest, ErrorOnClosed) {
+  MockNetworkStream stream{"ab", 100};
+  buffered_raw_socket_istream is{stream, 0, 8};
+
+  char buf[4];
+  is.read(buf, 4);
+  EXPECT_TRUE(is.has_error());
+}
+
+}  // namespace wpi
@@ -36,6 +36,11 @@ TEST(UvSimpleBufferPoolTest, ReleaseReuse) {
   pool.Release({&buf2, 1});
 }
 
+TEST(UvSimpleBufferPoolTest, GetBufferSize) {
+  SimpleBufferPool<4> pool{8192};
+  ASSERT_EQ(pool.GetBufferSize(), 8192u);
+}
+
 TEST(UvSimpleBufferPoolTest, ClearRemaining) {
   SimpleBufferPool<4> pool;
   auto buf1 = pool.Allocate();
@@ -0,0 +1,97 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "wpinet/uv/TimerWheel.h"  // NOLINT(build/include_order)
+
+#include <memory>
+
+#include "gtest/gtest.h"
+
+#include "wpinet/uv/Loop.h"
+
+namespace wpi::uv {
+
+TEST(UvTimerWheelTest, SingleShot) {
+  auto loop = Loop::Create();
+  auto wheel = std::make_unique<TimerWheel>(*loop, TimerWheel::Time{1});
+  TimerWheel::Entry entry;
+
+  int count = 0;
+  entry.timeout.connect([&count] { ++count; });
+
+  wheel->Arm(entry, TimerWheel::Time{2});
+  ASSERT_TRUE(entry.IsArmed());
+
+  loop->Run();
+
+  ASSERT_EQ(count, 1);
+  ASSERT_FALSE(entry.IsArmed());
+
+  wheel.reset();
+  loop->Run();  // forces close callback to run
+}
+
+TEST(UvTimerWheelTest, DisarmFromCallback) {
+  auto loop = Loop::Create();
+  auto wheel = std::make_unique<TimerWheel>(*loop, TimerWheel::Time{1});
+  TimerWheel::Entry first;
+  TimerWheel::Entry second;
+
+  bool firstFired = false;
+  first.timeout.connect([&] {
+    firstFired = true;
+    wheel->Disarm(second);
+  });
+  second.timeout.connect([] { FAIL(); });
+
+  wheel->Arm(first, TimerWheel::Time{2});
+  wheel->Arm(second, TimerWheel::Time{10});
+
+  loop->Run();
+
+  ASSERT_TRUE(firstFired);
+  ASSERT_FALSE(second.IsArmed());
+
+  wheel.reset();
+  loop->Run();  // forces close callback to run
+}
+
+TEST(UvTimerWheelTest, Rearm) {
+  auto loop = Loop::Create();
+  auto wheel = std::make_unique<TimerWheel>(*loop, TimerWheel::Time{1});
+  TimerWheel::Entry entry;
+
+  int count = 0;
+  entry.timeout.connect([&] {
+    if (++count < 3) {
+      wheel->Arm(entry, TimerWheel::Time{1});
+    }
+  });
+
+  wheel->Arm(entry, TimerWheel::Time{1});
+
+  loop->Run();
+
+  ASSERT_EQ(count, 3);
+
+  wheel.reset();
+  loop->Run();  // forces close callback to run
+}
+
+TEST(UvTimerWheelTest, DestroyArmedEntry) {
+  auto loop = Loop::Create();
+  auto wheel = std::make_unique<TimerWheel>(*loop, TimerWheel::Time{1});
+  {
+    TimerWheel::Entry entry;
+    entry.timeout.connect([] { FAIL(); });
+    wheel->Arm(entry, TimerWheel::Time{10});
+  }
+
+  loop->Run();
+
+  wheel.reset();
+  loop->Run();  // forces close callback to run
+}
+
+}  // namespace wpi::uv
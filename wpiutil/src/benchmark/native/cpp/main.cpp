@@ -0,0 +1,159 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <stdint.h>
+
+#include <atomic>
+#include <chrono>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <fmt/format.h>
+#include <wpi/DataLog.h>
+#include <wpi/SmallVector.h>
+#include <wpi/UidVector.h>
+#include <wpi/circular_buffer.h>
+#include <wpi/interpolating_map.h>
+#include <wpi/leb128.h>
+#include <wpi/timestamp.h>
+
+namespace {
+
+// Runs fn() count times and prints the per-iteration time.  Coarse by design;
+// these exist to catch order-of-magnitude regressions in the hot paths, not to
+// replace a profiler.
+template <typename F>
+void Bench(std::string_view name, int count, F&& fn) {
+  auto start = std::chrono::high_resolution_clock::now();
+  for (int i = 0; i < count; ++i) {
+    fn(i);
+  }
+  auto stop = std::chrono::high_resolution_clock::now();
+  auto total =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start)
+          .count();
+  fmt::print("{:<32} {:>10} iters {:>10} ns/iter\n", name, count,
+             total / count);
+}
+
+void BenchCircularBuffer() {
+  fmt::print("-- circular_buffer --\n");
+  wpi::circular_buffer<double> buf{64};
+  Bench("push_back (full buffer)", 10000000,
+        [&](int i) { buf.push_back(i * 0.5); });
+  double sum = 0;
+  Bench("indexed read x64", 1000000, [&](int) {
+    for (size_t j = 0; j < 64; ++j) {
+      sum += buf[j];
+    }
+  });
+  fmt::print("  (checksum {})\n", sum);
+}
+
+void BenchInterpolatingMap() {
+  fmt::print("-- interpolating_map --\n");
+  wpi::interpolating_map<double, double> map;
+  for (int i = 0; i < 1000; ++i) {
+    map.insert(i * 1.0, i * 2.0);
+  }
+  double sum = 0;
+  Bench("interpolated lookup", 1000000,
+        [&](int i) { sum += map[(i % 999) + 0.5]; });
+  fmt::print("  (checksum {})\n", sum);
+}
+
+void BenchUidVector() {
+  fmt::print("-- UidVector --\n");
+  wpi::UidVector<int, 16> vec;
+  std::vector<size_t> uids;
+  for (int i = 0; i < 64; ++i) {
+    uids.push_back(vec.emplace_back(i));
+  }
+  Bench("emplace_back + erase", 1000000, [&](int i) {
+    size_t uid = vec.emplace_back(i);
+    vec.erase(uid);
+  });
+  int64_t sum = 0;
+  Bench("iterate x64", 1000000, [&](int) {
+    for (auto&& val : vec) {
+      sum += val;
+    }
+  });
+  fmt::print("  (checksum {})\n", sum);
+}
+
+void BenchLeb128() {
+  fmt::print("-- leb128 --\n");
+  wpi::SmallVector<char, 16> buf;
+  Bench("WriteUleb128 small", 10000000, [&](int i) {
+    buf.clear();
+    wpi::WriteUleb128(buf, static_cast<uint64_t>(i) & 0x7f);
+  });
+  Bench("WriteUleb128 large", 10000000, [&](int i) {
+    buf.clear();
+    wpi::WriteUleb128(buf, static_cast<uint64_t>(i) * 0x12345678u);
+  });
+  buf.clear();
+  wpi::WriteUleb128(buf, 0x123456789abcull);
+  uint64_t val = 0;
+  Bench("ReadUleb128", 10000000,
+        [&](int) { wpi::ReadUleb128(buf.data(), &val); });
+  fmt::print("  (checksum {})\n", val);
+}
+
+void BenchDataLog() {
+  fmt::print("-- DataLog --\n");
+  // log to a counting sink rather than disk so the numbers reflect append
+  // cost, not filesystem throughput
+  std::atomic<uint64_t> bytes{0};
+  wpi::log::DataLog log{
+      [&](std::span<const uint8_t> data) { bytes += data.size(); }, 0.1};
+  int entry = log.Start("bench/double", "double");
+  Bench("AppendDouble", 5000000,
+        [&](int i) { log.AppendDouble(entry, i * 0.5, 1000 + i); });
+  int sentry = log.Start("bench/string", "string");
+  Bench("AppendString", 1000000, [&](int i) {
+    log.AppendString(sentry, "a string value of typical length", 1000 + i);
+  });
+
+  // contended appends from multiple threads (exercises the append shards)
+  Bench("AppendDouble x4 threads", 250000, [&](int i) {
+    static std::thread threads[4];
+    if (i == 0) {
+      for (auto& thr : threads) {
+        thr = std::thread{[&] {
+          for (int j = 0; j < 250000; ++j) {
+            log.AppendDouble(entry, j * 0.5, 2000 + j);
+          }
+        }};
+      }
+    }
+    if (i == 250000 - 1) {
+      for (auto& thr : threads) {
+        thr.join();
+      }
+    }
+  });
+  log.Flush();
+  fmt::print("  ({} bytes written)\n", bytes.load());
+}
+
+void BenchNow() {
+  fmt::print("-- timestamp --\n");
+  uint64_t sum = 0;
+  Bench("wpi::Now()", 10000000, [&](int) { sum += wpi::Now(); });
+  fmt::print("  (checksum {})\n", sum);
+}
+
+}  // namespace
+
+int main() {
+  BenchCircularBuffer();
+  BenchInterpolatingMap();
+  BenchUidVector();
+  BenchLeb128();
+  BenchDataLog();
+  BenchNow();
+}
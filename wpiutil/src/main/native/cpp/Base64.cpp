@@ -60,6 +60,14 @@
 #include "wpi/SmallVector.h"
 #include "wpi/raw_ostream.h"
 
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define WPI_BASE64_SSSE3 1
+#include <tmmintrin.h>
+#elif defined(__aarch64__)
+#define WPI_BASE64_NEON 1
+#include <arm_neon.h>
+#endif
+
 namespace wpi {
 
 // aaaack but it's fast and const should make it shared text page.
@@ -94,12 +102,19 @@ size_t Base64Decode(raw_ostream& os, std::string_view encoded) {
 
   const unsigned char* cur = bytes_begin;
 
+  // decode into a chunk buffer so the stream sees large writes instead of
+  // one call per output byte
+  char chunk[192];
   while (nprbytes > 4) {
-    os << static_cast<unsigned char>(pr2six[cur[0]] << 2 | pr2six[cur[1]] >> 4);
-    os << static_cast<unsigned char>(pr2six[cur[1]] << 4 | pr2six[cur[2]] >> 2);
-    os << static_cast<unsigned char>(pr2six[cur[2]] << 6 | pr2six[cur[3]]);
-    cur += 4;
-    nprbytes -= 4;
+    size_t n = 0;
+    while (nprbytes > 4 && n + 3 <= sizeof(chunk)) {
+      chunk[n++] = pr2six[cur[0]] << 2 | pr2six[cur[1]] >> 4;
+      chunk[n++] = pr2six[cur[1]] << 4 | pr2six[cur[2]] >> 2;
+      chunk[n++] = pr2six[cur[2]] << 6 | pr2six[cur[3]];
+      cur += 4;
+      nprbytes -= 4;
+    }
+    os.write(chunk, n);
   }
 
   // Note: (nprbytes == 1) would be an error, so just ignore that case
@@ -149,32 +164,142 @@ std::span<uint8_t> Base64Decode(std::string_view encoded, size_t* num_read,
 static const char basis_64[] =
     "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
 
+#ifdef WPI_BASE64_SSSE3
+
+// SIMD encode kernel (the split/translate approach from Wojciech Mula's
+// base64 work): each iteration loads 16 input bytes, encodes 12 of them,
+// and stores 16 output characters.  Compiled with the ssse3 target
+// attribute and selected at runtime so the translation unit itself builds
+// without -mssse3.
+__attribute__((target("ssse3"))) static size_t Base64EncodeSsse3(
+    char* out, size_t outCap, const unsigned char*& in, size_t& len) {
+  size_t n = 0;
+  // each iteration reads 16 bytes but consumes 12, so keep 4 bytes of slack
+  while (len >= 16 && n + 16 <= outCap) {
+    __m128i data =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+    // gather the 3-byte groups into 16-bit lanes
+    data = _mm_shuffle_epi8(
+        data, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    // split each 24-bit group into four 6-bit indices
+    __m128i t0 = _mm_and_si128(data, _mm_set1_epi32(0x0fc0fc00));
+    __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    __m128i t2 = _mm_and_si128(data, _mm_set1_epi32(0x003f03f0));
+    __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    __m128i indices = _mm_or_si128(t1, t3);
+    // translate indices to characters: pick a per-range offset and add it
+    __m128i result = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+    result = _mm_or_si128(result, _mm_and_si128(less, _mm_set1_epi8(13)));
+    result = _mm_shuffle_epi8(
+        _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                      '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                      '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0),
+        result);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + n),
+                     _mm_add_epi8(result, indices));
+    in += 12;
+    len -= 12;
+    n += 16;
+  }
+  return n;
+}
+
+static bool Base64HasSsse3() {
+  static const bool has = __builtin_cpu_supports("ssse3");
+  return has;
+}
+
+#elif defined(WPI_BASE64_NEON)
+
+// NEON encode kernel: each iteration consumes 48 input bytes (deinterleaved
+// into three registers) and stores 64 output characters.
+static size_t Base64EncodeNeon(char* out, size_t outCap,
+                               const unsigned char*& in, size_t& len) {
+  const uint8x16_t shiftLUT = {71,  0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
+                               0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xed,
+                               0xf0, 'A',  0,    0};
+  size_t n = 0;
+  while (len >= 48 && n + 64 <= outCap) {
+    uint8x16x3_t data = vld3q_u8(in);
+    uint8x16x4_t result;
+    uint8x16_t indices[4];
+    indices[0] = vshrq_n_u8(data.val[0], 2);
+    indices[1] = vorrq_u8(vshlq_n_u8(vandq_u8(data.val[0], vdupq_n_u8(0x03)), 4),
+                          vshrq_n_u8(data.val[1], 4));
+    indices[2] = vorrq_u8(vshlq_n_u8(vandq_u8(data.val[1], vdupq_n_u8(0x0f)), 2),
+                          vshrq_n_u8(data.val[2], 6));
+    indices[3] = vandq_u8(data.val[2], vdupq_n_u8(0x3f));
+    for (int i = 0; i < 4; ++i) {
+      // translate indices to characters: pick a per-range offset and add it
+      uint8x16_t offset = vqsubq_u8(indices[i], vdupq_n_u8(51));
+      uint8x16_t less = vcltq_u8(indices[i], vdupq_n_u8(26));
+      offset = vorrq_u8(offset, vandq_u8(less, vdupq_n_u8(13)));
+      result.val[i] = vaddq_u8(vqtbl1q_u8(shiftLUT, offset), indices[i]);
+    }
+    vst4q_u8(reinterpret_cast<uint8_t*>(out + n), result);
+    in += 48;
+    len -= 48;
+    n += 64;
+  }
+  return n;
+}
+
+#endif  // WPI_BASE64_NEON
+
 void Base64Encode(raw_ostream& os, std::string_view plain) {
   if (plain.empty()) {
     return;
   }
+  const auto* in = reinterpret_cast<const unsigned char*>(plain.data());
   size_t len = plain.size();
+  char chunk[256];
+
+#ifdef WPI_BASE64_SSSE3
+  if (Base64HasSsse3()) {
+    while (len >= 16) {
+      size_t n = Base64EncodeSsse3(chunk, sizeof(chunk), in, len);
+      if (n == 0) {
+        break;
+      }
+      os.write(chunk, n);
+    }
+  }
+#elif defined(WPI_BASE64_NEON)
+  while (len >= 48) {
+    size_t n = Base64EncodeNeon(chunk, sizeof(chunk), in, len);
+    if (n == 0) {
+      break;
+    }
+    os.write(chunk, n);
+  }
+#endif
 
-  size_t i;
-  for (i = 0; (i + 2) < len; i += 3) {
-    os << basis_64[(plain[i] >> 2) & 0x3F];
-    os << basis_64[((plain[i] & 0x3) << 4) |
-                   (static_cast<int>(plain[i + 1] & 0xF0) >> 4)];
-    os << basis_64[((plain[i + 1] & 0xF) << 2) |
-                   (static_cast<int>(plain[i + 2] & 0xC0) >> 6)];
-    os << basis_64[plain[i + 2] & 0x3F];
+  while (len >= 3) {
+    size_t n = 0;
+    while (len >= 3 && n + 4 <= sizeof(chunk)) {
+      chunk[n++] = basis_64[(in[0] >> 2) & 0x3F];
+      chunk[n++] = basis_64[((in[0] & 0x3) << 4) | (in[1] >> 4)];
+      chunk[n++] = basis_64[((in[1] & 0xF) << 2) | (in[2] >> 6)];
+      chunk[n++] = basis_64[in[2] & 0x3F];
+      in += 3;
+      len -= 3;
+    }
+    os.write(chunk, n);
   }
-  if (i < len) {
-    os << basis_64[(plain[i] >> 2) & 0x3F];
-    if (i == (len - 1)) {
-      os << basis_64[((plain[i] & 0x3) << 4)];
-      os << '=';
+
+  if (len > 0) {
+    char tail[4];
+    tail[0] = basis_64[(in[0] >> 2) & 0x3F];
+    if (len == 1) {
+      tail[1] = basis_64[(in[0] & 0x3) << 4];
+      tail[2] = '=';
     } else {
-      os << basis_64[((plain[i] & 0x3) << 4) |
-                     (static_cast<int>(plain[i + 1] & 0xF0) >> 4)];
-      os << basis_64[((plain[i + 1] & 0xF) << 2)];
+      tail[1] = basis_64[((in[0] & 0x3) << 4) | (in[1] >> 4)];
+      tail[2] = basis_64[(in[1] & 0xF) << 2];
     }
-    os << '=';
+    tail[3] = '=';
+    os.write(tail, 4);
   }
 }
 
@@ -7,6 +7,7 @@
 #include "wpi/Synchronization.h"
 
 #ifndef _WIN32
+#include <sys/mman.h>
 #include <unistd.h>
 #endif
 
@@ -19,6 +20,7 @@
 
 #endif
 
+#include <algorithm>
 #include <atomic>
 #include <cstdio>
 #include <cstdlib>
@@ -27,9 +29,12 @@
 #include <vector>
 
 #include "fmt/format.h"
+#include "Lz4Block.h"
 #include "wpi/Endian.h"
 #include "wpi/Logger.h"
+#include "wpi/MappedFileRegion.h"
 #include "wpi/MathExtras.h"
+#include "wpi/ThreadPolicy.h"
 #include "wpi/fs.h"
 #include "wpi/timestamp.h"
 
@@ -77,7 +82,10 @@ class DataLog::Buffer {
   Buffer& operator=(const Buffer&) = delete;
 
   Buffer(Buffer&& oth)
-      : m_buf{oth.m_buf}, m_len{oth.m_len}, m_maxLen{oth.m_maxLen} {
+      : m_buf{oth.m_buf},
+        m_len{oth.m_len},
+        m_maxLen{oth.m_maxLen},
+        m_records{std::move(oth.m_records)} {
     oth.m_buf = nullptr;
     oth.m_len = 0;
     oth.m_maxLen = 0;
@@ -90,6 +98,7 @@ class DataLog::Buffer {
     m_buf = oth.m_buf;
     m_len = oth.m_len;
     m_maxLen = oth.m_maxLen;
+    m_records = std::move(oth.m_records);
     oth.m_buf = nullptr;
     oth.m_len = 0;
     oth.m_maxLen = 0;
@@ -105,17 +114,30 @@ class DataLog::Buffer {
 
   void Unreserve(size_t size) { m_len -= size; }
 
-  void Clear() { m_len = 0; }
+  void Clear() {
+    m_len = 0;
+    m_records.resize(0);
+  }
 
   size_t GetRemaining() const { return m_maxLen - m_len; }
 
   std::span<uint8_t> GetData() { return {m_buf, m_len}; }
   std::span<const uint8_t> GetData() const { return {m_buf, m_len}; }
 
+  // notes the entry id of a record starting at the given buffer offset;
+  // consumed by the writer thread to build index records
+  void NoteRecord(uint32_t entry, uint32_t offset) {
+    m_records.emplace_back(entry, offset);
+  }
+  std::span<const std::pair<uint32_t, uint32_t>> GetRecords() const {
+    return m_records;
+  }
+
  private:
   uint8_t* m_buf;
   size_t m_len = 0;
   size_t m_maxLen;
+  std::vector<std::pair<uint32_t, uint32_t>> m_records;
 };
 
 static void DefaultLog(unsigned int level, const char* file, unsigned int line,
@@ -130,13 +152,15 @@ static void DefaultLog(unsigned int level, const char* file, unsigned int line,
 static wpi::Logger defaultMessageLog{DefaultLog};
 
 DataLog::DataLog(std::string_view dir, std::string_view filename, double period,
-                 std::string_view extraHeader)
-    : DataLog{defaultMessageLog, dir, filename, period, extraHeader} {}
+                 std::string_view extraHeader, bool compress)
+    : DataLog{defaultMessageLog, dir, filename, period, extraHeader, compress} {
+}
 
 DataLog::DataLog(wpi::Logger& msglog, std::string_view dir,
                  std::string_view filename, double period,
-                 std::string_view extraHeader)
+                 std::string_view extraHeader, bool compress)
     : m_msglog{msglog},
+      m_compress{compress},
       m_period{period},
       m_extraHeader{extraHeader},
       m_newFilename{filename},
@@ -222,6 +246,148 @@ static void WriteToFile(fs::file_t f, std::span<const uint8_t> data,
   } while (data.size() > 0);
 }
 
+#ifndef _WIN32
+// Appends into a preallocated memory-mapped window of the log file, so a
+// flush is a memcpy into page cache and writeback is handled by the kernel
+// without blocking the writer thread (on slow flash, buffered writes plus
+// fdatasync cause periodic 50+ ms stalls).  The file is grown in chunks
+// ahead of the append position and truncated back to the actual data length
+// on close.  Any failure (e.g. filesystem without mmap support, disk full
+// during preallocation) reports false so the caller can fall back to
+// buffered writes.
+class MappedAppender {
+ public:
+  static constexpr uint64_t kChunkSize = 1024 * 1024;
+
+  bool Init(fs::file_t f, uint64_t pos) {
+    m_file = f;
+    m_pos = pos;
+    return MapWindow();
+  }
+
+  bool Append(std::span<const uint8_t> data) {
+    while (!data.empty()) {
+      uint64_t windowEnd = m_windowStart + m_region.size();
+      if (m_pos == windowEnd && !MapWindow()) {
+        return false;
+      }
+      windowEnd = m_windowStart + m_region.size();
+      size_t amt = (std::min)(static_cast<uint64_t>(data.size()),
+                              windowEnd - m_pos);
+      std::memcpy(m_region.data() + (m_pos - m_windowStart), data.data(), amt);
+      m_pos += amt;
+      data = data.subspan(amt);
+    }
+    return true;
+  }
+
+  // nudge the kernel to start writeback without waiting for it
+  void Sync() {
+    if (m_region) {
+      ::msync(m_region.data(), m_region.size(), MS_ASYNC);
+    }
+  }
+
+  // unmap and trim preallocated space back to the data actually written;
+  // after this, regular appending writes continue at the right offset
+  void Close() {
+    m_region.Unmap();
+    if (::ftruncate(m_file, m_pos) != 0) {
+      // ignore; the reader tolerates trailing zero padding
+    }
+  }
+
+ private:
+  bool MapWindow() {
+    m_region.Unmap();
+    uint64_t align = wpi::MappedFileRegion::GetAlignment();
+    m_windowStart = m_pos / align * align;
+    uint64_t end = m_windowStart + kChunkSize;
+    if (::ftruncate(m_file, end) != 0) {
+      return false;
+    }
+    std::error_code ec;
+    m_region = wpi::MappedFileRegion{m_file, end - m_windowStart,
+                                     m_windowStart,
+                                     wpi::MappedFileRegion::kReadWrite, ec};
+    return !ec && m_region;
+  }
+
+  fs::file_t m_file{fs::kInvalidFile};
+  wpi::MappedFileRegion m_region;
+  uint64_t m_windowStart{0};
+  uint64_t m_pos{0};
+};
+#endif  // !_WIN32
+
+// Accumulates per-entry record counts while the writer thread writes out
+// buffers, and encodes periodic index control records (kControlIndex).  Each
+// index record describes the block of records written since the previous
+// index record: entry ids with record counts, the block's file offset range,
+// and the offset of the previous index record (forming a chain).  The final
+// index record additionally ends with the trailer magic and its own file
+// offset so a reader can locate the chain without scanning the file.
+// Readers that predate index records skip them as unknown control records.
+class IndexBuilder {
+ public:
+  // emit an index record roughly every this many bytes of log data
+  static constexpr uint64_t kIndexPeriod = 4 * 1024 * 1024;
+
+  void SetStart(uint64_t pos) { m_blockStart = pos; }
+
+  void NoteRecords(std::span<const std::pair<uint32_t, uint32_t>> records) {
+    for (auto&& [entry, offset] : records) {
+      ++m_counts[entry];
+    }
+  }
+
+  bool ShouldEmit(uint64_t pos) const {
+    return (pos - m_blockStart) >= kIndexPeriod;
+  }
+
+  // encodes an index record covering [blockStart, pos); pos must be the file
+  // offset the returned record will be written at
+  std::span<const uint8_t> EncodeRecord(uint64_t pos, bool isFinal) {
+    size_t payloadSize =
+        1 + 4 + 8 + 8 + 8 + m_counts.size() * 8 + (isFinal ? 16 : 0);
+    m_rec.resize(kRecordMaxHeaderSize + payloadSize);
+    uint8_t* buf = m_rec.data();
+    unsigned int headerLen = WriteRecordHeader(buf, 0, 0, payloadSize);
+    uint8_t* p = buf + headerLen;
+    *p++ = impl::kControlIndex;
+    wpi::support::endian::write32le(p, m_counts.size());
+    p += 4;
+    wpi::support::endian::write64le(p, m_prevIndex);
+    p += 8;
+    wpi::support::endian::write64le(p, m_blockStart);
+    p += 8;
+    wpi::support::endian::write64le(p, pos);
+    p += 8;
+    for (auto&& [entry, count] : m_counts) {
+      wpi::support::endian::write32le(p, entry);
+      p += 4;
+      wpi::support::endian::write32le(p, count);
+      p += 4;
+    }
+    if (isFinal) {
+      std::memcpy(p, impl::kIndexTrailerMagic, 8);
+      p += 8;
+      wpi::support::endian::write64le(p, pos);
+    }
+    size_t size = headerLen + payloadSize;
+    m_prevIndex = pos;
+    m_blockStart = pos + size;
+    m_counts.clear();
+    return {m_rec.data(), size};
+  }
+
+ private:
+  uint64_t m_blockStart = 0;
+  uint64_t m_prevIndex = 0;
+  wpi::DenseMap<int, uint32_t> m_counts;
+  std::vector<uint8_t> m_rec;
+};
+
 static std::string MakeRandomFilename() {
   // build random filename
   static std::random_device dev;
@@ -237,6 +403,7 @@ static std::string MakeRandomFilename() {
 }
 
 void DataLog::WriterThreadMain(std::string_view dir) {
+  wpi::RegisterCurrentThread("DataLogWriter");
   std::chrono::duration<double> periodTime{m_period};
 
   std::error_code ec;
@@ -297,6 +464,75 @@ void DataLog::WriterThreadMain(std::string_view dir) {
   }
 
   std::vector<Buffer> toWrite;
+  uint64_t filePos = 8 + 4 + m_extraHeader.size();
+  IndexBuilder index;
+  index.SetStart(filePos);
+
+#ifndef _WIN32
+  // prefer the memory-mapped backend; fall back to buffered writes if the
+  // file cannot be mapped (or preallocation fails later on)
+  MappedAppender mapped;
+  bool useMapped = false;
+  if (f != fs::kInvalidFile) {
+    useMapped = mapped.Init(f, filePos);
+    if (!useMapped) {
+      mapped.Close();
+    }
+  }
+#endif
+
+  auto writeData = [&](std::span<const uint8_t> data) {
+#ifndef _WIN32
+    if (useMapped) {
+      if (mapped.Append(data)) {
+        return;
+      }
+      // could not grow the mapping (e.g. disk full); trim the
+      // preallocation and continue with buffered writes
+      WPI_WARNING(m_msglog,
+                  "could not extend mapped log file '{}'; falling back to "
+                  "buffered writes",
+                  filename);
+      mapped.Close();
+      useMapped = false;
+    }
+#endif
+    WriteToFile(f, data, filename, m_msglog);
+  };
+
+  // in compressed mode, record data is staged into frameBuf and written to
+  // the file as one compressed frame per flush; otherwise it goes straight
+  // to the file
+  std::vector<uint8_t> frameBuf;
+  std::vector<uint8_t> compBuf;
+  auto writeRecordData = [&](std::span<const uint8_t> data) {
+    if (m_compress) {
+      frameBuf.insert(frameBuf.end(), data.begin(), data.end());
+    } else {
+      writeData(data);
+    }
+  };
+  auto flushFrame = [&] {
+    if (!m_compress || frameBuf.empty()) {
+      return;
+    }
+    compBuf.resize(0);
+    size_t compSize = Lz4BlockCompress(compBuf, frameBuf);
+    uint8_t frameHeader[12];
+    std::memcpy(frameHeader, kLz4FrameMagic, 4);
+    support::endian::write32le(&frameHeader[4], frameBuf.size());
+    if (compSize >= frameBuf.size()) {
+      // incompressible; store the frame uncompressed
+      support::endian::write32le(&frameHeader[8], frameBuf.size());
+      writeData(frameHeader);
+      writeData(frameBuf);
+    } else {
+      support::endian::write32le(&frameHeader[8], compSize);
+      writeData(frameHeader);
+      writeData(compBuf);
+    }
+    frameBuf.resize(0);
+  };
 
   std::unique_lock lock{m_mutex};
   while (m_active) {
@@ -328,44 +564,88 @@ void DataLog::WriterThreadMain(std::string_view dir) {
     if (doFlush || m_doFlush) {
       // flush to file
       m_doFlush = false;
-      if (m_outgoing.empty()) {
+      // collect outgoing buffers from every append shard
+      lock.unlock();
+      CollectBuffers(toWrite);
+      if (toWrite.empty()) {
+        lock.lock();
         continue;
       }
-      // swap outgoing with empty vector
-      toWrite.swap(m_outgoing);
 
       if (f != fs::kInvalidFile) {
-        lock.unlock();
         // write buffers to file
         for (auto&& buf : toWrite) {
-          WriteToFile(f, buf.GetData(), filename, m_msglog);
+          index.NoteRecords(buf.GetRecords());
+          writeRecordData(buf.GetData());
+          filePos += buf.GetData().size();
         }
 
-        // sync to storage
+        // periodically append an index record describing the block of
+        // records written since the last one
+        if (index.ShouldEmit(filePos)) {
+          auto rec = index.EncodeRecord(filePos, false);
+          writeRecordData(rec);
+          filePos += rec.size();
+        }
+
+        flushFrame();
+
+#ifndef _WIN32
+        if (useMapped) {
+          // start writeback without waiting for it
+          mapped.Sync();
+        } else {
+          // sync to storage
 #if defined(__linux__)
-        ::fdatasync(f);
+          ::fdatasync(f);
 #elif defined(__APPLE__)
-        ::fsync(f);
+          ::fsync(f);
+#endif
+        }
 #endif
-        lock.lock();
       }
 
-      // release buffers back to free list
+      // release buffers back to shard free lists
+      size_t shardNum = 0;
       for (auto&& buf : toWrite) {
         buf.Clear();
-        m_free.emplace_back(std::move(buf));
+        auto& shard = m_shards[shardNum++ % kNumAppendShards];
+        std::scoped_lock shardLock{shard.mutex};
+        shard.free.emplace_back(std::move(buf));
       }
       toWrite.resize(0);
+      lock.lock();
     }
   }
 
+  lock.unlock();
+
   if (f != fs::kInvalidFile) {
+    // drain any remaining buffers, then append a final index record; the
+    // trailer at the end of its payload lets a reader locate the index
+    // chain without scanning the file
+    CollectBuffers(toWrite);
+    for (auto&& buf : toWrite) {
+      index.NoteRecords(buf.GetRecords());
+      writeRecordData(buf.GetData());
+      filePos += buf.GetData().size();
+    }
+    auto rec = index.EncodeRecord(filePos, true);
+    writeRecordData(rec);
+    flushFrame();
+#ifndef _WIN32
+    if (useMapped) {
+      mapped.Close();
+    }
+#endif
     fs::CloseFile(f);
   }
+  wpi::UnregisterCurrentThread();
 }
 
 void DataLog::WriterThreadMain(
     std::function<void(std::span<const uint8_t> data)> write) {
+  wpi::RegisterCurrentThread("DataLogWriter");
   std::chrono::duration<double> periodTime{m_period};
 
   // write header (version 1.0)
@@ -382,6 +662,9 @@ void DataLog::WriterThreadMain(
   }
 
   std::vector<Buffer> toWrite;
+  uint64_t filePos = 8 + 4 + m_extraHeader.size();
+  IndexBuilder index;
+  index.SetStart(filePos);
 
   std::unique_lock lock{m_mutex};
   while (m_active) {
@@ -394,31 +677,60 @@ void DataLog::WriterThreadMain(
     if (doFlush || m_doFlush) {
       // flush to file
       m_doFlush = false;
-      if (m_outgoing.empty()) {
+      // collect outgoing buffers from every append shard
+      lock.unlock();
+      CollectBuffers(toWrite);
+      if (toWrite.empty()) {
+        lock.lock();
         continue;
       }
-      // swap outgoing with empty vector
-      toWrite.swap(m_outgoing);
 
-      lock.unlock();
       // write buffers
       for (auto&& buf : toWrite) {
         if (!buf.GetData().empty()) {
+          index.NoteRecords(buf.GetRecords());
           write(buf.GetData());
+          filePos += buf.GetData().size();
         }
       }
-      lock.lock();
 
-      // release buffers back to free list
+      // periodically append an index record describing the block of
+      // records written since the last one
+      if (index.ShouldEmit(filePos)) {
+        auto rec = index.EncodeRecord(filePos, false);
+        write(rec);
+        filePos += rec.size();
+      }
+
+      // release buffers back to shard free lists
+      size_t shardNum = 0;
       for (auto&& buf : toWrite) {
         buf.Clear();
-        m_free.emplace_back(std::move(buf));
+        auto& shard = m_shards[shardNum++ % kNumAppendShards];
+        std::scoped_lock shardLock{shard.mutex};
+        shard.free.emplace_back(std::move(buf));
       }
       toWrite.resize(0);
+      lock.lock();
     }
   }
+  lock.unlock();
+
+  // drain any remaining buffers, then append a final index record; the
+  // trailer at the end of its payload lets a reader locate the index chain
+  // without scanning the file
+  CollectBuffers(toWrite);
+  for (auto&& buf : toWrite) {
+    if (!buf.GetData().empty()) {
+      index.NoteRecords(buf.GetRecords());
+      write(buf.GetData());
+      filePos += buf.GetData().size();
+    }
+  }
+  write(index.EncodeRecord(filePos, true));
 
   write({});  // indicate EOF
+  wpi::UnregisterCurrentThread();
 }
 
 // Control records use the following format:
@@ -446,12 +758,13 @@ int DataLog::Start(std::string_view name, std::string_view type,
   }
   entryInfo.type = type;
   size_t strsize = name.size() + type.size() + metadata.size();
-  uint8_t* buf = StartRecord(0, timestamp, 5 + 12 + strsize, 5);
+  std::scoped_lock shardLock{m_controlShard.mutex};
+  uint8_t* buf = StartRecord(m_controlShard, 0, timestamp, 5 + 12 + strsize, 5);
   *buf++ = impl::kControlStart;
   wpi::support::endian::write32le(buf, entryInfo.id);
-  AppendStringImpl(name);
-  AppendStringImpl(type);
-  AppendStringImpl(metadata);
+  AppendStringImpl(m_controlShard, name);
+  AppendStringImpl(m_controlShard, type);
+  AppendStringImpl(m_controlShard, metadata);
 
   return entryInfo.id;
 }
@@ -470,7 +783,18 @@ void DataLog::Finish(int entry, int64_t timestamp) {
     return;
   }
   m_entryCounts.erase(entry);
-  uint8_t* buf = StartRecord(0, timestamp, 5, 5);
+  // seal data appended before this point into the control stream so the
+  // Finish record cannot be emitted ahead of earlier data records for the
+  // entry (the control shard is emitted before the data shards)
+  for (auto&& shard : m_shards) {
+    std::scoped_lock locks{m_controlShard.mutex, shard.mutex};
+    for (auto&& buf : shard.outgoing) {
+      m_controlShard.outgoing.emplace_back(std::move(buf));
+    }
+    shard.outgoing.resize(0);
+  }
+  std::scoped_lock shardLock{m_controlShard.mutex};
+  uint8_t* buf = StartRecord(m_controlShard, 0, timestamp, 5, 5);
   *buf++ = impl::kControlFinish;
   wpi::support::endian::write32le(buf, entry);
 }
@@ -481,48 +805,85 @@ void DataLog::SetMetadata(int entry, std::string_view metadata,
     return;
   }
   std::scoped_lock lock{m_mutex};
-  uint8_t* buf = StartRecord(0, timestamp, 5 + 4 + metadata.size(), 5);
+  std::scoped_lock shardLock{m_controlShard.mutex};
+  uint8_t* buf =
+      StartRecord(m_controlShard, 0, timestamp, 5 + 4 + metadata.size(), 5);
   *buf++ = impl::kControlSetMetadata;
   wpi::support::endian::write32le(buf, entry);
-  AppendStringImpl(metadata);
+  AppendStringImpl(m_controlShard, metadata);
+}
+
+DataLog::AppendShard& DataLog::GetAppendShard() {
+  static std::atomic<unsigned int> nextShard{0};
+  thread_local unsigned int shardNum =
+      nextShard.fetch_add(1, std::memory_order_relaxed) % kNumAppendShards;
+  return m_shards[shardNum];
+}
+
+void DataLog::CollectBuffers(std::vector<Buffer>& toWrite) {
+  size_t start = toWrite.size();
+  for (auto&& shard : m_shards) {
+    std::scoped_lock shardLock{shard.mutex};
+    for (auto&& buf : shard.outgoing) {
+      toWrite.emplace_back(std::move(buf));
+    }
+    shard.outgoing.resize(0);
+  }
+  size_t numData = toWrite.size();
+  {
+    std::scoped_lock shardLock{m_controlShard.mutex};
+    for (auto&& buf : m_controlShard.outgoing) {
+      toWrite.emplace_back(std::move(buf));
+    }
+    m_controlShard.outgoing.resize(0);
+  }
+  // emit the control shard ahead of the data shards; because the control
+  // shard is collected last, any Start record that preceded collected data
+  // is guaranteed to be included, so an entry's Start always reaches the
+  // file before the entry's data
+  std::rotate(toWrite.begin() + start, toWrite.begin() + numData,
+              toWrite.end());
 }
 
-uint8_t* DataLog::Reserve(size_t size) {
+uint8_t* DataLog::Reserve(AppendShard& shard, size_t size) {
   assert(size <= kBlockSize);
-  if (m_outgoing.empty() || size > m_outgoing.back().GetRemaining()) {
-    if (m_free.empty()) {
-      m_outgoing.emplace_back();
+  if (shard.outgoing.empty() || size > shard.outgoing.back().GetRemaining()) {
+    if (shard.free.empty()) {
+      shard.outgoing.emplace_back();
     } else {
-      m_outgoing.emplace_back(std::move(m_free.back()));
-      m_free.pop_back();
+      shard.outgoing.emplace_back(std::move(shard.free.back()));
+      shard.free.pop_back();
     }
   }
-  return m_outgoing.back().Reserve(size);
+  return shard.outgoing.back().Reserve(size);
 }
 
-uint8_t* DataLog::StartRecord(uint32_t entry, uint64_t timestamp,
-                              uint32_t payloadSize, size_t reserveSize) {
-  uint8_t* buf = Reserve(kRecordMaxHeaderSize + reserveSize);
+uint8_t* DataLog::StartRecord(AppendShard& shard, uint32_t entry,
+                              uint64_t timestamp, uint32_t payloadSize,
+                              size_t reserveSize) {
+  uint8_t* buf = Reserve(shard, kRecordMaxHeaderSize + reserveSize);
+  auto& buffer = shard.outgoing.back();
+  buffer.NoteRecord(entry, buf - buffer.GetData().data());
   auto headerLen = WriteRecordHeader(buf, entry, timestamp, payloadSize);
-  m_outgoing.back().Unreserve(kRecordMaxHeaderSize - headerLen);
+  buffer.Unreserve(kRecordMaxHeaderSize - headerLen);
   buf += headerLen;
   return buf;
 }
 
-void DataLog::AppendImpl(std::span<const uint8_t> data) {
+void DataLog::AppendImpl(AppendShard& shard, std::span<const uint8_t> data) {
   while (data.size() > kBlockSize) {
-    uint8_t* buf = Reserve(kBlockSize);
+    uint8_t* buf = Reserve(shard, kBlockSize);
     std::memcpy(buf, data.data(), kBlockSize);
     data = data.subspan(kBlockSize);
   }
-  uint8_t* buf = Reserve(data.size());
+  uint8_t* buf = Reserve(shard, data.size());
   std::memcpy(buf, data.data(), data.size());
 }
 
-void DataLog::AppendStringImpl(std::string_view str) {
-  uint8_t* buf = Reserve(4);
+void DataLog::AppendStringImpl(AppendShard& shard, std::string_view str) {
+  uint8_t* buf = Reserve(shard, 4);
   wpi::support::endian::write32le(buf, str.size());
-  AppendImpl({reinterpret_cast<const uint8_t*>(str.data()), str.size()});
+  AppendImpl(shard, {reinterpret_cast<const uint8_t*>(str.data()), str.size()});
 }
 
 void DataLog::AppendRaw(int entry, std::span<const uint8_t> data,
@@ -530,12 +891,13 @@ void DataLog::AppendRaw(int entry, std::span<const uint8_t> data,
   if (entry <= 0) {
     return;
   }
-  std::scoped_lock lock{m_mutex};
   if (m_paused) {
     return;
   }
-  StartRecord(entry, timestamp, data.size(), 0);
-  AppendImpl(data);
+  auto& shard = GetAppendShard();
+  std::scoped_lock lock{shard.mutex};
+  StartRecord(shard, entry, timestamp, data.size(), 0);
+  AppendImpl(shard, data);
 }
 
 void DataLog::AppendRaw2(int entry,
@@ -544,17 +906,18 @@ void DataLog::AppendRaw2(int entry,
   if (entry <= 0) {
     return;
   }
-  std::scoped_lock lock{m_mutex};
   if (m_paused) {
     return;
   }
+  auto& shard = GetAppendShard();
+  std::scoped_lock lock{shard.mutex};
   size_t size = 0;
   for (auto&& chunk : data) {
     size += chunk.size();
   }
-  StartRecord(entry, timestamp, size, 0);
+  StartRecord(shard, entry, timestamp, size, 0);
   for (auto chunk : data) {
-    AppendImpl(chunk);
+    AppendImpl(shard, chunk);
   }
 }
 
@@ -562,11 +925,12 @@ void DataLog::AppendBoolean(int entry, bool value, int64_t timestamp) {
   if (entry <= 0) {
     return;
   }
-  std::scoped_lock lock{m_mutex};
   if (m_paused) {
     return;
   }
-  uint8_t* buf = StartRecord(entry, timestamp, 1, 1);
+  auto& shard = GetAppendShard();
+  std::scoped_lock lock{shard.mutex};
+  uint8_t* buf = StartRecord(shard, entry, timestamp, 1, 1);
   buf[0] = value ? 1 : 0;
 }
 
@@ -574,11 +938,12 @@ void DataLog::AppendInteger(int entry, int64_t value, int64_t timestamp) {
   if (entry <= 0) {
     return;
   }
-  std::scoped_lock lock{m_mutex};
   if (m_paused) {
     return;
   }
-  uint8_t* buf = StartRecord(entry, timestamp, 8, 8);
+  auto& shard = GetAppendShard();
+  std::scoped_lock lock{shard.mutex};
+  uint8_t* buf = StartRecord(shard, entry, timestamp, 8, 8);
   wpi::support::endian::write64le(buf, value);
 }
 
@@ -586,11 +951,12 @@ void DataLog::AppendFloat(int entry, float value, int64_t timestamp) {
   if (entry <= 0) {
     return;
   }
-  std::scoped_lock lock{m_mutex};
   if (m_paused) {
     return;
   }
-  uint8_t* buf = StartRecord(entry, timestamp, 4, 4);
+  auto& shard = GetAppendShard();
+  std::scoped_lock lock{shard.mutex};
+  uint8_t* buf = StartRecord(shard, entry, timestamp, 4, 4);
   if constexpr (wpi::support::endian::system_endianness() ==
                 wpi::support::little) {
     std::memcpy(buf, &value, 4);
@@ -603,11 +969,12 @@ void DataLog::AppendDouble(int entry, double value, int64_t timestamp) {
   if (entry <= 0) {
     return;
   }
-  std::scoped_lock lock{m_mutex};
   if (m_paused) {
     return;
   }
-  uint8_t* buf = StartRecord(entry, timestamp, 8, 8);
+  auto& shard = GetAppendShard();
+  std::scoped_lock lock{shard.mutex};
+  uint8_t* buf = StartRecord(shard, entry, timestamp, 8, 8);
   if constexpr (wpi::support::endian::system_endianness() ==
                 wpi::support::little) {
     std::memcpy(buf, &value, 8);
@@ -628,20 +995,21 @@ void DataLog::AppendBooleanArray(int entry, std::span<const bool> arr,
   if (entry <= 0) {
     return;
   }
-  std::scoped_lock lock{m_mutex};
   if (m_paused) {
     return;
   }
-  StartRecord(entry, timestamp, arr.size(), 0);
+  auto& shard = GetAppendShard();
+  std::scoped_lock lock{shard.mutex};
+  StartRecord(shard, entry, timestamp, arr.size(), 0);
   uint8_t* buf;
   while (arr.size() > kBlockSize) {
-    buf = Reserve(kBlockSize);
+    buf = Reserve(shard, kBlockSize);
     for (auto val : arr.subspan(0, kBlockSize)) {
       *buf++ = val ? 1 : 0;
     }
     arr = arr.subspan(kBlockSize);
   }
-  buf = Reserve(arr.size());
+  buf = Reserve(shard, arr.size());
   for (auto val : arr) {
     *buf++ = val ? 1 : 0;
   }
@@ -652,20 +1020,21 @@ void DataLog::AppendBooleanArray(int entry, std::span<const int> arr,
   if (entry <= 0) {
     return;
   }
-  std::scoped_lock lock{m_mutex};
   if (m_paused) {
     return;
   }
-  StartRecord(entry, timestamp, arr.size(), 0);
+  auto& shard = GetAppendShard();
+  std::scoped_lock lock{shard.mutex};
+  StartRecord(shard, entry, timestamp, arr.size(), 0);
   uint8_t* buf;
   while (arr.size() > kBlockSize) {
-    buf = Reserve(kBlockSize);
+    buf = Reserve(shard, kBlockSize);
     for (auto val : arr.subspan(0, kBlockSize)) {
       *buf++ = val & 1;
     }
     arr = arr.subspan(kBlockSize);
   }
-  buf = Reserve(arr.size());
+  buf = Reserve(shard, arr.size());
   for (auto val : arr) {
     *buf++ = val & 1;
   }
@@ -687,21 +1056,22 @@ void DataLog::AppendIntegerArray(int entry, std::span<const int64_t> arr,
     if (entry <= 0) {
       return;
     }
-    std::scoped_lock lock{m_mutex};
     if (m_paused) {
       return;
     }
-    StartRecord(entry, timestamp, arr.size() * 8, 0);
+    auto& shard = GetAppendShard();
+    std::scoped_lock lock{shard.mutex};
+    StartRecord(shard, entry, timestamp, arr.size() * 8, 0);
     uint8_t* buf;
     while ((arr.size() * 8) > kBlockSize) {
-      buf = Reserve(kBlockSize);
+      buf = Reserve(shard, kBlockSize);
       for (auto val : arr.subspan(0, kBlockSize / 8)) {
         wpi::support::endian::write64le(buf, val);
         buf += 8;
       }
       arr = arr.subspan(kBlockSize / 8);
     }
-    buf = Reserve(arr.size() * 8);
+    buf = Reserve(shard, arr.size() * 8);
     for (auto val : arr) {
       wpi::support::endian::write64le(buf, val);
       buf += 8;
@@ -720,21 +1090,22 @@ void DataLog::AppendFloatArray(int entry, std::span<const float> arr,
     if (entry <= 0) {
       return;
     }
-    std::scoped_lock lock{m_mutex};
     if (m_paused) {
       return;
     }
-    StartRecord(entry, timestamp, arr.size() * 4, 0);
+    auto& shard = GetAppendShard();
+    std::scoped_lock lock{shard.mutex};
+    StartRecord(shard, entry, timestamp, arr.size() * 4, 0);
     uint8_t* buf;
     while ((arr.size() * 4) > kBlockSize) {
-      buf = Reserve(kBlockSize);
+      buf = Reserve(shard, kBlockSize);
       for (auto val : arr.subspan(0, kBlockSize / 4)) {
         wpi::support::endian::write32le(buf, wpi::FloatToBits(val));
         buf += 4;
       }
       arr = arr.subspan(kBlockSize / 4);
     }
-    buf = Reserve(arr.size() * 4);
+    buf = Reserve(shard, arr.size() * 4);
     for (auto val : arr) {
       wpi::support::endian::write32le(buf, wpi::FloatToBits(val));
       buf += 4;
@@ -753,21 +1124,22 @@ void DataLog::AppendDoubleArray(int entry, std::span<const double> arr,
     if (entry <= 0) {
       return;
     }
-    std::scoped_lock lock{m_mutex};
     if (m_paused) {
       return;
     }
-    StartRecord(entry, timestamp, arr.size() * 8, 0);
+    auto& shard = GetAppendShard();
+    std::scoped_lock lock{shard.mutex};
+    StartRecord(shard, entry, timestamp, arr.size() * 8, 0);
     uint8_t* buf;
     while ((arr.size() * 8) > kBlockSize) {
-      buf = Reserve(kBlockSize);
+      buf = Reserve(shard, kBlockSize);
       for (auto val : arr.subspan(0, kBlockSize / 8)) {
         wpi::support::endian::write64le(buf, wpi::DoubleToBits(val));
         buf += 8;
       }
       arr = arr.subspan(kBlockSize / 8);
     }
-    buf = Reserve(arr.size() * 8);
+    buf = Reserve(shard, arr.size() * 8);
     for (auto val : arr) {
       wpi::support::endian::write64le(buf, wpi::DoubleToBits(val));
       buf += 8;
@@ -786,14 +1158,15 @@ void DataLog::AppendStringArray(int entry, std::span<const std::string> arr,
   for (auto&& str : arr) {
     size += 4 + str.size();
   }
-  std::scoped_lock lock{m_mutex};
   if (m_paused) {
     return;
   }
-  uint8_t* buf = StartRecord(entry, timestamp, size, 4);
+  auto& shard = GetAppendShard();
+  std::scoped_lock lock{shard.mutex};
+  uint8_t* buf = StartRecord(shard, entry, timestamp, size, 4);
   wpi::support::endian::write32le(buf, arr.size());
   for (auto&& str : arr) {
-    AppendStringImpl(str);
+    AppendStringImpl(shard, str);
   }
 }
 
@@ -809,13 +1182,14 @@ void DataLog::AppendStringArray(int entry,
   for (auto&& str : arr) {
     size += 4 + str.size();
   }
-  std::scoped_lock lock{m_mutex};
   if (m_paused) {
     return;
   }
-  uint8_t* buf = StartRecord(entry, timestamp, size, 4);
+  auto& shard = GetAppendShard();
+  std::scoped_lock lock{shard.mutex};
+  uint8_t* buf = StartRecord(shard, entry, timestamp, size, 4);
   wpi::support::endian::write32le(buf, arr.size());
   for (auto sv : arr) {
-    AppendStringImpl(sv);
+    AppendStringImpl(shard, sv);
   }
 }
@@ -4,7 +4,15 @@
 
 #include "wpi/DataLogReader.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include "Lz4Block.h"
 #include "wpi/DataLog.h"
+#include "wpi/DenseMap.h"
 #include "wpi/Endian.h"
 #include "wpi/MathExtras.h"
 
@@ -40,6 +48,11 @@ bool DataLogRecord::IsSetMetadata() const {
          m_data[0] == impl::kControlSetMetadata;
 }
 
+bool DataLogRecord::IsIndex() const {
+  return m_entry == 0 && m_data.size() >= 29 &&
+         m_data[0] == impl::kControlIndex;
+}
+
 bool DataLogRecord::GetStartData(StartRecordData* out) const {
   if (!IsStart()) {
     return false;
@@ -75,6 +88,28 @@ bool DataLogRecord::GetSetMetadataData(MetadataRecordData* out) const {
   return ReadString(&buf, &out->metadata);
 }
 
+bool DataLogRecord::GetIndexData(IndexRecordData* out) const {
+  if (!IsIndex()) {
+    return false;
+  }
+  uint32_t count = wpi::support::endian::read32le(&m_data[1]);
+  // sanity check size
+  if (count > ((m_data.size() - 29) / 8)) {
+    return false;
+  }
+  out->prevIndex = wpi::support::endian::read64le(&m_data[5]);
+  out->blockStart = wpi::support::endian::read64le(&m_data[13]);
+  out->blockEnd = wpi::support::endian::read64le(&m_data[21]);
+  out->entries.clear();
+  out->entries.reserve(count);
+  for (uint32_t i = 0; i < count; ++i) {
+    int entry = wpi::support::endian::read32le(&m_data[29 + i * 8]);
+    unsigned int num = wpi::support::endian::read32le(&m_data[33 + i * 8]);
+    out->entries.emplace_back(entry, num);
+  }
+  return true;
+}
+
 bool DataLogRecord::GetBoolean(bool* value) const {
   if (m_data.size() != 1) {
     return false;
@@ -188,7 +223,84 @@ bool DataLogRecord::GetStringArray(std::vector<std::string_view>* arr) const {
 }
 
 DataLogReader::DataLogReader(std::unique_ptr<MemoryBuffer> buffer)
-    : m_buf{std::move(buffer)} {}
+    : m_buf{std::move(buffer)} {
+  ExpandCompressed();
+}
+
+void DataLogReader::ExpandCompressed() {
+  if (!m_buf) {
+    return;
+  }
+  auto buf = m_buf->GetBuffer();
+  if (buf.size() < 12) {
+    return;
+  }
+  uint32_t extraSize = wpi::support::endian::read32le(&buf[8]);
+  if (extraSize > buf.size() - 12) {
+    return;
+  }
+  size_t dataStart = 12 + extraSize;
+  if (buf.size() < dataStart + 12 ||
+      std::memcmp(&buf[dataStart], kLz4FrameMagic, 4) != 0) {
+    return;  // not a compressed log
+  }
+
+  // first pass: sum the uncompressed frame sizes
+  size_t total = dataStart;
+  size_t pos = dataStart;
+  while ((pos + 12) <= buf.size() &&
+         std::memcmp(&buf[pos], kLz4FrameMagic, 4) == 0) {
+    uint32_t uncompSize = wpi::support::endian::read32le(&buf[pos + 4]);
+    uint32_t compSize = wpi::support::endian::read32le(&buf[pos + 8]);
+    if (compSize > (buf.size() - pos - 12)) {
+      break;  // truncated final frame
+    }
+    total += uncompSize;
+    pos += 12 + compSize;
+  }
+
+  std::string name{m_buf->GetBufferIdentifier()};
+  auto out = WritableMemoryBuffer::GetNewUninitMemBuffer(total, name);
+  if (!out) {
+    return;
+  }
+  auto outBuf = out->GetBuffer();
+
+  // second pass: copy the header and decompress each frame in place
+  std::memcpy(outBuf.data(), buf.data(), dataStart);
+  size_t opos = dataStart;
+  pos = dataStart;
+  while ((pos + 12) <= buf.size() &&
+         std::memcmp(&buf[pos], kLz4FrameMagic, 4) == 0) {
+    uint32_t uncompSize = wpi::support::endian::read32le(&buf[pos + 4]);
+    uint32_t compSize = wpi::support::endian::read32le(&buf[pos + 8]);
+    if (compSize > (buf.size() - pos - 12)) {
+      break;
+    }
+    auto frame = buf.subspan(pos + 12, compSize);
+    auto dst = outBuf.subspan(opos, uncompSize);
+    if (compSize == uncompSize) {
+      // incompressible frame, stored uncompressed
+      std::memcpy(dst.data(), frame.data(), compSize);
+    } else if (!Lz4BlockDecompress(dst, frame)) {
+      break;  // corrupt frame; keep the frames that did decompress
+    }
+    opos += uncompSize;
+    pos += 12 + compSize;
+  }
+
+  if (opos == total) {
+    m_buf = std::move(out);
+  } else {
+    // a frame failed to decompress; trim to the valid prefix
+    auto trimmed = WritableMemoryBuffer::GetNewUninitMemBuffer(opos, name);
+    if (!trimmed) {
+      return;
+    }
+    std::memcpy(trimmed->GetBuffer().data(), outBuf.data(), opos);
+    m_buf = std::move(trimmed);
+  }
+}
 
 bool DataLogReader::IsValid() const {
   if (!m_buf) {
@@ -226,6 +338,182 @@ std::string_view DataLogReader::GetExtraHeader() const {
   return rv;
 }
 
+std::vector<IndexRecordData> DataLogReader::GetIndexBlocks() const {
+  std::vector<IndexRecordData> blocks;
+  if (!m_buf) {
+    return blocks;
+  }
+  auto buf = m_buf->GetBuffer();
+
+  // fast path: the trailer at the end of a cleanly closed file gives the
+  // offset of the final index record, and each index record chains to the
+  // previous one
+  if (buf.size() >= 16 &&
+      std::memcmp(&buf[buf.size() - 16], impl::kIndexTrailerMagic, 8) == 0) {
+    uint64_t off = wpi::support::endian::read64le(&buf[buf.size() - 8]);
+    bool complete = false;
+    while (off != 0 && off < buf.size()) {
+      size_t pos = off;
+      DataLogRecord record;
+      IndexRecordData data;
+      if (!GetRecord(&pos, &record) || !record.GetIndexData(&data)) {
+        break;
+      }
+      uint64_t prev = data.prevIndex;
+      blocks.emplace_back(std::move(data));
+      if (prev == 0) {
+        complete = true;
+        break;
+      }
+      if (prev >= off) {  // chain offsets must be strictly decreasing
+        break;
+      }
+      off = prev;
+    }
+    if (complete) {
+      std::reverse(blocks.begin(), blocks.end());
+      return blocks;
+    }
+    // broken chain; fall back to scanning
+    blocks.clear();
+  }
+
+  // slow path (e.g. the log was not cleanly closed): scan for index records
+  for (auto&& record : *this) {
+    IndexRecordData data;
+    if (record.GetIndexData(&data)) {
+      blocks.emplace_back(std::move(data));
+    }
+  }
+  return blocks;
+}
+
+std::vector<DataLogRecord> DataLogReader::GetEntryRecords(int entry) const {
+  std::vector<DataLogRecord> records;
+  auto blocks = GetIndexBlocks();
+  if (blocks.empty()) {
+    // no index; scan the entire log
+    for (auto&& record : *this) {
+      if (record.GetEntry() == entry) {
+        records.push_back(record);
+      }
+    }
+    return records;
+  }
+  for (auto&& block : blocks) {
+    unsigned int count = 0;
+    for (auto&& [id, num] : block.entries) {
+      if (id == entry) {
+        count = num;
+        break;
+      }
+    }
+    if (count == 0) {
+      continue;
+    }
+    records.reserve(records.size() + count);
+    size_t pos = block.blockStart;
+    DataLogRecord record;
+    while (pos < block.blockEnd && GetRecord(&pos, &record)) {
+      if (record.GetEntry() == entry) {
+        records.push_back(record);
+      }
+    }
+  }
+  return records;
+}
+
+std::vector<std::pair<int, std::vector<DataLogRecord>>>
+DataLogReader::GetAllEntryRecords(unsigned int numThreads) const {
+  // DenseMap layout varies with NDEBUG, so it must not cross the shared
+  // library boundary; it's used internally here and converted to a plain
+  // vector of pairs for the return
+  std::vector<std::pair<int, std::vector<DataLogRecord>>> rv;
+  if (!m_buf) {
+    return rv;
+  }
+  auto buf = m_buf->GetBuffer();
+  if (buf.size() < 12) {
+    return rv;
+  }
+  uint32_t extraSize = wpi::support::endian::read32le(&buf[8]);
+  if (buf.size() < (12 + extraSize)) {
+    return rv;
+  }
+
+  if (numThreads == 0) {
+    numThreads = std::thread::hardware_concurrency();
+  }
+  if (numThreads == 0) {
+    numThreads = 1;
+  }
+
+  // serial header-only pass to find chunk boundaries; record headers don't
+  // self-synchronize, so chunks can only start where a record starts
+  static constexpr size_t kRecordsPerChunk = 4096;
+  std::vector<size_t> bounds;
+  bounds.push_back(12 + extraSize);
+  size_t pos = bounds[0];
+  size_t count = 0;
+  while (GetNextRecord(&pos)) {
+    if (++count == kRecordsPerChunk) {
+      bounds.push_back(pos);
+      count = 0;
+    }
+  }
+  size_t numChunks = bounds.size();
+  bounds.push_back(SIZE_MAX);  // GetRecord stops at the first bad header
+
+  // decode chunks in parallel into per-chunk maps
+  std::vector<wpi::DenseMap<int, std::vector<DataLogRecord>>> chunkMaps{
+      numChunks};
+  std::atomic<size_t> nextChunk{0};
+  auto worker = [&] {
+    for (;;) {
+      size_t chunk = nextChunk.fetch_add(1, std::memory_order_relaxed);
+      if (chunk >= numChunks) {
+        return;
+      }
+      size_t rpos = bounds[chunk];
+      size_t end = bounds[chunk + 1];
+      DataLogRecord record;
+      while (rpos < end && GetRecord(&rpos, &record)) {
+        chunkMaps[chunk][record.GetEntry()].push_back(record);
+      }
+    }
+  };
+  if (numThreads == 1 || numChunks <= 1) {
+    worker();
+  } else {
+    std::vector<std::thread> threads;
+    size_t n = (std::min)(static_cast<size_t>(numThreads), numChunks);
+    threads.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+      threads.emplace_back(worker);
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  // merge in chunk order so each entry's records stay in file order
+  wpi::DenseMap<int, std::vector<DataLogRecord>> merged;
+  for (auto& chunkMap : chunkMaps) {
+    for (auto& [entry, records] : chunkMap) {
+      auto& dest = merged[entry];
+      dest.insert(dest.end(), records.begin(), records.end());
+    }
+  }
+  rv.reserve(merged.size());
+  for (auto& [entry, records] : merged) {
+    rv.emplace_back(entry, std::move(records));
+  }
+  std::sort(rv.begin(), rv.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.first < rhs.first;
+  });
+  return rv;
+}
+
 DataLogReader::iterator DataLogReader::begin() const {
   if (!m_buf) {
     return end();
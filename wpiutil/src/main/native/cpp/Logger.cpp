@@ -4,8 +4,253 @@
 
 #include "wpi/Logger.h"
 
+#include <atomic>
+#include <cstring>
+
+#include "fmt/args.h"
+
 using namespace wpi;
 
+namespace {
+
+enum class ArgType : unsigned char {
+  kBool,
+  kChar,
+  kInt,
+  kUInt,
+  kFloat,
+  kDouble,
+  kLongDouble,
+  kString,
+  kPointer
+};
+
+// Binary log record: the format string followed by a tag/payload stream of
+// packed arguments, all inline so records can be copied through the ring
+// without allocation.  String arguments are copied by contents, so the
+// caller's temporaries may die before the record is formatted.
+struct Record {
+  static constexpr size_t kBufSize = 128;
+
+  unsigned int level;
+  unsigned int line;
+  const char* file;  // __FILE__ literal; static storage
+  unsigned int formatLen;
+  unsigned int argBytes;
+  char buf[kBufSize];
+
+  fmt::string_view GetFormat() const { return {buf, formatLen}; }
+};
+
+struct PackVisitor {
+  Record& rec;
+  size_t& pos;
+
+  bool Put(const void* data, size_t len) {
+    if (pos + len > Record::kBufSize) {
+      return false;
+    }
+    std::memcpy(rec.buf + pos, data, len);
+    pos += len;
+    return true;
+  }
+
+  template <typename T>
+  bool Tagged(ArgType type, T value) {
+    auto tag = static_cast<unsigned char>(type);
+    return Put(&tag, 1) && Put(&value, sizeof(value));
+  }
+
+  bool operator()(bool value) { return Tagged(ArgType::kBool, value); }
+  bool operator()(char value) { return Tagged(ArgType::kChar, value); }
+  bool operator()(int value) {
+    return Tagged(ArgType::kInt, static_cast<long long>(value));
+  }
+  bool operator()(unsigned value) {
+    return Tagged(ArgType::kUInt, static_cast<unsigned long long>(value));
+  }
+  bool operator()(long long value) { return Tagged(ArgType::kInt, value); }
+  bool operator()(unsigned long long value) {
+    return Tagged(ArgType::kUInt, value);
+  }
+  bool operator()(float value) { return Tagged(ArgType::kFloat, value); }
+  bool operator()(double value) { return Tagged(ArgType::kDouble, value); }
+  bool operator()(long double value) {
+    return Tagged(ArgType::kLongDouble, value);
+  }
+  bool operator()(const char* value) {
+    return (*this)(fmt::string_view{value});
+  }
+  bool operator()(fmt::string_view value) {
+    auto tag = static_cast<unsigned char>(ArgType::kString);
+    auto len = static_cast<unsigned int>(value.size());
+    return Put(&tag, 1) && Put(&len, sizeof(len)) &&
+           Put(value.data(), value.size());
+  }
+  bool operator()(const void* value) {
+    return Tagged(ArgType::kPointer, reinterpret_cast<uintptr_t>(value));
+  }
+
+  // custom-formatted types, 128-bit integers, etc.: fall back to eager
+  template <typename T>
+  bool operator()(T) {
+    return false;
+  }
+};
+
+bool PackRecord(Record& rec, unsigned int level, const char* file,
+                unsigned int line, fmt::string_view format,
+                fmt::format_args args) {
+  if (format.size() > Record::kBufSize) {
+    return false;
+  }
+  rec.level = level;
+  rec.line = line;
+  rec.file = file;
+  rec.formatLen = static_cast<unsigned int>(format.size());
+  std::memcpy(rec.buf, format.data(), format.size());
+  size_t pos = format.size();
+  PackVisitor visitor{rec, pos};
+  for (int i = 0;; ++i) {
+    auto arg = args.get(i);
+    if (!arg) {
+      break;
+    }
+    if (!fmt::visit_format_arg(visitor, arg)) {
+      return false;
+    }
+  }
+  rec.argBytes = static_cast<unsigned int>(pos - rec.formatLen);
+  return true;
+}
+
+template <typename T>
+T Unpack(const char*& p) {
+  T value;
+  std::memcpy(&value, p, sizeof(value));
+  p += sizeof(value);
+  return value;
+}
+
+void UnpackArgs(const Record& rec,
+                fmt::dynamic_format_arg_store<fmt::format_context>& store) {
+  const char* p = rec.buf + rec.formatLen;
+  const char* end = p + rec.argBytes;
+  while (p < end) {
+    auto type = static_cast<ArgType>(*p++);
+    switch (type) {
+      case ArgType::kBool:
+        store.push_back(Unpack<bool>(p));
+        break;
+      case ArgType::kChar:
+        store.push_back(Unpack<char>(p));
+        break;
+      case ArgType::kInt:
+        store.push_back(Unpack<long long>(p));
+        break;
+      case ArgType::kUInt:
+        store.push_back(Unpack<unsigned long long>(p));
+        break;
+      case ArgType::kFloat:
+        store.push_back(Unpack<float>(p));
+        break;
+      case ArgType::kDouble:
+        store.push_back(Unpack<double>(p));
+        break;
+      case ArgType::kLongDouble:
+        store.push_back(Unpack<long double>(p));
+        break;
+      case ArgType::kString: {
+        auto len = Unpack<unsigned int>(p);
+        store.push_back(fmt::string_view{p, len});
+        p += len;
+        break;
+      }
+      case ArgType::kPointer:
+        store.push_back(reinterpret_cast<const void*>(Unpack<uintptr_t>(p)));
+        break;
+    }
+  }
+}
+
+}  // namespace
+
+namespace wpi::detail {
+
+// Bounded lock-free MPMC ring of log records (Vyukov-style; per-cell
+// sequence numbers arbitrate producers).  Push fails when full rather than
+// blocking or overwriting; the caller formats eagerly instead.
+class LogRing {
+ public:
+  explicit LogRing(size_t capacity) {
+    size_t cap = 1;
+    while (cap < capacity) {
+      cap <<= 1;
+    }
+    m_mask = cap - 1;
+    m_cells = std::make_unique<Cell[]>(cap);
+    for (size_t i = 0; i < cap; ++i) {
+      m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  bool Push(const Record& rec) {
+    size_t pos = m_head.load(std::memory_order_relaxed);
+    for (;;) {
+      Cell& cell = m_cells[pos & m_mask];
+      size_t seq = cell.sequence.load(std::memory_order_acquire);
+      auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+      if (diff == 0) {
+        if (m_head.compare_exchange_weak(pos, pos + 1,
+                                         std::memory_order_relaxed)) {
+          cell.record = rec;
+          cell.sequence.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;  // full
+      } else {
+        pos = m_head.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  bool Pop(Record& rec) {
+    size_t pos = m_tail.load(std::memory_order_relaxed);
+    for (;;) {
+      Cell& cell = m_cells[pos & m_mask];
+      size_t seq = cell.sequence.load(std::memory_order_acquire);
+      auto diff =
+          static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+      if (diff == 0) {
+        if (m_tail.compare_exchange_weak(pos, pos + 1,
+                                         std::memory_order_relaxed)) {
+          rec = cell.record;
+          cell.sequence.store(pos + m_mask + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;  // empty
+      } else {
+        pos = m_tail.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+ private:
+  struct Cell {
+    std::atomic<size_t> sequence;
+    Record record;
+  };
+
+  std::unique_ptr<Cell[]> m_cells;
+  size_t m_mask;
+  alignas(64) std::atomic<size_t> m_head{0};
+  alignas(64) std::atomic<size_t> m_tail{0};
+};
+
+}  // namespace wpi::detail
+
 void Logger::DoLog(unsigned int level, const char* file, unsigned int line,
                    const char* msg) {
   if (!m_func || level < m_min_level) {
@@ -19,8 +264,37 @@ void Logger::LogV(unsigned int level, const char* file, unsigned int line,
   if (!m_func || level < m_min_level) {
     return;
   }
+  if (m_ring) {
+    Record rec;
+    if (PackRecord(rec, level, file, line, format, args) &&
+        m_ring->Push(rec)) {
+      return;
+    }
+  }
   fmt::memory_buffer out;
   fmt::vformat_to(fmt::appender{out}, format, args);
   out.push_back('\0');
   m_func(level, file, line, out.data());
 }
+
+void Logger::SetDeferred(size_t capacity) {
+  m_ring = std::make_shared<detail::LogRing>(capacity);
+}
+
+void Logger::ProcessDeferred() {
+  if (!m_ring || !m_func) {
+    return;
+  }
+  Record rec;
+  while (m_ring->Pop(rec)) {
+    if (rec.level < m_min_level) {
+      continue;
+    }
+    fmt::dynamic_format_arg_store<fmt::format_context> store;
+    UnpackArgs(rec, store);
+    fmt::memory_buffer out;
+    fmt::vformat_to(fmt::appender{out}, rec.GetFormat(), store);
+    out.push_back('\0');
+    m_func(rec.level, rec.file, rec.line, out.data());
+  }
+}
@@ -0,0 +1,174 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "Lz4Block.h"
+
+#include <cstring>
+
+#include "wpi/Endian.h"
+
+using namespace wpi::log;
+
+// Self-contained implementation of the LZ4 block format (token byte with
+// literal/match length nibbles, length extension bytes, 2-byte match
+// offsets).  A greedy single-probe hash table matcher keeps the append cost
+// low; compression ratio on typical log data (doubles with shared exponent
+// bytes, repeated strings) is close to the reference fast compressor.
+
+namespace {
+
+constexpr unsigned int kHashLog = 12;
+constexpr size_t kMinMatch = 4;
+// matches must not start within this many bytes of the end
+constexpr size_t kMfLimit = 12;
+// the last bytes of a block are always literals
+constexpr size_t kLastLiterals = 5;
+
+uint32_t Hash(uint32_t v) {
+  return (v * 2654435761u) >> (32 - kHashLog);
+}
+
+void WriteLength(std::vector<uint8_t>& dst, size_t len) {
+  while (len >= 255) {
+    dst.push_back(255);
+    len -= 255;
+  }
+  dst.push_back(static_cast<uint8_t>(len));
+}
+
+}  // namespace
+
+size_t wpi::log::Lz4BlockCompress(std::vector<uint8_t>& dst,
+                                  std::span<const uint8_t> src) {
+  size_t start = dst.size();
+  const uint8_t* base = src.data();
+  const uint8_t* ip = base;
+  const uint8_t* anchor = base;
+  const uint8_t* end = base + src.size();
+
+  if (src.size() > kMfLimit) {
+    const uint8_t* mflimit = end - kMfLimit;
+    const uint8_t* matchlimit = end - kLastLiterals;
+    uint32_t table[1 << kHashLog] = {0};  // position + 1; 0 means empty
+
+    ++ip;  // the first byte has nothing earlier to match
+    while (ip < mflimit) {
+      uint32_t seq = wpi::support::endian::read32le(ip);
+      uint32_t h = Hash(seq);
+      uint32_t pos = table[h];
+      table[h] = static_cast<uint32_t>(ip - base) + 1;
+      if (pos != 0) {
+        const uint8_t* ref = base + (pos - 1);
+        if (static_cast<size_t>(ip - ref) <= 65535 &&
+            wpi::support::endian::read32le(ref) == seq) {
+          // extend the match as far as allowed
+          const uint8_t* mip = ip + kMinMatch;
+          const uint8_t* mref = ref + kMinMatch;
+          while (mip < matchlimit && *mip == *mref) {
+            ++mip;
+            ++mref;
+          }
+          size_t matchLen = mip - ip;
+          size_t litLen = ip - anchor;
+          size_t ml = matchLen - kMinMatch;
+          uint8_t token = static_cast<uint8_t>(litLen >= 15 ? 15 : litLen)
+                          << 4;
+          token |= static_cast<uint8_t>(ml >= 15 ? 15 : ml);
+          dst.push_back(token);
+          if (litLen >= 15) {
+            WriteLength(dst, litLen - 15);
+          }
+          dst.insert(dst.end(), anchor, ip);
+          size_t offset = ip - ref;
+          dst.push_back(offset & 0xff);
+          dst.push_back((offset >> 8) & 0xff);
+          if (ml >= 15) {
+            WriteLength(dst, ml - 15);
+          }
+          ip = mip;
+          anchor = ip;
+          continue;
+        }
+      }
+      ++ip;
+    }
+  }
+
+  // final literal run
+  size_t litLen = end - anchor;
+  dst.push_back(static_cast<uint8_t>(litLen >= 15 ? 15 : litLen) << 4);
+  if (litLen >= 15) {
+    WriteLength(dst, litLen - 15);
+  }
+  dst.insert(dst.end(), anchor, end);
+  return dst.size() - start;
+}
+
+bool wpi::log::Lz4BlockDecompress(std::span<uint8_t> dst,
+                                  std::span<const uint8_t> src) {
+  const uint8_t* ip = src.data();
+  const uint8_t* iend = ip + src.size();
+  uint8_t* op = dst.data();
+  uint8_t* oend = op + dst.size();
+
+  while (ip < iend) {
+    unsigned int token = *ip++;
+
+    // literals
+    size_t litLen = token >> 4;
+    if (litLen == 15) {
+      uint8_t v;
+      do {
+        if (ip >= iend) {
+          return false;
+        }
+        v = *ip++;
+        litLen += v;
+      } while (v == 255);
+    }
+    if (litLen > static_cast<size_t>(iend - ip) ||
+        litLen > static_cast<size_t>(oend - op)) {
+      return false;
+    }
+    std::memcpy(op, ip, litLen);
+    op += litLen;
+    ip += litLen;
+    if (ip >= iend) {
+      break;  // final sequence has no match
+    }
+
+    // match
+    if ((iend - ip) < 2) {
+      return false;
+    }
+    size_t offset = wpi::support::endian::read16le(ip);
+    ip += 2;
+    if (offset == 0 || offset > static_cast<size_t>(op - dst.data())) {
+      return false;
+    }
+    size_t matchLen = token & 0xf;
+    if (matchLen == 15) {
+      uint8_t v;
+      do {
+        if (ip >= iend) {
+          return false;
+        }
+        v = *ip++;
+        matchLen += v;
+      } while (v == 255);
+    }
+    matchLen += kMinMatch;
+    if (matchLen > static_cast<size_t>(oend - op)) {
+      return false;
+    }
+    // byte-at-a-time; matches may overlap the output being written
+    const uint8_t* match = op - offset;
+    for (size_t i = 0; i < matchLen; ++i) {
+      op[i] = match[i];
+    }
+    op += matchLen;
+  }
+
+  return op == oend;
+}
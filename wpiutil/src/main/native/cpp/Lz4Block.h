@@ -0,0 +1,32 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <span>
+#include <vector>
+
+namespace wpi::log {
+
+// magic at the start of every compressed frame in a compressed data log;
+// each frame is: 4-byte magic, 4-byte little-endian uncompressed length,
+// 4-byte little-endian compressed length, compressed data.  A compressed
+// length equal to the uncompressed length indicates the frame data is
+// stored uncompressed (incompressible input).
+inline constexpr char kLz4FrameMagic[] = "WPLZ";
+
+// Compresses src in the LZ4 block format, appending the output to dst.
+// Returns the number of bytes appended.  Incompressible input may produce
+// output slightly larger than the input; the caller should store the raw
+// bytes instead in that case.
+size_t Lz4BlockCompress(std::vector<uint8_t>& dst, std::span<const uint8_t> src);
+
+// Decompresses an LZ4 block into dst, which must be sized to the exact
+// original (uncompressed) length.  Returns false if the input is corrupt or
+// does not decompress to exactly dst.size() bytes.
+bool Lz4BlockDecompress(std::span<uint8_t> dst, std::span<const uint8_t> src);
+
+}  // namespace wpi::log
@@ -4,8 +4,63 @@
 
 #include "wpi/SafeThread.h"
 
+#include "wpi/ThreadPolicy.h"
+
 using namespace wpi;
 
+// Registry of named threads for GetSafeThreadTelemetry().  Writers copy and
+// republish under a mutex; readers just load the current snapshot, so
+// telemetry polling never contends with thread startup.
+static wpi::mutex& GetRegistryMutex() {
+  static wpi::mutex mutex;
+  return mutex;
+}
+
+using Registry = std::vector<std::weak_ptr<SafeThreadBase>>;
+
+// accessed via the std::atomic_load/atomic_store free functions; libc++
+// doesn't provide std::atomic<std::shared_ptr>
+static std::shared_ptr<const Registry>& GetRegistry() {
+  static std::shared_ptr<const Registry> registry;
+  return registry;
+}
+
+static void RegisterSafeThread(const std::shared_ptr<SafeThreadBase>& thr) {
+  std::scoped_lock lock{GetRegistryMutex()};
+  auto updated = std::make_shared<Registry>();
+  if (auto current = std::atomic_load_explicit(&GetRegistry(),
+                                               std::memory_order_acquire)) {
+    for (auto&& weak : *current) {
+      if (!weak.expired()) {
+        updated->emplace_back(weak);
+      }
+    }
+  }
+  updated->emplace_back(thr);
+  std::atomic_store_explicit(
+      &GetRegistry(), std::shared_ptr<const Registry>{std::move(updated)},
+      std::memory_order_release);
+}
+
+std::vector<SafeThreadTelemetry> wpi::GetSafeThreadTelemetry() {
+  std::vector<SafeThreadTelemetry> rv;
+  auto snapshot = std::atomic_load_explicit(&GetRegistry(),
+                                            std::memory_order_acquire);
+  if (!snapshot) {
+    return rv;
+  }
+  for (auto&& weak : *snapshot) {
+    if (auto thr = weak.lock()) {
+      rv.emplace_back(SafeThreadTelemetry{
+          thr->m_telemetryName,
+          thr->m_iterations.load(std::memory_order_relaxed),
+          thr->m_lastWakeTime.load(std::memory_order_relaxed),
+          thr->m_queueDepth.load(std::memory_order_relaxed)});
+    }
+  }
+  return rv;
+}
+
 void SafeThread::Stop() {
   m_active = false;
   m_cond.notify_all();
@@ -43,8 +98,20 @@ void detail::SafeThreadOwnerBase::Start(std::shared_ptr<SafeThreadBase> thr) {
   if (auto thr = m_thread.lock()) {
     return;
   }
-  m_stdThread = std::thread([=] { thr->Main(); });
+  m_stdThread = std::thread([=] {
+    std::string name{thr->GetTelemetryName()};
+    if (!name.empty()) {
+      RegisterCurrentThread(name);
+    }
+    thr->Main();
+    if (!name.empty()) {
+      UnregisterCurrentThread();
+    }
+  });
   thr->m_threadId = m_stdThread.get_id();
+  if (!thr->GetTelemetryName().empty()) {
+    RegisterSafeThread(thr);
+  }
   m_thread = thr;
 }
 
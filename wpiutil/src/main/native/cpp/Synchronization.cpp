@@ -5,6 +5,7 @@
 #include "wpi/Synchronization.h"
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <cstring>
 #include <mutex>
@@ -21,19 +22,46 @@ static std::atomic_bool gShutdown{false};
 
 namespace {
 
+// Each waiting thread gets its own condition variable; signalers notify the
+// waiters registered on the object instead of a shared cv, so a wakeup only
+// involves the signaler and the threads actually waiting on that object.
+struct Waiter {
+  wpi::mutex mutex;
+  wpi::condition_variable cv;
+  bool notified{false};
+};
+
 struct State {
   int signaled{0};
   bool autoReset{false};
-  wpi::SmallVector<wpi::condition_variable*, 2> waiters;
+  wpi::SmallVector<Waiter*, 2> waiters;
+};
+
+// Handle state is sharded so signaling one object only contends with other
+// objects that hash to the same shard, rather than serializing every event
+// and semaphore in the process on a single global lock.
+constexpr uint32_t kNumShards = 16;
+
+struct Shard {
+  wpi::mutex mutex;
+  wpi::DenseMap<WPI_Handle, State> states;
 };
 
 struct HandleManager {
   ~HandleManager() { gShutdown = true; }
 
-  wpi::mutex mutex;
+  // only guards index allocation; handle state lives in the shards
+  wpi::mutex idMutex;
   wpi::UidVector<int, 8> eventIds;
   wpi::UidVector<int, 8> semaphoreIds;
-  wpi::DenseMap<WPI_Handle, State> states;
+
+  std::array<Shard, kNumShards> shards;
+
+  Shard& GetShard(WPI_Handle handle) {
+    // Fibonacci hash of the handle; the low bits are a densely allocated
+    // index, so multiplying spreads consecutive handles across shards
+    return shards[(handle * 2654435769u) >> 28];
+  }
 };
 
 }  // namespace
@@ -43,18 +71,31 @@ static HandleManager& GetManager() {
   return manager;
 }
 
+static void NotifyWaiter(Waiter* waiter) {
+  {
+    std::scoped_lock lock{waiter->mutex};
+    waiter->notified = true;
+  }
+  waiter->cv.notify_all();
+}
+
 WPI_EventHandle wpi::CreateEvent(bool manualReset, bool initialState) {
   auto& manager = GetManager();
   if (gShutdown) {
     return {};
   }
-  std::scoped_lock lock{manager.mutex};
 
-  auto index = manager.eventIds.emplace_back(0);
+  size_t index;
+  {
+    std::scoped_lock lock{manager.idMutex};
+    index = manager.eventIds.emplace_back(0);
+  }
   WPI_EventHandle handle = (kHandleTypeEvent << 24) | (index & 0xffffff);
 
   // configure state data
-  auto& state = manager.states[handle];
+  auto& shard = manager.GetShard(handle);
+  std::scoped_lock lock{shard.mutex};
+  auto& state = shard.states[handle];
   state.signaled = initialState ? 1 : 0;
   state.autoReset = !manualReset;
 
@@ -72,7 +113,7 @@ void wpi::DestroyEvent(WPI_EventHandle handle) {
   if (gShutdown) {
     return;
   }
-  std::scoped_lock lock{manager.mutex};
+  std::scoped_lock lock{manager.idMutex};
   manager.eventIds.erase(handle & 0xffffff);
 }
 
@@ -97,13 +138,18 @@ WPI_SemaphoreHandle wpi::CreateSemaphore(int initialCount, int maximumCount) {
   if (gShutdown) {
     return {};
   }
-  std::scoped_lock lock{manager.mutex};
 
-  auto index = manager.semaphoreIds.emplace_back(maximumCount);
+  size_t index;
+  {
+    std::scoped_lock lock{manager.idMutex};
+    index = manager.semaphoreIds.emplace_back(maximumCount);
+  }
   WPI_EventHandle handle = (kHandleTypeSemaphore << 24) | (index & 0xffffff);
 
   // configure state data
-  auto& state = manager.states[handle];
+  auto& shard = manager.GetShard(handle);
+  std::scoped_lock lock{shard.mutex};
+  auto& state = shard.states[handle];
   state.signaled = initialCount;
   state.autoReset = true;
 
@@ -121,7 +167,7 @@ void wpi::DestroySemaphore(WPI_SemaphoreHandle handle) {
   if (gShutdown) {
     return;
   }
-  std::scoped_lock lock{manager.mutex};
+  std::scoped_lock lock{manager.idMutex};
   manager.eventIds.erase(handle & 0xffffff);
 }
 
@@ -139,13 +185,20 @@ bool wpi::ReleaseSemaphore(WPI_SemaphoreHandle handle, int releaseCount,
   if (gShutdown) {
     return true;
   }
-  std::scoped_lock lock{manager.mutex};
-  auto it = manager.states.find(handle);
-  if (it == manager.states.end()) {
+
+  int maxCount;
+  {
+    std::scoped_lock lock{manager.idMutex};
+    maxCount = manager.eventIds[index];
+  }
+
+  auto& shard = manager.GetShard(handle);
+  std::scoped_lock lock{shard.mutex};
+  auto it = shard.states.find(handle);
+  if (it == shard.states.end()) {
     return false;
   }
   auto& state = it->second;
-  int maxCount = manager.eventIds[index];
   if (prevCount) {
     *prevCount = state.signaled;
   }
@@ -154,7 +207,7 @@ bool wpi::ReleaseSemaphore(WPI_SemaphoreHandle handle, int releaseCount,
   }
   state.signaled += releaseCount;
   for (auto& waiter : state.waiters) {
-    waiter->notify_all();
+    NotifyWaiter(waiter);
   }
   return true;
 }
@@ -186,16 +239,20 @@ std::span<WPI_Handle> wpi::WaitForObjects(std::span<const WPI_Handle> handles,
     *timedOut = false;
     return {};
   }
-  std::unique_lock lock{manager.mutex};
-  wpi::condition_variable cv;
+  Waiter waiter;
   bool addedWaiters = false;
   bool timedOutVal = false;
   size_t count = 0;
 
+  auto timeoutTime = std::chrono::steady_clock::now() +
+                     std::chrono::duration<double>(timeout < 0 ? 0 : timeout);
+
   for (;;) {
     for (auto handle : handles) {
-      auto it = manager.states.find(handle);
-      if (it == manager.states.end()) {
+      auto& shard = manager.GetShard(handle);
+      std::scoped_lock lock{shard.mutex};
+      auto it = shard.states.find(handle);
+      if (it == shard.states.end()) {
         if (count < signaled.size()) {
           // treat a non-existent handle as signaled, but set the error bit
           signaled[count++] = handle | 0x80000000ul;
@@ -228,26 +285,33 @@ std::span<WPI_Handle> wpi::WaitForObjects(std::span<const WPI_Handle> handles,
     if (!addedWaiters) {
       addedWaiters = true;
       for (auto handle : handles) {
-        auto& state = manager.states[handle];
-        state.waiters.emplace_back(&cv);
+        auto& shard = manager.GetShard(handle);
+        std::scoped_lock lock{shard.mutex};
+        shard.states[handle].waiters.emplace_back(&waiter);
       }
+      // rescan before blocking; a signal delivered between the scan above
+      // and registration wouldn't have seen our waiter entry
+      continue;
     }
 
+    std::unique_lock waitLock{waiter.mutex};
     if (timeout < 0) {
-      cv.wait(lock);
-    } else {
-      auto timeoutTime = std::chrono::steady_clock::now() +
-                         std::chrono::duration<double>(timeout);
-      if (cv.wait_until(lock, timeoutTime) == std::cv_status::timeout) {
-        timedOutVal = true;
-      }
+      waiter.cv.wait(waitLock, [&] { return waiter.notified; });
+    } else if (!waiter.cv.wait_until(waitLock, timeoutTime,
+                                     [&] { return waiter.notified; })) {
+      timedOutVal = true;
     }
+    // a signal after this point just leaves notified set, which results in a
+    // harmless extra rescan on the next wait
+    waiter.notified = false;
   }
 
   if (addedWaiters) {
     for (auto handle : handles) {
-      auto& state = manager.states[handle];
-      auto it = std::find(state.waiters.begin(), state.waiters.end(), &cv);
+      auto& shard = manager.GetShard(handle);
+      std::scoped_lock lock{shard.mutex};
+      auto& state = shard.states[handle];
+      auto it = std::find(state.waiters.begin(), state.waiters.end(), &waiter);
       if (it != state.waiters.end()) {
         state.waiters.erase(it);
       }
@@ -267,8 +331,9 @@ void wpi::CreateSignalObject(WPI_Handle handle, bool manualReset,
   if (gShutdown) {
     return;
   }
-  std::scoped_lock lock{manager.mutex};
-  auto& state = manager.states[handle];
+  auto& shard = manager.GetShard(handle);
+  std::scoped_lock lock{shard.mutex};
+  auto& state = shard.states[handle];
   state.signaled = initialState ? 1 : 0;
   state.autoReset = !manualReset;
 }
@@ -278,19 +343,21 @@ void wpi::SetSignalObject(WPI_Handle handle) {
   if (gShutdown) {
     return;
   }
-  std::scoped_lock lock{manager.mutex};
-  auto it = manager.states.find(handle);
-  if (it == manager.states.end()) {
+  auto& shard = manager.GetShard(handle);
+  std::scoped_lock lock{shard.mutex};
+  auto it = shard.states.find(handle);
+  if (it == shard.states.end()) {
     return;
   }
   auto& state = it->second;
   state.signaled = 1;
+  // notify every registered waiter, even for auto-reset events: the first
+  // entry may belong to a waiter that was already satisfied by a different
+  // handle and is about to deregister, and a notification it consumes
+  // without rescanning would otherwise be lost.  A spuriously woken waiter
+  // just rescans and blocks again.
   for (auto& waiter : state.waiters) {
-    waiter->notify_all();
-    if (state.autoReset) {
-      // expect the first waiter to reset it
-      break;
-    }
+    NotifyWaiter(waiter);
   }
 }
 
@@ -299,9 +366,10 @@ void wpi::ResetSignalObject(WPI_Handle handle) {
   if (gShutdown) {
     return;
   }
-  std::scoped_lock lock{manager.mutex};
-  auto it = manager.states.find(handle);
-  if (it != manager.states.end()) {
+  auto& shard = manager.GetShard(handle);
+  std::scoped_lock lock{shard.mutex};
+  auto it = shard.states.find(handle);
+  if (it != shard.states.end()) {
     it->second.signaled = 0;
   }
 }
@@ -311,15 +379,16 @@ void wpi::DestroySignalObject(WPI_Handle handle) {
   if (gShutdown) {
     return;
   }
-  std::scoped_lock lock{manager.mutex};
+  auto& shard = manager.GetShard(handle);
+  std::scoped_lock lock{shard.mutex};
 
-  auto it = manager.states.find(handle);
-  if (it != manager.states.end()) {
+  auto it = shard.states.find(handle);
+  if (it != shard.states.end()) {
     // wake up any waiters
     for (auto& waiter : it->second.waiters) {
-      waiter->notify_all();
+      NotifyWaiter(waiter);
     }
-    manager.states.erase(it);
+    shard.states.erase(it);
   }
 }
 
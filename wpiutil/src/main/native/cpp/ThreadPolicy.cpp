@@ -0,0 +1,170 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "wpi/ThreadPolicy.h"
+
+#include <thread>
+#include <utility>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "wpi/mutex.h"
+
+using namespace wpi;
+
+namespace {
+
+struct ThreadEntry {
+  std::string name;
+  std::thread::id id;
+#ifdef __linux__
+  pthread_t handle;
+#endif
+};
+
+struct PatternPolicy {
+  std::string pattern;
+  ThreadPolicy policy;
+};
+
+struct Registry {
+  wpi::mutex mutex;
+  std::vector<ThreadEntry> threads;
+  std::vector<PatternPolicy> policies;
+};
+
+}  // namespace
+
+static Registry& GetRegistry() {
+  static Registry registry;
+  return registry;
+}
+
+// Greedy wildcard match; '*' matches any (possibly empty) sequence of
+// characters, everything else matches literally.
+static bool MatchPattern(std::string_view pattern, std::string_view name) {
+  size_t p = 0;
+  size_t n = 0;
+  size_t star = std::string_view::npos;
+  size_t mark = 0;
+  while (n < name.size()) {
+    if (p < pattern.size() && pattern[p] == '*') {
+      star = p++;
+      mark = n;
+    } else if (p < pattern.size() && pattern[p] == name[n]) {
+      ++p;
+      ++n;
+    } else if (star != std::string_view::npos) {
+      p = star + 1;
+      n = ++mark;
+    } else {
+      return false;
+    }
+  }
+  while (p < pattern.size() && pattern[p] == '*') {
+    ++p;
+  }
+  return p == pattern.size();
+}
+
+static bool ApplyPolicy(const ThreadEntry& entry, const ThreadPolicy& policy) {
+#ifdef __linux__
+  bool ok = true;
+  sched_param sch{};
+  sch.sched_priority = policy.realTime ? policy.priority : 0;
+  if (pthread_setschedparam(entry.handle,
+                            policy.realTime ? SCHED_FIFO : SCHED_OTHER,
+                            &sch) != 0) {
+    ok = false;
+  }
+  if (policy.affinityMask != 0) {
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    for (int cpu = 0; cpu < 64; ++cpu) {
+      if ((policy.affinityMask & (1ULL << cpu)) != 0) {
+        CPU_SET(cpu, &cpuset);
+      }
+    }
+    if (pthread_setaffinity_np(entry.handle, sizeof(cpuset), &cpuset) != 0) {
+      ok = false;
+    }
+  }
+  return ok;
+#else
+  return false;
+#endif
+}
+
+void wpi::RegisterCurrentThread(std::string_view name) {
+  ThreadEntry entry;
+  entry.name = name;
+  entry.id = std::this_thread::get_id();
+#ifdef __linux__
+  entry.handle = pthread_self();
+  // OS-level thread names are limited to 15 characters plus the terminator
+  pthread_setname_np(entry.handle, entry.name.substr(0, 15).c_str());
+#endif
+
+  auto& registry = GetRegistry();
+  std::scoped_lock lock{registry.mutex};
+  // Most recently set matching pattern wins
+  const ThreadPolicy* match = nullptr;
+  for (auto&& pp : registry.policies) {
+    if (MatchPattern(pp.pattern, entry.name)) {
+      match = &pp.policy;
+    }
+  }
+  if (match) {
+    ApplyPolicy(entry, *match);
+  }
+  registry.threads.emplace_back(std::move(entry));
+}
+
+void wpi::UnregisterCurrentThread() {
+  auto id = std::this_thread::get_id();
+  auto& registry = GetRegistry();
+  std::scoped_lock lock{registry.mutex};
+  std::erase_if(registry.threads,
+                [&](const ThreadEntry& entry) { return entry.id == id; });
+}
+
+bool wpi::SetThreadPolicy(std::string_view pattern,
+                          const ThreadPolicy& policy) {
+  auto& registry = GetRegistry();
+  std::scoped_lock lock{registry.mutex};
+  bool found = false;
+  for (auto&& pp : registry.policies) {
+    if (pp.pattern == pattern) {
+      pp.policy = policy;
+      found = true;
+      break;
+    }
+  }
+  if (!found) {
+    registry.policies.emplace_back(PatternPolicy{std::string{pattern}, policy});
+  }
+  bool ok = true;
+  for (auto&& entry : registry.threads) {
+    if (MatchPattern(pattern, entry.name)) {
+      if (!ApplyPolicy(entry, policy)) {
+        ok = false;
+      }
+    }
+  }
+  return ok;
+}
+
+std::vector<std::string> wpi::GetRegisteredThreadNames() {
+  auto& registry = GetRegistry();
+  std::scoped_lock lock{registry.mutex};
+  std::vector<std::string> rv;
+  rv.reserve(registry.threads.size());
+  for (auto&& entry : registry.threads) {
+    rv.emplace_back(entry.name);
+  }
+  return rv;
+}
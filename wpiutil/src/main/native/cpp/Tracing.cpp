@@ -0,0 +1,165 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "wpi/Tracing.h"
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+#include "fmt/format.h"
+#include "wpi/DataLog.h"
+#include "wpi/Endian.h"
+#include "wpi/SmallVector.h"
+#include "wpi/mutex.h"
+#include "wpi/timestamp.h"
+
+using namespace wpi::tracing;
+
+namespace {
+
+// ring size per thread; must be a power of two
+constexpr uint64_t kRingSize = 8192;
+
+// Single-producer ring buffer.  The owning thread writes the slot and then
+// publishes it with a release store of the count; drains read the count with
+// acquire, copy, and re-read the count to discard any slots the producer may
+// have overwritten during the copy (seqlock style).  This keeps the record
+// path to a timestamp read and a slot write, with no locks or CAS loops.
+struct Ring {
+  uint64_t threadId;
+  std::atomic<uint64_t> count{0};
+  uint64_t drained{0};  // consumer position; guarded by the registry mutex
+  TraceEvent events[kRingSize];
+};
+
+struct Registry {
+  wpi::mutex mutex;
+  // rings are retained after thread exit so late drains still see the events
+  std::vector<std::unique_ptr<Ring>> rings;
+  uint64_t nextThreadId{0};
+};
+
+Registry& GetRegistry() {
+  static Registry* registry = new Registry;  // never destroyed
+  return *registry;
+}
+
+std::atomic_bool gEnabled{false};
+
+Ring& GetThreadRing() {
+  thread_local Ring* ring = [] {
+    auto r = std::make_unique<Ring>();
+    auto& reg = GetRegistry();
+    std::scoped_lock lock{reg.mutex};
+    r->threadId = reg.nextThreadId++;
+    reg.rings.emplace_back(std::move(r));
+    return reg.rings.back().get();
+  }();
+  return *ring;
+}
+
+void Record(const char* name, bool begin) {
+  auto& ring = GetThreadRing();
+  uint64_t count = ring.count.load(std::memory_order_relaxed);
+  auto& event = ring.events[count & (kRingSize - 1)];
+  event.time = wpi::Now();
+  event.name = name;
+  event.begin = begin;
+  ring.count.store(count + 1, std::memory_order_release);
+}
+
+}  // namespace
+
+void wpi::tracing::SetEnabled(bool enabled) {
+  gEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool wpi::tracing::IsEnabled() {
+  return gEnabled.load(std::memory_order_relaxed);
+}
+
+Span::Span(const char* name) {
+  if (!gEnabled.load(std::memory_order_relaxed)) {
+    m_name = nullptr;
+    return;
+  }
+  m_name = name;
+  Record(name, true);
+}
+
+Span::~Span() {
+  if (m_name) {
+    Record(m_name, false);
+  }
+}
+
+std::vector<ThreadTrace> wpi::tracing::Drain() {
+  std::vector<ThreadTrace> rv;
+  auto& reg = GetRegistry();
+  std::scoped_lock lock{reg.mutex};
+  for (auto&& ring : reg.rings) {
+    uint64_t end = ring->count.load(std::memory_order_acquire);
+    uint64_t start = end > kRingSize ? end - kRingSize : 0;
+    if (start < ring->drained) {
+      start = ring->drained;
+    }
+    if (start == end) {
+      continue;
+    }
+    ThreadTrace trace;
+    trace.threadId = ring->threadId;
+    trace.events.reserve(end - start);
+    for (uint64_t i = start; i < end; ++i) {
+      trace.events.push_back(ring->events[i & (kRingSize - 1)]);
+    }
+    // discard any events the thread overwrote while we were copying
+    uint64_t end2 = ring->count.load(std::memory_order_acquire);
+    uint64_t valid = end2 > kRingSize ? end2 - kRingSize : 0;
+    if (valid > start) {
+      trace.events.erase(trace.events.begin(),
+                         trace.events.begin() + (valid - start));
+    }
+    ring->drained = end;
+    if (!trace.events.empty()) {
+      rv.emplace_back(std::move(trace));
+    }
+  }
+  return rv;
+}
+
+void wpi::tracing::WriteDataLog(log::DataLog& log, int entry) {
+  wpi::SmallVector<uint8_t, 64> buf;
+  for (auto&& trace : Drain()) {
+    for (auto&& event : trace.events) {
+      buf.clear();
+      buf.push_back(event.begin ? 'B' : 'E');
+      buf.resize(9);
+      wpi::support::endian::write64le(&buf[1], trace.threadId);
+      const char* name = event.name;
+      while (*name != '\0') {
+        buf.push_back(static_cast<uint8_t>(*name++));
+      }
+      log.AppendRaw(entry, buf, event.time);
+    }
+  }
+}
+
+std::string wpi::tracing::ExportChromeTrace() {
+  std::string rv = "{\"traceEvents\":[";
+  bool first = true;
+  for (auto&& trace : Drain()) {
+    for (auto&& event : trace.events) {
+      if (!first) {
+        rv += ',';
+      }
+      first = false;
+      rv += fmt::format(
+          "{{\"name\":\"{}\",\"ph\":\"{}\",\"ts\":{},\"pid\":0,\"tid\":{}}}",
+          event.name, event.begin ? 'B' : 'E', event.time, trace.threadId);
+    }
+  }
+  rv += "]}";
+  return rv;
+}
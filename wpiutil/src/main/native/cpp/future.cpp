@@ -74,7 +74,7 @@ void PromiseFactory<void>::SetThen(uint64_t request, uint64_t outRequest,
     lock.unlock();
     return func(outRequest);
   }
-  m_thens.emplace_back(request, outRequest, func);
+  m_thens.emplace_back(request, outRequest, std::move(func));
 }
 
 bool PromiseFactory<void>::IsReady(uint64_t request) noexcept {
@@ -4,10 +4,14 @@
 
 #include "wpi/sendable/SendableRegistry.h"
 
+#include <iterator>
 #include <memory>
+#include <new>
+#include <vector>
 
 #include "fmt/format.h"
 #include "wpi/DenseMap.h"
+#include "wpi/SmallString.h"
 #include "wpi/SmallVector.h"
 #include "wpi/UidVector.h"
 #include "wpi/mutex.h"
@@ -20,26 +24,74 @@ namespace {
 struct Component {
   Sendable* sendable = nullptr;
   std::unique_ptr<SendableBuilder> builder;
-  std::string name;
-  std::string subsystem = "Ungrouped";
+  // typical names ("Gyro[0]", "Ungrouped") fit inline, avoiding a heap
+  // allocation per component at startup
+  SmallString<24> name;
+  SmallString<24> subsystem{"Ungrouped"};
   Sendable* parent = nullptr;
   bool liveWindow = false;
   wpi::SmallVector<std::shared_ptr<void>, 2> data;
 
   void SetName(std::string_view moduleType, int channel) {
-    name = fmt::format("{}[{}]", moduleType, channel);
+    name.clear();
+    fmt::format_to(std::back_inserter(name), "{}[{}]", moduleType, channel);
   }
 
   void SetName(std::string_view moduleType, int moduleNumber, int channel) {
-    name = fmt::format("{}[{},{}]", moduleType, moduleNumber, channel);
+    name.clear();
+    fmt::format_to(std::back_inserter(name), "{}[{},{}]", moduleType,
+                   moduleNumber, channel);
   }
 };
 
+// Chunked pool for Component structs.  Components are placement-constructed
+// into contiguous chunks, so registering a few hundred sendables at robot
+// startup makes a handful of chunk allocations instead of one heap
+// allocation each, and iteration (ForeachLiveWindow) walks mostly
+// sequential memory.  Freed slots are reused before a new chunk is added.
+class ComponentPool {
+ public:
+  struct Deleter {
+    ComponentPool* pool;
+    void operator()(Component* comp) const { pool->Release(comp); }
+  };
+
+  std::unique_ptr<Component, Deleter> Allocate() {
+    if (m_free.empty()) {
+      auto& chunk = *m_chunks.emplace_back(std::make_unique<Chunk>());
+      for (size_t i = kChunkSize; i-- != 0;) {
+        m_free.push_back(
+            reinterpret_cast<Component*>(chunk.storage + i * sizeof(Component)));
+      }
+    }
+    Component* slot = m_free.back();
+    m_free.pop_back();
+    return {new (slot) Component, Deleter{this}};
+  }
+
+ private:
+  void Release(Component* comp) {
+    comp->~Component();
+    m_free.push_back(comp);
+  }
+
+  static constexpr size_t kChunkSize = 64;
+  struct Chunk {
+    alignas(Component) unsigned char storage[kChunkSize * sizeof(Component)];
+  };
+  std::vector<std::unique_ptr<Chunk>> m_chunks;
+  std::vector<Component*> m_free;
+};
+
 struct SendableRegistryInst {
   wpi::recursive_mutex mutex;
 
   std::function<std::unique_ptr<SendableBuilder>()> liveWindowFactory;
-  wpi::UidVector<std::unique_ptr<Component>, 32> components;
+  // declared before components so outstanding components are released into
+  // the pool before the pool itself is destroyed
+  ComponentPool componentPool;
+  wpi::UidVector<std::unique_ptr<Component, ComponentPool::Deleter>, 32>
+      components;
   wpi::DenseMap<void*, SendableRegistry::UID> componentMap;
   int nextDataHandle = 0;
 
@@ -51,7 +103,7 @@ Component& SendableRegistryInst::GetOrAdd(void* sendable,
                                           SendableRegistry::UID* uid) {
   SendableRegistry::UID& compUid = componentMap[sendable];
   if (compUid == 0) {
-    compUid = components.emplace_back(std::make_unique<Component>()) + 1;
+    compUid = components.emplace_back(componentPool.Allocate()) + 1;
   }
   if (uid) {
     *uid = compUid;
@@ -88,7 +140,7 @@ void SendableRegistry::Add(Sendable* sendable, std::string_view name) {
   std::scoped_lock lock(inst.mutex);
   auto& comp = inst.GetOrAdd(sendable);
   comp.sendable = sendable;
-  comp.name = name;
+  comp.name.assign(name);
 }
 
 void SendableRegistry::Add(Sendable* sendable, std::string_view moduleType,
@@ -115,8 +167,8 @@ void SendableRegistry::Add(Sendable* sendable, std::string_view subsystem,
   std::scoped_lock lock(inst.mutex);
   auto& comp = inst.GetOrAdd(sendable);
   comp.sendable = sendable;
-  comp.name = name;
-  comp.subsystem = subsystem;
+  comp.name.assign(name);
+  comp.subsystem.assign(subsystem);
 }
 
 void SendableRegistry::AddLW(Sendable* sendable, std::string_view name) {
@@ -128,7 +180,7 @@ void SendableRegistry::AddLW(Sendable* sendable, std::string_view name) {
     comp.builder = inst.liveWindowFactory();
   }
   comp.liveWindow = true;
-  comp.name = name;
+  comp.name.assign(name);
 }
 
 void SendableRegistry::AddLW(Sendable* sendable, std::string_view moduleType,
@@ -167,8 +219,8 @@ void SendableRegistry::AddLW(Sendable* sendable, std::string_view subsystem,
     comp.builder = inst.liveWindowFactory();
   }
   comp.liveWindow = true;
-  comp.name = name;
-  comp.subsystem = subsystem;
+  comp.name.assign(name);
+  comp.subsystem.assign(subsystem);
 }
 
 void SendableRegistry::AddChild(Sendable* parent, Sendable* child) {
@@ -242,7 +294,7 @@ std::string SendableRegistry::GetName(const Sendable* sendable) {
   if (it == inst.componentMap.end() || !inst.components[it->getSecond() - 1]) {
     return {};
   }
-  return inst.components[it->getSecond() - 1]->name;
+  return std::string{inst.components[it->getSecond() - 1]->name.str()};
 }
 
 void SendableRegistry::SetName(Sendable* sendable, std::string_view name) {
@@ -252,7 +304,7 @@ void SendableRegistry::SetName(Sendable* sendable, std::string_view name) {
   if (it == inst.componentMap.end() || !inst.components[it->getSecond() - 1]) {
     return;
   }
-  inst.components[it->getSecond() - 1]->name = name;
+  inst.components[it->getSecond() - 1]->name.assign(name);
 }
 
 void SendableRegistry::SetName(Sendable* sendable, std::string_view moduleType,
@@ -287,8 +339,8 @@ void SendableRegistry::SetName(Sendable* sendable, std::string_view subsystem,
     return;
   }
   auto& comp = *inst.components[it->getSecond() - 1];
-  comp.name = name;
-  comp.subsystem = subsystem;
+  comp.name.assign(name);
+  comp.subsystem.assign(subsystem);
 }
 
 std::string SendableRegistry::GetSubsystem(const Sendable* sendable) {
@@ -298,7 +350,7 @@ std::string SendableRegistry::GetSubsystem(const Sendable* sendable) {
   if (it == inst.componentMap.end() || !inst.components[it->getSecond() - 1]) {
     return {};
   }
-  return inst.components[it->getSecond() - 1]->subsystem;
+  return std::string{inst.components[it->getSecond() - 1]->subsystem.str()};
 }
 
 void SendableRegistry::SetSubsystem(Sendable* sendable,
@@ -309,7 +361,7 @@ void SendableRegistry::SetSubsystem(Sendable* sendable,
   if (it == inst.componentMap.end() || !inst.components[it->getSecond() - 1]) {
     return;
   }
-  inst.components[it->getSecond() - 1]->subsystem = subsystem;
+  inst.components[it->getSecond() - 1]->subsystem.assign(subsystem);
 }
 
 int SendableRegistry::GetDataHandle() {
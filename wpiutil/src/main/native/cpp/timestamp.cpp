@@ -15,6 +15,15 @@
 #include <chrono>
 #endif
 
+#if defined(__linux__) && (defined(__x86_64__) || defined(__aarch64__))
+#define WPI_TIMESTAMP_TSC_FAST_PATH
+#include <mutex>
+#ifdef __x86_64__
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+#endif
+
 // offset in microseconds
 static uint64_t time_since_epoch() noexcept {
 #ifdef _WIN32
@@ -72,6 +81,184 @@ static const uint64_t offset_val = timestamp();
 static const uint64_t frequency_val = update_frequency();
 #endif
 
+#ifdef WPI_TIMESTAMP_TSC_FAST_PATH
+
+// Calibrated cycle-counter fast path.  Reading the OS clock costs a vDSO
+// call (or worse) per timestamp; the CPU cycle counter is a few nanoseconds
+// of pure userspace arithmetic.  Now() maps the cycle counter to
+// microseconds with a (scale, offset) pair calibrated against the OS clock
+// and published via a seqlock, and resyncs the pair about once a second
+// (piggybacked on a Now() call, so no background thread is needed).  Only
+// used when the counter is invariant (constant rate, synchronized across
+// cores): always true for cntvct_el0 on aarch64, checked via CPUID on x86.
+
+static uint64_t now_reference() noexcept {
+  return zerotime_val + timestamp() - offset_val;
+}
+
+static uint64_t read_cycle_counter() noexcept {
+#ifdef __x86_64__
+  return __rdtsc();
+#else
+  uint64_t cntvct;
+  asm volatile("mrs %0, cntvct_el0" : "=r"(cntvct));
+  return cntvct;
+#endif
+}
+
+static bool has_invariant_cycle_counter() noexcept {
+#ifdef __x86_64__
+  unsigned int eax, ebx, ecx, edx;
+  return __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) != 0 &&
+         (edx & (1u << 8)) != 0;  // invariant TSC
+#else
+  return true;  // architecturally constant frequency
+#endif
+}
+
+namespace {
+struct TscCalibration {
+  std::atomic<uint64_t> tscBase{0};
+  std::atomic<uint64_t> usBase{0};
+  // microseconds per tick, 32.32 fixed point
+  std::atomic<uint64_t> scale{0};
+  std::atomic<uint64_t> nextResync{0};
+};
+enum TscState { kTscUninit, kTscWarmup, kTscActive, kTscDisabled };
+}  // namespace
+
+// __int128 is a GCC/Clang extension (the fast path is only enabled on
+// Linux x86-64/aarch64, so it's always available); __extension__ keeps it
+// legal under -pedantic -Werror
+__extension__ typedef unsigned __int128 tsc_uint128;
+
+// The reference clock is only microsecond-granular, so the relative error of
+// the frequency estimate is roughly 1/baseline: stay on the reference clock
+// until a full second of baseline has accumulated (~ppm scale accuracy)
+// rather than switching over early with a scale that can be off by 0.1% or
+// more and accumulate milliseconds of error before the first resync.
+static constexpr uint64_t kTscWarmupUs = 1000000;  // calibration baseline
+static constexpr uint64_t kTscResyncUs = 1000000;  // resync period
+
+static std::atomic<int> tsc_state{kTscUninit};
+static std::atomic<uint32_t> tsc_seq{0};  // seqlock generation; odd = writing
+static TscCalibration tsc_calib;
+static std::mutex tsc_mutex;  // serializes calibration updates
+static uint64_t tsc_init;     // first cycle counter sample
+static uint64_t us_init;      // reference time at tsc_init
+
+// must be called with tsc_mutex held
+static void tsc_publish(uint64_t tscBase, uint64_t usBase, uint64_t scale,
+                        uint64_t nextResync) noexcept {
+  tsc_seq.fetch_add(1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  tsc_calib.tscBase.store(tscBase, std::memory_order_relaxed);
+  tsc_calib.usBase.store(usBase, std::memory_order_relaxed);
+  tsc_calib.scale.store(scale, std::memory_order_relaxed);
+  tsc_calib.nextResync.store(nextResync, std::memory_order_relaxed);
+  tsc_seq.fetch_add(1, std::memory_order_release);
+}
+
+static uint64_t tsc_evaluate(uint64_t tscBase, uint64_t usBase, uint64_t scale,
+                             uint64_t tsc) noexcept {
+  uint64_t delta = tsc > tscBase ? tsc - tscBase : 0;
+  return usBase + static_cast<uint64_t>(
+                      (static_cast<tsc_uint128>(delta) * scale) >> 32);
+}
+
+static void tsc_resync() noexcept {
+  std::unique_lock lock{tsc_mutex, std::try_to_lock};
+  if (!lock) {
+    return;  // another thread is already resyncing
+  }
+  uint64_t ref = now_reference();
+  uint64_t tscNow = read_cycle_counter();
+  if (tscNow <= tsc_init || ref <= us_init) {
+    return;
+  }
+  // frequency estimate over the full baseline; gets better as uptime grows
+  uint64_t scale = static_cast<uint64_t>(
+      (static_cast<tsc_uint128>(ref - us_init) << 32) /
+      (tscNow - tsc_init));
+  // continue from the old mapping's current value (no step in either
+  // direction) and slew the accumulated error against the reference clock
+  // out over the next resync interval by biasing the scale: the published
+  // clock runs slightly fast or slow until it reconverges, but stays
+  // monotonic and never bakes the error in permanently
+  uint64_t oldVal = tsc_evaluate(
+      tsc_calib.tscBase.load(std::memory_order_relaxed),
+      tsc_calib.usBase.load(std::memory_order_relaxed),
+      tsc_calib.scale.load(std::memory_order_relaxed), tscNow);
+  int64_t err = static_cast<int64_t>(oldVal) - static_cast<int64_t>(ref);
+  // bound the correction to half the interval so the adjusted rate stays
+  // positive (and the slew bounded) even if the error is somehow huge
+  constexpr int64_t kMaxSlewUs = static_cast<int64_t>(kTscResyncUs / 2);
+  if (err > kMaxSlewUs) {
+    err = kMaxSlewUs;
+  } else if (err < -kMaxSlewUs) {
+    err = -kMaxSlewUs;
+  }
+  scale = static_cast<uint64_t>(
+      static_cast<tsc_uint128>(scale) *
+      static_cast<uint64_t>(static_cast<int64_t>(kTscResyncUs) - err) /
+      kTscResyncUs);
+  tsc_publish(tscNow, oldVal, scale, oldVal + kTscResyncUs);
+}
+
+static uint64_t tsc_warmup() noexcept {
+  uint64_t now = now_reference();
+  std::unique_lock lock{tsc_mutex, std::try_to_lock};
+  if (!lock) {
+    return now;
+  }
+  int state = tsc_state.load(std::memory_order_relaxed);
+  if (state == kTscUninit) {
+    if (!has_invariant_cycle_counter()) {
+      tsc_state.store(kTscDisabled, std::memory_order_release);
+      return now;
+    }
+    tsc_init = read_cycle_counter();
+    us_init = now;
+    tsc_state.store(kTscWarmup, std::memory_order_release);
+  } else if (state == kTscWarmup && now - us_init >= kTscWarmupUs) {
+    uint64_t tscNow = read_cycle_counter();
+    if (tscNow <= tsc_init) {
+      tsc_state.store(kTscDisabled, std::memory_order_release);
+      return now;
+    }
+    uint64_t scale = static_cast<uint64_t>(
+        (static_cast<tsc_uint128>(now - us_init) << 32) /
+        (tscNow - tsc_init));
+    tsc_publish(tscNow, now, scale, now + kTscResyncUs);
+    tsc_state.store(kTscActive, std::memory_order_release);
+  }
+  return now;
+}
+
+static uint64_t tsc_now() noexcept {
+  uint64_t tscBase, usBase, scale, nextResync;
+  for (;;) {
+    uint32_t seq = tsc_seq.load(std::memory_order_acquire);
+    if ((seq & 1) == 0) {
+      tscBase = tsc_calib.tscBase.load(std::memory_order_relaxed);
+      usBase = tsc_calib.usBase.load(std::memory_order_relaxed);
+      scale = tsc_calib.scale.load(std::memory_order_relaxed);
+      nextResync = tsc_calib.nextResync.load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (tsc_seq.load(std::memory_order_relaxed) == seq) {
+        break;
+      }
+    }
+  }
+  uint64_t now = tsc_evaluate(tscBase, usBase, scale, read_cycle_counter());
+  if (now >= nextResync) {
+    tsc_resync();
+  }
+  return now;
+}
+
+#endif  // WPI_TIMESTAMP_TSC_FAST_PATH
+
 uint64_t wpi::NowDefault() {
 #ifdef _WIN32
   assert(offset_val > 0u);
@@ -82,6 +269,15 @@ uint64_t wpi::NowDefault() {
   uint64_t delta_in_us = delta * 1000000ull / frequency_val;
   return delta_in_us + zerotime_val;
 #else
+#ifdef WPI_TIMESTAMP_TSC_FAST_PATH
+  int state = tsc_state.load(std::memory_order_acquire);
+  if (state == kTscActive) {
+    return tsc_now();
+  }
+  if (state != kTscDisabled) {
+    return tsc_warmup();
+  }
+#endif
   return zerotime_val + timestamp() - offset_val;
 #endif
 }
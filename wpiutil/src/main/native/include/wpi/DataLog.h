@@ -6,6 +6,7 @@
 
 #include <stdint.h>
 
+#include <atomic>
 #include <functional>
 #include <initializer_list>
 #include <memory>
@@ -13,6 +14,7 @@
 #include <string>
 #include <string_view>
 #include <thread>
+#include <type_traits>
 #include <vector>
 
 #include "wpi/DenseMap.h"
@@ -31,9 +33,16 @@ namespace impl {
 enum ControlRecordType {
   kControlStart = 0,
   kControlFinish,
-  kControlSetMetadata
+  kControlSetMetadata,
+  kControlIndex
 };
 
+// last 16 bytes of a complete indexed log: this magic followed by the
+// 8-byte little-endian file offset of the final index record (the bytes
+// live inside that record's payload, so older readers still parse it as
+// an ordinary record)
+inline constexpr char kIndexTrailerMagic[] = "WPILGIDX";
+
 }  // namespace impl
 
 /**
@@ -75,9 +84,14 @@ class DataLog final {
    * @param period time between automatic flushes to disk, in seconds;
    *               this is a time/storage tradeoff
    * @param extraHeader extra header data
+   * @param compress if true, log data is written as LZ4-compressed frames
+   *                 (one frame per flush); uses less disk space and bandwidth
+   *                 at a small CPU cost, but the file can only be read by
+   *                 readers that support compressed logs
    */
   explicit DataLog(std::string_view dir = "", std::string_view filename = "",
-                   double period = 0.25, std::string_view extraHeader = "");
+                   double period = 0.25, std::string_view extraHeader = "",
+                   bool compress = false);
 
   /**
    * Construct a new Data Log.  The log will be initially created with a
@@ -90,10 +104,14 @@ class DataLog final {
    * @param period time between automatic flushes to disk, in seconds;
    *               this is a time/storage tradeoff
    * @param extraHeader extra header data
+   * @param compress if true, log data is written as LZ4-compressed frames
+   *                 (one frame per flush); uses less disk space and bandwidth
+   *                 at a small CPU cost, but the file can only be read by
+   *                 readers that support compressed logs
    */
   explicit DataLog(wpi::Logger& msglog, std::string_view dir = "",
                    std::string_view filename = "", double period = 0.25,
-                   std::string_view extraHeader = "");
+                   std::string_view extraHeader = "", bool compress = false);
 
   /**
    * Construct a new Data Log that passes its output to the provided function
@@ -235,25 +253,51 @@ class DataLog final {
   void WriterThreadMain(
       std::function<void(std::span<const uint8_t> data)> write);
 
-  // must be called with m_mutex held
-  uint8_t* StartRecord(uint32_t entry, uint64_t timestamp, uint32_t payloadSize,
-                       size_t reserveSize);
-  uint8_t* Reserve(size_t size);
-  void AppendImpl(std::span<const uint8_t> data);
-  void AppendStringImpl(std::string_view str);
+  class Buffer;
+
+  // Outgoing data is buffered in shards so appends from different threads
+  // rarely contend on the same lock; each thread is assigned a shard on first
+  // append and the writer thread drains every shard on flush.  Record order
+  // across threads is unspecified (see class comment), but records appended
+  // from a single thread stay in order.
+  //
+  // Control records (Start/Finish/SetMetadata) go through a dedicated shard
+  // that is collected after the data shards but emitted ahead of them, so a
+  // Start record always reaches the file before any data record for its
+  // entry; Finish() additionally seals pending data into the control stream
+  // first so it cannot overtake earlier data for the entry (see
+  // CollectBuffers()).
+  static constexpr size_t kNumAppendShards = 8;
+  struct AppendShard {
+    mutable wpi::mutex mutex;
+    std::vector<Buffer> free;
+    std::vector<Buffer> outgoing;
+  };
+  AppendShard& GetAppendShard();
+
+  // moves every shard's outgoing buffers into toWrite in emission order
+  // (control shard first, then data shards)
+  void CollectBuffers(std::vector<Buffer>& toWrite);
+
+  // must be called with the shard mutex held
+  uint8_t* StartRecord(AppendShard& shard, uint32_t entry, uint64_t timestamp,
+                       uint32_t payloadSize, size_t reserveSize);
+  uint8_t* Reserve(AppendShard& shard, size_t size);
+  void AppendImpl(AppendShard& shard, std::span<const uint8_t> data);
+  void AppendStringImpl(AppendShard& shard, std::string_view str);
 
   wpi::Logger& m_msglog;
   mutable wpi::mutex m_mutex;
   wpi::condition_variable m_cond;
   bool m_active{true};
   bool m_doFlush{false};
-  bool m_paused{false};
+  std::atomic_bool m_paused{false};
+  bool m_compress{false};
   double m_period;
   std::string m_extraHeader;
   std::string m_newFilename;
-  class Buffer;
-  std::vector<Buffer> m_free;
-  std::vector<Buffer> m_outgoing;
+  AppendShard m_shards[kNumAppendShards];
+  AppendShard m_controlShard;
   struct EntryInfo {
     std::string type;
     int id{0};
@@ -693,4 +737,98 @@ class StringArrayLogEntry : public DataLogEntry {
   }
 };
 
+/**
+ * Builds a field-layout schema for a StructLogEntry.  The schema is stored as
+ * JSON in the entry's start-record metadata so log readers can decode the
+ * packed records without outside knowledge of the struct.
+ *
+ * Declare one field per struct member, in any order:
+ *
+ *     struct DriveState { double leftVolts; double rightVolts; bool ok; };
+ *     wpi::log::StructSchemaBuilder schema;
+ *     schema.AddField("leftVolts", "double", offsetof(DriveState, leftVolts))
+ *           .AddField("rightVolts", "double", offsetof(DriveState, rightVolts))
+ *           .AddField("ok", "boolean", offsetof(DriveState, ok));
+ */
+class StructSchemaBuilder {
+ public:
+  /**
+   * Adds a field to the schema.
+   *
+   * @param name field name
+   * @param type field type (e.g. "boolean", "int64", "float", "double")
+   * @param offset byte offset of the field within the struct (offsetof())
+   * @return this builder, for chaining
+   */
+  StructSchemaBuilder& AddField(std::string_view name, std::string_view type,
+                                size_t offset) {
+    if (!m_schema.empty()) {
+      m_schema += ',';
+    }
+    m_schema += "{\"name\":\"";
+    m_schema += name;
+    m_schema += "\",\"type\":\"";
+    m_schema += type;
+    m_schema += "\",\"offset\":";
+    m_schema += std::to_string(offset);
+    m_schema += '}';
+    return *this;
+  }
+
+  /**
+   * Builds the schema metadata string.
+   *
+   * @return JSON array of field descriptions
+   */
+  std::string Build() const { return '[' + m_schema + ']'; }
+
+ private:
+  std::string m_schema;
+};
+
+/**
+ * Log trivially copyable structs as single packed records.
+ *
+ * Appending logs the raw bytes of the struct with one AppendRaw() call, so a
+ * full snapshot of many signals is one contiguous record instead of one
+ * record per signal.  The field layout is published once in the entry's
+ * start-record metadata (see StructSchemaBuilder); readers use it to unpack
+ * the fields.
+ */
+template <typename T>
+  requires std::is_trivially_copyable_v<T> && std::is_standard_layout_v<T>
+class StructLogEntry : public DataLogEntry {
+ public:
+  StructLogEntry() = default;
+
+  /**
+   * Constructs a struct log entry.
+   *
+   * @param log data log
+   * @param name entry name
+   * @param typeString type name recorded in the entry's start record (e.g.
+   *                   "struct:DriveState")
+   * @param schema field-layout schema (from StructSchemaBuilder::Build()),
+   *               stored as the entry metadata
+   * @param timestamp entry creation timestamp (may be 0 to indicate now)
+   */
+  StructLogEntry(DataLog& log, std::string_view name,
+                 std::string_view typeString, std::string_view schema,
+                 int64_t timestamp = 0)
+      : DataLogEntry{log, name, typeString, schema, timestamp} {}
+
+  /**
+   * Appends a record to the log.
+   *
+   * @param value Value to record
+   * @param timestamp Time stamp (may be 0 to indicate now)
+   */
+  void Append(const T& value, int64_t timestamp = 0) {
+    m_log->AppendRaw(
+        m_entry,
+        {reinterpret_cast<const uint8_t*>(&value), sizeof(T)},
+        timestamp);
+  }
+};
+
 }  // namespace wpi::log
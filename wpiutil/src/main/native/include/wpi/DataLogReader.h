@@ -47,6 +47,26 @@ struct MetadataRecordData {
   std::string_view metadata;
 };
 
+/**
+ * Data contained in an index control record as periodically written by the
+ * DataLog writer thread.  Each index record describes the block of records
+ * written since the previous index record.  This can be read by calling
+ * DataLogRecord::GetIndexData().
+ */
+struct IndexRecordData {
+  /** File offset of the first record in the block. */
+  uint64_t blockStart;
+
+  /** File offset just past the last record in the block. */
+  uint64_t blockEnd;
+
+  /** File offset of the previous index record; 0 if this is the first. */
+  uint64_t prevIndex;
+
+  /** Entry IDs and corresponding record counts for the block. */
+  std::vector<std::pair<int, unsigned int>> entries;
+};
+
 /**
  * A record in the data log. May represent either a control record (entry == 0)
  * or a data record. Used only for reading (e.g. with DataLogReader).
@@ -115,6 +135,14 @@ class DataLogRecord {
    */
   bool IsSetMetadata() const;
 
+  /**
+   * Returns true if the record is an index control record. Use GetIndexData()
+   * to decode the contents.
+   *
+   * @return True if index control record, false otherwise.
+   */
+  bool IsIndex() const;
+
   /**
    * Decodes a start control record.
    *
@@ -139,6 +167,14 @@ class DataLogRecord {
    */
   bool GetSetMetadataData(MetadataRecordData* out) const;
 
+  /**
+   * Decodes an index control record.
+   *
+   * @param[out] out index record decoded data (if successful)
+   * @return True on success, false on error
+   */
+  bool GetIndexData(IndexRecordData* out) const;
+
   /**
    * Decodes a data record as a boolean. Note if the data type (as indicated in
    * the corresponding start control record for this entry) is not "boolean",
@@ -302,7 +338,10 @@ class DataLogReader {
  public:
   using iterator = DataLogIterator;
 
-  /** Constructs from a memory buffer. */
+  /**
+   * Constructs from a memory buffer.  Logs written in compressed mode are
+   * transparently decompressed into memory.
+   */
   explicit DataLogReader(std::unique_ptr<MemoryBuffer> buffer);
 
   /** Returns true if the data log is valid (e.g. has a valid header). */
@@ -335,6 +374,42 @@ class DataLogReader {
     return m_buf ? m_buf->GetBufferIdentifier() : "Invalid";
   }
 
+  /**
+   * Reads the log's index records, if present.  Uses the trailer at the end
+   * of the file when available (written when the log was cleanly closed);
+   * otherwise scans the log for index records.
+   *
+   * @return Index blocks in file order; empty if the log has no index
+   */
+  std::vector<IndexRecordData> GetIndexBlocks() const;
+
+  /**
+   * Gets all records for a single entry.  When the log contains index
+   * records, blocks with no records for the entry are skipped entirely, so
+   * this is much faster than iterating the whole log.
+   *
+   * @param entry entry ID
+   * @return Records for the entry, in file order
+   */
+  std::vector<DataLogRecord> GetEntryRecords(int entry) const;
+
+  /**
+   * Decodes every record in the log, grouped by entry.  A serial header-only
+   * pass splits the buffer into chunks at record boundaries; the chunks are
+   * then decoded on multiple threads and the per-chunk results merged in file
+   * order, so large memory-mapped logs decode at close to memory bandwidth.
+   * Record data spans reference the log buffer and are valid for the lifetime
+   * of the reader.
+   *
+   * @param numThreads number of decode threads; 0 (the default) uses the
+   *                   hardware concurrency
+   * @return Each entry ID paired with that entry's records (including
+   *         control records under entry 0), sorted by entry ID; each
+   *         entry's records are in file order
+   */
+  std::vector<std::pair<int, std::vector<DataLogRecord>>> GetAllEntryRecords(
+      unsigned int numThreads = 0) const;
+
   /** Returns iterator to first record. */
   iterator begin() const;
 
@@ -344,6 +419,9 @@ class DataLogReader {
  private:
   std::unique_ptr<MemoryBuffer> m_buf;
 
+  // replaces m_buf with a decompressed copy if the log is compressed
+  void ExpandCompressed();
+
   bool GetRecord(size_t* pos, DataLogRecord* out) const;
   bool GetNextRecord(size_t* pos) const;
 };
@@ -4,14 +4,26 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
 #include "wpi/SmallVector.h"
 #include "wpi/Synchronization.h"
 #include "wpi/mutex.h"
 
 namespace wpi {
 struct EventVector {
+  using List = wpi::SmallVector<WPI_EventHandle, 4>;
+
+  // Writers copy the list under the mutex and publish the new snapshot;
+  // wakers read the snapshot without taking the lock, so signaling never
+  // blocks behind (or holds up) an Add/Remove on another thread.  Accessed
+  // via the std::atomic_load/atomic_store free functions; libc++ doesn't
+  // provide std::atomic<std::shared_ptr>.
   wpi::mutex mutex;
-  wpi::SmallVector<WPI_EventHandle, 4> events;
+  std::shared_ptr<const List> events;
+  std::atomic<size_t> nextWake{0};
 
   /**
    * Adds an event to the event vector.
@@ -20,7 +32,11 @@ struct EventVector {
    */
   void Add(WPI_EventHandle handle) {
     std::scoped_lock lock{mutex};
-    events.emplace_back(handle);
+    auto updated = CopyList();
+    updated->emplace_back(handle);
+    std::atomic_store_explicit(&events,
+                               std::shared_ptr<const List>{std::move(updated)},
+                               std::memory_order_release);
   }
 
   /**
@@ -30,22 +46,63 @@ struct EventVector {
    */
   void Remove(WPI_EventHandle handle) {
     std::scoped_lock lock{mutex};
+    auto updated = CopyList();
     auto it = std::find_if(
-        events.begin(), events.end(),
+        updated->begin(), updated->end(),
         [=](const WPI_EventHandle fromHandle) { return fromHandle == handle; });
-    if (it != events.end()) {
-      events.erase(it);
+    if (it != updated->end()) {
+      updated->erase(it);
+      std::atomic_store_explicit(
+          &events, std::shared_ptr<const List>{std::move(updated)},
+          std::memory_order_release);
     }
   }
 
   /**
    * Wakes up all events in the event vector.
+   *
+   * Signals from a snapshot of the list without holding the mutex, so a
+   * per-frame or per-packet wakeup of many listeners doesn't serialize with
+   * listener registration.
    */
   void Wakeup() {
-    std::scoped_lock lock{mutex};
-    for (auto&& handle : events) {
+    auto snapshot =
+        std::atomic_load_explicit(&events, std::memory_order_acquire);
+    if (!snapshot) {
+      return;
+    }
+    for (auto&& handle : *snapshot) {
       wpi::SetEvent(handle);
     }
   }
+
+  /**
+   * Wakes up a single event in the event vector, rotating through the events
+   * on successive calls.
+   *
+   * Use this instead of Wakeup() for work-queue patterns where each item
+   * only needs one consumer; waking every waiter per item just makes the
+   * losers contend and go back to sleep.
+   */
+  void WakeupOne() {
+    auto snapshot =
+        std::atomic_load_explicit(&events, std::memory_order_acquire);
+    if (!snapshot || snapshot->empty()) {
+      return;
+    }
+    size_t index = nextWake.fetch_add(1, std::memory_order_relaxed);
+    wpi::SetEvent((*snapshot)[index % snapshot->size()]);
+  }
+
+ private:
+  // must be called with mutex held
+  std::shared_ptr<List> CopyList() {
+    auto current =
+        std::atomic_load_explicit(&events, std::memory_order_acquire);
+    if (current) {
+      return std::make_shared<List>(*current);
+    }
+    return std::make_shared<List>();
+  }
 };
 }  // namespace wpi
@@ -6,12 +6,17 @@
 #define WPIUTIL_WPI_LOGGER_H_
 
 #include <functional>
+#include <memory>
 #include <utility>
 
 #include "fmt/format.h"
 
 namespace wpi {
 
+namespace detail {
+class LogRing;
+}  // namespace detail
+
 enum LogLevel {
   WPI_LOG_CRITICAL = 50,
   WPI_LOG_ERROR = 40,
@@ -45,6 +50,27 @@ class Logger {
   void LogV(unsigned int level, const char* file, unsigned int line,
             fmt::string_view format, fmt::format_args args);
 
+  /**
+   * Enables deferred-format mode.  Log calls pack the format string and
+   * arguments into a fixed-size binary record and push it onto a lock-free
+   * ring instead of formatting; formatting happens in ProcessDeferred() on
+   * whatever thread consumes the log.  Records that don't fit (long strings,
+   * custom-formatted types) and records that arrive while the ring is full
+   * are formatted eagerly as before, so no messages are lost, but ordering
+   * between the two paths is not guaranteed.
+   *
+   * @param capacity number of records the ring holds (rounded up to a power
+   *                 of 2)
+   */
+  void SetDeferred(size_t capacity = 512);
+
+  /**
+   * Formats and delivers any queued deferred records to the log function.
+   * Call periodically from the consuming thread when deferred mode is
+   * enabled; records below the current minimum level are dropped unformatted.
+   */
+  void ProcessDeferred();
+
   template <typename... Args>
   void Log(unsigned int level, const char* file, unsigned int line,
            fmt::string_view format, Args&&... args) {
@@ -58,6 +84,7 @@ class Logger {
  private:
   LogFunc m_func;
   unsigned int m_min_level = 20;
+  std::shared_ptr<detail::LogRing> m_ring;
 };
 
 // C++20 relaxed the number of arguments to variadics, but Apple Clang's
@@ -0,0 +1,188 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "wpi/SmallVector.h"
+#include "wpi/mutex.h"
+
+namespace wpi {
+
+/**
+ * A pool of reusable heap objects for high-churn message and value buffers.
+ *
+ * Acquire() hands out objects as std::shared_ptr<T> whose deleter returns the
+ * object to the pool instead of freeing it, so pooled objects drop into
+ * existing shared_ptr-based storage (e.g. value payloads) unchanged. Objects
+ * come back in whatever state the last user left them; callers are expected
+ * to assign over the previous contents, which for containers reuses the
+ * existing capacity and is exactly what makes the pool pay off.
+ *
+ * A small per-thread cache serves repeat acquire/release cycles without
+ * touching the pool mutex; the cache is tagged with the owning pool's
+ * generation so a cache left over from a destroyed pool is flushed rather
+ * than handed to an unrelated pool that reused the same address. Objects
+ * released after the pool itself is gone are simply freed.
+ *
+ * Pools must be created via Create() (the deleter holds a weak reference to
+ * the pool). All members are safe to call from any thread.
+ */
+template <typename T>
+class ObjectPool : public std::enable_shared_from_this<ObjectPool<T>> {
+  struct private_init {};
+
+ public:
+  /** Pool usage counters, retrievable with GetStatistics(). */
+  struct Statistics {
+    /** Total Acquire() calls. */
+    uint64_t acquires = 0;
+    /** Acquires served from the thread cache or free list. */
+    uint64_t hits = 0;
+    /** Acquires that fell through to a heap allocation. */
+    uint64_t allocations = 0;
+    /** Objects returned when the pool was already full and were freed. */
+    uint64_t discards = 0;
+  };
+
+  ObjectPool(size_t maxPooled, const private_init&)
+      : m_maxPooled{maxPooled},
+        m_generation{s_nextGeneration.fetch_add(1,
+                                                std::memory_order_relaxed)} {}
+
+  /**
+   * Creates an object pool.
+   *
+   * @param maxPooled maximum number of idle objects kept in the shared free
+   *                  list; returns beyond this (and beyond the per-thread
+   *                  caches) are freed
+   */
+  static std::shared_ptr<ObjectPool> Create(size_t maxPooled = 256) {
+    return std::make_shared<ObjectPool>(maxPooled, private_init{});
+  }
+
+  ObjectPool(const ObjectPool&) = delete;
+  ObjectPool& operator=(const ObjectPool&) = delete;
+
+  /**
+   * Gets an object from the pool, allocating a new one if the pool is empty.
+   * The object's contents are unspecified; assign before use.
+   *
+   * @return shared pointer whose deleter recycles the object
+   */
+  std::shared_ptr<T> Acquire() {
+    m_stats.acquires.fetch_add(1, std::memory_order_relaxed);
+    std::unique_ptr<T> obj = Take();
+    if (obj) {
+      m_stats.hits.fetch_add(1, std::memory_order_relaxed);
+    } else {
+      m_stats.allocations.fetch_add(1, std::memory_order_relaxed);
+      obj = std::make_unique<T>();
+    }
+    return std::shared_ptr<T>{obj.release(),
+                              Recycler{this->weak_from_this()}};
+  }
+
+  /**
+   * Returns a snapshot of the pool's usage counters.
+   */
+  Statistics GetStatistics() const {
+    Statistics stats;
+    stats.acquires = m_stats.acquires.load(std::memory_order_relaxed);
+    stats.hits = m_stats.hits.load(std::memory_order_relaxed);
+    stats.allocations = m_stats.allocations.load(std::memory_order_relaxed);
+    stats.discards = m_stats.discards.load(std::memory_order_relaxed);
+    return stats;
+  }
+
+ private:
+  static constexpr size_t kThreadCacheSize = 8;
+
+  struct ThreadCache {
+    ObjectPool* owner = nullptr;
+    uint64_t generation = 0;
+    wpi::SmallVector<std::unique_ptr<T>, kThreadCacheSize> items;
+  };
+
+  struct Recycler {
+    std::weak_ptr<ObjectPool> pool;
+    void operator()(T* obj) const {
+      if (auto p = pool.lock()) {
+        p->Put(std::unique_ptr<T>{obj});
+      } else {
+        delete obj;
+      }
+    }
+  };
+
+  static ThreadCache& GetThreadCache() {
+    static thread_local ThreadCache cache;
+    return cache;
+  }
+
+  // Rebinds the calling thread's cache to this pool, flushing any objects
+  // cached for a different (possibly destroyed) pool instance.
+  ThreadCache& BindThreadCache() {
+    auto& cache = GetThreadCache();
+    if (cache.owner != this || cache.generation != m_generation) {
+      cache.items.clear();
+      cache.owner = this;
+      cache.generation = m_generation;
+    }
+    return cache;
+  }
+
+  std::unique_ptr<T> Take() {
+    auto& cache = BindThreadCache();
+    if (!cache.items.empty()) {
+      auto obj = std::move(cache.items.back());
+      cache.items.pop_back();
+      return obj;
+    }
+    std::scoped_lock lock{m_mutex};
+    if (!m_freeList.empty()) {
+      auto obj = std::move(m_freeList.back());
+      m_freeList.pop_back();
+      return obj;
+    }
+    return nullptr;
+  }
+
+  void Put(std::unique_ptr<T> obj) {
+    auto& cache = BindThreadCache();
+    if (cache.items.size() < kThreadCacheSize) {
+      cache.items.emplace_back(std::move(obj));
+      return;
+    }
+    std::scoped_lock lock{m_mutex};
+    if (m_freeList.size() < m_maxPooled) {
+      m_freeList.emplace_back(std::move(obj));
+    } else {
+      m_stats.discards.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  struct AtomicStatistics {
+    std::atomic<uint64_t> acquires{0};
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> discards{0};
+  };
+
+  static inline std::atomic<uint64_t> s_nextGeneration{1};
+
+  size_t m_maxPooled;
+  uint64_t m_generation;
+  wpi::mutex m_mutex;
+  std::vector<std::unique_ptr<T>> m_freeList;
+  AtomicStatistics m_stats;
+};
+
+}  // namespace wpi
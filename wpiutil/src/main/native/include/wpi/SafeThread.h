@@ -7,15 +7,34 @@
 
 #include <atomic>
 #include <memory>
+#include <string>
+#include <string_view>
 #include <thread>
 #include <utility>
+#include <vector>
 
 #include "wpi/Synchronization.h"
 #include "wpi/condition_variable.h"
 #include "wpi/mutex.h"
+#include "wpi/timestamp.h"
 
 namespace wpi {
 
+/**
+ * Telemetry snapshot for one registered SafeThread, as returned by
+ * GetSafeThreadTelemetry().
+ */
+struct SafeThreadTelemetry {
+  /** Thread name (as set with SetTelemetryName()). */
+  std::string name;
+  /** Number of loop iterations recorded with RecordWake(). */
+  uint64_t iterations;
+  /** Timestamp of the last RecordWake() call (wpi::Now() timebase, us). */
+  uint64_t lastWakeTime;
+  /** Last reported queue depth; -1 if the thread doesn't report one. */
+  int64_t queueDepth;
+};
+
 /**
  * Base class for SafeThreadOwner threads.
  */
@@ -25,11 +44,49 @@ class SafeThreadBase {
   virtual void Main() = 0;
   virtual void Stop() = 0;
 
+  /**
+   * Sets the thread's telemetry name.  Naming a thread before it is started
+   * opts it into the telemetry registry (see GetSafeThreadTelemetry()); the
+   * thread should then call RecordWake() at the top of its loop.
+   */
+  void SetTelemetryName(std::string_view name) { m_telemetryName = name; }
+
+  std::string_view GetTelemetryName() const { return m_telemetryName; }
+
+  /**
+   * Records a loop wakeup for telemetry.  Cheap (a few relaxed atomic
+   * stores), so it's safe to call every loop iteration.
+   *
+   * @param queueDepth depth of the thread's work queue at wakeup, or -1 if
+   *                   the thread has no queue to report
+   */
+  void RecordWake(int64_t queueDepth = -1) {
+    m_iterations.fetch_add(1, std::memory_order_relaxed);
+    m_lastWakeTime.store(Now(), std::memory_order_relaxed);
+    m_queueDepth.store(queueDepth, std::memory_order_relaxed);
+  }
+
   mutable wpi::mutex m_mutex;
   std::atomic_bool m_active{true};
   std::thread::id m_threadId;
+
+ private:
+  friend std::vector<SafeThreadTelemetry> GetSafeThreadTelemetry();
+
+  std::string m_telemetryName;
+  std::atomic<uint64_t> m_iterations{0};
+  std::atomic<uint64_t> m_lastWakeTime{0};
+  std::atomic<int64_t> m_queueDepth{-1};
 };
 
+/**
+ * Returns telemetry snapshots for all live SafeThreads that opted in by
+ * setting a telemetry name.  Reading is lock-free (a published-snapshot load
+ * plus relaxed counter reads), so this can be polled for NT or DataLog
+ * publication without perturbing the threads being watched.
+ */
+std::vector<SafeThreadTelemetry> GetSafeThreadTelemetry();
+
 class SafeThread : public SafeThreadBase {
  public:
   void Stop() override;
@@ -5,7 +5,9 @@
 #ifndef WPIUTIL_WPI_STACKTRACE_H_
 #define WPIUTIL_WPI_STACKTRACE_H_
 
+#include <span>
 #include <string>
+#include <vector>
 
 namespace wpi {
 
@@ -16,6 +18,25 @@ namespace wpi {
  */
 std::string GetStackTrace(int offset);
 
+/**
+ * Capture raw stack frame return addresses, ignoring the first "offset"
+ * frames.  This is cheap (no symbol lookup or demangling), so it is safe to
+ * call from latency-sensitive code; pass the result to SymbolizeStackTrace()
+ * later, e.g. from a background thread.
+ *
+ * @param offset The number of frames at the top of the stack to ignore
+ */
+std::vector<void*> CaptureStackTrace(int offset);
+
+/**
+ * Symbolize a raw stack capture from CaptureStackTrace() into the same text
+ * format as GetStackTrace().  This does the expensive symbol lookup and
+ * demangling and may block.
+ *
+ * @param frames Raw frame addresses
+ */
+std::string SymbolizeStackTrace(std::span<void* const> frames);
+
 /**
  * The default implementation used for GetStackTrace().
  *
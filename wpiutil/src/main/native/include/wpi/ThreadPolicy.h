@@ -0,0 +1,75 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#ifndef WPIUTIL_WPI_THREADPOLICY_H_
+#define WPIUTIL_WPI_THREADPOLICY_H_
+
+#include <stdint.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace wpi {
+
+/**
+ * Scheduling policy for a library-created thread.  Assigned to threads by
+ * name pattern with SetThreadPolicy().
+ */
+struct ThreadPolicy {
+  /** True to run the thread with a real-time (SCHED_FIFO) priority. */
+  bool realTime = false;
+  /**
+   * Thread priority.  For real-time, this is 1-99 with 99 being highest;
+   * for non-real-time, this is forced to 0.  See "man 7 sched" for details.
+   */
+  int priority = 0;
+  /**
+   * CPU affinity mask; bit N allows the thread to run on core N.  0 leaves
+   * the thread's affinity unchanged.
+   */
+  uint64_t affinityMask = 0;
+};
+
+/**
+ * Registers the calling thread in the thread-policy registry under the given
+ * name and applies any matching policy previously set with SetThreadPolicy().
+ * Also sets the OS-level thread name (truncated as required by the platform)
+ * so the thread is identifiable in debuggers and process listings.
+ *
+ * Threads started through SafeThreadOwner that have a telemetry name are
+ * registered automatically; other library threads should call this at the
+ * top of their main function and UnregisterCurrentThread() before exiting.
+ *
+ * @param name thread name
+ */
+void RegisterCurrentThread(std::string_view name);
+
+/**
+ * Removes the calling thread from the thread-policy registry.
+ */
+void UnregisterCurrentThread();
+
+/**
+ * Sets the scheduling policy for all registered threads whose name matches
+ * the given pattern, and remembers the pattern so threads registered later
+ * also get the policy.  '*' in the pattern matches any sequence of
+ * characters; all other characters match literally.  When multiple patterns
+ * match a thread, the most recently set one wins.
+ *
+ * @param pattern thread name pattern (e.g. "NT*")
+ * @param policy  policy to apply
+ * @return        true if the policy was applied successfully to all
+ *                currently matching threads
+ */
+bool SetThreadPolicy(std::string_view pattern, const ThreadPolicy& policy);
+
+/**
+ * Returns the names of all threads currently in the thread-policy registry.
+ */
+std::vector<std::string> GetRegisteredThreadNames();
+
+}  // namespace wpi
+
+#endif  // WPIUTIL_WPI_THREADPOLICY_H_
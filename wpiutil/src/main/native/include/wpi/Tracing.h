@@ -0,0 +1,118 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+namespace wpi::log {
+class DataLog;
+}  // namespace wpi::log
+
+namespace wpi::tracing {
+
+/**
+ * A single trace event as recorded by Span.  Begin and end events for a span
+ * are recorded separately; nesting is implied by the order of events within a
+ * thread.
+ */
+struct TraceEvent {
+  /** Event time (from wpi::Now()), in integer microseconds. */
+  uint64_t time;
+
+  /**
+   * Span name.  Points to the string passed to the Span constructor, which
+   * must have static storage duration.
+   */
+  const char* name;
+
+  /** True for a span begin event, false for a span end event. */
+  bool begin;
+};
+
+/** Events drained from a single thread's ring buffer. */
+struct ThreadTrace {
+  /** Thread ID (small integer assigned in thread creation order). */
+  uint64_t threadId;
+
+  /** Events in recording order. */
+  std::vector<TraceEvent> events;
+};
+
+/**
+ * Enables or disables trace recording.  Spans created while tracing is
+ * disabled record nothing; the check is a single relaxed atomic load.
+ *
+ * @param enabled true to record spans, false to disable
+ */
+void SetEnabled(bool enabled);
+
+/**
+ * Returns true if trace recording is enabled.
+ *
+ * @return true if enabled
+ */
+bool IsEnabled();
+
+/**
+ * RAII scoped trace span.  Records a begin event at construction and an end
+ * event at destruction into a per-thread lock-free ring buffer; spans nest
+ * naturally with scopes.  Cheap enough to leave in hot paths: when tracing is
+ * disabled the cost is one atomic load, and when enabled each event is a
+ * timestamp read and a ring slot write (no locks, no allocation).
+ *
+ * The ring buffer has a fixed size; if events are not drained often enough,
+ * the oldest events are overwritten.
+ */
+class Span {
+ public:
+  /**
+   * Starts a span.
+   *
+   * @param name span name; must have static storage duration (e.g. a string
+   *             literal), as only the pointer is recorded
+   */
+  explicit Span(const char* name);
+
+  Span(const Span&) = delete;
+  Span& operator=(const Span&) = delete;
+
+  ~Span();
+
+ private:
+  const char* m_name;
+};
+
+/**
+ * Drains all recorded events from every thread's ring buffer.  Events
+ * recorded by a thread concurrently with the drain may be deferred to the
+ * next drain; events overwritten before being drained are lost.
+ *
+ * @return Drained events, grouped by thread
+ */
+std::vector<ThreadTrace> Drain();
+
+/**
+ * Drains all recorded events and appends them to a data log entry as raw
+ * records, one record per event.  The record timestamp is the event time;
+ * the payload is a phase byte ('B' or 'E'), an 8-byte little-endian thread
+ * ID, and the span name.
+ *
+ * @param log data log
+ * @param entry raw entry index (as returned by DataLog::Start())
+ */
+void WriteDataLog(log::DataLog& log, int entry);
+
+/**
+ * Drains all recorded events and formats them as Chrome trace event JSON
+ * (viewable in chrome://tracing or Perfetto).
+ *
+ * @return JSON string
+ */
+std::string ExportChromeTrace();
+
+}  // namespace wpi::tracing
@@ -4,7 +4,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <span>
+#include <utility>
 #include <vector>
 
 namespace wpi {
@@ -239,6 +242,52 @@ class circular_buffer {
     return m_data[(m_front + m_length) % m_data.size()];
   }
 
+  /**
+   * Returns the buffer contents as up to two contiguous spans ordered from
+   * front to back.
+   *
+   * The second span is empty unless the contents wrap around the end of the
+   * internal storage, so kernels can run over linear memory instead of
+   * indexing through modulo arithmetic per element.
+   */
+  std::pair<std::span<T>, std::span<T>> data_spans();
+
+  /**
+   * Returns the buffer contents as up to two contiguous spans ordered from
+   * front to back.
+   *
+   * The second span is empty unless the contents wrap around the end of the
+   * internal storage.
+   */
+  std::pair<std::span<const T>, std::span<const T>> data_spans() const;
+
+  /**
+   * Rearranges the internal storage so the buffer contents are contiguous,
+   * then returns a span over them ordered from front to back.
+   *
+   * References and spans previously obtained from the buffer are invalidated
+   * if the contents wrapped around the end of the internal storage.
+   */
+  std::span<T> make_contiguous();
+
+  /**
+   * Push a span of values onto the back of the buffer in order.
+   *
+   * Values at the front are overwritten if the buffer is full; if the span is
+   * larger than the buffer, only the last size() values are kept.
+   */
+  void push_back(std::span<const T> values);
+
+  /**
+   * Pop values from the front of the buffer into the given span.
+   *
+   * Pops at most the smaller of the span size and the number of elements in
+   * the buffer.
+   *
+   * @return The number of values popped.
+   */
+  size_t pop_front(std::span<T> out);
+
   /**
    * Resizes internal buffer to given size.
    */
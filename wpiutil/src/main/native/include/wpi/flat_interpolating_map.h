@@ -0,0 +1,159 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace wpi {
+
+/**
+ * Implements a table of key-value pairs with linear interpolation between
+ * values, stored as flat sorted arrays.
+ *
+ * Semantically equivalent to interpolating_map, but keys and values live in
+ * contiguous vectors instead of red-black tree nodes and lookups use a
+ * branchless binary search, so repeated lookups (e.g. feedforward tables
+ * evaluated every loop iteration) stay in cache.  Inserts shift elements and
+ * are O(n); use this for tables that are built once and queried often.
+ *
+ * @tparam Key   The key type.
+ * @tparam Value The value type.
+ */
+template <typename Key, typename Value>
+class flat_interpolating_map {
+ public:
+  /**
+   * Inserts a key-value pair.  If the key already exists, the table is
+   * unchanged (matching interpolating_map).
+   *
+   * @param key   The key.
+   * @param value The value.
+   */
+  void insert(const Key& key, const Value& value) {
+    auto it = std::lower_bound(m_keys.begin(), m_keys.end(), key);
+    if (it != m_keys.end() && !(key < *it)) {
+      return;
+    }
+    m_values.insert(m_values.begin() + (it - m_keys.begin()), value);
+    m_keys.insert(it, key);
+  }
+
+  /**
+   * Inserts a key-value pair.  If the key already exists, the table is
+   * unchanged (matching interpolating_map).
+   *
+   * @param key   The key.
+   * @param value The value.
+   */
+  void insert(Key&& key, Value&& value) {
+    auto it = std::lower_bound(m_keys.begin(), m_keys.end(), key);
+    if (it != m_keys.end() && !(key < *it)) {
+      return;
+    }
+    m_values.insert(m_values.begin() + (it - m_keys.begin()),
+                    std::move(value));
+    m_keys.insert(it, std::move(key));
+  }
+
+  /**
+   * Reserves storage for at least capacity key-value pairs.
+   *
+   * @param capacity Number of pairs.
+   */
+  void reserve(size_t capacity) {
+    m_keys.reserve(capacity);
+    m_values.reserve(capacity);
+  }
+
+  /**
+   * Returns the value associated with a given key.
+   *
+   * If there's no matching key, the value returned will be a linear
+   * interpolation between the keys before and after the provided one.
+   *
+   * @param key The key.
+   */
+  Value operator[](const Key& key) const {
+    size_t upper = UpperBound(key);
+
+    // If key > largest key in table, return value for largest table key
+    if (upper == m_keys.size()) {
+      return m_values.back();
+    }
+
+    // If key <= smallest key in table, return value for smallest table key
+    if (upper == 0) {
+      return m_values.front();
+    }
+
+    // Perform linear interpolation between lower and upper bound
+    const double delta =
+        (key - m_keys[upper - 1]) / (m_keys[upper] - m_keys[upper - 1]);
+    return delta * m_values[upper] + (1.0 - delta) * m_values[upper - 1];
+  }
+
+  /**
+   * Looks up several keys in one call, writing one interpolated value per
+   * key.  The flat storage and branchless search let the compiler keep
+   * multiple independent lookups in flight, so this is faster than N calls
+   * to operator[] when evaluating a batch of tables per loop iteration.
+   *
+   * @param[in]  keys   Keys to look up.
+   * @param[out] values Interpolated values; must be the same length as keys.
+   */
+  void interpolate(std::span<const Key> keys, std::span<Value> values) const {
+    size_t n = (std::min)(keys.size(), values.size());
+    for (size_t i = 0; i < n; ++i) {
+      values[i] = (*this)[keys[i]];
+    }
+  }
+
+  /**
+   * Returns the number of key-value pairs.
+   */
+  size_t size() const { return m_keys.size(); }
+
+  /**
+   * Returns true if the table is empty.
+   */
+  bool empty() const { return m_keys.empty(); }
+
+  /**
+   * Clears the contents.
+   */
+  void clear() {
+    m_keys.clear();
+    m_values.clear();
+  }
+
+ private:
+  // Branchless upper bound: returns the index of the first key greater than
+  // key, or size() if none.  Each halving step is a conditional move rather
+  // than a branch, so lookups with unpredictable keys don't pay for
+  // mispredictions.
+  size_t UpperBound(const Key& key) const {
+    size_t pos = 0;
+    size_t n = m_keys.size();
+    if (n == 0) {
+      return 0;
+    }
+    while (n > 1) {
+      size_t half = n >> 1;
+      pos += (m_keys[pos + half - 1] <= key) ? half : 0;
+      n -= half;
+    }
+    pos += (m_keys[pos] <= key) ? 1 : 0;
+    return pos;
+  }
+
+  std::vector<Key> m_keys;
+  std::vector<Value> m_values;
+};
+
+}  // namespace wpi
@@ -10,11 +10,11 @@
 #include <algorithm>
 #include <atomic>
 #include <chrono>
-#include <functional>
 #include <type_traits>
 #include <utility>
-#include <vector>
 
+#include "wpi/FunctionExtras.h"
+#include "wpi/SmallVector.h"
 #include "wpi/condition_variable.h"
 #include "wpi/mutex.h"
 
@@ -72,7 +72,7 @@ class PromiseFactoryBase {
   wpi::condition_variable m_resultCv;
 
   uint64_t m_uid = 0;
-  std::vector<uint64_t> m_requests;
+  wpi::SmallVector<uint64_t, 4> m_requests;
 };
 
 template <typename To, typename From>
@@ -125,7 +125,10 @@ class PromiseFactory final : public detail::PromiseFactoryBase {
 
  public:
   using detail::PromiseFactoryBase::Notify;
-  using ThenFunction = std::function<void(uint64_t, T)>;
+
+  // move-only with inline storage for typical continuation captures, so
+  // chaining a then() doesn't heap-allocate for the callable
+  using ThenFunction = wpi::unique_function<void(uint64_t, T)>;
 
   /**
    * Creates a future.
@@ -189,8 +192,8 @@ class PromiseFactory final : public detail::PromiseFactoryBase {
     ThenFunction func;
   };
 
-  std::vector<Then> m_thens;
-  std::vector<std::pair<uint64_t, T>> m_results;
+  wpi::SmallVector<Then, 4> m_thens;
+  wpi::SmallVector<std::pair<uint64_t, T>, 4> m_results;
 };
 
 /**
@@ -202,7 +205,10 @@ class PromiseFactory<void> final : public detail::PromiseFactoryBase {
 
  public:
   using detail::PromiseFactoryBase::Notify;
-  using ThenFunction = std::function<void(uint64_t)>;
+
+  // move-only with inline storage for typical continuation captures, so
+  // chaining a then() doesn't heap-allocate for the callable
+  using ThenFunction = wpi::unique_function<void(uint64_t)>;
 
   /**
    * Creates a future.
@@ -256,8 +262,8 @@ class PromiseFactory<void> final : public detail::PromiseFactoryBase {
     ThenFunction func;
   };
 
-  std::vector<Then> m_thens;
-  std::vector<uint64_t> m_results;
+  wpi::SmallVector<Then, 4> m_thens;
+  wpi::SmallVector<uint64_t, 4> m_results;
 };
 
 /**
@@ -328,7 +334,7 @@ class future final {
       auto promises = m_promises;
       m_promises = nullptr;
       return detail::FutureThen<R, T>::Create(*promises, m_request, factory,
-                                              func);
+                                              std::forward<F>(func));
     } else {
       return future<R>();
     }
@@ -451,7 +457,7 @@ class future<void> final {
       auto promises = m_promises;
       m_promises = nullptr;
       return detail::FutureThen<R, void>::Create(*promises, m_request, factory,
-                                                 func);
+                                                 std::forward<F>(func));
     } else {
       return future<R>();
     }
@@ -779,7 +785,7 @@ void PromiseFactory<T>::SetThen(uint64_t request, uint64_t outRequest,
     lock.unlock();
     return func(outRequest, std::move(val));
   }
-  m_thens.emplace_back(request, outRequest, func);
+  m_thens.emplace_back(request, outRequest, std::move(func));
 }
 
 template <typename T>
@@ -895,9 +901,11 @@ future<To> detail::FutureThen<To, From>::Create(
     PromiseFactory<From>& fromFactory, uint64_t request,
     PromiseFactory<To>& factory, F&& func) {
   uint64_t req = factory.CreateRequest();
-  fromFactory.SetThen(request, req, [&factory, func](uint64_t r, From value) {
-    factory.SetValue(r, func(std::move(value)));
-  });
+  fromFactory.SetThen(request, req,
+                      [&factory, func = std::forward<F>(func)](
+                          uint64_t r, From value) mutable {
+                        factory.SetValue(r, func(std::move(value)));
+                      });
   return factory.CreateFuture(req);
 }
 
@@ -907,10 +915,12 @@ future<void> detail::FutureThen<void, From>::Create(
     PromiseFactory<From>& fromFactory, uint64_t request,
     PromiseFactory<void>& factory, F&& func) {
   uint64_t req = factory.CreateRequest();
-  fromFactory.SetThen(request, req, [&factory, func](uint64_t r, From value) {
-    func(std::move(value));
-    factory.SetValue(r);
-  });
+  fromFactory.SetThen(request, req,
+                      [&factory, func = std::forward<F>(func)](
+                          uint64_t r, From value) mutable {
+                        func(std::move(value));
+                        factory.SetValue(r);
+                      });
   return factory.CreateFuture(req);
 }
 
@@ -920,9 +930,11 @@ future<To> detail::FutureThen<To, void>::Create(
     PromiseFactory<void>& fromFactory, uint64_t request,
     PromiseFactory<To>& factory, F&& func) {
   uint64_t req = factory.CreateRequest();
-  fromFactory.SetThen(request, req, [&factory, func](uint64_t r) {
-    factory.SetValue(r, func());
-  });
+  fromFactory.SetThen(
+      request, req,
+      [&factory, func = std::forward<F>(func)](uint64_t r) mutable {
+        factory.SetValue(r, func());
+      });
   return factory.CreateFuture(req);
 }
 
@@ -931,10 +943,12 @@ future<void> detail::FutureThen<void, void>::Create(
     PromiseFactory<void>& fromFactory, uint64_t request,
     PromiseFactory<void>& factory, F&& func) {
   uint64_t req = factory.CreateRequest();
-  fromFactory.SetThen(request, req, [&factory, func](uint64_t r) {
-    func();
-    factory.SetValue(r);
-  });
+  fromFactory.SetThen(
+      request, req,
+      [&factory, func = std::forward<F>(func)](uint64_t r) mutable {
+        func();
+        factory.SetValue(r);
+      });
   return factory.CreateFuture(req);
 }
 
@@ -18,4 +18,51 @@ using mutex = ::std::mutex;
 using recursive_mutex = ::std::recursive_mutex;
 #endif
 
+/**
+ * An adaptive mutex for microsecond-scale critical sections.  lock() spins
+ * a bounded number of times with exponential backoff before falling back to
+ * a blocking lock, so short sections under contention avoid the park/unpark
+ * round trip entirely.  The fallback is wpi::mutex, which keeps priority
+ * inheritance on platforms that have it (e.g. the roboRIO's RT kernel).
+ * Meets the Lockable requirements, so it works with std::scoped_lock and
+ * std::unique_lock.
+ */
+class adaptive_mutex {
+ public:
+  constexpr adaptive_mutex() noexcept = default;
+  adaptive_mutex(const adaptive_mutex&) = delete;
+  adaptive_mutex& operator=(const adaptive_mutex&) = delete;
+
+  void lock() {
+    for (unsigned int backoff = 1; backoff <= kMaxBackoff; backoff <<= 1) {
+      if (m_mutex.try_lock()) {
+        return;
+      }
+      for (unsigned int i = 0; i < backoff; ++i) {
+        Pause();
+      }
+    }
+    m_mutex.lock();  // contended beyond the spin budget; park
+  }
+
+  void unlock() { m_mutex.unlock(); }
+
+  bool try_lock() noexcept { return m_mutex.try_lock(); }
+
+ private:
+  // ~2k pause iterations total before parking; roughly a microsecond of
+  // spinning, matching the critical sections this is meant for
+  static constexpr unsigned int kMaxBackoff = 1024;
+
+  static inline void Pause() noexcept {
+#if defined(__i386__) || defined(__x86_64__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+  }
+
+  wpi::mutex m_mutex;
+};
+
 }  // namespace wpi
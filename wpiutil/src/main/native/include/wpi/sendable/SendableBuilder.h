@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "wpi/SmallVector.h"
+#include "wpi/sendable/SendableProperty.h"
 
 namespace wpi {
 
@@ -264,6 +265,99 @@ class SendableBuilder {
           getter,
       std::function<void(std::span<const uint8_t>)> setter) = 0;
 
+  /**
+   * Add all properties in a static property table (see SendableProperty).
+   * The table is typically a constexpr array shared by every instance of the
+   * Sendable class, so registration does not allocate per-property closures.
+   * Backends may override this to store the table entries directly; the
+   * default implementation forwards each entry to the corresponding
+   * AddXProperty() call.
+   *
+   * @param obj    object the table's accessors are called on (must outlive
+   *               the builder, like a captured this pointer)
+   * @param table  property table
+   */
+  virtual void AddPropertyTable(void* obj,
+                                std::span<const SendableProperty> table) {
+    for (auto&& prop : table) {
+      if (prop.boolGetter || prop.boolSetter) {
+        AddBooleanProperty(
+            prop.key,
+            prop.boolGetter
+                ? std::function<bool()>{[obj, getter = prop.boolGetter] {
+                    return getter(obj);
+                  }}
+                : nullptr,
+            prop.boolSetter
+                ? std::function<void(bool)>{[obj, setter = prop.boolSetter](
+                                                bool value) {
+                    setter(obj, value);
+                  }}
+                : nullptr);
+      } else if (prop.intGetter || prop.intSetter) {
+        AddIntegerProperty(
+            prop.key,
+            prop.intGetter
+                ? std::function<int64_t()>{[obj, getter = prop.intGetter] {
+                    return getter(obj);
+                  }}
+                : nullptr,
+            prop.intSetter
+                ? std::function<void(int64_t)>{[obj, setter = prop.intSetter](
+                                                   int64_t value) {
+                    setter(obj, value);
+                  }}
+                : nullptr);
+      } else if (prop.floatGetter || prop.floatSetter) {
+        AddFloatProperty(
+            prop.key,
+            prop.floatGetter
+                ? std::function<float()>{[obj, getter = prop.floatGetter] {
+                    return getter(obj);
+                  }}
+                : nullptr,
+            prop.floatSetter
+                ? std::function<void(float)>{[obj, setter = prop.floatSetter](
+                                                 float value) {
+                    setter(obj, value);
+                  }}
+                : nullptr);
+      } else if (prop.doubleGetter || prop.doubleSetter) {
+        AddDoubleProperty(
+            prop.key,
+            prop.doubleGetter
+                ? std::function<double()>{[obj, getter = prop.doubleGetter] {
+                    return getter(obj);
+                  }}
+                : nullptr,
+            prop.doubleSetter
+                ? std::function<void(double)>{[obj,
+                                               setter = prop.doubleSetter](
+                                                  double value) {
+                    setter(obj, value);
+                  }}
+                : nullptr);
+      } else if (prop.stringGetter || prop.stringSetter) {
+        AddStringProperty(
+            prop.key,
+            prop.stringGetter
+                ? std::function<std::string()>{[obj,
+                                                getter = prop.stringGetter] {
+                    return getter(obj);
+                  }}
+                : nullptr,
+            prop.stringSetter
+                ? std::function<void(std::string_view)>{[obj, setter =
+                                                                  prop.stringSetter](
+                                                            std::string_view
+                                                                value) {
+                    setter(obj, value);
+                  }}
+                : nullptr);
+      }
+    }
+  }
+
   /**
    * Gets the kind of backend being used.
    *
@@ -0,0 +1,189 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace wpi {
+
+namespace detail {
+
+template <typename T>
+struct SendableMemberTraits;
+
+template <typename T, typename C>
+struct SendableMemberTraits<T C::*> {
+  using ClassType = C;
+  using MemberType = T;
+};
+
+template <typename T, auto Getter>
+constexpr auto SendableGetterThunk() {
+  using C = typename SendableMemberTraits<decltype(Getter)>::ClassType;
+  if constexpr (std::is_member_object_pointer_v<decltype(Getter)>) {
+    return +[](void* obj) -> T {
+      return static_cast<T>(static_cast<C*>(obj)->*Getter);
+    };
+  } else {
+    return +[](void* obj) -> T {
+      return static_cast<T>((static_cast<C*>(obj)->*Getter)());
+    };
+  }
+}
+
+template <typename T, auto Setter>
+constexpr auto SendableSetterThunk() {
+  if constexpr (std::is_same_v<decltype(Setter), std::nullptr_t>) {
+    return static_cast<void (*)(void*, T)>(nullptr);
+  } else {
+    using Traits = SendableMemberTraits<decltype(Setter)>;
+    using C = typename Traits::ClassType;
+    if constexpr (std::is_member_object_pointer_v<decltype(Setter)>) {
+      return +[](void* obj, T value) {
+        static_cast<C*>(obj)->*Setter =
+            static_cast<typename Traits::MemberType>(value);
+      };
+    } else {
+      return +[](void* obj, T value) {
+        (static_cast<C*>(obj)->*Setter)(value);
+      };
+    }
+  }
+}
+
+}  // namespace detail
+
+/**
+ * A single entry in a static Sendable property table: a property name plus
+ * type-erased getter/setter thunks that take the object pointer as a
+ * parameter.  Unlike the std::function overloads on SendableBuilder, entries
+ * are literal types, so a Sendable class can describe its properties once in
+ * a constexpr array shared by every instance and register them with
+ * SendableBuilder::AddPropertyTable() without allocating per-property
+ * closures:
+ *
+ * @code{.cpp}
+ * void Arm::InitSendable(wpi::SendableBuilder& builder) {
+ *   static constexpr wpi::SendableProperty kProperties[] = {
+ *       wpi::SendableProperty::Double<&Arm::GetAngle, &Arm::SetAngle>(
+ *           "angle"),
+ *       wpi::SendableProperty::Boolean<&Arm::IsStalled>("stalled")};
+ *   builder.SetSmartDashboardType("Arm");
+ *   builder.AddPropertyTable(this, kProperties);
+ * }
+ * @endcode
+ *
+ * The accessors may be pointers to data members or to member functions; a
+ * setter of nullptr (the default) makes the property read-only.  Exactly one
+ * type's getter/setter pair is non-null per entry.  Array and raw properties
+ * have no table form; use the std::function overloads for those.
+ */
+struct SendableProperty {
+  /** Property name. */
+  std::string_view key;
+
+  bool (*boolGetter)(void*) = nullptr;
+  void (*boolSetter)(void*, bool) = nullptr;
+  int64_t (*intGetter)(void*) = nullptr;
+  void (*intSetter)(void*, int64_t) = nullptr;
+  float (*floatGetter)(void*) = nullptr;
+  void (*floatSetter)(void*, float) = nullptr;
+  double (*doubleGetter)(void*) = nullptr;
+  void (*doubleSetter)(void*, double) = nullptr;
+  std::string (*stringGetter)(void*) = nullptr;
+  void (*stringSetter)(void*, std::string_view) = nullptr;
+
+  /**
+   * Create a boolean property entry.
+   *
+   * @tparam Getter member pointer called to get the value
+   * @tparam Setter member pointer called to set the value; nullptr for a
+   *                read-only property
+   * @param key property name
+   */
+  template <auto Getter, auto Setter = nullptr>
+  static constexpr SendableProperty Boolean(std::string_view key) {
+    SendableProperty prop;
+    prop.key = key;
+    prop.boolGetter = detail::SendableGetterThunk<bool, Getter>();
+    prop.boolSetter = detail::SendableSetterThunk<bool, Setter>();
+    return prop;
+  }
+
+  /**
+   * Create an integer property entry.
+   *
+   * @tparam Getter member pointer called to get the value
+   * @tparam Setter member pointer called to set the value; nullptr for a
+   *                read-only property
+   * @param key property name
+   */
+  template <auto Getter, auto Setter = nullptr>
+  static constexpr SendableProperty Integer(std::string_view key) {
+    SendableProperty prop;
+    prop.key = key;
+    prop.intGetter = detail::SendableGetterThunk<int64_t, Getter>();
+    prop.intSetter = detail::SendableSetterThunk<int64_t, Setter>();
+    return prop;
+  }
+
+  /**
+   * Create a float property entry.
+   *
+   * @tparam Getter member pointer called to get the value
+   * @tparam Setter member pointer called to set the value; nullptr for a
+   *                read-only property
+   * @param key property name
+   */
+  template <auto Getter, auto Setter = nullptr>
+  static constexpr SendableProperty Float(std::string_view key) {
+    SendableProperty prop;
+    prop.key = key;
+    prop.floatGetter = detail::SendableGetterThunk<float, Getter>();
+    prop.floatSetter = detail::SendableSetterThunk<float, Setter>();
+    return prop;
+  }
+
+  /**
+   * Create a double property entry.
+   *
+   * @tparam Getter member pointer called to get the value
+   * @tparam Setter member pointer called to set the value; nullptr for a
+   *                read-only property
+   * @param key property name
+   */
+  template <auto Getter, auto Setter = nullptr>
+  static constexpr SendableProperty Double(std::string_view key) {
+    SendableProperty prop;
+    prop.key = key;
+    prop.doubleGetter = detail::SendableGetterThunk<double, Getter>();
+    prop.doubleSetter = detail::SendableSetterThunk<double, Setter>();
+    return prop;
+  }
+
+  /**
+   * Create a string property entry.
+   *
+   * @tparam Getter member pointer called to get the value
+   * @tparam Setter member pointer called to set the value; nullptr for a
+   *                read-only property
+   * @param key property name
+   */
+  template <auto Getter, auto Setter = nullptr>
+  static constexpr SendableProperty String(std::string_view key) {
+    SendableProperty prop;
+    prop.key = key;
+    prop.stringGetter = detail::SendableGetterThunk<std::string, Getter>();
+    prop.stringSetter =
+        detail::SendableSetterThunk<std::string_view, Setter>();
+    return prop;
+  }
+};
+
+}  // namespace wpi
@@ -0,0 +1,152 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace wpi {
+
+/**
+ * A fixed-capacity ring buffer of time-ordered samples.  Storage is allocated
+ * once at construction; inserting and expiring samples never allocates, and
+ * lookups binary-search the timestamps through ring index arithmetic.
+ *
+ * Samples are kept sorted by time.  Appending at the end (the common case for
+ * periodic measurements) is O(1); inserting an out-of-order sample shifts the
+ * newer samples within the ring.  When the buffer is full, inserting drops
+ * the oldest sample (or the new one, if it is older than everything held).
+ *
+ * T must be default constructible.
+ *
+ * @tparam T sample type
+ */
+template <typename T>
+class time_series_buffer {
+ public:
+  /**
+   * Constructs a buffer.
+   *
+   * @param capacity maximum number of samples held
+   */
+  explicit time_series_buffer(size_t capacity) : m_storage(capacity) {}
+
+  /** Returns the number of samples in the buffer. */
+  size_t size() const { return m_size; }
+
+  /** Returns true if the buffer is empty. */
+  bool empty() const { return m_size == 0; }
+
+  /** Returns the maximum number of samples held. */
+  size_t capacity() const { return m_storage.size(); }
+
+  /** Empties the buffer (does not release storage). */
+  void clear() {
+    m_front = 0;
+    m_size = 0;
+  }
+
+  /** Returns the timestamp of the i'th oldest sample. */
+  double time(size_t i) const { return entry(i).first; }
+
+  /** Returns the value of the i'th oldest sample. */
+  T& value(size_t i) { return entry(i).second; }
+
+  /** Returns the value of the i'th oldest sample. */
+  const T& value(size_t i) const { return entry(i).second; }
+
+  /**
+   * Inserts a sample, keeping the buffer sorted by time.  If the buffer is
+   * full, the oldest sample is dropped to make room; a sample older than
+   * everything held by a full buffer is discarded.
+   *
+   * @param time sample timestamp
+   * @param value sample value
+   */
+  void insert(double time, T value) {
+    if (m_storage.empty()) {
+      return;
+    }
+    if (m_size == m_storage.size()) {
+      if (time < entry(0).first) {
+        return;
+      }
+      pop_front();
+    }
+    size_t pos = upper_bound(time);
+    for (size_t i = m_size; i > pos; --i) {
+      entry(i) = std::move(entry(i - 1));
+    }
+    entry(pos) = {time, std::move(value)};
+    ++m_size;
+  }
+
+  /** Removes the oldest sample. */
+  void pop_front() {
+    m_front = (m_front + 1) % m_storage.size();
+    --m_size;
+  }
+
+  /**
+   * Removes all samples with timestamps earlier than the given time.
+   *
+   * @param time expiration time
+   */
+  void expire_before(double time) {
+    while (m_size != 0 && entry(0).first < time) {
+      pop_front();
+    }
+  }
+
+  /**
+   * Returns the index of the first sample with timestamp not less than the
+   * given time, or size() if there is none.
+   *
+   * @param time search time
+   */
+  size_t lower_bound(double time) const {
+    size_t lo = 0;
+    size_t hi = m_size;
+    while (lo < hi) {
+      size_t mid = lo + (hi - lo) / 2;
+      if (entry(mid).first < time) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    return lo;
+  }
+
+ private:
+  // index of the first sample with timestamp greater than the given time
+  size_t upper_bound(double time) const {
+    size_t lo = 0;
+    size_t hi = m_size;
+    while (lo < hi) {
+      size_t mid = lo + (hi - lo) / 2;
+      if (entry(mid).first <= time) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    return lo;
+  }
+
+  std::pair<double, T>& entry(size_t i) {
+    return m_storage[(m_front + i) % m_storage.size()];
+  }
+  const std::pair<double, T>& entry(size_t i) const {
+    return m_storage[(m_front + i) % m_storage.size()];
+  }
+
+  std::vector<std::pair<double, T>> m_storage;
+  size_t m_front = 0;
+  size_t m_size = 0;
+};
+
+}  // namespace wpi
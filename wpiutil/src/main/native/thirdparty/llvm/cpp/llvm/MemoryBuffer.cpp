@@ -239,17 +239,20 @@ static std::unique_ptr<WritableMemoryBuffer> GetMemoryBufferForStream(
   do {
     buffer.resize_for_overwrite(buffer.size() + ChunkSize);
 #ifdef _WIN32
-    if (!ReadFile(f, buffer.end(), ChunkSize, &readBytes, nullptr)) {
+    if (!ReadFile(f, buffer.end() - ChunkSize, ChunkSize, &readBytes,
+                  nullptr)) {
       ec = mapWindowsError(GetLastError());
       return nullptr;
     }
 #else
-    readBytes = sys::RetryAfterSignal(-1, ::read, f, buffer.end(), ChunkSize);
+    readBytes = sys::RetryAfterSignal(-1, ::read, f, buffer.end() - ChunkSize,
+                                      ChunkSize);
     if (readBytes == -1) {
       ec = std::error_code(errno, std::generic_category());
       return nullptr;
     }
 #endif
+    buffer.truncate(buffer.size() - ChunkSize + readBytes);
   } while (readBytes != 0);
 
   return GetMemBufferCopyImpl(buffer, bufferName, ec);
@@ -367,7 +370,7 @@ static std::unique_ptr<WriteThroughMemoryBuffer> GetReadWriteFile(
 
       // If this not a file or a block device (e.g. it's a named pipe
       // or character device), we can't mmap it, so error out.
-      if (status.st_mode != S_IFREG && status.st_mode != S_IFBLK) {
+      if (!S_ISREG(status.st_mode) && !S_ISBLK(status.st_mode)) {
         ec = make_error_code(errc::invalid_argument);
         return nullptr;
       }
@@ -430,7 +433,7 @@ static std::unique_ptr<MB> GetOpenFileImpl(fs::file_t f,
       // If this not a file or a block device (e.g. it's a named pipe
       // or character device), we can't trust the size. Create the memory
       // buffer by copying off the stream.
-      if (status.st_mode != S_IFREG && status.st_mode != S_IFBLK) {
+      if (!S_ISREG(status.st_mode) && !S_ISBLK(status.st_mode)) {
         return GetMemoryBufferForStream(f, filename, ec);
       }
 
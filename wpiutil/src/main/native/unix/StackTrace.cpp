@@ -13,16 +13,28 @@
 
 namespace wpi {
 
-std::string GetStackTraceDefault(int offset) {
+std::vector<void*> CaptureStackTrace(int offset) {
   void* stackTrace[128];
   int stackSize = backtrace(stackTrace, 128);
-  char** mangledSymbols = backtrace_symbols(stackTrace, stackSize);
+  // +1 skips this function's own frame
+  int start = offset + 1;
+  if (start > stackSize) {
+    start = stackSize;
+  }
+  return std::vector<void*>(stackTrace + start, stackTrace + stackSize);
+}
+
+std::string SymbolizeStackTrace(std::span<void* const> frames) {
+  if (frames.empty()) {
+    return {};
+  }
+  char** mangledSymbols = backtrace_symbols(frames.data(), frames.size());
   wpi::SmallString<1024> buf;
   wpi::raw_svector_ostream trace(buf);
 
-  for (int i = offset; i < stackSize; i++) {
+  for (size_t i = 0; i < frames.size(); i++) {
     // Only print recursive functions once in a row.
-    if (i == 0 || stackTrace[i] != stackTrace[i - 1]) {
+    if (i == 0 || frames[i] != frames[i - 1]) {
       // extract just function name from "pathToExe(functionName+offset)"
       std::string_view sym = split(mangledSymbols[i], '(').second;
       std::string_view offset;
@@ -38,4 +50,10 @@ std::string GetStackTraceDefault(int offset) {
   return std::string{trace.str()};
 }
 
+std::string GetStackTraceDefault(int offset) {
+  // CaptureStackTrace skips its own frame, so the offset stays relative to
+  // this function's caller chain as before
+  return SymbolizeStackTrace(CaptureStackTrace(offset));
+}
+
 }  // namespace wpi
@@ -5,6 +5,7 @@
 #include "wpi/StackTrace.h"
 
 #include "StackWalker.h"
+#include "fmt/format.h"
 #include "wpi/ConvertUTF.h"
 #include "wpi/SmallString.h"
 
@@ -41,6 +42,24 @@ std::string GetStackTraceDefault(int offset) {
   return output;
 }
 
+std::vector<void*> CaptureStackTrace(int offset) {
+  void* stackTrace[128];
+  // +1 skips this function's own frame
+  USHORT stackSize =
+      CaptureStackBackTrace(offset + 1, 128, stackTrace, nullptr);
+  return std::vector<void*>(stackTrace, stackTrace + stackSize);
+}
+
+std::string SymbolizeStackTrace(std::span<void* const> frames) {
+  // TODO: symbol lookup (the synchronous walker above doesn't do it either);
+  // report raw addresses
+  std::string output;
+  for (auto frame : frames) {
+    output += fmt::format("\tat {}\n", frame);
+  }
+  return output;
+}
+
 }  // namespace wpi
 
 #endif  // defined(_MSC_VER)
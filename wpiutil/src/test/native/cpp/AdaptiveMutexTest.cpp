@@ -0,0 +1,37 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "wpi/mutex.h"  // NOLINT(build/include_order)
+
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+TEST(AdaptiveMutexTest, TryLock) {
+  wpi::adaptive_mutex mutex;
+  ASSERT_TRUE(mutex.try_lock());
+  std::thread other([&] { EXPECT_FALSE(mutex.try_lock()); });
+  other.join();
+  mutex.unlock();
+}
+
+TEST(AdaptiveMutexTest, MutualExclusion) {
+  wpi::adaptive_mutex mutex;
+  int counter = 0;
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&] {
+      for (int i = 0; i < 10000; ++i) {
+        std::scoped_lock lock(mutex);
+        ++counter;
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(counter, 40000);
+}
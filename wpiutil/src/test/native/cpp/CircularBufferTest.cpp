@@ -252,3 +252,106 @@ TEST(CircularBufferTest, Iterator) {
     ++i;
   }
 }
+
+TEST(CircularBufferTest, DataSpans) {
+  wpi::circular_buffer<double> queue(4);
+
+  queue.push_back(1.0);
+  queue.push_back(2.0);
+  queue.push_back(3.0);
+
+  // Contents don't wrap yet; everything is in the first span
+  auto [first, second] = queue.data_spans();
+  ASSERT_EQ(3u, first.size());
+  EXPECT_EQ(1.0, first[0]);
+  EXPECT_EQ(2.0, first[1]);
+  EXPECT_EQ(3.0, first[2]);
+  EXPECT_TRUE(second.empty());
+
+  queue.push_back(4.0);
+  queue.push_back(5.0);  // Overwrite 1 with 5; contents now wrap
+
+  // The buffer contains 2, 3, 4, 5
+  auto [front, back] = queue.data_spans();
+  ASSERT_EQ(3u, front.size());
+  EXPECT_EQ(2.0, front[0]);
+  EXPECT_EQ(3.0, front[1]);
+  EXPECT_EQ(4.0, front[2]);
+  ASSERT_EQ(1u, back.size());
+  EXPECT_EQ(5.0, back[0]);
+}
+
+TEST(CircularBufferTest, MakeContiguous) {
+  wpi::circular_buffer<double> queue(4);
+
+  queue.push_back(1.0);
+  queue.push_back(2.0);
+  queue.push_back(3.0);
+  queue.push_back(4.0);
+  queue.push_back(5.0);  // Overwrite 1 with 5; contents now wrap
+
+  auto span = queue.make_contiguous();
+  ASSERT_EQ(4u, span.size());
+  EXPECT_EQ(2.0, span[0]);
+  EXPECT_EQ(3.0, span[1]);
+  EXPECT_EQ(4.0, span[2]);
+  EXPECT_EQ(5.0, span[3]);
+
+  // Contents are now contiguous in the second span-free view
+  auto [first, second] = queue.data_spans();
+  EXPECT_EQ(4u, first.size());
+  EXPECT_TRUE(second.empty());
+
+  // Element access is unchanged
+  EXPECT_EQ(2.0, queue[0]);
+  EXPECT_EQ(5.0, queue[3]);
+}
+
+TEST(CircularBufferTest, BulkPushBack) {
+  wpi::circular_buffer<double> queue(4);
+
+  const std::array<double, 3> in1 = {1.0, 2.0, 3.0};
+  queue.push_back(std::span{in1});
+  EXPECT_EQ(3u, queue.size());
+  EXPECT_EQ(1.0, queue[0]);
+  EXPECT_EQ(3.0, queue[2]);
+
+  // Push enough to overwrite the front; buffer becomes 3, 4, 5, 6
+  const std::array<double, 3> in2 = {4.0, 5.0, 6.0};
+  queue.push_back(std::span{in2});
+  EXPECT_EQ(4u, queue.size());
+  EXPECT_EQ(3.0, queue[0]);
+  EXPECT_EQ(4.0, queue[1]);
+  EXPECT_EQ(5.0, queue[2]);
+  EXPECT_EQ(6.0, queue[3]);
+
+  // A span larger than the buffer keeps only the last size() values
+  const std::array<double, 6> in3 = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+  queue.push_back(std::span{in3});
+  EXPECT_EQ(4u, queue.size());
+  EXPECT_EQ(3.0, queue[0]);
+  EXPECT_EQ(6.0, queue[3]);
+}
+
+TEST(CircularBufferTest, BulkPopFront) {
+  wpi::circular_buffer<double> queue(4);
+
+  queue.push_back(1.0);
+  queue.push_back(2.0);
+  queue.push_back(3.0);
+  queue.push_back(4.0);
+  queue.push_back(5.0);  // Overwrite 1 with 5; contents now wrap
+
+  std::array<double, 3> out;
+  EXPECT_EQ(3u, queue.pop_front(std::span{out}));
+  EXPECT_EQ(2.0, out[0]);
+  EXPECT_EQ(3.0, out[1]);
+  EXPECT_EQ(4.0, out[2]);
+  EXPECT_EQ(1u, queue.size());
+
+  // Popping more than remains only pops what's left
+  EXPECT_EQ(1u, queue.pop_front(std::span{out}));
+  EXPECT_EQ(5.0, out[0]);
+  EXPECT_EQ(0u, queue.size());
+  EXPECT_EQ(0u, queue.pop_front(std::span{out}));
+}
@@ -0,0 +1,304 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <stdint.h>
+
+#include <chrono>
+#include <cstring>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "gtest/gtest.h"
+#include "wpi/DataLog.h"
+#include "wpi/DataLogReader.h"
+#include "wpi/MemoryBuffer.h"
+#include "wpi/fs.h"
+
+namespace {
+
+// compressed frame header: 4-byte magic, 4-byte LE uncompressed length,
+// 4-byte LE compressed length (equal lengths mean the frame is stored raw)
+constexpr char kFrameMagic[] = "WPLZ";
+
+struct Frame {
+  size_t pos;  // file offset of the frame header
+  uint32_t uncompSize;
+  uint32_t compSize;
+};
+
+uint32_t Read32le(const uint8_t* p) {
+  return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+         (static_cast<uint32_t>(p[2]) << 16) |
+         (static_cast<uint32_t>(p[3]) << 24);
+}
+
+// parses the chain of complete compressed frames following the file header
+std::vector<Frame> ParseFrames(const std::vector<uint8_t>& buf) {
+  std::vector<Frame> frames;
+  if (buf.size() < 12) {
+    return frames;
+  }
+  size_t pos = 12 + Read32le(&buf[8]);  // skip header and extra header
+  while (pos + 12 <= buf.size() &&
+         std::memcmp(&buf[pos], kFrameMagic, 4) == 0) {
+    Frame frame{pos, Read32le(&buf[pos + 4]), Read32le(&buf[pos + 8])};
+    if (frame.compSize > buf.size() - pos - 12) {
+      break;
+    }
+    frames.push_back(frame);
+    pos += 12 + frame.compSize;
+  }
+  return frames;
+}
+
+std::vector<uint8_t> ReadFileBytes(const fs::path& path) {
+  std::error_code ec;
+  auto buf = wpi::MemoryBuffer::GetFile(path.string(), ec);
+  if (!buf) {
+    return {};
+  }
+  auto data = buf->GetBuffer();
+  return {data.begin(), data.end()};
+}
+
+class DataLogCompressionTest : public ::testing::Test {
+ protected:
+  fs::path MakeLogPath() {
+    auto path =
+        fs::path{::testing::TempDir()} /
+        fmt::format(
+            "{}.wpilog",
+            ::testing::UnitTest::GetInstance()->current_test_info()->name());
+    fs::remove(path);
+    return path;
+  }
+};
+
+TEST_F(DataLogCompressionTest, RoundTrip) {
+  auto path = MakeLogPath();
+  std::vector<std::string> values;
+  for (int i = 0; i < 100; ++i) {
+    values.emplace_back(fmt::format("compressible value {:03}", i % 10));
+  }
+  {
+    wpi::log::DataLog log{path.parent_path().string(),
+                          path.filename().string(), 0.25, "", true};
+    int entry = log.Start("test", "string", "", 1);
+    for (size_t i = 0; i < values.size(); ++i) {
+      log.AppendString(entry, values[i], 2 + i);
+    }
+  }
+
+  auto bytes = ReadFileBytes(path);
+  ASSERT_GE(bytes.size(), 24u);
+  // data after the header must be compressed frames
+  auto frames = ParseFrames(bytes);
+  ASSERT_FALSE(frames.empty());
+  // repetitive data must actually compress
+  EXPECT_LT(frames[0].compSize, frames[0].uncompSize);
+
+  wpi::log::DataLogReader reader{
+      wpi::MemoryBuffer::GetMemBufferCopy(bytes, "test")};
+  ASSERT_TRUE(reader.IsValid());
+  size_t next = 0;
+  for (auto&& record : reader) {
+    if (record.IsControl()) {
+      continue;
+    }
+    std::string_view value;
+    ASSERT_TRUE(record.GetString(&value));
+    ASSERT_LT(next, values.size());
+    EXPECT_EQ(value, values[next]);
+    EXPECT_EQ(record.GetTimestamp(), static_cast<int64_t>(2 + next));
+    ++next;
+  }
+  EXPECT_EQ(next, values.size());
+}
+
+TEST_F(DataLogCompressionTest, IncompressibleStoredRaw) {
+  auto path = MakeLogPath();
+  std::vector<uint8_t> noise(64 * 1024);
+  std::mt19937 gen{12345};  // fixed seed for reproducibility
+  std::uniform_int_distribution<unsigned int> dist{0, 255};
+  for (auto& b : noise) {
+    b = static_cast<uint8_t>(dist(gen));
+  }
+  {
+    wpi::log::DataLog log{path.parent_path().string(),
+                          path.filename().string(), 0.25, "", true};
+    int entry = log.Start("noise", "raw", "", 1);
+    log.AppendRaw(entry, noise, 2);
+  }
+
+  auto bytes = ReadFileBytes(path);
+  auto frames = ParseFrames(bytes);
+  ASSERT_FALSE(frames.empty());
+  // random data is incompressible, so the frame must be stored raw
+  EXPECT_EQ(frames[0].compSize, frames[0].uncompSize);
+
+  wpi::log::DataLogReader reader{
+      wpi::MemoryBuffer::GetMemBufferCopy(bytes, "test")};
+  ASSERT_TRUE(reader.IsValid());
+  bool found = false;
+  for (auto&& record : reader) {
+    if (!record.IsControl()) {
+      auto data = record.GetRaw();
+      ASSERT_EQ(data.size(), noise.size());
+      EXPECT_EQ(std::memcmp(data.data(), noise.data(), noise.size()), 0);
+      found = true;
+    }
+  }
+  EXPECT_TRUE(found);
+}
+
+TEST_F(DataLogCompressionTest, TruncatedOnlyFrame) {
+  auto path = MakeLogPath();
+  {
+    wpi::log::DataLog log{path.parent_path().string(),
+                          path.filename().string(), 0.25, "", true};
+    int entry = log.Start("test", "string", "", 1);
+    log.AppendString(entry, "hello", 2);
+  }
+
+  auto bytes = ReadFileBytes(path);
+  auto frames = ParseFrames(bytes);
+  ASSERT_FALSE(frames.empty());
+  // cut the file off partway into the first frame's data
+  bytes.resize(frames[0].pos + 12 + frames[0].compSize / 2);
+
+  wpi::log::DataLogReader reader{
+      wpi::MemoryBuffer::GetMemBufferCopy(bytes, "test")};
+  // the header survives, but the truncated frame must be dropped cleanly
+  ASSERT_TRUE(reader.IsValid());
+  int records = 0;
+  for (auto&& record : reader) {
+    if (record.GetEntry() >= 0) {
+      ++records;
+    }
+  }
+  EXPECT_EQ(records, 0);
+}
+
+TEST_F(DataLogCompressionTest, TruncatedFinalFrame) {
+  auto path = MakeLogPath();
+  {
+    wpi::log::DataLog log{path.parent_path().string(),
+                          path.filename().string(), 0.25, "", true};
+    int entry = log.Start("test", "string", "", 1);
+    log.AppendString(entry, "first frame", 2);
+    log.Flush();
+    // wait for the first frame to land on disk so the second batch goes into
+    // a later frame
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (ParseFrames(ReadFileBytes(path)).empty() &&
+           std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_FALSE(ParseFrames(ReadFileBytes(path)).empty());
+    log.AppendString(entry, "second frame", 3);
+  }
+
+  auto bytes = ReadFileBytes(path);
+  auto frames = ParseFrames(bytes);
+  ASSERT_GE(frames.size(), 2u);
+  // cut the file off partway into the first frame written after the first
+  // batch; that truncated frame and everything after it must be dropped
+  bytes.resize(frames[1].pos + 12 + frames[1].compSize / 2);
+
+  wpi::log::DataLogReader reader{
+      wpi::MemoryBuffer::GetMemBufferCopy(bytes, "test")};
+  ASSERT_TRUE(reader.IsValid());
+  bool foundFirst = false;
+  for (auto&& record : reader) {
+    if (record.IsControl()) {
+      continue;
+    }
+    std::string_view value;
+    ASSERT_TRUE(record.GetString(&value));
+    EXPECT_NE(value, "second frame");
+    if (value == "first frame") {
+      foundFirst = true;
+    }
+  }
+  EXPECT_TRUE(foundFirst);
+}
+
+TEST_F(DataLogCompressionTest, MalformedFrameData) {
+  auto path = MakeLogPath();
+  {
+    wpi::log::DataLog log{path.parent_path().string(),
+                          path.filename().string(), 0.25, "", true};
+    int entry = log.Start("test", "string", "", 1);
+    for (int i = 0; i < 50; ++i) {
+      log.AppendString(entry, "first frame", 2 + i);
+    }
+    log.Flush();
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (ParseFrames(ReadFileBytes(path)).empty() &&
+           std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_FALSE(ParseFrames(ReadFileBytes(path)).empty());
+    // a compressible second batch, so the frame holding it is actually
+    // LZ4-encoded rather than stored raw
+    for (int i = 0; i < 50; ++i) {
+      log.AppendString(entry, "second frame", 100 + i);
+    }
+  }
+
+  auto bytes = ReadFileBytes(path);
+  auto frames = ParseFrames(bytes);
+  ASSERT_GE(frames.size(), 2u);
+  // overwrite the second frame's compressed data with garbage LZ4 tokens;
+  // the frame must actually be compressed for corruption to be detectable
+  auto& frame = frames[1];
+  ASSERT_LT(frame.compSize, frame.uncompSize);
+  std::memset(&bytes[frame.pos + 12], 0xf7, frame.compSize);
+
+  wpi::log::DataLogReader reader{
+      wpi::MemoryBuffer::GetMemBufferCopy(bytes, "test")};
+  // decompression must fail cleanly, keeping the frames before the corrupt
+  // one and dropping the rest
+  ASSERT_TRUE(reader.IsValid());
+  size_t firstCount = 0;
+  for (auto&& record : reader) {
+    if (record.IsControl()) {
+      continue;
+    }
+    std::string_view value;
+    ASSERT_TRUE(record.GetString(&value));
+    EXPECT_EQ(value, "first frame");
+    ++firstCount;
+  }
+  EXPECT_EQ(firstCount, 50u);
+}
+
+TEST_F(DataLogCompressionTest, MalformedFrameHeader) {
+  // hand-built log: valid file header followed by a frame whose payload is
+  // garbage and whose sizes don't describe real LZ4 data
+  std::vector<uint8_t> bytes = {'W', 'P', 'I', 'L', 'O', 'G',
+                                0,   1,           // version 1.0
+                                0,   0,   0, 0};  // no extra header
+  bytes.insert(bytes.end(), {'W', 'P', 'L', 'Z'});
+  bytes.insert(bytes.end(), {100, 0, 0, 0});  // uncompressed length 100
+  bytes.insert(bytes.end(), {4, 0, 0, 0});    // compressed length 4
+  bytes.insert(bytes.end(), {0xf0, 0xff, 0xff, 0xff});  // invalid tokens
+
+  wpi::log::DataLogReader reader{
+      wpi::MemoryBuffer::GetMemBufferCopy(bytes, "test")};
+  ASSERT_TRUE(reader.IsValid());
+  int records = 0;
+  for (auto&& record : reader) {
+    if (record.GetEntry() >= 0) {
+      ++records;
+    }
+  }
+  EXPECT_EQ(records, 0);
+}
+
+}  // namespace
@@ -0,0 +1,225 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <stdint.h>
+
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "gtest/gtest.h"
+#include "wpi/DataLog.h"
+#include "wpi/DataLogReader.h"
+#include "wpi/MemoryBuffer.h"
+#include "wpi/fs.h"
+
+namespace {
+
+std::vector<uint8_t> ReadFileBytes(const fs::path& path) {
+  std::error_code ec;
+  auto buf = wpi::MemoryBuffer::GetFile(path.string(), ec);
+  if (!buf) {
+    return {};
+  }
+  auto data = buf->GetBuffer();
+  return {data.begin(), data.end()};
+}
+
+wpi::log::DataLogReader MakeReader(const std::vector<uint8_t>& bytes) {
+  return wpi::log::DataLogReader{
+      wpi::MemoryBuffer::GetMemBufferCopy(bytes, "test")};
+}
+
+class DataLogIndexTest : public ::testing::Test {
+ protected:
+  // Index records are emitted roughly every 4 MiB of log data, so the big
+  // entry gets enough volume for the writer to emit a mid-file index record;
+  // the tail records are written after it so that chopping off the end of
+  // the file destroys only the final index record.
+  static constexpr int kBigCount = 90;       // total big records
+  static constexpr int kBigTail = 10;        // written after the mid index
+  static constexpr size_t kBigSize = 65536;  // bytes per big record
+  static constexpr int kSmallCount = 3;      // small records, first part only
+
+  fs::path MakeLogPath() {
+    auto path =
+        fs::path{::testing::TempDir()} /
+        fmt::format(
+            "{}.wpilog",
+            ::testing::UnitTest::GetInstance()->current_test_info()->name());
+    fs::remove(path);
+    return path;
+  }
+
+  static std::string BigValue(int i) {
+    return std::string(kBigSize, static_cast<char>('a' + (i % 26)));
+  }
+
+  // Writes a log with one high-volume entry ("big") spread across the whole
+  // file and one low-volume entry ("small") confined to the first index
+  // block, so later index blocks contain no records for it.  Waits for the
+  // mid-file index record to hit the disk before appending the tail records,
+  // which the final index record (written at close) then covers.  Returns
+  // the entry IDs via the out parameters.
+  void WriteLog(const fs::path& path, bool compress, int* bigOut,
+                int* smallOut) {
+    wpi::log::DataLog log{path.parent_path().string(),
+                          path.filename().string(), 0.25, "", compress};
+    int big = log.Start("big", "string", "", 1);
+    int small = log.Start("small", "string", "", 1);
+    for (int i = 0; i < kSmallCount; ++i) {
+      log.AppendString(small, fmt::format("small {}", i), 2000 + i);
+    }
+    for (int i = 0; i < kBigCount - kBigTail; ++i) {
+      log.AppendString(big, BigValue(i), 1000 + i);
+    }
+    log.Flush();
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (MakeReader(ReadFileBytes(path)).GetIndexBlocks().empty() &&
+           std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_FALSE(MakeReader(ReadFileBytes(path)).GetIndexBlocks().empty());
+    for (int i = kBigCount - kBigTail; i < kBigCount; ++i) {
+      log.AppendString(big, BigValue(i), 1000 + i);
+    }
+    *bigOut = big;
+    *smallOut = small;
+  }
+
+  void CheckSmallRecords(const std::vector<wpi::log::DataLogRecord>& records) {
+    ASSERT_EQ(records.size(), static_cast<size_t>(kSmallCount));
+    for (int i = 0; i < kSmallCount; ++i) {
+      std::string_view value;
+      ASSERT_TRUE(records[i].GetString(&value));
+      EXPECT_EQ(value, fmt::format("small {}", i));
+      EXPECT_EQ(records[i].GetTimestamp(), 2000 + i);
+    }
+  }
+};
+
+TEST_F(DataLogIndexTest, CleanClose) {
+  auto path = MakeLogPath();
+  int big, small;
+  WriteLog(path, false, &big, &small);
+
+  auto bytes = ReadFileBytes(path);
+  // a cleanly closed file ends with the index trailer
+  ASSERT_GE(bytes.size(), 16u);
+  EXPECT_EQ(std::memcmp(&bytes[bytes.size() - 16],
+                        wpi::log::impl::kIndexTrailerMagic, 8),
+            0);
+
+  auto reader = MakeReader(bytes);
+  ASSERT_TRUE(reader.IsValid());
+  auto blocks = reader.GetIndexBlocks();
+  ASSERT_GE(blocks.size(), 2u);
+  // blocks are in file order, separated only by the index records themselves
+  for (size_t i = 1; i < blocks.size(); ++i) {
+    EXPECT_GT(blocks[i].blockStart, blocks[i - 1].blockEnd);
+  }
+  // the small entry is confined to the first block, so at least one later
+  // block has no records for it (the case the indexed lookup skips)
+  bool haveBlockWithoutSmall = false;
+  unsigned int indexedSmallCount = 0;
+  for (auto&& block : blocks) {
+    bool hasSmall = false;
+    for (auto&& [id, num] : block.entries) {
+      if (id == small) {
+        hasSmall = true;
+        indexedSmallCount += num;
+      }
+    }
+    if (!hasSmall) {
+      haveBlockWithoutSmall = true;
+    }
+  }
+  EXPECT_TRUE(haveBlockWithoutSmall);
+  EXPECT_EQ(indexedSmallCount, static_cast<unsigned int>(kSmallCount));
+
+  CheckSmallRecords(reader.GetEntryRecords(small));
+
+  auto bigRecords = reader.GetEntryRecords(big);
+  ASSERT_EQ(bigRecords.size(), static_cast<size_t>(kBigCount));
+  for (int i = 0; i < kBigCount; ++i) {
+    std::string_view value;
+    ASSERT_TRUE(bigRecords[i].GetString(&value));
+    EXPECT_EQ(value, BigValue(i));
+    EXPECT_EQ(bigRecords[i].GetTimestamp(), 1000 + i);
+  }
+}
+
+TEST_F(DataLogIndexTest, ScanFallbackAfterUncleanClose) {
+  auto path = MakeLogPath();
+  int big, small;
+  WriteLog(path, false, &big, &small);
+
+  auto bytes = ReadFileBytes(path);
+  // chop off the tail (including the trailer), as if the process died before
+  // the file was cleanly closed
+  ASSERT_GT(bytes.size(), 1000u);
+  bytes.resize(bytes.size() - 1000);
+  ASSERT_NE(std::memcmp(&bytes[bytes.size() - 16],
+                        wpi::log::impl::kIndexTrailerMagic, 8),
+            0);
+
+  auto reader = MakeReader(bytes);
+  ASSERT_TRUE(reader.IsValid());
+  // no trailer, so the index must be recovered by scanning the log
+  auto blocks = reader.GetIndexBlocks();
+  ASSERT_FALSE(blocks.empty());
+
+  // the small entry's records are all inside the surviving blocks
+  CheckSmallRecords(reader.GetEntryRecords(small));
+
+  // the indexed lookup covers exactly the records the surviving blocks
+  // describe
+  unsigned int indexedBigCount = 0;
+  for (auto&& block : blocks) {
+    for (auto&& [id, num] : block.entries) {
+      if (id == big) {
+        indexedBigCount += num;
+      }
+    }
+  }
+  EXPECT_EQ(reader.GetEntryRecords(big).size(), indexedBigCount);
+}
+
+TEST_F(DataLogIndexTest, CompressedIndexedLookup) {
+  auto path = MakeLogPath();
+  int big, small;
+  WriteLog(path, true, &big, &small);
+
+  auto bytes = ReadFileBytes(path);
+  // the raw file is compressed frames...
+  ASSERT_GE(bytes.size(), 16u);
+  EXPECT_EQ(std::memcmp(&bytes[12], "WPLZ", 4), 0);
+
+  // ...but index offsets are logical (post-decompression) offsets, so the
+  // indexed lookup must work transparently on the expanded log
+  auto reader = MakeReader(bytes);
+  ASSERT_TRUE(reader.IsValid());
+  auto blocks = reader.GetIndexBlocks();
+  ASSERT_GE(blocks.size(), 2u);
+  for (size_t i = 1; i < blocks.size(); ++i) {
+    EXPECT_GT(blocks[i].blockStart, blocks[i - 1].blockEnd);
+  }
+
+  CheckSmallRecords(reader.GetEntryRecords(small));
+
+  auto bigRecords = reader.GetEntryRecords(big);
+  ASSERT_EQ(bigRecords.size(), static_cast<size_t>(kBigCount));
+  for (int i = 0; i < kBigCount; ++i) {
+    std::string_view value;
+    ASSERT_TRUE(bigRecords[i].GetString(&value));
+    EXPECT_EQ(value, BigValue(i));
+    EXPECT_EQ(bigRecords[i].GetTimestamp(), 1000 + i);
+  }
+}
+
+}  // namespace
@@ -0,0 +1,102 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "wpi/EventVector.h"  // NOLINT(build/include_order)
+
+#include <thread>
+
+#include "gtest/gtest.h"
+
+TEST(EventVectorTest, WakeupAll) {
+  wpi::EventVector eventVector;
+  auto event1 = wpi::CreateEvent(false, false);
+  auto event2 = wpi::CreateEvent(false, false);
+  eventVector.Add(event1);
+  eventVector.Add(event2);
+
+  eventVector.Wakeup();
+
+  bool timedOut;
+  wpi::WaitForObject(event1, 0, &timedOut);
+  ASSERT_FALSE(timedOut);
+  wpi::WaitForObject(event2, 0, &timedOut);
+  ASSERT_FALSE(timedOut);
+
+  wpi::DestroyEvent(event1);
+  wpi::DestroyEvent(event2);
+}
+
+TEST(EventVectorTest, Remove) {
+  wpi::EventVector eventVector;
+  auto event1 = wpi::CreateEvent(false, false);
+  auto event2 = wpi::CreateEvent(false, false);
+  eventVector.Add(event1);
+  eventVector.Add(event2);
+  eventVector.Remove(event1);
+
+  eventVector.Wakeup();
+
+  bool timedOut;
+  wpi::WaitForObject(event1, 0, &timedOut);
+  ASSERT_TRUE(timedOut);
+  wpi::WaitForObject(event2, 0, &timedOut);
+  ASSERT_FALSE(timedOut);
+
+  wpi::DestroyEvent(event1);
+  wpi::DestroyEvent(event2);
+}
+
+TEST(EventVectorTest, WakeupOneRotates) {
+  wpi::EventVector eventVector;
+  auto event1 = wpi::CreateEvent(false, false);
+  auto event2 = wpi::CreateEvent(false, false);
+  eventVector.Add(event1);
+  eventVector.Add(event2);
+
+  // each call signals exactly one event, alternating between the two
+  eventVector.WakeupOne();
+  eventVector.WakeupOne();
+
+  bool timedOut;
+  wpi::WaitForObject(event1, 0, &timedOut);
+  ASSERT_FALSE(timedOut);
+  wpi::WaitForObject(event2, 0, &timedOut);
+  ASSERT_FALSE(timedOut);
+
+  // only one of the two is signaled now
+  eventVector.WakeupOne();
+  bool timedOut1;
+  bool timedOut2;
+  wpi::WaitForObject(event1, 0, &timedOut1);
+  wpi::WaitForObject(event2, 0, &timedOut2);
+  ASSERT_NE(timedOut1, timedOut2);
+
+  wpi::DestroyEvent(event1);
+  wpi::DestroyEvent(event2);
+}
+
+TEST(EventVectorTest, ConcurrentWakeupAndAdd) {
+  wpi::EventVector eventVector;
+  auto event = wpi::CreateEvent(false, false);
+  eventVector.Add(event);
+
+  std::atomic<bool> done{false};
+  std::thread waker([&] {
+    while (!done) {
+      eventVector.Wakeup();
+    }
+  });
+
+  // mutate the list while the waker is spinning on snapshots
+  for (int i = 0; i < 1000; ++i) {
+    auto extra = wpi::CreateEvent(false, false);
+    eventVector.Add(extra);
+    eventVector.Remove(extra);
+    wpi::DestroyEvent(extra);
+  }
+  done = true;
+  waker.join();
+
+  wpi::DestroyEvent(event);
+}
@@ -0,0 +1,88 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "wpi/flat_interpolating_map.h"  // NOLINT(build/include_order)
+
+#include <gtest/gtest.h>
+
+TEST(FlatInterpolatingMapTest, Insert) {
+  wpi::flat_interpolating_map<double, double> table;
+
+  table.insert(125, 450);
+  table.insert(200, 510);
+  table.insert(268, 525);
+  table.insert(312, 550);
+  table.insert(326, 650);
+
+  // Key below minimum gives smallest value
+  EXPECT_EQ(450, table[100]);
+
+  // Minimum key gives exact value
+  EXPECT_EQ(450, table[125]);
+
+  // Key gives interpolated value
+  EXPECT_EQ(480, table[162.5]);
+
+  // Key at right of interpolation range gives exact value
+  EXPECT_EQ(510, table[200]);
+
+  // Maximum key gives exact value
+  EXPECT_EQ(650, table[326]);
+
+  // Key above maximum gives largest value
+  EXPECT_EQ(650, table[400]);
+}
+
+TEST(FlatInterpolatingMapTest, UnorderedInsert) {
+  wpi::flat_interpolating_map<double, double> table;
+
+  // inserts in arbitrary order produce the same sorted table
+  table.insert(326, 650);
+  table.insert(125, 450);
+  table.insert(312, 550);
+  table.insert(200, 510);
+  table.insert(268, 525);
+
+  EXPECT_EQ(5u, table.size());
+  EXPECT_EQ(480, table[162.5]);
+
+  // duplicate key leaves the table unchanged
+  table.insert(200, 9999);
+  EXPECT_EQ(5u, table.size());
+  EXPECT_EQ(510, table[200]);
+}
+
+TEST(FlatInterpolatingMapTest, Batch) {
+  wpi::flat_interpolating_map<double, double> table;
+
+  table.insert(125, 450);
+  table.insert(200, 510);
+  table.insert(268, 525);
+  table.insert(312, 550);
+  table.insert(326, 650);
+
+  double keys[] = {100, 162.5, 200, 400};
+  double values[4];
+  table.interpolate(keys, values);
+
+  EXPECT_EQ(450, values[0]);
+  EXPECT_EQ(480, values[1]);
+  EXPECT_EQ(510, values[2]);
+  EXPECT_EQ(650, values[3]);
+}
+
+TEST(FlatInterpolatingMapTest, Clear) {
+  wpi::flat_interpolating_map<double, double> table;
+
+  table.insert(125, 450);
+  table.insert(200, 510);
+
+  table.clear();
+  EXPECT_TRUE(table.empty());
+
+  table.insert(100, 250);
+  table.insert(200, 500);
+
+  EXPECT_EQ(375, table[150]);
+}
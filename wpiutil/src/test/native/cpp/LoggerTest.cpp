@@ -0,0 +1,83 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "wpi/Logger.h"  // NOLINT(build/include_order)
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+TEST(LoggerTest, Eager) {
+  std::vector<std::string> messages;
+  wpi::Logger logger{[&](unsigned int level, const char* file,
+                         unsigned int line,
+                         const char* msg) { messages.emplace_back(msg); }};
+
+  WPI_INFO(logger, "count={}", 42);
+  ASSERT_EQ(messages.size(), 1u);
+  EXPECT_EQ(messages[0], "count=42");
+}
+
+TEST(LoggerTest, DeferredFormatsAtProcess) {
+  std::vector<std::string> messages;
+  wpi::Logger logger{[&](unsigned int level, const char* file,
+                         unsigned int line,
+                         const char* msg) { messages.emplace_back(msg); }};
+  logger.SetDeferred();
+
+  WPI_INFO(logger, "{} {} {} {}", 1, 2.5, true, 'x');
+  EXPECT_TRUE(messages.empty());
+
+  logger.ProcessDeferred();
+  ASSERT_EQ(messages.size(), 1u);
+  EXPECT_EQ(messages[0], "1 2.5 true x");
+}
+
+TEST(LoggerTest, DeferredCopiesStringContents) {
+  std::vector<std::string> messages;
+  wpi::Logger logger{[&](unsigned int level, const char* file,
+                         unsigned int line,
+                         const char* msg) { messages.emplace_back(msg); }};
+  logger.SetDeferred();
+
+  {
+    std::string name = "topic";
+    WPI_INFO(logger, "publish {}", name);
+  }  // temporary dies before formatting
+
+  logger.ProcessDeferred();
+  ASSERT_EQ(messages.size(), 1u);
+  EXPECT_EQ(messages[0], "publish topic");
+}
+
+TEST(LoggerTest, DeferredFallsBackWhenFull) {
+  std::vector<std::string> messages;
+  wpi::Logger logger{[&](unsigned int level, const char* file,
+                         unsigned int line,
+                         const char* msg) { messages.emplace_back(msg); }};
+  logger.SetDeferred(2);
+
+  for (int i = 0; i < 10; ++i) {
+    WPI_INFO(logger, "msg {}", i);
+  }
+  // ring holds 2; the rest were formatted eagerly, none lost
+  EXPECT_EQ(messages.size(), 8u);
+  logger.ProcessDeferred();
+  EXPECT_EQ(messages.size(), 10u);
+}
+
+TEST(LoggerTest, DeferredDropsBelowMinLevel) {
+  std::vector<std::string> messages;
+  wpi::Logger logger{[&](unsigned int level, const char* file,
+                         unsigned int line,
+                         const char* msg) { messages.emplace_back(msg); }};
+  logger.SetDeferred();
+  logger.set_min_level(wpi::WPI_LOG_DEBUG);
+
+  WPI_DEBUG(logger, "noisy {}", 1);
+  logger.set_min_level(wpi::WPI_LOG_INFO);
+  logger.ProcessDeferred();
+  EXPECT_TRUE(messages.empty());
+}
@@ -0,0 +1,91 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "wpi/ObjectPool.h"  // NOLINT(build/include_order)
+
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+TEST(ObjectPoolTest, RecyclesObject) {
+  auto pool = wpi::ObjectPool<std::vector<double>>::Create();
+
+  std::vector<double>* first;
+  {
+    auto obj = pool->Acquire();
+    obj->assign({1.0, 2.0, 3.0});
+    first = obj.get();
+  }
+
+  // released object comes back, capacity intact
+  auto obj = pool->Acquire();
+  EXPECT_EQ(obj.get(), first);
+  EXPECT_GE(obj->capacity(), 3u);
+
+  auto stats = pool->GetStatistics();
+  EXPECT_EQ(stats.acquires, 2u);
+  EXPECT_EQ(stats.hits, 1u);
+  EXPECT_EQ(stats.allocations, 1u);
+}
+
+TEST(ObjectPoolTest, ReleaseAfterPoolDestroyed) {
+  std::shared_ptr<std::vector<double>> survivor;
+  {
+    auto pool = wpi::ObjectPool<std::vector<double>>::Create();
+    survivor = pool->Acquire();
+    survivor->assign({1.0});
+  }
+  // the pool is gone; dropping the object must free it, not recycle it
+  survivor.reset();
+}
+
+TEST(ObjectPoolTest, NewPoolDoesNotInheritStaleThreadCache) {
+  auto pool1 = wpi::ObjectPool<std::vector<int>>::Create();
+  { auto obj = pool1->Acquire(); }
+  pool1.reset();
+
+  // a fresh pool on the same thread must not serve pool1's cached object
+  auto pool2 = wpi::ObjectPool<std::vector<int>>::Create();
+  { auto obj = pool2->Acquire(); }
+  auto stats = pool2->GetStatistics();
+  EXPECT_EQ(stats.allocations, 1u);
+  EXPECT_EQ(stats.hits, 0u);
+}
+
+TEST(ObjectPoolTest, CrossThreadRelease) {
+  auto pool = wpi::ObjectPool<std::vector<int>>::Create();
+
+  auto obj = pool->Acquire();
+  obj->assign(100, 42);
+  std::thread releaser([obj = std::move(obj)]() mutable { obj.reset(); });
+  releaser.join();
+
+  auto stats = pool->GetStatistics();
+  EXPECT_EQ(stats.acquires, 1u);
+  EXPECT_EQ(stats.allocations, 1u);
+}
+
+TEST(ObjectPoolTest, ConcurrentChurn) {
+  auto pool = wpi::ObjectPool<std::vector<int>>::Create();
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&] {
+      for (int i = 0; i < 1000; ++i) {
+        auto obj = pool->Acquire();
+        obj->assign(16, i);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto stats = pool->GetStatistics();
+  EXPECT_EQ(stats.acquires, 4000u);
+  EXPECT_EQ(stats.hits + stats.allocations, stats.acquires);
+  // steady-state churn should be served almost entirely from the pool
+  EXPECT_GT(stats.hits, stats.allocations);
+}
@@ -0,0 +1,223 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "wpi/sendable/SendableBuilder.h"
+
+namespace {
+
+struct TestData {
+  bool enabled = false;
+  int64_t count = 0;
+  double voltage = 0.0;
+  std::string name;
+
+  double GetVoltage() const { return voltage; }
+  void SetCount(int64_t value) { count = value; }
+  std::string GetName() const { return name; }
+  void SetName(std::string_view value) { name = value; }
+};
+
+// table construction must be possible at compile time
+constexpr wpi::SendableProperty kTable[] = {
+    wpi::SendableProperty::Boolean<&TestData::enabled, &TestData::enabled>(
+        "enabled"),
+    wpi::SendableProperty::Integer<&TestData::count, &TestData::SetCount>(
+        "count"),
+    wpi::SendableProperty::Double<&TestData::GetVoltage>("voltage"),
+    wpi::SendableProperty::String<&TestData::GetName, &TestData::SetName>(
+        "name")};
+
+// records the std::function forms produced by the default AddPropertyTable()
+class MockSendableBuilder : public wpi::SendableBuilder {
+ public:
+  struct BoolProp {
+    std::string key;
+    std::function<bool()> getter;
+    std::function<void(bool)> setter;
+  };
+  struct IntProp {
+    std::string key;
+    std::function<int64_t()> getter;
+    std::function<void(int64_t)> setter;
+  };
+  struct DoubleProp {
+    std::string key;
+    std::function<double()> getter;
+    std::function<void(double)> setter;
+  };
+  struct StringProp {
+    std::string key;
+    std::function<std::string()> getter;
+    std::function<void(std::string_view)> setter;
+  };
+  std::vector<BoolProp> boolProps;
+  std::vector<IntProp> intProps;
+  std::vector<DoubleProp> doubleProps;
+  std::vector<StringProp> stringProps;
+
+  void SetSmartDashboardType(std::string_view type) override {}
+  void SetActuator(bool value) override {}
+  void SetSafeState(std::function<void()> func) override {}
+  void AddBooleanProperty(std::string_view key, std::function<bool()> getter,
+                          std::function<void(bool)> setter) override {
+    boolProps.emplace_back(
+        BoolProp{std::string{key}, std::move(getter), std::move(setter)});
+  }
+  void AddIntegerProperty(std::string_view key, std::function<int64_t()> getter,
+                          std::function<void(int64_t)> setter) override {
+    intProps.emplace_back(
+        IntProp{std::string{key}, std::move(getter), std::move(setter)});
+  }
+  void AddFloatProperty(std::string_view key, std::function<float()> getter,
+                        std::function<void(float)> setter) override {}
+  void AddDoubleProperty(std::string_view key, std::function<double()> getter,
+                         std::function<void(double)> setter) override {
+    doubleProps.emplace_back(
+        DoubleProp{std::string{key}, std::move(getter), std::move(setter)});
+  }
+  void AddStringProperty(
+      std::string_view key, std::function<std::string()> getter,
+      std::function<void(std::string_view)> setter) override {
+    stringProps.emplace_back(
+        StringProp{std::string{key}, std::move(getter), std::move(setter)});
+  }
+  void AddBooleanArrayProperty(
+      std::string_view key, std::function<std::vector<int>()> getter,
+      std::function<void(std::span<const int>)> setter) override {}
+  void AddIntegerArrayProperty(
+      std::string_view key, std::function<std::vector<int64_t>()> getter,
+      std::function<void(std::span<const int64_t>)> setter) override {}
+  void AddFloatArrayProperty(
+      std::string_view key, std::function<std::vector<float>()> getter,
+      std::function<void(std::span<const float>)> setter) override {}
+  void AddDoubleArrayProperty(
+      std::string_view key, std::function<std::vector<double>()> getter,
+      std::function<void(std::span<const double>)> setter) override {}
+  void AddStringArrayProperty(
+      std::string_view key, std::function<std::vector<std::string>()> getter,
+      std::function<void(std::span<const std::string>)> setter) override {}
+  void AddRawProperty(
+      std::string_view key, std::string_view typeString,
+      std::function<std::vector<uint8_t>()> getter,
+      std::function<void(std::span<const uint8_t>)> setter) override {}
+  void AddSmallStringProperty(
+      std::string_view key,
+      std::function<std::string_view(wpi::SmallVectorImpl<char>& buf)> getter,
+      std::function<void(std::string_view)> setter) override {}
+  void AddSmallBooleanArrayProperty(
+      std::string_view key,
+      std::function<std::span<const int>(wpi::SmallVectorImpl<int>& buf)>
+          getter,
+      std::function<void(std::span<const int>)> setter) override {}
+  void AddSmallIntegerArrayProperty(
+      std::string_view key,
+      std::function<
+          std::span<const int64_t>(wpi::SmallVectorImpl<int64_t>& buf)>
+          getter,
+      std::function<void(std::span<const int64_t>)> setter) override {}
+  void AddSmallFloatArrayProperty(
+      std::string_view key,
+      std::function<std::span<const float>(wpi::SmallVectorImpl<float>& buf)>
+          getter,
+      std::function<void(std::span<const float>)> setter) override {}
+  void AddSmallDoubleArrayProperty(
+      std::string_view key,
+      std::function<std::span<const double>(wpi::SmallVectorImpl<double>& buf)>
+          getter,
+      std::function<void(std::span<const double>)> setter) override {}
+  void AddSmallStringArrayProperty(
+      std::string_view key,
+      std::function<
+          std::span<const std::string>(wpi::SmallVectorImpl<std::string>& buf)>
+          getter,
+      std::function<void(std::span<const std::string>)> setter) override {}
+  void AddSmallRawProperty(
+      std::string_view key, std::string_view typeString,
+      std::function<std::span<uint8_t>(wpi::SmallVectorImpl<uint8_t>& buf)>
+          getter,
+      std::function<void(std::span<const uint8_t>)> setter) override {}
+  BackendKind GetBackendKind() const override { return kUnknown; }
+  bool IsPublished() const override { return true; }
+  void Update() override {}
+  void ClearProperties() override {}
+};
+
+}  // namespace
+
+TEST(SendablePropertyTest, MemberObjectAccessors) {
+  constexpr auto prop =
+      wpi::SendableProperty::Boolean<&TestData::enabled, &TestData::enabled>(
+          "enabled");
+  TestData data;
+  ASSERT_FALSE(prop.boolGetter(&data));
+  prop.boolSetter(&data, true);
+  ASSERT_TRUE(data.enabled);
+  ASSERT_TRUE(prop.boolGetter(&data));
+}
+
+TEST(SendablePropertyTest, MemberFunctionAccessors) {
+  constexpr auto prop =
+      wpi::SendableProperty::Integer<&TestData::count, &TestData::SetCount>(
+          "count");
+  TestData data;
+  prop.intSetter(&data, 7);
+  ASSERT_EQ(data.count, 7);
+  ASSERT_EQ(prop.intGetter(&data), 7);
+}
+
+TEST(SendablePropertyTest, ReadOnly) {
+  constexpr auto prop =
+      wpi::SendableProperty::Double<&TestData::GetVoltage>("voltage");
+  TestData data;
+  data.voltage = 2.5;
+  ASSERT_EQ(prop.doubleGetter(&data), 2.5);
+  ASSERT_EQ(prop.doubleSetter, nullptr);
+}
+
+TEST(SendablePropertyTest, String) {
+  constexpr auto prop =
+      wpi::SendableProperty::String<&TestData::GetName, &TestData::SetName>(
+          "name");
+  TestData data;
+  prop.stringSetter(&data, "motor");
+  ASSERT_EQ(data.name, "motor");
+  ASSERT_EQ(prop.stringGetter(&data), "motor");
+}
+
+TEST(SendablePropertyTest, DefaultBuilderDispatch) {
+  MockSendableBuilder builder;
+  TestData data;
+  builder.AddPropertyTable(&data, kTable);
+
+  ASSERT_EQ(builder.boolProps.size(), 1u);
+  ASSERT_EQ(builder.intProps.size(), 1u);
+  ASSERT_EQ(builder.doubleProps.size(), 1u);
+  ASSERT_EQ(builder.stringProps.size(), 1u);
+
+  auto& boolProp = builder.boolProps[0];
+  ASSERT_EQ(boolProp.key, "enabled");
+  boolProp.setter(true);
+  ASSERT_TRUE(data.enabled);
+  ASSERT_TRUE(boolProp.getter());
+
+  auto& intProp = builder.intProps[0];
+  ASSERT_EQ(intProp.key, "count");
+  intProp.setter(42);
+  ASSERT_EQ(intProp.getter(), 42);
+
+  auto& doubleProp = builder.doubleProps[0];
+  ASSERT_EQ(doubleProp.key, "voltage");
+  data.voltage = 1.25;
+  ASSERT_EQ(doubleProp.getter(), 1.25);
+  ASSERT_FALSE(doubleProp.setter);  // read-only entry forwards a null setter
+
+  auto& stringProp = builder.stringProps[0];
+  ASSERT_EQ(stringProp.key, "name");
+  stringProp.setter("arm");
+  ASSERT_EQ(stringProp.getter(), "arm");
+}
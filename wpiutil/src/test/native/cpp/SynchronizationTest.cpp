@@ -4,7 +4,9 @@
 
 #include "wpi/Synchronization.h"  // NOLINT(build/include_order)
 
+#include <atomic>
 #include <thread>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -54,3 +56,36 @@ TEST(EventTest, WaitMultiple) {
   ASSERT_EQ(timedOut, true);
   ASSERT_EQ(result2.size(), 0u);
 }
+
+TEST(EventTest, ManyWaitersManySignalers) {
+  constexpr int kNumEvents = 32;
+
+  WPI_EventHandle events[kNumEvents];
+  for (auto& event : events) {
+    event = wpi::CreateEvent(false, false);
+  }
+
+  // One waiter and one signaler per event, all running concurrently, so
+  // handles land in different shards and signal each other in parallel.
+  std::vector<std::thread> threads;
+  std::atomic<int> wakeups{0};
+  for (auto& event : events) {
+    threads.emplace_back([&, event] {
+      if (wpi::WaitForObject(event)) {
+        ++wakeups;
+      }
+    });
+  }
+  for (auto& event : events) {
+    threads.emplace_back([event] { wpi::SetEvent(event); });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  ASSERT_EQ(wakeups, kNumEvents);
+
+  for (auto& event : events) {
+    wpi::DestroyEvent(event);
+  }
+}
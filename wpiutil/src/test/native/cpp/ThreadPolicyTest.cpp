@@ -0,0 +1,79 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include "gtest/gtest.h"
+#include "wpi/ThreadPolicy.h"
+
+namespace {
+bool HasName(std::string_view name) {
+  auto names = wpi::GetRegisteredThreadNames();
+  return std::find(names.begin(), names.end(), name) != names.end();
+}
+}  // namespace
+
+TEST(ThreadPolicyTest, RegisterUnregister) {
+  std::atomic<bool> registered{false};
+  std::atomic<bool> release{false};
+  std::thread thr{[&] {
+    wpi::RegisterCurrentThread("TPTestThread");
+    registered = true;
+    while (!release) {
+      std::this_thread::yield();
+    }
+    wpi::UnregisterCurrentThread();
+  }};
+  while (!registered) {
+    std::this_thread::yield();
+  }
+  EXPECT_TRUE(HasName("TPTestThread"));
+  release = true;
+  thr.join();
+  EXPECT_FALSE(HasName("TPTestThread"));
+}
+
+TEST(ThreadPolicyTest, PolicyAppliesToLaterThreads) {
+  // Affinity can be set without elevated privileges, so use it to observe
+  // that a pattern set before a thread registers is applied at registration
+  wpi::ThreadPolicy policy;
+  policy.affinityMask = 1;  // core 0 only
+  EXPECT_TRUE(wpi::SetThreadPolicy("TPAffinity*", policy));
+
+  std::atomic<bool> done{false};
+  std::thread thr{[&] {
+    wpi::RegisterCurrentThread("TPAffinityThread");
+    done = true;
+    wpi::UnregisterCurrentThread();
+  }};
+  while (!done) {
+    std::this_thread::yield();
+  }
+  thr.join();
+}
+
+TEST(ThreadPolicyTest, PatternMatchesExistingThreads) {
+  std::atomic<bool> registered{false};
+  std::atomic<bool> release{false};
+  std::thread thr{[&] {
+    wpi::RegisterCurrentThread("TPMatchThread");
+    registered = true;
+    while (!release) {
+      std::this_thread::yield();
+    }
+    wpi::UnregisterCurrentThread();
+  }};
+  while (!registered) {
+    std::this_thread::yield();
+  }
+
+  wpi::ThreadPolicy policy;
+  policy.affinityMask = 1;
+  EXPECT_TRUE(wpi::SetThreadPolicy("TPMatch*", policy));
+
+  release = true;
+  thr.join();
+}
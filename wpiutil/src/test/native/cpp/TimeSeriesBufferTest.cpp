@@ -0,0 +1,63 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "wpi/time_series_buffer.h"  // NOLINT(build/include_order)
+
+#include "gtest/gtest.h"
+
+TEST(TimeSeriesBufferTest, InsertAppend) {
+  wpi::time_series_buffer<int> buf{8};
+  buf.insert(1.0, 10);
+  buf.insert(2.0, 20);
+  buf.insert(3.0, 30);
+  ASSERT_EQ(buf.size(), 3u);
+  EXPECT_EQ(buf.time(0), 1.0);
+  EXPECT_EQ(buf.value(2), 30);
+}
+
+TEST(TimeSeriesBufferTest, InsertOutOfOrder) {
+  wpi::time_series_buffer<int> buf{8};
+  buf.insert(1.0, 10);
+  buf.insert(3.0, 30);
+  buf.insert(2.0, 20);
+  ASSERT_EQ(buf.size(), 3u);
+  EXPECT_EQ(buf.value(0), 10);
+  EXPECT_EQ(buf.value(1), 20);
+  EXPECT_EQ(buf.value(2), 30);
+}
+
+TEST(TimeSeriesBufferTest, DropsOldestWhenFull) {
+  wpi::time_series_buffer<int> buf{3};
+  for (int i = 0; i < 5; ++i) {
+    buf.insert(i, i * 10);
+  }
+  ASSERT_EQ(buf.size(), 3u);
+  EXPECT_EQ(buf.time(0), 2.0);
+  EXPECT_EQ(buf.value(2), 40);
+
+  // older than everything held by a full buffer: discarded
+  buf.insert(0.5, 5);
+  EXPECT_EQ(buf.time(0), 2.0);
+}
+
+TEST(TimeSeriesBufferTest, ExpireBefore) {
+  wpi::time_series_buffer<int> buf{8};
+  for (int i = 0; i < 5; ++i) {
+    buf.insert(i, i);
+  }
+  buf.expire_before(2.5);
+  ASSERT_EQ(buf.size(), 2u);
+  EXPECT_EQ(buf.time(0), 3.0);
+}
+
+TEST(TimeSeriesBufferTest, LowerBoundWrapsRing) {
+  wpi::time_series_buffer<int> buf{4};
+  for (int i = 0; i < 10; ++i) {
+    buf.insert(i, i);  // ring wraps several times
+  }
+  ASSERT_EQ(buf.size(), 4u);
+  EXPECT_EQ(buf.lower_bound(6.5), 1u);
+  EXPECT_EQ(buf.lower_bound(6.0), 0u);
+  EXPECT_EQ(buf.lower_bound(100.0), 4u);
+}
@@ -0,0 +1,68 @@
+// Copyright (c) FIRST and other WPILib contributors.
+// Open Source Software; you can modify and/or share it under the terms of
+// the WPILib BSD license file in the root directory of this project.
+
+#include "wpi/Tracing.h"  // NOLINT(build/include_order)
+
+#include <string_view>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+TEST(TracingTest, DisabledRecordsNothing) {
+  wpi::tracing::SetEnabled(false);
+  wpi::tracing::Drain();  // discard anything from earlier tests
+  { wpi::tracing::Span span{"disabled"}; }
+  auto traces = wpi::tracing::Drain();
+  ASSERT_TRUE(traces.empty());
+}
+
+TEST(TracingTest, SpanRecordsBeginEnd) {
+  wpi::tracing::SetEnabled(true);
+  wpi::tracing::Drain();
+  {
+    wpi::tracing::Span outer{"outer"};
+    wpi::tracing::Span inner{"inner"};
+  }
+  wpi::tracing::SetEnabled(false);
+  auto traces = wpi::tracing::Drain();
+  ASSERT_EQ(traces.size(), 1u);
+  auto& events = traces[0].events;
+  ASSERT_EQ(events.size(), 4u);
+  ASSERT_EQ(std::string_view{events[0].name}, "outer");
+  ASSERT_TRUE(events[0].begin);
+  ASSERT_EQ(std::string_view{events[1].name}, "inner");
+  ASSERT_TRUE(events[1].begin);
+  // destruction order: inner ends before outer
+  ASSERT_EQ(std::string_view{events[2].name}, "inner");
+  ASSERT_FALSE(events[2].begin);
+  ASSERT_EQ(std::string_view{events[3].name}, "outer");
+  ASSERT_FALSE(events[3].begin);
+  ASSERT_LE(events[0].time, events[3].time);
+}
+
+TEST(TracingTest, PerThreadBuffers) {
+  wpi::tracing::SetEnabled(true);
+  wpi::tracing::Drain();
+  { wpi::tracing::Span span{"main"}; }
+  std::thread thr([] { wpi::tracing::Span span{"worker"}; });
+  thr.join();
+  wpi::tracing::SetEnabled(false);
+  auto traces = wpi::tracing::Drain();
+  ASSERT_EQ(traces.size(), 2u);
+  ASSERT_NE(traces[0].threadId, traces[1].threadId);
+  for (auto&& trace : traces) {
+    ASSERT_EQ(trace.events.size(), 2u);
+  }
+}
+
+TEST(TracingTest, ChromeTraceExport) {
+  wpi::tracing::SetEnabled(true);
+  wpi::tracing::Drain();
+  { wpi::tracing::Span span{"json"}; }
+  wpi::tracing::SetEnabled(false);
+  auto json = wpi::tracing::ExportChromeTrace();
+  ASSERT_NE(json.find("\"name\":\"json\""), std::string::npos);
+  ASSERT_NE(json.find("\"ph\":\"B\""), std::string::npos);
+  ASSERT_NE(json.find("\"ph\":\"E\""), std::string::npos);
+}